@@ -103,7 +103,10 @@
 #include "text_parser.h"
 #include "canonical_machine.h"
 #include "plan_arc.h"
+#include "plan_fit.h"
+#include "plan_merge.h"
 #include "planner.h"
+#include "metrics.h"
 //#include "stepper.h"
 //#include "spindle.h"
 #include "report.h"
@@ -540,6 +543,9 @@ void cm_set_move_times(GCodeState_t *gcode_state)
 		gcode_state->minimum_time = min(gcode_state->minimum_time, tmp_time);
 	}
 	gcode_state->move_time = max4(inv_time, max_time, xyz_time, abc_time);
+	if ((gm.motion_mode == MOTION_MODE_STRAIGHT_FEED) && (max_time > max3(inv_time, xyz_time, abc_time))) {
+		jm.clamped++;					// an axis feed rate limit slowed the move
+	}
 }
 
 /*
@@ -872,7 +878,7 @@ stat_t cm_straight_traverse(float target[], float flags[])
 	cm_set_work_offsets(&gm);					// capture the fully resolved offsets to the state
 	cm_set_move_times(&gm);						// set move time and minimum time in the state
 	cm_cycle_start();							// required for homing & other cycles
-	stat_t status = mp_aline(&gm);				// run the move
+	stat_t status = mp_fit_aline(&gm);			// run the move, fitted or merged with its neighbours if it can be
 	cm_conditional_set_model_position(status);	// update position if the move was successful
 	return (status);
 }
@@ -1002,7 +1008,7 @@ stat_t cm_straight_feed(float target[], float flags[])
 	cm_set_work_offsets(&gm);					// capture the fully resolved offsets to the state
 	cm_set_move_times(&gm);						// set move time and minimum time in the state
 	cm_cycle_start();							// required for homing & other cycles
-	stat_t status = mp_aline(&gm);				// run the move
+	stat_t status = mp_fit_aline(&gm);			// run the move, fitted or merged with its neighbours if it can be
 	cm_conditional_set_model_position(status);	// update position if the move was successful
 	return (status);
 }
@@ -1818,12 +1824,34 @@ const char fmt_ct[] PROGMEM = "[ct]  chordal tolerance%16.3f%s\n";
 const char fmt_ml[] PROGMEM = "[ml]  min line segment%17.3f%s\n";
 const char fmt_ma[] PROGMEM = "[ma]  min arc segment%18.3f%s\n";
 const char fmt_ms[] PROGMEM = "[ms]  min segment time%13.0f uSec\n";
+const char fmt_mb[] PROGMEM = "[mb]  long body segments%11d [0=off,1=on]\n";
+const char fmt_mc[] PROGMEM = "[mc]  step-exact s-curves%10d [0=off,1=on]\n";
+const char fmt_mp[] PROGMEM = "[mp]  segment velocity step%12.0f%s/min [0=fixed segments]\n";
+const char fmt_mn[] PROGMEM = "[mn]  native arcs%18d [0=off,1=on]\n";
+const char fmt_mg[] PROGMEM = "[mg]  merge angle%18.2f deg [0=off]\n";
+const char fmt_mf[] PROGMEM = "[mf]  merge rate tolerance%9.1f %%\n";
+const char fmt_mw[] PROGMEM = "[mw]  fit arcs to short moves%6d [0=off,1=on]\n";
+const char fmt_mx[] PROGMEM = "[mx]  arc fit tolerance%16.3f%s\n";
+const char fmt_seg[] PROGMEM = "Segments in last move:%7d\n";
+const char fmt_mrg[] PROGMEM = "Moves merged:%16d\n";
+const char fmt_fit[] PROGMEM = "Moves fitted to arcs:%8d\n";
 
 void cm_print_ja(cmdObj_t *cmd) { text_print_flt_units(cmd, fmt_ja, GET_UNITS(ACTIVE_MODEL));}
 void cm_print_ct(cmdObj_t *cmd) { text_print_flt_units(cmd, fmt_ct, GET_UNITS(ACTIVE_MODEL));}
 void cm_print_ml(cmdObj_t *cmd) { text_print_flt_units(cmd, fmt_ml, GET_UNITS(ACTIVE_MODEL));}
 void cm_print_ma(cmdObj_t *cmd) { text_print_flt_units(cmd, fmt_ma, GET_UNITS(ACTIVE_MODEL));}
 void cm_print_ms(cmdObj_t *cmd) { text_print_flt_units(cmd, fmt_ms, GET_UNITS(ACTIVE_MODEL));}
+void cm_print_mb(cmdObj_t *cmd) { text_print_ui8(cmd, fmt_mb);}
+void cm_print_mc(cmdObj_t *cmd) { text_print_ui8(cmd, fmt_mc);}
+void cm_print_mp(cmdObj_t *cmd) { text_print_flt_units(cmd, fmt_mp, GET_UNITS(ACTIVE_MODEL));}
+void cm_print_mn(cmdObj_t *cmd) { text_print_ui8(cmd, fmt_mn);}
+void cm_print_mg(cmdObj_t *cmd) { text_print_flt(cmd, fmt_mg);}
+void cm_print_mf(cmdObj_t *cmd) { text_print_flt(cmd, fmt_mf);}
+void cm_print_mw(cmdObj_t *cmd) { text_print_ui8(cmd, fmt_mw);}
+void cm_print_mx(cmdObj_t *cmd) { text_print_flt_units(cmd, fmt_mx, GET_UNITS(ACTIVE_MODEL));}
+void cm_print_seg(cmdObj_t *cmd) { text_print_int(cmd, fmt_seg);}
+void cm_print_mrg(cmdObj_t *cmd) { text_print_int(cmd, fmt_mrg);}
+void cm_print_fit(cmdObj_t *cmd) { text_print_int(cmd, fmt_fit);}
 
 /*
  * axis print functions
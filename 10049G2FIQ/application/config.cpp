@@ -56,6 +56,8 @@
 #include "util.h"
 #include "xio.h"
 
+#include <unistd.h>
+
 #ifdef __cplusplus
 extern "C"{
 #endif
@@ -150,9 +152,32 @@ void config_init()
 	    }
 	    sr_init_status_report();
 	}
+	cmd_commit_NVM();						// write back defaults loaded into a new or old config
 // End of persistance code.
 }
 
+/*
+ * cmd_hash_config() - 64 bit hash of the config values config_init() loaded
+ *
+ *	Hashes the value of every item initialized from the config file, as its get
+ *	function reports it. The converter build is keyed separately (BUILD_ID).
+ *	Keys the output cache (output_cache.cpp).
+ */
+uint64_t cmd_hash_config()
+{
+	uint64_t hash = 0;
+
+	for (index_t i=0; cmd_index_is_single(i); i++) {
+		cmdObj_t *cmd = cmd_reset_list();
+		cmd->index = i;
+		if ((GET_TABLE_BYTE(flags) & F_INITIALIZE) == 0) continue;
+		cmd_get(cmd);
+		hash = compute_hash(hash, &cmd->value, sizeof(cmd->value));
+	}
+	cmd_reset_list();
+	return (hash);
+}
+
 /*
  * set_defaults() - reset NVM with default values for active profile
  */
@@ -402,30 +427,49 @@ uint8_t cmd_group_is_prefixed(char *group)
 
 /* cmd_get_index() - get index from mnenonic token + group
  *
- * cmd_get_index() is the most expensive routine in the whole config. It does a
- * linear table scan of the PROGMEM strings, which of course could be further
- * optimized with indexes or hashing.
+ * cmd_get_index() used to be the most expensive routine in the whole config - a
+ * linear table scan of the PROGMEM strings. It now binary searches cmdTokenIndex[],
+ * a list of cfgArray indexes sorted by token that _index_tokens() builds on first
+ * use. Ties sort by index so a duplicated token resolves to its first table entry,
+ * as the old scan did.
  */
+static uint8_t tokens_indexed = false;
+
+static int _compare_tokens(const void *a, const void *b)
+{
+	index_t i = *(const index_t *)a;
+	index_t j = *(const index_t *)b;
+	int cmp = strcmp(cfgArray[i].token, cfgArray[j].token);
+	if (cmp != 0) return (cmp);
+	return ((i < j) ? -1 : 1);
+}
+
+static void _index_tokens()
+{
+	index_t index_max = cmd_index_max();
+
+	for (index_t i=0; i < index_max; i++) { cmdTokenIndex[i] = i;}
+	qsort(cmdTokenIndex, index_max, sizeof(index_t), _compare_tokens);
+	tokens_indexed = true;
+}
+
 index_t cmd_get_index(const char *group, const char*token)
 {
-    char c;
     char str[CMD_TOKEN_LEN+1];
 	strcpy(str, group);
 	strcat(str, token);
 
-	index_t index_max = cmd_index_max();
+	if (tokens_indexed == false) _index_tokens();
 
-	for (index_t i=0; i < index_max; i++) {
-		if ((c = GET_TOKEN_BYTE(token[0])) != str[0]) {	continue; }			// 1st character mismatch
-		if ((c = GET_TOKEN_BYTE(token[1])) == NUL) { if (str[1] == NUL) return(i);}	// one character match
-		if (c != str[1]) continue;							// 2nd character mismatch
-		if ((c = GET_TOKEN_BYTE(token[2])) == NUL) { if (str[2] == NUL) return(i);}	// two character match
-		if (c != str[2]) continue;							// 3rd character mismatch
-		if ((c = GET_TOKEN_BYTE(token[3])) == NUL) { if (str[3] == NUL) return(i);}	// three character match
-		if (c != str[3]) continue;							// 4th character mismatch
-		if ((c = GET_TOKEN_BYTE(token[4])) == NUL) { if (str[4] == NUL) return(i);}	// four character match
-		if (c != str[4]) continue;							// 5th character mismatch
-		return(i);									// five character match
+	index_t lo = 0;									// lower bound of the first token >= str
+	index_t hi = cmd_index_max();
+	while (lo < hi) {
+		index_t mid = lo + (hi - lo) / 2;
+		if (strcmp(cfgArray[cmdTokenIndex[mid]].token, str) < 0) { lo = mid + 1;}
+		else { hi = mid;}
+	}
+	if ((lo < cmd_index_max()) && (strcmp(cfgArray[cmdTokenIndex[lo]].token, str) == 0)) {
+		return (cmdTokenIndex[lo]);
 	}
 	return (NO_MATCH);
 }
@@ -677,61 +721,101 @@ void cmd_print_list(stat_t status, uint8_t text_flags, uint8_t json_flags)
  ************************************************************************************
  * cmd_read_NVM_value()	 - return value (as float) by index
  * cmd_write_NVM_value() - write to NVM by index, but only if the value has changed
+ * cmd_commit_NVM()		 - write the NVM image back to the config file if it changed
+ *
+ *	The config file is read once into an in-memory image on first access. Reads and
+ *	writes are served from the image and cmd_commit_NVM() writes a changed image to
+ *	a temp file that is renamed over the config file, so a crash mid-write can't
+ *	leave a half written config behind. It runs at the end of config_init(), after
+ *	each $ line the text parser sets - so a set_defaults() pass is one write - and as
+ *	the controller exits. The file layout is unchanged: the value for an index starts
+ *	at byte offset index.
  *
  *	It's the responsibility of the caller to make sure the index does not exceed range
  */
-stat_t cmd_read_NVM_value(cmdObj_t *cmd, index_t index)
+static nvmImage_t nvm;
+
+static void _nvm_load()
 {
-  size_t tempsize;
-  int8_t nvm_byte_array[NVM_VALUE_LEN];
+	FILE *fp;
+	long size;
 
-    Cfg_fp = fopen(ConfigPathFile, "rb");
-    if (!Cfg_fp)
-        {
-            printf("Can't Open Config file %s\n", ConfigPathFile);
-            return(STAT_FILE_NOT_OPEN);
-        }
+	if (nvm.loaded) return;
+	nvm.loaded = true;
+	if ((fp = fopen(ConfigPathFile, "rb")) == NULL) return;
+	nvm.exists = true;
+	if ((fseek(fp, 0, SEEK_END) == 0) && ((size = ftell(fp)) > 0) &&
+		((nvm.buf = (uint8_t *)malloc(size)) != NULL)) {
+		rewind(fp);
+		nvm.size = fread(nvm.buf, 1, size, fp);
+	}
+	fclose(fp);
+}
 
-    fseek(Cfg_fp, index, SEEK_SET);
-    tempsize = fread(&nvm_byte_array, 1, NVM_VALUE_LEN, Cfg_fp);
-    fclose(Cfg_fp);
-    if (tempsize != NVM_VALUE_LEN)
-        return(STAT_BUFFER_EMPTY);
+stat_t cmd_read_NVM_value(cmdObj_t *cmd, index_t index)
+{
+	_nvm_load();
+	if ((nvm.exists == false) && (nvm.dirty == false)) {
+		printf("Can't Open Config file %s\n", ConfigPathFile);
+		return(STAT_FILE_NOT_OPEN);
+	}
+	if ((uint32_t)index + NVM_VALUE_LEN > nvm.size)
+		return(STAT_BUFFER_EMPTY);
 
-    memcpy(&cmd->value, &nvm_byte_array, NVM_VALUE_LEN);
-    return (STAT_OK);
+	memcpy(&cmd->value, &nvm.buf[index], NVM_VALUE_LEN);
+	return (STAT_OK);
 }
 
 stat_t cmd_write_NVM_value(cmdObj_t *cmd, index_t index)
 {
-  int8_t nvm_byte_array[NVM_VALUE_LEN];
+	uint32_t end = (uint32_t)index + NVM_VALUE_LEN;
 
-    if (cm.cycle_state != CYCLE_OFF) return (STAT_FILE_NOT_OPEN);	// can't write when machine is moving
-//    float tmp = cmd->value;
+	if (cm.cycle_state != CYCLE_OFF) return (STAT_FILE_NOT_OPEN);	// can't write when machine is moving
 
-    Cfg_fp = fopen(ConfigPathFile, "r+b");
-    if (!Cfg_fp)
-        {
-            printf("New Config file %s\n", ConfigPathFile);
-            Cfg_fp = fopen(ConfigPathFile, "wb");
-            if  (!Cfg_fp)
-            {
-                printf("Can't Open Config file %s\n", ConfigPathFile);
-                return(STAT_FILE_NOT_OPEN);
-            }
-        }
+	_nvm_load();
+	if (end > nvm.size) {							// writing past the end extends the file with zeros
+		uint8_t *grown = (uint8_t *)realloc(nvm.buf, end);
+		if (grown == NULL) return(STAT_FILE_SIZE_EXCEEDED);
+		memset(&grown[nvm.size], 0, end - nvm.size);
+		nvm.buf = grown;
+		nvm.size = end;
+		nvm.dirty = true;
+	}
+	if (memcmp(&nvm.buf[index], &cmd->value, NVM_VALUE_LEN) != 0) {
+		memcpy(&nvm.buf[index], &cmd->value, NVM_VALUE_LEN);
+		nvm.dirty = true;
+	}
+	return (STAT_OK);
+}
 
-    if( 0 != fseek(Cfg_fp, index, SEEK_SET) )
-    {
-        fclose(Cfg_fp);
-        return(STAT_FILE_SIZE_EXCEEDED);
-    }
+stat_t cmd_commit_NVM()
+{
+	char temp[FILE_PATH_NAME_LEN + 8];
+	FILE *fp;
+	uint8_t failed;
 
-    memcpy(&nvm_byte_array, &cmd->value, NVM_VALUE_LEN);
-    fwrite(&cmd->value, 1, NVM_VALUE_LEN, Cfg_fp);
-    fclose(Cfg_fp);
+	if (nvm.dirty == false) return (STAT_NOOP);
 
-    return (STAT_OK);
+	snprintf(temp, sizeof(temp), "%s.tmp", ConfigPathFile);
+	if ((fp = fopen(temp, "wb")) == NULL) {
+		printf("Can't Open Config file %s\n", temp);
+		return(STAT_FILE_NOT_OPEN);
+	}
+	failed = (fwrite(nvm.buf, 1, nvm.size, fp) != nvm.size) || (fflush(fp) != 0);
+	if ((NVM_FSYNC == true) && (failed == false)) {
+		failed = (fsync(fileno(fp)) != 0);
+	}
+	if ((fclose(fp) != 0) || (failed) || (rename(temp, ConfigPathFile) != 0)) {
+		printf("Can't Write Config file %s\n", ConfigPathFile);
+		remove(temp);
+		return(STAT_FILE_NOT_OPEN);
+	}
+	if (nvm.exists == false) {
+		printf("New Config file %s\n", ConfigPathFile);
+		nvm.exists = true;
+	}
+	nvm.dirty = false;
+	return (STAT_OK);
 }
 
 /****************************************************************************
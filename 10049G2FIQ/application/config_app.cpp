@@ -50,6 +50,9 @@
 #include "text_parser.h"
 #include "settings.h"
 #include "planner.h"
+#include "plan_fit.h"
+#include "profile.h"
+#include "plan_merge.h"
 #include "stepper.h"
 #include "switch.h"
 //#include "pwm.h"
@@ -137,6 +140,9 @@ const cfgItem_t cfgArray[] PROGMEM = {
 	{ "",   "dist",_f00, 0, cm_print_dist, cm_get_dist, set_nul,(float *)&cs.null, 0 },	// distance mode
 	{ "",   "frmo",_f00, 0, cm_print_frmo, cm_get_frmo, set_nul,(float *)&cs.null, 0 },	// feed rate mode
 	{ "",   "tool",_f00, 0, cm_print_tool, cm_get_toolv,set_nul,(float *)&cs.null, 0 },	// active tool
+	{ "",   "seg", _f00, 0, cm_print_seg,  get_int,     set_nul,(float *)&mr.last_move_segments, 0 },// segments in last move
+	{ "",   "mrg", _f00, 0, cm_print_mrg,  get_int,     set_nul,(float *)&merge.total_merged, 0 },// moves merged into others
+	{ "",   "fit", _f00, 0, cm_print_fit,  get_int,     set_nul,(float *)&fit.total_fitted, 0 },// moves fitted to arcs
 //	{ "",   "tick",_f00, 0, tx_print_int,  get_int,     set_int,(float *)&rtc.sys_ticks, 0 },// tick count
 
 	{ "mpo","mpox",_f00, 3, cm_print_mpo, cm_get_mpo, set_nul,(float *)&cs.null, 0 },	// X machine position
@@ -185,6 +191,9 @@ const cfgItem_t cfgArray[] PROGMEM = {
 //	{ "", "invoke",_f00, 0, tx_print_nul, help_command_line,set_nul, (float *)&cs.null,0 },
 	{ "", "help",_f00, 0, tx_print_nul, help_config,	 set_nul, 	  (float *)&cs.null,0 },	// prints config help screen
 	{ "", "h",   _f00, 0, tx_print_nul, help_config,	 set_nul, 	  (float *)&cs.null,0 },	// alias for "help"
+#ifdef __PROFILE
+	{ "", "prof",_f00, 0, tx_print_nul, prof_get,		 prof_set,	  (float *)&cs.null,0 },	// prints stage timings; $prof=0 resets them
+#endif
 #endif
 
 	// Motor parameters
@@ -450,6 +459,14 @@ const cfgItem_t cfgArray[] PROGMEM = {
 	{ "",   "ms",  _fip, 0, cm_print_ms,  get_flt, set_flt, (float *)&cm.estd_segment_usec,		NOM_SEGMENT_USEC },
 	{ "",   "ml",  _fip, 4, cm_print_ml,  get_flu, set_flu, (float *)&cm.min_segment_len,		MIN_LINE_LENGTH },
 	{ "",   "ma",  _fip, 4, cm_print_ma,  get_flu, set_flu, (float *)&cm.arc_segment_len,		ARC_SEGMENT_LENGTH },
+	{ "",   "mb",  _fip, 0, cm_print_mb,  get_ui8, set_01,  (float *)&cm.body_segment_mode,		BODY_SEGMENT_MODE },
+	{ "",   "mc",  _fip, 0, cm_print_mc,  get_ui8, set_01,  (float *)&cm.scurve_mode,			SCURVE_MODE },
+	{ "",   "mp",  _fip, 0, cm_print_mp,  get_flu, set_flu, (float *)&cm.segment_tolerance,		SEGMENT_TOLERANCE },
+	{ "",   "mn",  _fip, 0, cm_print_mn,  get_ui8, set_01,  (float *)&cm.arc_mode,				ARC_MODE },
+	{ "",   "mg",  _fip, 2, cm_print_mg,  get_flt, set_flt, (float *)&cm.merge_angle,			MERGE_ANGLE },
+	{ "",   "mf",  _fip, 1, cm_print_mf,  get_flt, set_flt, (float *)&cm.merge_tolerance,		MERGE_TOLERANCE },
+	{ "",   "mw",  _fip, 0, cm_print_mw,  get_ui8, set_01,  (float *)&cm.arc_fit,				ARC_FIT },
+	{ "",   "mx",  _fip, 4, cm_print_mx,  get_flu, set_flu, (float *)&cm.fit_tolerance,			FIT_TOLERANCE },
 //RKP	{ "",   "fd",  _fip, 0, tx_print_ui8, get_ui8, set_01,  (float *)&js.json_footer_depth,		JSON_FOOTER_DEPTH },
 
 	// Persistence for status report - must be in sequence
@@ -537,6 +554,8 @@ const cfgItem_t cfgArray[] PROGMEM = {
 #define CMD_INDEX_START_UBER_GROUPS (CMD_INDEX_MAX - CMD_COUNT_UBER_GROUPS)
 /* </DO NOT MESS WITH THESE DEFINES> */
 
+index_t cmdTokenIndex[CMD_INDEX_MAX];		// cfgArray indexes sorted by token - see cmd_get_index()
+
 index_t	cmd_index_max() { return ( CMD_INDEX_MAX );}
 uint16_t cfg_array_max() { return ( CFG_ARRAY_MAX );}
 uint8_t cmd_index_is_single(index_t index) { return ((index <= CMD_INDEX_END_SINGLES) ? true : false);}
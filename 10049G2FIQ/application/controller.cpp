@@ -48,14 +48,23 @@
 //#include "json_parser.h"
 #include "text_parser.h"
 #include "gcode_parser.h"
+#include "gcode_cache.h"
+#include "output_cache.h"
 #include "canonical_machine.h"
 #include "plan_arc.h"
+#include "plan_fit.h"
+#include "plan_merge.h"
 #include "planner.h"
+#include "plan_diag.h"
+#include "verify.h"
+#include "profile.h"
+#include "metrics.h"
 #include "stepper.h"
 #include "hardware.h"
 #include "switch.h"
 //#include "gpio.h"
 #include "report.h"
+#include "status_page.h"
 #include "help.h"
 #include "util.h"
 #include "xio.h"
@@ -138,6 +147,57 @@ void controller_run()
 		_controller_HSM();
 	}
 	while (cs.state != CONTROLLER_EXIT);
+
+	// an exit from inside the G code file leaves its output and caches open
+	mp_merge_flush();
+	xio_close_fiq();
+	gc_cache_close(false);
+	oc_close(false);
+	cmd_commit_NVM();			// anything not written back yet
+	sp_update();
+}
+
+/*
+ * controller_run_job() - convert GcodePathFile into FcodePathFile from a warm context
+ *
+ *	For the job server (server.cpp). Runs the controller loop over one G code file and
+ *	stops at its end instead of prompting. poll() is called every 256 lines, as the
+ *	progress line is printed; if it returns true the job is cancelled and its output
+ *	removed. Returns STAT_OK, STAT_FILE_NOT_OPEN if a file could not be opened or
+ *	written, STAT_OUTPUT_DRIFT if it was verified (-V) off its targets, or
+ *	STAT_TERMINATE if the job was cancelled.
+ */
+stat_t controller_run_job(uint8_t (*poll)(void))
+{
+	int polled = 0;
+
+	cs.state = CONTROLLER_NOT_CONNECTED;
+	cs.job_status = STAT_OK;
+	cs.lineNumber = 0;
+	while ((cs.state == CONTROLLER_NOT_CONNECTED) || (cs.state == CONTROLLER_WORKING)) {
+		_controller_HSM();
+		if (cs.job_status != STAT_OK) break;				// a file could not be opened
+		if ((cs.lineNumber != polled) && ((cs.lineNumber & 0xFF) == 0)) {
+			polled = cs.lineNumber;
+			if (poll()) {
+				cs.job_status = STAT_TERMINATE;
+				break;
+			}
+		}
+	}
+
+	if (cs.state == CONTROLLER_EXIT) {					// an exit from inside the G code file
+		mp_merge_flush();
+	} else if (cs.state != CONTROLLER_PROMPT) {			// cancelled, or a file could not be opened
+		xio_close_gcode();
+	}
+	xio_close_fiq();									// the end of file path has closed these already
+	gc_cache_close(false);
+	oc_close(false);
+	if (cs.job_status == STAT_TERMINATE) { remove(FcodePathFile);}
+	cmd_commit_NVM();
+	sp_update();
+	return (cs.job_status);
 }
 
 #define	DISPATCH(func) if (func == STAT_EAGAIN) return;
@@ -189,42 +249,108 @@ static void _controller_HSM()
 
 static stat_t _command_dispatch()
 {
+        sp_update();			// the last line's results, before this line is read
 
         if (cs.state == CONTROLLER_WORKING)
 	{
 	    // read a line from the Gcode file and check for end of file.
-            if (NULL != fgets(cs.in_buf, sizeof(cs.in_buf), Gin_fp))
+	    char *line;
+	    uint32_t len;
+	    const gcWord_t *word = NULL;
+	    uint8_t count;
+	    // from the pre-parsed cache if there is one, text lines come back in in_buf
+	    stat_t status = (gcc.mode == GC_CACHE_READ) ? gc_cache_next(cs.in_buf, &len, &word, &count) :
+	                                                  xio_read_line(&line, &len);
+            if (status == STAT_OK)
 		{
-			cs.linelen = strlen(cs.in_buf);
+			if (gcc.mode != GC_CACHE_READ)
+			{
+			    // the parsers work in place, so the line view is copied into in_buf
+			    len = min(len, (uint32_t)(INPUT_BUFFER_LEN-1));
+			    memcpy(cs.in_buf, line, len);
+			    cs.in_buf[len] = NUL;
+			    gc_cache_line(line, len);
+			}
+			cs.linelen = len;
 			cs.bufp = cs.in_buf;
                         cs.lineNumber++;
 			if( (cs.lineNumber & 0xFF) == 0 )
                         {
-                            printf("Line 0x%x\n", cs.lineNumber);
+                            int8_t percent = (gcc.mode == GC_CACHE_READ) ? gc_cache_get_percent() :
+                                                                           xio_get_percent();	// byte based - no line count needed
+                            if (percent < 0)
+                                printf("Line 0x%x\n", cs.lineNumber);
+                            else
+                                printf("Line 0x%x %d%%\n", cs.lineNumber, percent);
 //                            printf("Line 0x%x Loop %d\n", cs.lineNumber, MaxLoops);
 //                            MaxLoops = 6000;
                         }
+			if (word != NULL)
+			{
+			    // a cached G code block goes straight to the parser, lexed already
+			    status = gc_gcode_words(word, count);
+			    if ((status != STAT_OK) && (status != STAT_NOOP))
+			        gc_cache_block_text(cs.saved_buf, sizeof(cs.saved_buf), word, count);
+			    text_response(status, cs.saved_buf);
+			    return (STAT_OK);
+			}
 
 		}
 		else
 		{
-                    fclose(Gin_fp);
+                    xio_close_gcode();
+                    gc_cache_close(true);
+                    mp_merge_flush();		// the last moves may be held back for fitting and merging
+                    uint8_t hit = (occ.mode == OC_CACHE_HIT);
                     printf("Completed processing the G code file.\n");
-		    if (!isCompressing)
+                    if (!hit)
+                        printf("Generated %u segments for %u moves.\n", mp_get_total_segments(), mp_get_total_moves());
+                    if (!hit && fp_NOT_ZERO(cm.merge_angle))
+                        printf("Merged %u moves into the moves before them.\n", mp_get_total_merged());
+                    if (!hit && (cm.arc_fit != FIT_ARCS_OFF))
+                        printf("Fitted %u moves into %u arcs.\n", mp_get_total_fitted(), mp_get_total_arcs());
+                    if (!hit && (strlen(BlockLogPathFile) != 0))
                     {
-                        fclose(Fout_fp);
+                        if (mp_diag_finish(BlockLogPathFile) != STAT_OK)
+                            printf("Can't write the block log %s\n", BlockLogPathFile);
+                        else
+                            printf("Lookahead limited %u blocks, costing %.3f s of %.3f s.\n",
+                                   diag.total_limited, diag.total_lost, diag.total_time);
                     }
-                    else
+                    stat_t status = xio_close_fiq();
+                    if (status != STAT_OK)
                     {
-                        Temp_fp = fopen(FcodePathFile, "wb");
-                        if (!Temp_fp)
+                        printf("Can't write the output file %s\n", FcodePathFile);
+                        cs.job_status = STAT_FILE_NOT_OPEN;
+                    }
+                    if (!hit && isVerifying && (status == STAT_OK))
+                    {
+                        if (strcmp(FcodePathFile, XIO_STDIO) == 0)
+                            printf("Can't verify the output on stdout\n");
+                        else if (vf_finish(FcodePathFile, isCompressing) != STAT_OK)
+                            printf("Can't verify the output file %s\n", FcodePathFile);
+                        else
                         {
-                            printf("Can't Open  the compressed file %s\n", FcodePathFile);
-                            return -1;
+                            vf_print();
+                            if (vf.total_off != 0)
+                                status = cs.job_status = STAT_OUTPUT_DRIFT;
                         }
-                        printf("Saved %ld bytes in compression\n", compressFile(Fout_fp, Temp_fp));
-                        fclose(Fout_fp);
-                        fclose(Temp_fp);
+                    }
+                    oc_close(status == STAT_OK);	// an output off its targets isn't kept
+                    if ((strlen(MetricsPathFile) != 0) && (jm_write(MetricsPathFile, status, hit) != STAT_OK))
+                        printf("Can't write the metrics file %s\n", MetricsPathFile);
+                    if (isCompressing && !hit)
+                    {
+                        printf("Saved %lld bytes in compression\n", (long long)(xw.bytes_in - xw.bytes_out));
+                    }
+#ifdef __PROFILE
+                    if (!hit)
+                        prof_print();
+#endif
+                    if (xr.is_stdin)		// stdin is used up - there is nothing to prompt from
+                    {
+                        cs.state = CONTROLLER_EXIT;
+                        return (STAT_OK);
                     }
 
                     cs.state = CONTROLLER_PROMPT;
@@ -241,36 +367,69 @@ static stat_t _command_dispatch()
 		}
 		else
 		{
-                    Gin_fp = fopen(GcodePathFile, "r");
-                    if (!Gin_fp)
+                    if (xio_open_gcode(GcodePathFile) != STAT_OK)
                     {
                         printf("Can't Open the input file %s\n", GcodePathFile);
+                        cs.job_status = STAT_FILE_NOT_OPEN;
                         return -1;  // Failed.
                 }
 
-    // If you are compressing then we will write to a temp file for now. Other wise we will write to the specified file.
-                if (!isCompressing)
+                if ((strlen(OutCachePathDir) != 0) &&
+                    (oc_open(OutCachePathDir, OutCacheLimit, isCompressing) != STAT_OK))
+                    printf("Can't cache the output of %s\n", GcodePathFile);
+
+                // Compressed output is compressed as it is written. No temporary file.
+                // A kept output is finished already, compressed or not.
+                if (xio_open_fiq(FcodePathFile, isCompressing && (occ.mode != OC_CACHE_HIT)) != STAT_OK)
                 {
-                    Fout_fp = fopen(FcodePathFile, "wb");
-                    if (!Fout_fp)
-                    {
-                        printf("Can't Open the output file %s\n", FcodePathFile);
-                        return -1;  // Failed.
-                    }
+                    printf("Can't Open the output file %s\n", FcodePathFile);
+                    oc_close(false);
+                    cs.job_status = STAT_FILE_NOT_OPEN;
+                    return -1;  // Failed.
                 }
-                else
+                jm_start(strlen(MetricsPathFile) != 0);
+                mp_diag_start((strlen(BlockLogPathFile) != 0) && (occ.mode != OC_CACHE_HIT));
+                vf_start(isVerifying && (occ.mode != OC_CACHE_HIT));
+
+                if (occ.mode == OC_CACHE_HIT)
                 {
-                    Fout_fp = fopen(TempPathFile, "w+b");
-                    if (!Fout_fp)
-                    {
-                        printf("Can't Open a temporary file: %s\n", TempPathFile);
-                        return -1;  // Failed.
-                    }
+                    // nothing to convert - the G code file is done with, so WORKING ends at once
+                    printf("Copying the output from the cache %s\n", occ.path);
+                    if (oc_copy() != STAT_OK)
+                        printf("Can't read the output cache %s\n", occ.path);
+                    xio_close_gcode();
+                    cs.bufp = cs.in_buf;		// PROMPT runs its lines from here
+                    cs.state = CONTROLLER_WORKING;
+                    return (STAT_OK);
+                }
+                if (occ.mode == OC_CACHE_FILL)
+                    xio_tee_fiq(occ.fd);
+
+                if (isCaching)
+                {
+                    if (gc_cache_open(GcodePathFile) != STAT_OK)
+                        printf("Can't cache the input file %s\n", GcodePathFile);
+                    else if (gcc.mode == GC_CACHE_READ)
+                        printf("Converting from the pre-parsed cache %s\n", gcc.path);
+                    else
+                        printf("Writing the pre-parsed cache %s\n", gcc.path);
                 }
 
 	        cm_request_queue_flush();
+#ifdef __PROFILE
+                prof_reset();			// time this file only
+#endif
 		cs.lineNumber = 0;
-                cs.totalLineNumber = fLineCount(Gin_fp);
+                cs.totalLineNumber = 0;
+                if (isCountingLines)		// optional - an extra pass over the whole file
+                {
+                    cs.totalLineNumber = xio_count_lines();
+                    printf("0x%x Lines in input file.\n", cs.totalLineNumber);
+                }
+                if (xr.mapped)
+                {
+                    printf("0x%llx Bytes in input file.\n", (unsigned long long)xr.file_size);
+                }
 		cs.state = CONTROLLER_WORKING;
 		return (STAT_OK);  // Exit if file process just started. returns OK for anything NOT OK, so the idler always runs
 	    }
@@ -292,7 +451,9 @@ static stat_t _command_dispatch()
 	}
 
     // execute the text line from PROMPT or WORKING file.
-    strncpy(cs.saved_buf, cs.bufp, SAVED_BUFFER_LEN-1);	// save input buffer for reporting
+    size_t saved_len = strnlen(cs.bufp, SAVED_BUFFER_LEN-1);
+    memcpy(cs.saved_buf, cs.bufp, saved_len);			// save input buffer for reporting
+    cs.saved_buf[saved_len] = NUL;
     cs.linelen = 0;
 
     // dispatch the new text line
@@ -332,7 +493,9 @@ static stat_t _command_dispatch()
         }
         default:
         {								// anything else must be Gcode
-            text_response(gc_gcode_parser(cs.bufp), cs.saved_buf);
+            stat_t status = gc_gcode_parser(cs.bufp);
+            gc_cache_block();		// keep the words if a cache is being written
+            text_response(status, cs.saved_buf);
         }
     }
 	return (STAT_OK);
@@ -0,0 +1,322 @@
+/*
+ * FILE NAME: gcode_cache.cpp - pre-parsed G code cache
+ *
+ * Copyright (c) 2014 Robert K. Parker
+ *
+ * This file was part of the TinyG project
+ *
+ * Copyright (c) 2010 - 2013 Alden S. Hart, Jr.
+ *
+ * Now it is in crystalfontz3D
+ *
+ * This file ("the software") is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2 as published by the
+ * Free Software Foundation. You should have received a copy of the GNU General Public
+ * License, version 2 along with the software.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * THE SOFTWARE IS DISTRIBUTED IN THE HOPE THAT IT WILL BE USEFUL, BUT WITHOUT ANY
+ * WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT
+ * SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+/*
+ * PURPOSE:	Saves the lexed words of a G code file, to skip lexing on later runs.
+ *
+ * NOTES:	Record format, in the native byte order (a cache is not moved between
+ *	machines - the magic number catches one that is):
+ *
+ *		gcCacheHeader_t
+ *		per line:	count (0 - GC_MAX_WORDS), then count x { letter, float value }
+ *				or	GC_CACHE_TEXT, length, then the line text
+ *		GC_CACHE_END
+ *
+ *	A cache is written to <cache>.tmp and renamed when the whole G code file has
+ *	been converted, so a cache that exists is complete.
+ *
+ *
+ * CHANGE HISTORY:
+ *
+ *    Revision: Initial 1.0
+ *    User: R.K.Parker     Date: 05/29/14
+ *    First prototype.
+ *
+ */
+
+#include "tinyg2.h"			// #1
+#include "config.h"			// #2
+#include "controller.h"
+#include "gcode_cache.h"
+#include "util.h"
+#include "xio.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#define GC_CACHE_MAX_RECORD (2 + GC_MAX_WORDS * 5)	// largest record, a block of GC_MAX_WORDS words
+#define GC_CACHE_TEMP ".tmp"
+
+gcCache_t gcc = { GC_CACHE_OFF, -1 };	// pre-parsed cache singleton
+static gcWord_t _words[GC_MAX_WORDS];	// the block returned by gc_cache_next()
+
+static stat_t _open_cache_read(void);
+static stat_t _open_cache_write(void);
+static void _put_text(void);
+static void _flush(uint8_t all);
+static void _refill(void);
+
+/*
+ * gc_cache_open() - open the cache of the G code file that xio_open_gcode() opened
+ *
+ *	Reads the cache if it matches the G code file, otherwise starts writing a new one.
+ *	Returns STAT_FILE_NOT_OPEN, with the cache off, if the input can't be cached
+ *	(stdin or a pipe) or the cache can't be written.
+ */
+stat_t gc_cache_open(const char *gcode_path)
+{
+	struct stat sb;
+
+	gc_cache_close(false);
+	memset(&gcc.header, 0, sizeof(gcc.header));
+	if ((xr.is_stdin) || (!xr.mapped) || (fstat(xr.fd, &sb) != 0)) { return (STAT_FILE_NOT_OPEN);}
+
+	gcc.header.magic = GC_CACHE_MAGIC;
+	gcc.header.version = GC_CACHE_VERSION;
+	gcc.header.size = sb.st_size;
+	gcc.header.mtime_sec = sb.st_mtim.tv_sec;
+	gcc.header.mtime_nsec = sb.st_mtim.tv_nsec;
+	gcc.header.hash = xio_hash_gcode();
+	snprintf(gcc.path, sizeof(gcc.path), "%s%s", gcode_path, GC_CACHE_SUFFIX);
+
+	gcc.len = gcc.rd = gcc.offset = 0;
+	gcc.eof = gcc.line_pending = false;
+	if ((gcc.buf = (char *)malloc(GC_CACHE_BUFFER_LEN)) == NULL) { return (STAT_FILE_NOT_OPEN);}
+	if (_open_cache_read() == STAT_OK) { return (STAT_OK);}
+	return (_open_cache_write());
+}
+
+static stat_t _open_cache_read()
+{
+	gcCacheHeader_t header;
+	struct stat sb;
+	char end = NUL;
+
+	if ((gcc.fd = open(gcc.path, O_RDONLY)) < 0) { return (STAT_FILE_NOT_OPEN);}
+	if ((read(gcc.fd, &header, sizeof(header)) != sizeof(header)) ||
+		(memcmp(&header, &gcc.header, sizeof(header)) != 0) ||		// stale, or not a cache
+		(fstat(gcc.fd, &sb) != 0) ||
+		(pread(gcc.fd, &end, 1, sb.st_size - 1) != 1) || (end != (char)GC_CACHE_END)) {
+		close(gcc.fd);
+		gcc.fd = -1;
+		return (STAT_FILE_NOT_OPEN);
+	}
+	gcc.file_size = sb.st_size;
+	gcc.offset = sizeof(header);
+	gcc.mode = GC_CACHE_READ;
+	return (STAT_OK);
+}
+
+static stat_t _open_cache_write()
+{
+	char temp[sizeof(gcc.path) + sizeof(GC_CACHE_TEMP)];	// the cache is written here, then renamed
+
+	snprintf(temp, sizeof(temp), "%s%s", gcc.path, GC_CACHE_TEMP);
+	if ((gcc.fd = open(temp, O_WRONLY | O_CREAT | O_TRUNC, 0644)) < 0) {
+		free(gcc.buf);
+		gcc.buf = NULL;
+		return (STAT_FILE_NOT_OPEN);
+	}
+	memcpy(gcc.buf, &gcc.header, sizeof(gcc.header));
+	gcc.len = sizeof(gcc.header);
+	gcc.mode = GC_CACHE_WRITE;
+	return (STAT_OK);
+}
+
+/*
+ * gc_cache_line()  - writing: the next input line, as the controller will run it
+ * gc_cache_block() - writing: the G code parser has run the line - keep its words
+ *
+ *	A line is kept as text until gc_cache_block() says it was a G code block the
+ *	lexer took without error. Anything else - a config command, a deleted or
+ *	malformed block - goes in the cache as text, to be run from the text again.
+ */
+void gc_cache_line(const char *line, uint32_t len)
+{
+	if (gcc.mode != GC_CACHE_WRITE) { return;}
+	_put_text();							// the line before was not a block
+	gcc.line_len = min(len, (uint32_t)(INPUT_BUFFER_LEN-1));
+	memcpy(gcc.line, line, gcc.line_len);
+	gcc.line_pending = true;
+}
+
+void gc_cache_block()
+{
+	const gcWord_t *word;
+	int16_t count;
+
+	if ((gcc.mode != GC_CACHE_WRITE) || (!gcc.line_pending)) { return;}
+	if ((count = gc_get_words(&word)) < 0) { return;}
+
+	char *wr = gcc.buf + gcc.len;
+	*(wr++) = (char)count;
+	for (uint8_t i=0; i < count; i++) {
+		*(wr++) = word[i].letter;
+		memcpy(wr, &word[i].value, sizeof(float));
+		wr += sizeof(float);
+	}
+	gcc.len = wr - gcc.buf;
+	gcc.line_pending = false;
+	_flush(false);
+}
+
+static void _put_text()
+{
+	if (!gcc.line_pending) { return;}
+	gcc.buf[gcc.len++] = (char)GC_CACHE_TEXT;
+	gcc.buf[gcc.len++] = (char)gcc.line_len;
+	memcpy(gcc.buf + gcc.len, gcc.line, gcc.line_len);
+	gcc.len += gcc.line_len;
+	gcc.line_pending = false;
+	_flush(false);
+}
+
+/*
+ * _flush() - write the buffer out - all of it, or if another record might not fit
+ */
+static void _flush(uint8_t all)
+{
+	if ((!all) && (gcc.len + GC_CACHE_MAX_RECORD <= GC_CACHE_BUFFER_LEN)) { return;}
+	char *data = gcc.buf;
+	while (gcc.len > 0) {
+		ssize_t count = write(gcc.fd, data, gcc.len);
+		if (count < 0) {
+			if (errno == EINTR) continue;
+			gcc.mode = GC_CACHE_OFF;			// give up on the cache - gc_cache_close() removes it
+			return;
+		}
+		data += count;
+		gcc.len -= count;
+	}
+}
+
+/*
+ * gc_cache_next() - reading: the next line
+ *
+ *	A G code block comes back as words: *word and *count are set. A text line comes
+ *	back in text, as a NUL terminated string of *len characters, with *word NULL.
+ *	Returns STAT_OK, or STAT_EOF at the end of the cache.
+ */
+stat_t gc_cache_next(char *text, uint32_t *len, const gcWord_t **word, uint8_t *count)
+{
+	_refill();
+	if (gcc.rd >= gcc.len) { return (STAT_EOF);}
+
+	const char *rd = gcc.buf + gcc.rd;
+	uint8_t type = (uint8_t)*(rd++);
+
+	if (type == GC_CACHE_END) { return (STAT_EOF);}
+	if (type == GC_CACHE_TEXT) {
+		*len = (uint8_t)*(rd++);
+		memcpy(text, rd, *len);
+		text[*len] = NUL;
+		rd += *len;
+		*word = NULL;
+	} else {
+		for (uint8_t i=0; i < type; i++) {
+			_words[i].letter = *(rd++);
+			memcpy(&_words[i].value, rd, sizeof(float));
+			rd += sizeof(float);
+		}
+		*word = _words;
+		*count = type;
+		*len = 0;
+	}
+	gcc.offset += (rd - gcc.buf) - gcc.rd;
+	gcc.rd = rd - gcc.buf;
+	return (STAT_OK);
+}
+
+/*
+ * _refill() - keep at least a whole record in the read-ahead buffer
+ */
+static void _refill()
+{
+	if ((gcc.eof) || (gcc.len - gcc.rd >= GC_CACHE_MAX_RECORD)) { return;}
+	memmove(gcc.buf, gcc.buf + gcc.rd, gcc.len - gcc.rd);
+	gcc.len -= gcc.rd;
+	gcc.rd = 0;
+	while (gcc.len < GC_CACHE_BUFFER_LEN) {
+		ssize_t count = read(gcc.fd, gcc.buf + gcc.len, GC_CACHE_BUFFER_LEN - gcc.len);
+		if (count > 0) {
+			gcc.len += count;
+			continue;
+		}
+		if ((count < 0) && (errno == EINTR)) continue;
+		gcc.eof = true;
+		return;
+	}
+}
+
+/*
+ * gc_cache_block_text() - a cached block as text, for error reports
+ */
+void gc_cache_block_text(char *buf, size_t size, const gcWord_t *word, uint8_t count)
+{
+	size_t len = 0;
+
+	buf[0] = NUL;
+	for (uint8_t i=0; (i < count) && (len < size); i++) {
+		len += snprintf(buf + len, size - len, (i == 0) ? "%c%g" : " %c%g", word[i].letter, (double)word[i].value);
+	}
+}
+
+/*
+ * gc_cache_get_percent() - reading: percentage of the cache replayed so far
+ */
+int8_t gc_cache_get_percent()
+{
+	if (gcc.file_size == 0) { return (-1);}
+	return ((int8_t)(gcc.offset * 100 / gcc.file_size));
+}
+
+/*
+ * gc_cache_close() - close the cache
+ *
+ *	A cache being written is kept only if it is complete - the whole G code file
+ *	was converted - and all of it could be written.
+ */
+void gc_cache_close(uint8_t complete)
+{
+	char temp[sizeof(gcc.path) + sizeof(GC_CACHE_TEMP)];	// the cache is written here, then renamed
+
+	if (gcc.fd >= 0) {
+		snprintf(temp, sizeof(temp), "%s%s", gcc.path, GC_CACHE_TEMP);
+		if (gcc.mode == GC_CACHE_WRITE) {
+			_put_text();
+			gcc.buf[gcc.len++] = (char)GC_CACHE_END;
+			_flush(true);
+		}
+		close(gcc.fd);
+		if ((gcc.mode == GC_CACHE_WRITE) && (complete)) {
+			rename(temp, gcc.path);
+		} else if (gcc.mode != GC_CACHE_READ) {
+			unlink(temp);
+		}
+	}
+	free(gcc.buf);
+	gcc.buf = NULL;
+	gcc.fd = -1;
+	gcc.file_size = 0;
+	gcc.mode = GC_CACHE_OFF;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -38,6 +38,10 @@
 #include "controller.h"
 #include "gcode_parser.h"
 #include "canonical_machine.h"
+#include "planner.h"
+#include "stepper.h"
+#include "profile.h"
+#include "microbench.h"
 //#include "spindle.h"
 #include "util.h"
 #include "xio.h"			// for char definitions
@@ -46,16 +50,74 @@
 extern "C"{
 #endif // __cplusplus
 
+/*
+ * The lexer turns a block into a list of words - a letter and its value - in a single
+ * pass. Every character is classified by a lookup in _char_class[]; numbers are
+ * accumulated as they are read, so the block is never normalized in place or read
+ * again by strtof().
+ */
+#define GC_MAX_MANTISSA 90071992547409ULL	// 2^53/100 - room for one more digit and a sticky digit
+#define GC_FAST_MANTISSA 16777216			// 2^24 - mantissas below this are exact floats
+#define GC_FAST_EXPONENT 10					// 10^10 is the largest exact float power of ten
+#define GC_EXACT_EXPONENT 22				// 10^22 is the largest exact double power of ten
+
 struct gcodeParserSingleton {	 	  // struct to manage globals
 	uint8_t modals[MODAL_GROUP_COUNT];// collects modal groups in a block
+	stat_t lex_status;				  // how lexing the block ended, STAT_NOOP if it was deleted
+	uint8_t word_count;				  // words lexed from the block
+	gcWord_t word[GC_MAX_WORDS];	  // words lexed from the block
 }; struct gcodeParserSingleton gp;
 
+enum gcCharClass {					// character classes for the lexer
+	GC_SKIP = 0,					// white space, control and other invalid characters
+	GC_END,							// NUL - end of the block
+	GC_COMMENT,						// ( or ; - a comment runs to the end of the block
+	GC_LETTER,						// A-Z, a-z - starts a word
+	GC_DIGIT,						// 0-9
+	GC_MINUS,						// leading minus sign of a value
+	GC_POINT						// decimal point
+};
+
+#define S_ GC_SKIP
+#define E_ GC_END
+#define C_ GC_COMMENT
+#define L_ GC_LETTER
+#define D_ GC_DIGIT
+#define M_ GC_MINUS
+#define P_ GC_POINT
+
+static const uint8_t _char_class[256] = {	// characters 0x80 - 0xFF are all GC_SKIP
+	E_,S_,S_,S_,S_,S_,S_,S_,S_,S_,S_,S_,S_,S_,S_,S_,	// 0x00 NUL, control
+	S_,S_,S_,S_,S_,S_,S_,S_,S_,S_,S_,S_,S_,S_,S_,S_,	// 0x10 control
+	S_,S_,S_,S_,S_,S_,S_,S_,C_,S_,S_,S_,S_,M_,P_,S_,	// 0x20  !"#$%&'()*+,-./
+	D_,D_,D_,D_,D_,D_,D_,D_,D_,D_,S_,C_,S_,S_,S_,S_,	// 0x30 0123456789:;<=>?
+	S_,L_,L_,L_,L_,L_,L_,L_,L_,L_,L_,L_,L_,L_,L_,L_,	// 0x40 @ABCDEFGHIJKLMNO
+	L_,L_,L_,L_,L_,L_,L_,L_,L_,L_,L_,S_,S_,S_,S_,S_,	// 0x50 PQRSTUVWXYZ[\]^_
+	S_,L_,L_,L_,L_,L_,L_,L_,L_,L_,L_,L_,L_,L_,L_,L_,	// 0x60 `abcdefghijklmno
+	L_,L_,L_,L_,L_,L_,L_,L_,L_,L_,L_,S_,S_,S_,S_,S_		// 0x70 pqrstuvwxyz{|}~ DEL
+};
+
+#undef S_
+#undef E_
+#undef C_
+#undef L_
+#undef D_
+#undef M_
+#undef P_
+
+static const float _pow10f[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+static const double _pow10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+								 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20,
+								 1e21, 1e22 };
+
 // local helper functions and macros
-static void _normalize_gcode_block(char *cmd, char **com, char **msg, uint8_t *block_delete_flag);
-static stat_t _get_next_gcode_word(char **pstr, char *letter, float *value);
-static stat_t _point(float value);
+static stat_t _lex_gcode_block(char *block, char **msg);
+static float _get_gcode_value(uint64_t mantissa, int16_t exponent);
+static char *_get_gcode_message(char *com);
+static uint8_t _point(float value);
 static stat_t _validate_gcode_block(void);
 static stat_t _parse_gcode_block(char *line);	// Parse the block into the GN/GF structs
+static stat_t _parse_gcode_words(const gcWord_t *word, uint8_t count, stat_t lex_status);
 static stat_t _execute_gcode_block(void);		// Execute the gcode block
 
 #define SET_MODAL(m,parm,val) ({gn.parm=val; gf.parm=1; gp.modals[m]+=1; break;})
@@ -65,48 +127,61 @@ static stat_t _execute_gcode_block(void);		// Execute the gcode block
 /*
  * gc_gcode_parser() - parse a block (line) of gcode
  *
- *	Top level of gcode parser. Normalizes block and looks for special cases
+ *	Top level of gcode parser. Looks for special cases and parses the block
  */
 
 stat_t gc_gcode_parser(char *block)
 {
-    char *cmd = block;					// gcode command or NUL string
-    char none = NUL;
-    char *com = &none;					// gcode comment or NUL string
-    char *msg = &none;					// gcode message or NUL string
-	uint8_t block_delete_flag;
-
-	_normalize_gcode_block(cmd, &com, &msg, &block_delete_flag);
+	PROF_SCOPE(PROF_PARSER);
+	MB_RECORD(mb_record_block(block));
 
 	// Block delete omits the line if a / char is present in the first space
 	// For now this is unconditional and will always delete
-//	if ((block_delete_flag == true) && (cm_get_block_delete_switch() == true)) {
-	if (block_delete_flag == true) {
+//	if ((*block == '/') && (cm_get_block_delete_switch() == true)) {
+	if (*block == '/') {
+		gp.lex_status = STAT_NOOP;
 		return (STAT_NOOP);
 	}
-//	if (*msg != NUL) { // +++++ THIS HAS A SERIOUS BUG IN IT SO FOR NOW IT'S DISABLED
-//		(void)cm_message(msg);				// queue the message
-//	}
 	return(_parse_gcode_block(block));
 }
 
 /*
- * _normalize_gcode_block() - normalize a block (line) of gcode in place
+ * gc_gcode_words() - run a block that was lexed before - see gcode_cache.cpp
+ */
+stat_t gc_gcode_words(const gcWord_t *word, uint8_t count)
+{
+	PROF_SCOPE(PROF_PARSER);
+	return (_parse_gcode_words(word, count, STAT_COMPLETE));
+}
+
+/*
+ * gc_get_words() - words of the last block given to gc_gcode_parser()
+ *
+ *	Returns the word count, or -1 if the block was deleted or stopped the lexer with
+ *	an error - it can only be run again from its text.
+ */
+int16_t gc_get_words(const gcWord_t **word)
+{
+	*word = gp.word;
+	return ((gp.lex_status == STAT_COMPLETE) ? gp.word_count : -1);
+}
+
+/*
+ * _lex_gcode_block() - break a block (line) of gcode into words in a single pass
  *
- *	Normalization functions:
- *   - convert all letters to upper case
- *	 - remove white space, control and other invalid characters
- *	 - remove (erroneous) leading zeros that might be taken to mean Octal
- *	 - identify and return start of comments and messages
- *	 - signal if a block-delete character (/) was encountered in the first space
+ *	Lexing rules - the same blocks are accepted as by the normalize-then-strtof()
+ *	parser this replaces:
+ *   - letters are taken as upper case
+ *	 - white space, control and other invalid characters are skipped, also inside values
+ *	 - values are decimal - leading zeros are not Octal and G0X... is not hexadecimal
+ *	 - values have no exponent: "X1E3" is X1 then E3 (strtof() made it X1000)
+ *	 - a comment starts with a '(' char or alternately a semicolon ';'
  *
- *	So this: "  g1 x100 Y100 f400" becomes this: "G1X100Y100F400"
+ *	So this: "  g1 x100 Y100 f400" becomes this: G1 X100 Y100 F400
  *
  *	Comment and message handling:
- *	 - Comments field start with a '(' char or alternately a semicolon ';'
- *	 - Comments and messages are not normalized - they are left alone
+ *	 - Comments and messages are not lexed - they are left alone
  *	 - The 'MSG' specifier in comment can have mixed case but cannot cannot have embedded white spaces
- *	 - Normalization returns true if there was a message to display, false otherwise
  *	 - Comments always terminate the block - i.e. leading or embedded comments are not supported
  *	 	- Valid cases (examples)			Notes:
  *		    G0X10							 - command only - no comment
@@ -121,87 +196,141 @@ stat_t gc_gcode_parser(char *block)
  *		    (comment) G0X10 				 - leading comment. G0X10 will be ignored
  * 			G0X10 # comment					 - invalid separator
  *
- *	Returns:
- *	 - com points to comment string or to NUL if no comment
- *	 - msg points to message string or to NUL if no comment
- *	 - block_delete_flag is set true if block delete encountered, false otherwise
+ *	Leaves the words in gp.word[] and msg pointing to the message string, or to NUL
+ *	if there is none. Returns STAT_COMPLETE, or the error that stopped the lexer;
+ *	the words before the error are still in the list.
  */
-static void _normalize_gcode_block(char *cmd, char **com, char **msg, uint8_t *block_delete_flag)
+static stat_t _lex_gcode_block(char *block, char **msg)
 {
-    char *rd = cmd;				// read pointer
-    char *wr = cmd;				// write pointer
-
-	// Preset comments and messages to NUL string
-	// Not required if com and msg already point to NUL on entry
-//	for (rd = cmd; *rd != NUL; rd++) { if (*rd == NUL) { *com = rd; *msg = rd; rd = cmd;} }
-
-	// mark block deletes
-	if (*rd == '/') { *block_delete_flag = true; }
-	else { *block_delete_flag = false; }
-
-	// normalize the command block & find the comment (if any)
-	for (; *wr != NUL; rd++) {
-		if (*rd == NUL) { *wr = NUL; }
-		else if ((*rd == '(') || (*rd == ';')) { *wr = NUL; *com = rd+1; }
-		else if ((isalnum((char)*rd)) || (strchr("-.", *rd))) { // all valid characters
-            *(wr++) = (char)toupper((char)*(rd));
-		}
-	}
-
-	// Perform Octal stripping - remove invalid leading zeros in number strings
-	rd = cmd;
-	while (*rd != NUL) {
-		if (*rd == '.') break;							// don't strip past a decimal point
-		if ((!isdigit(*rd)) && (*(rd+1) == '0') && (isdigit(*(rd+2)))) {
-			wr = rd+1;
-			while (*wr != NUL) { *wr = *(wr+1); wr++;}	// copy forward w/overwrite
+	char *rd = block;
+	char letter = NUL;				// letter of the word being lexed, NUL between words
+	uint8_t digits = false;			// the value has at least one digit
+	uint8_t point = false;			// the value has a decimal point
+	uint8_t negative = false;		// the value has a minus sign
+	uint64_t mantissa = 0;			// digits of the value as an integer
+	int16_t exponent = 0;			// power of ten to scale the mantissa by
+	uint8_t sticky = false;			// a non-zero digit was dropped from the mantissa
+	stat_t status = STAT_COMPLETE;
+
+	gp.word_count = 0;
+	while (true) {
+		char c = *(rd++);
+		uint8_t cls = _char_class[(uint8_t)c];
+
+		if (cls == GC_SKIP) continue;
+		if (cls == GC_DIGIT) {
+			if (letter == NUL) { return (STAT_EXPECTED_COMMAND_LETTER);}
+			if (mantissa < GC_MAX_MANTISSA) {
+				mantissa = mantissa * 10 + (c - '0');
+				exponent -= point;
+			} else {
+				exponent += !point;				// drop digits past the float's precision
+				sticky |= (c != '0');
+			}
+			digits = true;
 			continue;
 		}
-		rd++;
-	}
+		if (letter != NUL) {
+			if ((cls == GC_MINUS) && (!digits) && (!point) && (!negative)) {
+				negative = true;
+				continue;
+			}
+			if ((cls == GC_POINT) && (!point)) {
+				point = true;
+				continue;
+			}
+			if (!digits) { return (STAT_BAD_NUMBER_FORMAT);}	// letter with no value
 
-	// process comments and messages
-	if (**com != NUL) {
-		rd = *com;
-		while (isspace(*rd)) { rd++; }		// skip any leading spaces before "msg"
-		if ((tolower(*rd) == 'm') && (tolower(*(rd+1)) == 's') && (tolower(*(rd+2)) == 'g')) {
-			*msg = rd+3;
+			// the word is complete
+			if (sticky) {						// stands in for the dropped digits
+				mantissa = mantissa * 10 + 1;
+				exponent--;
+			}
+			float value = _get_gcode_value(mantissa, exponent);
+			gp.word[gp.word_count].letter = letter;
+			gp.word[gp.word_count].value = (negative ? -value : value);
+			gp.word_count++;
+			letter = NUL;
+			if ((cls == GC_MINUS) || (cls == GC_POINT)) { return (STAT_EXPECTED_COMMAND_LETTER);}
 		}
-		for (; *rd != NUL; rd++) {
-			if (*rd == ')') *rd = NUL;		// NUL terminate on trailing parenthesis, if any
+		if (cls == GC_LETTER) {
+			if (gp.word_count >= GC_MAX_WORDS) { return (STAT_INPUT_EXCEEDS_MAX_LENGTH);}
+			letter = c & ~0x20;					// upper case
+			digits = point = negative = sticky = false;
+			mantissa = 0;
+			exponent = 0;
+			continue;
 		}
+		if (cls == GC_COMMENT) { *msg = _get_gcode_message(rd);}
+		else if (cls != GC_END) { status = STAT_EXPECTED_COMMAND_LETTER;}	// value with no letter
+		return (status);
 	}
 }
 
 /*
- * _get_next_gcode_word() - get gcode word consisting of a letter and a value
+ * _get_gcode_value() - mantissa * 10^exponent correctly rounded to float
  *
- *	This function requires the Gcode string to be normalized.
- *	Normalization must remove any leading zeros or they will be converted to Octal
- *	G0X... is not interpreted as hexadecimal. This is trapped.
+ *	Replaces strtof(), which is locale dependent, reads hex, inf and nan, and is slow in
+ *	soft-float. Correctly rounded - the same float strtof() gives - for values of up to
+ *	14 significant digits within the 10^22 exact double powers of ten. Longer mantissas
+ *	come from the lexer cut to 14-15 digits plus a sticky digit. In order of cost:
+ *
+ *	 - Integers convert directly.
+ *	 - The typical slicer value, e.g. 79.850, is a mantissa below 2^24 and a power of
+ *	   ten up to 10^10. Both are exact floats, so a single float divide or multiply is
+ *	   correctly rounded. No double math at all.
+ *	 - Anything else is computed in double. Both operands are exact doubles, so the
+ *	   result is a correctly rounded double; rounding that to float is wrong only when
+ *	   the double lands exactly halfway between two floats. That case is found from the
+ *	   bits and settled with the exact sign of the error, from a fused multiply-add.
  */
-static stat_t _get_next_gcode_word(char **pstr, char *letter, float *value)
+static float _get_gcode_value(uint64_t mantissa, int16_t exponent)
 {
-	if (**pstr == NUL) { return (STAT_COMPLETE); }	// no more words
-
-	// get letter part
-	if(isupper(**pstr) == false) { return (STAT_EXPECTED_COMMAND_LETTER); }
-	*letter = **pstr;
-	(*pstr)++;
-
-	// X-axis-becomes-a-hexadecimal-number get-value case, e.g. G0X100 --> G255
-	if ((**pstr == '0') && (*(*pstr+1) == 'X')) {
-		*value = 0;
-		(*pstr)++;
-		return (STAT_OK);		// pointer points to X
+	if (exponent == 0) { return ((float)mantissa);}
+	if ((mantissa < GC_FAST_MANTISSA) && (exponent >= -GC_FAST_EXPONENT) && (exponent <= GC_FAST_EXPONENT)) {
+		return ((exponent < 0) ? (float)mantissa / _pow10f[-exponent] : (float)mantissa * _pow10f[exponent]);
+	}
+	if (mantissa == 0) { return (0);}
+
+	double m = (double)mantissa;				// exact, the lexer keeps it below 2^53
+	double value;
+	double error;								// sign of value minus the exact result
+	for (; exponent > GC_EXACT_EXPONENT; exponent -= GC_EXACT_EXPONENT) { m *= _pow10[GC_EXACT_EXPONENT];}
+	for (; exponent < -GC_EXACT_EXPONENT; exponent += GC_EXACT_EXPONENT) { m /= _pow10[GC_EXACT_EXPONENT];}
+	if (exponent < 0) {
+		value = m / _pow10[-exponent];
+		error = fma(value, _pow10[-exponent], -m);
+	} else {
+		value = m * _pow10[exponent];
+		error = -fma(m, _pow10[exponent], -value);
 	}
 
-	// get-value general case
-	char *end;
-	*value = strtof(*pstr, &end);
-	if(end == *pstr) { return(STAT_BAD_NUMBER_FORMAT); }	// more robust test then checking for value=0;
-	*pstr = end;
-	return (STAT_OK);			// pointer points to next character after the word
+	uint64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	if (((bits & 0x1FFFFFFF) == 0x10000000) && (error != 0)) {	// halfway between two floats
+		bits += (error > 0) ? -1 : 1;			// move off halfway towards the exact result
+		memcpy(&value, &bits, sizeof(bits));
+	}
+	return ((float)value);
+}
+
+/*
+ * _get_gcode_message() - find the message in a comment
+ *
+ *	Returns a pointer to the message string, or to NUL if the comment is not a message.
+ *	NUL terminates the comment on its trailing parenthesis, if any.
+ */
+static char *_get_gcode_message(char *com)
+{
+	char *msg = com + strlen(com);			// NUL string if no message
+	char *paren = strchr(com, ')');
+
+	if (paren != NULL) { *paren = NUL;}
+	while (isspace(*com)) { com++; }		// skip any leading spaces before "msg"
+	if ((tolower(*com) == 'm') && (tolower(*(com+1)) == 's') && (tolower(*(com+2)) == 'g')) {
+		msg = com+3;
+	}
+	return (msg);
 }
 
 /*
@@ -239,29 +368,44 @@ static stat_t _validate_gcode_block()
 
 /*
  * _parse_gcode_block() - parses one line of NULL terminated G-Code.
+ * _parse_gcode_words() - the part after lexing, also used to run cached words
  *
  *	All the parser does is load the state values in gn (next model state) and set flags
- *	in gf (model state flags). The execute routine applies them. The buffer is assumed to
- *	contain only uppercase characters and signed floats (no whitespace).
+ *	in gf (model state flags). The execute routine applies them. The words come from
+ *	_lex_gcode_block().
  *
  *	A number of implicit things happen when the gn struct is zeroed:
  *	  - inverse feed rate mode is canceled - set back to units_per_minute mode
  */
 static stat_t _parse_gcode_block(char *buf)
 {
-	char *pstr = (char *)buf;		// persistent pointer into gcode block for parsing words
+    char none = NUL;
+    char *msg = &none;				// gcode message or NUL string
+
+	gp.lex_status = _lex_gcode_block(buf, &msg);
+
+//	if (*msg != NUL) { // +++++ THIS HAS A SERIOUS BUG IN IT SO FOR NOW IT'S DISABLED
+//		(void)cm_message(msg);				// queue the message
+//	}
+	return (_parse_gcode_words(gp.word, gp.word_count, gp.lex_status));
+}
+
+static stat_t _parse_gcode_words(const gcWord_t *word, uint8_t count, stat_t lex_status)
+{
   	char letter;					// parsed letter, eg.g. G or X or Y
-	float value = 0;				// value parsed from letter (e.g. 2 for G2)
+	float value;					// value parsed from letter (e.g. 2 for G2)
 	stat_t status = STAT_OK;
 
 	// set initial state for new move
-	memset(&gp, 0, sizeof(gp));		// clear all parser values
+	memset(gp.modals, 0, sizeof(gp.modals));// clear all parser values
 	memset(&gf, 0, sizeof(gf));		// clear all next-state flags
 	memset(&gn, 0, sizeof(gn));		// clear all next-state values
 	gn.motion_mode = cm_get_motion_mode(MODEL);// get motion mode from previous block
 
 	// extract commands and parameters
-	while((status = _get_next_gcode_word(&pstr, &letter, &value)) == STAT_OK) {
+	for (uint8_t i=0; i < count; i++) {
+		letter = word[i].letter;
+		value = word[i].value;
 		switch(letter) {
 			case 'G':
 			switch((uint8_t)value) {
@@ -383,8 +527,12 @@ static stat_t _parse_gcode_block(char *buf)
 		}
 		if(status != STAT_OK) break;
 	}
+	if (status == STAT_OK) { status = lex_status;}	// the words before a lexing error are checked first
 	if ((status != STAT_OK) && (status != STAT_COMPLETE)) return (status);
 	ritorno(_validate_gcode_block());
+#ifdef __MICROBENCH
+	if (bench.replaying) return (STAT_OK);	// timing the parse alone
+#endif
 	return (_execute_gcode_block());		// if successful execute the block
 }
 
@@ -429,6 +577,7 @@ static stat_t _parse_gcode_block(char *buf)
 
 static stat_t _execute_gcode_block()
 {
+	PROF_SCOPE(PROF_CANONICAL);
 	stat_t status = STAT_OK;
 
 	cm_set_model_linenum(gn.linenum);
@@ -521,6 +670,247 @@ stat_t gc_run_gc(cmdObj_t *cmd)
 	return(gc_gcode_parser(*cmd->stringp));
 }
 
+//##########################################
+//############## UNIT TESTS ################
+//##########################################
+
+#ifdef __UNIT_TESTS
+#ifdef __UNIT_TEST_GCODE
+
+#define GC_TEST_PASSES 20000		// passes over the test blocks by the timing test
+#define GC_TEST_VALUES 1000000		// random values compared by the strtof() fuzz test
+#define GC_TEST_BATCH 1000			// values generated, converted and timed at a time
+
+static const char *_test_blocks[] = {	// representative slicer output, plus some odd cases
+	"G1 X80.000 Y50.000 A0.0000\n",
+	"G1 X79.850 Y52.995 A0.0500\n",
+	"G1 X-12.5 Y.25 A1.23456 F1800\n",
+	"G0 F7800 X102.345 Y98.765 Z0.300\n",
+	"G1 Z0.600 F7800.000\n",
+	"G92 A0\n",
+	"G1 F3000\n",
+	"g1 x100 y100 f400 (lower case, comment)\n",
+	"N10 G1 X1.0 ; msg a message\n",
+	"G1 X010 Y-007.50\n",
+	"G0X10Y20\n",
+	"G2 X10 Y10 I5 J0\n",
+	"G1 X 1 2 . 5\n",
+	"G1 X123456789012345678 Y0.000000000001\n",
+	"(comment only)\n",
+	"M2\n",
+	"G1 X5-3\n",
+	"G1 X-\n",
+	"G1 X1.2.3\n",
+	"5 G1 X1\n"
+};
+
+static void _test_lexer(void);
+static void _test_lexer_timing(void);
+static void _test_value_fuzz(void);
+static void _test_random_value(char *str);
+static uint8_t _test_reference_lex(char *block, gcWord_t word[], stat_t *status);
+static float _test_elapsed(struct timespec *start);
+
+void gc_unit_tests()
+{
+	_test_lexer();
+	_test_lexer_timing();
+	_test_value_fuzz();
+}
+
+static float _test_elapsed(struct timespec *start)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((now.tv_sec - start->tv_sec) + (now.tv_nsec - start->tv_nsec) / 1000000000.0);
+}
+
+/*
+ * _test_reference_lex() - words of a block by the normalize-then-strtof() parser
+ *
+ *	This is the parser _lex_gcode_block() replaced, kept as the reference for the
+ *	tests. Returns the word count and the status the word loop ended with.
+ */
+static uint8_t _test_reference_lex(char *block, gcWord_t word[], stat_t *status)
+{
+	char *rd = block;
+	char *wr = block;
+	uint8_t count = 0;
+
+	for (; *wr != NUL; rd++) {				// normalize
+		if (*rd == NUL) { *wr = NUL; }
+		else if ((*rd == '(') || (*rd == ';')) { *wr = NUL; }
+		else if ((isalnum((char)*rd)) || (strchr("-.", *rd))) {
+            *(wr++) = (char)toupper((char)*(rd));
+		}
+	}
+	rd = block;								// strip Octal leading zeros
+	while (*rd != NUL) {
+		if (*rd == '.') break;
+		if ((!isdigit(*rd)) && (*(rd+1) == '0') && (isdigit(*(rd+2)))) {
+			wr = rd+1;
+			while (*wr != NUL) { *wr = *(wr+1); wr++;}
+			continue;
+		}
+		rd++;
+	}
+	rd = block;								// get the words
+	while (true) {
+		char *end;
+		if (*rd == NUL) { *status = STAT_COMPLETE; break;}
+		if (isupper(*rd) == false) { *status = STAT_EXPECTED_COMMAND_LETTER; break;}
+		word[count].letter = *(rd++);
+		if ((*rd == '0') && (*(rd+1) == 'X')) {
+			word[count++].value = 0;
+			rd++;
+			continue;
+		}
+		word[count].value = strtof(rd, &end);
+		if (end == rd) { *status = STAT_BAD_NUMBER_FORMAT; break;}
+		rd = end;
+		count++;
+	}
+	return (count);
+}
+
+/*
+ * _test_lexer() - compare the words and status of each test block with the reference
+ */
+static void _test_lexer()
+{
+	char block[INPUT_BUFFER_LEN];
+	char *msg;
+	gcWord_t word[GC_MAX_WORDS];
+	stat_t status;
+
+	for (uint8_t i=0; i < sizeof(_test_blocks)/sizeof(_test_blocks[0]); i++) {
+		strncpy(block, _test_blocks[i], sizeof(block));
+		uint8_t count = _test_reference_lex(block, word, &status);
+		strncpy(block, _test_blocks[i], sizeof(block));
+		stat_t lex_status = _lex_gcode_block(block, &msg);
+
+		uint8_t same = ((count == gp.word_count) && (status == lex_status));
+		for (uint8_t j=0; same && (j < count); j++) {
+			same = ((word[j].letter == gp.word[j].letter) && (word[j].value == gp.word[j].value));
+		}
+		printf("gcode lexer test %2d: %s %d words status %d (reference %d words status %d) %s",
+				i, (same ? "pass" : "FAIL"), gp.word_count, lex_status, count, status, _test_blocks[i]);
+	}
+}
+
+/*
+ * _test_lexer_timing() - time both lexers over the test blocks
+ *
+ *	Both work on a fresh copy of each block, as both write into the block.
+ */
+static void _test_lexer_timing()
+{
+	char block[INPUT_BUFFER_LEN];
+	char *msg;
+	gcWord_t word[GC_MAX_WORDS];
+	stat_t status;
+	uint32_t sum = 0;					// keeps the optimizer from dropping the loops
+	uint8_t blocks = 7;					// only the slicer output blocks
+
+	struct timespec start;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (uint32_t pass=0; pass < GC_TEST_PASSES; pass++) {
+		for (uint8_t i=0; i < blocks; i++) {
+			strcpy(block, _test_blocks[i]);
+			sum += _test_reference_lex(block, word, &status);
+		}
+	}
+	float reference = _test_elapsed(&start);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (uint32_t pass=0; pass < GC_TEST_PASSES; pass++) {
+		for (uint8_t i=0; i < blocks; i++) {
+			strcpy(block, _test_blocks[i]);
+			_lex_gcode_block(block, &msg);
+			sum -= gp.word_count;
+		}
+	}
+	float fused = _test_elapsed(&start);
+
+	printf("gcode lexer timing: reference %.1f ns/block, fused %.1f ns/block, %.1fx (check %u)\n",
+			(double)(reference * 1e9 / GC_TEST_PASSES / blocks), (double)(fused * 1e9 / GC_TEST_PASSES / blocks),
+			(double)(reference / fused), sum);
+}
+
+/*
+ * _test_random_value() - a random decimal value string
+ *
+ *	Half are slicer style values: up to 6 integer and 6 fraction digits, some with
+ *	leading zeros or a minus sign. Half are printed to 9-14 significant digits from a
+ *	point halfway between two floats, where the rounding is hardest to get right.
+ */
+static void _test_random_value(char *str)
+{
+	if (rand() & 1) {
+		char *wr = str;
+		int integers = rand() % 7;
+		int fractions = (integers == 0) ? 1 + rand() % 6 : rand() % 7;
+		if (rand() % 4 == 0) { *(wr++) = '-';}
+		if (rand() % 8 == 0) { *(wr++) = '0';}
+		for (int i=0; i < integers; i++) { *(wr++) = '0' + rand() % 10;}
+		if ((fractions > 0) || (rand() & 1)) { *(wr++) = '.';}
+		for (int i=0; i < fractions; i++) { *(wr++) = '0' + rand() % 10;}
+		*wr = NUL;
+	} else {
+		float f = ldexpf((float)((rand() % 0x800000) | 0x800000), rand() % 48 - 40);
+		double halfway = (double)f + ldexp(1, ilogb(f) - 24);
+		int decimals = 9 + rand() % 6 - 1 - (int)floor(log10(halfway));
+		sprintf(str, "%.*f", max(decimals, 0), halfway);		// G code has no exponents
+	}
+}
+
+/*
+ * _test_value_fuzz() - compare the lexer's values with strtof() bit for bit
+ *
+ *	Also times both over the same values, GC_TEST_BATCH values at a time.
+ */
+static void _test_value_fuzz()
+{
+	static char block[GC_TEST_BATCH][32];
+	static float expected[GC_TEST_BATCH];
+	static float value[GC_TEST_BATCH];
+	char *msg;
+	uint32_t fails = 0;
+	float strtof_time = 0, lexer_time = 0;
+	struct timespec start;
+
+	srand(1);
+	for (uint32_t n=0; n < GC_TEST_VALUES; n += GC_TEST_BATCH) {
+		for (uint16_t i=0; i < GC_TEST_BATCH; i++) {
+			block[i][0] = 'X';
+			_test_random_value(block[i]+1);
+		}
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		for (uint16_t i=0; i < GC_TEST_BATCH; i++) {
+			expected[i] = strtof(block[i]+1, NULL);
+		}
+		strtof_time += _test_elapsed(&start);
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		for (uint16_t i=0; i < GC_TEST_BATCH; i++) {
+			_lex_gcode_block(block[i], &msg);
+			value[i] = gp.word[0].value;
+		}
+		lexer_time += _test_elapsed(&start);
+
+		for (uint16_t i=0; i < GC_TEST_BATCH; i++) {
+			if ((memcmp(&expected[i], &value[i], sizeof(float)) != 0) && (++fails <= 10)) {
+				printf("gcode value fuzz FAIL: %s strtof %.9g lexer %.9g\n",
+						block[i]+1, (double)expected[i], (double)value[i]);
+			}
+		}
+	}
+	printf("gcode value fuzz: %u of %u values differ from strtof(); strtof %.1f ns/value, lexer %.1f ns/word\n",
+			fails, GC_TEST_VALUES, (double)(strtof_time * 1e9 / GC_TEST_VALUES), (double)(lexer_time * 1e9 / GC_TEST_VALUES));
+}
+
+#endif // __UNIT_TEST_GCODE
+#endif // __UNIT_TESTS
+
 /***********************************************************************************
  * TEXT MODE SUPPORT
  * Functions to print variables from the cfgArray table
@@ -44,8 +44,11 @@
 #include "tinyg2.h"
 #include "config.h"
 #include "canonical_machine.h"
+#include "planner.h"
 #include "stepper.h"
 #include "kinematics.h"
+#include "profile.h"
+#include "microbench.h"
 
 #ifdef __cplusplus
 extern "C"{
@@ -67,6 +70,8 @@ extern "C"{
 
 void ik_kinematics(float travel[], float steps[], float microseconds)
 {
+	PROF_SCOPE(PROF_KINEMATICS);
+	MB_RECORD(mb_record_kinematics(travel, microseconds));
 	float joint[AXES];
 
 //	_inverse_kinematics(travel, joint, microseconds);// you can insert inverse kinematics transformations here
@@ -0,0 +1,211 @@
+/*
+ * FILE NAME: output_cache.cpp - FIQ output cache
+ *
+ * Copyright (c) 2014 Robert K. Parker
+ *
+ * This file was part of the TinyG project
+ *
+ * Copyright (c) 2010 - 2013 Alden S. Hart, Jr.
+ *
+ * Now it is in crystalfontz3D
+ *
+ * This file ("the software") is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2 as published by the
+ * Free Software Foundation. You should have received a copy of the GNU General Public
+ * License, version 2 along with the software.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * THE SOFTWARE IS DISTRIBUTED IN THE HOPE THAT IT WILL BE USEFUL, BUT WITHOUT ANY
+ * WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT
+ * SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+/*
+ * PURPOSE:	Keeps the FIQ output of past conversions, to hand it back without converting.
+ *
+ * NOTES:	An entry is <dir>/<hash>.fiq, holding the output file byte for byte. It is
+ *	filled by teeing the output writer (xio_tee_fiq()) into <entry>.<pid>.tmp, which
+ *	is renamed when the conversion completes, so an entry that exists is complete and
+ *	runs sharing the directory don't trip over each other's temporary files.
+ *
+ *
+ * CHANGE HISTORY:
+ *
+ *    Revision: Initial 1.0
+ *    User: R.K.Parker     Date: 05/29/14
+ *    First prototype.
+ *
+ */
+
+#include "tinyg2.h"			// #1
+#include "config.h"			// #2
+#include "output_cache.h"
+#include "util.h"
+#include "xio.h"
+#include "build_id.h"		// generated (build_id.cmake)
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+typedef struct ocEntry {				// one entry of the directory, for eviction
+	int64_t mtime_sec;
+	int64_t mtime_nsec;
+	uint64_t size;
+	char name[24];						// 16 hex digits + OC_SUFFIX
+} ocEntry_t;
+
+ocCache_t occ = { OC_CACHE_OFF, -1 };	// output cache singleton
+
+static void _evict(void);
+static int _compare_age(const void *a, const void *b);
+
+/*
+ * oc_open() - look up the output of the G code file that xio_open_gcode() opened
+ *
+ *	Call after config_init() and xio_open_gcode(). On a hit occ.mode is OC_CACHE_HIT
+ *	and oc_copy() writes the output. Otherwise it is OC_CACHE_FILL and the caller
+ *	tees the output into occ.fd. Returns STAT_FILE_NOT_OPEN, with the cache off, if
+ *	the input can't be cached (stdin or a pipe) or the directory can't be used.
+ */
+stat_t oc_open(const char *dir, uint64_t limit_mb, uint8_t compress)
+{
+	ocKey_t key;
+
+	oc_close(false);
+	if ((xr.is_stdin) || (!xr.mapped)) { return (STAT_FILE_NOT_OPEN);}
+	if ((mkdir(dir, 0755) != 0) && (errno != EEXIST)) { return (STAT_FILE_NOT_OPEN);}
+
+	memset(&key, 0, sizeof(key));
+	key.gcode_hash = xio_hash_gcode();
+	key.gcode_size = xr.file_size;
+	key.config_hash = cmd_hash_config();
+	key.build_hash = compute_hash(0, BUILD_ID, sizeof(BUILD_ID) - 1);
+	key.format = OC_FORMAT;
+	key.compress = compress;
+	strncpy(occ.dir, dir, sizeof(occ.dir) - 1);
+	occ.limit = limit_mb << 20;
+	snprintf(occ.path, sizeof(occ.path), "%s/%016llx%s", occ.dir,
+			 (unsigned long long)compute_hash(0, &key, sizeof(key)), OC_SUFFIX);
+
+	if ((occ.fd = open(occ.path, O_RDONLY)) >= 0) {
+		futimens(occ.fd, NULL);			// now the most recently used
+		occ.mode = OC_CACHE_HIT;
+		return (STAT_OK);
+	}
+	snprintf(occ.temp, sizeof(occ.temp), "%s.%d%s", occ.path, (int)getpid(), OC_TEMP);
+	if ((occ.fd = open(occ.temp, O_WRONLY | O_CREAT | O_TRUNC, 0644)) < 0) { return (STAT_FILE_NOT_OPEN);}
+	occ.mode = OC_CACHE_FILL;
+	return (STAT_OK);
+}
+
+/*
+ * oc_copy() - hit: write the kept output through the output writer
+ *
+ *	The output must be open without compression - the entry is the finished stream.
+ */
+stat_t oc_copy()
+{
+	char buf[XIO_WRITE_BUFFER_LEN];
+	ssize_t count;
+
+	if (occ.mode != OC_CACHE_HIT) { return (STAT_NOOP);}
+	while ((count = read(occ.fd, buf, sizeof(buf))) != 0) {
+		if (count < 0) {
+			if (errno == EINTR) continue;
+			return (STAT_FILE_NOT_OPEN);
+		}
+		xio_write_fiq(buf, count);
+	}
+	return (STAT_OK);
+}
+
+/*
+ * oc_close() - done with the entry
+ *
+ *	Filling, the entry is kept if the conversion completed and every write to it
+ *	worked. Call after xio_close_fiq(), so the last of the output has reached the
+ *	entry. A completed job then trims the directory to its limit - a hit too, as
+ *	the limit may have been lowered.
+ */
+void oc_close(uint8_t complete)
+{
+	if (occ.fd < 0) { return;}
+	if (occ.mode == OC_CACHE_FILL) {
+		xio_tee_fiq(-1);
+		if ((close(occ.fd) != 0) || (!complete) || (xw.tee_error) || (rename(occ.temp, occ.path) != 0)) {
+			unlink(occ.temp);
+			complete = false;
+		}
+	} else {
+		close(occ.fd);
+	}
+	if (complete) { _evict();}
+	occ.fd = -1;
+	occ.mode = OC_CACHE_OFF;
+}
+
+/*
+ * _evict() - remove the least recently used entries until the directory fits its limit
+ */
+static void _evict()
+{
+	DIR *dp;
+	struct dirent *de;
+	struct stat sb;
+	char path[sizeof(occ.dir) + 1 + sizeof(de->d_name)];
+	ocEntry_t *entry = NULL;
+	size_t count = 0, size = 0;
+	uint64_t total = 0;
+
+	if ((dp = opendir(occ.dir)) == NULL) { return;}
+	while ((de = readdir(dp)) != NULL) {
+		size_t len = strlen(de->d_name);
+		if ((len != 16 + sizeof(OC_SUFFIX) - 1) || (strcmp(de->d_name + 16, OC_SUFFIX) != 0)) { continue;}
+		snprintf(path, sizeof(path), "%s/%s", occ.dir, de->d_name);
+		if ((stat(path, &sb) != 0) || (!S_ISREG(sb.st_mode))) { continue;}
+		if (count == size) {
+			size = (size == 0) ? 64 : size * 2;
+			ocEntry_t *grown = (ocEntry_t *)realloc(entry, size * sizeof(ocEntry_t));
+			if (grown == NULL) { break;}
+			entry = grown;
+		}
+		entry[count].mtime_sec = sb.st_mtim.tv_sec;
+		entry[count].mtime_nsec = sb.st_mtim.tv_nsec;
+		entry[count].size = sb.st_size;
+		strcpy(entry[count].name, de->d_name);
+		total += sb.st_size;
+		count++;
+	}
+	closedir(dp);
+
+	if (total > occ.limit) {
+		qsort(entry, count, sizeof(ocEntry_t), _compare_age);
+		for (size_t i=0; (i < count) && (total > occ.limit); i++) {
+			snprintf(path, sizeof(path), "%s/%s", occ.dir, entry[i].name);
+			if (unlink(path) == 0) { total -= entry[i].size;}
+		}
+	}
+	free(entry);
+}
+
+static int _compare_age(const void *a, const void *b)		// oldest first
+{
+	const ocEntry_t *ea = (const ocEntry_t *)a;
+	const ocEntry_t *eb = (const ocEntry_t *)b;
+
+	if (ea->mtime_sec != eb->mtime_sec) { return ((ea->mtime_sec < eb->mtime_sec) ? -1 : 1);}
+	if (ea->mtime_nsec != eb->mtime_nsec) { return ((ea->mtime_nsec < eb->mtime_nsec) ? -1 : 1);}
+	return (0);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -42,6 +42,7 @@
 #include "canonical_machine.h"
 #include "plan_arc.h"
 #include "planner.h"
+#include "metrics.h"
 #include "util.h"
 
 #ifdef __cplusplus
@@ -59,6 +60,7 @@ static stat_t _compute_center_arc(void);
 static stat_t _get_arc_radius(void);
 static float _get_arc_time (const float linear_travel, const float angular_travel, const float radius);
 static float _get_theta(const float x, const float y);
+static void _advance_arc_theta(void);
 
 static stat_t _setup_arc(const GCodeState_t *gm_arc, 	// gcode model state
 			  const float i, const float j, const float k,
@@ -153,6 +155,9 @@ stat_t cm_arc_feed(float target[], float flags[],	// arc endpoints
  *	Each time it's called it queues as many arc segments (lines) as it can 
  *	before it blocks, then returns.
  *
+ *	In ARC_NATIVE mode ($mn) the whole arc is queued at once as a single block
+ *	(mp_arc()) and the runtime generates the segments.
+ *
  *  Parts of this routine were originally sourced from the grbl project.
  */
 
@@ -161,10 +166,18 @@ stat_t cm_arc_callback()
 	if (arc.run_state == MOVE_STATE_OFF) { return (STAT_NOOP);}
 	if (mp_get_planner_buffers_available() < PLANNER_BUFFER_HEADROOM) { return (STAT_EAGAIN);}
 	if (arc.run_state == MOVE_STATE_RUN) {
+		if (cm.arc_mode == ARC_NATIVE) {
+			float center[2] = { arc.center_1, arc.center_2 };
+			arc.gm.target[arc.axis_linear] = arc.endpoint[arc.axis_linear];
+			arc.gm.move_time = arc.arc_time;				// the block runs the whole arc
+			mp_arc(&arc.gm, center, arc.radius, arc.theta, arc.angular_travel, arc.axis_1, arc.axis_2);
+			arc.run_state = MOVE_STATE_OFF;
+			return (STAT_OK);
+		}
 		if (--arc.segment_count > 0) {
-			arc.theta += arc.segment_theta;
-			arc.gm.target[arc.axis_1] = arc.center_1 + sin(arc.theta) * arc.radius;
-			arc.gm.target[arc.axis_2] = arc.center_2 + cos(arc.theta) * arc.radius;
+			_advance_arc_theta();
+			arc.gm.target[arc.axis_1] = arc.center_1 + arc.sin_theta * arc.radius;
+			arc.gm.target[arc.axis_2] = arc.center_2 + arc.cos_theta * arc.radius;
 			arc.gm.target[arc.axis_linear] += arc.segment_linear_travel;
 			mp_aline(&arc.gm);								// run the line
 			copy_axis_vector(arc.position, arc.gm.target);	// update arc current position	
@@ -177,6 +190,30 @@ stat_t cm_arc_callback()
 	return (STAT_OK);
 }
 
+/*
+ * _advance_arc_theta() - step theta and its sin and cos to the next arc segment
+ *
+ *	Rotates (sin_theta, cos_theta) through segment_theta:
+ *
+ *		sin(theta + d) = sin(theta)*cos(d) + cos(theta)*sin(d)
+ *		cos(theta + d) = cos(theta)*cos(d) - sin(theta)*sin(d)
+ *
+ *	and re-anchors to the exact sin() and cos() every ARC_ANCHOR_SEGMENTS segments.
+ *	Uses segment_count, so call it after segment_count has been decremented.
+ */
+static void _advance_arc_theta()
+{
+	arc.theta += arc.segment_theta;
+	if ((arc.segment_count % ARC_ANCHOR_SEGMENTS) == 0) {
+		arc.sin_theta = sin(arc.theta);
+		arc.cos_theta = cos(arc.theta);
+	} else {
+		float sin_theta = arc.sin_theta * arc.cos_segment + arc.cos_theta * arc.sin_segment;
+		arc.cos_theta = arc.cos_theta * arc.cos_segment - arc.sin_theta * arc.sin_segment;
+		arc.sin_theta = sin_theta;
+	}
+}
+
 /*
  * cm_abort_arc() - stop arc movement without maintaining position
  *
@@ -251,10 +288,15 @@ static stat_t _setup_arc(const GCodeState_t *gm_arc, 	// gcode model state
 	arc.segment_count = (uint32_t)arc.segments;
 	arc.segment_theta = arc.angular_travel / arc.segments;
 	arc.segment_linear_travel = arc.linear_travel / arc.segments;
-	arc.center_1 = arc.position[arc.axis_1] - sin(arc.theta) * arc.radius;
-	arc.center_2 = arc.position[arc.axis_2] - cos(arc.theta) * arc.radius;
+	arc.sin_theta = sin(arc.theta);
+	arc.cos_theta = cos(arc.theta);
+	arc.sin_segment = sin(arc.segment_theta);
+	arc.cos_segment = cos(arc.segment_theta);
+	arc.center_1 = arc.position[arc.axis_1] - arc.sin_theta * arc.radius;
+	arc.center_2 = arc.position[arc.axis_2] - arc.cos_theta * arc.radius;
 	arc.gm.target[arc.axis_linear] = arc.position[arc.axis_linear];
 	arc.run_state = MOVE_STATE_RUN;
+	jm.arcs++;
 	return (STAT_OK);
 }
 
@@ -459,6 +501,7 @@ static float _get_arc_time (const float linear_travel, 		// in mm
 	} else {
 		move_time = sqrt(square(planar_travel) + square(linear_travel)) / gm.feed_rate;
 	}
+	float feed_time = move_time;
 	if ((tmp = planar_travel/cm.a[gmx.plane_axis_0].feedrate_max) > move_time) {
 		move_time = tmp;
 	}
@@ -468,6 +511,7 @@ static float _get_arc_time (const float linear_travel, 		// in mm
 	if ((tmp = fabs(linear_travel/cm.a[gmx.plane_axis_2].feedrate_max)) > move_time) {
 		move_time = tmp;
 	}
+	if (move_time > feed_time) { jm.clamped++;}	// an axis feed rate limit slowed the arc
 	return (move_time);
 }
 
@@ -500,9 +544,111 @@ static float _get_theta(const float x, const float y)
 #ifdef __UNIT_TESTS
 #ifdef __UNIT_TEST_PLANNER
 
+#define ARC_TEST_CIRCLES 2000		// circles run by the timing test
+#define ARC_TEST_MAX_DEVIATION 0.001	// mm - recurrence points further than this from sin/cos fail
+
+static void _test_arc_recurrence(void);
+static void _test_arc_recurrence_timing(void);
+static void _test_arc_start(float theta, float radius, float angular_travel, float segments);
+static float _test_arc_elapsed(struct timespec *start);
+
 void mp_plan_arc_unit_tests()
 {
 //	_mp_test_buffers();
+	_test_arc_recurrence();
+	_test_arc_recurrence_timing();
+}
+
+/*
+ * _test_arc_start() - load the arc singleton as _setup_arc() would for the arc tests
+ */
+static void _test_arc_start(float theta, float radius, float angular_travel, float segments)
+{
+	arc.theta = theta;
+	arc.radius = radius;
+	arc.angular_travel = angular_travel;
+	arc.segments = segments;
+	arc.segment_count = (uint32_t)segments;
+	arc.segment_theta = angular_travel / segments;
+	arc.sin_theta = sin(arc.theta);
+	arc.cos_theta = cos(arc.theta);
+	arc.sin_segment = sin(arc.segment_theta);
+	arc.cos_segment = cos(arc.segment_theta);
+}
+
+static float _test_arc_elapsed(struct timespec *start)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return ((now.tv_sec - start->tv_sec) + (now.tv_nsec - start->tv_nsec) / 1000000000.0);
+}
+
+/*
+ * _test_arc_recurrence() - compare recurrence arc points to the direct sin() and cos() points
+ *
+ *	Runs each arc segment by segment both ways and reports the largest distance
+ *	between the two points in mm. An arc fails if it is ARC_TEST_MAX_DEVIATION or more.
+ */
+static void _test_arc_recurrence()
+{
+	//					theta	radius	angular	 segments
+	float test[][4] = {{ 0,		 1,		 2*M_PI,	 63 },		// small full circle
+					   { -2.356, 25,	 2*M_PI,	 1571 },	// full circle, start at -135 degrees
+					   { 1.0,	 100,	 -3.0,		 3000 },	// CCW arc
+					   { 3.0,	 500,	 -2*M_PI,	 31416 },	// large circle, many segments
+					   { -1.0,	 10,	 0.01,		 1 }};		// single segment
+
+	for (uint8_t i=0; i < sizeof(test)/sizeof(test[0]); i++) {
+		_test_arc_start(test[i][0], test[i][1], test[i][2], test[i][3]);
+		float theta = arc.theta;
+		float deviation = 0;
+		while (--arc.segment_count > 0) {
+			theta += arc.segment_theta;			// what cm_arc_callback() did before
+			_advance_arc_theta();
+			deviation = max(deviation, (float)hypot((arc.sin_theta - sin(theta)) * arc.radius,
+													(arc.cos_theta - cos(theta)) * arc.radius));
+		}
+		printf("arc test %d: %s radius %8.3f segments %6.0f max deviation %.9f mm\n",
+				i, ((deviation < ARC_TEST_MAX_DEVIATION) ? "pass" : "FAIL"),
+				(double)test[i][1], (double)test[i][3], (double)deviation);
+	}
+}
+
+/*
+ * _test_arc_recurrence_timing() - time segment generation for a circle-heavy file
+ *
+ *	Generates the points of ARC_TEST_CIRCLES circles with the direct sin() and cos()
+ *	calls and with the recurrence, and reports the time per segment for each.
+ */
+static void _test_arc_recurrence_timing()
+{
+	struct timespec start;
+	float segments = 360;
+	float sum = 0;						// keeps the optimizer from dropping the loops
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (uint16_t i=0; i < ARC_TEST_CIRCLES; i++) {
+		_test_arc_start(i * 0.001, 5, 2*M_PI, segments);
+		while (--arc.segment_count > 0) {
+			arc.theta += arc.segment_theta;
+			sum += sin(arc.theta) * arc.radius + cos(arc.theta) * arc.radius;
+		}
+	}
+	float direct = _test_arc_elapsed(&start);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (uint16_t i=0; i < ARC_TEST_CIRCLES; i++) {
+		_test_arc_start(i * 0.001, 5, 2*M_PI, segments);
+		while (--arc.segment_count > 0) {
+			_advance_arc_theta();
+			sum -= arc.sin_theta * arc.radius + arc.cos_theta * arc.radius;
+		}
+	}
+	float recurrence = _test_arc_elapsed(&start);
+
+	float per_segment = 1000000000.0 / (ARC_TEST_CIRCLES * (segments - 1));
+	printf("arc timing: sin/cos %.1f ns/segment, recurrence %.1f ns/segment (residual %f)\n",
+			(double)(direct * per_segment), (double)(recurrence * per_segment), (double)sum);
 }
 
 #endif
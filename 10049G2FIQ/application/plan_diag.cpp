@@ -0,0 +1,267 @@
+/*
+ * FILE NAME: plan_diag.cpp - planner lookahead diagnostics
+ *
+ * Copyright (c) 2014 Robert K. Parker
+ *
+ * This file was part of the TinyG project
+ *
+ * Copyright (c) 2010 - 2013 Alden S. Hart, Jr.
+ *
+ * Now it is in crystalfontz3D
+ *
+ * This file ("the software") is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2 as published by the
+ * Free Software Foundation. You should have received a copy of the GNU General Public
+ * License, version 2 along with the software.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * THE SOFTWARE IS DISTRIBUTED IN THE HOPE THAT IT WILL BE USEFUL, BUT WITHOUT ANY
+ * WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT
+ * SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+/*
+ * PURPOSE: planner lookahead diagnostics - the print time lost to a short planning queue.
+ *
+ *
+ * CHANGE HISTORY:
+ *
+ *    Revision: Initial 1.0
+ *    User: R.K.Parker     Date: 05/29/14
+ *    First prototype.
+ *
+ */
+
+#include "tinyg2.h"
+#include "config.h"
+#include "canonical_machine.h"
+#include "planner.h"
+#include "plan_diag.h"
+#include "util.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+// Allocate diagnostics singleton structure
+
+mpDiag_t diag;
+
+static mpDiagBlock_t *_add_record(void);
+static float _get_reachable_velocity(const float Vi, const mpDiagBlock_t *r);
+static float _get_ideal_time(const float entry, const float exit, const mpDiagBlock_t *r);
+static float _get_time(const mpBuf_t *bf);
+
+/*
+ * mp_diag_start() - drop the last job's records; start recording if enabled
+ */
+void mp_diag_start(uint8_t enabled)
+{
+	free(diag.block);
+	memset(&diag, 0, sizeof(diag));
+	diag.enabled = enabled;
+	diag.after_hold = true;				// the job starts from a stop
+}
+
+/*
+ * mp_diag_block() - record a block as it starts to execute
+ *
+ *	The junction limit is worked out here against the block that really ran before
+ *	it. The planner's entry_vmax may have been taken against an emptied buffer if
+ *	the block before had finished by the time this one was queued.
+ */
+void mp_diag_block(const mpBuf_t *bf)
+{
+	mpDiagBlock_t *r;
+	float entry_unit[AXES];
+	uint8_t exact_stop = (bf->gm.path_control == PATH_EXACT_STOP);
+
+	if ((r = _add_record()) == NULL) return;
+
+	copy_axis_vector(entry_unit, bf->unit);
+	if (bf->arc_flag == true) {			// an arc starts out along its entry tangent (mp_arc())
+		float tangent = bf->arc_angular_travel * bf->arc_radius / bf->length;
+		entry_unit[bf->arc_axis_1] = cos(bf->arc_theta) * tangent;
+		entry_unit[bf->arc_axis_2] = -sin(bf->arc_theta) * tangent;
+		r->flags |= DIAG_ARC;
+	}
+	if ((diag.after_hold) || (diag.exact_stop) || (exact_stop)) {
+		r->junction_vmax = 0;
+	} else {
+		r->junction_vmax = min3(mp_get_junction_vmax(diag.unit, entry_unit), diag.cruise_vmax, bf->cruise_vmax);
+	}
+	if (bf->nx->buffer_state == MP_BUFFER_EMPTY) { r->flags |= DIAG_STARVED;}
+	if (exact_stop) { r->flags |= DIAG_EXACT_STOP;}
+
+	r->line = bf->line;
+	r->length = bf->length;
+	r->jerk = bf->jerk;
+	r->entry_velocity = bf->entry_velocity;
+	r->cruise_velocity = bf->cruise_velocity;
+	r->exit_velocity = bf->exit_velocity;
+	r->entry_vmax = bf->entry_vmax;
+	r->cruise_vmax = bf->cruise_vmax;
+	r->exit_vmax = bf->exit_vmax;
+	r->time = _get_time(bf);
+
+	copy_axis_vector(diag.unit, bf->unit);
+	diag.cruise_vmax = bf->cruise_vmax;
+	diag.exact_stop = exact_stop;
+	diag.after_hold = false;
+}
+
+/*
+ * mp_diag_hold() - record a command or dwell; the blocks either side stop at it
+ */
+void mp_diag_hold()
+{
+	mpDiagBlock_t *r;
+
+	if ((r = _add_record()) == NULL) return;
+	r->flags = DIAG_HOLD;
+	diag.after_hold = true;
+}
+
+/*
+ * mp_diag_finish() - replan the job with unlimited lookahead and write the block log
+ *
+ *	The replan is the planner's own, run over every block at once: a backward pass
+ *	finds the fastest exit each block can still stop from in the blocks after it,
+ *	and a forward pass holds that to what it can reach from its entry. Each block's
+ *	time is then taken from _calculate_trapezoid() with the replanned velocities.
+ */
+stat_t mp_diag_finish(const char *path)
+{
+	FILE *f;
+	float braking = 0;					// fastest exit the blocks after can stop from
+	float entry = 0;
+	double time = 0;
+	double ideal_time = 0;
+
+	if (diag.failed) {
+		mp_diag_start(false);
+		return (STAT_BUFFER_FULL);
+	}
+	for (uint32_t i = diag.blocks; i-- > 0;) {
+		mpDiagBlock_t *r = &diag.block[i];
+		if (r->flags & DIAG_HOLD) {
+			braking = 0;
+			continue;
+		}
+		r->ideal_exit = braking;
+		braking = min(r->junction_vmax, _get_reachable_velocity(r->ideal_exit, r));
+	}
+	for (uint32_t i = 0; i < diag.blocks; i++) {
+		mpDiagBlock_t *r = &diag.block[i];
+		if (r->flags & DIAG_HOLD) {
+			entry = 0;
+			continue;
+		}
+		r->ideal_exit = min(r->ideal_exit, _get_reachable_velocity(entry, r));
+		r->ideal_time = _get_ideal_time(entry, r->ideal_exit, r);
+		if (r->exit_velocity < r->ideal_exit * (1 - DIAG_TOLERANCE / 100)) {
+			r->flags |= DIAG_LIMITED;
+			diag.total_limited++;
+		}
+		time += r->time;
+		ideal_time += r->ideal_time;
+		entry = r->ideal_exit;
+	}
+	diag.total_time = time * 60;
+	diag.total_lost = (time - ideal_time) * 60;
+
+	if ((f = fopen(path, "w")) == NULL) { return (STAT_FILE_NOT_OPEN);}
+	fprintf(f, "# Planned and unlimited lookahead velocities of each block, mm/min\n");
+	fprintf(f, "# flags: L lookahead limited, S nothing queued behind it, A arc, E exact stop\n");
+	fprintf(f, "#   line     entry entry_vmax    cruise cruise_vmax      exit exit_vmax  ideal_exit   time_ms   lost_ms flags\n");
+	for (uint32_t i = 0; i < diag.blocks; i++) {
+		const mpDiagBlock_t *r = &diag.block[i];
+		if (r->flags & DIAG_HOLD) {
+			fprintf(f, "# hold\n");
+			continue;
+		}
+		fprintf(f, "%8lu %9.1f %10.1f %9.1f %11.1f %9.1f %9.1f %11.1f %9.3f %9.3f %s%s%s%s\n",
+				(unsigned long)r->line, r->entry_velocity, r->entry_vmax, r->cruise_velocity, r->cruise_vmax,
+				r->exit_velocity, r->exit_vmax, r->ideal_exit, r->time * 60000, (r->time - r->ideal_time) * 60000,
+				(r->flags & DIAG_LIMITED) ? "L" : "", (r->flags & DIAG_STARVED) ? "S" : "",
+				(r->flags & DIAG_ARC) ? "A" : "", (r->flags & DIAG_EXACT_STOP) ? "E" : "");
+	}
+	fprintf(f, "# %lu of %lu blocks lookahead limited. Planned %.3f s, %.3f s with unlimited lookahead: %.3f s lost\n",
+			(unsigned long)diag.total_limited, (unsigned long)mp_get_total_moves(), diag.total_time,
+			ideal_time * 60, diag.total_lost);
+
+	free(diag.block);
+	diag.block = NULL;
+	diag.blocks = diag.size = 0;
+	if (fclose(f) != 0) { return (STAT_FILE_NOT_OPEN);}
+	return (STAT_OK);
+}
+
+/*
+ * _add_record() - next free record, growing the records by DIAG_CHUNK as needed
+ *
+ *	Recording stops if they can't grow; mp_diag_finish() then fails.
+ */
+static mpDiagBlock_t *_add_record()
+{
+	if (diag.blocks == diag.size) {
+		mpDiagBlock_t *block = (mpDiagBlock_t *)realloc(diag.block, (diag.size + DIAG_CHUNK) * sizeof(mpDiagBlock_t));
+		if (block == NULL) {
+			diag.enabled = false;
+			diag.failed = true;
+			return (NULL);
+		}
+		diag.block = block;
+		diag.size += DIAG_CHUNK;
+	}
+	mpDiagBlock_t *r = &diag.block[diag.blocks++];
+	memset(r, 0, sizeof(mpDiagBlock_t));
+	return (r);
+}
+
+/*
+ * _get_reachable_velocity() - fastest velocity the block can reach from Vi, or brake to Vi from
+ * _get_ideal_time()		 - time of the block, in minutes, planned with this entry and exit
+ * _get_time()				 - time of a planned block, in minutes, from its sections
+ */
+static float _get_reachable_velocity(const float Vi, const mpDiagBlock_t *r)
+{
+	mpBuf_t bf;
+
+	bf.jerk = r->jerk;
+	bf.cbrt_jerk = cbrt(r->jerk);
+	bf.recip_jerk = 1/r->jerk;
+	return (mp_get_target_velocity(Vi, r->length, &bf));
+}
+
+static float _get_ideal_time(const float entry, const float exit, const mpDiagBlock_t *r)
+{
+	mpBuf_t bf;
+
+	memset(&bf, 0, sizeof(bf));
+	bf.length = r->length;
+	bf.jerk = r->jerk;
+	bf.cbrt_jerk = cbrt(r->jerk);
+	bf.recip_jerk = 1/r->jerk;
+	bf.entry_velocity = entry;
+	bf.cruise_vmax = r->cruise_vmax;
+	bf.cruise_velocity = r->cruise_vmax;
+	bf.exit_velocity = exit;
+	mp_calculate_trapezoid(&bf);
+	return (_get_time(&bf));
+}
+
+static float _get_time(const mpBuf_t *bf)
+{
+	float time = 0;
+
+	if (bf->head_length > 0) { time += 2 * bf->head_length / (bf->entry_velocity + bf->cruise_velocity);}
+	if (bf->body_length > 0) { time += bf->body_length / bf->cruise_velocity;}
+	if (bf->tail_length > 0) { time += 2 * bf->tail_length / (bf->cruise_velocity + bf->exit_velocity);}
+	return (time);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,260 @@
+/*
+ * FILE NAME: plan_fit.cpp - arc fitting of short moves ahead of the planner
+ *
+ * Copyright (c) 2014 Robert K. Parker
+ *
+ * This file was part of the TinyG project
+ *
+ * Copyright (c) 2010 - 2013 Alden S. Hart, Jr.
+ *
+ * Now it is in crystalfontz3D
+ *
+ * This file ("the software") is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2 as published by the
+ * Free Software Foundation. You should have received a copy of the GNU General Public
+ * License, version 2 along with the software.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * THE SOFTWARE IS DISTRIBUTED IN THE HOPE THAT IT WILL BE USEFUL, BUT WITHOUT ANY
+ * WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT
+ * SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+/*
+ * PURPOSE: arc fitting of short moves ahead of the planner.
+ *
+ * NOTES:	Arc fitting sits between the canonical machine and merging:
+ *
+ *		cm_straight_feed() -> mp_fit_aline() -> mp_merge_aline() -> mp_aline()
+ *								    `-> mp_arc()
+ *
+ *	A move is added to the chain, and while the chain no longer fits one arc its
+ *	front is queued - as an arc if it is long enough, else as a line - until it
+ *	does. So the chain always fits an arc. mp_merge_flush() flushes the chain first,
+ *	which makes every planner entry point flush both stages in order.
+ *
+ *
+ * CHANGE HISTORY:
+ *
+ *    Revision: Initial 1.0
+ *    User: R.K.Parker     Date: 05/29/14
+ *    First prototype.
+ *
+ */
+
+#include "tinyg2.h"
+#include "config.h"
+#include "canonical_machine.h"
+#include "plan_fit.h"
+#include "plan_merge.h"
+#include "planner.h"
+#include "util.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+// Allocate arc fitting singleton structure
+
+mpFit_t fit;
+
+static uint8_t _can_chain(const GCodeState_t *gm_line, const float start[]);
+static uint8_t _fit_arc(const uint8_t count);
+static void _queue_arc(const uint8_t count);
+static void _queue_lines(const uint8_t count);
+static void _drop_moves(const uint8_t count);
+static float _get_xy_length(const float a[], const float b[]);
+
+uint32_t mp_get_total_fitted(void) { return (fit.total_fitted);}
+uint32_t mp_get_total_arcs(void) { return (fit.total_arcs);}
+
+/*
+ * mp_fit_aline() - canonical machine entry point for G1 moves
+ *
+ *	Returns the status mp_aline() would have for the move, as mp_merge_aline() does.
+ */
+stat_t mp_fit_aline(const GCodeState_t *gm_line)
+{
+	if (cm.arc_fit == FIT_ARCS_OFF) { return (mp_merge_aline(gm_line));}
+
+	// where the move starts: the chain, else the merging stage, else the planner
+	const float *start = (fit.count > 0) ? fit.move[fit.count-1].target :
+						 (merge.pending) ? merge.gm.target : mm.position;
+	if (get_axis_vector_length(gm_line->target, start) < MIN_LENGTH_MOVE) {
+		return (STAT_MINIMUM_LENGTH_MOVE_ERROR);
+	}
+	if (!_can_chain(gm_line, start)) {
+		mp_fit_flush();
+		return (mp_merge_aline(gm_line));
+	}
+	if (fit.count == 0) {
+		copy_axis_vector(fit.start, start);
+	} else if (fit.count == FIT_MAX_MOVES) {
+		_queue_arc(fit.count);						// the chain starts again at its end
+	}
+	memcpy(&fit.move[fit.count++], gm_line, sizeof(GCodeState_t));
+
+	while ((fit.count >= 2) && (!_fit_arc(fit.count))) {
+		if (fit.count > FIT_MIN_MOVES) {
+			_queue_arc(fit.count - 1);		// all but the new move
+		} else {
+			_queue_lines(1);
+		}
+	}
+	return (STAT_OK);
+}
+
+/*
+ * mp_fit_flush() - queue the chain, as an arc if it is long enough
+ * mp_fit_reset() - drop the chain (planner flush)
+ */
+void mp_fit_flush()
+{
+	if ((fit.emitting) || (fit.count == 0)) { return;}
+	if (fit.count >= FIT_MIN_MOVES) {
+		_queue_arc(fit.count);
+	} else {
+		_queue_lines(fit.count);
+	}
+}
+
+void mp_fit_reset()
+{
+	fit.count = 0;
+}
+
+/*
+ * _can_chain() - TRUE if a move may join the chain
+ *
+ *	The chain is in the XY plane at the Z it starts at, and its moves must match
+ *	the first one closely enough to share one arc block.
+ */
+static uint8_t _can_chain(const GCodeState_t *gm_line, const float start[])
+{
+	if (gm_line->motion_mode != MOTION_MODE_STRAIGHT_FEED) { return (false);}
+	if (gm_line->inverse_feed_rate_mode == true) { return (false);}
+	if (gm_line->path_control == PATH_EXACT_STOP) { return (false);}
+	float xy_length = _get_xy_length(gm_line->target, start);
+	if (xy_length < MIN_LENGTH_MOVE) { return (false);}
+	if (fp_NE(gm_line->target[AXIS_Z], start[AXIS_Z])) { return (false);}
+	if (fit.count == 0) { return (true);}
+
+	const GCodeState_t *first = &fit.move[0];
+	if ((gm_line->path_control != first->path_control) ||
+		(gm_line->spindle_speed != first->spindle_speed) ||
+		(memcmp(gm_line->work_offset, first->work_offset, sizeof(gm_line->work_offset)) != 0) ||
+		(!mp_within_merge_tolerance(gm_line->feed_rate, first->feed_rate))) {
+		return (false);
+	}
+	float first_length = _get_xy_length(first->target, fit.start);
+	for (uint8_t axis = AXIS_A; axis < AXES; axis++) {
+		float rate = (gm_line->target[axis] - start[axis]) / xy_length;
+		float first_rate = (first->target[axis] - fit.start[axis]) / first_length;
+		if (!mp_within_merge_tolerance(rate, first_rate)) { return (false);}
+	}
+	return (true);
+}
+
+/*
+ * _fit_arc() - TRUE if the first count moves of the chain fit one arc
+ *
+ *	Leaves the circle and the angles in fit for _queue_arc(). Angles are measured
+ *	clockwise from the +Y axis, as for G2/G3 arcs.
+ */
+static uint8_t _fit_arc(const uint8_t count)
+{
+	double x0 = fit.start[AXIS_X];
+	double y0 = fit.start[AXIS_Y];
+	const float *mid = fit.move[count/2 - 1].target;		// count >= 2
+	const float *end = fit.move[count - 1].target;
+
+	// circle through the start, middle and end points
+	double ax = mid[AXIS_X] - x0, ay = mid[AXIS_Y] - y0;
+	double bx = end[AXIS_X] - x0, by = end[AXIS_Y] - y0;
+	double d = 2 * (ax*by - ay*bx);
+	double a2 = ax*ax + ay*ay, b2 = bx*bx + by*by;
+	if (d == 0) { return (false);}								// straight
+	double ux = (by*a2 - ay*b2) / d;
+	double uy = (ax*b2 - bx*a2) / d;
+	fit.radius = sqrt(ux*ux + uy*uy);
+	if (fit.radius > FIT_MAX_RADIUS) { return (false);}
+	fit.center[0] = x0 + ux;
+	fit.center[1] = y0 + uy;
+
+	// every point and chord midpoint near the circle, and all turning the same way
+	double tolerance = cm.fit_tolerance;
+	double px = -ux, py = -uy;									// start point from the center
+	fit.theta = atan2(px, py);
+	fit.angular_travel = 0;
+	for (uint8_t i=0; i < count; i++) {
+		double qx = fit.move[i].target[AXIS_X] - fit.center[0];
+		double qy = fit.move[i].target[AXIS_Y] - fit.center[1];
+		double mx = (px + qx) / 2, my = (py + qy) / 2;
+		if ((fabs(sqrt(qx*qx + qy*qy) - fit.radius) > tolerance) ||
+			(fabs(sqrt(mx*mx + my*my) - fit.radius) > tolerance)) { return (false);}
+		double step = -atan2(px*qy - py*qx, px*qx + py*qy);		// clockwise positive
+		if ((i > 0) && ((step > 0) != (fit.angular_travel > 0))) { return (false);}
+		fit.angular_travel += step;
+		px = qx;
+		py = qy;
+	}
+	return (fabs(fit.angular_travel) < 2*M_PI);
+}
+
+/*
+ * _queue_arc() 	- queue the first count moves of the chain as one arc block
+ * _queue_lines()	- queue the first count moves of the chain as they are
+ *
+ *	The chain is left holding the moves after them. fit.emitting keeps the stages
+ *	below from flushing the rest of the chain while these are queued.
+ */
+static void _queue_arc(const uint8_t count)
+{
+	GCodeState_t gm_arc;
+	float center[2];
+
+	_fit_arc(count);
+	memcpy(&gm_arc, &fit.move[count-1], sizeof(GCodeState_t));
+	gm_arc.move_time = 0;
+	gm_arc.minimum_time = 0;
+	for (uint8_t i=0; i < count; i++) {
+		gm_arc.move_time += fit.move[i].move_time;
+		gm_arc.minimum_time += fit.move[i].minimum_time;
+	}
+	center[0] = fit.center[0];
+	center[1] = fit.center[1];
+
+	fit.emitting = true;
+	mp_arc(&gm_arc, center, fit.radius, fit.theta, fit.angular_travel, AXIS_X, AXIS_Y);
+	fit.emitting = false;
+	fit.total_fitted += count;
+	fit.total_arcs++;
+	_drop_moves(count);
+}
+
+static void _queue_lines(const uint8_t count)
+{
+	fit.emitting = true;
+	for (uint8_t i=0; i < count; i++) {
+		mp_merge_aline(&fit.move[i]);
+	}
+	fit.emitting = false;
+	_drop_moves(count);
+}
+
+static void _drop_moves(const uint8_t count)
+{
+	copy_axis_vector(fit.start, fit.move[count-1].target);
+	fit.count -= count;
+	memmove(&fit.move[0], &fit.move[count], fit.count * sizeof(GCodeState_t));
+}
+
+static float _get_xy_length(const float a[], const float b[])
+{
+	return (sqrt(square(a[AXIS_X] - b[AXIS_X]) + square(a[AXIS_Y] - b[AXIS_Y])));
+}
+
+#ifdef __cplusplus
+}
+#endif
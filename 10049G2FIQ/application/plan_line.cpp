@@ -47,9 +47,16 @@
 #include "controller.h"
 #include "canonical_machine.h"
 #include "plan_line.h"
+#include "plan_merge.h"
 #include "planner.h"
+#include "plan_diag.h"
+#include "verify.h"
+#include "metrics.h"
+#include "profile.h"
 #include "kinematics.h"
 #include "stepper.h"
+#include "microbench.h"
+#include "hardware.h"
 #include "report.h"
 #include "util.h"
 
@@ -58,6 +65,7 @@ extern "C"{
 #endif
 
 // aline planner routines / feedhold planning
+static void _queue_aline(mpBuf_t *bf, const float entry_unit[], const float cruise_vmax);
 static void _plan_block_list(mpBuf_t *bf, uint8_t *mr_flag);
 static void _calculate_trapezoid(mpBuf_t *bf);
 static float _get_target_length(const float Vi, const float Vt, const mpBuf_t *bf);
@@ -72,12 +80,18 @@ static stat_t _exec_aline_head(void);
 static stat_t _exec_aline_body(void);
 static stat_t _exec_aline_tail(void);
 static stat_t _exec_aline_segment(uint8_t correction_flag);
+static stat_t _exec_aline_curve(float v0, float a0, float jerk, uint8_t correction_flag);
 static void _init_forward_diffs(float t0, float t2);
+static float _get_section_segments(float move_time, float delta_v);
+static float _get_chord_segments(float length);
+static void _set_arc_segment_target(float segment_length);
 //static float _compute_next_segment_velocity(void);
 
 /* Runtime-specific setters and getters
  *
  * mp_get_runtime_velocity() 		- returns current velocity (aggregate)
+ * mp_get_total_segments()			- returns segments prepped for all moves so far
+ * mp_get_total_moves()				- returns number of moves executed so far
  * mp_get_runtime_machine_position() - returns current axis position in machine coordinates
  * mp_get_runtime_work_position() 	- returns current axis position in work coordinates
  *									  that were in effect at move planning time
@@ -86,6 +100,8 @@ static void _init_forward_diffs(float t0, float t2);
  */
 
 float mp_get_runtime_velocity(void) { return (mr.segment_velocity);}
+uint32_t mp_get_total_segments(void) { return (mr.total_segments);}
+uint32_t mp_get_total_moves(void) { return (mr.total_moves);}
 float mp_get_runtime_absolute_position(uint8_t axis) { return (mr.position[axis]);}
 float mp_get_runtime_work_position(uint8_t axis) { return (mr.position[axis] - mr.gm.work_offset[axis]);}
 void mp_set_runtime_work_offset(float offset[]) { copy_axis_vector(mr.gm.work_offset, offset);}
@@ -104,6 +120,22 @@ uint8_t mp_get_runtime_busy()
 	return (false);
 }
 
+/*
+ * mp_get_junction_vmax()	- _get_junction_vmax() for the planner diagnostics
+ * mp_get_target_velocity() - _get_target_velocity()
+ * mp_calculate_trapezoid() - _calculate_trapezoid()
+ */
+float mp_get_junction_vmax(const float a_unit[], const float b_unit[]) { return (_get_junction_vmax(a_unit, b_unit));}
+float mp_get_target_velocity(const float Vi, const float L, const mpBuf_t *bf) { return (_get_target_velocity(Vi, L, bf));}
+void mp_calculate_trapezoid(mpBuf_t *bf) { _calculate_trapezoid(bf);}
+
+#ifdef __MICROBENCH
+/*
+ * mp_bench_exec_aline_segment() - _exec_aline_segment() for the microbenchmarks
+ */
+stat_t mp_bench_exec_aline_segment(uint8_t correction_flag) { return (_exec_aline_segment(correction_flag));}
+#endif
+
 /**************************************************************************
  * mp_aline() - plan a line with acceleration / deceleration
  *
@@ -124,10 +156,11 @@ uint8_t mp_get_runtime_busy()
 
 stat_t mp_aline(const GCodeState_t *gm_line)
 {
+	PROF_SCOPE(PROF_PLAN_LINE);
+	MB_RECORD(mb_record_aline(gm_line));
 	mpBuf_t *bf; 						// current move pointer
-	float exact_stop = 0;
-	float junction_velocity;
 
+	mp_merge_flush();					// arc segments come here directly
 	// trap error conditions
 	float length = get_axis_vector_length(gm_line->target, mm.position);
 	if (length < MIN_LENGTH_MOVE) { return (STAT_MINIMUM_LENGTH_MOVE_ERROR);}
@@ -168,6 +201,115 @@ stat_t mp_aline(const GCodeState_t *gm_line)
 	}
 	bf->jerk = sqrt(bf->jerk) * JERK_MULTIPLIER;
 
+	_queue_aline(bf, bf->unit, bf->length / bf->gm.move_time);
+	return (STAT_OK);
+}
+
+/*
+ * mp_arc() - plan an arc as a single block
+ *
+ *	The ARC_NATIVE counterpart of the segment lines queued by cm_arc_callback().
+ *	The block is planned like a line of the arc's (helix) length, but with the
+ *	arc's own velocity limits: cruise is capped by the centripetal acceleration
+ *	v^2/r <= junction_acceleration, and the junctions are taken against the entry
+ *	tangent (previous move) and the exit tangent (next move, left in bf->unit).
+ *	The runtime places each segment on the arc - see _set_arc_segment_target().
+ *
+ *	gm_arc->target is the arc endpoint; mm.position is the arc start point and
+ *	must lie on the circle at theta.
+ */
+
+stat_t mp_arc(const GCodeState_t *gm_arc, const float center[], const float radius, const float theta,
+			  const float angular_travel, const uint8_t axis_1, const uint8_t axis_2)
+{
+	mpBuf_t *bf; 						// current move pointer
+	float entry_unit[AXES];
+	float planar_travel = fabs(angular_travel * radius);
+
+	mp_merge_flush();
+	// length is the planar travel plus the straight travel of the remaining axes
+	float length = 0;
+	for (uint8_t i=0; i < AXES; i++) {
+		if ((i == axis_1) || (i == axis_2)) continue;
+		length += square(gm_arc->target[i] - mm.position[i]);
+	}
+	length = sqrt(square(planar_travel) + length);
+	if (length < MIN_LENGTH_MOVE) { return (STAT_MINIMUM_LENGTH_MOVE_ERROR);}
+
+	if ((bf = mp_get_write_buffer()) == NULL) { return(cm_alarm(STAT_BUFFER_FULL_FATAL));} // never supposed to fail
+
+	memcpy(&bf->gm, gm_arc, sizeof(GCodeState_t));	// copy model state into planner
+	bf->bf_func = _exec_aline;					// arcs run through the aline runtime
+	bf->length = length;
+	bf->arc_flag = true;
+	bf->arc_axis_1 = axis_1;
+	bf->arc_axis_2 = axis_2;
+	bf->arc_center[0] = center[0];
+	bf->arc_center[1] = center[1];
+	bf->arc_radius = radius;
+	bf->arc_theta = theta;
+	bf->arc_angular_travel = angular_travel;
+
+	// longest segment that stays within the chordal tolerance (but no shorter than $ma)
+	if (cm.chordal_tolerance < radius) {
+		bf->arc_chord = sqrt(4*cm.chordal_tolerance * (2 * radius - cm.chordal_tolerance));
+	} else {
+		bf->arc_chord = 2 * radius;
+	}
+	bf->arc_chord = max(bf->arc_chord, cm.arc_segment_len);
+
+	// the remaining axes move in a straight line and have a constant unit vector
+	for (uint8_t i=0; i < AXES; i++) {
+		if ((i == axis_1) || (i == axis_2)) continue;
+		bf->unit[i] = (bf->gm.target[i] - mm.position[i]) / length;
+		bf->jerk += square(bf->unit[i] * cm.a[i].jerk_max);
+	}
+	// the planar part turns through both plane axes - use the lower of their jerks
+	bf->jerk += square(planar_travel / length * min(cm.a[axis_1].jerk_max, cm.a[axis_2].jerk_max));
+	bf->jerk = sqrt(bf->jerk) * JERK_MULTIPLIER;
+
+	// tangents at the start and the end of the arc (derivatives of the arc point in
+	// cm_arc_callback() with respect to path length)
+	float tangent = angular_travel * radius / length;
+	copy_axis_vector(entry_unit, bf->unit);
+	entry_unit[axis_1] = cos(theta) * tangent;
+	entry_unit[axis_2] = -sin(theta) * tangent;
+	bf->unit[axis_1] = cos(theta + angular_travel) * tangent;
+	bf->unit[axis_2] = -sin(theta + angular_travel) * tangent;
+
+	// cruise is also held to where a chord still takes MIN_SEGMENT_TIME, so the runtime
+	// can always cut segments short enough to keep the chordal tolerance
+	float cruise_vmax = min(sqrt(radius * cm.junction_acceleration), bf->arc_chord / MIN_SEGMENT_TIME);
+	if (cruise_vmax < bf->length / bf->gm.move_time) {
+		jm.clamped++;
+	} else {
+		cruise_vmax = bf->length / bf->gm.move_time;
+	}
+	_queue_aline(bf, entry_unit, cruise_vmax);
+	return (STAT_OK);
+}
+
+/***** ALINE HELPERS *****
+ * _queue_aline()
+ * _plan_block_list()
+ * _calculate_trapezoid()
+ * _get_target_length()
+ * _get_target_velocity()
+ * _get_junction_vmax()
+ * _reset_replannable_list()
+ */
+
+/* _queue_aline() - finish planning a line or arc block and queue it
+ *
+ *	Common tail of mp_aline() and mp_arc(). bf has its length, unit vector and
+ *	jerk set. entry_unit is the direction the block starts out in (same as
+ *	bf->unit for lines) and is used for the junction with the previous block.
+ */
+static void _queue_aline(mpBuf_t *bf, const float entry_unit[], const float cruise_vmax)
+{
+	float exact_stop = 0;
+	float junction_velocity;
+
 	if (fabs(bf->jerk - mm.prev_jerk) < JERK_MATCH_PRECISION) {	// can we re-use jerk terms?
 		bf->cbrt_jerk = mm.prev_cbrt_jerk;
 		bf->recip_jerk = mm.prev_recip_jerk;
@@ -184,8 +326,9 @@ stat_t mp_aline(const GCodeState_t *gm_line)
 		bf->replannable = true;
 		exact_stop = 8675309;								// an arbitrarily large floating point number (Jenny)
 	}
-	bf->cruise_vmax = bf->length / bf->gm.move_time;		// target velocity requested
-	junction_velocity = _get_junction_vmax(bf->pv->unit, bf->unit);
+	bf->cruise_vmax = cruise_vmax;							// target velocity requested
+	bf->line = cs.lineNumber;
+	junction_velocity = _get_junction_vmax(bf->pv->unit, entry_unit);
 	bf->entry_vmax = min3(bf->cruise_vmax, junction_velocity, exact_stop);
 	bf->delta_vmax = _get_target_velocity(0, bf->length, bf);
 	bf->exit_vmax = min3(bf->cruise_vmax, (bf->entry_vmax + bf->delta_vmax), exact_stop);
@@ -195,18 +338,8 @@ stat_t mp_aline(const GCodeState_t *gm_line)
 	_plan_block_list(bf, &mr_flag);							// replan block list and commit current block
 	copy_axis_vector(mm.position, bf->gm.target);			// update planning position
 	mp_queue_write_buffer(MOVE_TYPE_ALINE);
-	return (STAT_OK);
 }
 
-/***** ALINE HELPERS *****
- * _plan_block_list()
- * _calculate_trapezoid()
- * _get_target_length()
- * _get_target_velocity()
- * _get_junction_vmax()
- * _reset_replannable_list()
- */
-
 /* _plan_block_list() - plans the entire block list
  *
  *	The block list is the circular buffer of planner buffers (bf's). The block
@@ -274,6 +407,7 @@ stat_t mp_aline(const GCodeState_t *gm_line)
  */
 static void _plan_block_list(mpBuf_t *bf, uint8_t *mr_flag)
 {
+	PROF_SCOPE(PROF_PLAN_BLOCKS);
 	mpBuf_t *bp = bf;
 
 	// Backward planning pass. Find first block and update the braking velocities.
@@ -410,6 +544,7 @@ static void _reset_replannable_list()
 
 static void _calculate_trapezoid(mpBuf_t *bf)
 {
+	MB_RECORD(mb_record_trapezoid(bf));
 	bf->head_length = 0;		// inialize the lengths
 	bf->body_length = 0;
 	bf->tail_length = 0;
@@ -579,6 +714,7 @@ static float _get_target_length(const float Vi, const float Vt, const mpBuf_t *b
 
 static float _get_target_velocity(const float Vi, const float L, const mpBuf_t *bf)
 {
+	MB_RECORD(mb_record_target_velocity(Vi, L, bf));
 	return (pow(L, 0.66666666) * bf->cbrt_jerk + Vi);
 }
 
@@ -697,6 +833,7 @@ static float _get_target_velocity(const float Vi, const float L, const mpBuf_t *
  */
 static float _get_junction_vmax(const float a_unit[], const float b_unit[])
 {
+	MB_RECORD(mb_record_junction(a_unit, b_unit));
 	float costheta = - (a_unit[AXIS_X] * b_unit[AXIS_X]) - (a_unit[AXIS_Y] * b_unit[AXIS_Y])
 					 - (a_unit[AXIS_Z] * b_unit[AXIS_Z]) - (a_unit[AXIS_A] * b_unit[AXIS_A])
 					 - (a_unit[AXIS_B] * b_unit[AXIS_B]) - (a_unit[AXIS_C] * b_unit[AXIS_C]);
@@ -925,6 +1062,7 @@ stat_t mp_end_hold()
  *	_exec_aline_body()	  - helper for cruise section
  *	_exec_aline_tail()	  - helper for deceleration section
  *	_exec_aline_segment() - helper for running a segment
+ *	_exec_aline_curve()	  - helper for running a step-exact curve section
  *
  *	Returns:
  *	 STAT_OK		move is done
@@ -1012,6 +1150,9 @@ static stat_t _exec_aline(mpBuf_t *bf)
 			return (STAT_NOOP);
 		}
 		bf->move_state = MOVE_STATE_RUN;
+		if (bf->nx->buffer_state == MP_BUFFER_EMPTY) { jm.starved++;}	// planned to stop - nothing to go on to
+		if (diag.enabled) { mp_diag_block(bf);}
+		mr.move_segments = 0;
 		mr.move_state = MOVE_STATE_HEAD;
 		mr.section_state = MOVE_STATE_NEW;
 		mr.jerk = bf->jerk;
@@ -1023,6 +1164,19 @@ static stat_t _exec_aline(mpBuf_t *bf)
 		mr.exit_velocity = bf->exit_velocity;
 		copy_axis_vector(mr.unit, bf->unit);
 		copy_axis_vector(mr.endpoint, bf->gm.target);	// save the final target of the move
+		mr.length = bf->length;
+		mr.arc_flag = bf->arc_flag;
+		if (mr.arc_flag == true) {						// native arc (mp_arc())
+			mr.arc_axis_1 = bf->arc_axis_1;
+			mr.arc_axis_2 = bf->arc_axis_2;
+			mr.arc_center[0] = bf->arc_center[0];
+			mr.arc_center[1] = bf->arc_center[1];
+			mr.arc_radius = bf->arc_radius;
+			mr.arc_theta = bf->arc_theta;
+			mr.arc_angular_travel = bf->arc_angular_travel;
+			mr.arc_chord = bf->arc_chord;
+			mr.arc_travel = 0;
+		}
 	}
 	// NB: from this point on the contents of the bf buffer do not affect execution
 
@@ -1059,10 +1213,14 @@ static stat_t _exec_aline(mpBuf_t *bf)
 	if (status == STAT_EAGAIN) {
 		sr_request_status_report(SR_TIMED_REQUEST); // continue reporting mr buffer
 	} else {
+		mr.last_move_segments = mr.move_segments;	// segment statistics for reporting
+		mr.total_segments += mr.move_segments;
+		mr.total_moves++;
 		mr.move_state = MOVE_STATE_OFF;			// reset mr buffer
 		mr.section_state = MOVE_STATE_OFF;
 		bf->nx->replannable = false;			// prevent overplanning (Note 2)
 		if (bf->move_state == MOVE_STATE_RUN) {
+			if (vf.enabled) { vf_block(bf);}
 			mp_free_run_buffer();				// free bf if it's actually done
 		}
 	}
@@ -1104,6 +1262,41 @@ static void _init_forward_diffs(float t0, float t2)
 	mr.segment_velocity = t0;
 }
 
+/*
+ * _get_section_segments() - number of segments in *each half* of a head or tail
+ *
+ *	With segment_tolerance at zero the section is cut into estd_segment_usec pieces.
+ *	Otherwise the count follows the velocity change instead. Each half changes
+ *	velocity by delta_v/2 in constant-velocity steps, and a step is how far a segment
+ *	strays from the ideal S-curve velocity. Picking enough segments to keep each step
+ *	under segment_tolerance gives gentle accelerations few segments and violent ones
+ *	many. Segment time stays within MIN_SEGMENT_USEC (jerk limit of the section) and
+ *	DDA_MAX_SEGMENT_USEC.
+ */
+static float _get_section_segments(float move_time, float delta_v)
+{
+	float half_usec = uSec(move_time) / 2;
+
+	if (fp_ZERO(cm.segment_tolerance)) {
+		return (ceil(half_usec / cm.estd_segment_usec));
+	}
+	float segments = ceil(fabs(delta_v) / (2 * cm.segment_tolerance));
+	segments = min(segments, floor(half_usec / MIN_SEGMENT_USEC));
+	segments = max(segments, ceil(half_usec / DDA_MAX_SEGMENT_USEC));
+	return (max(segments, (float)1));
+}
+
+/*
+ * _get_chord_segments() - segments needed to run length of a native arc within chordal tolerance
+ *
+ *	Returns zero for lines, which have no chordal limit.
+ */
+static float _get_chord_segments(float length)
+{
+	if (mr.arc_flag == false) { return (0);}
+	return (ceil(length / mr.arc_chord));
+}
+
 /*
  * _exec_aline_head()
  */
@@ -1116,7 +1309,12 @@ static stat_t _exec_aline_head()
 		}
 		mr.midpoint_velocity = (mr.entry_velocity + mr.cruise_velocity) / 2;
 		mr.gm.move_time = mr.head_length / mr.midpoint_velocity;	// time for entire accel region
-		mr.segments = ceil(uSec(mr.gm.move_time) / (2 * cm.estd_segment_usec)); // # of segments in *each half*
+		if ((cm.scurve_mode == SCURVE_STEP_EXACT) && (mr.arc_flag == false)) {
+			mr.segments = 1;								// each half is a single curve section
+		} else {
+			mr.segments = _get_section_segments(mr.gm.move_time, mr.cruise_velocity - mr.entry_velocity);
+			mr.segments = max(mr.segments, _get_chord_segments(mr.cruise_velocity * mr.gm.move_time / 2));
+		}
 		mr.segment_move_time = mr.gm.move_time / (2 * mr.segments);
 		mr.segment_count = (uint32_t)mr.segments;
 		if ((mr.microseconds = uSec(mr.segment_move_time)) < MIN_SEGMENT_USEC) {
@@ -1125,6 +1323,19 @@ static stat_t _exec_aline_head()
 		_init_forward_diffs(mr.entry_velocity, mr.midpoint_velocity);
 		mr.section_state = MOVE_STATE_RUN1;
 	}
+	if ((cm.scurve_mode == SCURVE_STEP_EXACT) && (mr.arc_flag == false)) { // periods 1 and 2 as curve sections
+		float jerk = (mr.cruise_velocity - mr.entry_velocity) / square(mr.segment_move_time);
+		if (mr.section_state == MOVE_STATE_RUN1) {
+			_exec_aline_curve(mr.entry_velocity, 0, jerk, false);
+			mr.section_state = MOVE_STATE_RUN2;
+			return(STAT_EAGAIN);
+		}
+		_exec_aline_curve(mr.midpoint_velocity, jerk * mr.segment_move_time, -jerk, false);
+		if ((fp_ZERO(mr.body_length)) && (fp_ZERO(mr.tail_length))) return(STAT_OK); // ends the move
+		mr.move_state = MOVE_STATE_BODY;
+		mr.section_state = MOVE_STATE_NEW;
+		return(STAT_EAGAIN);
+	}
 	if (mr.section_state == MOVE_STATE_RUN1) {				// concave part of accel curve (period 1)
 		mr.segment_velocity += mr.forward_diff_1;
 		if (_exec_aline_segment(false) == STAT_OK) { 		// set up for second half
@@ -1155,7 +1366,10 @@ static stat_t _exec_aline_head()
  * _exec_aline_body()
  *
  *	The body is broken into little segments even though it is a straight line so that
- *	feedholds can happen in the middle of a line with a minimum of latency
+ *	feedholds can happen in the middle of a line with a minimum of latency.
+ *	In BODY_SEGMENT_LONG mode there are no feedholds to service, so the body is only
+ *	split as far as the DDA accumulators require. Fewer segments also means fewer
+ *	dda_ticks truncations to accumulate.
  */
 static stat_t _exec_aline_body()
 {
@@ -1165,7 +1379,12 @@ static stat_t _exec_aline_body()
 			return(_exec_aline_tail());						// skip ahead to tail periods
 		}
 		mr.gm.move_time = mr.body_length / mr.cruise_velocity;
-		mr.segments = ceil(uSec(mr.gm.move_time) / cm.estd_segment_usec);
+		if (cm.body_segment_mode == BODY_SEGMENT_LONG) {
+			mr.segments = ceil(uSec(mr.gm.move_time) / DDA_MAX_SEGMENT_USEC);
+		} else {
+			mr.segments = ceil(uSec(mr.gm.move_time) / cm.estd_segment_usec);
+		}
+		mr.segments = max(mr.segments, _get_chord_segments(mr.body_length));
 		mr.segment_move_time = mr.gm.move_time / mr.segments;
 		mr.segment_velocity = mr.cruise_velocity;
 		mr.segment_count = (uint32_t)mr.segments;
@@ -1194,7 +1413,12 @@ static stat_t _exec_aline_tail()
 		if (fp_ZERO(mr.tail_length)) { return(STAT_OK);}		// end the move
 		mr.midpoint_velocity = (mr.cruise_velocity + mr.exit_velocity) / 2;
 		mr.gm.move_time = mr.tail_length / mr.midpoint_velocity;
-		mr.segments = ceil(uSec(mr.gm.move_time) / (2 * cm.estd_segment_usec));// # of segments in *each half*
+		if ((cm.scurve_mode == SCURVE_STEP_EXACT) && (mr.arc_flag == false)) {
+			mr.segments = 1;								// each half is a single curve section
+		} else {
+			mr.segments = _get_section_segments(mr.gm.move_time, mr.cruise_velocity - mr.exit_velocity);
+			mr.segments = max(mr.segments, _get_chord_segments(mr.cruise_velocity * mr.gm.move_time / 2));
+		}
 		mr.segment_move_time = mr.gm.move_time / (2 * mr.segments);// time to advance for each segment
 		mr.segment_count = (uint32_t)mr.segments;
 		if ((mr.microseconds = uSec(mr.segment_move_time)) < MIN_SEGMENT_USEC) {
@@ -1203,6 +1427,15 @@ static stat_t _exec_aline_tail()
 		_init_forward_diffs(mr.cruise_velocity, mr.midpoint_velocity);
 		mr.section_state = MOVE_STATE_RUN1;
 	}
+	if ((cm.scurve_mode == SCURVE_STEP_EXACT) && (mr.arc_flag == false)) { // periods 4 and 5 as curve sections
+		float jerk = (mr.cruise_velocity - mr.exit_velocity) / square(mr.segment_move_time);
+		if (mr.section_state == MOVE_STATE_RUN1) {
+			_exec_aline_curve(mr.cruise_velocity, 0, -jerk, false);
+			mr.section_state = MOVE_STATE_RUN2;
+			return(STAT_EAGAIN);
+		}
+		return (_exec_aline_curve(mr.midpoint_velocity, -jerk * mr.segment_move_time, jerk, true));
+	}
 	if (mr.section_state == MOVE_STATE_RUN1) {				// convex part (period 4)
 		mr.segment_velocity += mr.forward_diff_1;
 		if (_exec_aline_segment(false) == STAT_OK) {		// set up for second half
@@ -1230,6 +1463,7 @@ static stat_t _exec_aline_tail()
  */
 static stat_t _exec_aline_segment(uint8_t correction_flag)
 {
+	MB_RECORD(mb_record_segment(correction_flag));
 	float travel[AXES];
 	float steps[MOTORS];
 
@@ -1246,6 +1480,9 @@ static stat_t _exec_aline_segment(uint8_t correction_flag)
 		mr.gm.target[AXIS_B] = mr.endpoint[AXIS_B];
 		mr.gm.target[AXIS_C] = mr.endpoint[AXIS_C];
 
+	} else if (mr.arc_flag == true) {
+		_set_arc_segment_target(mr.segment_velocity * mr.segment_move_time);
+
 	} else {
 		float intermediate = mr.segment_velocity * mr.segment_move_time;
 		mr.gm.target[AXIS_X] = mr.position[AXIS_X] + (mr.unit[AXIS_X] * intermediate);
@@ -1276,6 +1513,7 @@ static stat_t _exec_aline_segment(uint8_t correction_flag)
 */
 	// prep the segment for the steppers and adjust the variables for the next iteration
 	ik_kinematics(travel, steps, mr.microseconds);
+	mr.move_segments++;
 	if (st_prep_line(steps, mr.microseconds) == STAT_OK) {
 		copy_axis_vector(mr.position, mr.gm.target); 	// update runtime position
 /* TRY THIS
@@ -1291,6 +1529,62 @@ static stat_t _exec_aline_segment(uint8_t correction_flag)
 	return (STAT_EAGAIN);								// this section still has more segments to run
 }
 
+/*
+ * _set_arc_segment_target() - put the next segment target of a native arc on the arc
+ *
+ *	The arc is parameterized by path length: the planar axes sit on the circle at
+ *	the angle reached after arc_travel of the arc's length, and the remaining axes
+ *	(helix, extruder) move in a straight line along mr.unit.
+ */
+static void _set_arc_segment_target(float segment_length)
+{
+	mr.arc_travel += segment_length;
+	float theta = mr.arc_theta + mr.arc_angular_travel * (mr.arc_travel / mr.length);
+
+	for (uint8_t i=0; i < AXES; i++) {
+		mr.gm.target[i] = mr.position[i] + (mr.unit[i] * segment_length);
+	}
+	mr.gm.target[mr.arc_axis_1] = mr.arc_center[0] + sin(theta) * mr.arc_radius;
+	mr.gm.target[mr.arc_axis_2] = mr.arc_center[1] + cos(theta) * mr.arc_radius;
+}
+
+/*
+ * _exec_aline_curve() - curve section runner helper
+ *
+ *	Runs one half of a head or tail (one jerk period) as a single step-exact curve
+ *	section instead of mr.segments constant-velocity segments. The section starts at
+ *	velocity v0 with acceleration a0 and runs for mr.segment_move_time at constant
+ *	jerk, so it covers v0*T + a0*T^2/2 + jerk*T^3/6. st_prep_curve() gets the same
+ *	polynomial and works out each step time from it.
+ *
+ *	Returns STAT_OK - a curve section is always the last segment of its half.
+ */
+static stat_t _exec_aline_curve(float v0, float a0, float jerk, uint8_t correction_flag)
+{
+	float travel[AXES];
+	float steps[MOTORS];
+	float T = mr.segment_move_time;
+
+	if ((correction_flag == true) &&
+		(cm.motion_state == MOTION_RUN) && (cm.cycle_state == CYCLE_MACHINING)) {
+		copy_axis_vector(mr.gm.target, mr.endpoint); // correct any accumulated rounding errors
+	} else {
+		float length = T * (v0 + T * (a0/2 + T * jerk/6));
+		for (uint8_t i=0; i < AXES; i++) {
+			mr.gm.target[i] = mr.position[i] + (mr.unit[i] * length);
+		}
+	}
+	for (uint8_t i=0; i < AXES; i++) {
+		travel[i] = mr.gm.target[i] - mr.position[i];
+	}
+	ik_kinematics(travel, steps, mr.microseconds);
+	mr.move_segments++;
+	if (st_prep_curve(steps, mr.microseconds, v0*T, a0*T*T, jerk*T*T*T) == STAT_OK) {
+		copy_axis_vector(mr.position, mr.gm.target); 	// update runtime position
+	}
+	return (STAT_OK);
+}
+
 
 /****** UNIT TESTS ******/
 
@@ -0,0 +1,208 @@
+/*
+ * FILE NAME: plan_merge.cpp - collinear move merging ahead of the planner
+ *
+ * Copyright (c) 2014 Robert K. Parker
+ *
+ * This file was part of the TinyG project
+ *
+ * Copyright (c) 2010 - 2013 Alden S. Hart, Jr.
+ *
+ * Now it is in crystalfontz3D
+ *
+ * This file ("the software") is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2 as published by the
+ * Free Software Foundation. You should have received a copy of the GNU General Public
+ * License, version 2 along with the software.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * THE SOFTWARE IS DISTRIBUTED IN THE HOPE THAT IT WILL BE USEFUL, BUT WITHOUT ANY
+ * WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT
+ * SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+/*
+ * PURPOSE: collinear move merging ahead of the planner.
+ *
+ * NOTES:	Merging sits between arc fitting (plan_fit.cpp) and mp_aline(). A held back
+ *	move is planned (flushed) before anything else reaches the planner: every
+ *	planner entry point and mp_set_planner_position() call mp_merge_flush() first,
+ *	and the controller flushes at the end of the G code file. The planner position
+ *	(mm.position) stays at the start of the held back move until it is flushed.
+ *
+ *
+ * CHANGE HISTORY:
+ *
+ *    Revision: Initial 1.0
+ *    User: R.K.Parker     Date: 05/29/14
+ *    First prototype.
+ *
+ */
+
+#include "tinyg2.h"
+#include "config.h"
+#include "canonical_machine.h"
+#include "plan_fit.h"
+#include "plan_merge.h"
+#include "planner.h"
+#include "util.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+// Allocate merge singleton structure
+
+mpMerge_t merge;
+
+static uint8_t _can_hold(const GCodeState_t *gm_line, const float xyz_length);
+static uint8_t _can_merge(const GCodeState_t *gm_line, const float xyz_length, const float unit[]);
+static float _get_xyz_length(const float a[], const float b[]);
+
+uint32_t mp_get_total_merged(void) { return (merge.total_merged);}
+
+/*
+ * mp_merge_aline() - canonical machine entry point for G0 and G1 moves
+ *
+ *	Folds the move into the held back move if it can, otherwise flushes that and
+ *	holds this one back in its place. Returns the status mp_aline() would have for
+ *	the move, so the model position is kept the same way; a move too short to plan
+ *	is refused here just as mp_aline() refuses it.
+ */
+stat_t mp_merge_aline(const GCodeState_t *gm_line)
+{
+	if (fp_ZERO(cm.merge_angle)) { return (mp_aline(gm_line));}
+
+	const float *start = (merge.pending) ? merge.gm.target : mm.position;
+	if (get_axis_vector_length(gm_line->target, start) < MIN_LENGTH_MOVE) {
+		return (STAT_MINIMUM_LENGTH_MOVE_ERROR);
+	}
+	float unit[3] = { 0,0,0 };
+	float xyz_length = _get_xyz_length(gm_line->target, start);
+	if (xyz_length > 0) {
+		for (uint8_t i=0; i<3; i++) { unit[i] = (gm_line->target[i] - start[i]) / xyz_length;}
+	}
+
+	if ((merge.pending) && (_can_merge(gm_line, xyz_length, unit))) {
+		for (uint8_t i=0; i<3; i++) { merge.vertex[merge.vertices][i] = merge.gm.target[i];}
+		merge.vertices++;
+		float move_time = merge.gm.move_time + gm_line->move_time;
+		float minimum_time = merge.gm.minimum_time + gm_line->minimum_time;
+		memcpy(&merge.gm, gm_line, sizeof(GCodeState_t));
+		merge.gm.move_time = move_time;
+		merge.gm.minimum_time = minimum_time;
+		merge.xyz_length = _get_xyz_length(merge.gm.target, mm.position);
+		for (uint8_t i=0; i<3; i++) { merge.unit[i] = unit[i];}
+		merge.total_merged++;
+		return (STAT_OK);
+	}
+
+	mp_merge_flush();
+	if (!_can_hold(gm_line, xyz_length)) { return (mp_aline(gm_line));}
+	memcpy(&merge.gm, gm_line, sizeof(GCodeState_t));
+	merge.xyz_length = xyz_length;
+	for (uint8_t i=0; i<3; i++) { merge.unit[i] = unit[i];}
+	merge.vertices = 0;
+	merge.pending = true;
+	return (STAT_OK);
+}
+
+/*
+ * mp_merge_flush() - plan the held back move, if there is one
+ * mp_merge_reset() - drop the held back move (planner flush)
+ *
+ *	Arc fitting comes before merging, so its chain is flushed first.
+ */
+void mp_merge_flush()
+{
+	mp_fit_flush();
+	if (!merge.pending) { return;}
+	merge.pending = false;					// first - mp_aline() flushes too
+	mp_aline(&merge.gm);
+}
+
+void mp_merge_reset()
+{
+	mp_fit_reset();
+	merge.pending = false;
+}
+
+/*
+ * mp_within_merge_tolerance() - TRUE if a is within MERGE_TOLERANCE ($mf) percent of b
+ *
+ *	The feed and extrusion rate match for merging, and for arc fitting (plan_fit.cpp).
+ */
+uint8_t mp_within_merge_tolerance(const float a, const float b)
+{
+	return (fabs(a - b) <= (fabs(b) * cm.merge_tolerance / 100 + EPSILON));
+}
+
+/*
+ * _can_hold() - TRUE if a move may be held back to merge the next ones into
+ */
+static uint8_t _can_hold(const GCodeState_t *gm_line, const float xyz_length)
+{
+	if ((gm_line->motion_mode != MOTION_MODE_STRAIGHT_TRAVERSE) &&
+		(gm_line->motion_mode != MOTION_MODE_STRAIGHT_FEED)) { return (false);}
+	if (gm_line->inverse_feed_rate_mode == true) { return (false);}	// time is per block
+	if (gm_line->path_control == PATH_EXACT_STOP) { return (false);}
+	return (xyz_length >= MIN_LENGTH_MOVE);								// not an A only move
+}
+
+/*
+ * _can_merge() - TRUE if a move can be folded into the held back move
+ *
+ *	unit is the XYZ direction of the move from the held back target. The merged
+ *	line runs from mm.position to the new target; the held back target and all
+ *	the corners folded in before must be within the chordal tolerance of it.
+ */
+static uint8_t _can_merge(const GCodeState_t *gm_line, const float xyz_length, const float unit[])
+{
+	if (!_can_hold(gm_line, xyz_length)) { return (false);}
+	if (merge.vertices >= MERGE_MAX_VERTICES) { return (false);}
+	if ((gm_line->motion_mode != merge.gm.motion_mode) ||
+		(gm_line->path_control != merge.gm.path_control) ||
+		(gm_line->spindle_speed != merge.gm.spindle_speed) ||
+		(memcmp(gm_line->work_offset, merge.gm.work_offset, sizeof(gm_line->work_offset)) != 0)) {
+		return (false);
+	}
+	if ((gm_line->motion_mode == MOTION_MODE_STRAIGHT_FEED) &&
+		(!mp_within_merge_tolerance(gm_line->feed_rate, merge.gm.feed_rate))) { return (false);}
+
+	// direction change from the last move folded in
+	float cos_angle = cos(cm.merge_angle / RADIAN);
+	if ((unit[0]*merge.unit[0] + unit[1]*merge.unit[1] + unit[2]*merge.unit[2]) < cos_angle) {
+		return (false);
+	}
+
+	// A, B and C travel per XYZ mm, so extrusion stays proportional along the merged line
+	for (uint8_t axis = AXIS_A; axis < AXES; axis++) {
+		float rate = (gm_line->target[axis] - merge.gm.target[axis]) / xyz_length;
+		float merged_rate = (merge.gm.target[axis] - mm.position[axis]) / merge.xyz_length;
+		if (!mp_within_merge_tolerance(rate, merged_rate)) { return (false);}
+	}
+
+	// corners to the merged line
+	float line[3];
+	float length = _get_xyz_length(gm_line->target, mm.position);
+	for (uint8_t i=0; i<3; i++) { line[i] = (gm_line->target[i] - mm.position[i]) / length;}
+	for (uint8_t v=0; v <= merge.vertices; v++) {
+		const float *corner = (v < merge.vertices) ? merge.vertex[v] : merge.gm.target;
+		float offset[3];
+		for (uint8_t i=0; i<3; i++) { offset[i] = corner[i] - mm.position[i];}
+		float along = offset[0]*line[0] + offset[1]*line[1] + offset[2]*line[2];
+		float distance = square(offset[0] - along*line[0]) + square(offset[1] - along*line[1]) +
+						 square(offset[2] - along*line[2]);
+		if (distance > square(cm.chordal_tolerance)) { return (false);}
+	}
+	return (true);
+}
+
+static float _get_xyz_length(const float a[], const float b[])
+{
+	return (sqrt(square(a[AXIS_X] - b[AXIS_X]) + square(a[AXIS_Y] - b[AXIS_Y]) + square(a[AXIS_Z] - b[AXIS_Z])));
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -70,8 +70,13 @@
 #include "config.h"
 #include "canonical_machine.h"
 #include "plan_arc.h"
+#include "plan_fit.h"
 #include "plan_line.h"
+#include "plan_merge.h"
 #include "planner.h"
+#include "plan_diag.h"
+#include "verify.h"
+#include "profile.h"
 #include "stepper.h"
 #include "report.h"
 #include "util.h"
@@ -111,6 +116,8 @@ void planner_init()
 // If you can can assume all memory has been zeroed by a hard reset you don;t need these next 2 lines
 	memset(&mr, 0, sizeof(mr));	// clear all values, pointers and status
 	memset(&mm, 0, sizeof(mm));	// clear all values, pointers and status
+	memset(&merge, 0, sizeof(merge));
+	memset(&fit, 0, sizeof(fit));
 
 	mr.magic_start = MAGICNUM;
 	mr.magic_end = MAGICNUM;
@@ -141,6 +148,7 @@ stat_t mp_assertions()
 void mp_flush_planner()
 {
 	cm_abort_arc();
+	mp_merge_reset();
 	mp_init_buffers();
 	cm_set_motion_state(MOTION_STOP);
 }
@@ -164,6 +172,7 @@ void mp_flush_planner()
 
 void mp_set_planner_position(uint8_t axis, const float position)
 {
+	mp_merge_flush();							// the held back move starts at the old position
 	mm.position[axis] = position;
 }
 
@@ -181,8 +190,10 @@ void mp_set_runtime_position(uint8_t axis, const float position)
 
 stat_t mp_exec_move()
 {
+	PROF_SCOPE(PROF_EXEC_MOVE);
 	mpBuf_t *bf;
 
+	if (vf.pending) { vf_mark();}				// the block before is all loaded now
 	if ((bf = mp_get_run_buffer()) == NULL) return (STAT_NOOP);	// NULL means nothing's running
 
 	// Manage cycle and motion state transitions
@@ -217,6 +228,7 @@ void mp_queue_command(void(*cm_exec)(float[], float[]), float *value, float *fla
 {
 	mpBuf_t *bf;
 
+	mp_merge_flush();					// commands run after the moves before them
 	// this error is not reported as buffer availability was checked upstream in the controller
 	if ((bf = mp_get_write_buffer()) == NULL) return;
 
@@ -233,6 +245,7 @@ void mp_queue_command(void(*cm_exec)(float[], float[]), float *value, float *fla
 
 static stat_t _exec_command(mpBuf_t *bf)
 {
+	if (diag.enabled) { mp_diag_hold();}
 	bf->cm_func(bf->value_vector, bf->flag_vector);	// 2 vectors used by callbacks
 	st_prep_null();									// Must call a null prep to keep the loader happy.
 	mp_free_run_buffer();
@@ -250,6 +263,7 @@ stat_t mp_dwell(float seconds)
 {
 	mpBuf_t *bf;
 
+	mp_merge_flush();
 	if ((bf = mp_get_write_buffer()) == NULL) {	// get write buffer or fail
 		return (STAT_BUFFER_FULL_FATAL);		// (not ever supposed to fail)
 	}
@@ -262,6 +276,7 @@ stat_t mp_dwell(float seconds)
 
 static stat_t _exec_dwell(mpBuf_t *bf)
 {
+	if (diag.enabled) { mp_diag_hold();}
 	st_prep_dwell((uint32_t)(bf->gm.move_time * 1000000));// convert seconds to uSec
 	mp_free_run_buffer();
 	return (STAT_OK);
@@ -289,6 +304,8 @@ static stat_t _exec_dwell(mpBuf_t *bf)
  *	(test, get and unget have no effect)
  *
  * mp_get_planner_buffers_available()   Returns # of available planner buffers
+ * mp_get_planner_buffers_in_use()	Returns # of buffers not empty, counted - for reports,
+ *							as buffers_available can drift above the pool size
  *
  * mp_init_buffers()		Initializes or resets buffers
  *
@@ -318,6 +335,15 @@ static stat_t _exec_dwell(mpBuf_t *bf)
 
 uint8_t mp_get_planner_buffers_available(void) { return (mb.buffers_available);}
 
+uint8_t mp_get_planner_buffers_in_use(void)
+{
+	uint8_t count = 0;
+	for (uint8_t i=0; i < PLANNER_BUFFER_POOL_SIZE; i++) {
+		if (mb.bf[i].buffer_state != MP_BUFFER_EMPTY) count++;
+	}
+	return (count);
+}
+
 void mp_init_buffers(void)
 {
 	mpBuf_t *pv;
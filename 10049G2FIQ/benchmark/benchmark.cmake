@@ -0,0 +1,207 @@
+#
+# FILE NAME: benchmark.cmake - G code corpus benchmark, golden output and verification
+#
+# Copyright (c) 2014 Robert K. Parker
+#
+# Now it is in crystalfontz3D
+#
+# This file ("the software") is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License, version 2 as published by the
+# Free Software Foundation. You should have received a copy of the GNU General Public
+# License, version 2 along with the software.  If not, see <http://www.gnu.org/licenses/>.
+#
+# Run by the benchmark and benchmark_golden targets (CMakeLists.txt):
+#
+#   cmake -DCONVERTER=<10049G2> -DSOURCE=<this directory> -DWORK=<scratch directory>
+#         -DHISTORY=<csv file> -DRUNS=<n> [-DUPDATE=ON] -P benchmark.cmake
+#
+# Each corpus/*.gcode is converted RUNS times from the default settings (a new config
+# file each run), verifying the output (-V, verify.h) into a job metrics file (-j,
+# metrics.h). The fastest run's lines, segments and FIQ cells per second of wall time,
+# the converter's peak RSS and the verifier's results are printed and appended to
+# HISTORY, one line per file, with the date and the git commit. Once every file has
+# been run the benchmark fails if any of them:
+#
+#   - has an output MD5 other than its hash in golden.md5, or no hash
+#   - has a block off by more than a step (VF_TOLERANCE) when verified
+#
+# The golden hashes pin the output as it is, so a change to it is never missed - they
+# don't say it is right. The verifier does.
+#
+# With UPDATE the hashes are written to golden.md5 instead - a file that doesn't
+# verify still fails. Only do that for a change that is meant to change the output,
+# and say so in its commit. The hashes are of the host build
+# - a cross build (codesourcery_toolchain.cmake) must be run on the board, and may
+# round differently.
+#
+
+foreach(var CONVERTER SOURCE WORK HISTORY RUNS)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "benchmark.cmake: ${var} is not set")
+    endif()
+endforeach()
+
+# rate() - count per second of wall time in ms, without overflowing 32 bit math
+function(rate out count ms)
+    math(EXPR whole "${count} / ${ms}")
+    math(EXPR part "(${count} % ${ms}) * 1000 / ${ms}")
+    math(EXPR result "${whole} * 1000 + ${part}")
+    set(${out} ${result} PARENT_SCOPE)
+endfunction()
+
+# field() - an integer field of the metrics file
+function(field out json name)
+    string(REGEX MATCH "\"${name}\": [{ \"a-z:]*([0-9]+)" match "${json}")
+    set(${out} ${CMAKE_MATCH_1} PARENT_SCOPE)
+endfunction()
+
+# milli() - thousandths of a value printed with 3 decimals
+function(milli out value)
+    string(REGEX MATCH "^([0-9]+)\\.([0-9][0-9][0-9])$" match "${value}")
+    math(EXPR result "${CMAKE_MATCH_1} * 1000 + 1${CMAKE_MATCH_2} - 1000")
+    set(${out} ${result} PARENT_SCOPE)
+endfunction()
+
+# worst_miss() - the largest of the metrics file's verify_max_steps
+function(worst_miss out json)
+    string(REGEX MATCH "\"verify_max_steps\": {[^}]*}" misses "${json}")
+    string(REGEX MATCHALL "[0-9]+\\.[0-9][0-9][0-9]" misses "${misses}")
+    set(worst "0.000")
+    set(worst_milli 0)
+    foreach(miss ${misses})
+        milli(miss_milli ${miss})
+        if(miss_milli GREATER worst_milli)
+            set(worst ${miss})
+            set(worst_milli ${miss_milli})
+        endif()
+    endforeach()
+    set(${out} ${worst} PARENT_SCOPE)
+endfunction()
+
+file(MAKE_DIRECTORY ${WORK})
+file(WRITE ${WORK}/exit.txt "&\n")          # the converter prompts at the end of the file
+file(GLOB corpus RELATIVE ${SOURCE}/corpus ${SOURCE}/corpus/*.gcode)
+list(SORT corpus)
+
+set(golden_file ${SOURCE}/golden.md5)
+set(golden "")
+if(EXISTS ${golden_file})
+    file(READ ${golden_file} golden)
+endif()
+
+execute_process(COMMAND git rev-parse --short HEAD WORKING_DIRECTORY ${SOURCE}
+                OUTPUT_VARIABLE commit OUTPUT_STRIP_TRAILING_WHITESPACE ERROR_QUIET)
+if(commit STREQUAL "")
+    set(commit "-")
+endif()
+string(TIMESTAMP date "%Y-%m-%d %H:%M:%S")
+set(columns "date,commit,file,lines,segments,cells,wall_ms,lines_per_s,segments_per_s,cells_per_s,peak_rss_kb,verified_blocks,verify_off_blocks,verify_max_steps,md5,golden,verified")
+if(EXISTS ${HISTORY})
+    file(STRINGS ${HISTORY} first LIMIT_COUNT 1)
+    if(NOT first STREQUAL columns)
+        file(RENAME ${HISTORY} ${HISTORY}.old)
+        message("${HISTORY} has other columns - moved to ${HISTORY}.old")
+    endif()
+endif()
+if(NOT EXISTS ${HISTORY})
+    file(WRITE ${HISTORY} "${columns}\n")
+endif()
+
+message("file                     lines/s  segments/s     cells/s  peak RSS  output   blocks off  worst miss  verified")
+set(new_golden "")
+set(failed "")
+foreach(gcode ${corpus})
+    string(REGEX REPLACE "\\.gcode$" "" name ${gcode})
+    set(best_ms 0)
+    foreach(run RANGE 1 ${RUNS})
+        file(REMOVE ${WORK}/benchmark.cfg ${WORK}/${name}.json)
+        execute_process(COMMAND ${CONVERTER} -g ${SOURCE}/corpus/${gcode} -f ${WORK}/${name}.fiq
+                                -c ${WORK}/benchmark.cfg -j ${WORK}/${name}.json -V
+                        INPUT_FILE ${WORK}/exit.txt OUTPUT_FILE ${WORK}/${name}.log ERROR_FILE ${WORK}/${name}.log
+                        RESULT_VARIABLE result)
+        if(NOT EXISTS ${WORK}/${name}.json)
+            message(FATAL_ERROR "${gcode} failed to convert - see ${WORK}/${name}.log")
+        endif()
+        file(READ ${WORK}/${name}.json json)
+        if(NOT json MATCHES "\"status\": \"(ok|drift)\"")
+            message(FATAL_ERROR "${gcode} output was not written - see ${WORK}/${name}.json")
+        endif()
+        if((NOT result EQUAL 0) AND (NOT json MATCHES "\"status\": \"drift\""))
+            message(FATAL_ERROR "${gcode} failed to convert - see ${WORK}/${name}.log")
+        endif()
+        string(REGEX MATCH "\"wall_s\": ([0-9]+)\\.([0-9]+)" match "${json}")
+        math(EXPR ms "${CMAKE_MATCH_1} * 1000 + 1${CMAKE_MATCH_2} - 1000")
+        if(ms EQUAL 0)
+            set(ms 1)
+        endif()
+        if(best_ms EQUAL 0 OR ms LESS best_ms)
+            set(best_ms ${ms})
+            set(best_json "${json}")
+        endif()
+    endforeach()
+
+    field(lines "${best_json}" lines)
+    field(segments "${best_json}" segments)
+    field(cells "${best_json}" cells)
+    field(rss "${best_json}" peak_rss_kb)
+    field(verified "${best_json}" verified_blocks)
+    field(off "${best_json}" verify_off_blocks)
+    worst_miss(worst "${best_json}")
+    if(verified STREQUAL "")
+        message(FATAL_ERROR "${gcode} output was not verified - see ${WORK}/${name}.json")
+    endif()
+    rate(lines_rate ${lines} ${best_ms})
+    rate(segments_rate ${segments} ${best_ms})
+    rate(cells_rate ${cells} ${best_ms})
+    math(EXPR rss_mb "${rss} / 1024")
+
+    file(MD5 ${WORK}/${name}.fiq md5)
+    set(new_golden "${new_golden}${md5}  ${gcode}\n")
+    if(UPDATE)
+        set(check "hashed")
+    elseif(golden MATCHES "${md5}  ${gcode}\n")
+        set(check "ok")
+    elseif(golden MATCHES "  ${gcode}\n")
+        set(check "DIFFERS")
+        list(APPEND failed ${gcode})
+    else()
+        set(check "NO GOLDEN HASH")
+        list(APPEND failed ${gcode})
+    endif()
+
+    if(off EQUAL 0)
+        set(verify_check "ok")
+    else()
+        set(verify_check "DRIFTS")
+        list(APPEND failed ${gcode})
+    endif()
+
+    set(row "${gcode}                    ")
+    string(SUBSTRING "${row}" 0 20 row)
+    foreach(value ${lines_rate} ${segments_rate} ${cells_rate})
+        set(column "            ${value}")
+        string(LENGTH "${column}" length)
+        math(EXPR start "${length} - 12")
+        string(SUBSTRING "${column}" ${start} 12 column)
+        set(row "${row}${column}")
+    endforeach()
+    set(off_column "            ${off}/${verified}")
+    string(LENGTH "${off_column}" length)
+    math(EXPR start "${length} - 12")
+    string(SUBSTRING "${off_column}" ${start} 12 off_column)
+    set(worst_column "            ${worst}")
+    string(LENGTH "${worst_column}" length)
+    math(EXPR start "${length} - 12")
+    string(SUBSTRING "${worst_column}" ${start} 12 worst_column)
+    message("${row}   ${rss_mb} MB  ${check}${off_column}${worst_column}  ${verify_check}")
+    file(APPEND ${HISTORY} "${date},${commit},${gcode},${lines},${segments},${cells},${best_ms},${lines_rate},${segments_rate},${cells_rate},${rss},${verified},${off},${worst},${md5},${check},${verify_check}\n")
+endforeach()
+
+if(UPDATE)
+    file(WRITE ${golden_file} "${new_golden}")
+    message("Golden hashes written to ${golden_file}")
+endif()
+if(failed)
+    message(FATAL_ERROR "Output differs from the golden hashes, or drifts off its targets: ${failed}\nThe outputs are in ${WORK}")
+endif()
+message("History appended to ${HISTORY}")
@@ -0,0 +1,240 @@
+; arcs - G2/G3 with I J and R, full circles and helices
+G21
+G90
+G92 A0
+G0 Z0.3
+G0 X60 Y100
+G1 F3000
+G0 X95.000 Y100
+G2 X95.000 Y100 I5.000 J0 A1.0367
+G0 X94.500 Y100
+G3 X94.500 Y100 I5.500 J0 A2.1771
+G0 X94.000 Y100
+G2 X94.000 Y100 I6.000 J0 A3.4212
+G0 X93.500 Y100
+G3 X93.500 Y100 I6.500 J0 A4.7689
+G0 X93.000 Y100
+G2 X93.000 Y100 I7.000 J0 A6.2204
+G0 X92.500 Y100
+G3 X92.500 Y100 I7.500 J0 A7.7754
+G0 X92.000 Y100
+G2 X92.000 Y100 I8.000 J0 A9.4342
+G0 X91.500 Y100
+G3 X91.500 Y100 I8.500 J0 A11.1966
+G0 X91.000 Y100
+G2 X91.000 Y100 I9.000 J0 A13.0627
+G0 X90.500 Y100
+G3 X90.500 Y100 I9.500 J0 A15.0325
+G0 X90.000 Y100
+G2 X90.000 Y100 I10.000 J0 A17.1060
+G0 X89.500 Y100
+G3 X89.500 Y100 I10.500 J0 A19.2831
+G0 X89.000 Y100
+G2 X89.000 Y100 I11.000 J0 A21.5639
+G0 X88.500 Y100
+G3 X88.500 Y100 I11.500 J0 A23.9484
+G0 X88.000 Y100
+G2 X88.000 Y100 I12.000 J0 A26.4365
+G0 X87.500 Y100
+G3 X87.500 Y100 I12.500 J0 A29.0283
+G0 X87.000 Y100
+G2 X87.000 Y100 I13.000 J0 A31.7238
+G0 X86.500 Y100
+G3 X86.500 Y100 I13.500 J0 A34.5230
+G0 X86.000 Y100
+G2 X86.000 Y100 I14.000 J0 A37.4258
+G0 X85.500 Y100
+G3 X85.500 Y100 I14.500 J0 A40.4323
+G0 X85.000 Y100
+G2 X85.000 Y100 I15.000 J0 A43.5425
+G0 X84.500 Y100
+G3 X84.500 Y100 I15.500 J0 A46.7563
+G0 X84.000 Y100
+G2 X84.000 Y100 I16.000 J0 A50.0738
+G0 X83.500 Y100
+G3 X83.500 Y100 I16.500 J0 A53.4950
+G0 X83.000 Y100
+G2 X83.000 Y100 I17.000 J0 A57.0199
+G0 X82.500 Y100
+G3 X82.500 Y100 I17.500 J0 A60.6484
+G0 X82.000 Y100
+G2 X82.000 Y100 I18.000 J0 A64.3807
+G0 X81.500 Y100
+G3 X81.500 Y100 I18.500 J0 A68.2165
+G0 X81.000 Y100
+G2 X81.000 Y100 I19.000 J0 A72.1561
+G0 X80.500 Y100
+G3 X80.500 Y100 I19.500 J0 A76.1993
+G0 X80.000 Y100
+G2 X80.000 Y100 I20.000 J0 A80.3462
+G0 X79.500 Y100
+G3 X79.500 Y100 I20.500 J0 A84.5968
+G0 X79.000 Y100
+G2 X79.000 Y100 I21.000 J0 A88.9511
+G0 X78.500 Y100
+G3 X78.500 Y100 I21.500 J0 A93.4090
+G0 X78.000 Y100
+G2 X78.000 Y100 I22.000 J0 A97.9706
+G0 X77.500 Y100
+G3 X77.500 Y100 I22.500 J0 A102.6358
+G0 X77.000 Y100
+G2 X77.000 Y100 I23.000 J0 A107.4048
+G0 X76.500 Y100
+G3 X76.500 Y100 I23.500 J0 A112.2774
+G0 X76.000 Y100
+G2 X76.000 Y100 I24.000 J0 A117.2537
+G0 X75.500 Y100
+G3 X75.500 Y100 I24.500 J0 A122.3336
+G1 X40 Y40.000 A123.3703
+G2 X40 Y60.000 R10.000 A123.3703
+G1 X40 Y62.000 A124.5107
+G2 X40 Y40.000 R11.000 A124.5107
+G1 X40 Y40.000 A125.7548
+G3 X40 Y64.000 R12.000 A125.7548
+G1 X40 Y66.000 A127.1026
+G3 X40 Y40.000 R13.000 A127.1026
+G1 X40 Y40.000 A128.5540
+G2 X40 Y68.000 R14.000 A128.5540
+G1 X40 Y70.000 A130.1091
+G2 X40 Y40.000 R15.000 A130.1091
+G1 X40 Y40.000 A131.7678
+G3 X40 Y72.000 R16.000 A131.7678
+G1 X40 Y60.000 A132.8045
+G3 X40 Y40.000 R10.000 A132.8045
+G1 X40 Y40.000 A133.9449
+G2 X40 Y62.000 R11.000 A133.9449
+G1 X40 Y64.000 A135.1890
+G2 X40 Y40.000 R12.000 A135.1890
+G1 X40 Y40.000 A136.5368
+G3 X40 Y66.000 R13.000 A136.5368
+G1 X40 Y68.000 A137.9882
+G3 X40 Y40.000 R14.000 A137.9882
+G1 X40 Y40.000 A139.5433
+G2 X40 Y70.000 R15.000 A139.5433
+G1 X40 Y72.000 A141.2020
+G2 X40 Y40.000 R16.000 A141.2020
+G1 X40 Y40.000 A142.2387
+G3 X40 Y60.000 R10.000 A142.2387
+G1 X40 Y62.000 A143.3791
+G3 X40 Y40.000 R11.000 A143.3791
+G1 X40 Y40.000 A144.6232
+G2 X40 Y64.000 R12.000 A144.6232
+G1 X40 Y66.000 A145.9710
+G2 X40 Y40.000 R13.000 A145.9710
+G1 X40 Y40.000 A147.4224
+G3 X40 Y68.000 R14.000 A147.4224
+G1 X40 Y70.000 A148.9775
+G3 X40 Y40.000 R15.000 A148.9775
+G1 X40 Y40.000 A150.6362
+G2 X40 Y72.000 R16.000 A150.6362
+G1 X40 Y60.000 A151.6730
+G2 X40 Y40.000 R10.000 A151.6730
+G1 X40 Y40.000 A152.8133
+G3 X40 Y62.000 R11.000 A152.8133
+G1 X40 Y64.000 A154.0574
+G3 X40 Y40.000 R12.000 A154.0574
+G1 X40 Y40.000 A155.4052
+G2 X40 Y66.000 R13.000 A155.4052
+G1 X40 Y68.000 A156.8566
+G2 X40 Y40.000 R14.000 A156.8566
+G1 X40 Y40.000 A158.4117
+G3 X40 Y70.000 R15.000 A158.4117
+G1 X40 Y72.000 A160.0704
+G3 X40 Y40.000 R16.000 A160.0704
+G1 X40 Y40.000 A161.1072
+G2 X40 Y60.000 R10.000 A161.1072
+G1 X40 Y62.000 A162.2476
+G2 X40 Y40.000 R11.000 A162.2476
+G1 X40 Y40.000 A163.4916
+G3 X40 Y64.000 R12.000 A163.4916
+G1 X40 Y66.000 A164.8394
+G3 X40 Y40.000 R13.000 A164.8394
+G1 X40 Y40.000 A166.2908
+G2 X40 Y68.000 R14.000 A166.2908
+G1 X40 Y70.000 A167.8459
+G2 X40 Y40.000 R15.000 A167.8459
+G1 X40 Y40.000 A169.5046
+G3 X40 Y72.000 R16.000 A169.5046
+G1 X40 Y60.000 A170.5414
+G3 X40 Y40.000 R10.000 A170.5414
+G1 X40 Y40.000 A171.6818
+G2 X40 Y62.000 R11.000 A171.6818
+G1 X40 Y64.000 A172.9258
+G2 X40 Y40.000 R12.000 A172.9258
+G1 X40 Y40.000 A174.2736
+G3 X40 Y66.000 R13.000 A174.2736
+G1 X40 Y68.000 A175.7250
+G3 X40 Y40.000 R14.000 A175.7250
+G1 X40 Y40.000 A177.2801
+G2 X40 Y70.000 R15.000 A177.2801
+G1 X40 Y72.000 A178.9388
+G2 X40 Y40.000 R16.000 A178.9388
+G1 X40 Y40.000 A179.9756
+G3 X40 Y60.000 R10.000 A179.9756
+G1 X40 Y62.000 A181.1160
+G3 X40 Y40.000 R11.000 A181.1160
+G1 X40 Y40.000 A182.3600
+G2 X40 Y64.000 R12.000 A182.3600
+G1 X40 Y66.000 A183.7078
+G2 X40 Y40.000 R13.000 A183.7078
+G1 X40 Y40.000 A185.1592
+G3 X40 Y68.000 R14.000 A185.1592
+G1 X40 Y70.000 A186.7143
+G3 X40 Y40.000 R15.000 A186.7143
+G1 X40 Y40.000 A188.3730
+G2 X40 Y72.000 R16.000 A188.3730
+G1 X40 Y60.000 A189.4098
+G2 X40 Y40.000 R10.000 A189.4098
+G1 X40 Y40.000 A190.5502
+G3 X40 Y62.000 R11.000 A190.5502
+G1 X40 Y64.000 A191.7942
+G3 X40 Y40.000 R12.000 A191.7942
+G1 X40 Y40.000 A193.1420
+G2 X40 Y66.000 R13.000 A193.1420
+G1 X40 Y68.000 A194.5934
+G2 X40 Y40.000 R14.000 A194.5934
+G1 X40 Y40.000 A196.1485
+G3 X40 Y70.000 R15.000 A196.1485
+G1 X40 Y72.000 A197.8072
+G3 X40 Y40.000 R16.000 A197.8072
+G1 X40 Y40.000 A198.8440
+G2 X40 Y60.000 R10.000 A198.8440
+G1 X40 Y62.000 A199.9844
+G2 X40 Y40.000 R11.000 A199.9844
+G1 X40 Y40.000 A201.2284
+G3 X40 Y64.000 R12.000 A201.2284
+G1 X40 Y66.000 A202.5762
+G3 X40 Y40.000 R13.000 A202.5762
+G0 X150 Y150
+G2 X150 Y150 Z0.40 I15 J0 A205.6864
+G2 X150 Y150 Z0.50 I15 J0 A208.7965
+G2 X150 Y150 Z0.60 I15 J0 A211.9067
+G2 X150 Y150 Z0.70 I15 J0 A215.0169
+G2 X150 Y150 Z0.80 I15 J0 A218.1271
+G2 X150 Y150 Z0.90 I15 J0 A221.2372
+G2 X150 Y150 Z1.00 I15 J0 A224.3474
+G2 X150 Y150 Z1.10 I15 J0 A227.4576
+G2 X150 Y150 Z1.20 I15 J0 A230.5678
+G2 X150 Y150 Z1.30 I15 J0 A233.6779
+G2 X150 Y150 Z1.40 I15 J0 A236.7881
+G2 X150 Y150 Z1.50 I15 J0 A239.8983
+G2 X150 Y150 Z1.60 I15 J0 A243.0085
+G2 X150 Y150 Z1.70 I15 J0 A246.1187
+G2 X150 Y150 Z1.80 I15 J0 A249.2288
+G2 X150 Y150 Z1.90 I15 J0 A252.3390
+G2 X150 Y150 Z2.00 I15 J0 A255.4492
+G2 X150 Y150 Z2.10 I15 J0 A258.5594
+G2 X150 Y150 Z2.20 I15 J0 A261.6695
+G2 X150 Y150 Z2.30 I15 J0 A264.7797
+G2 X150 Y150 Z2.40 I15 J0 A267.8899
+G2 X150 Y150 Z2.50 I15 J0 A271.0001
+G2 X150 Y150 Z2.60 I15 J0 A274.1102
+G2 X150 Y150 Z2.70 I15 J0 A277.2204
+G2 X150 Y150 Z2.80 I15 J0 A280.3306
+G2 X150 Y150 Z2.90 I15 J0 A283.4408
+G2 X150 Y150 Z3.00 I15 J0 A286.5509
+G2 X150 Y150 Z3.10 I15 J0 A289.6611
+G2 X150 Y150 Z3.20 I15 J0 A292.7713
+G2 X150 Y150 Z3.30 I15 J0 A295.8815
+G0 X0 Y0
+M2
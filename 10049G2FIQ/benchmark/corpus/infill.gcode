@@ -0,0 +1,4486 @@
+; infill - 45 degree rectilinear fill, 10 layers
+G21
+G90
+G92 A0
+G0 Z0.30
+G1 A-1.0000 F2400
+G0 X75.000 Y75.450
+G1 A0.0000 F2400
+G1 F4800
+G1 X75.450 Y75.000 A0.0210
+G1 X75.900 Y75.000 A0.0359
+G1 X75.000 Y75.900 A0.0779
+G1 X75.000 Y76.350 A0.0927
+G1 X76.350 Y75.000 A0.1557
+G1 X76.800 Y75.000 A0.1706
+G1 X75.000 Y76.800 A0.2546
+G1 X75.000 Y77.250 A0.2694
+G1 X77.250 Y75.000 A0.3744
+G1 X77.700 Y75.000 A0.3893
+G1 X75.000 Y77.700 A0.5153
+G1 X75.000 Y78.150 A0.5301
+G1 X78.150 Y75.000 A0.6771
+G1 X78.600 Y75.000 A0.6920
+G1 X75.000 Y78.600 A0.8600
+G1 X75.000 Y79.050 A0.8748
+G1 X79.050 Y75.000 A1.0638
+G1 X79.500 Y75.000 A1.0787
+G1 X75.000 Y79.500 A1.2887
+G1 X75.000 Y79.950 A1.3036
+G1 X79.950 Y75.000 A1.5346
+G1 X80.400 Y75.000 A1.5494
+G1 X75.000 Y80.400 A1.8014
+G1 X75.000 Y80.850 A1.8163
+G1 X80.850 Y75.000 A2.0893
+G1 X81.300 Y75.000 A2.1041
+G1 X75.000 Y81.300 A2.3982
+G1 X75.000 Y81.750 A2.4130
+G1 X81.750 Y75.000 A2.7280
+G1 X82.200 Y75.000 A2.7429
+G1 X75.000 Y82.200 A3.0789
+G1 X75.000 Y82.650 A3.0937
+G1 X82.650 Y75.000 A3.4508
+G1 X83.100 Y75.000 A3.4656
+G1 X75.000 Y83.100 A3.8436
+G1 X75.000 Y83.550 A3.8585
+G1 X83.550 Y75.000 A4.2575
+G1 X84.000 Y75.000 A4.2724
+G1 X75.000 Y84.000 A4.6924
+G1 X75.000 Y84.450 A4.7072
+G1 X84.450 Y75.000 A5.1482
+G1 X84.900 Y75.000 A5.1631
+G1 X75.000 Y84.900 A5.6251
+G1 X75.000 Y85.350 A5.6400
+G1 X85.350 Y75.000 A6.1230
+G1 X85.800 Y75.000 A6.1378
+G1 X75.000 Y85.800 A6.6419
+G1 X75.000 Y86.250 A6.6567
+G1 X86.250 Y75.000 A7.1817
+G1 X86.700 Y75.000 A7.1966
+G1 X75.000 Y86.700 A7.7426
+G1 X75.000 Y87.150 A7.7575
+G1 X87.150 Y75.000 A8.3245
+G1 X87.600 Y75.000 A8.3394
+G1 X75.000 Y87.600 A8.9274
+G1 X75.000 Y88.050 A8.9422
+G1 X88.050 Y75.000 A9.5513
+G1 X88.500 Y75.000 A9.5661
+G1 X75.000 Y88.500 A10.1961
+G1 X75.000 Y88.950 A10.2110
+G1 X88.950 Y75.000 A10.8620
+G1 X89.400 Y75.000 A10.8769
+G1 X75.000 Y89.400 A11.5489
+G1 X75.000 Y89.850 A11.5638
+G1 X89.850 Y75.000 A12.2568
+G1 X90.300 Y75.000 A12.2717
+G1 X75.000 Y90.300 A12.9857
+G1 X75.000 Y90.750 A13.0005
+G1 X90.750 Y75.000 A13.7356
+G1 X91.200 Y75.000 A13.7504
+G1 X75.000 Y91.200 A14.5065
+G1 X75.000 Y91.650 A14.5213
+G1 X91.650 Y75.000 A15.2984
+G1 X92.100 Y75.000 A15.3132
+G1 X75.000 Y92.100 A16.1112
+G1 X75.000 Y92.550 A16.1261
+G1 X92.550 Y75.000 A16.9451
+G1 X93.000 Y75.000 A16.9600
+G1 X75.000 Y93.000 A17.8000
+G1 X75.000 Y93.450 A17.8149
+G1 X93.450 Y75.000 A18.6759
+G1 X93.900 Y75.000 A18.6908
+G1 X75.000 Y93.900 A19.5728
+G1 X75.000 Y94.350 A19.5877
+G1 X94.350 Y75.000 A20.4907
+G1 X94.800 Y75.000 A20.5056
+G1 X75.000 Y94.800 A21.4296
+G1 X75.000 Y95.250 A21.4445
+G1 X95.250 Y75.000 A22.3895
+G1 X95.700 Y75.000 A22.4044
+G1 X75.000 Y95.700 A23.3704
+G1 X75.000 Y96.150 A23.3853
+G1 X96.150 Y75.000 A24.3723
+G1 X96.600 Y75.000 A24.3872
+G1 X75.000 Y96.600 A25.3952
+G1 X75.000 Y97.050 A25.4101
+G1 X97.050 Y75.000 A26.4391
+G1 X97.500 Y75.000 A26.4540
+G1 X75.000 Y97.500 A27.5040
+G1 X75.000 Y97.950 A27.5189
+G1 X97.950 Y75.000 A28.5899
+G1 X98.400 Y75.000 A28.6048
+G1 X75.000 Y98.400 A29.6968
+G1 X75.000 Y98.850 A29.7117
+G1 X98.850 Y75.000 A30.8247
+G1 X99.300 Y75.000 A30.8396
+G1 X75.000 Y99.300 A31.9736
+G1 X75.000 Y99.750 A31.9885
+G1 X99.750 Y75.000 A33.1435
+G1 X100.200 Y75.000 A33.1584
+G1 X75.000 Y100.200 A34.3345
+G1 X75.000 Y100.650 A34.3493
+G1 X100.650 Y75.000 A35.5464
+G1 X101.100 Y75.000 A35.5612
+G1 X75.000 Y101.100 A36.7793
+G1 X75.000 Y101.550 A36.7941
+G1 X101.550 Y75.000 A38.0332
+G1 X102.000 Y75.000 A38.0480
+G1 X75.000 Y102.000 A39.3081
+G1 X75.000 Y102.450 A39.3230
+G1 X102.450 Y75.000 A40.6040
+G1 X102.900 Y75.000 A40.6189
+G1 X75.000 Y102.900 A41.9209
+G1 X75.000 Y103.350 A41.9358
+G1 X103.350 Y75.000 A43.2589
+G1 X103.800 Y75.000 A43.2737
+G1 X75.000 Y103.800 A44.6178
+G1 X75.000 Y104.250 A44.6326
+G1 X104.250 Y75.000 A45.9977
+G1 X104.700 Y75.000 A46.0125
+G1 X75.000 Y104.700 A47.3986
+G1 X75.000 Y105.150 A47.4135
+G1 X105.150 Y75.000 A48.8205
+G1 X105.600 Y75.000 A48.8354
+G1 X75.000 Y105.600 A50.2635
+G1 X75.000 Y106.050 A50.2783
+G1 X106.050 Y75.000 A51.7274
+G1 X106.500 Y75.000 A51.7422
+G1 X75.000 Y106.500 A53.2123
+G1 X75.000 Y106.950 A53.2272
+G1 X106.950 Y75.000 A54.7182
+G1 X107.400 Y75.000 A54.7331
+G1 X75.000 Y107.400 A56.2452
+G1 X75.000 Y107.850 A56.2600
+G1 X107.850 Y75.000 A57.7931
+G1 X108.300 Y75.000 A57.8079
+G1 X75.000 Y108.300 A59.3620
+G1 X75.000 Y108.750 A59.3769
+G1 X108.750 Y75.000 A60.9520
+G1 X109.200 Y75.000 A60.9668
+G1 X75.000 Y109.200 A62.5629
+G1 X75.000 Y109.650 A62.5777
+G1 X109.650 Y75.000 A64.1948
+G1 X110.100 Y75.000 A64.2097
+G1 X75.000 Y110.100 A65.8478
+G1 X75.000 Y110.550 A65.8626
+G1 X110.550 Y75.000 A67.5217
+G1 X111.000 Y75.000 A67.5365
+G1 X75.000 Y111.000 A69.2166
+G1 X75.000 Y111.450 A69.2315
+G1 X111.450 Y75.000 A70.9326
+G1 X111.900 Y75.000 A70.9474
+G1 X75.000 Y111.900 A72.6695
+G1 X75.000 Y112.350 A72.6843
+G1 X112.350 Y75.000 A74.4274
+G1 X112.800 Y75.000 A74.4423
+G1 X75.000 Y112.800 A76.2064
+G1 X75.000 Y113.250 A76.2212
+G1 X113.250 Y75.000 A78.0063
+G1 X113.700 Y75.000 A78.0212
+G1 X75.000 Y113.700 A79.8273
+G1 X75.000 Y114.150 A79.8421
+G1 X114.150 Y75.000 A81.6692
+G1 X114.600 Y75.000 A81.6841
+G1 X75.000 Y114.600 A83.5321
+G1 X75.000 Y115.050 A83.5470
+G1 X115.050 Y75.000 A85.4161
+G1 X115.500 Y75.000 A85.4309
+G1 X75.000 Y115.500 A87.3210
+G1 X75.000 Y115.950 A87.3359
+G1 X115.950 Y75.000 A89.2470
+G1 X116.400 Y75.000 A89.2618
+G1 X75.000 Y116.400 A91.1939
+G1 X75.000 Y116.850 A91.2088
+G1 X116.850 Y75.000 A93.1619
+G1 X117.300 Y75.000 A93.1767
+G1 X75.000 Y117.300 A95.1508
+G1 X75.000 Y117.750 A95.1657
+G1 X117.750 Y75.000 A97.1608
+G1 X118.200 Y75.000 A97.1756
+G1 X75.000 Y118.200 A99.1917
+G1 X75.000 Y118.650 A99.2066
+G1 X118.650 Y75.000 A101.2437
+G1 X119.100 Y75.000 A101.2585
+G1 X75.000 Y119.100 A103.3166
+G1 X75.000 Y119.550 A103.3315
+G1 X119.550 Y75.000 A105.4106
+G1 X120.000 Y75.000 A105.4255
+G1 X75.000 Y120.000 A107.5256
+G1 X75.000 Y120.450 A107.5404
+G1 X120.450 Y75.000 A109.6615
+G1 X120.900 Y75.000 A109.6764
+G1 X75.000 Y120.900 A111.8185
+G1 X75.000 Y121.350 A111.8333
+G1 X121.350 Y75.000 A113.9964
+G1 X121.800 Y75.000 A114.0113
+G1 X75.000 Y121.800 A116.1954
+G1 X75.000 Y122.250 A116.2102
+G1 X122.250 Y75.000 A118.4154
+G1 X122.700 Y75.000 A118.4302
+G1 X75.000 Y122.700 A120.6563
+G1 X75.000 Y123.150 A120.6712
+G1 X123.150 Y75.000 A122.9183
+G1 X123.600 Y75.000 A122.9331
+G1 X75.000 Y123.600 A125.2013
+G1 X75.000 Y124.050 A125.2161
+G1 X124.050 Y75.000 A127.5052
+G1 X124.500 Y75.000 A127.5201
+G1 X75.000 Y124.500 A129.8302
+G1 X75.000 Y124.950 A129.8450
+G1 X124.950 Y75.000 A132.1762
+G1 X125.000 Y75.400 A132.1895
+G1 X75.400 Y125.000 A134.5042
+G1 X75.850 Y125.000 A134.5191
+G1 X125.000 Y75.850 A136.8129
+G1 X125.000 Y76.300 A136.8277
+G1 X76.300 Y125.000 A139.1005
+G1 X76.750 Y125.000 A139.1154
+G1 X125.000 Y76.750 A141.3671
+G1 X125.000 Y77.200 A141.3820
+G1 X77.200 Y125.000 A143.6128
+G1 X77.650 Y125.000 A143.6276
+G1 X125.000 Y77.650 A145.8374
+G1 X125.000 Y78.100 A145.8523
+G1 X78.100 Y125.000 A148.0410
+G1 X78.550 Y125.000 A148.0559
+G1 X125.000 Y78.550 A150.2237
+G1 X125.000 Y79.000 A150.2385
+G1 X79.000 Y125.000 A152.3853
+G1 X79.450 Y125.000 A152.4001
+G1 X125.000 Y79.450 A154.5259
+G1 X125.000 Y79.900 A154.5408
+G1 X79.900 Y125.000 A156.6455
+G1 X80.350 Y125.000 A156.6604
+G1 X125.000 Y80.350 A158.7442
+G1 X125.000 Y80.800 A158.7590
+G1 X80.800 Y125.000 A160.8218
+G1 X81.250 Y125.000 A160.8366
+G1 X125.000 Y81.250 A162.8784
+G1 X125.000 Y81.700 A162.8933
+G1 X81.700 Y125.000 A164.9140
+G1 X82.150 Y125.000 A164.9289
+G1 X125.000 Y82.150 A166.9286
+G1 X125.000 Y82.600 A166.9435
+G1 X82.600 Y125.000 A168.9223
+G1 X83.050 Y125.000 A168.9371
+G1 X125.000 Y83.050 A170.8949
+G1 X125.000 Y83.500 A170.9097
+G1 X83.500 Y125.000 A172.8465
+G1 X83.950 Y125.000 A172.8613
+G1 X125.000 Y83.950 A174.7771
+G1 X125.000 Y84.400 A174.7920
+G1 X84.400 Y125.000 A176.6867
+G1 X84.850 Y125.000 A176.7016
+G1 X125.000 Y84.850 A178.5753
+G1 X125.000 Y85.300 A178.5902
+G1 X85.300 Y125.000 A180.4429
+G1 X85.750 Y125.000 A180.4578
+G1 X125.000 Y85.750 A182.2896
+G1 X125.000 Y86.200 A182.3044
+G1 X86.200 Y125.000 A184.1152
+G1 X86.650 Y125.000 A184.1300
+G1 X125.000 Y86.650 A185.9198
+G1 X125.000 Y87.100 A185.9346
+G1 X87.100 Y125.000 A187.7034
+G1 X87.550 Y125.000 A187.7182
+G1 X125.000 Y87.550 A189.4660
+G1 X125.000 Y88.000 A189.4808
+G1 X88.000 Y125.000 A191.2076
+G1 X88.450 Y125.000 A191.2224
+G1 X125.000 Y88.450 A192.9282
+G1 X125.000 Y88.900 A192.9430
+G1 X88.900 Y125.000 A194.6278
+G1 X89.350 Y125.000 A194.6426
+G1 X125.000 Y89.350 A196.3064
+G1 X125.000 Y89.800 A196.3212
+G1 X89.800 Y125.000 A197.9640
+G1 X90.250 Y125.000 A197.9788
+G1 X125.000 Y90.250 A199.6006
+G1 X125.000 Y90.700 A199.6154
+G1 X90.700 Y125.000 A201.2162
+G1 X91.150 Y125.000 A201.2310
+G1 X125.000 Y91.150 A202.8108
+G1 X125.000 Y91.600 A202.8256
+G1 X91.600 Y125.000 A204.3844
+G1 X92.050 Y125.000 A204.3992
+G1 X125.000 Y92.050 A205.9370
+G1 X125.000 Y92.500 A205.9518
+G1 X92.500 Y125.000 A207.4686
+G1 X92.950 Y125.000 A207.4834
+G1 X125.000 Y92.950 A208.9792
+G1 X125.000 Y93.400 A208.9940
+G1 X93.400 Y125.000 A210.4688
+G1 X93.850 Y125.000 A210.4836
+G1 X125.000 Y93.850 A211.9373
+G1 X125.000 Y94.300 A211.9522
+G1 X94.300 Y125.000 A213.3849
+G1 X94.750 Y125.000 A213.3998
+G1 X125.000 Y94.750 A214.8115
+G1 X125.000 Y95.200 A214.8264
+G1 X95.200 Y125.000 A216.2171
+G1 X95.650 Y125.000 A216.2320
+G1 X125.000 Y95.650 A217.6017
+G1 X125.000 Y96.100 A217.6166
+G1 X96.100 Y125.000 A218.9653
+G1 X96.550 Y125.000 A218.9801
+G1 X125.000 Y96.550 A220.3079
+G1 X125.000 Y97.000 A220.3227
+G1 X97.000 Y125.000 A221.6295
+G1 X97.450 Y125.000 A221.6443
+G1 X125.000 Y97.450 A222.9300
+G1 X125.000 Y97.900 A222.9449
+G1 X97.900 Y125.000 A224.2096
+G1 X98.350 Y125.000 A224.2245
+G1 X125.000 Y98.350 A225.4682
+G1 X125.000 Y98.800 A225.4830
+G1 X98.800 Y125.000 A226.7058
+G1 X99.250 Y125.000 A226.7206
+G1 X125.000 Y99.250 A227.9224
+G1 X125.000 Y99.700 A227.9372
+G1 X99.700 Y125.000 A229.1179
+G1 X100.150 Y125.000 A229.1328
+G1 X125.000 Y100.150 A230.2925
+G1 X125.000 Y100.600 A230.3074
+G1 X100.600 Y125.000 A231.4461
+G1 X101.050 Y125.000 A231.4609
+G1 X125.000 Y101.050 A232.5787
+G1 X125.000 Y101.500 A232.5935
+G1 X101.500 Y125.000 A233.6902
+G1 X101.950 Y125.000 A233.7051
+G1 X125.000 Y101.950 A234.7808
+G1 X125.000 Y102.400 A234.7957
+G1 X102.400 Y125.000 A235.8504
+G1 X102.850 Y125.000 A235.8652
+G1 X125.000 Y102.850 A236.8989
+G1 X125.000 Y103.300 A236.9138
+G1 X103.300 Y125.000 A237.9265
+G1 X103.750 Y125.000 A237.9414
+G1 X125.000 Y103.750 A238.9331
+G1 X125.000 Y104.200 A238.9479
+G1 X104.200 Y125.000 A239.9186
+G1 X104.650 Y125.000 A239.9335
+G1 X125.000 Y104.650 A240.8832
+G1 X125.000 Y105.100 A240.8981
+G1 X105.100 Y125.000 A241.8268
+G1 X105.550 Y125.000 A241.8416
+G1 X125.000 Y105.550 A242.7493
+G1 X125.000 Y106.000 A242.7642
+G1 X106.000 Y125.000 A243.6509
+G1 X106.450 Y125.000 A243.6657
+G1 X125.000 Y106.450 A244.5315
+G1 X125.000 Y106.900 A244.5463
+G1 X106.900 Y125.000 A245.3910
+G1 X107.350 Y125.000 A245.4059
+G1 X125.000 Y107.350 A246.2296
+G1 X125.000 Y107.800 A246.2444
+G1 X107.800 Y125.000 A247.0471
+G1 X108.250 Y125.000 A247.0620
+G1 X125.000 Y108.250 A247.8437
+G1 X125.000 Y108.700 A247.8585
+G1 X108.700 Y125.000 A248.6192
+G1 X109.150 Y125.000 A248.6341
+G1 X125.000 Y109.150 A249.3738
+G1 X125.000 Y109.600 A249.3887
+G1 X109.600 Y125.000 A250.1074
+G1 X110.050 Y125.000 A250.1222
+G1 X125.000 Y110.050 A250.8199
+G1 X125.000 Y110.500 A250.8348
+G1 X110.500 Y125.000 A251.5115
+G1 X110.950 Y125.000 A251.5263
+G1 X125.000 Y110.950 A252.1820
+G1 X125.000 Y111.400 A252.1969
+G1 X111.400 Y125.000 A252.8316
+G1 X111.850 Y125.000 A252.8464
+G1 X125.000 Y111.850 A253.4601
+G1 X125.000 Y112.300 A253.4750
+G1 X112.300 Y125.000 A254.0677
+G1 X112.750 Y125.000 A254.0825
+G1 X125.000 Y112.750 A254.6542
+G1 X125.000 Y113.200 A254.6690
+G1 X113.200 Y125.000 A255.2197
+G1 X113.650 Y125.000 A255.2346
+G1 X125.000 Y113.650 A255.7643
+G1 X125.000 Y114.100 A255.7791
+G1 X114.100 Y125.000 A256.2878
+G1 X114.550 Y125.000 A256.3027
+G1 X125.000 Y114.550 A256.7904
+G1 X125.000 Y115.000 A256.8052
+G1 X115.000 Y125.000 A257.2719
+G1 X115.450 Y125.000 A257.2868
+G1 X125.000 Y115.450 A257.7324
+G1 X125.000 Y115.900 A257.7473
+G1 X115.900 Y125.000 A258.1720
+G1 X116.350 Y125.000 A258.1868
+G1 X125.000 Y116.350 A258.5905
+G1 X125.000 Y116.800 A258.6054
+G1 X116.800 Y125.000 A258.9881
+G1 X117.250 Y125.000 A259.0029
+G1 X125.000 Y117.250 A259.3646
+G1 X125.000 Y117.700 A259.3794
+G1 X117.700 Y125.000 A259.7201
+G1 X118.150 Y125.000 A259.7350
+G1 X125.000 Y118.150 A260.0547
+G1 X125.000 Y118.600 A260.0695
+G1 X118.600 Y125.000 A260.3682
+G1 X119.050 Y125.000 A260.3830
+G1 X125.000 Y119.050 A260.6607
+G1 X125.000 Y119.500 A260.6756
+G1 X119.500 Y125.000 A260.9323
+G1 X119.950 Y125.000 A260.9471
+G1 X125.000 Y119.950 A261.1828
+G1 X125.000 Y120.400 A261.1976
+G1 X120.400 Y125.000 A261.4123
+G1 X120.850 Y125.000 A261.4272
+G1 X125.000 Y120.850 A261.6208
+G1 X125.000 Y121.300 A261.6357
+G1 X121.300 Y125.000 A261.8084
+G1 X121.750 Y125.000 A261.8232
+G1 X125.000 Y121.750 A261.9749
+G1 X125.000 Y122.200 A261.9897
+G1 X122.200 Y125.000 A262.1204
+G1 X122.650 Y125.000 A262.1353
+G1 X125.000 Y122.650 A262.2449
+G1 X125.000 Y123.100 A262.2598
+G1 X123.100 Y125.000 A262.3485
+G1 X123.550 Y125.000 A262.3633
+G1 X125.000 Y123.550 A262.4310
+G1 X125.000 Y124.000 A262.4458
+G1 X124.000 Y125.000 A262.4925
+G1 X124.450 Y125.000 A262.5073
+G1 X125.000 Y124.450 A262.5330
+G1 X125.000 Y124.900 A262.5479
+G1 X124.900 Y125.000 A262.5525
+G0 Z0.50
+G1 A261.5525 F2400
+G0 X125.000 Y75.450
+G1 A262.5525 F2400
+G1 F4800
+G1 X124.550 Y75.000 A262.5735
+G1 X124.100 Y75.000 A262.5884
+G1 X125.000 Y75.900 A262.6304
+G1 X125.000 Y76.350 A262.6452
+G1 X123.650 Y75.000 A262.7082
+G1 X123.200 Y75.000 A262.7231
+G1 X125.000 Y76.800 A262.8071
+G1 X125.000 Y77.250 A262.8219
+G1 X122.750 Y75.000 A262.9269
+G1 X122.300 Y75.000 A262.9418
+G1 X125.000 Y77.700 A263.0678
+G1 X125.000 Y78.150 A263.0827
+G1 X121.850 Y75.000 A263.2297
+G1 X121.400 Y75.000 A263.2445
+G1 X125.000 Y78.600 A263.4125
+G1 X125.000 Y79.050 A263.4274
+G1 X120.950 Y75.000 A263.6164
+G1 X120.500 Y75.000 A263.6312
+G1 X125.000 Y79.500 A263.8412
+G1 X125.000 Y79.950 A263.8561
+G1 X120.050 Y75.000 A264.0871
+G1 X119.600 Y75.000 A264.1020
+G1 X125.000 Y80.400 A264.3540
+G1 X125.000 Y80.850 A264.3688
+G1 X119.150 Y75.000 A264.6418
+G1 X118.700 Y75.000 A264.6567
+G1 X125.000 Y81.300 A264.9507
+G1 X125.000 Y81.750 A264.9655
+G1 X118.250 Y75.000 A265.2806
+G1 X117.800 Y75.000 A265.2954
+G1 X125.000 Y82.200 A265.6314
+G1 X125.000 Y82.650 A265.6463
+G1 X117.350 Y75.000 A266.0033
+G1 X116.900 Y75.000 A266.0181
+G1 X125.000 Y83.100 A266.3962
+G1 X125.000 Y83.550 A266.4110
+G1 X116.450 Y75.000 A266.8100
+G1 X116.000 Y75.000 A266.8249
+G1 X125.000 Y84.000 A267.2449
+G1 X125.000 Y84.450 A267.2598
+G1 X115.550 Y75.000 A267.7008
+G1 X115.100 Y75.000 A267.7156
+G1 X125.000 Y84.900 A268.1777
+G1 X125.000 Y85.350 A268.1925
+G1 X114.650 Y75.000 A268.6755
+G1 X114.200 Y75.000 A268.6904
+G1 X125.000 Y85.800 A269.1944
+G1 X125.000 Y86.250 A269.2093
+G1 X113.750 Y75.000 A269.7343
+G1 X113.300 Y75.000 A269.7491
+G1 X125.000 Y86.700 A270.2952
+G1 X125.000 Y87.150 A270.3100
+G1 X112.850 Y75.000 A270.8770
+G1 X112.400 Y75.000 A270.8919
+G1 X125.000 Y87.600 A271.4799
+G1 X125.000 Y88.050 A271.4948
+G1 X111.950 Y75.000 A272.1038
+G1 X111.500 Y75.000 A272.1186
+G1 X125.000 Y88.500 A272.7487
+G1 X125.000 Y88.950 A272.7635
+G1 X111.050 Y75.000 A273.4146
+G1 X110.600 Y75.000 A273.4294
+G1 X125.000 Y89.400 A274.1014
+G1 X125.000 Y89.850 A274.1163
+G1 X110.150 Y75.000 A274.8093
+G1 X109.700 Y75.000 A274.8242
+G1 X125.000 Y90.300 A275.5382
+G1 X125.000 Y90.750 A275.5531
+G1 X109.250 Y75.000 A276.2881
+G1 X108.800 Y75.000 A276.3030
+G1 X125.000 Y91.200 A277.0590
+G1 X125.000 Y91.650 A277.0738
+G1 X108.350 Y75.000 A277.8509
+G1 X107.900 Y75.000 A277.8657
+G1 X125.000 Y92.100 A278.6638
+G1 X125.000 Y92.550 A278.6786
+G1 X107.450 Y75.000 A279.4977
+G1 X107.000 Y75.000 A279.5125
+G1 X125.000 Y93.000 A280.3526
+G1 X125.000 Y93.450 A280.3674
+G1 X106.550 Y75.000 A281.2285
+G1 X106.100 Y75.000 A281.2433
+G1 X125.000 Y93.900 A282.1253
+G1 X125.000 Y94.350 A282.1402
+G1 X105.650 Y75.000 A283.0432
+G1 X105.200 Y75.000 A283.0581
+G1 X125.000 Y94.800 A283.9821
+G1 X125.000 Y95.250 A283.9970
+G1 X104.750 Y75.000 A284.9420
+G1 X104.300 Y75.000 A284.9569
+G1 X125.000 Y95.700 A285.9229
+G1 X125.000 Y96.150 A285.9378
+G1 X103.850 Y75.000 A286.9248
+G1 X103.400 Y75.000 A286.9397
+G1 X125.000 Y96.600 A287.9477
+G1 X125.000 Y97.050 A287.9626
+G1 X102.950 Y75.000 A288.9916
+G1 X102.500 Y75.000 A289.0065
+G1 X125.000 Y97.500 A290.0565
+G1 X125.000 Y97.950 A290.0714
+G1 X102.050 Y75.000 A291.1425
+G1 X101.600 Y75.000 A291.1573
+G1 X125.000 Y98.400 A292.2494
+G1 X125.000 Y98.850 A292.2642
+G1 X101.150 Y75.000 A293.3773
+G1 X100.700 Y75.000 A293.3921
+G1 X125.000 Y99.300 A294.5262
+G1 X125.000 Y99.750 A294.5410
+G1 X100.250 Y75.000 A295.6961
+G1 X99.800 Y75.000 A295.7109
+G1 X125.000 Y100.200 A296.8870
+G1 X125.000 Y100.650 A296.9018
+G1 X99.350 Y75.000 A298.0989
+G1 X98.900 Y75.000 A298.1138
+G1 X125.000 Y101.100 A299.3318
+G1 X125.000 Y101.550 A299.3467
+G1 X98.450 Y75.000 A300.5857
+G1 X98.000 Y75.000 A300.6006
+G1 X125.000 Y102.000 A301.8606
+G1 X125.000 Y102.450 A301.8755
+G1 X97.550 Y75.000 A303.1566
+G1 X97.100 Y75.000 A303.1714
+G1 X125.000 Y102.900 A304.4735
+G1 X125.000 Y103.350 A304.4883
+G1 X96.650 Y75.000 A305.8114
+G1 X96.200 Y75.000 A305.8262
+G1 X125.000 Y103.800 A307.1703
+G1 X125.000 Y104.250 A307.1852
+G1 X95.750 Y75.000 A308.5502
+G1 X95.300 Y75.000 A308.5651
+G1 X125.000 Y104.700 A309.9511
+G1 X125.000 Y105.150 A309.9660
+G1 X94.850 Y75.000 A311.3731
+G1 X94.400 Y75.000 A311.3879
+G1 X125.000 Y105.600 A312.8160
+G1 X125.000 Y106.050 A312.8308
+G1 X93.950 Y75.000 A314.2799
+G1 X93.500 Y75.000 A314.2948
+G1 X125.000 Y106.500 A315.7648
+G1 X125.000 Y106.950 A315.7797
+G1 X93.050 Y75.000 A317.2708
+G1 X92.600 Y75.000 A317.2856
+G1 X125.000 Y107.400 A318.7977
+G1 X125.000 Y107.850 A318.8125
+G1 X92.150 Y75.000 A320.3456
+G1 X91.700 Y75.000 A320.3605
+G1 X125.000 Y108.300 A321.9146
+G1 X125.000 Y108.750 A321.9294
+G1 X91.250 Y75.000 A323.5045
+G1 X90.800 Y75.000 A323.5193
+G1 X125.000 Y109.200 A325.1154
+G1 X125.000 Y109.650 A325.1303
+G1 X90.350 Y75.000 A326.7473
+G1 X89.900 Y75.000 A326.7622
+G1 X125.000 Y110.100 A328.4003
+G1 X125.000 Y110.550 A328.4151
+G1 X89.450 Y75.000 A330.0742
+G1 X89.000 Y75.000 A330.0891
+G1 X125.000 Y111.000 A331.7692
+G1 X125.000 Y111.450 A331.7840
+G1 X88.550 Y75.000 A333.4851
+G1 X88.100 Y75.000 A333.4999
+G1 X125.000 Y111.900 A335.2220
+G1 X125.000 Y112.350 A335.2369
+G1 X87.650 Y75.000 A336.9800
+G1 X87.200 Y75.000 A336.9948
+G1 X125.000 Y112.800 A338.7589
+G1 X125.000 Y113.250 A338.7738
+G1 X86.750 Y75.000 A340.5588
+G1 X86.300 Y75.000 A340.5737
+G1 X125.000 Y113.700 A342.3798
+G1 X125.000 Y114.150 A342.3946
+G1 X85.850 Y75.000 A344.2217
+G1 X85.400 Y75.000 A344.2366
+G1 X125.000 Y114.600 A346.0847
+G1 X125.000 Y115.050 A346.0995
+G1 X84.950 Y75.000 A347.9686
+G1 X84.500 Y75.000 A347.9835
+G1 X125.000 Y115.500 A349.8736
+G1 X125.000 Y115.950 A349.8884
+G1 X84.050 Y75.000 A351.7995
+G1 X83.600 Y75.000 A351.8144
+G1 X125.000 Y116.400 A353.7465
+G1 X125.000 Y116.850 A353.7613
+G1 X83.150 Y75.000 A355.7144
+G1 X82.700 Y75.000 A355.7293
+G1 X125.000 Y117.300 A357.7034
+G1 X125.000 Y117.750 A357.7182
+G1 X82.250 Y75.000 A359.7133
+G1 X81.800 Y75.000 A359.7282
+G1 X125.000 Y118.200 A361.7443
+G1 X125.000 Y118.650 A361.7591
+G1 X81.350 Y75.000 A363.7962
+G1 X80.900 Y75.000 A363.8111
+G1 X125.000 Y119.100 A365.8692
+G1 X125.000 Y119.550 A365.8840
+G1 X80.450 Y75.000 A367.9631
+G1 X80.000 Y75.000 A367.9780
+G1 X125.000 Y120.000 A370.0781
+G1 X125.000 Y120.450 A370.0929
+G1 X79.550 Y75.000 A372.2140
+G1 X79.100 Y75.000 A372.2289
+G1 X125.000 Y120.900 A374.3710
+G1 X125.000 Y121.350 A374.3859
+G1 X78.650 Y75.000 A376.5490
+G1 X78.200 Y75.000 A376.5638
+G1 X125.000 Y121.800 A378.7479
+G1 X125.000 Y122.250 A378.7628
+G1 X77.750 Y75.000 A380.9679
+G1 X77.300 Y75.000 A380.9827
+G1 X125.000 Y122.700 A383.2089
+G1 X125.000 Y123.150 A383.2237
+G1 X76.850 Y75.000 A385.4708
+G1 X76.400 Y75.000 A385.4857
+G1 X125.000 Y123.600 A387.7538
+G1 X125.000 Y124.050 A387.7686
+G1 X75.950 Y75.000 A390.0578
+G1 X75.500 Y75.000 A390.0726
+G1 X125.000 Y124.500 A392.3827
+G1 X125.000 Y124.950 A392.3976
+G1 X75.050 Y75.000 A394.7287
+G1 X75.000 Y75.400 A394.7420
+G1 X124.600 Y125.000 A397.0568
+G1 X124.150 Y125.000 A397.0716
+G1 X75.000 Y75.850 A399.3654
+G1 X75.000 Y76.300 A399.3803
+G1 X123.700 Y125.000 A401.6530
+G1 X123.250 Y125.000 A401.6679
+G1 X75.000 Y76.750 A403.9197
+G1 X75.000 Y77.200 A403.9345
+G1 X122.800 Y125.000 A406.1653
+G1 X122.350 Y125.000 A406.1802
+G1 X75.000 Y77.650 A408.3899
+G1 X75.000 Y78.100 A408.4048
+G1 X121.900 Y125.000 A410.5936
+G1 X121.450 Y125.000 A410.6084
+G1 X75.000 Y78.550 A412.7762
+G1 X75.000 Y79.000 A412.7910
+G1 X121.000 Y125.000 A414.9378
+G1 X120.550 Y125.000 A414.9527
+G1 X75.000 Y79.450 A417.0784
+G1 X75.000 Y79.900 A417.0933
+G1 X120.100 Y125.000 A419.1981
+G1 X119.650 Y125.000 A419.2129
+G1 X75.000 Y80.350 A421.2967
+G1 X75.000 Y80.800 A421.3115
+G1 X119.200 Y125.000 A423.3743
+G1 X118.750 Y125.000 A423.3892
+G1 X75.000 Y81.250 A425.4309
+G1 X75.000 Y81.700 A425.4458
+G1 X118.300 Y125.000 A427.4666
+G1 X117.850 Y125.000 A427.4814
+G1 X75.000 Y82.150 A429.4812
+G1 X75.000 Y82.600 A429.4960
+G1 X117.400 Y125.000 A431.4748
+G1 X116.950 Y125.000 A431.4896
+G1 X75.000 Y83.050 A433.4474
+G1 X75.000 Y83.500 A433.4623
+G1 X116.500 Y125.000 A435.3990
+G1 X116.050 Y125.000 A435.4139
+G1 X75.000 Y83.950 A437.3296
+G1 X75.000 Y84.400 A437.3445
+G1 X115.600 Y125.000 A439.2392
+G1 X115.150 Y125.000 A439.2541
+G1 X75.000 Y84.850 A441.1279
+G1 X75.000 Y85.300 A441.1427
+G1 X114.700 Y125.000 A442.9955
+G1 X114.250 Y125.000 A443.0103
+G1 X75.000 Y85.750 A444.8421
+G1 X75.000 Y86.200 A444.8569
+G1 X113.800 Y125.000 A446.6677
+G1 X113.350 Y125.000 A446.6825
+G1 X75.000 Y86.650 A448.4723
+G1 X75.000 Y87.100 A448.4871
+G1 X112.900 Y125.000 A450.2559
+G1 X112.450 Y125.000 A450.2708
+G1 X75.000 Y87.550 A452.0185
+G1 X75.000 Y88.000 A452.0334
+G1 X112.000 Y125.000 A453.7601
+G1 X111.550 Y125.000 A453.7750
+G1 X75.000 Y88.450 A455.4807
+G1 X75.000 Y88.900 A455.4956
+G1 X111.100 Y125.000 A457.1803
+G1 X110.650 Y125.000 A457.1952
+G1 X75.000 Y89.350 A458.8589
+G1 X75.000 Y89.800 A458.8738
+G1 X110.200 Y125.000 A460.5165
+G1 X109.750 Y125.000 A460.5314
+G1 X75.000 Y90.250 A462.1531
+G1 X75.000 Y90.700 A462.1680
+G1 X109.300 Y125.000 A463.7687
+G1 X108.850 Y125.000 A463.7836
+G1 X75.000 Y91.150 A465.3633
+G1 X75.000 Y91.600 A465.3782
+G1 X108.400 Y125.000 A466.9369
+G1 X107.950 Y125.000 A466.9518
+G1 X75.000 Y92.050 A468.4895
+G1 X75.000 Y92.500 A468.5044
+G1 X107.500 Y125.000 A470.0211
+G1 X107.050 Y125.000 A470.0360
+G1 X75.000 Y92.950 A471.5317
+G1 X75.000 Y93.400 A471.5465
+G1 X106.600 Y125.000 A473.0213
+G1 X106.150 Y125.000 A473.0361
+G1 X75.000 Y93.850 A474.4899
+G1 X75.000 Y94.300 A474.5047
+G1 X105.700 Y125.000 A475.9375
+G1 X105.250 Y125.000 A475.9523
+G1 X75.000 Y94.750 A477.3641
+G1 X75.000 Y95.200 A477.3789
+G1 X104.800 Y125.000 A478.7696
+G1 X104.350 Y125.000 A478.7845
+G1 X75.000 Y95.650 A480.1542
+G1 X75.000 Y96.100 A480.1691
+G1 X103.900 Y125.000 A481.5178
+G1 X103.450 Y125.000 A481.5327
+G1 X75.000 Y96.550 A482.8604
+G1 X75.000 Y97.000 A482.8753
+G1 X103.000 Y125.000 A484.1820
+G1 X102.550 Y125.000 A484.1968
+G1 X75.000 Y97.450 A485.4826
+G1 X75.000 Y97.900 A485.4974
+G1 X102.100 Y125.000 A486.7621
+G1 X101.650 Y125.000 A486.7770
+G1 X75.000 Y98.350 A488.0207
+G1 X75.000 Y98.800 A488.0356
+G1 X101.200 Y125.000 A489.2583
+G1 X100.750 Y125.000 A489.2732
+G1 X75.000 Y99.250 A490.4749
+G1 X75.000 Y99.700 A490.4897
+G1 X100.300 Y125.000 A491.6705
+G1 X99.850 Y125.000 A491.6853
+G1 X75.000 Y100.150 A492.8450
+G1 X75.000 Y100.600 A492.8599
+G1 X99.400 Y125.000 A493.9986
+G1 X98.950 Y125.000 A494.0135
+G1 X75.000 Y101.050 A495.1312
+G1 X75.000 Y101.500 A495.1460
+G1 X98.500 Y125.000 A496.2428
+G1 X98.050 Y125.000 A496.2576
+G1 X75.000 Y101.950 A497.3333
+G1 X75.000 Y102.400 A497.3482
+G1 X97.600 Y125.000 A498.4029
+G1 X97.150 Y125.000 A498.4178
+G1 X75.000 Y102.850 A499.4515
+G1 X75.000 Y103.300 A499.4663
+G1 X96.700 Y125.000 A500.4790
+G1 X96.250 Y125.000 A500.4939
+G1 X75.000 Y103.750 A501.4856
+G1 X75.000 Y104.200 A501.5005
+G1 X95.800 Y125.000 A502.4712
+G1 X95.350 Y125.000 A502.4860
+G1 X75.000 Y104.650 A503.4357
+G1 X75.000 Y105.100 A503.4506
+G1 X94.900 Y125.000 A504.3793
+G1 X94.450 Y125.000 A504.3942
+G1 X75.000 Y105.550 A505.3019
+G1 X75.000 Y106.000 A505.3167
+G1 X94.000 Y125.000 A506.2034
+G1 X93.550 Y125.000 A506.2183
+G1 X75.000 Y106.450 A507.0840
+G1 X75.000 Y106.900 A507.0988
+G1 X93.100 Y125.000 A507.9435
+G1 X92.650 Y125.000 A507.9584
+G1 X75.000 Y107.350 A508.7821
+G1 X75.000 Y107.800 A508.7970
+G1 X92.200 Y125.000 A509.5997
+G1 X91.750 Y125.000 A509.6145
+G1 X75.000 Y108.250 A510.3962
+G1 X75.000 Y108.700 A510.4111
+G1 X91.300 Y125.000 A511.1718
+G1 X90.850 Y125.000 A511.1866
+G1 X75.000 Y109.150 A511.9263
+G1 X75.000 Y109.600 A511.9412
+G1 X90.400 Y125.000 A512.6599
+G1 X89.950 Y125.000 A512.6747
+G1 X75.000 Y110.050 A513.3724
+G1 X75.000 Y110.500 A513.3873
+G1 X89.500 Y125.000 A514.0640
+G1 X89.050 Y125.000 A514.0788
+G1 X75.000 Y110.950 A514.7345
+G1 X75.000 Y111.400 A514.7494
+G1 X88.600 Y125.000 A515.3841
+G1 X88.150 Y125.000 A515.3989
+G1 X75.000 Y111.850 A516.0126
+G1 X75.000 Y112.300 A516.0275
+G1 X87.700 Y125.000 A516.6202
+G1 X87.250 Y125.000 A516.6350
+G1 X75.000 Y112.750 A517.2067
+G1 X75.000 Y113.200 A517.2216
+G1 X86.800 Y125.000 A517.7723
+G1 X86.350 Y125.000 A517.7871
+G1 X75.000 Y113.650 A518.3168
+G1 X75.000 Y114.100 A518.3317
+G1 X85.900 Y125.000 A518.8404
+G1 X85.450 Y125.000 A518.8552
+G1 X75.000 Y114.550 A519.3429
+G1 X75.000 Y115.000 A519.3577
+G1 X85.000 Y125.000 A519.8244
+G1 X84.550 Y125.000 A519.8393
+G1 X75.000 Y115.450 A520.2850
+G1 X75.000 Y115.900 A520.2998
+G1 X84.100 Y125.000 A520.7245
+G1 X83.650 Y125.000 A520.7394
+G1 X75.000 Y116.350 A521.1431
+G1 X75.000 Y116.800 A521.1579
+G1 X83.200 Y125.000 A521.5406
+G1 X82.750 Y125.000 A521.5554
+G1 X75.000 Y117.250 A521.9171
+G1 X75.000 Y117.700 A521.9320
+G1 X82.300 Y125.000 A522.2727
+G1 X81.850 Y125.000 A522.2875
+G1 X75.000 Y118.150 A522.6072
+G1 X75.000 Y118.600 A522.6220
+G1 X81.400 Y125.000 A522.9207
+G1 X80.950 Y125.000 A522.9356
+G1 X75.000 Y119.050 A523.2133
+G1 X75.000 Y119.500 A523.2281
+G1 X80.500 Y125.000 A523.4848
+G1 X80.050 Y125.000 A523.4996
+G1 X75.000 Y119.950 A523.7353
+G1 X75.000 Y120.400 A523.7502
+G1 X79.600 Y125.000 A523.9648
+G1 X79.150 Y125.000 A523.9797
+G1 X75.000 Y120.850 A524.1734
+G1 X75.000 Y121.300 A524.1882
+G1 X78.700 Y125.000 A524.3609
+G1 X78.250 Y125.000 A524.3757
+G1 X75.000 Y121.750 A524.5274
+G1 X75.000 Y122.200 A524.5423
+G1 X77.800 Y125.000 A524.6729
+G1 X77.350 Y125.000 A524.6878
+G1 X75.000 Y122.650 A524.7975
+G1 X75.000 Y123.100 A524.8123
+G1 X76.900 Y125.000 A524.9010
+G1 X76.450 Y125.000 A524.9158
+G1 X75.000 Y123.550 A524.9835
+G1 X75.000 Y124.000 A524.9984
+G1 X76.000 Y125.000 A525.0450
+G1 X75.550 Y125.000 A525.0599
+G1 X75.000 Y124.450 A525.0855
+G1 X75.000 Y124.900 A525.1004
+G1 X75.100 Y125.000 A525.1051
+G0 Z0.70
+G1 A524.1051 F2400
+G0 X75.000 Y75.450
+G1 A525.1051 F2400
+G1 F4800
+G1 X75.450 Y75.000 A525.1261
+G1 X75.900 Y75.000 A525.1409
+G1 X75.000 Y75.900 A525.1829
+G1 X75.000 Y76.350 A525.1978
+G1 X76.350 Y75.000 A525.2608
+G1 X76.800 Y75.000 A525.2756
+G1 X75.000 Y76.800 A525.3596
+G1 X75.000 Y77.250 A525.3745
+G1 X77.250 Y75.000 A525.4795
+G1 X77.700 Y75.000 A525.4943
+G1 X75.000 Y77.700 A525.6203
+G1 X75.000 Y78.150 A525.6352
+G1 X78.150 Y75.000 A525.7822
+G1 X78.600 Y75.000 A525.7970
+G1 X75.000 Y78.600 A525.9650
+G1 X75.000 Y79.050 A525.9799
+G1 X79.050 Y75.000 A526.1689
+G1 X79.500 Y75.000 A526.1838
+G1 X75.000 Y79.500 A526.3938
+G1 X75.000 Y79.950 A526.4086
+G1 X79.950 Y75.000 A526.6396
+G1 X80.400 Y75.000 A526.6545
+G1 X75.000 Y80.400 A526.9065
+G1 X75.000 Y80.850 A526.9213
+G1 X80.850 Y75.000 A527.1944
+G1 X81.300 Y75.000 A527.2092
+G1 X75.000 Y81.300 A527.5032
+G1 X75.000 Y81.750 A527.5181
+G1 X81.750 Y75.000 A527.8331
+G1 X82.200 Y75.000 A527.8479
+G1 X75.000 Y82.200 A528.1840
+G1 X75.000 Y82.650 A528.1988
+G1 X82.650 Y75.000 A528.5558
+G1 X83.100 Y75.000 A528.5707
+G1 X75.000 Y83.100 A528.9487
+G1 X75.000 Y83.550 A528.9635
+G1 X83.550 Y75.000 A529.3626
+G1 X84.000 Y75.000 A529.3774
+G1 X75.000 Y84.000 A529.7974
+G1 X75.000 Y84.450 A529.8123
+G1 X84.450 Y75.000 A530.2533
+G1 X84.900 Y75.000 A530.2682
+G1 X75.000 Y84.900 A530.7302
+G1 X75.000 Y85.350 A530.7450
+G1 X85.350 Y75.000 A531.2281
+G1 X85.800 Y75.000 A531.2429
+G1 X75.000 Y85.800 A531.7469
+G1 X75.000 Y86.250 A531.7618
+G1 X86.250 Y75.000 A532.2868
+G1 X86.700 Y75.000 A532.3017
+G1 X75.000 Y86.700 A532.8477
+G1 X75.000 Y87.150 A532.8625
+G1 X87.150 Y75.000 A533.4296
+G1 X87.600 Y75.000 A533.4444
+G1 X75.000 Y87.600 A534.0324
+G1 X75.000 Y88.050 A534.0473
+G1 X88.050 Y75.000 A534.6563
+G1 X88.500 Y75.000 A534.6712
+G1 X75.000 Y88.500 A535.3012
+G1 X75.000 Y88.950 A535.3161
+G1 X88.950 Y75.000 A535.9671
+G1 X89.400 Y75.000 A535.9819
+G1 X75.000 Y89.400 A536.6540
+G1 X75.000 Y89.850 A536.6688
+G1 X89.850 Y75.000 A537.3619
+G1 X90.300 Y75.000 A537.3767
+G1 X75.000 Y90.300 A538.0907
+G1 X75.000 Y90.750 A538.1056
+G1 X90.750 Y75.000 A538.8406
+G1 X91.200 Y75.000 A538.8555
+G1 X75.000 Y91.200 A539.6115
+G1 X75.000 Y91.650 A539.6264
+G1 X91.650 Y75.000 A540.4034
+G1 X92.100 Y75.000 A540.4183
+G1 X75.000 Y92.100 A541.2163
+G1 X75.000 Y92.550 A541.2312
+G1 X92.550 Y75.000 A542.0502
+G1 X93.000 Y75.000 A542.0650
+G1 X75.000 Y93.000 A542.9051
+G1 X75.000 Y93.450 A542.9199
+G1 X93.450 Y75.000 A543.7810
+G1 X93.900 Y75.000 A543.7958
+G1 X75.000 Y93.900 A544.6779
+G1 X75.000 Y94.350 A544.6927
+G1 X94.350 Y75.000 A545.5958
+G1 X94.800 Y75.000 A545.6106
+G1 X75.000 Y94.800 A546.5347
+G1 X75.000 Y95.250 A546.5495
+G1 X95.250 Y75.000 A547.4946
+G1 X95.700 Y75.000 A547.5094
+G1 X75.000 Y95.700 A548.4755
+G1 X75.000 Y96.150 A548.4903
+G1 X96.150 Y75.000 A549.4774
+G1 X96.600 Y75.000 A549.4922
+G1 X75.000 Y96.600 A550.5003
+G1 X75.000 Y97.050 A550.5151
+G1 X97.050 Y75.000 A551.5442
+G1 X97.500 Y75.000 A551.5590
+G1 X75.000 Y97.500 A552.6091
+G1 X75.000 Y97.950 A552.6239
+G1 X97.950 Y75.000 A553.6950
+G1 X98.400 Y75.000 A553.7098
+G1 X75.000 Y98.400 A554.8019
+G1 X75.000 Y98.850 A554.8167
+G1 X98.850 Y75.000 A555.9298
+G1 X99.300 Y75.000 A555.9446
+G1 X75.000 Y99.300 A557.0787
+G1 X75.000 Y99.750 A557.0936
+G1 X99.750 Y75.000 A558.2486
+G1 X100.200 Y75.000 A558.2635
+G1 X75.000 Y100.200 A559.4395
+G1 X75.000 Y100.650 A559.4544
+G1 X100.650 Y75.000 A560.6514
+G1 X101.100 Y75.000 A560.6663
+G1 X75.000 Y101.100 A561.8843
+G1 X75.000 Y101.550 A561.8992
+G1 X101.550 Y75.000 A563.1383
+G1 X102.000 Y75.000 A563.1531
+G1 X75.000 Y102.000 A564.4132
+G1 X75.000 Y102.450 A564.4280
+G1 X102.450 Y75.000 A565.7091
+G1 X102.900 Y75.000 A565.7239
+G1 X75.000 Y102.900 A567.0260
+G1 X75.000 Y103.350 A567.0409
+G1 X103.350 Y75.000 A568.3639
+G1 X103.800 Y75.000 A568.3788
+G1 X75.000 Y103.800 A569.7228
+G1 X75.000 Y104.250 A569.7377
+G1 X104.250 Y75.000 A571.1028
+G1 X104.700 Y75.000 A571.1176
+G1 X75.000 Y104.700 A572.5037
+G1 X75.000 Y105.150 A572.5185
+G1 X105.150 Y75.000 A573.9256
+G1 X105.600 Y75.000 A573.9405
+G1 X75.000 Y105.600 A575.3685
+G1 X75.000 Y106.050 A575.3834
+G1 X106.050 Y75.000 A576.8324
+G1 X106.500 Y75.000 A576.8473
+G1 X75.000 Y106.500 A578.3174
+G1 X75.000 Y106.950 A578.3322
+G1 X106.950 Y75.000 A579.8233
+G1 X107.400 Y75.000 A579.8381
+G1 X75.000 Y107.400 A581.3502
+G1 X75.000 Y107.850 A581.3651
+G1 X107.850 Y75.000 A582.8982
+G1 X108.300 Y75.000 A582.9130
+G1 X75.000 Y108.300 A584.4671
+G1 X75.000 Y108.750 A584.4819
+G1 X108.750 Y75.000 A586.0570
+G1 X109.200 Y75.000 A586.0719
+G1 X75.000 Y109.200 A587.6679
+G1 X75.000 Y109.650 A587.6828
+G1 X109.650 Y75.000 A589.2999
+G1 X110.100 Y75.000 A589.3147
+G1 X75.000 Y110.100 A590.9528
+G1 X75.000 Y110.550 A590.9677
+G1 X110.550 Y75.000 A592.6267
+G1 X111.000 Y75.000 A592.6416
+G1 X75.000 Y111.000 A594.3217
+G1 X75.000 Y111.450 A594.3365
+G1 X111.450 Y75.000 A596.0376
+G1 X111.900 Y75.000 A596.0525
+G1 X75.000 Y111.900 A597.7746
+G1 X75.000 Y112.350 A597.7894
+G1 X112.350 Y75.000 A599.5325
+G1 X112.800 Y75.000 A599.5473
+G1 X75.000 Y112.800 A601.3114
+G1 X75.000 Y113.250 A601.3263
+G1 X113.250 Y75.000 A603.1114
+G1 X113.700 Y75.000 A603.1262
+G1 X75.000 Y113.700 A604.9323
+G1 X75.000 Y114.150 A604.9472
+G1 X114.150 Y75.000 A606.7743
+G1 X114.600 Y75.000 A606.7891
+G1 X75.000 Y114.600 A608.6372
+G1 X75.000 Y115.050 A608.6521
+G1 X115.050 Y75.000 A610.5212
+G1 X115.500 Y75.000 A610.5360
+G1 X75.000 Y115.500 A612.4261
+G1 X75.000 Y115.950 A612.4409
+G1 X115.950 Y75.000 A614.3520
+G1 X116.400 Y75.000 A614.3669
+G1 X75.000 Y116.400 A616.2990
+G1 X75.000 Y116.850 A616.3138
+G1 X116.850 Y75.000 A618.2669
+G1 X117.300 Y75.000 A618.2818
+G1 X75.000 Y117.300 A620.2559
+G1 X75.000 Y117.750 A620.2707
+G1 X117.750 Y75.000 A622.2658
+G1 X118.200 Y75.000 A622.2807
+G1 X75.000 Y118.200 A624.2968
+G1 X75.000 Y118.650 A624.3116
+G1 X118.650 Y75.000 A626.3488
+G1 X119.100 Y75.000 A626.3636
+G1 X75.000 Y119.100 A628.4217
+G1 X75.000 Y119.550 A628.4366
+G1 X119.550 Y75.000 A630.5157
+G1 X120.000 Y75.000 A630.5305
+G1 X75.000 Y120.000 A632.6306
+G1 X75.000 Y120.450 A632.6455
+G1 X120.450 Y75.000 A634.7666
+G1 X120.900 Y75.000 A634.7814
+G1 X75.000 Y120.900 A636.9235
+G1 X75.000 Y121.350 A636.9384
+G1 X121.350 Y75.000 A639.1015
+G1 X121.800 Y75.000 A639.1163
+G1 X75.000 Y121.800 A641.3005
+G1 X75.000 Y122.250 A641.3153
+G1 X122.250 Y75.000 A643.5204
+G1 X122.700 Y75.000 A643.5353
+G1 X75.000 Y122.700 A645.7614
+G1 X75.000 Y123.150 A645.7762
+G1 X123.150 Y75.000 A648.0234
+G1 X123.600 Y75.000 A648.0382
+G1 X75.000 Y123.600 A650.3063
+G1 X75.000 Y124.050 A650.3212
+G1 X124.050 Y75.000 A652.6103
+G1 X124.500 Y75.000 A652.6251
+G1 X75.000 Y124.500 A654.9353
+G1 X75.000 Y124.950 A654.9501
+G1 X124.950 Y75.000 A657.2812
+G1 X125.000 Y75.400 A657.2945
+G1 X75.400 Y125.000 A659.6093
+G1 X75.850 Y125.000 A659.6242
+G1 X125.000 Y75.850 A661.9179
+G1 X125.000 Y76.300 A661.9328
+G1 X76.300 Y125.000 A664.2056
+G1 X76.750 Y125.000 A664.2204
+G1 X125.000 Y76.750 A666.4722
+G1 X125.000 Y77.200 A666.4871
+G1 X77.200 Y125.000 A668.7178
+G1 X77.650 Y125.000 A668.7327
+G1 X125.000 Y77.650 A670.9425
+G1 X125.000 Y78.100 A670.9573
+G1 X78.100 Y125.000 A673.1461
+G1 X78.550 Y125.000 A673.1609
+G1 X125.000 Y78.550 A675.3287
+G1 X125.000 Y79.000 A675.3436
+G1 X79.000 Y125.000 A677.4903
+G1 X79.450 Y125.000 A677.5052
+G1 X125.000 Y79.450 A679.6310
+G1 X125.000 Y79.900 A679.6458
+G1 X79.900 Y125.000 A681.7506
+G1 X80.350 Y125.000 A681.7654
+G1 X125.000 Y80.350 A683.8492
+G1 X125.000 Y80.800 A683.8641
+G1 X80.800 Y125.000 A685.9268
+G1 X81.250 Y125.000 A685.9417
+G1 X125.000 Y81.250 A687.9835
+G1 X125.000 Y81.700 A687.9983
+G1 X81.700 Y125.000 A690.0191
+G1 X82.150 Y125.000 A690.0339
+G1 X125.000 Y82.150 A692.0337
+G1 X125.000 Y82.600 A692.0485
+G1 X82.600 Y125.000 A694.0273
+G1 X83.050 Y125.000 A694.0422
+G1 X125.000 Y83.050 A695.9999
+G1 X125.000 Y83.500 A696.0148
+G1 X83.500 Y125.000 A697.9515
+G1 X83.950 Y125.000 A697.9664
+G1 X125.000 Y83.950 A699.8822
+G1 X125.000 Y84.400 A699.8970
+G1 X84.400 Y125.000 A701.7918
+G1 X84.850 Y125.000 A701.8066
+G1 X125.000 Y84.850 A703.6804
+G1 X125.000 Y85.300 A703.6952
+G1 X85.300 Y125.000 A705.5480
+G1 X85.750 Y125.000 A705.5629
+G1 X125.000 Y85.750 A707.3946
+G1 X125.000 Y86.200 A707.4095
+G1 X86.200 Y125.000 A709.2202
+G1 X86.650 Y125.000 A709.2351
+G1 X125.000 Y86.650 A711.0248
+G1 X125.000 Y87.100 A711.0397
+G1 X87.100 Y125.000 A712.8084
+G1 X87.550 Y125.000 A712.8233
+G1 X125.000 Y87.550 A714.5710
+G1 X125.000 Y88.000 A714.5859
+G1 X88.000 Y125.000 A716.3126
+G1 X88.450 Y125.000 A716.3275
+G1 X125.000 Y88.450 A718.0332
+G1 X125.000 Y88.900 A718.0481
+G1 X88.900 Y125.000 A719.7329
+G1 X89.350 Y125.000 A719.7477
+G1 X125.000 Y89.350 A721.4115
+G1 X125.000 Y89.800 A721.4263
+G1 X89.800 Y125.000 A723.0691
+G1 X90.250 Y125.000 A723.0839
+G1 X125.000 Y90.250 A724.7057
+G1 X125.000 Y90.700 A724.7205
+G1 X90.700 Y125.000 A726.3213
+G1 X91.150 Y125.000 A726.3361
+G1 X125.000 Y91.150 A727.9158
+G1 X125.000 Y91.600 A727.9307
+G1 X91.600 Y125.000 A729.4894
+G1 X92.050 Y125.000 A729.5043
+G1 X125.000 Y92.050 A731.0420
+G1 X125.000 Y92.500 A731.0569
+G1 X92.500 Y125.000 A732.5736
+G1 X92.950 Y125.000 A732.5885
+G1 X125.000 Y92.950 A734.0842
+G1 X125.000 Y93.400 A734.0991
+G1 X93.400 Y125.000 A735.5738
+G1 X93.850 Y125.000 A735.5887
+G1 X125.000 Y93.850 A737.0424
+G1 X125.000 Y94.300 A737.0573
+G1 X94.300 Y125.000 A738.4900
+G1 X94.750 Y125.000 A738.5048
+G1 X125.000 Y94.750 A739.9166
+G1 X125.000 Y95.200 A739.9314
+G1 X95.200 Y125.000 A741.3222
+G1 X95.650 Y125.000 A741.3370
+G1 X125.000 Y95.650 A742.7068
+G1 X125.000 Y96.100 A742.7216
+G1 X96.100 Y125.000 A744.0703
+G1 X96.550 Y125.000 A744.0852
+G1 X125.000 Y96.550 A745.4129
+G1 X125.000 Y97.000 A745.4278
+G1 X97.000 Y125.000 A746.7345
+G1 X97.450 Y125.000 A746.7494
+G1 X125.000 Y97.450 A748.0351
+G1 X125.000 Y97.900 A748.0499
+G1 X97.900 Y125.000 A749.3147
+G1 X98.350 Y125.000 A749.3295
+G1 X125.000 Y98.350 A750.5733
+G1 X125.000 Y98.800 A750.5881
+G1 X98.800 Y125.000 A751.8108
+G1 X99.250 Y125.000 A751.8257
+G1 X125.000 Y99.250 A753.0274
+G1 X125.000 Y99.700 A753.0423
+G1 X99.700 Y125.000 A754.2230
+G1 X100.150 Y125.000 A754.2378
+G1 X125.000 Y100.150 A755.3976
+G1 X125.000 Y100.600 A755.4124
+G1 X100.600 Y125.000 A756.5511
+G1 X101.050 Y125.000 A756.5660
+G1 X125.000 Y101.050 A757.6837
+G1 X125.000 Y101.500 A757.6986
+G1 X101.500 Y125.000 A758.7953
+G1 X101.950 Y125.000 A758.8101
+G1 X125.000 Y101.950 A759.8859
+G1 X125.000 Y102.400 A759.9007
+G1 X102.400 Y125.000 A760.9554
+G1 X102.850 Y125.000 A760.9703
+G1 X125.000 Y102.850 A762.0040
+G1 X125.000 Y103.300 A762.0189
+G1 X103.300 Y125.000 A763.0316
+G1 X103.750 Y125.000 A763.0464
+G1 X125.000 Y103.750 A764.0381
+G1 X125.000 Y104.200 A764.0530
+G1 X104.200 Y125.000 A765.0237
+G1 X104.650 Y125.000 A765.0386
+G1 X125.000 Y104.650 A765.9883
+G1 X125.000 Y105.100 A766.0031
+G1 X105.100 Y125.000 A766.9318
+G1 X105.550 Y125.000 A766.9467
+G1 X125.000 Y105.550 A767.8544
+G1 X125.000 Y106.000 A767.8692
+G1 X106.000 Y125.000 A768.7560
+G1 X106.450 Y125.000 A768.7708
+G1 X125.000 Y106.450 A769.6365
+G1 X125.000 Y106.900 A769.6514
+G1 X106.900 Y125.000 A770.4961
+G1 X107.350 Y125.000 A770.5109
+G1 X125.000 Y107.350 A771.3346
+G1 X125.000 Y107.800 A771.3495
+G1 X107.800 Y125.000 A772.1522
+G1 X108.250 Y125.000 A772.1670
+G1 X125.000 Y108.250 A772.9488
+G1 X125.000 Y108.700 A772.9636
+G1 X108.700 Y125.000 A773.7243
+G1 X109.150 Y125.000 A773.7392
+G1 X125.000 Y109.150 A774.4789
+G1 X125.000 Y109.600 A774.4937
+G1 X109.600 Y125.000 A775.2124
+G1 X110.050 Y125.000 A775.2273
+G1 X125.000 Y110.050 A775.9250
+G1 X125.000 Y110.500 A775.9398
+G1 X110.500 Y125.000 A776.6165
+G1 X110.950 Y125.000 A776.6314
+G1 X125.000 Y110.950 A777.2871
+G1 X125.000 Y111.400 A777.3019
+G1 X111.400 Y125.000 A777.9366
+G1 X111.850 Y125.000 A777.9515
+G1 X125.000 Y111.850 A778.5652
+G1 X125.000 Y112.300 A778.5800
+G1 X112.300 Y125.000 A779.1727
+G1 X112.750 Y125.000 A779.1876
+G1 X125.000 Y112.750 A779.7593
+G1 X125.000 Y113.200 A779.7741
+G1 X113.200 Y125.000 A780.3248
+G1 X113.650 Y125.000 A780.3397
+G1 X125.000 Y113.650 A780.8693
+G1 X125.000 Y114.100 A780.8842
+G1 X114.100 Y125.000 A781.3929
+G1 X114.550 Y125.000 A781.4077
+G1 X125.000 Y114.550 A781.8954
+G1 X125.000 Y115.000 A781.9103
+G1 X115.000 Y125.000 A782.3770
+G1 X115.450 Y125.000 A782.3918
+G1 X125.000 Y115.450 A782.8375
+G1 X125.000 Y115.900 A782.8524
+G1 X115.900 Y125.000 A783.2770
+G1 X116.350 Y125.000 A783.2919
+G1 X125.000 Y116.350 A783.6956
+G1 X125.000 Y116.800 A783.7104
+G1 X116.800 Y125.000 A784.0931
+G1 X117.250 Y125.000 A784.1080
+G1 X125.000 Y117.250 A784.4697
+G1 X125.000 Y117.700 A784.4845
+G1 X117.700 Y125.000 A784.8252
+G1 X118.150 Y125.000 A784.8400
+G1 X125.000 Y118.150 A785.1597
+G1 X125.000 Y118.600 A785.1746
+G1 X118.600 Y125.000 A785.4733
+G1 X119.050 Y125.000 A785.4881
+G1 X125.000 Y119.050 A785.7658
+G1 X125.000 Y119.500 A785.7806
+G1 X119.500 Y125.000 A786.0373
+G1 X119.950 Y125.000 A786.0522
+G1 X125.000 Y119.950 A786.2878
+G1 X125.000 Y120.400 A786.3027
+G1 X120.400 Y125.000 A786.5174
+G1 X120.850 Y125.000 A786.5322
+G1 X125.000 Y120.850 A786.7259
+G1 X125.000 Y121.300 A786.7407
+G1 X121.300 Y125.000 A786.9134
+G1 X121.750 Y125.000 A786.9283
+G1 X125.000 Y121.750 A787.0799
+G1 X125.000 Y122.200 A787.0948
+G1 X122.200 Y125.000 A787.2255
+G1 X122.650 Y125.000 A787.2403
+G1 X125.000 Y122.650 A787.3500
+G1 X125.000 Y123.100 A787.3648
+G1 X123.100 Y125.000 A787.4535
+G1 X123.550 Y125.000 A787.4684
+G1 X125.000 Y123.550 A787.5360
+G1 X125.000 Y124.000 A787.5509
+G1 X124.000 Y125.000 A787.5976
+G1 X124.450 Y125.000 A787.6124
+G1 X125.000 Y124.450 A787.6381
+G1 X125.000 Y124.900 A787.6529
+G1 X124.900 Y125.000 A787.6576
+G0 Z0.90
+G1 A786.6576 F2400
+G0 X125.000 Y75.450
+G1 A787.6576 F2400
+G1 F4800
+G1 X124.550 Y75.000 A787.6786
+G1 X124.100 Y75.000 A787.6934
+G1 X125.000 Y75.900 A787.7354
+G1 X125.000 Y76.350 A787.7503
+G1 X123.650 Y75.000 A787.8133
+G1 X123.200 Y75.000 A787.8281
+G1 X125.000 Y76.800 A787.9122
+G1 X125.000 Y77.250 A787.9270
+G1 X122.750 Y75.000 A788.0320
+G1 X122.300 Y75.000 A788.0469
+G1 X125.000 Y77.700 A788.1729
+G1 X125.000 Y78.150 A788.1877
+G1 X121.850 Y75.000 A788.3347
+G1 X121.400 Y75.000 A788.3496
+G1 X125.000 Y78.600 A788.5176
+G1 X125.000 Y79.050 A788.5324
+G1 X120.950 Y75.000 A788.7214
+G1 X120.500 Y75.000 A788.7363
+G1 X125.000 Y79.500 A788.9463
+G1 X125.000 Y79.950 A788.9611
+G1 X120.050 Y75.000 A789.1922
+G1 X119.600 Y75.000 A789.2070
+G1 X125.000 Y80.400 A789.4590
+G1 X125.000 Y80.850 A789.4739
+G1 X119.150 Y75.000 A789.7469
+G1 X118.700 Y75.000 A789.7617
+G1 X125.000 Y81.300 A790.0558
+G1 X125.000 Y81.750 A790.0706
+G1 X118.250 Y75.000 A790.3856
+G1 X117.800 Y75.000 A790.4005
+G1 X125.000 Y82.200 A790.7365
+G1 X125.000 Y82.650 A790.7513
+G1 X117.350 Y75.000 A791.1084
+G1 X116.900 Y75.000 A791.1232
+G1 X125.000 Y83.100 A791.5012
+G1 X125.000 Y83.550 A791.5161
+G1 X116.450 Y75.000 A791.9151
+G1 X116.000 Y75.000 A791.9299
+G1 X125.000 Y84.000 A792.3500
+G1 X125.000 Y84.450 A792.3648
+G1 X115.550 Y75.000 A792.8058
+G1 X115.100 Y75.000 A792.8207
+G1 X125.000 Y84.900 A793.2827
+G1 X125.000 Y85.350 A793.2976
+G1 X114.650 Y75.000 A793.7806
+G1 X114.200 Y75.000 A793.7954
+G1 X125.000 Y85.800 A794.2995
+G1 X125.000 Y86.250 A794.3143
+G1 X113.750 Y75.000 A794.8393
+G1 X113.300 Y75.000 A794.8542
+G1 X125.000 Y86.700 A795.4002
+G1 X125.000 Y87.150 A795.4151
+G1 X112.850 Y75.000 A795.9821
+G1 X112.400 Y75.000 A795.9969
+G1 X125.000 Y87.600 A796.5850
+G1 X125.000 Y88.050 A796.5998
+G1 X111.950 Y75.000 A797.2089
+G1 X111.500 Y75.000 A797.2237
+G1 X125.000 Y88.500 A797.8537
+G1 X125.000 Y88.950 A797.8686
+G1 X111.050 Y75.000 A798.5196
+G1 X110.600 Y75.000 A798.5345
+G1 X125.000 Y89.400 A799.2065
+G1 X125.000 Y89.850 A799.2214
+G1 X110.150 Y75.000 A799.9144
+G1 X109.700 Y75.000 A799.9292
+G1 X125.000 Y90.300 A800.6433
+G1 X125.000 Y90.750 A800.6581
+G1 X109.250 Y75.000 A801.3932
+G1 X108.800 Y75.000 A801.4080
+G1 X125.000 Y91.200 A802.1641
+G1 X125.000 Y91.650 A802.1789
+G1 X108.350 Y75.000 A802.9559
+G1 X107.900 Y75.000 A802.9708
+G1 X125.000 Y92.100 A803.7688
+G1 X125.000 Y92.550 A803.7837
+G1 X107.450 Y75.000 A804.6027
+G1 X107.000 Y75.000 A804.6176
+G1 X125.000 Y93.000 A805.4576
+G1 X125.000 Y93.450 A805.4725
+G1 X106.550 Y75.000 A806.3335
+G1 X106.100 Y75.000 A806.3484
+G1 X125.000 Y93.900 A807.2304
+G1 X125.000 Y94.350 A807.2453
+G1 X105.650 Y75.000 A808.1483
+G1 X105.200 Y75.000 A808.1632
+G1 X125.000 Y94.800 A809.0872
+G1 X125.000 Y95.250 A809.1021
+G1 X104.750 Y75.000 A810.0471
+G1 X104.300 Y75.000 A810.0619
+G1 X125.000 Y95.700 A811.0280
+G1 X125.000 Y96.150 A811.0428
+G1 X103.850 Y75.000 A812.0299
+G1 X103.400 Y75.000 A812.0447
+G1 X125.000 Y96.600 A813.0528
+G1 X125.000 Y97.050 A813.0676
+G1 X102.950 Y75.000 A814.0967
+G1 X102.500 Y75.000 A814.1116
+G1 X125.000 Y97.500 A815.1616
+G1 X125.000 Y97.950 A815.1765
+G1 X102.050 Y75.000 A816.2475
+G1 X101.600 Y75.000 A816.2624
+G1 X125.000 Y98.400 A817.3544
+G1 X125.000 Y98.850 A817.3693
+G1 X101.150 Y75.000 A818.4823
+G1 X100.700 Y75.000 A818.4972
+G1 X125.000 Y99.300 A819.6312
+G1 X125.000 Y99.750 A819.6461
+G1 X100.250 Y75.000 A820.8011
+G1 X99.800 Y75.000 A820.8160
+G1 X125.000 Y100.200 A821.9920
+G1 X125.000 Y100.650 A822.0069
+G1 X99.350 Y75.000 A823.2040
+G1 X98.900 Y75.000 A823.2188
+G1 X125.000 Y101.100 A824.4369
+G1 X125.000 Y101.550 A824.4517
+G1 X98.450 Y75.000 A825.6908
+G1 X98.000 Y75.000 A825.7056
+G1 X125.000 Y102.000 A826.9657
+G1 X125.000 Y102.450 A826.9806
+G1 X97.550 Y75.000 A828.2616
+G1 X97.100 Y75.000 A828.2765
+G1 X125.000 Y102.900 A829.5785
+G1 X125.000 Y103.350 A829.5934
+G1 X96.650 Y75.000 A830.9164
+G1 X96.200 Y75.000 A830.9313
+G1 X125.000 Y103.800 A832.2754
+G1 X125.000 Y104.250 A832.2902
+G1 X95.750 Y75.000 A833.6553
+G1 X95.300 Y75.000 A833.6701
+G1 X125.000 Y104.700 A835.0562
+G1 X125.000 Y105.150 A835.0711
+G1 X94.850 Y75.000 A836.4781
+G1 X94.400 Y75.000 A836.4930
+G1 X125.000 Y105.600 A837.9211
+G1 X125.000 Y106.050 A837.9359
+G1 X93.950 Y75.000 A839.3850
+G1 X93.500 Y75.000 A839.3998
+G1 X125.000 Y106.500 A840.8699
+G1 X125.000 Y106.950 A840.8848
+G1 X93.050 Y75.000 A842.3758
+G1 X92.600 Y75.000 A842.3907
+G1 X125.000 Y107.400 A843.9028
+G1 X125.000 Y107.850 A843.9176
+G1 X92.150 Y75.000 A845.4507
+G1 X91.700 Y75.000 A845.4655
+G1 X125.000 Y108.300 A847.0196
+G1 X125.000 Y108.750 A847.0345
+G1 X91.250 Y75.000 A848.6095
+G1 X90.800 Y75.000 A848.6244
+G1 X125.000 Y109.200 A850.2205
+G1 X125.000 Y109.650 A850.2353
+G1 X90.350 Y75.000 A851.8524
+G1 X89.900 Y75.000 A851.8673
+G1 X125.000 Y110.100 A853.5053
+G1 X125.000 Y110.550 A853.5202
+G1 X89.450 Y75.000 A855.1793
+G1 X89.000 Y75.000 A855.1941
+G1 X125.000 Y111.000 A856.8742
+G1 X125.000 Y111.450 A856.8891
+G1 X88.550 Y75.000 A858.5901
+G1 X88.100 Y75.000 A858.6050
+G1 X125.000 Y111.900 A860.3271
+G1 X125.000 Y112.350 A860.3419
+G1 X87.650 Y75.000 A862.0850
+G1 X87.200 Y75.000 A862.0999
+G1 X125.000 Y112.800 A863.8640
+G1 X125.000 Y113.250 A863.8788
+G1 X86.750 Y75.000 A865.6639
+G1 X86.300 Y75.000 A865.6788
+G1 X125.000 Y113.700 A867.4848
+G1 X125.000 Y114.150 A867.4997
+G1 X85.850 Y75.000 A869.3268
+G1 X85.400 Y75.000 A869.3416
+G1 X125.000 Y114.600 A871.1897
+G1 X125.000 Y115.050 A871.2046
+G1 X84.950 Y75.000 A873.0737
+G1 X84.500 Y75.000 A873.0885
+G1 X125.000 Y115.500 A874.9786
+G1 X125.000 Y115.950 A874.9935
+G1 X84.050 Y75.000 A876.9046
+G1 X83.600 Y75.000 A876.9194
+G1 X125.000 Y116.400 A878.8515
+G1 X125.000 Y116.850 A878.8664
+G1 X83.150 Y75.000 A880.8195
+G1 X82.700 Y75.000 A880.8343
+G1 X125.000 Y117.300 A882.8084
+G1 X125.000 Y117.750 A882.8233
+G1 X82.250 Y75.000 A884.8184
+G1 X81.800 Y75.000 A884.8332
+G1 X125.000 Y118.200 A886.8493
+G1 X125.000 Y118.650 A886.8642
+G1 X81.350 Y75.000 A888.9013
+G1 X80.900 Y75.000 A888.9161
+G1 X125.000 Y119.100 A890.9742
+G1 X125.000 Y119.550 A890.9891
+G1 X80.450 Y75.000 A893.0682
+G1 X80.000 Y75.000 A893.0830
+G1 X125.000 Y120.000 A895.1832
+G1 X125.000 Y120.450 A895.1980
+G1 X79.550 Y75.000 A897.3191
+G1 X79.100 Y75.000 A897.3340
+G1 X125.000 Y120.900 A899.4761
+G1 X125.000 Y121.350 A899.4909
+G1 X78.650 Y75.000 A901.6540
+G1 X78.200 Y75.000 A901.6689
+G1 X125.000 Y121.800 A903.8530
+G1 X125.000 Y122.250 A903.8678
+G1 X77.750 Y75.000 A906.0730
+G1 X77.300 Y75.000 A906.0878
+G1 X125.000 Y122.700 A908.3139
+G1 X125.000 Y123.150 A908.3288
+G1 X76.850 Y75.000 A910.5759
+G1 X76.400 Y75.000 A910.5907
+G1 X125.000 Y123.600 A912.8588
+G1 X125.000 Y124.050 A912.8737
+G1 X75.950 Y75.000 A915.1628
+G1 X75.500 Y75.000 A915.1777
+G1 X125.000 Y124.500 A917.4878
+G1 X125.000 Y124.950 A917.5026
+G1 X75.050 Y75.000 A919.8337
+G1 X75.000 Y75.400 A919.8471
+G1 X124.600 Y125.000 A922.1618
+G1 X124.150 Y125.000 A922.1767
+G1 X75.000 Y75.850 A924.4705
+G1 X75.000 Y76.300 A924.4853
+G1 X123.700 Y125.000 A926.7581
+G1 X123.250 Y125.000 A926.7730
+G1 X75.000 Y76.750 A929.0247
+G1 X75.000 Y77.200 A929.0396
+G1 X122.800 Y125.000 A931.2704
+G1 X122.350 Y125.000 A931.2852
+G1 X75.000 Y77.650 A933.4950
+G1 X75.000 Y78.100 A933.5098
+G1 X121.900 Y125.000 A935.6986
+G1 X121.450 Y125.000 A935.7135
+G1 X75.000 Y78.550 A937.8813
+G1 X75.000 Y79.000 A937.8961
+G1 X121.000 Y125.000 A940.0429
+G1 X120.550 Y125.000 A940.0577
+G1 X75.000 Y79.450 A942.1835
+G1 X75.000 Y79.900 A942.1984
+G1 X120.100 Y125.000 A944.3031
+G1 X119.650 Y125.000 A944.3180
+G1 X75.000 Y80.350 A946.4017
+G1 X75.000 Y80.800 A946.4166
+G1 X119.200 Y125.000 A948.4794
+G1 X118.750 Y125.000 A948.4942
+G1 X75.000 Y81.250 A950.5360
+G1 X75.000 Y81.700 A950.5508
+G1 X118.300 Y125.000 A952.5716
+G1 X117.850 Y125.000 A952.5865
+G1 X75.000 Y82.150 A954.5862
+G1 X75.000 Y82.600 A954.6011
+G1 X117.400 Y125.000 A956.5798
+G1 X116.950 Y125.000 A956.5947
+G1 X75.000 Y83.050 A958.5525
+G1 X75.000 Y83.500 A958.5673
+G1 X116.500 Y125.000 A960.5041
+G1 X116.050 Y125.000 A960.5189
+G1 X75.000 Y83.950 A962.4347
+G1 X75.000 Y84.400 A962.4495
+G1 X115.600 Y125.000 A964.3443
+G1 X115.150 Y125.000 A964.3592
+G1 X75.000 Y84.850 A966.2329
+G1 X75.000 Y85.300 A966.2478
+G1 X114.700 Y125.000 A968.1005
+G1 X114.250 Y125.000 A968.1154
+G1 X75.000 Y85.750 A969.9471
+G1 X75.000 Y86.200 A969.9620
+G1 X113.800 Y125.000 A971.7727
+G1 X113.350 Y125.000 A971.7876
+G1 X75.000 Y86.650 A973.5774
+G1 X75.000 Y87.100 A973.5922
+G1 X112.900 Y125.000 A975.3610
+G1 X112.450 Y125.000 A975.3758
+G1 X75.000 Y87.550 A977.1236
+G1 X75.000 Y88.000 A977.1384
+G1 X112.000 Y125.000 A978.8652
+G1 X111.550 Y125.000 A978.8800
+G1 X75.000 Y88.450 A980.5858
+G1 X75.000 Y88.900 A980.6006
+G1 X111.100 Y125.000 A982.2854
+G1 X110.650 Y125.000 A982.3002
+G1 X75.000 Y89.350 A983.9640
+G1 X75.000 Y89.800 A983.9788
+G1 X110.200 Y125.000 A985.6216
+G1 X109.750 Y125.000 A985.6364
+G1 X75.000 Y90.250 A987.2582
+G1 X75.000 Y90.700 A987.2730
+G1 X109.300 Y125.000 A988.8738
+G1 X108.850 Y125.000 A988.8886
+G1 X75.000 Y91.150 A990.4684
+G1 X75.000 Y91.600 A990.4832
+G1 X108.400 Y125.000 A992.0420
+G1 X107.950 Y125.000 A992.0568
+G1 X75.000 Y92.050 A993.5946
+G1 X75.000 Y92.500 A993.6094
+G1 X107.500 Y125.000 A995.1262
+G1 X107.050 Y125.000 A995.1410
+G1 X75.000 Y92.950 A996.6368
+G1 X75.000 Y93.400 A996.6516
+G1 X106.600 Y125.000 A998.1263
+G1 X106.150 Y125.000 A998.1412
+G1 X75.000 Y93.850 A999.5949
+G1 X75.000 Y94.300 A999.6098
+G1 X105.700 Y125.000 A1001.0425
+G1 X105.250 Y125.000 A1001.0574
+G1 X75.000 Y94.750 A1002.4691
+G1 X75.000 Y95.200 A1002.4840
+G1 X104.800 Y125.000 A1003.8747
+G1 X104.350 Y125.000 A1003.8896
+G1 X75.000 Y95.650 A1005.2593
+G1 X75.000 Y96.100 A1005.2741
+G1 X103.900 Y125.000 A1006.6229
+G1 X103.450 Y125.000 A1006.6377
+G1 X75.000 Y96.550 A1007.9655
+G1 X75.000 Y97.000 A1007.9803
+G1 X103.000 Y125.000 A1009.2870
+G1 X102.550 Y125.000 A1009.3019
+G1 X75.000 Y97.450 A1010.5876
+G1 X75.000 Y97.900 A1010.6025
+G1 X102.100 Y125.000 A1011.8672
+G1 X101.650 Y125.000 A1011.8821
+G1 X75.000 Y98.350 A1013.1258
+G1 X75.000 Y98.800 A1013.1406
+G1 X101.200 Y125.000 A1014.3634
+G1 X100.750 Y125.000 A1014.3782
+G1 X75.000 Y99.250 A1015.5799
+G1 X75.000 Y99.700 A1015.5948
+G1 X100.300 Y125.000 A1016.7755
+G1 X99.850 Y125.000 A1016.7904
+G1 X75.000 Y100.150 A1017.9501
+G1 X75.000 Y100.600 A1017.9649
+G1 X99.400 Y125.000 A1019.1037
+G1 X98.950 Y125.000 A1019.1185
+G1 X75.000 Y101.050 A1020.2362
+G1 X75.000 Y101.500 A1020.2511
+G1 X98.500 Y125.000 A1021.3478
+G1 X98.050 Y125.000 A1021.3627
+G1 X75.000 Y101.950 A1022.4384
+G1 X75.000 Y102.400 A1022.4532
+G1 X97.600 Y125.000 A1023.5080
+G1 X97.150 Y125.000 A1023.5228
+G1 X75.000 Y102.850 A1024.5565
+G1 X75.000 Y103.300 A1024.5714
+G1 X96.700 Y125.000 A1025.5841
+G1 X96.250 Y125.000 A1025.5989
+G1 X75.000 Y103.750 A1026.5907
+G1 X75.000 Y104.200 A1026.6055
+G1 X95.800 Y125.000 A1027.5762
+G1 X95.350 Y125.000 A1027.5911
+G1 X75.000 Y104.650 A1028.5408
+G1 X75.000 Y105.100 A1028.5556
+G1 X94.900 Y125.000 A1029.4844
+G1 X94.450 Y125.000 A1029.4992
+G1 X75.000 Y105.550 A1030.4069
+G1 X75.000 Y106.000 A1030.4218
+G1 X94.000 Y125.000 A1031.3085
+G1 X93.550 Y125.000 A1031.3233
+G1 X75.000 Y106.450 A1032.1890
+G1 X75.000 Y106.900 A1032.2039
+G1 X93.100 Y125.000 A1033.0486
+G1 X92.650 Y125.000 A1033.0635
+G1 X75.000 Y107.350 A1033.8872
+G1 X75.000 Y107.800 A1033.9020
+G1 X92.200 Y125.000 A1034.7047
+G1 X91.750 Y125.000 A1034.7196
+G1 X75.000 Y108.250 A1035.5013
+G1 X75.000 Y108.700 A1035.5161
+G1 X91.300 Y125.000 A1036.2768
+G1 X90.850 Y125.000 A1036.2917
+G1 X75.000 Y109.150 A1037.0314
+G1 X75.000 Y109.600 A1037.0462
+G1 X90.400 Y125.000 A1037.7649
+G1 X89.950 Y125.000 A1037.7798
+G1 X75.000 Y110.050 A1038.4775
+G1 X75.000 Y110.500 A1038.4923
+G1 X89.500 Y125.000 A1039.1690
+G1 X89.050 Y125.000 A1039.1839
+G1 X75.000 Y110.950 A1039.8396
+G1 X75.000 Y111.400 A1039.8544
+G1 X88.600 Y125.000 A1040.4891
+G1 X88.150 Y125.000 A1040.5040
+G1 X75.000 Y111.850 A1041.1177
+G1 X75.000 Y112.300 A1041.1325
+G1 X87.700 Y125.000 A1041.7252
+G1 X87.250 Y125.000 A1041.7401
+G1 X75.000 Y112.750 A1042.3118
+G1 X75.000 Y113.200 A1042.3266
+G1 X86.800 Y125.000 A1042.8773
+G1 X86.350 Y125.000 A1042.8922
+G1 X75.000 Y113.650 A1043.4219
+G1 X75.000 Y114.100 A1043.4367
+G1 X85.900 Y125.000 A1043.9454
+G1 X85.450 Y125.000 A1043.9603
+G1 X75.000 Y114.550 A1044.4480
+G1 X75.000 Y115.000 A1044.4628
+G1 X85.000 Y125.000 A1044.9295
+G1 X84.550 Y125.000 A1044.9444
+G1 X75.000 Y115.450 A1045.3900
+G1 X75.000 Y115.900 A1045.4049
+G1 X84.100 Y125.000 A1045.8296
+G1 X83.650 Y125.000 A1045.8444
+G1 X75.000 Y116.350 A1046.2481
+G1 X75.000 Y116.800 A1046.2630
+G1 X83.200 Y125.000 A1046.6457
+G1 X82.750 Y125.000 A1046.6605
+G1 X75.000 Y117.250 A1047.0222
+G1 X75.000 Y117.700 A1047.0370
+G1 X82.300 Y125.000 A1047.3777
+G1 X81.850 Y125.000 A1047.3926
+G1 X75.000 Y118.150 A1047.7123
+G1 X75.000 Y118.600 A1047.7271
+G1 X81.400 Y125.000 A1048.0258
+G1 X80.950 Y125.000 A1048.0406
+G1 X75.000 Y119.050 A1048.3183
+G1 X75.000 Y119.500 A1048.3332
+G1 X80.500 Y125.000 A1048.5898
+G1 X80.050 Y125.000 A1048.6047
+G1 X75.000 Y119.950 A1048.8404
+G1 X75.000 Y120.400 A1048.8552
+G1 X79.600 Y125.000 A1049.0699
+G1 X79.150 Y125.000 A1049.0848
+G1 X75.000 Y120.850 A1049.2784
+G1 X75.000 Y121.300 A1049.2933
+G1 X78.700 Y125.000 A1049.4660
+G1 X78.250 Y125.000 A1049.4808
+G1 X75.000 Y121.750 A1049.6325
+G1 X75.000 Y122.200 A1049.6473
+G1 X77.800 Y125.000 A1049.7780
+G1 X77.350 Y125.000 A1049.7929
+G1 X75.000 Y122.650 A1049.9025
+G1 X75.000 Y123.100 A1049.9174
+G1 X76.900 Y125.000 A1050.0060
+G1 X76.450 Y125.000 A1050.0209
+G1 X75.000 Y123.550 A1050.0886
+G1 X75.000 Y124.000 A1050.1034
+G1 X76.000 Y125.000 A1050.1501
+G1 X75.550 Y125.000 A1050.1649
+G1 X75.000 Y124.450 A1050.1906
+G1 X75.000 Y124.900 A1050.2055
+G1 X75.100 Y125.000 A1050.2101
+G0 Z1.10
+G1 A1049.2101 F2400
+G0 X75.000 Y75.450
+G1 A1050.2101 F2400
+G1 F4800
+G1 X75.450 Y75.000 A1050.2311
+G1 X75.900 Y75.000 A1050.2460
+G1 X75.000 Y75.900 A1050.2880
+G1 X75.000 Y76.350 A1050.3028
+G1 X76.350 Y75.000 A1050.3658
+G1 X76.800 Y75.000 A1050.3807
+G1 X75.000 Y76.800 A1050.4647
+G1 X75.000 Y77.250 A1050.4795
+G1 X77.250 Y75.000 A1050.5845
+G1 X77.700 Y75.000 A1050.5994
+G1 X75.000 Y77.700 A1050.7254
+G1 X75.000 Y78.150 A1050.7402
+G1 X78.150 Y75.000 A1050.8872
+G1 X78.600 Y75.000 A1050.9021
+G1 X75.000 Y78.600 A1051.0701
+G1 X75.000 Y79.050 A1051.0850
+G1 X79.050 Y75.000 A1051.2740
+G1 X79.500 Y75.000 A1051.2888
+G1 X75.000 Y79.500 A1051.4988
+G1 X75.000 Y79.950 A1051.5137
+G1 X79.950 Y75.000 A1051.7447
+G1 X80.400 Y75.000 A1051.7595
+G1 X75.000 Y80.400 A1052.0116
+G1 X75.000 Y80.850 A1052.0264
+G1 X80.850 Y75.000 A1052.2994
+G1 X81.300 Y75.000 A1052.3143
+G1 X75.000 Y81.300 A1052.6083
+G1 X75.000 Y81.750 A1052.6231
+G1 X81.750 Y75.000 A1052.9381
+G1 X82.200 Y75.000 A1052.9530
+G1 X75.000 Y82.200 A1053.2890
+G1 X75.000 Y82.650 A1053.3039
+G1 X82.650 Y75.000 A1053.6609
+G1 X83.100 Y75.000 A1053.6757
+G1 X75.000 Y83.100 A1054.0538
+G1 X75.000 Y83.550 A1054.0686
+G1 X83.550 Y75.000 A1054.4676
+G1 X84.000 Y75.000 A1054.4825
+G1 X75.000 Y84.000 A1054.9025
+G1 X75.000 Y84.450 A1054.9173
+G1 X84.450 Y75.000 A1055.3584
+G1 X84.900 Y75.000 A1055.3732
+G1 X75.000 Y84.900 A1055.8352
+G1 X75.000 Y85.350 A1055.8501
+G1 X85.350 Y75.000 A1056.3331
+G1 X85.800 Y75.000 A1056.3480
+G1 X75.000 Y85.800 A1056.8520
+G1 X75.000 Y86.250 A1056.8668
+G1 X86.250 Y75.000 A1057.3919
+G1 X86.700 Y75.000 A1057.4067
+G1 X75.000 Y86.700 A1057.9527
+G1 X75.000 Y87.150 A1057.9676
+G1 X87.150 Y75.000 A1058.5346
+G1 X87.600 Y75.000 A1058.5495
+G1 X75.000 Y87.600 A1059.1375
+G1 X75.000 Y88.050 A1059.1524
+G1 X88.050 Y75.000 A1059.7614
+G1 X88.500 Y75.000 A1059.7762
+G1 X75.000 Y88.500 A1060.4063
+G1 X75.000 Y88.950 A1060.4211
+G1 X88.950 Y75.000 A1061.0722
+G1 X89.400 Y75.000 A1061.0870
+G1 X75.000 Y89.400 A1061.7590
+G1 X75.000 Y89.850 A1061.7739
+G1 X89.850 Y75.000 A1062.4669
+G1 X90.300 Y75.000 A1062.4818
+G1 X75.000 Y90.300 A1063.1958
+G1 X75.000 Y90.750 A1063.2107
+G1 X90.750 Y75.000 A1063.9457
+G1 X91.200 Y75.000 A1063.9605
+G1 X75.000 Y91.200 A1064.7166
+G1 X75.000 Y91.650 A1064.7314
+G1 X91.650 Y75.000 A1065.5085
+G1 X92.100 Y75.000 A1065.5233
+G1 X75.000 Y92.100 A1066.3214
+G1 X75.000 Y92.550 A1066.3362
+G1 X92.550 Y75.000 A1067.1553
+G1 X93.000 Y75.000 A1067.1701
+G1 X75.000 Y93.000 A1068.0101
+G1 X75.000 Y93.450 A1068.0250
+G1 X93.450 Y75.000 A1068.8860
+G1 X93.900 Y75.000 A1068.9009
+G1 X75.000 Y93.900 A1069.7829
+G1 X75.000 Y94.350 A1069.7978
+G1 X94.350 Y75.000 A1070.7008
+G1 X94.800 Y75.000 A1070.7157
+G1 X75.000 Y94.800 A1071.6397
+G1 X75.000 Y95.250 A1071.6546
+G1 X95.250 Y75.000 A1072.5996
+G1 X95.700 Y75.000 A1072.6145
+G1 X75.000 Y95.700 A1073.5805
+G1 X75.000 Y96.150 A1073.5954
+G1 X96.150 Y75.000 A1074.5824
+G1 X96.600 Y75.000 A1074.5973
+G1 X75.000 Y96.600 A1075.6053
+G1 X75.000 Y97.050 A1075.6202
+G1 X97.050 Y75.000 A1076.6492
+G1 X97.500 Y75.000 A1076.6641
+G1 X75.000 Y97.500 A1077.7141
+G1 X75.000 Y97.950 A1077.7290
+G1 X97.950 Y75.000 A1078.8000
+G1 X98.400 Y75.000 A1078.8149
+G1 X75.000 Y98.400 A1079.9069
+G1 X75.000 Y98.850 A1079.9218
+G1 X98.850 Y75.000 A1081.0349
+G1 X99.300 Y75.000 A1081.0497
+G1 X75.000 Y99.300 A1082.1838
+G1 X75.000 Y99.750 A1082.1986
+G1 X99.750 Y75.000 A1083.3537
+G1 X100.200 Y75.000 A1083.3685
+G1 X75.000 Y100.200 A1084.5446
+G1 X75.000 Y100.650 A1084.5594
+G1 X100.650 Y75.000 A1085.7565
+G1 X101.100 Y75.000 A1085.7713
+G1 X75.000 Y101.100 A1086.9894
+G1 X75.000 Y101.550 A1087.0043
+G1 X101.550 Y75.000 A1088.2433
+G1 X102.000 Y75.000 A1088.2582
+G1 X75.000 Y102.000 A1089.5182
+G1 X75.000 Y102.450 A1089.5331
+G1 X102.450 Y75.000 A1090.8141
+G1 X102.900 Y75.000 A1090.8290
+G1 X75.000 Y102.900 A1092.1311
+G1 X75.000 Y103.350 A1092.1459
+G1 X103.350 Y75.000 A1093.4690
+G1 X103.800 Y75.000 A1093.4838
+G1 X75.000 Y103.800 A1094.8279
+G1 X75.000 Y104.250 A1094.8427
+G1 X104.250 Y75.000 A1096.2078
+G1 X104.700 Y75.000 A1096.2227
+G1 X75.000 Y104.700 A1097.6087
+G1 X75.000 Y105.150 A1097.6236
+G1 X105.150 Y75.000 A1099.0307
+G1 X105.600 Y75.000 A1099.0455
+G1 X75.000 Y105.600 A1100.4736
+G1 X75.000 Y106.050 A1100.4884
+G1 X106.050 Y75.000 A1101.9375
+G1 X106.500 Y75.000 A1101.9524
+G1 X75.000 Y106.500 A1103.4224
+G1 X75.000 Y106.950 A1103.4373
+G1 X106.950 Y75.000 A1104.9284
+G1 X107.400 Y75.000 A1104.9432
+G1 X75.000 Y107.400 A1106.4553
+G1 X75.000 Y107.850 A1106.4701
+G1 X107.850 Y75.000 A1108.0032
+G1 X108.300 Y75.000 A1108.0181
+G1 X75.000 Y108.300 A1109.5721
+G1 X75.000 Y108.750 A1109.5870
+G1 X108.750 Y75.000 A1111.1621
+G1 X109.200 Y75.000 A1111.1769
+G1 X75.000 Y109.200 A1112.7730
+G1 X75.000 Y109.650 A1112.7879
+G1 X109.650 Y75.000 A1114.4049
+G1 X110.100 Y75.000 A1114.4198
+G1 X75.000 Y110.100 A1116.0579
+G1 X75.000 Y110.550 A1116.0727
+G1 X110.550 Y75.000 A1117.7318
+G1 X111.000 Y75.000 A1117.7467
+G1 X75.000 Y111.000 A1119.4267
+G1 X75.000 Y111.450 A1119.4416
+G1 X111.450 Y75.000 A1121.1427
+G1 X111.900 Y75.000 A1121.1575
+G1 X75.000 Y111.900 A1122.8796
+G1 X75.000 Y112.350 A1122.8945
+G1 X112.350 Y75.000 A1124.6376
+G1 X112.800 Y75.000 A1124.6524
+G1 X75.000 Y112.800 A1126.4165
+G1 X75.000 Y113.250 A1126.4313
+G1 X113.250 Y75.000 A1128.2164
+G1 X113.700 Y75.000 A1128.2313
+G1 X75.000 Y113.700 A1130.0374
+G1 X75.000 Y114.150 A1130.0522
+G1 X114.150 Y75.000 A1131.8793
+G1 X114.600 Y75.000 A1131.8942
+G1 X75.000 Y114.600 A1133.7423
+G1 X75.000 Y115.050 A1133.7571
+G1 X115.050 Y75.000 A1135.6262
+G1 X115.500 Y75.000 A1135.6411
+G1 X75.000 Y115.500 A1137.5312
+G1 X75.000 Y115.950 A1137.5460
+G1 X115.950 Y75.000 A1139.4571
+G1 X116.400 Y75.000 A1139.4720
+G1 X75.000 Y116.400 A1141.4041
+G1 X75.000 Y116.850 A1141.4189
+G1 X116.850 Y75.000 A1143.3720
+G1 X117.300 Y75.000 A1143.3869
+G1 X75.000 Y117.300 A1145.3610
+G1 X75.000 Y117.750 A1145.3758
+G1 X117.750 Y75.000 A1147.3709
+G1 X118.200 Y75.000 A1147.3858
+G1 X75.000 Y118.200 A1149.4019
+G1 X75.000 Y118.650 A1149.4167
+G1 X118.650 Y75.000 A1151.4538
+G1 X119.100 Y75.000 A1151.4687
+G1 X75.000 Y119.100 A1153.5268
+G1 X75.000 Y119.550 A1153.5416
+G1 X119.550 Y75.000 A1155.6207
+G1 X120.000 Y75.000 A1155.6356
+G1 X75.000 Y120.000 A1157.7357
+G1 X75.000 Y120.450 A1157.7505
+G1 X120.450 Y75.000 A1159.8716
+G1 X120.900 Y75.000 A1159.8865
+G1 X75.000 Y120.900 A1162.0286
+G1 X75.000 Y121.350 A1162.0434
+G1 X121.350 Y75.000 A1164.2066
+G1 X121.800 Y75.000 A1164.2214
+G1 X75.000 Y121.800 A1166.4055
+G1 X75.000 Y122.250 A1166.4204
+G1 X122.250 Y75.000 A1168.6255
+G1 X122.700 Y75.000 A1168.6403
+G1 X75.000 Y122.700 A1170.8664
+G1 X75.000 Y123.150 A1170.8813
+G1 X123.150 Y75.000 A1173.1284
+G1 X123.600 Y75.000 A1173.1433
+G1 X75.000 Y123.600 A1175.4114
+G1 X75.000 Y124.050 A1175.4262
+G1 X124.050 Y75.000 A1177.7153
+G1 X124.500 Y75.000 A1177.7302
+G1 X75.000 Y124.500 A1180.0403
+G1 X75.000 Y124.950 A1180.0552
+G1 X124.950 Y75.000 A1182.3863
+G1 X125.000 Y75.400 A1182.3996
+G1 X75.400 Y125.000 A1184.7144
+G1 X75.850 Y125.000 A1184.7292
+G1 X125.000 Y75.850 A1187.0230
+G1 X125.000 Y76.300 A1187.0379
+G1 X76.300 Y125.000 A1189.3106
+G1 X76.750 Y125.000 A1189.3255
+G1 X125.000 Y76.750 A1191.5773
+G1 X125.000 Y77.200 A1191.5921
+G1 X77.200 Y125.000 A1193.8229
+G1 X77.650 Y125.000 A1193.8377
+G1 X125.000 Y77.650 A1196.0475
+G1 X125.000 Y78.100 A1196.0624
+G1 X78.100 Y125.000 A1198.2512
+G1 X78.550 Y125.000 A1198.2660
+G1 X125.000 Y78.550 A1200.4338
+G1 X125.000 Y79.000 A1200.4486
+G1 X79.000 Y125.000 A1202.5954
+G1 X79.450 Y125.000 A1202.6103
+G1 X125.000 Y79.450 A1204.7360
+G1 X125.000 Y79.900 A1204.7509
+G1 X79.900 Y125.000 A1206.8557
+G1 X80.350 Y125.000 A1206.8705
+G1 X125.000 Y80.350 A1208.9543
+G1 X125.000 Y80.800 A1208.9691
+G1 X80.800 Y125.000 A1211.0319
+G1 X81.250 Y125.000 A1211.0468
+G1 X125.000 Y81.250 A1213.0885
+G1 X125.000 Y81.700 A1213.1034
+G1 X81.700 Y125.000 A1215.1241
+G1 X82.150 Y125.000 A1215.1390
+G1 X125.000 Y82.150 A1217.1388
+G1 X125.000 Y82.600 A1217.1536
+G1 X82.600 Y125.000 A1219.1324
+G1 X83.050 Y125.000 A1219.1472
+G1 X125.000 Y83.050 A1221.1050
+G1 X125.000 Y83.500 A1221.1198
+G1 X83.500 Y125.000 A1223.0566
+G1 X83.950 Y125.000 A1223.0715
+G1 X125.000 Y83.950 A1224.9872
+G1 X125.000 Y84.400 A1225.0021
+G1 X84.400 Y125.000 A1226.8968
+G1 X84.850 Y125.000 A1226.9117
+G1 X125.000 Y84.850 A1228.7854
+G1 X125.000 Y85.300 A1228.8003
+G1 X85.300 Y125.000 A1230.6531
+G1 X85.750 Y125.000 A1230.6679
+G1 X125.000 Y85.750 A1232.4997
+G1 X125.000 Y86.200 A1232.5145
+G1 X86.200 Y125.000 A1234.3253
+G1 X86.650 Y125.000 A1234.3401
+G1 X125.000 Y86.650 A1236.1299
+G1 X125.000 Y87.100 A1236.1447
+G1 X87.100 Y125.000 A1237.9135
+G1 X87.550 Y125.000 A1237.9283
+G1 X125.000 Y87.550 A1239.6761
+G1 X125.000 Y88.000 A1239.6910
+G1 X88.000 Y125.000 A1241.4177
+G1 X88.450 Y125.000 A1241.4326
+G1 X125.000 Y88.450 A1243.1383
+G1 X125.000 Y88.900 A1243.1532
+G1 X88.900 Y125.000 A1244.8379
+G1 X89.350 Y125.000 A1244.8528
+G1 X125.000 Y89.350 A1246.5165
+G1 X125.000 Y89.800 A1246.5314
+G1 X89.800 Y125.000 A1248.1741
+G1 X90.250 Y125.000 A1248.1890
+G1 X125.000 Y90.250 A1249.8107
+G1 X125.000 Y90.700 A1249.8256
+G1 X90.700 Y125.000 A1251.4263
+G1 X91.150 Y125.000 A1251.4412
+G1 X125.000 Y91.150 A1253.0209
+G1 X125.000 Y91.600 A1253.0358
+G1 X91.600 Y125.000 A1254.5945
+G1 X92.050 Y125.000 A1254.6094
+G1 X125.000 Y92.050 A1256.1471
+G1 X125.000 Y92.500 A1256.1619
+G1 X92.500 Y125.000 A1257.6787
+G1 X92.950 Y125.000 A1257.6935
+G1 X125.000 Y92.950 A1259.1893
+G1 X125.000 Y93.400 A1259.2041
+G1 X93.400 Y125.000 A1260.6789
+G1 X93.850 Y125.000 A1260.6937
+G1 X125.000 Y93.850 A1262.1475
+G1 X125.000 Y94.300 A1262.1623
+G1 X94.300 Y125.000 A1263.5951
+G1 X94.750 Y125.000 A1263.6099
+G1 X125.000 Y94.750 A1265.0216
+G1 X125.000 Y95.200 A1265.0365
+G1 X95.200 Y125.000 A1266.4272
+G1 X95.650 Y125.000 A1266.4421
+G1 X125.000 Y95.650 A1267.8118
+G1 X125.000 Y96.100 A1267.8267
+G1 X96.100 Y125.000 A1269.1754
+G1 X96.550 Y125.000 A1269.1903
+G1 X125.000 Y96.550 A1270.5180
+G1 X125.000 Y97.000 A1270.5328
+G1 X97.000 Y125.000 A1271.8396
+G1 X97.450 Y125.000 A1271.8544
+G1 X125.000 Y97.450 A1273.1402
+G1 X125.000 Y97.900 A1273.1550
+G1 X97.900 Y125.000 A1274.4197
+G1 X98.350 Y125.000 A1274.4346
+G1 X125.000 Y98.350 A1275.6783
+G1 X125.000 Y98.800 A1275.6932
+G1 X98.800 Y125.000 A1276.9159
+G1 X99.250 Y125.000 A1276.9307
+G1 X125.000 Y99.250 A1278.1325
+G1 X125.000 Y99.700 A1278.1473
+G1 X99.700 Y125.000 A1279.3281
+G1 X100.150 Y125.000 A1279.3429
+G1 X125.000 Y100.150 A1280.5026
+G1 X125.000 Y100.600 A1280.5175
+G1 X100.600 Y125.000 A1281.6562
+G1 X101.050 Y125.000 A1281.6711
+G1 X125.000 Y101.050 A1282.7888
+G1 X125.000 Y101.500 A1282.8036
+G1 X101.500 Y125.000 A1283.9003
+G1 X101.950 Y125.000 A1283.9152
+G1 X125.000 Y101.950 A1284.9909
+G1 X125.000 Y102.400 A1285.0058
+G1 X102.400 Y125.000 A1286.0605
+G1 X102.850 Y125.000 A1286.0753
+G1 X125.000 Y102.850 A1287.1091
+G1 X125.000 Y103.300 A1287.1239
+G1 X103.300 Y125.000 A1288.1366
+G1 X103.750 Y125.000 A1288.1515
+G1 X125.000 Y103.750 A1289.1432
+G1 X125.000 Y104.200 A1289.1580
+G1 X104.200 Y125.000 A1290.1288
+G1 X104.650 Y125.000 A1290.1436
+G1 X125.000 Y104.650 A1291.0933
+G1 X125.000 Y105.100 A1291.1082
+G1 X105.100 Y125.000 A1292.0369
+G1 X105.550 Y125.000 A1292.0517
+G1 X125.000 Y105.550 A1292.9595
+G1 X125.000 Y106.000 A1292.9743
+G1 X106.000 Y125.000 A1293.8610
+G1 X106.450 Y125.000 A1293.8759
+G1 X125.000 Y106.450 A1294.7416
+G1 X125.000 Y106.900 A1294.7564
+G1 X106.900 Y125.000 A1295.6011
+G1 X107.350 Y125.000 A1295.6160
+G1 X125.000 Y107.350 A1296.4397
+G1 X125.000 Y107.800 A1296.4545
+G1 X107.800 Y125.000 A1297.2573
+G1 X108.250 Y125.000 A1297.2721
+G1 X125.000 Y108.250 A1298.0538
+G1 X125.000 Y108.700 A1298.0687
+G1 X108.700 Y125.000 A1298.8294
+G1 X109.150 Y125.000 A1298.8442
+G1 X125.000 Y109.150 A1299.5839
+G1 X125.000 Y109.600 A1299.5988
+G1 X109.600 Y125.000 A1300.3175
+G1 X110.050 Y125.000 A1300.3323
+G1 X125.000 Y110.050 A1301.0300
+G1 X125.000 Y110.500 A1301.0449
+G1 X110.500 Y125.000 A1301.7216
+G1 X110.950 Y125.000 A1301.7364
+G1 X125.000 Y110.950 A1302.3921
+G1 X125.000 Y111.400 A1302.4070
+G1 X111.400 Y125.000 A1303.0417
+G1 X111.850 Y125.000 A1303.0565
+G1 X125.000 Y111.850 A1303.6702
+G1 X125.000 Y112.300 A1303.6851
+G1 X112.300 Y125.000 A1304.2778
+G1 X112.750 Y125.000 A1304.2926
+G1 X125.000 Y112.750 A1304.8643
+G1 X125.000 Y113.200 A1304.8792
+G1 X113.200 Y125.000 A1305.4299
+G1 X113.650 Y125.000 A1305.4447
+G1 X125.000 Y113.650 A1305.9744
+G1 X125.000 Y114.100 A1305.9893
+G1 X114.100 Y125.000 A1306.4979
+G1 X114.550 Y125.000 A1306.5128
+G1 X125.000 Y114.550 A1307.0005
+G1 X125.000 Y115.000 A1307.0153
+G1 X115.000 Y125.000 A1307.4820
+G1 X115.450 Y125.000 A1307.4969
+G1 X125.000 Y115.450 A1307.9426
+G1 X125.000 Y115.900 A1307.9574
+G1 X115.900 Y125.000 A1308.3821
+G1 X116.350 Y125.000 A1308.3970
+G1 X125.000 Y116.350 A1308.8006
+G1 X125.000 Y116.800 A1308.8155
+G1 X116.800 Y125.000 A1309.1982
+G1 X117.250 Y125.000 A1309.2130
+G1 X125.000 Y117.250 A1309.5747
+G1 X125.000 Y117.700 A1309.5896
+G1 X117.700 Y125.000 A1309.9303
+G1 X118.150 Y125.000 A1309.9451
+G1 X125.000 Y118.150 A1310.2648
+G1 X125.000 Y118.600 A1310.2796
+G1 X118.600 Y125.000 A1310.5783
+G1 X119.050 Y125.000 A1310.5932
+G1 X125.000 Y119.050 A1310.8708
+G1 X125.000 Y119.500 A1310.8857
+G1 X119.500 Y125.000 A1311.1424
+G1 X119.950 Y125.000 A1311.1572
+G1 X125.000 Y119.950 A1311.3929
+G1 X125.000 Y120.400 A1311.4078
+G1 X120.400 Y125.000 A1311.6224
+G1 X120.850 Y125.000 A1311.6373
+G1 X125.000 Y120.850 A1311.8310
+G1 X125.000 Y121.300 A1311.8458
+G1 X121.300 Y125.000 A1312.0185
+G1 X121.750 Y125.000 A1312.0333
+G1 X125.000 Y121.750 A1312.1850
+G1 X125.000 Y122.200 A1312.1999
+G1 X122.200 Y125.000 A1312.3305
+G1 X122.650 Y125.000 A1312.3454
+G1 X125.000 Y122.650 A1312.4551
+G1 X125.000 Y123.100 A1312.4699
+G1 X123.100 Y125.000 A1312.5586
+G1 X123.550 Y125.000 A1312.5734
+G1 X125.000 Y123.550 A1312.6411
+G1 X125.000 Y124.000 A1312.6559
+G1 X124.000 Y125.000 A1312.7026
+G1 X124.450 Y125.000 A1312.7175
+G1 X125.000 Y124.450 A1312.7431
+G1 X125.000 Y124.900 A1312.7580
+G1 X124.900 Y125.000 A1312.7626
+G0 Z1.30
+G1 A1311.7626 F2400
+G0 X125.000 Y75.450
+G1 A1312.7626 F2400
+G1 F4800
+G1 X124.550 Y75.000 A1312.7837
+G1 X124.100 Y75.000 A1312.7985
+G1 X125.000 Y75.900 A1312.8405
+G1 X125.000 Y76.350 A1312.8554
+G1 X123.650 Y75.000 A1312.9184
+G1 X123.200 Y75.000 A1312.9332
+G1 X125.000 Y76.800 A1313.0172
+G1 X125.000 Y77.250 A1313.0321
+G1 X122.750 Y75.000 A1313.1371
+G1 X122.300 Y75.000 A1313.1519
+G1 X125.000 Y77.700 A1313.2779
+G1 X125.000 Y78.150 A1313.2928
+G1 X121.850 Y75.000 A1313.4398
+G1 X121.400 Y75.000 A1313.4546
+G1 X125.000 Y78.600 A1313.6226
+G1 X125.000 Y79.050 A1313.6375
+G1 X120.950 Y75.000 A1313.8265
+G1 X120.500 Y75.000 A1313.8413
+G1 X125.000 Y79.500 A1314.0514
+G1 X125.000 Y79.950 A1314.0662
+G1 X120.050 Y75.000 A1314.2972
+G1 X119.600 Y75.000 A1314.3121
+G1 X125.000 Y80.400 A1314.5641
+G1 X125.000 Y80.850 A1314.5789
+G1 X119.150 Y75.000 A1314.8519
+G1 X118.700 Y75.000 A1314.8668
+G1 X125.000 Y81.300 A1315.1608
+G1 X125.000 Y81.750 A1315.1757
+G1 X118.250 Y75.000 A1315.4907
+G1 X117.800 Y75.000 A1315.5055
+G1 X125.000 Y82.200 A1315.8415
+G1 X125.000 Y82.650 A1315.8564
+G1 X117.350 Y75.000 A1316.2134
+G1 X116.900 Y75.000 A1316.2283
+G1 X125.000 Y83.100 A1316.6063
+G1 X125.000 Y83.550 A1316.6211
+G1 X116.450 Y75.000 A1317.0202
+G1 X116.000 Y75.000 A1317.0350
+G1 X125.000 Y84.000 A1317.4550
+G1 X125.000 Y84.450 A1317.4699
+G1 X115.550 Y75.000 A1317.9109
+G1 X115.100 Y75.000 A1317.9257
+G1 X125.000 Y84.900 A1318.3878
+G1 X125.000 Y85.350 A1318.4026
+G1 X114.650 Y75.000 A1318.8856
+G1 X114.200 Y75.000 A1318.9005
+G1 X125.000 Y85.800 A1319.4045
+G1 X125.000 Y86.250 A1319.4194
+G1 X113.750 Y75.000 A1319.9444
+G1 X113.300 Y75.000 A1319.9592
+G1 X125.000 Y86.700 A1320.5053
+G1 X125.000 Y87.150 A1320.5201
+G1 X112.850 Y75.000 A1321.0872
+G1 X112.400 Y75.000 A1321.1020
+G1 X125.000 Y87.600 A1321.6900
+G1 X125.000 Y88.050 A1321.7049
+G1 X111.950 Y75.000 A1322.3139
+G1 X111.500 Y75.000 A1322.3288
+G1 X125.000 Y88.500 A1322.9588
+G1 X125.000 Y88.950 A1322.9736
+G1 X111.050 Y75.000 A1323.6247
+G1 X110.600 Y75.000 A1323.6395
+G1 X125.000 Y89.400 A1324.3116
+G1 X125.000 Y89.850 A1324.3264
+G1 X110.150 Y75.000 A1325.0195
+G1 X109.700 Y75.000 A1325.0343
+G1 X125.000 Y90.300 A1325.7483
+G1 X125.000 Y90.750 A1325.7632
+G1 X109.250 Y75.000 A1326.4982
+G1 X108.800 Y75.000 A1326.5131
+G1 X125.000 Y91.200 A1327.2691
+G1 X125.000 Y91.650 A1327.2840
+G1 X108.350 Y75.000 A1328.0610
+G1 X107.900 Y75.000 A1328.0759
+G1 X125.000 Y92.100 A1328.8739
+G1 X125.000 Y92.550 A1328.8887
+G1 X107.450 Y75.000 A1329.7078
+G1 X107.000 Y75.000 A1329.7226
+G1 X125.000 Y93.000 A1330.5627
+G1 X125.000 Y93.450 A1330.5775
+G1 X106.550 Y75.000 A1331.4386
+G1 X106.100 Y75.000 A1331.4534
+G1 X125.000 Y93.900 A1332.3355
+G1 X125.000 Y94.350 A1332.3503
+G1 X105.650 Y75.000 A1333.2534
+G1 X105.200 Y75.000 A1333.2682
+G1 X125.000 Y94.800 A1334.1923
+G1 X125.000 Y95.250 A1334.2071
+G1 X104.750 Y75.000 A1335.1522
+G1 X104.300 Y75.000 A1335.1670
+G1 X125.000 Y95.700 A1336.1331
+G1 X125.000 Y96.150 A1336.1479
+G1 X103.850 Y75.000 A1337.1350
+G1 X103.400 Y75.000 A1337.1498
+G1 X125.000 Y96.600 A1338.1579
+G1 X125.000 Y97.050 A1338.1727
+G1 X102.950 Y75.000 A1339.2018
+G1 X102.500 Y75.000 A1339.2166
+G1 X125.000 Y97.500 A1340.2667
+G1 X125.000 Y97.950 A1340.2815
+G1 X102.050 Y75.000 A1341.3526
+G1 X101.600 Y75.000 A1341.3674
+G1 X125.000 Y98.400 A1342.4595
+G1 X125.000 Y98.850 A1342.4743
+G1 X101.150 Y75.000 A1343.5874
+G1 X100.700 Y75.000 A1343.6022
+G1 X125.000 Y99.300 A1344.7363
+G1 X125.000 Y99.750 A1344.7511
+G1 X100.250 Y75.000 A1345.9062
+G1 X99.800 Y75.000 A1345.9210
+G1 X125.000 Y100.200 A1347.0971
+G1 X125.000 Y100.650 A1347.1120
+G1 X99.350 Y75.000 A1348.3090
+G1 X98.900 Y75.000 A1348.3239
+G1 X125.000 Y101.100 A1349.5419
+G1 X125.000 Y101.550 A1349.5568
+G1 X98.450 Y75.000 A1350.7958
+G1 X98.000 Y75.000 A1350.8107
+G1 X125.000 Y102.000 A1352.0708
+G1 X125.000 Y102.450 A1352.0856
+G1 X97.550 Y75.000 A1353.3667
+G1 X97.100 Y75.000 A1353.3815
+G1 X125.000 Y102.900 A1354.6836
+G1 X125.000 Y103.350 A1354.6984
+G1 X96.650 Y75.000 A1356.0215
+G1 X96.200 Y75.000 A1356.0364
+G1 X125.000 Y103.800 A1357.3804
+G1 X125.000 Y104.250 A1357.3953
+G1 X95.750 Y75.000 A1358.7603
+G1 X95.300 Y75.000 A1358.7752
+G1 X125.000 Y104.700 A1360.1613
+G1 X125.000 Y105.150 A1360.1761
+G1 X94.850 Y75.000 A1361.5832
+G1 X94.400 Y75.000 A1361.5980
+G1 X125.000 Y105.600 A1363.0261
+G1 X125.000 Y106.050 A1363.0410
+G1 X93.950 Y75.000 A1364.4900
+G1 X93.500 Y75.000 A1364.5049
+G1 X125.000 Y106.500 A1365.9750
+G1 X125.000 Y106.950 A1365.9898
+G1 X93.050 Y75.000 A1367.4809
+G1 X92.600 Y75.000 A1367.4957
+G1 X125.000 Y107.400 A1369.0078
+G1 X125.000 Y107.850 A1369.0227
+G1 X92.150 Y75.000 A1370.5557
+G1 X91.700 Y75.000 A1370.5706
+G1 X125.000 Y108.300 A1372.1247
+G1 X125.000 Y108.750 A1372.1395
+G1 X91.250 Y75.000 A1373.7146
+G1 X90.800 Y75.000 A1373.7295
+G1 X125.000 Y109.200 A1375.3255
+G1 X125.000 Y109.650 A1375.3404
+G1 X90.350 Y75.000 A1376.9575
+G1 X89.900 Y75.000 A1376.9723
+G1 X125.000 Y110.100 A1378.6104
+G1 X125.000 Y110.550 A1378.6253
+G1 X89.450 Y75.000 A1380.2843
+G1 X89.000 Y75.000 A1380.2992
+G1 X125.000 Y111.000 A1381.9793
+G1 X125.000 Y111.450 A1381.9941
+G1 X88.550 Y75.000 A1383.6952
+G1 X88.100 Y75.000 A1383.7101
+G1 X125.000 Y111.900 A1385.4321
+G1 X125.000 Y112.350 A1385.4470
+G1 X87.650 Y75.000 A1387.1901
+G1 X87.200 Y75.000 A1387.2049
+G1 X125.000 Y112.800 A1388.9690
+G1 X125.000 Y113.250 A1388.9839
+G1 X86.750 Y75.000 A1390.7690
+G1 X86.300 Y75.000 A1390.7838
+G1 X125.000 Y113.700 A1392.5899
+G1 X125.000 Y114.150 A1392.6048
+G1 X85.850 Y75.000 A1394.4319
+G1 X85.400 Y75.000 A1394.4467
+G1 X125.000 Y114.600 A1396.2948
+G1 X125.000 Y115.050 A1396.3096
+G1 X84.950 Y75.000 A1398.1787
+G1 X84.500 Y75.000 A1398.1936
+G1 X125.000 Y115.500 A1400.0837
+G1 X125.000 Y115.950 A1400.0985
+G1 X84.050 Y75.000 A1402.0096
+G1 X83.600 Y75.000 A1402.0245
+G1 X125.000 Y116.400 A1403.9566
+G1 X125.000 Y116.850 A1403.9714
+G1 X83.150 Y75.000 A1405.9245
+G1 X82.700 Y75.000 A1405.9394
+G1 X125.000 Y117.300 A1407.9135
+G1 X125.000 Y117.750 A1407.9283
+G1 X82.250 Y75.000 A1409.9234
+G1 X81.800 Y75.000 A1409.9383
+G1 X125.000 Y118.200 A1411.9544
+G1 X125.000 Y118.650 A1411.9692
+G1 X81.350 Y75.000 A1414.0063
+G1 X80.900 Y75.000 A1414.0212
+G1 X125.000 Y119.100 A1416.0793
+G1 X125.000 Y119.550 A1416.0941
+G1 X80.450 Y75.000 A1418.1733
+G1 X80.000 Y75.000 A1418.1881
+G1 X125.000 Y120.000 A1420.2882
+G1 X125.000 Y120.450 A1420.3031
+G1 X79.550 Y75.000 A1422.4242
+G1 X79.100 Y75.000 A1422.4390
+G1 X125.000 Y120.900 A1424.5811
+G1 X125.000 Y121.350 A1424.5960
+G1 X78.650 Y75.000 A1426.7591
+G1 X78.200 Y75.000 A1426.7739
+G1 X125.000 Y121.800 A1428.9580
+G1 X125.000 Y122.250 A1428.9729
+G1 X77.750 Y75.000 A1431.1780
+G1 X77.300 Y75.000 A1431.1929
+G1 X125.000 Y122.700 A1433.4190
+G1 X125.000 Y123.150 A1433.4338
+G1 X76.850 Y75.000 A1435.6809
+G1 X76.400 Y75.000 A1435.6958
+G1 X125.000 Y123.600 A1437.9639
+G1 X125.000 Y124.050 A1437.9788
+G1 X75.950 Y75.000 A1440.2679
+G1 X75.500 Y75.000 A1440.2827
+G1 X125.000 Y124.500 A1442.5928
+G1 X125.000 Y124.950 A1442.6077
+G1 X75.050 Y75.000 A1444.9388
+G1 X75.000 Y75.400 A1444.9521
+G1 X124.600 Y125.000 A1447.2669
+G1 X124.150 Y125.000 A1447.2817
+G1 X75.000 Y75.850 A1449.5755
+G1 X75.000 Y76.300 A1449.5904
+G1 X123.700 Y125.000 A1451.8632
+G1 X123.250 Y125.000 A1451.8780
+G1 X75.000 Y76.750 A1454.1298
+G1 X75.000 Y77.200 A1454.1446
+G1 X122.800 Y125.000 A1456.3754
+G1 X122.350 Y125.000 A1456.3903
+G1 X75.000 Y77.650 A1458.6001
+G1 X75.000 Y78.100 A1458.6149
+G1 X121.900 Y125.000 A1460.8037
+G1 X121.450 Y125.000 A1460.8185
+G1 X75.000 Y78.550 A1462.9863
+G1 X75.000 Y79.000 A1463.0012
+G1 X121.000 Y125.000 A1465.1479
+G1 X120.550 Y125.000 A1465.1628
+G1 X75.000 Y79.450 A1467.2886
+G1 X75.000 Y79.900 A1467.3034
+G1 X120.100 Y125.000 A1469.4082
+G1 X119.650 Y125.000 A1469.4230
+G1 X75.000 Y80.350 A1471.5068
+G1 X75.000 Y80.800 A1471.5217
+G1 X119.200 Y125.000 A1473.5844
+G1 X118.750 Y125.000 A1473.5993
+G1 X75.000 Y81.250 A1475.6411
+G1 X75.000 Y81.700 A1475.6559
+G1 X118.300 Y125.000 A1477.6767
+G1 X117.850 Y125.000 A1477.6915
+G1 X75.000 Y82.150 A1479.6913
+G1 X75.000 Y82.600 A1479.7061
+G1 X117.400 Y125.000 A1481.6849
+G1 X116.950 Y125.000 A1481.6998
+G1 X75.000 Y83.050 A1483.6575
+G1 X75.000 Y83.500 A1483.6724
+G1 X116.500 Y125.000 A1485.6091
+G1 X116.050 Y125.000 A1485.6240
+G1 X75.000 Y83.950 A1487.5398
+G1 X75.000 Y84.400 A1487.5546
+G1 X115.600 Y125.000 A1489.4494
+G1 X115.150 Y125.000 A1489.4642
+G1 X75.000 Y84.850 A1491.3380
+G1 X75.000 Y85.300 A1491.3528
+G1 X114.700 Y125.000 A1493.2056
+G1 X114.250 Y125.000 A1493.2204
+G1 X75.000 Y85.750 A1495.0522
+G1 X75.000 Y86.200 A1495.0671
+G1 X113.800 Y125.000 A1496.8778
+G1 X113.350 Y125.000 A1496.8927
+G1 X75.000 Y86.650 A1498.6824
+G1 X75.000 Y87.100 A1498.6973
+G1 X112.900 Y125.000 A1500.4660
+G1 X112.450 Y125.000 A1500.4809
+G1 X75.000 Y87.550 A1502.2286
+G1 X75.000 Y88.000 A1502.2435
+G1 X112.000 Y125.000 A1503.9702
+G1 X111.550 Y125.000 A1503.9851
+G1 X75.000 Y88.450 A1505.6908
+G1 X75.000 Y88.900 A1505.7057
+G1 X111.100 Y125.000 A1507.3904
+G1 X110.650 Y125.000 A1507.4053
+G1 X75.000 Y89.350 A1509.0690
+G1 X75.000 Y89.800 A1509.0839
+G1 X110.200 Y125.000 A1510.7266
+G1 X109.750 Y125.000 A1510.7415
+G1 X75.000 Y90.250 A1512.3632
+G1 X75.000 Y90.700 A1512.3781
+G1 X109.300 Y125.000 A1513.9788
+G1 X108.850 Y125.000 A1513.9937
+G1 X75.000 Y91.150 A1515.5734
+G1 X75.000 Y91.600 A1515.5883
+G1 X108.400 Y125.000 A1517.1470
+G1 X107.950 Y125.000 A1517.1619
+G1 X75.000 Y92.050 A1518.6996
+G1 X75.000 Y92.500 A1518.7145
+G1 X107.500 Y125.000 A1520.2312
+G1 X107.050 Y125.000 A1520.2461
+G1 X75.000 Y92.950 A1521.7418
+G1 X75.000 Y93.400 A1521.7567
+G1 X106.600 Y125.000 A1523.2314
+G1 X106.150 Y125.000 A1523.2463
+G1 X75.000 Y93.850 A1524.7000
+G1 X75.000 Y94.300 A1524.7148
+G1 X105.700 Y125.000 A1526.1476
+G1 X105.250 Y125.000 A1526.1624
+G1 X75.000 Y94.750 A1527.5742
+G1 X75.000 Y95.200 A1527.5890
+G1 X104.800 Y125.000 A1528.9798
+G1 X104.350 Y125.000 A1528.9946
+G1 X75.000 Y95.650 A1530.3644
+G1 X75.000 Y96.100 A1530.3792
+G1 X103.900 Y125.000 A1531.7279
+G1 X103.450 Y125.000 A1531.7428
+G1 X75.000 Y96.550 A1533.0705
+G1 X75.000 Y97.000 A1533.0854
+G1 X103.000 Y125.000 A1534.3921
+G1 X102.550 Y125.000 A1534.4070
+G1 X75.000 Y97.450 A1535.6927
+G1 X75.000 Y97.900 A1535.7075
+G1 X102.100 Y125.000 A1536.9723
+G1 X101.650 Y125.000 A1536.9871
+G1 X75.000 Y98.350 A1538.2308
+G1 X75.000 Y98.800 A1538.2457
+G1 X101.200 Y125.000 A1539.4684
+G1 X100.750 Y125.000 A1539.4833
+G1 X75.000 Y99.250 A1540.6850
+G1 X75.000 Y99.700 A1540.6999
+G1 X100.300 Y125.000 A1541.8806
+G1 X99.850 Y125.000 A1541.8954
+G1 X75.000 Y100.150 A1543.0552
+G1 X75.000 Y100.600 A1543.0700
+G1 X99.400 Y125.000 A1544.2087
+G1 X98.950 Y125.000 A1544.2236
+G1 X75.000 Y101.050 A1545.3413
+G1 X75.000 Y101.500 A1545.3562
+G1 X98.500 Y125.000 A1546.4529
+G1 X98.050 Y125.000 A1546.4677
+G1 X75.000 Y101.950 A1547.5435
+G1 X75.000 Y102.400 A1547.5583
+G1 X97.600 Y125.000 A1548.6130
+G1 X97.150 Y125.000 A1548.6279
+G1 X75.000 Y102.850 A1549.6616
+G1 X75.000 Y103.300 A1549.6764
+G1 X96.700 Y125.000 A1550.6892
+G1 X96.250 Y125.000 A1550.7040
+G1 X75.000 Y103.750 A1551.6957
+G1 X75.000 Y104.200 A1551.7106
+G1 X95.800 Y125.000 A1552.6813
+G1 X95.350 Y125.000 A1552.6961
+G1 X75.000 Y104.650 A1553.6459
+G1 X75.000 Y105.100 A1553.6607
+G1 X94.900 Y125.000 A1554.5894
+G1 X94.450 Y125.000 A1554.6043
+G1 X75.000 Y105.550 A1555.5120
+G1 X75.000 Y106.000 A1555.5268
+G1 X94.000 Y125.000 A1556.4135
+G1 X93.550 Y125.000 A1556.4284
+G1 X75.000 Y106.450 A1557.2941
+G1 X75.000 Y106.900 A1557.3090
+G1 X93.100 Y125.000 A1558.1537
+G1 X92.650 Y125.000 A1558.1685
+G1 X75.000 Y107.350 A1558.9922
+G1 X75.000 Y107.800 A1559.0071
+G1 X92.200 Y125.000 A1559.8098
+G1 X91.750 Y125.000 A1559.8246
+G1 X75.000 Y108.250 A1560.6063
+G1 X75.000 Y108.700 A1560.6212
+G1 X91.300 Y125.000 A1561.3819
+G1 X90.850 Y125.000 A1561.3967
+G1 X75.000 Y109.150 A1562.1365
+G1 X75.000 Y109.600 A1562.1513
+G1 X90.400 Y125.000 A1562.8700
+G1 X89.950 Y125.000 A1562.8849
+G1 X75.000 Y110.050 A1563.5826
+G1 X75.000 Y110.500 A1563.5974
+G1 X89.500 Y125.000 A1564.2741
+G1 X89.050 Y125.000 A1564.2890
+G1 X75.000 Y110.950 A1564.9447
+G1 X75.000 Y111.400 A1564.9595
+G1 X88.600 Y125.000 A1565.5942
+G1 X88.150 Y125.000 A1565.6091
+G1 X75.000 Y111.850 A1566.2228
+G1 X75.000 Y112.300 A1566.2376
+G1 X87.700 Y125.000 A1566.8303
+G1 X87.250 Y125.000 A1566.8452
+G1 X75.000 Y112.750 A1567.4168
+G1 X75.000 Y113.200 A1567.4317
+G1 X86.800 Y125.000 A1567.9824
+G1 X86.350 Y125.000 A1567.9972
+G1 X75.000 Y113.650 A1568.5269
+G1 X75.000 Y114.100 A1568.5418
+G1 X85.900 Y125.000 A1569.0505
+G1 X85.450 Y125.000 A1569.0653
+G1 X75.000 Y114.550 A1569.5530
+G1 X75.000 Y115.000 A1569.5679
+G1 X85.000 Y125.000 A1570.0346
+G1 X84.550 Y125.000 A1570.0494
+G1 X75.000 Y115.450 A1570.4951
+G1 X75.000 Y115.900 A1570.5099
+G1 X84.100 Y125.000 A1570.9346
+G1 X83.650 Y125.000 A1570.9495
+G1 X75.000 Y116.350 A1571.3532
+G1 X75.000 Y116.800 A1571.3680
+G1 X83.200 Y125.000 A1571.7507
+G1 X82.750 Y125.000 A1571.7656
+G1 X75.000 Y117.250 A1572.1272
+G1 X75.000 Y117.700 A1572.1421
+G1 X82.300 Y125.000 A1572.4828
+G1 X81.850 Y125.000 A1572.4976
+G1 X75.000 Y118.150 A1572.8173
+G1 X75.000 Y118.600 A1572.8322
+G1 X81.400 Y125.000 A1573.1308
+G1 X80.950 Y125.000 A1573.1457
+G1 X75.000 Y119.050 A1573.4234
+G1 X75.000 Y119.500 A1573.4382
+G1 X80.500 Y125.000 A1573.6949
+G1 X80.050 Y125.000 A1573.7098
+G1 X75.000 Y119.950 A1573.9454
+G1 X75.000 Y120.400 A1573.9603
+G1 X79.600 Y125.000 A1574.1750
+G1 X79.150 Y125.000 A1574.1898
+G1 X75.000 Y120.850 A1574.3835
+G1 X75.000 Y121.300 A1574.3983
+G1 X78.700 Y125.000 A1574.5710
+G1 X78.250 Y125.000 A1574.5859
+G1 X75.000 Y121.750 A1574.7375
+G1 X75.000 Y122.200 A1574.7524
+G1 X77.800 Y125.000 A1574.8831
+G1 X77.350 Y125.000 A1574.8979
+G1 X75.000 Y122.650 A1575.0076
+G1 X75.000 Y123.100 A1575.0224
+G1 X76.900 Y125.000 A1575.1111
+G1 X76.450 Y125.000 A1575.1260
+G1 X75.000 Y123.550 A1575.1936
+G1 X75.000 Y124.000 A1575.2085
+G1 X76.000 Y125.000 A1575.2551
+G1 X75.550 Y125.000 A1575.2700
+G1 X75.000 Y124.450 A1575.2957
+G1 X75.000 Y124.900 A1575.3105
+G1 X75.100 Y125.000 A1575.3152
+G0 Z1.50
+G1 A1574.3152 F2400
+G0 X75.000 Y75.450
+G1 A1575.3152 F2400
+G1 F4800
+G1 X75.450 Y75.000 A1575.3362
+G1 X75.900 Y75.000 A1575.3510
+G1 X75.000 Y75.900 A1575.3930
+G1 X75.000 Y76.350 A1575.4079
+G1 X76.350 Y75.000 A1575.4709
+G1 X76.800 Y75.000 A1575.4857
+G1 X75.000 Y76.800 A1575.5697
+G1 X75.000 Y77.250 A1575.5846
+G1 X77.250 Y75.000 A1575.6896
+G1 X77.700 Y75.000 A1575.7044
+G1 X75.000 Y77.700 A1575.8305
+G1 X75.000 Y78.150 A1575.8453
+G1 X78.150 Y75.000 A1575.9923
+G1 X78.600 Y75.000 A1576.0072
+G1 X75.000 Y78.600 A1576.1752
+G1 X75.000 Y79.050 A1576.1900
+G1 X79.050 Y75.000 A1576.3790
+G1 X79.500 Y75.000 A1576.3939
+G1 X75.000 Y79.500 A1576.6039
+G1 X75.000 Y79.950 A1576.6187
+G1 X79.950 Y75.000 A1576.8498
+G1 X80.400 Y75.000 A1576.8646
+G1 X75.000 Y80.400 A1577.1166
+G1 X75.000 Y80.850 A1577.1315
+G1 X80.850 Y75.000 A1577.4045
+G1 X81.300 Y75.000 A1577.4193
+G1 X75.000 Y81.300 A1577.7133
+G1 X75.000 Y81.750 A1577.7282
+G1 X81.750 Y75.000 A1578.0432
+G1 X82.200 Y75.000 A1578.0581
+G1 X75.000 Y82.200 A1578.3941
+G1 X75.000 Y82.650 A1578.4089
+G1 X82.650 Y75.000 A1578.7659
+G1 X83.100 Y75.000 A1578.7808
+G1 X75.000 Y83.100 A1579.1588
+G1 X75.000 Y83.550 A1579.1737
+G1 X83.550 Y75.000 A1579.5727
+G1 X84.000 Y75.000 A1579.5875
+G1 X75.000 Y84.000 A1580.0076
+G1 X75.000 Y84.450 A1580.0224
+G1 X84.450 Y75.000 A1580.4634
+G1 X84.900 Y75.000 A1580.4783
+G1 X75.000 Y84.900 A1580.9403
+G1 X75.000 Y85.350 A1580.9552
+G1 X85.350 Y75.000 A1581.4382
+G1 X85.800 Y75.000 A1581.4530
+G1 X75.000 Y85.800 A1581.9571
+G1 X75.000 Y86.250 A1581.9719
+G1 X86.250 Y75.000 A1582.4969
+G1 X86.700 Y75.000 A1582.5118
+G1 X75.000 Y86.700 A1583.0578
+G1 X75.000 Y87.150 A1583.0727
+G1 X87.150 Y75.000 A1583.6397
+G1 X87.600 Y75.000 A1583.6545
+G1 X75.000 Y87.600 A1584.2426
+G1 X75.000 Y88.050 A1584.2574
+G1 X88.050 Y75.000 A1584.8664
+G1 X88.500 Y75.000 A1584.8813
+G1 X75.000 Y88.500 A1585.5113
+G1 X75.000 Y88.950 A1585.5262
+G1 X88.950 Y75.000 A1586.1772
+G1 X89.400 Y75.000 A1586.1921
+G1 X75.000 Y89.400 A1586.8641
+G1 X75.000 Y89.850 A1586.8789
+G1 X89.850 Y75.000 A1587.5720
+G1 X90.300 Y75.000 A1587.5868
+G1 X75.000 Y90.300 A1588.3009
+G1 X75.000 Y90.750 A1588.3157
+G1 X90.750 Y75.000 A1589.0508
+G1 X91.200 Y75.000 A1589.0656
+G1 X75.000 Y91.200 A1589.8216
+G1 X75.000 Y91.650 A1589.8365
+G1 X91.650 Y75.000 A1590.6135
+G1 X92.100 Y75.000 A1590.6284
+G1 X75.000 Y92.100 A1591.4264
+G1 X75.000 Y92.550 A1591.4413
+G1 X92.550 Y75.000 A1592.2603
+G1 X93.000 Y75.000 A1592.2752
+G1 X75.000 Y93.000 A1593.1152
+G1 X75.000 Y93.450 A1593.1301
+G1 X93.450 Y75.000 A1593.9911
+G1 X93.900 Y75.000 A1594.0060
+G1 X75.000 Y93.900 A1594.8880
+G1 X75.000 Y94.350 A1594.9028
+G1 X94.350 Y75.000 A1595.8059
+G1 X94.800 Y75.000 A1595.8207
+G1 X75.000 Y94.800 A1596.7448
+G1 X75.000 Y95.250 A1596.7596
+G1 X95.250 Y75.000 A1597.7047
+G1 X95.700 Y75.000 A1597.7195
+G1 X75.000 Y95.700 A1598.6856
+G1 X75.000 Y96.150 A1598.7004
+G1 X96.150 Y75.000 A1599.6875
+G1 X96.600 Y75.000 A1599.7023
+G1 X75.000 Y96.600 A1600.7104
+G1 X75.000 Y97.050 A1600.7252
+G1 X97.050 Y75.000 A1601.7543
+G1 X97.500 Y75.000 A1601.7691
+G1 X75.000 Y97.500 A1602.8192
+G1 X75.000 Y97.950 A1602.8340
+G1 X97.950 Y75.000 A1603.9051
+G1 X98.400 Y75.000 A1603.9200
+G1 X75.000 Y98.400 A1605.0120
+G1 X75.000 Y98.850 A1605.0269
+G1 X98.850 Y75.000 A1606.1399
+G1 X99.300 Y75.000 A1606.1548
+G1 X75.000 Y99.300 A1607.2888
+G1 X75.000 Y99.750 A1607.3037
+G1 X99.750 Y75.000 A1608.4587
+G1 X100.200 Y75.000 A1608.4736
+G1 X75.000 Y100.200 A1609.6496
+G1 X75.000 Y100.650 A1609.6645
+G1 X100.650 Y75.000 A1610.8616
+G1 X101.100 Y75.000 A1610.8764
+G1 X75.000 Y101.100 A1612.0945
+G1 X75.000 Y101.550 A1612.1093
+G1 X101.550 Y75.000 A1613.3484
+G1 X102.000 Y75.000 A1613.3632
+G1 X75.000 Y102.000 A1614.6233
+G1 X75.000 Y102.450 A1614.6381
+G1 X102.450 Y75.000 A1615.9192
+G1 X102.900 Y75.000 A1615.9341
+G1 X75.000 Y102.900 A1617.2361
+G1 X75.000 Y103.350 A1617.2510
+G1 X103.350 Y75.000 A1618.5740
+G1 X103.800 Y75.000 A1618.5889
+G1 X75.000 Y103.800 A1619.9330
+G1 X75.000 Y104.250 A1619.9478
+G1 X104.250 Y75.000 A1621.3129
+G1 X104.700 Y75.000 A1621.3277
+G1 X75.000 Y104.700 A1622.7138
+G1 X75.000 Y105.150 A1622.7286
+G1 X105.150 Y75.000 A1624.1357
+G1 X105.600 Y75.000 A1624.1506
+G1 X75.000 Y105.600 A1625.5786
+G1 X75.000 Y106.050 A1625.5935
+G1 X106.050 Y75.000 A1627.0426
+G1 X106.500 Y75.000 A1627.0574
+G1 X75.000 Y106.500 A1628.5275
+G1 X75.000 Y106.950 A1628.5423
+G1 X106.950 Y75.000 A1630.0334
+G1 X107.400 Y75.000 A1630.0483
+G1 X75.000 Y107.400 A1631.5603
+G1 X75.000 Y107.850 A1631.5752
+G1 X107.850 Y75.000 A1633.1083
+G1 X108.300 Y75.000 A1633.1231
+G1 X75.000 Y108.300 A1634.6772
+G1 X75.000 Y108.750 A1634.6921
+G1 X108.750 Y75.000 A1636.2671
+G1 X109.200 Y75.000 A1636.2820
+G1 X75.000 Y109.200 A1637.8781
+G1 X75.000 Y109.650 A1637.8929
+G1 X109.650 Y75.000 A1639.5100
+G1 X110.100 Y75.000 A1639.5248
+G1 X75.000 Y110.100 A1641.1629
+G1 X75.000 Y110.550 A1641.1778
+G1 X110.550 Y75.000 A1642.8369
+G1 X111.000 Y75.000 A1642.8517
+G1 X75.000 Y111.000 A1644.5318
+G1 X75.000 Y111.450 A1644.5467
+G1 X111.450 Y75.000 A1646.2477
+G1 X111.900 Y75.000 A1646.2626
+G1 X75.000 Y111.900 A1647.9847
+G1 X75.000 Y112.350 A1647.9995
+G1 X112.350 Y75.000 A1649.7426
+G1 X112.800 Y75.000 A1649.7575
+G1 X75.000 Y112.800 A1651.5216
+G1 X75.000 Y113.250 A1651.5364
+G1 X113.250 Y75.000 A1653.3215
+G1 X113.700 Y75.000 A1653.3363
+G1 X75.000 Y113.700 A1655.1424
+G1 X75.000 Y114.150 A1655.1573
+G1 X114.150 Y75.000 A1656.9844
+G1 X114.600 Y75.000 A1656.9992
+G1 X75.000 Y114.600 A1658.8473
+G1 X75.000 Y115.050 A1658.8622
+G1 X115.050 Y75.000 A1660.7313
+G1 X115.500 Y75.000 A1660.7461
+G1 X75.000 Y115.500 A1662.6362
+G1 X75.000 Y115.950 A1662.6511
+G1 X115.950 Y75.000 A1664.5622
+G1 X116.400 Y75.000 A1664.5770
+G1 X75.000 Y116.400 A1666.5091
+G1 X75.000 Y116.850 A1666.5240
+G1 X116.850 Y75.000 A1668.4771
+G1 X117.300 Y75.000 A1668.4919
+G1 X75.000 Y117.300 A1670.4660
+G1 X75.000 Y117.750 A1670.4809
+G1 X117.750 Y75.000 A1672.4760
+G1 X118.200 Y75.000 A1672.4908
+G1 X75.000 Y118.200 A1674.5069
+G1 X75.000 Y118.650 A1674.5218
+G1 X118.650 Y75.000 A1676.5589
+G1 X119.100 Y75.000 A1676.5737
+G1 X75.000 Y119.100 A1678.6318
+G1 X75.000 Y119.550 A1678.6467
+G1 X119.550 Y75.000 A1680.7258
+G1 X120.000 Y75.000 A1680.7406
+G1 X75.000 Y120.000 A1682.8407
+G1 X75.000 Y120.450 A1682.8556
+G1 X120.450 Y75.000 A1684.9767
+G1 X120.900 Y75.000 A1684.9915
+G1 X75.000 Y120.900 A1687.1337
+G1 X75.000 Y121.350 A1687.1485
+G1 X121.350 Y75.000 A1689.3116
+G1 X121.800 Y75.000 A1689.3265
+G1 X75.000 Y121.800 A1691.5106
+G1 X75.000 Y122.250 A1691.5254
+G1 X122.250 Y75.000 A1693.7305
+G1 X122.700 Y75.000 A1693.7454
+G1 X75.000 Y122.700 A1695.9715
+G1 X75.000 Y123.150 A1695.9864
+G1 X123.150 Y75.000 A1698.2335
+G1 X123.600 Y75.000 A1698.2483
+G1 X75.000 Y123.600 A1700.5164
+G1 X75.000 Y124.050 A1700.5313
+G1 X124.050 Y75.000 A1702.8204
+G1 X124.500 Y75.000 A1702.8353
+G1 X75.000 Y124.500 A1705.1454
+G1 X75.000 Y124.950 A1705.1602
+G1 X124.950 Y75.000 A1707.4913
+G1 X125.000 Y75.400 A1707.5046
+G1 X75.400 Y125.000 A1709.8194
+G1 X75.850 Y125.000 A1709.8343
+G1 X125.000 Y75.850 A1712.1281
+G1 X125.000 Y76.300 A1712.1429
+G1 X76.300 Y125.000 A1714.4157
+G1 X76.750 Y125.000 A1714.4305
+G1 X125.000 Y76.750 A1716.6823
+G1 X125.000 Y77.200 A1716.6972
+G1 X77.200 Y125.000 A1718.9280
+G1 X77.650 Y125.000 A1718.9428
+G1 X125.000 Y77.650 A1721.1526
+G1 X125.000 Y78.100 A1721.1674
+G1 X78.100 Y125.000 A1723.3562
+G1 X78.550 Y125.000 A1723.3711
+G1 X125.000 Y78.550 A1725.5388
+G1 X125.000 Y79.000 A1725.5537
+G1 X79.000 Y125.000 A1727.7005
+G1 X79.450 Y125.000 A1727.7153
+G1 X125.000 Y79.450 A1729.8411
+G1 X125.000 Y79.900 A1729.8559
+G1 X79.900 Y125.000 A1731.9607
+G1 X80.350 Y125.000 A1731.9756
+G1 X125.000 Y80.350 A1734.0593
+G1 X125.000 Y80.800 A1734.0742
+G1 X80.800 Y125.000 A1736.1370
+G1 X81.250 Y125.000 A1736.1518
+G1 X125.000 Y81.250 A1738.1936
+G1 X125.000 Y81.700 A1738.2084
+G1 X81.700 Y125.000 A1740.2292
+G1 X82.150 Y125.000 A1740.2441
+G1 X125.000 Y82.150 A1742.2438
+G1 X125.000 Y82.600 A1742.2587
+G1 X82.600 Y125.000 A1744.2374
+G1 X83.050 Y125.000 A1744.2523
+G1 X125.000 Y83.050 A1746.2101
+G1 X125.000 Y83.500 A1746.2249
+G1 X83.500 Y125.000 A1748.1617
+G1 X83.950 Y125.000 A1748.1765
+G1 X125.000 Y83.950 A1750.0923
+G1 X125.000 Y84.400 A1750.1071
+G1 X84.400 Y125.000 A1752.0019
+G1 X84.850 Y125.000 A1752.0167
+G1 X125.000 Y84.850 A1753.8905
+G1 X125.000 Y85.300 A1753.9054
+G1 X85.300 Y125.000 A1755.7581
+G1 X85.750 Y125.000 A1755.7730
+G1 X125.000 Y85.750 A1757.6047
+G1 X125.000 Y86.200 A1757.6196
+G1 X86.200 Y125.000 A1759.4303
+G1 X86.650 Y125.000 A1759.4452
+G1 X125.000 Y86.650 A1761.2349
+G1 X125.000 Y87.100 A1761.2498
+G1 X87.100 Y125.000 A1763.0186
+G1 X87.550 Y125.000 A1763.0334
+G1 X125.000 Y87.550 A1764.7812
+G1 X125.000 Y88.000 A1764.7960
+G1 X88.000 Y125.000 A1766.5228
+G1 X88.450 Y125.000 A1766.5376
+G1 X125.000 Y88.450 A1768.2434
+G1 X125.000 Y88.900 A1768.2582
+G1 X88.900 Y125.000 A1769.9430
+G1 X89.350 Y125.000 A1769.9578
+G1 X125.000 Y89.350 A1771.6216
+G1 X125.000 Y89.800 A1771.6364
+G1 X89.800 Y125.000 A1773.2792
+G1 X90.250 Y125.000 A1773.2940
+G1 X125.000 Y90.250 A1774.9158
+G1 X125.000 Y90.700 A1774.9306
+G1 X90.700 Y125.000 A1776.5314
+G1 X91.150 Y125.000 A1776.5462
+G1 X125.000 Y91.150 A1778.1260
+G1 X125.000 Y91.600 A1778.1408
+G1 X91.600 Y125.000 A1779.6996
+G1 X92.050 Y125.000 A1779.7144
+G1 X125.000 Y92.050 A1781.2522
+G1 X125.000 Y92.500 A1781.2670
+G1 X92.500 Y125.000 A1782.7838
+G1 X92.950 Y125.000 A1782.7986
+G1 X125.000 Y92.950 A1784.2943
+G1 X125.000 Y93.400 A1784.3092
+G1 X93.400 Y125.000 A1785.7839
+G1 X93.850 Y125.000 A1785.7988
+G1 X125.000 Y93.850 A1787.2525
+G1 X125.000 Y94.300 A1787.2674
+G1 X94.300 Y125.000 A1788.7001
+G1 X94.750 Y125.000 A1788.7150
+G1 X125.000 Y94.750 A1790.1267
+G1 X125.000 Y95.200 A1790.1416
+G1 X95.200 Y125.000 A1791.5323
+G1 X95.650 Y125.000 A1791.5471
+G1 X125.000 Y95.650 A1792.9169
+G1 X125.000 Y96.100 A1792.9317
+G1 X96.100 Y125.000 A1794.2805
+G1 X96.550 Y125.000 A1794.2953
+G1 X125.000 Y96.550 A1795.6231
+G1 X125.000 Y97.000 A1795.6379
+G1 X97.000 Y125.000 A1796.9446
+G1 X97.450 Y125.000 A1796.9595
+G1 X125.000 Y97.450 A1798.2452
+G1 X125.000 Y97.900 A1798.2601
+G1 X97.900 Y125.000 A1799.5248
+G1 X98.350 Y125.000 A1799.5396
+G1 X125.000 Y98.350 A1800.7834
+G1 X125.000 Y98.800 A1800.7982
+G1 X98.800 Y125.000 A1802.0210
+G1 X99.250 Y125.000 A1802.0358
+G1 X125.000 Y99.250 A1803.2375
+G1 X125.000 Y99.700 A1803.2524
+G1 X99.700 Y125.000 A1804.4331
+G1 X100.150 Y125.000 A1804.4480
+G1 X125.000 Y100.150 A1805.6077
+G1 X125.000 Y100.600 A1805.6225
+G1 X100.600 Y125.000 A1806.7613
+G1 X101.050 Y125.000 A1806.7761
+G1 X125.000 Y101.050 A1807.8938
+G1 X125.000 Y101.500 A1807.9087
+G1 X101.500 Y125.000 A1809.0054
+G1 X101.950 Y125.000 A1809.0203
+G1 X125.000 Y101.950 A1810.0960
+G1 X125.000 Y102.400 A1810.1108
+G1 X102.400 Y125.000 A1811.1656
+G1 X102.850 Y125.000 A1811.1804
+G1 X125.000 Y102.850 A1812.2141
+G1 X125.000 Y103.300 A1812.2290
+G1 X103.300 Y125.000 A1813.2417
+G1 X103.750 Y125.000 A1813.2565
+G1 X125.000 Y103.750 A1814.2483
+G1 X125.000 Y104.200 A1814.2631
+G1 X104.200 Y125.000 A1815.2338
+G1 X104.650 Y125.000 A1815.2487
+G1 X125.000 Y104.650 A1816.1984
+G1 X125.000 Y105.100 A1816.2132
+G1 X105.100 Y125.000 A1817.1420
+G1 X105.550 Y125.000 A1817.1568
+G1 X125.000 Y105.550 A1818.0645
+G1 X125.000 Y106.000 A1818.0794
+G1 X106.000 Y125.000 A1818.9661
+G1 X106.450 Y125.000 A1818.9809
+G1 X125.000 Y106.450 A1819.8466
+G1 X125.000 Y106.900 A1819.8615
+G1 X106.900 Y125.000 A1820.7062
+G1 X107.350 Y125.000 A1820.7210
+G1 X125.000 Y107.350 A1821.5448
+G1 X125.000 Y107.800 A1821.5596
+G1 X107.800 Y125.000 A1822.3623
+G1 X108.250 Y125.000 A1822.3772
+G1 X125.000 Y108.250 A1823.1589
+G1 X125.000 Y108.700 A1823.1737
+G1 X108.700 Y125.000 A1823.9344
+G1 X109.150 Y125.000 A1823.9493
+G1 X125.000 Y109.150 A1824.6890
+G1 X125.000 Y109.600 A1824.7038
+G1 X109.600 Y125.000 A1825.4225
+G1 X110.050 Y125.000 A1825.4374
+G1 X125.000 Y110.050 A1826.1351
+G1 X125.000 Y110.500 A1826.1499
+G1 X110.500 Y125.000 A1826.8266
+G1 X110.950 Y125.000 A1826.8415
+G1 X125.000 Y110.950 A1827.4972
+G1 X125.000 Y111.400 A1827.5120
+G1 X111.400 Y125.000 A1828.1467
+G1 X111.850 Y125.000 A1828.1616
+G1 X125.000 Y111.850 A1828.7753
+G1 X125.000 Y112.300 A1828.7901
+G1 X112.300 Y125.000 A1829.3828
+G1 X112.750 Y125.000 A1829.3977
+G1 X125.000 Y112.750 A1829.9694
+G1 X125.000 Y113.200 A1829.9842
+G1 X113.200 Y125.000 A1830.5349
+G1 X113.650 Y125.000 A1830.5498
+G1 X125.000 Y113.650 A1831.0795
+G1 X125.000 Y114.100 A1831.0943
+G1 X114.100 Y125.000 A1831.6030
+G1 X114.550 Y125.000 A1831.6179
+G1 X125.000 Y114.550 A1832.1055
+G1 X125.000 Y115.000 A1832.1204
+G1 X115.000 Y125.000 A1832.5871
+G1 X115.450 Y125.000 A1832.6019
+G1 X125.000 Y115.450 A1833.0476
+G1 X125.000 Y115.900 A1833.0625
+G1 X115.900 Y125.000 A1833.4872
+G1 X116.350 Y125.000 A1833.5020
+G1 X125.000 Y116.350 A1833.9057
+G1 X125.000 Y116.800 A1833.9206
+G1 X116.800 Y125.000 A1834.3032
+G1 X117.250 Y125.000 A1834.3181
+G1 X125.000 Y117.250 A1834.6798
+G1 X125.000 Y117.700 A1834.6946
+G1 X117.700 Y125.000 A1835.0353
+G1 X118.150 Y125.000 A1835.0502
+G1 X125.000 Y118.150 A1835.3698
+G1 X125.000 Y118.600 A1835.3847
+G1 X118.600 Y125.000 A1835.6834
+G1 X119.050 Y125.000 A1835.6982
+G1 X125.000 Y119.050 A1835.9759
+G1 X125.000 Y119.500 A1835.9908
+G1 X119.500 Y125.000 A1836.2474
+G1 X119.950 Y125.000 A1836.2623
+G1 X125.000 Y119.950 A1836.4980
+G1 X125.000 Y120.400 A1836.5128
+G1 X120.400 Y125.000 A1836.7275
+G1 X120.850 Y125.000 A1836.7423
+G1 X125.000 Y120.850 A1836.9360
+G1 X125.000 Y121.300 A1836.9509
+G1 X121.300 Y125.000 A1837.1235
+G1 X121.750 Y125.000 A1837.1384
+G1 X125.000 Y121.750 A1837.2901
+G1 X125.000 Y122.200 A1837.3049
+G1 X122.200 Y125.000 A1837.4356
+G1 X122.650 Y125.000 A1837.4504
+G1 X125.000 Y122.650 A1837.5601
+G1 X125.000 Y123.100 A1837.5750
+G1 X123.100 Y125.000 A1837.6636
+G1 X123.550 Y125.000 A1837.6785
+G1 X125.000 Y123.550 A1837.7462
+G1 X125.000 Y124.000 A1837.7610
+G1 X124.000 Y125.000 A1837.8077
+G1 X124.450 Y125.000 A1837.8225
+G1 X125.000 Y124.450 A1837.8482
+G1 X125.000 Y124.900 A1837.8630
+G1 X124.900 Y125.000 A1837.8677
+G0 Z1.70
+G1 A1836.8677 F2400
+G0 X125.000 Y75.450
+G1 A1837.8677 F2400
+G1 F4800
+G1 X124.550 Y75.000 A1837.8887
+G1 X124.100 Y75.000 A1837.9036
+G1 X125.000 Y75.900 A1837.9456
+G1 X125.000 Y76.350 A1837.9604
+G1 X123.650 Y75.000 A1838.0234
+G1 X123.200 Y75.000 A1838.0383
+G1 X125.000 Y76.800 A1838.1223
+G1 X125.000 Y77.250 A1838.1371
+G1 X122.750 Y75.000 A1838.2421
+G1 X122.300 Y75.000 A1838.2570
+G1 X125.000 Y77.700 A1838.3830
+G1 X125.000 Y78.150 A1838.3978
+G1 X121.850 Y75.000 A1838.5448
+G1 X121.400 Y75.000 A1838.5597
+G1 X125.000 Y78.600 A1838.7277
+G1 X125.000 Y79.050 A1838.7425
+G1 X120.950 Y75.000 A1838.9316
+G1 X120.500 Y75.000 A1838.9464
+G1 X125.000 Y79.500 A1839.1564
+G1 X125.000 Y79.950 A1839.1713
+G1 X120.050 Y75.000 A1839.4023
+G1 X119.600 Y75.000 A1839.4171
+G1 X125.000 Y80.400 A1839.6691
+G1 X125.000 Y80.850 A1839.6840
+G1 X119.150 Y75.000 A1839.9570
+G1 X118.700 Y75.000 A1839.9719
+G1 X125.000 Y81.300 A1840.2659
+G1 X125.000 Y81.750 A1840.2807
+G1 X118.250 Y75.000 A1840.5957
+G1 X117.800 Y75.000 A1840.6106
+G1 X125.000 Y82.200 A1840.9466
+G1 X125.000 Y82.650 A1840.9615
+G1 X117.350 Y75.000 A1841.3185
+G1 X116.900 Y75.000 A1841.3333
+G1 X125.000 Y83.100 A1841.7113
+G1 X125.000 Y83.550 A1841.7262
+G1 X116.450 Y75.000 A1842.1252
+G1 X116.000 Y75.000 A1842.1401
+G1 X125.000 Y84.000 A1842.5601
+G1 X125.000 Y84.450 A1842.5749
+G1 X115.550 Y75.000 A1843.0160
+G1 X115.100 Y75.000 A1843.0308
+G1 X125.000 Y84.900 A1843.4928
+G1 X125.000 Y85.350 A1843.5077
+G1 X114.650 Y75.000 A1843.9907
+G1 X114.200 Y75.000 A1844.0056
+G1 X125.000 Y85.800 A1844.5096
+G1 X125.000 Y86.250 A1844.5244
+G1 X113.750 Y75.000 A1845.0495
+G1 X113.300 Y75.000 A1845.0643
+G1 X125.000 Y86.700 A1845.6103
+G1 X125.000 Y87.150 A1845.6252
+G1 X112.850 Y75.000 A1846.1922
+G1 X112.400 Y75.000 A1846.2071
+G1 X125.000 Y87.600 A1846.7951
+G1 X125.000 Y88.050 A1846.8099
+G1 X111.950 Y75.000 A1847.4190
+G1 X111.500 Y75.000 A1847.4338
+G1 X125.000 Y88.500 A1848.0639
+G1 X125.000 Y88.950 A1848.0787
+G1 X111.050 Y75.000 A1848.7297
+G1 X110.600 Y75.000 A1848.7446
+G1 X125.000 Y89.400 A1849.4166
+G1 X125.000 Y89.850 A1849.4315
+G1 X110.150 Y75.000 A1850.1245
+G1 X109.700 Y75.000 A1850.1394
+G1 X125.000 Y90.300 A1850.8534
+G1 X125.000 Y90.750 A1850.8682
+G1 X109.250 Y75.000 A1851.6033
+G1 X108.800 Y75.000 A1851.6181
+G1 X125.000 Y91.200 A1852.3742
+G1 X125.000 Y91.650 A1852.3890
+G1 X108.350 Y75.000 A1853.1661
+G1 X107.900 Y75.000 A1853.1809
+G1 X125.000 Y92.100 A1853.9790
+G1 X125.000 Y92.550 A1853.9938
+G1 X107.450 Y75.000 A1854.8128
+G1 X107.000 Y75.000 A1854.8277
+G1 X125.000 Y93.000 A1855.6677
+G1 X125.000 Y93.450 A1855.6826
+G1 X106.550 Y75.000 A1856.5436
+G1 X106.100 Y75.000 A1856.5585
+G1 X125.000 Y93.900 A1857.4405
+G1 X125.000 Y94.350 A1857.4554
+G1 X105.650 Y75.000 A1858.3584
+G1 X105.200 Y75.000 A1858.3733
+G1 X125.000 Y94.800 A1859.2973
+G1 X125.000 Y95.250 A1859.3122
+G1 X104.750 Y75.000 A1860.2572
+G1 X104.300 Y75.000 A1860.2721
+G1 X125.000 Y95.700 A1861.2381
+G1 X125.000 Y96.150 A1861.2530
+G1 X103.850 Y75.000 A1862.2400
+G1 X103.400 Y75.000 A1862.2549
+G1 X125.000 Y96.600 A1863.2629
+G1 X125.000 Y97.050 A1863.2778
+G1 X102.950 Y75.000 A1864.3068
+G1 X102.500 Y75.000 A1864.3217
+G1 X125.000 Y97.500 A1865.3717
+G1 X125.000 Y97.950 A1865.3866
+G1 X102.050 Y75.000 A1866.4576
+G1 X101.600 Y75.000 A1866.4725
+G1 X125.000 Y98.400 A1867.5645
+G1 X125.000 Y98.850 A1867.5794
+G1 X101.150 Y75.000 A1868.6924
+G1 X100.700 Y75.000 A1868.7073
+G1 X125.000 Y99.300 A1869.8414
+G1 X125.000 Y99.750 A1869.8562
+G1 X100.250 Y75.000 A1871.0113
+G1 X99.800 Y75.000 A1871.0261
+G1 X125.000 Y100.200 A1872.2022
+G1 X125.000 Y100.650 A1872.2170
+G1 X99.350 Y75.000 A1873.4141
+G1 X98.900 Y75.000 A1873.4289
+G1 X125.000 Y101.100 A1874.6470
+G1 X125.000 Y101.550 A1874.6618
+G1 X98.450 Y75.000 A1875.9009
+G1 X98.000 Y75.000 A1875.9158
+G1 X125.000 Y102.000 A1877.1758
+G1 X125.000 Y102.450 A1877.1907
+G1 X97.550 Y75.000 A1878.4717
+G1 X97.100 Y75.000 A1878.4866
+G1 X125.000 Y102.900 A1879.7887
+G1 X125.000 Y103.350 A1879.8035
+G1 X96.650 Y75.000 A1881.1266
+G1 X96.200 Y75.000 A1881.1414
+G1 X125.000 Y103.800 A1882.4855
+G1 X125.000 Y104.250 A1882.5003
+G1 X95.750 Y75.000 A1883.8654
+G1 X95.300 Y75.000 A1883.8803
+G1 X125.000 Y104.700 A1885.2663
+G1 X125.000 Y105.150 A1885.2812
+G1 X94.850 Y75.000 A1886.6882
+G1 X94.400 Y75.000 A1886.7031
+G1 X125.000 Y105.600 A1888.1312
+G1 X125.000 Y106.050 A1888.1460
+G1 X93.950 Y75.000 A1889.5951
+G1 X93.500 Y75.000 A1889.6099
+G1 X125.000 Y106.500 A1891.0800
+G1 X125.000 Y106.950 A1891.0949
+G1 X93.050 Y75.000 A1892.5859
+G1 X92.600 Y75.000 A1892.6008
+G1 X125.000 Y107.400 A1894.1129
+G1 X125.000 Y107.850 A1894.1277
+G1 X92.150 Y75.000 A1895.6608
+G1 X91.700 Y75.000 A1895.6757
+G1 X125.000 Y108.300 A1897.2297
+G1 X125.000 Y108.750 A1897.2446
+G1 X91.250 Y75.000 A1898.8197
+G1 X90.800 Y75.000 A1898.8345
+G1 X125.000 Y109.200 A1900.4306
+G1 X125.000 Y109.650 A1900.4454
+G1 X90.350 Y75.000 A1902.0625
+G1 X89.900 Y75.000 A1902.0774
+G1 X125.000 Y110.100 A1903.7155
+G1 X125.000 Y110.550 A1903.7303
+G1 X89.450 Y75.000 A1905.3894
+G1 X89.000 Y75.000 A1905.4042
+G1 X125.000 Y111.000 A1907.0843
+G1 X125.000 Y111.450 A1907.0992
+G1 X88.550 Y75.000 A1908.8003
+G1 X88.100 Y75.000 A1908.8151
+G1 X125.000 Y111.900 A1910.5372
+G1 X125.000 Y112.350 A1910.5521
+G1 X87.650 Y75.000 A1912.2951
+G1 X87.200 Y75.000 A1912.3100
+G1 X125.000 Y112.800 A1914.0741
+G1 X125.000 Y113.250 A1914.0889
+G1 X86.750 Y75.000 A1915.8740
+G1 X86.300 Y75.000 A1915.8889
+G1 X125.000 Y113.700 A1917.6950
+G1 X125.000 Y114.150 A1917.7098
+G1 X85.850 Y75.000 A1919.5369
+G1 X85.400 Y75.000 A1919.5518
+G1 X125.000 Y114.600 A1921.3999
+G1 X125.000 Y115.050 A1921.4147
+G1 X84.950 Y75.000 A1923.2838
+G1 X84.500 Y75.000 A1923.2987
+G1 X125.000 Y115.500 A1925.1887
+G1 X125.000 Y115.950 A1925.2036
+G1 X84.050 Y75.000 A1927.1147
+G1 X83.600 Y75.000 A1927.1295
+G1 X125.000 Y116.400 A1929.0616
+G1 X125.000 Y116.850 A1929.0765
+G1 X83.150 Y75.000 A1931.0296
+G1 X82.700 Y75.000 A1931.0444
+G1 X125.000 Y117.300 A1933.0185
+G1 X125.000 Y117.750 A1933.0334
+G1 X82.250 Y75.000 A1935.0285
+G1 X81.800 Y75.000 A1935.0433
+G1 X125.000 Y118.200 A1937.0594
+G1 X125.000 Y118.650 A1937.0743
+G1 X81.350 Y75.000 A1939.1114
+G1 X80.900 Y75.000 A1939.1263
+G1 X125.000 Y119.100 A1941.1844
+G1 X125.000 Y119.550 A1941.1992
+G1 X80.450 Y75.000 A1943.2783
+G1 X80.000 Y75.000 A1943.2932
+G1 X125.000 Y120.000 A1945.3933
+G1 X125.000 Y120.450 A1945.4081
+G1 X79.550 Y75.000 A1947.5292
+G1 X79.100 Y75.000 A1947.5441
+G1 X125.000 Y120.900 A1949.6862
+G1 X125.000 Y121.350 A1949.7010
+G1 X78.650 Y75.000 A1951.8641
+G1 X78.200 Y75.000 A1951.8790
+G1 X125.000 Y121.800 A1954.0631
+G1 X125.000 Y122.250 A1954.0780
+G1 X77.750 Y75.000 A1956.2831
+G1 X77.300 Y75.000 A1956.2979
+G1 X125.000 Y122.700 A1958.5240
+G1 X125.000 Y123.150 A1958.5389
+G1 X76.850 Y75.000 A1960.7860
+G1 X76.400 Y75.000 A1960.8008
+G1 X125.000 Y123.600 A1963.0690
+G1 X125.000 Y124.050 A1963.0838
+G1 X75.950 Y75.000 A1965.3729
+G1 X75.500 Y75.000 A1965.3878
+G1 X125.000 Y124.500 A1967.6979
+G1 X125.000 Y124.950 A1967.7128
+G1 X75.050 Y75.000 A1970.0439
+G1 X75.000 Y75.400 A1970.0572
+G1 X124.600 Y125.000 A1972.3720
+G1 X124.150 Y125.000 A1972.3868
+G1 X75.000 Y75.850 A1974.6806
+G1 X75.000 Y76.300 A1974.6954
+G1 X123.700 Y125.000 A1976.9682
+G1 X123.250 Y125.000 A1976.9831
+G1 X75.000 Y76.750 A1979.2349
+G1 X75.000 Y77.200 A1979.2497
+G1 X122.800 Y125.000 A1981.4805
+G1 X122.350 Y125.000 A1981.4953
+G1 X75.000 Y77.650 A1983.7051
+G1 X75.000 Y78.100 A1983.7200
+G1 X121.900 Y125.000 A1985.9087
+G1 X121.450 Y125.000 A1985.9236
+G1 X75.000 Y78.550 A1988.0914
+G1 X75.000 Y79.000 A1988.1062
+G1 X121.000 Y125.000 A1990.2530
+G1 X120.550 Y125.000 A1990.2678
+G1 X75.000 Y79.450 A1992.3936
+G1 X75.000 Y79.900 A1992.4085
+G1 X120.100 Y125.000 A1994.5132
+G1 X119.650 Y125.000 A1994.5281
+G1 X75.000 Y80.350 A1996.6119
+G1 X75.000 Y80.800 A1996.6267
+G1 X119.200 Y125.000 A1998.6895
+G1 X118.750 Y125.000 A1998.7043
+G1 X75.000 Y81.250 A2000.7461
+G1 X75.000 Y81.700 A2000.7610
+G1 X118.300 Y125.000 A2002.7817
+G1 X117.850 Y125.000 A2002.7966
+G1 X75.000 Y82.150 A2004.7963
+G1 X75.000 Y82.600 A2004.8112
+G1 X117.400 Y125.000 A2006.7900
+G1 X116.950 Y125.000 A2006.8048
+G1 X75.000 Y83.050 A2008.7626
+G1 X75.000 Y83.500 A2008.7774
+G1 X116.500 Y125.000 A2010.7142
+G1 X116.050 Y125.000 A2010.7290
+G1 X75.000 Y83.950 A2012.6448
+G1 X75.000 Y84.400 A2012.6597
+G1 X115.600 Y125.000 A2014.5544
+G1 X115.150 Y125.000 A2014.5693
+G1 X75.000 Y84.850 A2016.4430
+G1 X75.000 Y85.300 A2016.4579
+G1 X114.700 Y125.000 A2018.3107
+G1 X114.250 Y125.000 A2018.3255
+G1 X75.000 Y85.750 A2020.1573
+G1 X75.000 Y86.200 A2020.1721
+G1 X113.800 Y125.000 A2021.9829
+G1 X113.350 Y125.000 A2021.9977
+G1 X75.000 Y86.650 A2023.7875
+G1 X75.000 Y87.100 A2023.8023
+G1 X112.900 Y125.000 A2025.5711
+G1 X112.450 Y125.000 A2025.5859
+G1 X75.000 Y87.550 A2027.3337
+G1 X75.000 Y88.000 A2027.3485
+G1 X112.000 Y125.000 A2029.0753
+G1 X111.550 Y125.000 A2029.0901
+G1 X75.000 Y88.450 A2030.7959
+G1 X75.000 Y88.900 A2030.8107
+G1 X111.100 Y125.000 A2032.4955
+G1 X110.650 Y125.000 A2032.5104
+G1 X75.000 Y89.350 A2034.1741
+G1 X75.000 Y89.800 A2034.1890
+G1 X110.200 Y125.000 A2035.8317
+G1 X109.750 Y125.000 A2035.8466
+G1 X75.000 Y90.250 A2037.4683
+G1 X75.000 Y90.700 A2037.4832
+G1 X109.300 Y125.000 A2039.0839
+G1 X108.850 Y125.000 A2039.0988
+G1 X75.000 Y91.150 A2040.6785
+G1 X75.000 Y91.600 A2040.6933
+G1 X108.400 Y125.000 A2042.2521
+G1 X107.950 Y125.000 A2042.2669
+G1 X75.000 Y92.050 A2043.8047
+G1 X75.000 Y92.500 A2043.8195
+G1 X107.500 Y125.000 A2045.3363
+G1 X107.050 Y125.000 A2045.3511
+G1 X75.000 Y92.950 A2046.8469
+G1 X75.000 Y93.400 A2046.8617
+G1 X106.600 Y125.000 A2048.3365
+G1 X106.150 Y125.000 A2048.3513
+G1 X75.000 Y93.850 A2049.8051
+G1 X75.000 Y94.300 A2049.8199
+G1 X105.700 Y125.000 A2051.2526
+G1 X105.250 Y125.000 A2051.2675
+G1 X75.000 Y94.750 A2052.6792
+G1 X75.000 Y95.200 A2052.6941
+G1 X104.800 Y125.000 A2054.0848
+G1 X104.350 Y125.000 A2054.0997
+G1 X75.000 Y95.650 A2055.4694
+G1 X75.000 Y96.100 A2055.4843
+G1 X103.900 Y125.000 A2056.8330
+G1 X103.450 Y125.000 A2056.8478
+G1 X75.000 Y96.550 A2058.1756
+G1 X75.000 Y97.000 A2058.1904
+G1 X103.000 Y125.000 A2059.4972
+G1 X102.550 Y125.000 A2059.5120
+G1 X75.000 Y97.450 A2060.7977
+G1 X75.000 Y97.900 A2060.8126
+G1 X102.100 Y125.000 A2062.0773
+G1 X101.650 Y125.000 A2062.0922
+G1 X75.000 Y98.350 A2063.3359
+G1 X75.000 Y98.800 A2063.3508
+G1 X101.200 Y125.000 A2064.5735
+G1 X100.750 Y125.000 A2064.5883
+G1 X75.000 Y99.250 A2065.7901
+G1 X75.000 Y99.700 A2065.8049
+G1 X100.300 Y125.000 A2066.9856
+G1 X99.850 Y125.000 A2067.0005
+G1 X75.000 Y100.150 A2068.1602
+G1 X75.000 Y100.600 A2068.1751
+G1 X99.400 Y125.000 A2069.3138
+G1 X98.950 Y125.000 A2069.3286
+G1 X75.000 Y101.050 A2070.4464
+G1 X75.000 Y101.500 A2070.4612
+G1 X98.500 Y125.000 A2071.5579
+G1 X98.050 Y125.000 A2071.5728
+G1 X75.000 Y101.950 A2072.6485
+G1 X75.000 Y102.400 A2072.6634
+G1 X97.600 Y125.000 A2073.7181
+G1 X97.150 Y125.000 A2073.7329
+G1 X75.000 Y102.850 A2074.7667
+G1 X75.000 Y103.300 A2074.7815
+G1 X96.700 Y125.000 A2075.7942
+G1 X96.250 Y125.000 A2075.8091
+G1 X75.000 Y103.750 A2076.8008
+G1 X75.000 Y104.200 A2076.8156
+G1 X95.800 Y125.000 A2077.7864
+G1 X95.350 Y125.000 A2077.8012
+G1 X75.000 Y104.650 A2078.7509
+G1 X75.000 Y105.100 A2078.7658
+G1 X94.900 Y125.000 A2079.6945
+G1 X94.450 Y125.000 A2079.7093
+G1 X75.000 Y105.550 A2080.6170
+G1 X75.000 Y106.000 A2080.6319
+G1 X94.000 Y125.000 A2081.5186
+G1 X93.550 Y125.000 A2081.5335
+G1 X75.000 Y106.450 A2082.3992
+G1 X75.000 Y106.900 A2082.4140
+G1 X93.100 Y125.000 A2083.2587
+G1 X92.650 Y125.000 A2083.2736
+G1 X75.000 Y107.350 A2084.0973
+G1 X75.000 Y107.800 A2084.1121
+G1 X92.200 Y125.000 A2084.9148
+G1 X91.750 Y125.000 A2084.9297
+G1 X75.000 Y108.250 A2085.7114
+G1 X75.000 Y108.700 A2085.7263
+G1 X91.300 Y125.000 A2086.4870
+G1 X90.850 Y125.000 A2086.5018
+G1 X75.000 Y109.150 A2087.2415
+G1 X75.000 Y109.600 A2087.2564
+G1 X90.400 Y125.000 A2087.9751
+G1 X89.950 Y125.000 A2087.9899
+G1 X75.000 Y110.050 A2088.6876
+G1 X75.000 Y110.500 A2088.7025
+G1 X89.500 Y125.000 A2089.3792
+G1 X89.050 Y125.000 A2089.3940
+G1 X75.000 Y110.950 A2090.0497
+G1 X75.000 Y111.400 A2090.0646
+G1 X88.600 Y125.000 A2090.6993
+G1 X88.150 Y125.000 A2090.7141
+G1 X75.000 Y111.850 A2091.3278
+G1 X75.000 Y112.300 A2091.3427
+G1 X87.700 Y125.000 A2091.9354
+G1 X87.250 Y125.000 A2091.9502
+G1 X75.000 Y112.750 A2092.5219
+G1 X75.000 Y113.200 A2092.5368
+G1 X86.800 Y125.000 A2093.0875
+G1 X86.350 Y125.000 A2093.1023
+G1 X75.000 Y113.650 A2093.6320
+G1 X75.000 Y114.100 A2093.6468
+G1 X85.900 Y125.000 A2094.1555
+G1 X85.450 Y125.000 A2094.1704
+G1 X75.000 Y114.550 A2094.6581
+G1 X75.000 Y115.000 A2094.6729
+G1 X85.000 Y125.000 A2095.1396
+G1 X84.550 Y125.000 A2095.1545
+G1 X75.000 Y115.450 A2095.6002
+G1 X75.000 Y115.900 A2095.6150
+G1 X84.100 Y125.000 A2096.0397
+G1 X83.650 Y125.000 A2096.0545
+G1 X75.000 Y116.350 A2096.4582
+G1 X75.000 Y116.800 A2096.4731
+G1 X83.200 Y125.000 A2096.8558
+G1 X82.750 Y125.000 A2096.8706
+G1 X75.000 Y117.250 A2097.2323
+G1 X75.000 Y117.700 A2097.2472
+G1 X82.300 Y125.000 A2097.5878
+G1 X81.850 Y125.000 A2097.6027
+G1 X75.000 Y118.150 A2097.9224
+G1 X75.000 Y118.600 A2097.9372
+G1 X81.400 Y125.000 A2098.2359
+G1 X80.950 Y125.000 A2098.2508
+G1 X75.000 Y119.050 A2098.5284
+G1 X75.000 Y119.500 A2098.5433
+G1 X80.500 Y125.000 A2098.8000
+G1 X80.050 Y125.000 A2098.8148
+G1 X75.000 Y119.950 A2099.0505
+G1 X75.000 Y120.400 A2099.0653
+G1 X79.600 Y125.000 A2099.2800
+G1 X79.150 Y125.000 A2099.2949
+G1 X75.000 Y120.850 A2099.4885
+G1 X75.000 Y121.300 A2099.5034
+G1 X78.700 Y125.000 A2099.6761
+G1 X78.250 Y125.000 A2099.6909
+G1 X75.000 Y121.750 A2099.8426
+G1 X75.000 Y122.200 A2099.8574
+G1 X77.800 Y125.000 A2099.9881
+G1 X77.350 Y125.000 A2100.0030
+G1 X75.000 Y122.650 A2100.1126
+G1 X75.000 Y123.100 A2100.1275
+G1 X76.900 Y125.000 A2100.2162
+G1 X76.450 Y125.000 A2100.2310
+G1 X75.000 Y123.550 A2100.2987
+G1 X75.000 Y124.000 A2100.3135
+G1 X76.000 Y125.000 A2100.3602
+G1 X75.550 Y125.000 A2100.3751
+G1 X75.000 Y124.450 A2100.4007
+G1 X75.000 Y124.900 A2100.4156
+G1 X75.100 Y125.000 A2100.4202
+G0 Z1.90
+G1 A2099.4202 F2400
+G0 X75.000 Y75.450
+G1 A2100.4202 F2400
+G1 F4800
+G1 X75.450 Y75.000 A2100.4412
+G1 X75.900 Y75.000 A2100.4561
+G1 X75.000 Y75.900 A2100.4981
+G1 X75.000 Y76.350 A2100.5129
+G1 X76.350 Y75.000 A2100.5759
+G1 X76.800 Y75.000 A2100.5908
+G1 X75.000 Y76.800 A2100.6748
+G1 X75.000 Y77.250 A2100.6896
+G1 X77.250 Y75.000 A2100.7947
+G1 X77.700 Y75.000 A2100.8095
+G1 X75.000 Y77.700 A2100.9355
+G1 X75.000 Y78.150 A2100.9504
+G1 X78.150 Y75.000 A2101.0974
+G1 X78.600 Y75.000 A2101.1122
+G1 X75.000 Y78.600 A2101.2802
+G1 X75.000 Y79.050 A2101.2951
+G1 X79.050 Y75.000 A2101.4841
+G1 X79.500 Y75.000 A2101.4989
+G1 X75.000 Y79.500 A2101.7089
+G1 X75.000 Y79.950 A2101.7238
+G1 X79.950 Y75.000 A2101.9548
+G1 X80.400 Y75.000 A2101.9697
+G1 X75.000 Y80.400 A2102.2217
+G1 X75.000 Y80.850 A2102.2365
+G1 X80.850 Y75.000 A2102.5095
+G1 X81.300 Y75.000 A2102.5244
+G1 X75.000 Y81.300 A2102.8184
+G1 X75.000 Y81.750 A2102.8333
+G1 X81.750 Y75.000 A2103.1483
+G1 X82.200 Y75.000 A2103.1631
+G1 X75.000 Y82.200 A2103.4991
+G1 X75.000 Y82.650 A2103.5140
+G1 X82.650 Y75.000 A2103.8710
+G1 X83.100 Y75.000 A2103.8859
+G1 X75.000 Y83.100 A2104.2639
+G1 X75.000 Y83.550 A2104.2787
+G1 X83.550 Y75.000 A2104.6777
+G1 X84.000 Y75.000 A2104.6926
+G1 X75.000 Y84.000 A2105.1126
+G1 X75.000 Y84.450 A2105.1275
+G1 X84.450 Y75.000 A2105.5685
+G1 X84.900 Y75.000 A2105.5833
+G1 X75.000 Y84.900 A2106.0454
+G1 X75.000 Y85.350 A2106.0602
+G1 X85.350 Y75.000 A2106.5432
+G1 X85.800 Y75.000 A2106.5581
+G1 X75.000 Y85.800 A2107.0621
+G1 X75.000 Y86.250 A2107.0770
+G1 X86.250 Y75.000 A2107.6020
+G1 X86.700 Y75.000 A2107.6168
+G1 X75.000 Y86.700 A2108.1629
+G1 X75.000 Y87.150 A2108.1777
+G1 X87.150 Y75.000 A2108.7447
+G1 X87.600 Y75.000 A2108.7596
+G1 X75.000 Y87.600 A2109.3476
+G1 X75.000 Y88.050 A2109.3625
+G1 X88.050 Y75.000 A2109.9715
+G1 X88.500 Y75.000 A2109.9864
+G1 X75.000 Y88.500 A2110.6164
+G1 X75.000 Y88.950 A2110.6312
+G1 X88.950 Y75.000 A2111.2823
+G1 X89.400 Y75.000 A2111.2971
+G1 X75.000 Y89.400 A2111.9692
+G1 X75.000 Y89.850 A2111.9840
+G1 X89.850 Y75.000 A2112.6770
+G1 X90.300 Y75.000 A2112.6919
+G1 X75.000 Y90.300 A2113.4059
+G1 X75.000 Y90.750 A2113.4208
+G1 X90.750 Y75.000 A2114.1558
+G1 X91.200 Y75.000 A2114.1707
+G1 X75.000 Y91.200 A2114.9267
+G1 X75.000 Y91.650 A2114.9416
+G1 X91.650 Y75.000 A2115.7186
+G1 X92.100 Y75.000 A2115.7334
+G1 X75.000 Y92.100 A2116.5315
+G1 X75.000 Y92.550 A2116.5463
+G1 X92.550 Y75.000 A2117.3654
+G1 X93.000 Y75.000 A2117.3802
+G1 X75.000 Y93.000 A2118.2203
+G1 X75.000 Y93.450 A2118.2351
+G1 X93.450 Y75.000 A2119.0962
+G1 X93.900 Y75.000 A2119.1110
+G1 X75.000 Y93.900 A2119.9931
+G1 X75.000 Y94.350 A2120.0079
+G1 X94.350 Y75.000 A2120.9110
+G1 X94.800 Y75.000 A2120.9258
+G1 X75.000 Y94.800 A2121.8498
+G1 X75.000 Y95.250 A2121.8647
+G1 X95.250 Y75.000 A2122.8097
+G1 X95.700 Y75.000 A2122.8246
+G1 X75.000 Y95.700 A2123.7906
+G1 X75.000 Y96.150 A2123.8055
+G1 X96.150 Y75.000 A2124.7925
+G1 X96.600 Y75.000 A2124.8074
+G1 X75.000 Y96.600 A2125.8154
+G1 X75.000 Y97.050 A2125.8303
+G1 X97.050 Y75.000 A2126.8594
+G1 X97.500 Y75.000 A2126.8742
+G1 X75.000 Y97.500 A2127.9243
+G1 X75.000 Y97.950 A2127.9391
+G1 X97.950 Y75.000 A2129.0102
+G1 X98.400 Y75.000 A2129.0250
+G1 X75.000 Y98.400 A2130.1171
+G1 X75.000 Y98.850 A2130.1319
+G1 X98.850 Y75.000 A2131.2450
+G1 X99.300 Y75.000 A2131.2598
+G1 X75.000 Y99.300 A2132.3939
+G1 X75.000 Y99.750 A2132.4087
+G1 X99.750 Y75.000 A2133.5638
+G1 X100.200 Y75.000 A2133.5786
+G1 X75.000 Y100.200 A2134.7547
+G1 X75.000 Y100.650 A2134.7695
+G1 X100.650 Y75.000 A2135.9666
+G1 X101.100 Y75.000 A2135.9815
+G1 X75.000 Y101.100 A2137.1995
+G1 X75.000 Y101.550 A2137.2144
+G1 X101.550 Y75.000 A2138.4534
+G1 X102.000 Y75.000 A2138.4683
+G1 X75.000 Y102.000 A2139.7283
+G1 X75.000 Y102.450 A2139.7432
+G1 X102.450 Y75.000 A2141.0243
+G1 X102.900 Y75.000 A2141.0391
+G1 X75.000 Y102.900 A2142.3412
+G1 X75.000 Y103.350 A2142.3560
+G1 X103.350 Y75.000 A2143.6791
+G1 X103.800 Y75.000 A2143.6939
+G1 X75.000 Y103.800 A2145.0380
+G1 X75.000 Y104.250 A2145.0529
+G1 X104.250 Y75.000 A2146.4179
+G1 X104.700 Y75.000 A2146.4328
+G1 X75.000 Y104.700 A2147.8189
+G1 X75.000 Y105.150 A2147.8337
+G1 X105.150 Y75.000 A2149.2408
+G1 X105.600 Y75.000 A2149.2556
+G1 X75.000 Y105.600 A2150.6837
+G1 X75.000 Y106.050 A2150.6986
+G1 X106.050 Y75.000 A2152.1476
+G1 X106.500 Y75.000 A2152.1625
+G1 X75.000 Y106.500 A2153.6326
+G1 X75.000 Y106.950 A2153.6474
+G1 X106.950 Y75.000 A2155.1385
+G1 X107.400 Y75.000 A2155.1533
+G1 X75.000 Y107.400 A2156.6654
+G1 X75.000 Y107.850 A2156.6803
+G1 X107.850 Y75.000 A2158.2133
+G1 X108.300 Y75.000 A2158.2282
+G1 X75.000 Y108.300 A2159.7823
+G1 X75.000 Y108.750 A2159.7971
+G1 X108.750 Y75.000 A2161.3722
+G1 X109.200 Y75.000 A2161.3870
+G1 X75.000 Y109.200 A2162.9831
+G1 X75.000 Y109.650 A2162.9980
+G1 X109.650 Y75.000 A2164.6151
+G1 X110.100 Y75.000 A2164.6299
+G1 X75.000 Y110.100 A2166.2680
+G1 X75.000 Y110.550 A2166.2828
+G1 X110.550 Y75.000 A2167.9419
+G1 X111.000 Y75.000 A2167.9568
+G1 X75.000 Y111.000 A2169.6369
+G1 X75.000 Y111.450 A2169.6517
+G1 X111.450 Y75.000 A2171.3528
+G1 X111.900 Y75.000 A2171.3676
+G1 X75.000 Y111.900 A2173.0897
+G1 X75.000 Y112.350 A2173.1046
+G1 X112.350 Y75.000 A2174.8477
+G1 X112.800 Y75.000 A2174.8625
+G1 X75.000 Y112.800 A2176.6266
+G1 X75.000 Y113.250 A2176.6415
+G1 X113.250 Y75.000 A2178.4266
+G1 X113.700 Y75.000 A2178.4414
+G1 X75.000 Y113.700 A2180.2475
+G1 X75.000 Y114.150 A2180.2623
+G1 X114.150 Y75.000 A2182.0894
+G1 X114.600 Y75.000 A2182.1043
+G1 X75.000 Y114.600 A2183.9524
+G1 X75.000 Y115.050 A2183.9672
+G1 X115.050 Y75.000 A2185.8363
+G1 X115.500 Y75.000 A2185.8512
+G1 X75.000 Y115.500 A2187.7413
+G1 X75.000 Y115.950 A2187.7561
+G1 X115.950 Y75.000 A2189.6672
+G1 X116.400 Y75.000 A2189.6821
+G1 X75.000 Y116.400 A2191.6142
+G1 X75.000 Y116.850 A2191.6290
+G1 X116.850 Y75.000 A2193.5821
+G1 X117.300 Y75.000 A2193.5970
+G1 X75.000 Y117.300 A2195.5711
+G1 X75.000 Y117.750 A2195.5859
+G1 X117.750 Y75.000 A2197.5810
+G1 X118.200 Y75.000 A2197.5959
+G1 X75.000 Y118.200 A2199.6120
+G1 X75.000 Y118.650 A2199.6268
+G1 X118.650 Y75.000 A2201.6639
+G1 X119.100 Y75.000 A2201.6788
+G1 X75.000 Y119.100 A2203.7369
+G1 X75.000 Y119.550 A2203.7517
+G1 X119.550 Y75.000 A2205.8308
+G1 X120.000 Y75.000 A2205.8457
+G1 X75.000 Y120.000 A2207.9458
+G1 X75.000 Y120.450 A2207.9606
+G1 X120.450 Y75.000 A2210.0818
+G1 X120.900 Y75.000 A2210.0966
+G1 X75.000 Y120.900 A2212.2387
+G1 X75.000 Y121.350 A2212.2536
+G1 X121.350 Y75.000 A2214.4167
+G1 X121.800 Y75.000 A2214.4315
+G1 X75.000 Y121.800 A2216.6156
+G1 X75.000 Y122.250 A2216.6305
+G1 X122.250 Y75.000 A2218.8356
+G1 X122.700 Y75.000 A2218.8505
+G1 X75.000 Y122.700 A2221.0766
+G1 X75.000 Y123.150 A2221.0914
+G1 X123.150 Y75.000 A2223.3385
+G1 X123.600 Y75.000 A2223.3534
+G1 X75.000 Y123.600 A2225.6215
+G1 X75.000 Y124.050 A2225.6363
+G1 X124.050 Y75.000 A2227.9255
+G1 X124.500 Y75.000 A2227.9403
+G1 X75.000 Y124.500 A2230.2504
+G1 X75.000 Y124.950 A2230.2653
+G1 X124.950 Y75.000 A2232.5964
+G1 X125.000 Y75.400 A2232.6097
+G1 X75.400 Y125.000 A2234.9245
+G1 X75.850 Y125.000 A2234.9393
+G1 X125.000 Y75.850 A2237.2331
+G1 X125.000 Y76.300 A2237.2480
+G1 X76.300 Y125.000 A2239.5208
+G1 X76.750 Y125.000 A2239.5356
+G1 X125.000 Y76.750 A2241.7874
+G1 X125.000 Y77.200 A2241.8022
+G1 X77.200 Y125.000 A2244.0330
+G1 X77.650 Y125.000 A2244.0479
+G1 X125.000 Y77.650 A2246.2576
+G1 X125.000 Y78.100 A2246.2725
+G1 X78.100 Y125.000 A2248.4613
+G1 X78.550 Y125.000 A2248.4761
+G1 X125.000 Y78.550 A2250.6439
+G1 X125.000 Y79.000 A2250.6587
+G1 X79.000 Y125.000 A2252.8055
+G1 X79.450 Y125.000 A2252.8204
+G1 X125.000 Y79.450 A2254.9462
+G1 X125.000 Y79.900 A2254.9610
+G1 X79.900 Y125.000 A2257.0658
+G1 X80.350 Y125.000 A2257.0806
+G1 X125.000 Y80.350 A2259.1644
+G1 X125.000 Y80.800 A2259.1792
+G1 X80.800 Y125.000 A2261.2420
+G1 X81.250 Y125.000 A2261.2569
+G1 X125.000 Y81.250 A2263.2986
+G1 X125.000 Y81.700 A2263.3135
+G1 X81.700 Y125.000 A2265.3343
+G1 X82.150 Y125.000 A2265.3491
+G1 X125.000 Y82.150 A2267.3489
+G1 X125.000 Y82.600 A2267.3637
+G1 X82.600 Y125.000 A2269.3425
+G1 X83.050 Y125.000 A2269.3573
+G1 X125.000 Y83.050 A2271.3151
+G1 X125.000 Y83.500 A2271.3300
+G1 X83.500 Y125.000 A2273.2667
+G1 X83.950 Y125.000 A2273.2816
+G1 X125.000 Y83.950 A2275.1973
+G1 X125.000 Y84.400 A2275.2122
+G1 X84.400 Y125.000 A2277.1070
+G1 X84.850 Y125.000 A2277.1218
+G1 X125.000 Y84.850 A2278.9956
+G1 X125.000 Y85.300 A2279.0104
+G1 X85.300 Y125.000 A2280.8632
+G1 X85.750 Y125.000 A2280.8780
+G1 X125.000 Y85.750 A2282.7098
+G1 X125.000 Y86.200 A2282.7246
+G1 X86.200 Y125.000 A2284.5354
+G1 X86.650 Y125.000 A2284.5502
+G1 X125.000 Y86.650 A2286.3400
+G1 X125.000 Y87.100 A2286.3549
+G1 X87.100 Y125.000 A2288.1236
+G1 X87.550 Y125.000 A2288.1385
+G1 X125.000 Y87.550 A2289.8862
+G1 X125.000 Y88.000 A2289.9011
+G1 X88.000 Y125.000 A2291.6278
+G1 X88.450 Y125.000 A2291.6427
+G1 X125.000 Y88.450 A2293.3484
+G1 X125.000 Y88.900 A2293.3633
+G1 X88.900 Y125.000 A2295.0480
+G1 X89.350 Y125.000 A2295.0629
+G1 X125.000 Y89.350 A2296.7266
+G1 X125.000 Y89.800 A2296.7415
+G1 X89.800 Y125.000 A2298.3842
+G1 X90.250 Y125.000 A2298.3991
+G1 X125.000 Y90.250 A2300.0208
+G1 X125.000 Y90.700 A2300.0357
+G1 X90.700 Y125.000 A2301.6364
+G1 X91.150 Y125.000 A2301.6513
+G1 X125.000 Y91.150 A2303.2310
+G1 X125.000 Y91.600 A2303.2459
+G1 X91.600 Y125.000 A2304.8046
+G1 X92.050 Y125.000 A2304.8195
+G1 X125.000 Y92.050 A2306.3572
+G1 X125.000 Y92.500 A2306.3721
+G1 X92.500 Y125.000 A2307.8888
+G1 X92.950 Y125.000 A2307.9037
+G1 X125.000 Y92.950 A2309.3994
+G1 X125.000 Y93.400 A2309.4143
+G1 X93.400 Y125.000 A2310.8890
+G1 X93.850 Y125.000 A2310.9038
+G1 X125.000 Y93.850 A2312.3576
+G1 X125.000 Y94.300 A2312.3724
+G1 X94.300 Y125.000 A2313.8052
+G1 X94.750 Y125.000 A2313.8200
+G1 X125.000 Y94.750 A2315.2318
+G1 X125.000 Y95.200 A2315.2466
+G1 X95.200 Y125.000 A2316.6374
+G1 X95.650 Y125.000 A2316.6522
+G1 X125.000 Y95.650 A2318.0219
+G1 X125.000 Y96.100 A2318.0368
+G1 X96.100 Y125.000 A2319.3855
+G1 X96.550 Y125.000 A2319.4004
+G1 X125.000 Y96.550 A2320.7281
+G1 X125.000 Y97.000 A2320.7430
+G1 X97.000 Y125.000 A2322.0497
+G1 X97.450 Y125.000 A2322.0645
+G1 X125.000 Y97.450 A2323.3503
+G1 X125.000 Y97.900 A2323.3651
+G1 X97.900 Y125.000 A2324.6299
+G1 X98.350 Y125.000 A2324.6447
+G1 X125.000 Y98.350 A2325.8884
+G1 X125.000 Y98.800 A2325.9033
+G1 X98.800 Y125.000 A2327.1260
+G1 X99.250 Y125.000 A2327.1409
+G1 X125.000 Y99.250 A2328.3426
+G1 X125.000 Y99.700 A2328.3574
+G1 X99.700 Y125.000 A2329.5382
+G1 X100.150 Y125.000 A2329.5530
+G1 X125.000 Y100.150 A2330.7127
+G1 X125.000 Y100.600 A2330.7276
+G1 X100.600 Y125.000 A2331.8663
+G1 X101.050 Y125.000 A2331.8812
+G1 X125.000 Y101.050 A2332.9989
+G1 X125.000 Y101.500 A2333.0137
+G1 X101.500 Y125.000 A2334.1105
+G1 X101.950 Y125.000 A2334.1253
+G1 X125.000 Y101.950 A2335.2010
+G1 X125.000 Y102.400 A2335.2159
+G1 X102.400 Y125.000 A2336.2706
+G1 X102.850 Y125.000 A2336.2855
+G1 X125.000 Y102.850 A2337.3192
+G1 X125.000 Y103.300 A2337.3340
+G1 X103.300 Y125.000 A2338.3467
+G1 X103.750 Y125.000 A2338.3616
+G1 X125.000 Y103.750 A2339.3533
+G1 X125.000 Y104.200 A2339.3682
+G1 X104.200 Y125.000 A2340.3389
+G1 X104.650 Y125.000 A2340.3537
+G1 X125.000 Y104.650 A2341.3034
+G1 X125.000 Y105.100 A2341.3183
+G1 X105.100 Y125.000 A2342.2470
+G1 X105.550 Y125.000 A2342.2619
+G1 X125.000 Y105.550 A2343.1696
+G1 X125.000 Y106.000 A2343.1844
+G1 X106.000 Y125.000 A2344.0711
+G1 X106.450 Y125.000 A2344.0860
+G1 X125.000 Y106.450 A2344.9517
+G1 X125.000 Y106.900 A2344.9665
+G1 X106.900 Y125.000 A2345.8113
+G1 X107.350 Y125.000 A2345.8261
+G1 X125.000 Y107.350 A2346.6498
+G1 X125.000 Y107.800 A2346.6647
+G1 X107.800 Y125.000 A2347.4674
+G1 X108.250 Y125.000 A2347.4822
+G1 X125.000 Y108.250 A2348.2639
+G1 X125.000 Y108.700 A2348.2788
+G1 X108.700 Y125.000 A2349.0395
+G1 X109.150 Y125.000 A2349.0543
+G1 X125.000 Y109.150 A2349.7940
+G1 X125.000 Y109.600 A2349.8089
+G1 X109.600 Y125.000 A2350.5276
+G1 X110.050 Y125.000 A2350.5424
+G1 X125.000 Y110.050 A2351.2401
+G1 X125.000 Y110.500 A2351.2550
+G1 X110.500 Y125.000 A2351.9317
+G1 X110.950 Y125.000 A2351.9465
+G1 X125.000 Y110.950 A2352.6022
+G1 X125.000 Y111.400 A2352.6171
+G1 X111.400 Y125.000 A2353.2518
+G1 X111.850 Y125.000 A2353.2666
+G1 X125.000 Y111.850 A2353.8803
+G1 X125.000 Y112.300 A2353.8952
+G1 X112.300 Y125.000 A2354.4879
+G1 X112.750 Y125.000 A2354.5027
+G1 X125.000 Y112.750 A2355.0744
+G1 X125.000 Y113.200 A2355.0893
+G1 X113.200 Y125.000 A2355.6400
+G1 X113.650 Y125.000 A2355.6548
+G1 X125.000 Y113.650 A2356.1845
+G1 X125.000 Y114.100 A2356.1994
+G1 X114.100 Y125.000 A2356.7081
+G1 X114.550 Y125.000 A2356.7229
+G1 X125.000 Y114.550 A2357.2106
+G1 X125.000 Y115.000 A2357.2255
+G1 X115.000 Y125.000 A2357.6921
+G1 X115.450 Y125.000 A2357.7070
+G1 X125.000 Y115.450 A2358.1527
+G1 X125.000 Y115.900 A2358.1675
+G1 X115.900 Y125.000 A2358.5922
+G1 X116.350 Y125.000 A2358.6071
+G1 X125.000 Y116.350 A2359.0108
+G1 X125.000 Y116.800 A2359.0256
+G1 X116.800 Y125.000 A2359.4083
+G1 X117.250 Y125.000 A2359.4232
+G1 X125.000 Y117.250 A2359.7848
+G1 X125.000 Y117.700 A2359.7997
+G1 X117.700 Y125.000 A2360.1404
+G1 X118.150 Y125.000 A2360.1552
+G1 X125.000 Y118.150 A2360.4749
+G1 X125.000 Y118.600 A2360.4898
+G1 X118.600 Y125.000 A2360.7884
+G1 X119.050 Y125.000 A2360.8033
+G1 X125.000 Y119.050 A2361.0810
+G1 X125.000 Y119.500 A2361.0958
+G1 X119.500 Y125.000 A2361.3525
+G1 X119.950 Y125.000 A2361.3673
+G1 X125.000 Y119.950 A2361.6030
+G1 X125.000 Y120.400 A2361.6179
+G1 X120.400 Y125.000 A2361.8326
+G1 X120.850 Y125.000 A2361.8474
+G1 X125.000 Y120.850 A2362.0411
+G1 X125.000 Y121.300 A2362.0559
+G1 X121.300 Y125.000 A2362.2286
+G1 X121.750 Y125.000 A2362.2435
+G1 X125.000 Y121.750 A2362.3951
+G1 X125.000 Y122.200 A2362.4100
+G1 X122.200 Y125.000 A2362.5407
+G1 X122.650 Y125.000 A2362.5555
+G1 X125.000 Y122.650 A2362.6652
+G1 X125.000 Y123.100 A2362.6800
+G1 X123.100 Y125.000 A2362.7687
+G1 X123.550 Y125.000 A2362.7835
+G1 X125.000 Y123.550 A2362.8512
+G1 X125.000 Y124.000 A2362.8661
+G1 X124.000 Y125.000 A2362.9127
+G1 X124.450 Y125.000 A2362.9276
+G1 X125.000 Y124.450 A2362.9533
+G1 X125.000 Y124.900 A2362.9681
+G1 X124.900 Y125.000 A2362.9728
+G0 Z2.10
+G1 A2361.9728 F2400
+G0 X125.000 Y75.450
+G1 A2362.9728 F2400
+G1 F4800
+G1 X124.550 Y75.000 A2362.9938
+G1 X124.100 Y75.000 A2363.0086
+G1 X125.000 Y75.900 A2363.0506
+G1 X125.000 Y76.350 A2363.0655
+G1 X123.650 Y75.000 A2363.1285
+G1 X123.200 Y75.000 A2363.1433
+G1 X125.000 Y76.800 A2363.2273
+G1 X125.000 Y77.250 A2363.2422
+G1 X122.750 Y75.000 A2363.3472
+G1 X122.300 Y75.000 A2363.3620
+G1 X125.000 Y77.700 A2363.4880
+G1 X125.000 Y78.150 A2363.5029
+G1 X121.850 Y75.000 A2363.6499
+G1 X121.400 Y75.000 A2363.6647
+G1 X125.000 Y78.600 A2363.8328
+G1 X125.000 Y79.050 A2363.8476
+G1 X120.950 Y75.000 A2364.0366
+G1 X120.500 Y75.000 A2364.0515
+G1 X125.000 Y79.500 A2364.2615
+G1 X125.000 Y79.950 A2364.2763
+G1 X120.050 Y75.000 A2364.5073
+G1 X119.600 Y75.000 A2364.5222
+G1 X125.000 Y80.400 A2364.7742
+G1 X125.000 Y80.850 A2364.7891
+G1 X119.150 Y75.000 A2365.0621
+G1 X118.700 Y75.000 A2365.0769
+G1 X125.000 Y81.300 A2365.3709
+G1 X125.000 Y81.750 A2365.3858
+G1 X118.250 Y75.000 A2365.7008
+G1 X117.800 Y75.000 A2365.7156
+G1 X125.000 Y82.200 A2366.0517
+G1 X125.000 Y82.650 A2366.0665
+G1 X117.350 Y75.000 A2366.4235
+G1 X116.900 Y75.000 A2366.4384
+G1 X125.000 Y83.100 A2366.8164
+G1 X125.000 Y83.550 A2366.8313
+G1 X116.450 Y75.000 A2367.2303
+G1 X116.000 Y75.000 A2367.2451
+G1 X125.000 Y84.000 A2367.6651
+G1 X125.000 Y84.450 A2367.6800
+G1 X115.550 Y75.000 A2368.1210
+G1 X115.100 Y75.000 A2368.1359
+G1 X125.000 Y84.900 A2368.5979
+G1 X125.000 Y85.350 A2368.6127
+G1 X114.650 Y75.000 A2369.0958
+G1 X114.200 Y75.000 A2369.1106
+G1 X125.000 Y85.800 A2369.6146
+G1 X125.000 Y86.250 A2369.6295
+G1 X113.750 Y75.000 A2370.1545
+G1 X113.300 Y75.000 A2370.1694
+G1 X125.000 Y86.700 A2370.7154
+G1 X125.000 Y87.150 A2370.7302
+G1 X112.850 Y75.000 A2371.2973
+G1 X112.400 Y75.000 A2371.3121
+G1 X125.000 Y87.600 A2371.9002
+G1 X125.000 Y88.050 A2371.9150
+G1 X111.950 Y75.000 A2372.5240
+G1 X111.500 Y75.000 A2372.5389
+G1 X125.000 Y88.500 A2373.1689
+G1 X125.000 Y88.950 A2373.1838
+G1 X111.050 Y75.000 A2373.8348
+G1 X110.600 Y75.000 A2373.8497
+G1 X125.000 Y89.400 A2374.5217
+G1 X125.000 Y89.850 A2374.5365
+G1 X110.150 Y75.000 A2375.2296
+G1 X109.700 Y75.000 A2375.2444
+G1 X125.000 Y90.300 A2375.9585
+G1 X125.000 Y90.750 A2375.9733
+G1 X109.250 Y75.000 A2376.7083
+G1 X108.800 Y75.000 A2376.7232
+G1 X125.000 Y91.200 A2377.4792
+G1 X125.000 Y91.650 A2377.4941
+G1 X108.350 Y75.000 A2378.2711
+G1 X107.900 Y75.000 A2378.2860
+G1 X125.000 Y92.100 A2379.0840
+G1 X125.000 Y92.550 A2379.0989
+G1 X107.450 Y75.000 A2379.9179
+G1 X107.000 Y75.000 A2379.9328
+G1 X125.000 Y93.000 A2380.7728
+G1 X125.000 Y93.450 A2380.7876
+G1 X106.550 Y75.000 A2381.6487
+G1 X106.100 Y75.000 A2381.6635
+G1 X125.000 Y93.900 A2382.5456
+G1 X125.000 Y94.350 A2382.5604
+G1 X105.650 Y75.000 A2383.4635
+G1 X105.200 Y75.000 A2383.4783
+G1 X125.000 Y94.800 A2384.4024
+G1 X125.000 Y95.250 A2384.4172
+G1 X104.750 Y75.000 A2385.3623
+G1 X104.300 Y75.000 A2385.3771
+G1 X125.000 Y95.700 A2386.3432
+G1 X125.000 Y96.150 A2386.3580
+G1 X103.850 Y75.000 A2387.3451
+G1 X103.400 Y75.000 A2387.3599
+G1 X125.000 Y96.600 A2388.3680
+G1 X125.000 Y97.050 A2388.3828
+G1 X102.950 Y75.000 A2389.4119
+G1 X102.500 Y75.000 A2389.4267
+G1 X125.000 Y97.500 A2390.4768
+G1 X125.000 Y97.950 A2390.4916
+G1 X102.050 Y75.000 A2391.5627
+G1 X101.600 Y75.000 A2391.5775
+G1 X125.000 Y98.400 A2392.6696
+G1 X125.000 Y98.850 A2392.6844
+G1 X101.150 Y75.000 A2393.7975
+G1 X100.700 Y75.000 A2393.8124
+G1 X125.000 Y99.300 A2394.9464
+G1 X125.000 Y99.750 A2394.9613
+G1 X100.250 Y75.000 A2396.1163
+G1 X99.800 Y75.000 A2396.1312
+G1 X125.000 Y100.200 A2397.3072
+G1 X125.000 Y100.650 A2397.3221
+G1 X99.350 Y75.000 A2398.5191
+G1 X98.900 Y75.000 A2398.5340
+G1 X125.000 Y101.100 A2399.7521
+G1 X125.000 Y101.550 A2399.7669
+G1 X98.450 Y75.000 A2401.0060
+G1 X98.000 Y75.000 A2401.0208
+G1 X125.000 Y102.000 A2402.2809
+G1 X125.000 Y102.450 A2402.2957
+G1 X97.550 Y75.000 A2403.5768
+G1 X97.100 Y75.000 A2403.5916
+G1 X125.000 Y102.900 A2404.8937
+G1 X125.000 Y103.350 A2404.9086
+G1 X96.650 Y75.000 A2406.2316
+G1 X96.200 Y75.000 A2406.2465
+G1 X125.000 Y103.800 A2407.5905
+G1 X125.000 Y104.250 A2407.6054
+G1 X95.750 Y75.000 A2408.9705
+G1 X95.300 Y75.000 A2408.9853
+G1 X125.000 Y104.700 A2410.3714
+G1 X125.000 Y105.150 A2410.3862
+G1 X94.850 Y75.000 A2411.7933
+G1 X94.400 Y75.000 A2411.8082
+G1 X125.000 Y105.600 A2413.2362
+G1 X125.000 Y106.050 A2413.2511
+G1 X93.950 Y75.000 A2414.7002
+G1 X93.500 Y75.000 A2414.7150
+G1 X125.000 Y106.500 A2416.1851
+G1 X125.000 Y106.950 A2416.1999
+G1 X93.050 Y75.000 A2417.6910
+G1 X92.600 Y75.000 A2417.7059
+G1 X125.000 Y107.400 A2419.2179
+G1 X125.000 Y107.850 A2419.2328
+G1 X92.150 Y75.000 A2420.7659
+G1 X91.700 Y75.000 A2420.7807
+G1 X125.000 Y108.300 A2422.3348
+G1 X125.000 Y108.750 A2422.3496
+G1 X91.250 Y75.000 A2423.9247
+G1 X90.800 Y75.000 A2423.9396
+G1 X125.000 Y109.200 A2425.5357
+G1 X125.000 Y109.650 A2425.5505
+G1 X90.350 Y75.000 A2427.1676
+G1 X89.900 Y75.000 A2427.1824
+G1 X125.000 Y110.100 A2428.8205
+G1 X125.000 Y110.550 A2428.8354
+G1 X89.450 Y75.000 A2430.4945
+G1 X89.000 Y75.000 A2430.5093
+G1 X125.000 Y111.000 A2432.1894
+G1 X125.000 Y111.450 A2432.2042
+G1 X88.550 Y75.000 A2433.9053
+G1 X88.100 Y75.000 A2433.9202
+G1 X125.000 Y111.900 A2435.6423
+G1 X125.000 Y112.350 A2435.6571
+G1 X87.650 Y75.000 A2437.4002
+G1 X87.200 Y75.000 A2437.4151
+G1 X125.000 Y112.800 A2439.1791
+G1 X125.000 Y113.250 A2439.1940
+G1 X86.750 Y75.000 A2440.9791
+G1 X86.300 Y75.000 A2440.9939
+G1 X125.000 Y113.700 A2442.8000
+G1 X125.000 Y114.150 A2442.8149
+G1 X85.850 Y75.000 A2444.6420
+G1 X85.400 Y75.000 A2444.6568
+G1 X125.000 Y114.600 A2446.5049
+G1 X125.000 Y115.050 A2446.5198
+G1 X84.950 Y75.000 A2448.3889
+G1 X84.500 Y75.000 A2448.4037
+G1 X125.000 Y115.500 A2450.2938
+G1 X125.000 Y115.950 A2450.3087
+G1 X84.050 Y75.000 A2452.2198
+G1 X83.600 Y75.000 A2452.2346
+G1 X125.000 Y116.400 A2454.1667
+G1 X125.000 Y116.850 A2454.1816
+G1 X83.150 Y75.000 A2456.1347
+G1 X82.700 Y75.000 A2456.1495
+G1 X125.000 Y117.300 A2458.1236
+G1 X125.000 Y117.750 A2458.1385
+G1 X82.250 Y75.000 A2460.1336
+G1 X81.800 Y75.000 A2460.1484
+G1 X125.000 Y118.200 A2462.1645
+G1 X125.000 Y118.650 A2462.1794
+G1 X81.350 Y75.000 A2464.2165
+G1 X80.900 Y75.000 A2464.2313
+G1 X125.000 Y119.100 A2466.2894
+G1 X125.000 Y119.550 A2466.3043
+G1 X80.450 Y75.000 A2468.3834
+G1 X80.000 Y75.000 A2468.3982
+G1 X125.000 Y120.000 A2470.4983
+G1 X125.000 Y120.450 A2470.5132
+G1 X79.550 Y75.000 A2472.6343
+G1 X79.100 Y75.000 A2472.6491
+G1 X125.000 Y120.900 A2474.7912
+G1 X125.000 Y121.350 A2474.8061
+G1 X78.650 Y75.000 A2476.9692
+G1 X78.200 Y75.000 A2476.9841
+G1 X125.000 Y121.800 A2479.1682
+G1 X125.000 Y122.250 A2479.1830
+G1 X77.750 Y75.000 A2481.3881
+G1 X77.300 Y75.000 A2481.4030
+G1 X125.000 Y122.700 A2483.6291
+G1 X125.000 Y123.150 A2483.6439
+G1 X76.850 Y75.000 A2485.8911
+G1 X76.400 Y75.000 A2485.9059
+G1 X125.000 Y123.600 A2488.1740
+G1 X125.000 Y124.050 A2488.1889
+G1 X75.950 Y75.000 A2490.4780
+G1 X75.500 Y75.000 A2490.4928
+G1 X125.000 Y124.500 A2492.8030
+G1 X125.000 Y124.950 A2492.8178
+G1 X75.050 Y75.000 A2495.1489
+G1 X75.000 Y75.400 A2495.1622
+G1 X124.600 Y125.000 A2497.4770
+G1 X124.150 Y125.000 A2497.4919
+G1 X75.000 Y75.850 A2499.7856
+G1 X75.000 Y76.300 A2499.8005
+G1 X123.700 Y125.000 A2502.0733
+G1 X123.250 Y125.000 A2502.0881
+G1 X75.000 Y76.750 A2504.3399
+G1 X75.000 Y77.200 A2504.3548
+G1 X122.800 Y125.000 A2506.5855
+G1 X122.350 Y125.000 A2506.6004
+G1 X75.000 Y77.650 A2508.8102
+G1 X75.000 Y78.100 A2508.8250
+G1 X121.900 Y125.000 A2511.0138
+G1 X121.450 Y125.000 A2511.0287
+G1 X75.000 Y78.550 A2513.1964
+G1 X75.000 Y79.000 A2513.2113
+G1 X121.000 Y125.000 A2515.3581
+G1 X120.550 Y125.000 A2515.3729
+G1 X75.000 Y79.450 A2517.4987
+G1 X75.000 Y79.900 A2517.5135
+G1 X120.100 Y125.000 A2519.6183
+G1 X119.650 Y125.000 A2519.6332
+G1 X75.000 Y80.350 A2521.7169
+G1 X75.000 Y80.800 A2521.7318
+G1 X119.200 Y125.000 A2523.7945
+G1 X118.750 Y125.000 A2523.8094
+G1 X75.000 Y81.250 A2525.8512
+G1 X75.000 Y81.700 A2525.8660
+G1 X118.300 Y125.000 A2527.8868
+G1 X117.850 Y125.000 A2527.9016
+G1 X75.000 Y82.150 A2529.9014
+G1 X75.000 Y82.600 A2529.9163
+G1 X117.400 Y125.000 A2531.8950
+G1 X116.950 Y125.000 A2531.9099
+G1 X75.000 Y83.050 A2533.8676
+G1 X75.000 Y83.500 A2533.8825
+G1 X116.500 Y125.000 A2535.8193
+G1 X116.050 Y125.000 A2535.8341
+G1 X75.000 Y83.950 A2537.7499
+G1 X75.000 Y84.400 A2537.7647
+G1 X115.600 Y125.000 A2539.6595
+G1 X115.150 Y125.000 A2539.6743
+G1 X75.000 Y84.850 A2541.5481
+G1 X75.000 Y85.300 A2541.5629
+G1 X114.700 Y125.000 A2543.4157
+G1 X114.250 Y125.000 A2543.4306
+G1 X75.000 Y85.750 A2545.2623
+G1 X75.000 Y86.200 A2545.2772
+G1 X113.800 Y125.000 A2547.0879
+G1 X113.350 Y125.000 A2547.1028
+G1 X75.000 Y86.650 A2548.8925
+G1 X75.000 Y87.100 A2548.9074
+G1 X112.900 Y125.000 A2550.6761
+G1 X112.450 Y125.000 A2550.6910
+G1 X75.000 Y87.550 A2552.4387
+G1 X75.000 Y88.000 A2552.4536
+G1 X112.000 Y125.000 A2554.1804
+G1 X111.550 Y125.000 A2554.1952
+G1 X75.000 Y88.450 A2555.9010
+G1 X75.000 Y88.900 A2555.9158
+G1 X111.100 Y125.000 A2557.6006
+G1 X110.650 Y125.000 A2557.6154
+G1 X75.000 Y89.350 A2559.2792
+G1 X75.000 Y89.800 A2559.2940
+G1 X110.200 Y125.000 A2560.9368
+G1 X109.750 Y125.000 A2560.9516
+G1 X75.000 Y90.250 A2562.5734
+G1 X75.000 Y90.700 A2562.5882
+G1 X109.300 Y125.000 A2564.1890
+G1 X108.850 Y125.000 A2564.2038
+G1 X75.000 Y91.150 A2565.7836
+G1 X75.000 Y91.600 A2565.7984
+G1 X108.400 Y125.000 A2567.3572
+G1 X107.950 Y125.000 A2567.3720
+G1 X75.000 Y92.050 A2568.9097
+G1 X75.000 Y92.500 A2568.9246
+G1 X107.500 Y125.000 A2570.4413
+G1 X107.050 Y125.000 A2570.4562
+G1 X75.000 Y92.950 A2571.9519
+G1 X75.000 Y93.400 A2571.9668
+G1 X106.600 Y125.000 A2573.4415
+G1 X106.150 Y125.000 A2573.4564
+G1 X75.000 Y93.850 A2574.9101
+G1 X75.000 Y94.300 A2574.9250
+G1 X105.700 Y125.000 A2576.3577
+G1 X105.250 Y125.000 A2576.3726
+G1 X75.000 Y94.750 A2577.7843
+G1 X75.000 Y95.200 A2577.7991
+G1 X104.800 Y125.000 A2579.1899
+G1 X104.350 Y125.000 A2579.2047
+G1 X75.000 Y95.650 A2580.5745
+G1 X75.000 Y96.100 A2580.5893
+G1 X103.900 Y125.000 A2581.9381
+G1 X103.450 Y125.000 A2581.9529
+G1 X75.000 Y96.550 A2583.2806
+G1 X75.000 Y97.000 A2583.2955
+G1 X103.000 Y125.000 A2584.6022
+G1 X102.550 Y125.000 A2584.6171
+G1 X75.000 Y97.450 A2585.9028
+G1 X75.000 Y97.900 A2585.9177
+G1 X102.100 Y125.000 A2587.1824
+G1 X101.650 Y125.000 A2587.1972
+G1 X75.000 Y98.350 A2588.4410
+G1 X75.000 Y98.800 A2588.4558
+G1 X101.200 Y125.000 A2589.6785
+G1 X100.750 Y125.000 A2589.6934
+G1 X75.000 Y99.250 A2590.8951
+G1 X75.000 Y99.700 A2590.9100
+G1 X100.300 Y125.000 A2592.0907
+G1 X99.850 Y125.000 A2592.1056
+G1 X75.000 Y100.150 A2593.2653
+G1 X75.000 Y100.600 A2593.2801
+G1 X99.400 Y125.000 A2594.4189
+G1 X98.950 Y125.000 A2594.4337
+G1 X75.000 Y101.050 A2595.5514
+G1 X75.000 Y101.500 A2595.5663
+G1 X98.500 Y125.000 A2596.6630
+G1 X98.050 Y125.000 A2596.6778
+G1 X75.000 Y101.950 A2597.7536
+G1 X75.000 Y102.400 A2597.7684
+G1 X97.600 Y125.000 A2598.8231
+G1 X97.150 Y125.000 A2598.8380
+G1 X75.000 Y102.850 A2599.8717
+G1 X75.000 Y103.300 A2599.8866
+G1 X96.700 Y125.000 A2600.8993
+G1 X96.250 Y125.000 A2600.9141
+G1 X75.000 Y103.750 A2601.9058
+G1 X75.000 Y104.200 A2601.9207
+G1 X95.800 Y125.000 A2602.8914
+G1 X95.350 Y125.000 A2602.9063
+G1 X75.000 Y104.650 A2603.8560
+G1 X75.000 Y105.100 A2603.8708
+G1 X94.900 Y125.000 A2604.7995
+G1 X94.450 Y125.000 A2604.8144
+G1 X75.000 Y105.550 A2605.7221
+G1 X75.000 Y106.000 A2605.7370
+G1 X94.000 Y125.000 A2606.6237
+G1 X93.550 Y125.000 A2606.6385
+G1 X75.000 Y106.450 A2607.5042
+G1 X75.000 Y106.900 A2607.5191
+G1 X93.100 Y125.000 A2608.3638
+G1 X92.650 Y125.000 A2608.3786
+G1 X75.000 Y107.350 A2609.2023
+G1 X75.000 Y107.800 A2609.2172
+G1 X92.200 Y125.000 A2610.0199
+G1 X91.750 Y125.000 A2610.0348
+G1 X75.000 Y108.250 A2610.8165
+G1 X75.000 Y108.700 A2610.8313
+G1 X91.300 Y125.000 A2611.5920
+G1 X90.850 Y125.000 A2611.6069
+G1 X75.000 Y109.150 A2612.3466
+G1 X75.000 Y109.600 A2612.3614
+G1 X90.400 Y125.000 A2613.0801
+G1 X89.950 Y125.000 A2613.0950
+G1 X75.000 Y110.050 A2613.7927
+G1 X75.000 Y110.500 A2613.8075
+G1 X89.500 Y125.000 A2614.4842
+G1 X89.050 Y125.000 A2614.4991
+G1 X75.000 Y110.950 A2615.1548
+G1 X75.000 Y111.400 A2615.1696
+G1 X88.600 Y125.000 A2615.8043
+G1 X88.150 Y125.000 A2615.8192
+G1 X75.000 Y111.850 A2616.4329
+G1 X75.000 Y112.300 A2616.4477
+G1 X87.700 Y125.000 A2617.0404
+G1 X87.250 Y125.000 A2617.0553
+G1 X75.000 Y112.750 A2617.6270
+G1 X75.000 Y113.200 A2617.6418
+G1 X86.800 Y125.000 A2618.1925
+G1 X86.350 Y125.000 A2618.2074
+G1 X75.000 Y113.650 A2618.7371
+G1 X75.000 Y114.100 A2618.7519
+G1 X85.900 Y125.000 A2619.2606
+G1 X85.450 Y125.000 A2619.2754
+G1 X75.000 Y114.550 A2619.7631
+G1 X75.000 Y115.000 A2619.7780
+G1 X85.000 Y125.000 A2620.2447
+G1 X84.550 Y125.000 A2620.2595
+G1 X75.000 Y115.450 A2620.7052
+G1 X75.000 Y115.900 A2620.7201
+G1 X84.100 Y125.000 A2621.1448
+G1 X83.650 Y125.000 A2621.1596
+G1 X75.000 Y116.350 A2621.5633
+G1 X75.000 Y116.800 A2621.5781
+G1 X83.200 Y125.000 A2621.9608
+G1 X82.750 Y125.000 A2621.9757
+G1 X75.000 Y117.250 A2622.3374
+G1 X75.000 Y117.700 A2622.3522
+G1 X82.300 Y125.000 A2622.6929
+G1 X81.850 Y125.000 A2622.7077
+G1 X75.000 Y118.150 A2623.0274
+G1 X75.000 Y118.600 A2623.0423
+G1 X81.400 Y125.000 A2623.3410
+G1 X80.950 Y125.000 A2623.3558
+G1 X75.000 Y119.050 A2623.6335
+G1 X75.000 Y119.500 A2623.6483
+G1 X80.500 Y125.000 A2623.9050
+G1 X80.050 Y125.000 A2623.9199
+G1 X75.000 Y119.950 A2624.1556
+G1 X75.000 Y120.400 A2624.1704
+G1 X79.600 Y125.000 A2624.3851
+G1 X79.150 Y125.000 A2624.3999
+G1 X75.000 Y120.850 A2624.5936
+G1 X75.000 Y121.300 A2624.6085
+G1 X78.700 Y125.000 A2624.7811
+G1 X78.250 Y125.000 A2624.7960
+G1 X75.000 Y121.750 A2624.9477
+G1 X75.000 Y122.200 A2624.9625
+G1 X77.800 Y125.000 A2625.0932
+G1 X77.350 Y125.000 A2625.1080
+G1 X75.000 Y122.650 A2625.2177
+G1 X75.000 Y123.100 A2625.2326
+G1 X76.900 Y125.000 A2625.3212
+G1 X76.450 Y125.000 A2625.3361
+G1 X75.000 Y123.550 A2625.4037
+G1 X75.000 Y124.000 A2625.4186
+G1 X76.000 Y125.000 A2625.4653
+G1 X75.550 Y125.000 A2625.4801
+G1 X75.000 Y124.450 A2625.5058
+G1 X75.000 Y124.900 A2625.5206
+G1 X75.100 Y125.000 A2625.5253
+G0 X0 Y0
+M2
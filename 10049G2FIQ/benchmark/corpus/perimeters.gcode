@@ -0,0 +1,3282 @@
+; perimeters - rounded shells and a round hole, 12 layers
+G21
+G90
+G92 A0
+G0 Z0.30
+G1 A-1.0000 F2400
+G0 X130.000 Y112.000
+G1 A0.0000 F2400
+G1 F2400
+G1 X129.932 Y113.044 A0.0345
+G1 X129.727 Y114.071 A0.0691
+G1 X129.391 Y115.061 A0.1036
+G1 X128.928 Y116.000 A0.1381
+G1 X128.347 Y116.870 A0.1727
+G1 X127.657 Y117.657 A0.2072
+G1 X126.870 Y118.347 A0.2417
+G1 X126.000 Y118.928 A0.2763
+G1 X125.061 Y119.391 A0.3108
+G1 X124.071 Y119.727 A0.3453
+G1 X123.044 Y119.932 A0.3799
+G1 X122.000 Y120.000 A0.4144
+G1 X78.000 Y120.000 A1.8664
+G1 X76.956 Y119.932 A1.9009
+G1 X75.929 Y119.727 A1.9355
+G1 X74.939 Y119.391 A1.9700
+G1 X74.000 Y118.928 A2.0045
+G1 X73.130 Y118.347 A2.0391
+G1 X72.343 Y117.657 A2.0736
+G1 X71.653 Y116.870 A2.1081
+G1 X71.072 Y116.000 A2.1427
+G1 X70.609 Y115.061 A2.1772
+G1 X70.273 Y114.071 A2.2117
+G1 X70.068 Y113.044 A2.2463
+G1 X70.000 Y112.000 A2.2808
+G1 X70.000 Y88.000 A3.0728
+G1 X70.068 Y86.956 A3.1073
+G1 X70.273 Y85.929 A3.1419
+G1 X70.609 Y84.939 A3.1764
+G1 X71.072 Y84.000 A3.2109
+G1 X71.653 Y83.130 A3.2455
+G1 X72.343 Y82.343 A3.2800
+G1 X73.130 Y81.653 A3.3145
+G1 X74.000 Y81.072 A3.3491
+G1 X74.939 Y80.609 A3.3836
+G1 X75.929 Y80.273 A3.4181
+G1 X76.956 Y80.068 A3.4526
+G1 X78.000 Y80.000 A3.4872
+G1 X122.000 Y80.000 A4.9392
+G1 X123.044 Y80.068 A4.9737
+G1 X124.071 Y80.273 A5.0082
+G1 X125.061 Y80.609 A5.0428
+G1 X126.000 Y81.072 A5.0773
+G1 X126.870 Y81.653 A5.1118
+G1 X127.657 Y82.343 A5.1464
+G1 X128.347 Y83.130 A5.1809
+G1 X128.928 Y84.000 A5.2154
+G1 X129.391 Y84.939 A5.2500
+G1 X129.727 Y85.929 A5.2845
+G1 X129.932 Y86.956 A5.3190
+G1 X130.000 Y88.000 A5.3536
+G1 X130.000 Y112.000 A6.1456
+G1 A5.1456 F2400
+G0 X129.550 Y112.000
+G1 A6.1456 F2400
+G1 F2400
+G1 X129.485 Y112.985 A6.1782
+G1 X129.293 Y113.954 A6.2108
+G1 X128.975 Y114.889 A6.2433
+G1 X128.538 Y115.775 A6.2759
+G1 X127.990 Y116.596 A6.3085
+G1 X127.339 Y117.339 A6.3411
+G1 X126.596 Y117.990 A6.3737
+G1 X125.775 Y118.538 A6.4063
+G1 X124.889 Y118.975 A6.4389
+G1 X123.954 Y119.293 A6.4715
+G1 X122.985 Y119.485 A6.5041
+G1 X122.000 Y119.550 A6.5367
+G1 X78.000 Y119.550 A7.9887
+G1 X77.015 Y119.485 A8.0213
+G1 X76.046 Y119.293 A8.0538
+G1 X75.111 Y118.975 A8.0864
+G1 X74.225 Y118.538 A8.1190
+G1 X73.404 Y117.990 A8.1516
+G1 X72.661 Y117.339 A8.1842
+G1 X72.010 Y116.596 A8.2168
+G1 X71.462 Y115.775 A8.2494
+G1 X71.025 Y114.889 A8.2820
+G1 X70.707 Y113.954 A8.3146
+G1 X70.515 Y112.985 A8.3472
+G1 X70.450 Y112.000 A8.3797
+G1 X70.450 Y88.000 A9.1717
+G1 X70.515 Y87.015 A9.2043
+G1 X70.707 Y86.046 A9.2369
+G1 X71.025 Y85.111 A9.2695
+G1 X71.462 Y84.225 A9.3021
+G1 X72.010 Y83.404 A9.3347
+G1 X72.661 Y82.661 A9.3673
+G1 X73.404 Y82.010 A9.3999
+G1 X74.225 Y81.462 A9.4325
+G1 X75.111 Y81.025 A9.4651
+G1 X76.046 Y80.707 A9.4976
+G1 X77.015 Y80.515 A9.5302
+G1 X78.000 Y80.450 A9.5628
+G1 X122.000 Y80.450 A11.0148
+G1 X122.985 Y80.515 A11.0474
+G1 X123.954 Y80.707 A11.0800
+G1 X124.889 Y81.025 A11.1126
+G1 X125.775 Y81.462 A11.1452
+G1 X126.596 Y82.010 A11.1778
+G1 X127.339 Y82.661 A11.2104
+G1 X127.990 Y83.404 A11.2430
+G1 X128.538 Y84.225 A11.2756
+G1 X128.975 Y85.111 A11.3081
+G1 X129.293 Y86.046 A11.3407
+G1 X129.485 Y87.015 A11.3733
+G1 X129.550 Y88.000 A11.4059
+G1 X129.550 Y112.000 A12.1979
+G1 A11.1979 F2400
+G0 X129.100 Y112.000
+G1 A12.1979 F2400
+G1 F2400
+G1 X129.039 Y112.927 A12.2286
+G1 X128.858 Y113.838 A12.2592
+G1 X128.560 Y114.717 A12.2899
+G1 X128.149 Y115.550 A12.3205
+G1 X127.633 Y116.322 A12.3512
+G1 X127.020 Y117.020 A12.3818
+G1 X126.322 Y117.633 A12.4125
+G1 X125.550 Y118.149 A12.4431
+G1 X124.717 Y118.560 A12.4737
+G1 X123.838 Y118.858 A12.5044
+G1 X122.927 Y119.039 A12.5350
+G1 X122.000 Y119.100 A12.5657
+G1 X78.000 Y119.100 A14.0177
+G1 X77.073 Y119.039 A14.0483
+G1 X76.162 Y118.858 A14.0790
+G1 X75.283 Y118.560 A14.1096
+G1 X74.450 Y118.149 A14.1403
+G1 X73.678 Y117.633 A14.1709
+G1 X72.980 Y117.020 A14.2016
+G1 X72.367 Y116.322 A14.2322
+G1 X71.851 Y115.550 A14.2629
+G1 X71.440 Y114.717 A14.2935
+G1 X71.142 Y113.838 A14.3242
+G1 X70.961 Y112.927 A14.3548
+G1 X70.900 Y112.000 A14.3855
+G1 X70.900 Y88.000 A15.1775
+G1 X70.961 Y87.073 A15.2081
+G1 X71.142 Y86.162 A15.2388
+G1 X71.440 Y85.283 A15.2694
+G1 X71.851 Y84.450 A15.3001
+G1 X72.367 Y83.678 A15.3307
+G1 X72.980 Y82.980 A15.3614
+G1 X73.678 Y82.367 A15.3920
+G1 X74.450 Y81.851 A15.4226
+G1 X75.283 Y81.440 A15.4533
+G1 X76.162 Y81.142 A15.4839
+G1 X77.073 Y80.961 A15.5146
+G1 X78.000 Y80.900 A15.5452
+G1 X122.000 Y80.900 A16.9972
+G1 X122.927 Y80.961 A17.0279
+G1 X123.838 Y81.142 A17.0585
+G1 X124.717 Y81.440 A17.0892
+G1 X125.550 Y81.851 A17.1198
+G1 X126.322 Y82.367 A17.1505
+G1 X127.020 Y82.980 A17.1811
+G1 X127.633 Y83.678 A17.2118
+G1 X128.149 Y84.450 A17.2424
+G1 X128.560 Y85.283 A17.2731
+G1 X128.858 Y86.162 A17.3037
+G1 X129.039 Y87.073 A17.3344
+G1 X129.100 Y88.000 A17.3650
+G1 X129.100 Y112.000 A18.1570
+G1 A17.1570 F2400
+G0 X91.000 Y100.000
+G1 A18.1570 F2400
+G1 F2400
+G1 X90.949 Y100.783 A18.1829
+G1 X90.796 Y101.553 A18.2088
+G1 X90.543 Y102.296 A18.2347
+G1 X90.196 Y103.000 A18.2606
+G1 X89.760 Y103.653 A18.2865
+G1 X89.243 Y104.243 A18.3124
+G1 X88.653 Y104.760 A18.3383
+G1 X88.000 Y105.196 A18.3642
+G1 X87.296 Y105.543 A18.3901
+G1 X86.553 Y105.796 A18.4160
+G1 X85.783 Y105.949 A18.4419
+G1 X85.000 Y106.000 A18.4678
+G1 X84.217 Y105.949 A18.4937
+G1 X83.447 Y105.796 A18.5196
+G1 X82.704 Y105.543 A18.5455
+G1 X82.000 Y105.196 A18.5714
+G1 X81.347 Y104.760 A18.5973
+G1 X80.757 Y104.243 A18.6232
+G1 X80.240 Y103.653 A18.6491
+G1 X79.804 Y103.000 A18.6750
+G1 X79.457 Y102.296 A18.7009
+G1 X79.204 Y101.553 A18.7268
+G1 X79.051 Y100.783 A18.7527
+G1 X79.000 Y100.000 A18.7786
+G1 X79.051 Y99.217 A18.8045
+G1 X79.204 Y98.447 A18.8304
+G1 X79.457 Y97.704 A18.8563
+G1 X79.804 Y97.000 A18.8822
+G1 X80.240 Y96.347 A18.9081
+G1 X80.757 Y95.757 A18.9340
+G1 X81.347 Y95.240 A18.9599
+G1 X82.000 Y94.804 A18.9858
+G1 X82.704 Y94.457 A19.0117
+G1 X83.447 Y94.204 A19.0376
+G1 X84.217 Y94.051 A19.0635
+G1 X85.000 Y94.000 A19.0894
+G1 X85.783 Y94.051 A19.1153
+G1 X86.553 Y94.204 A19.1412
+G1 X87.296 Y94.457 A19.1671
+G1 X88.000 Y94.804 A19.1930
+G1 X88.653 Y95.240 A19.2189
+G1 X89.243 Y95.757 A19.2448
+G1 X89.760 Y96.347 A19.2707
+G1 X90.196 Y97.000 A19.2966
+G1 X90.543 Y97.704 A19.3225
+G1 X90.796 Y98.447 A19.3484
+G1 X90.949 Y99.217 A19.3743
+G1 X91.000 Y100.000 A19.4002
+G1 A18.4002 F2400
+G0 X91.450 Y100.000
+G1 A19.4002 F2400
+G1 F2400
+G1 X91.395 Y100.842 A19.4280
+G1 X91.230 Y101.669 A19.4559
+G1 X90.959 Y102.468 A19.4837
+G1 X90.586 Y103.225 A19.5116
+G1 X90.117 Y103.927 A19.5394
+G1 X89.561 Y104.561 A19.5672
+G1 X88.927 Y105.117 A19.5951
+G1 X88.225 Y105.586 A19.6229
+G1 X87.468 Y105.959 A19.6508
+G1 X86.669 Y106.230 A19.6786
+G1 X85.842 Y106.395 A19.7065
+G1 X85.000 Y106.450 A19.7343
+G1 X84.158 Y106.395 A19.7621
+G1 X83.331 Y106.230 A19.7900
+G1 X82.532 Y105.959 A19.8178
+G1 X81.775 Y105.586 A19.8457
+G1 X81.073 Y105.117 A19.8735
+G1 X80.439 Y104.561 A19.9014
+G1 X79.883 Y103.927 A19.9292
+G1 X79.414 Y103.225 A19.9570
+G1 X79.041 Y102.468 A19.9849
+G1 X78.770 Y101.669 A20.0127
+G1 X78.605 Y100.842 A20.0406
+G1 X78.550 Y100.000 A20.0684
+G1 X78.605 Y99.158 A20.0963
+G1 X78.770 Y98.331 A20.1241
+G1 X79.041 Y97.532 A20.1519
+G1 X79.414 Y96.775 A20.1798
+G1 X79.883 Y96.073 A20.2076
+G1 X80.439 Y95.439 A20.2355
+G1 X81.073 Y94.883 A20.2633
+G1 X81.775 Y94.414 A20.2911
+G1 X82.532 Y94.041 A20.3190
+G1 X83.331 Y93.770 A20.3468
+G1 X84.158 Y93.605 A20.3747
+G1 X85.000 Y93.550 A20.4025
+G1 X85.842 Y93.605 A20.4304
+G1 X86.669 Y93.770 A20.4582
+G1 X87.468 Y94.041 A20.4860
+G1 X88.225 Y94.414 A20.5139
+G1 X88.927 Y94.883 A20.5417
+G1 X89.561 Y95.439 A20.5696
+G1 X90.117 Y96.073 A20.5974
+G1 X90.586 Y96.775 A20.6253
+G1 X90.959 Y97.532 A20.6531
+G1 X91.230 Y98.331 A20.6809
+G1 X91.395 Y99.158 A20.7088
+G1 X91.450 Y100.000 A20.7366
+G0 Z0.50
+G1 A19.7366 F2400
+G0 X130.000 Y112.000
+G1 A20.7366 F2400
+G1 F2400
+G1 X129.932 Y113.044 A20.7712
+G1 X129.727 Y114.071 A20.8057
+G1 X129.391 Y115.061 A20.8402
+G1 X128.928 Y116.000 A20.8748
+G1 X128.347 Y116.870 A20.9093
+G1 X127.657 Y117.657 A20.9438
+G1 X126.870 Y118.347 A20.9783
+G1 X126.000 Y118.928 A21.0129
+G1 X125.061 Y119.391 A21.0474
+G1 X124.071 Y119.727 A21.0819
+G1 X123.044 Y119.932 A21.1165
+G1 X122.000 Y120.000 A21.1510
+G1 X78.000 Y120.000 A22.6030
+G1 X76.956 Y119.932 A22.6375
+G1 X75.929 Y119.727 A22.6721
+G1 X74.939 Y119.391 A22.7066
+G1 X74.000 Y118.928 A22.7411
+G1 X73.130 Y118.347 A22.7757
+G1 X72.343 Y117.657 A22.8102
+G1 X71.653 Y116.870 A22.8447
+G1 X71.072 Y116.000 A22.8793
+G1 X70.609 Y115.061 A22.9138
+G1 X70.273 Y114.071 A22.9483
+G1 X70.068 Y113.044 A22.9829
+G1 X70.000 Y112.000 A23.0174
+G1 X70.000 Y88.000 A23.8094
+G1 X70.068 Y86.956 A23.8439
+G1 X70.273 Y85.929 A23.8785
+G1 X70.609 Y84.939 A23.9130
+G1 X71.072 Y84.000 A23.9475
+G1 X71.653 Y83.130 A23.9821
+G1 X72.343 Y82.343 A24.0166
+G1 X73.130 Y81.653 A24.0511
+G1 X74.000 Y81.072 A24.0857
+G1 X74.939 Y80.609 A24.1202
+G1 X75.929 Y80.273 A24.1547
+G1 X76.956 Y80.068 A24.1893
+G1 X78.000 Y80.000 A24.2238
+G1 X122.000 Y80.000 A25.6758
+G1 X123.044 Y80.068 A25.7103
+G1 X124.071 Y80.273 A25.7449
+G1 X125.061 Y80.609 A25.7794
+G1 X126.000 Y81.072 A25.8139
+G1 X126.870 Y81.653 A25.8485
+G1 X127.657 Y82.343 A25.8830
+G1 X128.347 Y83.130 A25.9175
+G1 X128.928 Y84.000 A25.9521
+G1 X129.391 Y84.939 A25.9866
+G1 X129.727 Y85.929 A26.0211
+G1 X129.932 Y86.956 A26.0557
+G1 X130.000 Y88.000 A26.0902
+G1 X130.000 Y112.000 A26.8822
+G1 A25.8822 F2400
+G0 X129.550 Y112.000
+G1 A26.8822 F2400
+G1 F2400
+G1 X129.485 Y112.985 A26.9148
+G1 X129.293 Y113.954 A26.9474
+G1 X128.975 Y114.889 A26.9800
+G1 X128.538 Y115.775 A27.0126
+G1 X127.990 Y116.596 A27.0451
+G1 X127.339 Y117.339 A27.0777
+G1 X126.596 Y117.990 A27.1103
+G1 X125.775 Y118.538 A27.1429
+G1 X124.889 Y118.975 A27.1755
+G1 X123.954 Y119.293 A27.2081
+G1 X122.985 Y119.485 A27.2407
+G1 X122.000 Y119.550 A27.2733
+G1 X78.000 Y119.550 A28.7253
+G1 X77.015 Y119.485 A28.7579
+G1 X76.046 Y119.293 A28.7905
+G1 X75.111 Y118.975 A28.8231
+G1 X74.225 Y118.538 A28.8556
+G1 X73.404 Y117.990 A28.8882
+G1 X72.661 Y117.339 A28.9208
+G1 X72.010 Y116.596 A28.9534
+G1 X71.462 Y115.775 A28.9860
+G1 X71.025 Y114.889 A29.0186
+G1 X70.707 Y113.954 A29.0512
+G1 X70.515 Y112.985 A29.0838
+G1 X70.450 Y112.000 A29.1164
+G1 X70.450 Y88.000 A29.9084
+G1 X70.515 Y87.015 A29.9410
+G1 X70.707 Y86.046 A29.9735
+G1 X71.025 Y85.111 A30.0061
+G1 X71.462 Y84.225 A30.0387
+G1 X72.010 Y83.404 A30.0713
+G1 X72.661 Y82.661 A30.1039
+G1 X73.404 Y82.010 A30.1365
+G1 X74.225 Y81.462 A30.1691
+G1 X75.111 Y81.025 A30.2017
+G1 X76.046 Y80.707 A30.2343
+G1 X77.015 Y80.515 A30.2669
+G1 X78.000 Y80.450 A30.2994
+G1 X122.000 Y80.450 A31.7514
+G1 X122.985 Y80.515 A31.7840
+G1 X123.954 Y80.707 A31.8166
+G1 X124.889 Y81.025 A31.8492
+G1 X125.775 Y81.462 A31.8818
+G1 X126.596 Y82.010 A31.9144
+G1 X127.339 Y82.661 A31.9470
+G1 X127.990 Y83.404 A31.9796
+G1 X128.538 Y84.225 A32.0122
+G1 X128.975 Y85.111 A32.0448
+G1 X129.293 Y86.046 A32.0774
+G1 X129.485 Y87.015 A32.1099
+G1 X129.550 Y88.000 A32.1425
+G1 X129.550 Y112.000 A32.9345
+G1 A31.9345 F2400
+G0 X129.100 Y112.000
+G1 A32.9345 F2400
+G1 F2400
+G1 X129.039 Y112.927 A32.9652
+G1 X128.858 Y113.838 A32.9958
+G1 X128.560 Y114.717 A33.0265
+G1 X128.149 Y115.550 A33.0571
+G1 X127.633 Y116.322 A33.0878
+G1 X127.020 Y117.020 A33.1184
+G1 X126.322 Y117.633 A33.1491
+G1 X125.550 Y118.149 A33.1797
+G1 X124.717 Y118.560 A33.2104
+G1 X123.838 Y118.858 A33.2410
+G1 X122.927 Y119.039 A33.2717
+G1 X122.000 Y119.100 A33.3023
+G1 X78.000 Y119.100 A34.7543
+G1 X77.073 Y119.039 A34.7850
+G1 X76.162 Y118.858 A34.8156
+G1 X75.283 Y118.560 A34.8463
+G1 X74.450 Y118.149 A34.8769
+G1 X73.678 Y117.633 A34.9075
+G1 X72.980 Y117.020 A34.9382
+G1 X72.367 Y116.322 A34.9688
+G1 X71.851 Y115.550 A34.9995
+G1 X71.440 Y114.717 A35.0301
+G1 X71.142 Y113.838 A35.0608
+G1 X70.961 Y112.927 A35.0914
+G1 X70.900 Y112.000 A35.1221
+G1 X70.900 Y88.000 A35.9141
+G1 X70.961 Y87.073 A35.9447
+G1 X71.142 Y86.162 A35.9754
+G1 X71.440 Y85.283 A36.0060
+G1 X71.851 Y84.450 A36.0367
+G1 X72.367 Y83.678 A36.0673
+G1 X72.980 Y82.980 A36.0980
+G1 X73.678 Y82.367 A36.1286
+G1 X74.450 Y81.851 A36.1593
+G1 X75.283 Y81.440 A36.1899
+G1 X76.162 Y81.142 A36.2206
+G1 X77.073 Y80.961 A36.2512
+G1 X78.000 Y80.900 A36.2819
+G1 X122.000 Y80.900 A37.7339
+G1 X122.927 Y80.961 A37.7645
+G1 X123.838 Y81.142 A37.7952
+G1 X124.717 Y81.440 A37.8258
+G1 X125.550 Y81.851 A37.8565
+G1 X126.322 Y82.367 A37.8871
+G1 X127.020 Y82.980 A37.9177
+G1 X127.633 Y83.678 A37.9484
+G1 X128.149 Y84.450 A37.9790
+G1 X128.560 Y85.283 A38.0097
+G1 X128.858 Y86.162 A38.0403
+G1 X129.039 Y87.073 A38.0710
+G1 X129.100 Y88.000 A38.1016
+G1 X129.100 Y112.000 A38.8936
+G1 A37.8936 F2400
+G0 X91.000 Y100.000
+G1 A38.8936 F2400
+G1 F2400
+G1 X90.949 Y100.783 A38.9195
+G1 X90.796 Y101.553 A38.9454
+G1 X90.543 Y102.296 A38.9713
+G1 X90.196 Y103.000 A38.9972
+G1 X89.760 Y103.653 A39.0231
+G1 X89.243 Y104.243 A39.0490
+G1 X88.653 Y104.760 A39.0749
+G1 X88.000 Y105.196 A39.1008
+G1 X87.296 Y105.543 A39.1267
+G1 X86.553 Y105.796 A39.1526
+G1 X85.783 Y105.949 A39.1785
+G1 X85.000 Y106.000 A39.2044
+G1 X84.217 Y105.949 A39.2303
+G1 X83.447 Y105.796 A39.2562
+G1 X82.704 Y105.543 A39.2821
+G1 X82.000 Y105.196 A39.3080
+G1 X81.347 Y104.760 A39.3339
+G1 X80.757 Y104.243 A39.3598
+G1 X80.240 Y103.653 A39.3857
+G1 X79.804 Y103.000 A39.4116
+G1 X79.457 Y102.296 A39.4375
+G1 X79.204 Y101.553 A39.4634
+G1 X79.051 Y100.783 A39.4893
+G1 X79.000 Y100.000 A39.5152
+G1 X79.051 Y99.217 A39.5411
+G1 X79.204 Y98.447 A39.5670
+G1 X79.457 Y97.704 A39.5929
+G1 X79.804 Y97.000 A39.6188
+G1 X80.240 Y96.347 A39.6447
+G1 X80.757 Y95.757 A39.6706
+G1 X81.347 Y95.240 A39.6965
+G1 X82.000 Y94.804 A39.7224
+G1 X82.704 Y94.457 A39.7483
+G1 X83.447 Y94.204 A39.7742
+G1 X84.217 Y94.051 A39.8001
+G1 X85.000 Y94.000 A39.8260
+G1 X85.783 Y94.051 A39.8519
+G1 X86.553 Y94.204 A39.8778
+G1 X87.296 Y94.457 A39.9037
+G1 X88.000 Y94.804 A39.9296
+G1 X88.653 Y95.240 A39.9555
+G1 X89.243 Y95.757 A39.9814
+G1 X89.760 Y96.347 A40.0073
+G1 X90.196 Y97.000 A40.0332
+G1 X90.543 Y97.704 A40.0591
+G1 X90.796 Y98.447 A40.0850
+G1 X90.949 Y99.217 A40.1109
+G1 X91.000 Y100.000 A40.1368
+G1 A39.1368 F2400
+G0 X91.450 Y100.000
+G1 A40.1368 F2400
+G1 F2400
+G1 X91.395 Y100.842 A40.1647
+G1 X91.230 Y101.669 A40.1925
+G1 X90.959 Y102.468 A40.2203
+G1 X90.586 Y103.225 A40.2482
+G1 X90.117 Y103.927 A40.2760
+G1 X89.561 Y104.561 A40.3039
+G1 X88.927 Y105.117 A40.3317
+G1 X88.225 Y105.586 A40.3596
+G1 X87.468 Y105.959 A40.3874
+G1 X86.669 Y106.230 A40.4152
+G1 X85.842 Y106.395 A40.4431
+G1 X85.000 Y106.450 A40.4709
+G1 X84.158 Y106.395 A40.4988
+G1 X83.331 Y106.230 A40.5266
+G1 X82.532 Y105.959 A40.5544
+G1 X81.775 Y105.586 A40.5823
+G1 X81.073 Y105.117 A40.6101
+G1 X80.439 Y104.561 A40.6380
+G1 X79.883 Y103.927 A40.6658
+G1 X79.414 Y103.225 A40.6937
+G1 X79.041 Y102.468 A40.7215
+G1 X78.770 Y101.669 A40.7493
+G1 X78.605 Y100.842 A40.7772
+G1 X78.550 Y100.000 A40.8050
+G1 X78.605 Y99.158 A40.8329
+G1 X78.770 Y98.331 A40.8607
+G1 X79.041 Y97.532 A40.8886
+G1 X79.414 Y96.775 A40.9164
+G1 X79.883 Y96.073 A40.9442
+G1 X80.439 Y95.439 A40.9721
+G1 X81.073 Y94.883 A40.9999
+G1 X81.775 Y94.414 A41.0278
+G1 X82.532 Y94.041 A41.0556
+G1 X83.331 Y93.770 A41.0834
+G1 X84.158 Y93.605 A41.1113
+G1 X85.000 Y93.550 A41.1391
+G1 X85.842 Y93.605 A41.1670
+G1 X86.669 Y93.770 A41.1948
+G1 X87.468 Y94.041 A41.2227
+G1 X88.225 Y94.414 A41.2505
+G1 X88.927 Y94.883 A41.2783
+G1 X89.561 Y95.439 A41.3062
+G1 X90.117 Y96.073 A41.3340
+G1 X90.586 Y96.775 A41.3619
+G1 X90.959 Y97.532 A41.3897
+G1 X91.230 Y98.331 A41.4176
+G1 X91.395 Y99.158 A41.4454
+G1 X91.450 Y100.000 A41.4732
+G0 Z0.70
+G1 A40.4732 F2400
+G0 X130.000 Y112.000
+G1 A41.4732 F2400
+G1 F2400
+G1 X129.932 Y113.044 A41.5078
+G1 X129.727 Y114.071 A41.5423
+G1 X129.391 Y115.061 A41.5768
+G1 X128.928 Y116.000 A41.6114
+G1 X128.347 Y116.870 A41.6459
+G1 X127.657 Y117.657 A41.6804
+G1 X126.870 Y118.347 A41.7150
+G1 X126.000 Y118.928 A41.7495
+G1 X125.061 Y119.391 A41.7840
+G1 X124.071 Y119.727 A41.8186
+G1 X123.044 Y119.932 A41.8531
+G1 X122.000 Y120.000 A41.8876
+G1 X78.000 Y120.000 A43.3396
+G1 X76.956 Y119.932 A43.3742
+G1 X75.929 Y119.727 A43.4087
+G1 X74.939 Y119.391 A43.4432
+G1 X74.000 Y118.928 A43.4778
+G1 X73.130 Y118.347 A43.5123
+G1 X72.343 Y117.657 A43.5468
+G1 X71.653 Y116.870 A43.5814
+G1 X71.072 Y116.000 A43.6159
+G1 X70.609 Y115.061 A43.6504
+G1 X70.273 Y114.071 A43.6850
+G1 X70.068 Y113.044 A43.7195
+G1 X70.000 Y112.000 A43.7540
+G1 X70.000 Y88.000 A44.5460
+G1 X70.068 Y86.956 A44.5806
+G1 X70.273 Y85.929 A44.6151
+G1 X70.609 Y84.939 A44.6496
+G1 X71.072 Y84.000 A44.6842
+G1 X71.653 Y83.130 A44.7187
+G1 X72.343 Y82.343 A44.7532
+G1 X73.130 Y81.653 A44.7878
+G1 X74.000 Y81.072 A44.8223
+G1 X74.939 Y80.609 A44.8568
+G1 X75.929 Y80.273 A44.8914
+G1 X76.956 Y80.068 A44.9259
+G1 X78.000 Y80.000 A44.9604
+G1 X122.000 Y80.000 A46.4124
+G1 X123.044 Y80.068 A46.4470
+G1 X124.071 Y80.273 A46.4815
+G1 X125.061 Y80.609 A46.5160
+G1 X126.000 Y81.072 A46.5506
+G1 X126.870 Y81.653 A46.5851
+G1 X127.657 Y82.343 A46.6196
+G1 X128.347 Y83.130 A46.6542
+G1 X128.928 Y84.000 A46.6887
+G1 X129.391 Y84.939 A46.7232
+G1 X129.727 Y85.929 A46.7577
+G1 X129.932 Y86.956 A46.7923
+G1 X130.000 Y88.000 A46.8268
+G1 X130.000 Y112.000 A47.6188
+G1 A46.6188 F2400
+G0 X129.550 Y112.000
+G1 A47.6188 F2400
+G1 F2400
+G1 X129.485 Y112.985 A47.6514
+G1 X129.293 Y113.954 A47.6840
+G1 X128.975 Y114.889 A47.7166
+G1 X128.538 Y115.775 A47.7492
+G1 X127.990 Y116.596 A47.7818
+G1 X127.339 Y117.339 A47.8144
+G1 X126.596 Y117.990 A47.8469
+G1 X125.775 Y118.538 A47.8795
+G1 X124.889 Y118.975 A47.9121
+G1 X123.954 Y119.293 A47.9447
+G1 X122.985 Y119.485 A47.9773
+G1 X122.000 Y119.550 A48.0099
+G1 X78.000 Y119.550 A49.4619
+G1 X77.015 Y119.485 A49.4945
+G1 X76.046 Y119.293 A49.5271
+G1 X75.111 Y118.975 A49.5597
+G1 X74.225 Y118.538 A49.5923
+G1 X73.404 Y117.990 A49.6249
+G1 X72.661 Y117.339 A49.6574
+G1 X72.010 Y116.596 A49.6900
+G1 X71.462 Y115.775 A49.7226
+G1 X71.025 Y114.889 A49.7552
+G1 X70.707 Y113.954 A49.7878
+G1 X70.515 Y112.985 A49.8204
+G1 X70.450 Y112.000 A49.8530
+G1 X70.450 Y88.000 A50.6450
+G1 X70.515 Y87.015 A50.6776
+G1 X70.707 Y86.046 A50.7102
+G1 X71.025 Y85.111 A50.7428
+G1 X71.462 Y84.225 A50.7753
+G1 X72.010 Y83.404 A50.8079
+G1 X72.661 Y82.661 A50.8405
+G1 X73.404 Y82.010 A50.8731
+G1 X74.225 Y81.462 A50.9057
+G1 X75.111 Y81.025 A50.9383
+G1 X76.046 Y80.707 A50.9709
+G1 X77.015 Y80.515 A51.0035
+G1 X78.000 Y80.450 A51.0361
+G1 X122.000 Y80.450 A52.4881
+G1 X122.985 Y80.515 A52.5207
+G1 X123.954 Y80.707 A52.5532
+G1 X124.889 Y81.025 A52.5858
+G1 X125.775 Y81.462 A52.6184
+G1 X126.596 Y82.010 A52.6510
+G1 X127.339 Y82.661 A52.6836
+G1 X127.990 Y83.404 A52.7162
+G1 X128.538 Y84.225 A52.7488
+G1 X128.975 Y85.111 A52.7814
+G1 X129.293 Y86.046 A52.8140
+G1 X129.485 Y87.015 A52.8466
+G1 X129.550 Y88.000 A52.8792
+G1 X129.550 Y112.000 A53.6712
+G1 A52.6712 F2400
+G0 X129.100 Y112.000
+G1 A53.6712 F2400
+G1 F2400
+G1 X129.039 Y112.927 A53.7018
+G1 X128.858 Y113.838 A53.7324
+G1 X128.560 Y114.717 A53.7631
+G1 X128.149 Y115.550 A53.7937
+G1 X127.633 Y116.322 A53.8244
+G1 X127.020 Y117.020 A53.8550
+G1 X126.322 Y117.633 A53.8857
+G1 X125.550 Y118.149 A53.9163
+G1 X124.717 Y118.560 A53.9470
+G1 X123.838 Y118.858 A53.9776
+G1 X122.927 Y119.039 A54.0083
+G1 X122.000 Y119.100 A54.0389
+G1 X78.000 Y119.100 A55.4909
+G1 X77.073 Y119.039 A55.5216
+G1 X76.162 Y118.858 A55.5522
+G1 X75.283 Y118.560 A55.5829
+G1 X74.450 Y118.149 A55.6135
+G1 X73.678 Y117.633 A55.6442
+G1 X72.980 Y117.020 A55.6748
+G1 X72.367 Y116.322 A55.7055
+G1 X71.851 Y115.550 A55.7361
+G1 X71.440 Y114.717 A55.7668
+G1 X71.142 Y113.838 A55.7974
+G1 X70.961 Y112.927 A55.8281
+G1 X70.900 Y112.000 A55.8587
+G1 X70.900 Y88.000 A56.6507
+G1 X70.961 Y87.073 A56.6814
+G1 X71.142 Y86.162 A56.7120
+G1 X71.440 Y85.283 A56.7426
+G1 X71.851 Y84.450 A56.7733
+G1 X72.367 Y83.678 A56.8039
+G1 X72.980 Y82.980 A56.8346
+G1 X73.678 Y82.367 A56.8652
+G1 X74.450 Y81.851 A56.8959
+G1 X75.283 Y81.440 A56.9265
+G1 X76.162 Y81.142 A56.9572
+G1 X77.073 Y80.961 A56.9878
+G1 X78.000 Y80.900 A57.0185
+G1 X122.000 Y80.900 A58.4705
+G1 X122.927 Y80.961 A58.5011
+G1 X123.838 Y81.142 A58.5318
+G1 X124.717 Y81.440 A58.5624
+G1 X125.550 Y81.851 A58.5931
+G1 X126.322 Y82.367 A58.6237
+G1 X127.020 Y82.980 A58.6544
+G1 X127.633 Y83.678 A58.6850
+G1 X128.149 Y84.450 A58.7157
+G1 X128.560 Y85.283 A58.7463
+G1 X128.858 Y86.162 A58.7770
+G1 X129.039 Y87.073 A58.8076
+G1 X129.100 Y88.000 A58.8383
+G1 X129.100 Y112.000 A59.6303
+G1 A58.6303 F2400
+G0 X91.000 Y100.000
+G1 A59.6303 F2400
+G1 F2400
+G1 X90.949 Y100.783 A59.6562
+G1 X90.796 Y101.553 A59.6821
+G1 X90.543 Y102.296 A59.7080
+G1 X90.196 Y103.000 A59.7339
+G1 X89.760 Y103.653 A59.7598
+G1 X89.243 Y104.243 A59.7856
+G1 X88.653 Y104.760 A59.8115
+G1 X88.000 Y105.196 A59.8374
+G1 X87.296 Y105.543 A59.8633
+G1 X86.553 Y105.796 A59.8892
+G1 X85.783 Y105.949 A59.9151
+G1 X85.000 Y106.000 A59.9410
+G1 X84.217 Y105.949 A59.9669
+G1 X83.447 Y105.796 A59.9928
+G1 X82.704 Y105.543 A60.0187
+G1 X82.000 Y105.196 A60.0446
+G1 X81.347 Y104.760 A60.0705
+G1 X80.757 Y104.243 A60.0964
+G1 X80.240 Y103.653 A60.1223
+G1 X79.804 Y103.000 A60.1482
+G1 X79.457 Y102.296 A60.1741
+G1 X79.204 Y101.553 A60.2000
+G1 X79.051 Y100.783 A60.2259
+G1 X79.000 Y100.000 A60.2518
+G1 X79.051 Y99.217 A60.2777
+G1 X79.204 Y98.447 A60.3036
+G1 X79.457 Y97.704 A60.3295
+G1 X79.804 Y97.000 A60.3554
+G1 X80.240 Y96.347 A60.3813
+G1 X80.757 Y95.757 A60.4072
+G1 X81.347 Y95.240 A60.4331
+G1 X82.000 Y94.804 A60.4590
+G1 X82.704 Y94.457 A60.4849
+G1 X83.447 Y94.204 A60.5108
+G1 X84.217 Y94.051 A60.5367
+G1 X85.000 Y94.000 A60.5626
+G1 X85.783 Y94.051 A60.5885
+G1 X86.553 Y94.204 A60.6144
+G1 X87.296 Y94.457 A60.6403
+G1 X88.000 Y94.804 A60.6662
+G1 X88.653 Y95.240 A60.6921
+G1 X89.243 Y95.757 A60.7180
+G1 X89.760 Y96.347 A60.7439
+G1 X90.196 Y97.000 A60.7698
+G1 X90.543 Y97.704 A60.7957
+G1 X90.796 Y98.447 A60.8216
+G1 X90.949 Y99.217 A60.8475
+G1 X91.000 Y100.000 A60.8734
+G1 A59.8734 F2400
+G0 X91.450 Y100.000
+G1 A60.8734 F2400
+G1 F2400
+G1 X91.395 Y100.842 A60.9013
+G1 X91.230 Y101.669 A60.9291
+G1 X90.959 Y102.468 A60.9570
+G1 X90.586 Y103.225 A60.9848
+G1 X90.117 Y103.927 A61.0126
+G1 X89.561 Y104.561 A61.0405
+G1 X88.927 Y105.117 A61.0683
+G1 X88.225 Y105.586 A61.0962
+G1 X87.468 Y105.959 A61.1240
+G1 X86.669 Y106.230 A61.1519
+G1 X85.842 Y106.395 A61.1797
+G1 X85.000 Y106.450 A61.2075
+G1 X84.158 Y106.395 A61.2354
+G1 X83.331 Y106.230 A61.2632
+G1 X82.532 Y105.959 A61.2911
+G1 X81.775 Y105.586 A61.3189
+G1 X81.073 Y105.117 A61.3468
+G1 X80.439 Y104.561 A61.3746
+G1 X79.883 Y103.927 A61.4024
+G1 X79.414 Y103.225 A61.4303
+G1 X79.041 Y102.468 A61.4581
+G1 X78.770 Y101.669 A61.4860
+G1 X78.605 Y100.842 A61.5138
+G1 X78.550 Y100.000 A61.5416
+G1 X78.605 Y99.158 A61.5695
+G1 X78.770 Y98.331 A61.5973
+G1 X79.041 Y97.532 A61.6252
+G1 X79.414 Y96.775 A61.6530
+G1 X79.883 Y96.073 A61.6809
+G1 X80.439 Y95.439 A61.7087
+G1 X81.073 Y94.883 A61.7365
+G1 X81.775 Y94.414 A61.7644
+G1 X82.532 Y94.041 A61.7922
+G1 X83.331 Y93.770 A61.8201
+G1 X84.158 Y93.605 A61.8479
+G1 X85.000 Y93.550 A61.8758
+G1 X85.842 Y93.605 A61.9036
+G1 X86.669 Y93.770 A61.9314
+G1 X87.468 Y94.041 A61.9593
+G1 X88.225 Y94.414 A61.9871
+G1 X88.927 Y94.883 A62.0150
+G1 X89.561 Y95.439 A62.0428
+G1 X90.117 Y96.073 A62.0706
+G1 X90.586 Y96.775 A62.0985
+G1 X90.959 Y97.532 A62.1263
+G1 X91.230 Y98.331 A62.1542
+G1 X91.395 Y99.158 A62.1820
+G1 X91.450 Y100.000 A62.2099
+G0 Z0.90
+G1 A61.2099 F2400
+G0 X130.000 Y112.000
+G1 A62.2099 F2400
+G1 F2400
+G1 X129.932 Y113.044 A62.2444
+G1 X129.727 Y114.071 A62.2789
+G1 X129.391 Y115.061 A62.3135
+G1 X128.928 Y116.000 A62.3480
+G1 X128.347 Y116.870 A62.3825
+G1 X127.657 Y117.657 A62.4171
+G1 X126.870 Y118.347 A62.4516
+G1 X126.000 Y118.928 A62.4861
+G1 X125.061 Y119.391 A62.5207
+G1 X124.071 Y119.727 A62.5552
+G1 X123.044 Y119.932 A62.5897
+G1 X122.000 Y120.000 A62.6243
+G1 X78.000 Y120.000 A64.0763
+G1 X76.956 Y119.932 A64.1108
+G1 X75.929 Y119.727 A64.1453
+G1 X74.939 Y119.391 A64.1798
+G1 X74.000 Y118.928 A64.2144
+G1 X73.130 Y118.347 A64.2489
+G1 X72.343 Y117.657 A64.2834
+G1 X71.653 Y116.870 A64.3180
+G1 X71.072 Y116.000 A64.3525
+G1 X70.609 Y115.061 A64.3870
+G1 X70.273 Y114.071 A64.4216
+G1 X70.068 Y113.044 A64.4561
+G1 X70.000 Y112.000 A64.4906
+G1 X70.000 Y88.000 A65.2826
+G1 X70.068 Y86.956 A65.3172
+G1 X70.273 Y85.929 A65.3517
+G1 X70.609 Y84.939 A65.3862
+G1 X71.072 Y84.000 A65.4208
+G1 X71.653 Y83.130 A65.4553
+G1 X72.343 Y82.343 A65.4898
+G1 X73.130 Y81.653 A65.5244
+G1 X74.000 Y81.072 A65.5589
+G1 X74.939 Y80.609 A65.5934
+G1 X75.929 Y80.273 A65.6280
+G1 X76.956 Y80.068 A65.6625
+G1 X78.000 Y80.000 A65.6970
+G1 X122.000 Y80.000 A67.1490
+G1 X123.044 Y80.068 A67.1836
+G1 X124.071 Y80.273 A67.2181
+G1 X125.061 Y80.609 A67.2526
+G1 X126.000 Y81.072 A67.2872
+G1 X126.870 Y81.653 A67.3217
+G1 X127.657 Y82.343 A67.3562
+G1 X128.347 Y83.130 A67.3908
+G1 X128.928 Y84.000 A67.4253
+G1 X129.391 Y84.939 A67.4598
+G1 X129.727 Y85.929 A67.4944
+G1 X129.932 Y86.956 A67.5289
+G1 X130.000 Y88.000 A67.5634
+G1 X130.000 Y112.000 A68.3554
+G1 A67.3554 F2400
+G0 X129.550 Y112.000
+G1 A68.3554 F2400
+G1 F2400
+G1 X129.485 Y112.985 A68.3880
+G1 X129.293 Y113.954 A68.4206
+G1 X128.975 Y114.889 A68.4532
+G1 X128.538 Y115.775 A68.4858
+G1 X127.990 Y116.596 A68.5184
+G1 X127.339 Y117.339 A68.5510
+G1 X126.596 Y117.990 A68.5836
+G1 X125.775 Y118.538 A68.6162
+G1 X124.889 Y118.975 A68.6487
+G1 X123.954 Y119.293 A68.6813
+G1 X122.985 Y119.485 A68.7139
+G1 X122.000 Y119.550 A68.7465
+G1 X78.000 Y119.550 A70.1985
+G1 X77.015 Y119.485 A70.2311
+G1 X76.046 Y119.293 A70.2637
+G1 X75.111 Y118.975 A70.2963
+G1 X74.225 Y118.538 A70.3289
+G1 X73.404 Y117.990 A70.3615
+G1 X72.661 Y117.339 A70.3941
+G1 X72.010 Y116.596 A70.4267
+G1 X71.462 Y115.775 A70.4592
+G1 X71.025 Y114.889 A70.4918
+G1 X70.707 Y113.954 A70.5244
+G1 X70.515 Y112.985 A70.5570
+G1 X70.450 Y112.000 A70.5896
+G1 X70.450 Y88.000 A71.3816
+G1 X70.515 Y87.015 A71.4142
+G1 X70.707 Y86.046 A71.4468
+G1 X71.025 Y85.111 A71.4794
+G1 X71.462 Y84.225 A71.5120
+G1 X72.010 Y83.404 A71.5446
+G1 X72.661 Y82.661 A71.5771
+G1 X73.404 Y82.010 A71.6097
+G1 X74.225 Y81.462 A71.6423
+G1 X75.111 Y81.025 A71.6749
+G1 X76.046 Y80.707 A71.7075
+G1 X77.015 Y80.515 A71.7401
+G1 X78.000 Y80.450 A71.7727
+G1 X122.000 Y80.450 A73.2247
+G1 X122.985 Y80.515 A73.2573
+G1 X123.954 Y80.707 A73.2899
+G1 X124.889 Y81.025 A73.3225
+G1 X125.775 Y81.462 A73.3550
+G1 X126.596 Y82.010 A73.3876
+G1 X127.339 Y82.661 A73.4202
+G1 X127.990 Y83.404 A73.4528
+G1 X128.538 Y84.225 A73.4854
+G1 X128.975 Y85.111 A73.5180
+G1 X129.293 Y86.046 A73.5506
+G1 X129.485 Y87.015 A73.5832
+G1 X129.550 Y88.000 A73.6158
+G1 X129.550 Y112.000 A74.4078
+G1 A73.4078 F2400
+G0 X129.100 Y112.000
+G1 A74.4078 F2400
+G1 F2400
+G1 X129.039 Y112.927 A74.4384
+G1 X128.858 Y113.838 A74.4691
+G1 X128.560 Y114.717 A74.4997
+G1 X128.149 Y115.550 A74.5304
+G1 X127.633 Y116.322 A74.5610
+G1 X127.020 Y117.020 A74.5917
+G1 X126.322 Y117.633 A74.6223
+G1 X125.550 Y118.149 A74.6530
+G1 X124.717 Y118.560 A74.6836
+G1 X123.838 Y118.858 A74.7143
+G1 X122.927 Y119.039 A74.7449
+G1 X122.000 Y119.100 A74.7755
+G1 X78.000 Y119.100 A76.2275
+G1 X77.073 Y119.039 A76.2582
+G1 X76.162 Y118.858 A76.2888
+G1 X75.283 Y118.560 A76.3195
+G1 X74.450 Y118.149 A76.3501
+G1 X73.678 Y117.633 A76.3808
+G1 X72.980 Y117.020 A76.4114
+G1 X72.367 Y116.322 A76.4421
+G1 X71.851 Y115.550 A76.4727
+G1 X71.440 Y114.717 A76.5034
+G1 X71.142 Y113.838 A76.5340
+G1 X70.961 Y112.927 A76.5647
+G1 X70.900 Y112.000 A76.5953
+G1 X70.900 Y88.000 A77.3873
+G1 X70.961 Y87.073 A77.4180
+G1 X71.142 Y86.162 A77.4486
+G1 X71.440 Y85.283 A77.4793
+G1 X71.851 Y84.450 A77.5099
+G1 X72.367 Y83.678 A77.5406
+G1 X72.980 Y82.980 A77.5712
+G1 X73.678 Y82.367 A77.6019
+G1 X74.450 Y81.851 A77.6325
+G1 X75.283 Y81.440 A77.6632
+G1 X76.162 Y81.142 A77.6938
+G1 X77.073 Y80.961 A77.7244
+G1 X78.000 Y80.900 A77.7551
+G1 X122.000 Y80.900 A79.2071
+G1 X122.927 Y80.961 A79.2377
+G1 X123.838 Y81.142 A79.2684
+G1 X124.717 Y81.440 A79.2990
+G1 X125.550 Y81.851 A79.3297
+G1 X126.322 Y82.367 A79.3603
+G1 X127.020 Y82.980 A79.3910
+G1 X127.633 Y83.678 A79.4216
+G1 X128.149 Y84.450 A79.4523
+G1 X128.560 Y85.283 A79.4829
+G1 X128.858 Y86.162 A79.5136
+G1 X129.039 Y87.073 A79.5442
+G1 X129.100 Y88.000 A79.5749
+G1 X129.100 Y112.000 A80.3669
+G1 A79.3669 F2400
+G0 X91.000 Y100.000
+G1 A80.3669 F2400
+G1 F2400
+G1 X90.949 Y100.783 A80.3928
+G1 X90.796 Y101.553 A80.4187
+G1 X90.543 Y102.296 A80.4446
+G1 X90.196 Y103.000 A80.4705
+G1 X89.760 Y103.653 A80.4964
+G1 X89.243 Y104.243 A80.5223
+G1 X88.653 Y104.760 A80.5482
+G1 X88.000 Y105.196 A80.5741
+G1 X87.296 Y105.543 A80.6000
+G1 X86.553 Y105.796 A80.6259
+G1 X85.783 Y105.949 A80.6518
+G1 X85.000 Y106.000 A80.6777
+G1 X84.217 Y105.949 A80.7036
+G1 X83.447 Y105.796 A80.7295
+G1 X82.704 Y105.543 A80.7554
+G1 X82.000 Y105.196 A80.7813
+G1 X81.347 Y104.760 A80.8072
+G1 X80.757 Y104.243 A80.8331
+G1 X80.240 Y103.653 A80.8590
+G1 X79.804 Y103.000 A80.8849
+G1 X79.457 Y102.296 A80.9108
+G1 X79.204 Y101.553 A80.9367
+G1 X79.051 Y100.783 A80.9626
+G1 X79.000 Y100.000 A80.9885
+G1 X79.051 Y99.217 A81.0144
+G1 X79.204 Y98.447 A81.0403
+G1 X79.457 Y97.704 A81.0662
+G1 X79.804 Y97.000 A81.0921
+G1 X80.240 Y96.347 A81.1180
+G1 X80.757 Y95.757 A81.1439
+G1 X81.347 Y95.240 A81.1698
+G1 X82.000 Y94.804 A81.1957
+G1 X82.704 Y94.457 A81.2216
+G1 X83.447 Y94.204 A81.2475
+G1 X84.217 Y94.051 A81.2734
+G1 X85.000 Y94.000 A81.2993
+G1 X85.783 Y94.051 A81.3252
+G1 X86.553 Y94.204 A81.3511
+G1 X87.296 Y94.457 A81.3770
+G1 X88.000 Y94.804 A81.4029
+G1 X88.653 Y95.240 A81.4288
+G1 X89.243 Y95.757 A81.4547
+G1 X89.760 Y96.347 A81.4806
+G1 X90.196 Y97.000 A81.5065
+G1 X90.543 Y97.704 A81.5324
+G1 X90.796 Y98.447 A81.5583
+G1 X90.949 Y99.217 A81.5842
+G1 X91.000 Y100.000 A81.6101
+G1 A80.6101 F2400
+G0 X91.450 Y100.000
+G1 A81.6101 F2400
+G1 F2400
+G1 X91.395 Y100.842 A81.6379
+G1 X91.230 Y101.669 A81.6657
+G1 X90.959 Y102.468 A81.6936
+G1 X90.586 Y103.225 A81.7214
+G1 X90.117 Y103.927 A81.7493
+G1 X89.561 Y104.561 A81.7771
+G1 X88.927 Y105.117 A81.8049
+G1 X88.225 Y105.586 A81.8328
+G1 X87.468 Y105.959 A81.8606
+G1 X86.669 Y106.230 A81.8885
+G1 X85.842 Y106.395 A81.9163
+G1 X85.000 Y106.450 A81.9442
+G1 X84.158 Y106.395 A81.9720
+G1 X83.331 Y106.230 A81.9998
+G1 X82.532 Y105.959 A82.0277
+G1 X81.775 Y105.586 A82.0555
+G1 X81.073 Y105.117 A82.0834
+G1 X80.439 Y104.561 A82.1112
+G1 X79.883 Y103.927 A82.1391
+G1 X79.414 Y103.225 A82.1669
+G1 X79.041 Y102.468 A82.1947
+G1 X78.770 Y101.669 A82.2226
+G1 X78.605 Y100.842 A82.2504
+G1 X78.550 Y100.000 A82.2783
+G1 X78.605 Y99.158 A82.3061
+G1 X78.770 Y98.331 A82.3339
+G1 X79.041 Y97.532 A82.3618
+G1 X79.414 Y96.775 A82.3896
+G1 X79.883 Y96.073 A82.4175
+G1 X80.439 Y95.439 A82.4453
+G1 X81.073 Y94.883 A82.4732
+G1 X81.775 Y94.414 A82.5010
+G1 X82.532 Y94.041 A82.5288
+G1 X83.331 Y93.770 A82.5567
+G1 X84.158 Y93.605 A82.5845
+G1 X85.000 Y93.550 A82.6124
+G1 X85.842 Y93.605 A82.6402
+G1 X86.669 Y93.770 A82.6681
+G1 X87.468 Y94.041 A82.6959
+G1 X88.225 Y94.414 A82.7237
+G1 X88.927 Y94.883 A82.7516
+G1 X89.561 Y95.439 A82.7794
+G1 X90.117 Y96.073 A82.8073
+G1 X90.586 Y96.775 A82.8351
+G1 X90.959 Y97.532 A82.8629
+G1 X91.230 Y98.331 A82.8908
+G1 X91.395 Y99.158 A82.9186
+G1 X91.450 Y100.000 A82.9465
+G0 Z1.10
+G1 A81.9465 F2400
+G0 X130.000 Y112.000
+G1 A82.9465 F2400
+G1 F2400
+G1 X129.932 Y113.044 A82.9810
+G1 X129.727 Y114.071 A83.0155
+G1 X129.391 Y115.061 A83.0501
+G1 X128.928 Y116.000 A83.0846
+G1 X128.347 Y116.870 A83.1191
+G1 X127.657 Y117.657 A83.1537
+G1 X126.870 Y118.347 A83.1882
+G1 X126.000 Y118.928 A83.2227
+G1 X125.061 Y119.391 A83.2573
+G1 X124.071 Y119.727 A83.2918
+G1 X123.044 Y119.932 A83.3263
+G1 X122.000 Y120.000 A83.3609
+G1 X78.000 Y120.000 A84.8129
+G1 X76.956 Y119.932 A84.8474
+G1 X75.929 Y119.727 A84.8819
+G1 X74.939 Y119.391 A84.9165
+G1 X74.000 Y118.928 A84.9510
+G1 X73.130 Y118.347 A84.9855
+G1 X72.343 Y117.657 A85.0201
+G1 X71.653 Y116.870 A85.0546
+G1 X71.072 Y116.000 A85.0891
+G1 X70.609 Y115.061 A85.1237
+G1 X70.273 Y114.071 A85.1582
+G1 X70.068 Y113.044 A85.1927
+G1 X70.000 Y112.000 A85.2273
+G1 X70.000 Y88.000 A86.0193
+G1 X70.068 Y86.956 A86.0538
+G1 X70.273 Y85.929 A86.0883
+G1 X70.609 Y84.939 A86.1229
+G1 X71.072 Y84.000 A86.1574
+G1 X71.653 Y83.130 A86.1919
+G1 X72.343 Y82.343 A86.2265
+G1 X73.130 Y81.653 A86.2610
+G1 X74.000 Y81.072 A86.2955
+G1 X74.939 Y80.609 A86.3301
+G1 X75.929 Y80.273 A86.3646
+G1 X76.956 Y80.068 A86.3991
+G1 X78.000 Y80.000 A86.4337
+G1 X122.000 Y80.000 A87.8857
+G1 X123.044 Y80.068 A87.9202
+G1 X124.071 Y80.273 A87.9547
+G1 X125.061 Y80.609 A87.9893
+G1 X126.000 Y81.072 A88.0238
+G1 X126.870 Y81.653 A88.0583
+G1 X127.657 Y82.343 A88.0929
+G1 X128.347 Y83.130 A88.1274
+G1 X128.928 Y84.000 A88.1619
+G1 X129.391 Y84.939 A88.1965
+G1 X129.727 Y85.929 A88.2310
+G1 X129.932 Y86.956 A88.2655
+G1 X130.000 Y88.000 A88.3001
+G1 X130.000 Y112.000 A89.0921
+G1 A88.0921 F2400
+G0 X129.550 Y112.000
+G1 A89.0921 F2400
+G1 F2400
+G1 X129.485 Y112.985 A89.1246
+G1 X129.293 Y113.954 A89.1572
+G1 X128.975 Y114.889 A89.1898
+G1 X128.538 Y115.775 A89.2224
+G1 X127.990 Y116.596 A89.2550
+G1 X127.339 Y117.339 A89.2876
+G1 X126.596 Y117.990 A89.3202
+G1 X125.775 Y118.538 A89.3528
+G1 X124.889 Y118.975 A89.3854
+G1 X123.954 Y119.293 A89.4180
+G1 X122.985 Y119.485 A89.4505
+G1 X122.000 Y119.550 A89.4831
+G1 X78.000 Y119.550 A90.9351
+G1 X77.015 Y119.485 A90.9677
+G1 X76.046 Y119.293 A91.0003
+G1 X75.111 Y118.975 A91.0329
+G1 X74.225 Y118.538 A91.0655
+G1 X73.404 Y117.990 A91.0981
+G1 X72.661 Y117.339 A91.1307
+G1 X72.010 Y116.596 A91.1633
+G1 X71.462 Y115.775 A91.1959
+G1 X71.025 Y114.889 A91.2284
+G1 X70.707 Y113.954 A91.2610
+G1 X70.515 Y112.985 A91.2936
+G1 X70.450 Y112.000 A91.3262
+G1 X70.450 Y88.000 A92.1182
+G1 X70.515 Y87.015 A92.1508
+G1 X70.707 Y86.046 A92.1834
+G1 X71.025 Y85.111 A92.2160
+G1 X71.462 Y84.225 A92.2486
+G1 X72.010 Y83.404 A92.2812
+G1 X72.661 Y82.661 A92.3138
+G1 X73.404 Y82.010 A92.3464
+G1 X74.225 Y81.462 A92.3789
+G1 X75.111 Y81.025 A92.4115
+G1 X76.046 Y80.707 A92.4441
+G1 X77.015 Y80.515 A92.4767
+G1 X78.000 Y80.450 A92.5093
+G1 X122.000 Y80.450 A93.9613
+G1 X122.985 Y80.515 A93.9939
+G1 X123.954 Y80.707 A94.0265
+G1 X124.889 Y81.025 A94.0591
+G1 X125.775 Y81.462 A94.0917
+G1 X126.596 Y82.010 A94.1243
+G1 X127.339 Y82.661 A94.1568
+G1 X127.990 Y83.404 A94.1894
+G1 X128.538 Y84.225 A94.2220
+G1 X128.975 Y85.111 A94.2546
+G1 X129.293 Y86.046 A94.2872
+G1 X129.485 Y87.015 A94.3198
+G1 X129.550 Y88.000 A94.3524
+G1 X129.550 Y112.000 A95.1444
+G1 A94.1444 F2400
+G0 X129.100 Y112.000
+G1 A95.1444 F2400
+G1 F2400
+G1 X129.039 Y112.927 A95.1750
+G1 X128.858 Y113.838 A95.2057
+G1 X128.560 Y114.717 A95.2363
+G1 X128.149 Y115.550 A95.2670
+G1 X127.633 Y116.322 A95.2976
+G1 X127.020 Y117.020 A95.3283
+G1 X126.322 Y117.633 A95.3589
+G1 X125.550 Y118.149 A95.3896
+G1 X124.717 Y118.560 A95.4202
+G1 X123.838 Y118.858 A95.4509
+G1 X122.927 Y119.039 A95.4815
+G1 X122.000 Y119.100 A95.5122
+G1 X78.000 Y119.100 A96.9642
+G1 X77.073 Y119.039 A96.9948
+G1 X76.162 Y118.858 A97.0255
+G1 X75.283 Y118.560 A97.0561
+G1 X74.450 Y118.149 A97.0868
+G1 X73.678 Y117.633 A97.1174
+G1 X72.980 Y117.020 A97.1481
+G1 X72.367 Y116.322 A97.1787
+G1 X71.851 Y115.550 A97.2093
+G1 X71.440 Y114.717 A97.2400
+G1 X71.142 Y113.838 A97.2706
+G1 X70.961 Y112.927 A97.3013
+G1 X70.900 Y112.000 A97.3319
+G1 X70.900 Y88.000 A98.1239
+G1 X70.961 Y87.073 A98.1546
+G1 X71.142 Y86.162 A98.1852
+G1 X71.440 Y85.283 A98.2159
+G1 X71.851 Y84.450 A98.2465
+G1 X72.367 Y83.678 A98.2772
+G1 X72.980 Y82.980 A98.3078
+G1 X73.678 Y82.367 A98.3385
+G1 X74.450 Y81.851 A98.3691
+G1 X75.283 Y81.440 A98.3998
+G1 X76.162 Y81.142 A98.4304
+G1 X77.073 Y80.961 A98.4611
+G1 X78.000 Y80.900 A98.4917
+G1 X122.000 Y80.900 A99.9437
+G1 X122.927 Y80.961 A99.9744
+G1 X123.838 Y81.142 A100.0050
+G1 X124.717 Y81.440 A100.0357
+G1 X125.550 Y81.851 A100.0663
+G1 X126.322 Y82.367 A100.0970
+G1 X127.020 Y82.980 A100.1276
+G1 X127.633 Y83.678 A100.1582
+G1 X128.149 Y84.450 A100.1889
+G1 X128.560 Y85.283 A100.2195
+G1 X128.858 Y86.162 A100.2502
+G1 X129.039 Y87.073 A100.2808
+G1 X129.100 Y88.000 A100.3115
+G1 X129.100 Y112.000 A101.1035
+G1 A100.1035 F2400
+G0 X91.000 Y100.000
+G1 A101.1035 F2400
+G1 F2400
+G1 X90.949 Y100.783 A101.1294
+G1 X90.796 Y101.553 A101.1553
+G1 X90.543 Y102.296 A101.1812
+G1 X90.196 Y103.000 A101.2071
+G1 X89.760 Y103.653 A101.2330
+G1 X89.243 Y104.243 A101.2589
+G1 X88.653 Y104.760 A101.2848
+G1 X88.000 Y105.196 A101.3107
+G1 X87.296 Y105.543 A101.3366
+G1 X86.553 Y105.796 A101.3625
+G1 X85.783 Y105.949 A101.3884
+G1 X85.000 Y106.000 A101.4143
+G1 X84.217 Y105.949 A101.4402
+G1 X83.447 Y105.796 A101.4661
+G1 X82.704 Y105.543 A101.4920
+G1 X82.000 Y105.196 A101.5179
+G1 X81.347 Y104.760 A101.5438
+G1 X80.757 Y104.243 A101.5697
+G1 X80.240 Y103.653 A101.5956
+G1 X79.804 Y103.000 A101.6215
+G1 X79.457 Y102.296 A101.6474
+G1 X79.204 Y101.553 A101.6733
+G1 X79.051 Y100.783 A101.6992
+G1 X79.000 Y100.000 A101.7251
+G1 X79.051 Y99.217 A101.7510
+G1 X79.204 Y98.447 A101.7769
+G1 X79.457 Y97.704 A101.8028
+G1 X79.804 Y97.000 A101.8287
+G1 X80.240 Y96.347 A101.8546
+G1 X80.757 Y95.757 A101.8805
+G1 X81.347 Y95.240 A101.9064
+G1 X82.000 Y94.804 A101.9323
+G1 X82.704 Y94.457 A101.9582
+G1 X83.447 Y94.204 A101.9841
+G1 X84.217 Y94.051 A102.0100
+G1 X85.000 Y94.000 A102.0359
+G1 X85.783 Y94.051 A102.0618
+G1 X86.553 Y94.204 A102.0877
+G1 X87.296 Y94.457 A102.1136
+G1 X88.000 Y94.804 A102.1395
+G1 X88.653 Y95.240 A102.1654
+G1 X89.243 Y95.757 A102.1913
+G1 X89.760 Y96.347 A102.2172
+G1 X90.196 Y97.000 A102.2431
+G1 X90.543 Y97.704 A102.2690
+G1 X90.796 Y98.447 A102.2949
+G1 X90.949 Y99.217 A102.3208
+G1 X91.000 Y100.000 A102.3467
+G1 A101.3467 F2400
+G0 X91.450 Y100.000
+G1 A102.3467 F2400
+G1 F2400
+G1 X91.395 Y100.842 A102.3745
+G1 X91.230 Y101.669 A102.4024
+G1 X90.959 Y102.468 A102.4302
+G1 X90.586 Y103.225 A102.4580
+G1 X90.117 Y103.927 A102.4859
+G1 X89.561 Y104.561 A102.5137
+G1 X88.927 Y105.117 A102.5416
+G1 X88.225 Y105.586 A102.5694
+G1 X87.468 Y105.959 A102.5973
+G1 X86.669 Y106.230 A102.6251
+G1 X85.842 Y106.395 A102.6529
+G1 X85.000 Y106.450 A102.6808
+G1 X84.158 Y106.395 A102.7086
+G1 X83.331 Y106.230 A102.7365
+G1 X82.532 Y105.959 A102.7643
+G1 X81.775 Y105.586 A102.7921
+G1 X81.073 Y105.117 A102.8200
+G1 X80.439 Y104.561 A102.8478
+G1 X79.883 Y103.927 A102.8757
+G1 X79.414 Y103.225 A102.9035
+G1 X79.041 Y102.468 A102.9314
+G1 X78.770 Y101.669 A102.9592
+G1 X78.605 Y100.842 A102.9870
+G1 X78.550 Y100.000 A103.0149
+G1 X78.605 Y99.158 A103.0427
+G1 X78.770 Y98.331 A103.0706
+G1 X79.041 Y97.532 A103.0984
+G1 X79.414 Y96.775 A103.1263
+G1 X79.883 Y96.073 A103.1541
+G1 X80.439 Y95.439 A103.1819
+G1 X81.073 Y94.883 A103.2098
+G1 X81.775 Y94.414 A103.2376
+G1 X82.532 Y94.041 A103.2655
+G1 X83.331 Y93.770 A103.2933
+G1 X84.158 Y93.605 A103.3211
+G1 X85.000 Y93.550 A103.3490
+G1 X85.842 Y93.605 A103.3768
+G1 X86.669 Y93.770 A103.4047
+G1 X87.468 Y94.041 A103.4325
+G1 X88.225 Y94.414 A103.4604
+G1 X88.927 Y94.883 A103.4882
+G1 X89.561 Y95.439 A103.5160
+G1 X90.117 Y96.073 A103.5439
+G1 X90.586 Y96.775 A103.5717
+G1 X90.959 Y97.532 A103.5996
+G1 X91.230 Y98.331 A103.6274
+G1 X91.395 Y99.158 A103.6553
+G1 X91.450 Y100.000 A103.6831
+G0 Z1.30
+G1 A102.6831 F2400
+G0 X130.000 Y112.000
+G1 A103.6831 F2400
+G1 F2400
+G1 X129.932 Y113.044 A103.7176
+G1 X129.727 Y114.071 A103.7522
+G1 X129.391 Y115.061 A103.7867
+G1 X128.928 Y116.000 A103.8212
+G1 X128.347 Y116.870 A103.8558
+G1 X127.657 Y117.657 A103.8903
+G1 X126.870 Y118.347 A103.9248
+G1 X126.000 Y118.928 A103.9594
+G1 X125.061 Y119.391 A103.9939
+G1 X124.071 Y119.727 A104.0284
+G1 X123.044 Y119.932 A104.0630
+G1 X122.000 Y120.000 A104.0975
+G1 X78.000 Y120.000 A105.5495
+G1 X76.956 Y119.932 A105.5840
+G1 X75.929 Y119.727 A105.6186
+G1 X74.939 Y119.391 A105.6531
+G1 X74.000 Y118.928 A105.6876
+G1 X73.130 Y118.347 A105.7222
+G1 X72.343 Y117.657 A105.7567
+G1 X71.653 Y116.870 A105.7912
+G1 X71.072 Y116.000 A105.8258
+G1 X70.609 Y115.061 A105.8603
+G1 X70.273 Y114.071 A105.8948
+G1 X70.068 Y113.044 A105.9293
+G1 X70.000 Y112.000 A105.9639
+G1 X70.000 Y88.000 A106.7559
+G1 X70.068 Y86.956 A106.7904
+G1 X70.273 Y85.929 A106.8249
+G1 X70.609 Y84.939 A106.8595
+G1 X71.072 Y84.000 A106.8940
+G1 X71.653 Y83.130 A106.9285
+G1 X72.343 Y82.343 A106.9631
+G1 X73.130 Y81.653 A106.9976
+G1 X74.000 Y81.072 A107.0321
+G1 X74.939 Y80.609 A107.0667
+G1 X75.929 Y80.273 A107.1012
+G1 X76.956 Y80.068 A107.1357
+G1 X78.000 Y80.000 A107.1703
+G1 X122.000 Y80.000 A108.6223
+G1 X123.044 Y80.068 A108.6568
+G1 X124.071 Y80.273 A108.6913
+G1 X125.061 Y80.609 A108.7259
+G1 X126.000 Y81.072 A108.7604
+G1 X126.870 Y81.653 A108.7949
+G1 X127.657 Y82.343 A108.8295
+G1 X128.347 Y83.130 A108.8640
+G1 X128.928 Y84.000 A108.8985
+G1 X129.391 Y84.939 A108.9331
+G1 X129.727 Y85.929 A108.9676
+G1 X129.932 Y86.956 A109.0021
+G1 X130.000 Y88.000 A109.0367
+G1 X130.000 Y112.000 A109.8287
+G1 A108.8287 F2400
+G0 X129.550 Y112.000
+G1 A109.8287 F2400
+G1 F2400
+G1 X129.485 Y112.985 A109.8613
+G1 X129.293 Y113.954 A109.8939
+G1 X128.975 Y114.889 A109.9264
+G1 X128.538 Y115.775 A109.9590
+G1 X127.990 Y116.596 A109.9916
+G1 X127.339 Y117.339 A110.0242
+G1 X126.596 Y117.990 A110.0568
+G1 X125.775 Y118.538 A110.0894
+G1 X124.889 Y118.975 A110.1220
+G1 X123.954 Y119.293 A110.1546
+G1 X122.985 Y119.485 A110.1872
+G1 X122.000 Y119.550 A110.2198
+G1 X78.000 Y119.550 A111.6718
+G1 X77.015 Y119.485 A111.7043
+G1 X76.046 Y119.293 A111.7369
+G1 X75.111 Y118.975 A111.7695
+G1 X74.225 Y118.538 A111.8021
+G1 X73.404 Y117.990 A111.8347
+G1 X72.661 Y117.339 A111.8673
+G1 X72.010 Y116.596 A111.8999
+G1 X71.462 Y115.775 A111.9325
+G1 X71.025 Y114.889 A111.9651
+G1 X70.707 Y113.954 A111.9977
+G1 X70.515 Y112.985 A112.0302
+G1 X70.450 Y112.000 A112.0628
+G1 X70.450 Y88.000 A112.8548
+G1 X70.515 Y87.015 A112.8874
+G1 X70.707 Y86.046 A112.9200
+G1 X71.025 Y85.111 A112.9526
+G1 X71.462 Y84.225 A112.9852
+G1 X72.010 Y83.404 A113.0178
+G1 X72.661 Y82.661 A113.0504
+G1 X73.404 Y82.010 A113.0830
+G1 X74.225 Y81.462 A113.1156
+G1 X75.111 Y81.025 A113.1482
+G1 X76.046 Y80.707 A113.1807
+G1 X77.015 Y80.515 A113.2133
+G1 X78.000 Y80.450 A113.2459
+G1 X122.000 Y80.450 A114.6979
+G1 X122.985 Y80.515 A114.7305
+G1 X123.954 Y80.707 A114.7631
+G1 X124.889 Y81.025 A114.7957
+G1 X125.775 Y81.462 A114.8283
+G1 X126.596 Y82.010 A114.8609
+G1 X127.339 Y82.661 A114.8935
+G1 X127.990 Y83.404 A114.9261
+G1 X128.538 Y84.225 A114.9586
+G1 X128.975 Y85.111 A114.9912
+G1 X129.293 Y86.046 A115.0238
+G1 X129.485 Y87.015 A115.0564
+G1 X129.550 Y88.000 A115.0890
+G1 X129.550 Y112.000 A115.8810
+G1 A114.8810 F2400
+G0 X129.100 Y112.000
+G1 A115.8810 F2400
+G1 F2400
+G1 X129.039 Y112.927 A115.9117
+G1 X128.858 Y113.838 A115.9423
+G1 X128.560 Y114.717 A115.9730
+G1 X128.149 Y115.550 A116.0036
+G1 X127.633 Y116.322 A116.0342
+G1 X127.020 Y117.020 A116.0649
+G1 X126.322 Y117.633 A116.0955
+G1 X125.550 Y118.149 A116.1262
+G1 X124.717 Y118.560 A116.1568
+G1 X123.838 Y118.858 A116.1875
+G1 X122.927 Y119.039 A116.2181
+G1 X122.000 Y119.100 A116.2488
+G1 X78.000 Y119.100 A117.7008
+G1 X77.073 Y119.039 A117.7314
+G1 X76.162 Y118.858 A117.7621
+G1 X75.283 Y118.560 A117.7927
+G1 X74.450 Y118.149 A117.8234
+G1 X73.678 Y117.633 A117.8540
+G1 X72.980 Y117.020 A117.8847
+G1 X72.367 Y116.322 A117.9153
+G1 X71.851 Y115.550 A117.9460
+G1 X71.440 Y114.717 A117.9766
+G1 X71.142 Y113.838 A118.0073
+G1 X70.961 Y112.927 A118.0379
+G1 X70.900 Y112.000 A118.0686
+G1 X70.900 Y88.000 A118.8606
+G1 X70.961 Y87.073 A118.8912
+G1 X71.142 Y86.162 A118.9219
+G1 X71.440 Y85.283 A118.9525
+G1 X71.851 Y84.450 A118.9831
+G1 X72.367 Y83.678 A119.0138
+G1 X72.980 Y82.980 A119.0444
+G1 X73.678 Y82.367 A119.0751
+G1 X74.450 Y81.851 A119.1057
+G1 X75.283 Y81.440 A119.1364
+G1 X76.162 Y81.142 A119.1670
+G1 X77.073 Y80.961 A119.1977
+G1 X78.000 Y80.900 A119.2283
+G1 X122.000 Y80.900 A120.6803
+G1 X122.927 Y80.961 A120.7110
+G1 X123.838 Y81.142 A120.7416
+G1 X124.717 Y81.440 A120.7723
+G1 X125.550 Y81.851 A120.8029
+G1 X126.322 Y82.367 A120.8336
+G1 X127.020 Y82.980 A120.8642
+G1 X127.633 Y83.678 A120.8949
+G1 X128.149 Y84.450 A120.9255
+G1 X128.560 Y85.283 A120.9562
+G1 X128.858 Y86.162 A120.9868
+G1 X129.039 Y87.073 A121.0175
+G1 X129.100 Y88.000 A121.0481
+G1 X129.100 Y112.000 A121.8401
+G1 A120.8401 F2400
+G0 X91.000 Y100.000
+G1 A121.8401 F2400
+G1 F2400
+G1 X90.949 Y100.783 A121.8660
+G1 X90.796 Y101.553 A121.8919
+G1 X90.543 Y102.296 A121.9178
+G1 X90.196 Y103.000 A121.9437
+G1 X89.760 Y103.653 A121.9696
+G1 X89.243 Y104.243 A121.9955
+G1 X88.653 Y104.760 A122.0214
+G1 X88.000 Y105.196 A122.0473
+G1 X87.296 Y105.543 A122.0732
+G1 X86.553 Y105.796 A122.0991
+G1 X85.783 Y105.949 A122.1250
+G1 X85.000 Y106.000 A122.1509
+G1 X84.217 Y105.949 A122.1768
+G1 X83.447 Y105.796 A122.2027
+G1 X82.704 Y105.543 A122.2286
+G1 X82.000 Y105.196 A122.2545
+G1 X81.347 Y104.760 A122.2804
+G1 X80.757 Y104.243 A122.3063
+G1 X80.240 Y103.653 A122.3322
+G1 X79.804 Y103.000 A122.3581
+G1 X79.457 Y102.296 A122.3840
+G1 X79.204 Y101.553 A122.4099
+G1 X79.051 Y100.783 A122.4358
+G1 X79.000 Y100.000 A122.4617
+G1 X79.051 Y99.217 A122.4876
+G1 X79.204 Y98.447 A122.5135
+G1 X79.457 Y97.704 A122.5394
+G1 X79.804 Y97.000 A122.5653
+G1 X80.240 Y96.347 A122.5912
+G1 X80.757 Y95.757 A122.6171
+G1 X81.347 Y95.240 A122.6430
+G1 X82.000 Y94.804 A122.6689
+G1 X82.704 Y94.457 A122.6948
+G1 X83.447 Y94.204 A122.7207
+G1 X84.217 Y94.051 A122.7466
+G1 X85.000 Y94.000 A122.7725
+G1 X85.783 Y94.051 A122.7984
+G1 X86.553 Y94.204 A122.8243
+G1 X87.296 Y94.457 A122.8502
+G1 X88.000 Y94.804 A122.8761
+G1 X88.653 Y95.240 A122.9020
+G1 X89.243 Y95.757 A122.9279
+G1 X89.760 Y96.347 A122.9538
+G1 X90.196 Y97.000 A122.9797
+G1 X90.543 Y97.704 A123.0056
+G1 X90.796 Y98.447 A123.0315
+G1 X90.949 Y99.217 A123.0574
+G1 X91.000 Y100.000 A123.0833
+G1 A122.0833 F2400
+G0 X91.450 Y100.000
+G1 A123.0833 F2400
+G1 F2400
+G1 X91.395 Y100.842 A123.1111
+G1 X91.230 Y101.669 A123.1390
+G1 X90.959 Y102.468 A123.1668
+G1 X90.586 Y103.225 A123.1947
+G1 X90.117 Y103.927 A123.2225
+G1 X89.561 Y104.561 A123.2503
+G1 X88.927 Y105.117 A123.2782
+G1 X88.225 Y105.586 A123.3060
+G1 X87.468 Y105.959 A123.3339
+G1 X86.669 Y106.230 A123.3617
+G1 X85.842 Y106.395 A123.3896
+G1 X85.000 Y106.450 A123.4174
+G1 X84.158 Y106.395 A123.4452
+G1 X83.331 Y106.230 A123.4731
+G1 X82.532 Y105.959 A123.5009
+G1 X81.775 Y105.586 A123.5288
+G1 X81.073 Y105.117 A123.5566
+G1 X80.439 Y104.561 A123.5844
+G1 X79.883 Y103.927 A123.6123
+G1 X79.414 Y103.225 A123.6401
+G1 X79.041 Y102.468 A123.6680
+G1 X78.770 Y101.669 A123.6958
+G1 X78.605 Y100.842 A123.7237
+G1 X78.550 Y100.000 A123.7515
+G1 X78.605 Y99.158 A123.7793
+G1 X78.770 Y98.331 A123.8072
+G1 X79.041 Y97.532 A123.8350
+G1 X79.414 Y96.775 A123.8629
+G1 X79.883 Y96.073 A123.8907
+G1 X80.439 Y95.439 A123.9186
+G1 X81.073 Y94.883 A123.9464
+G1 X81.775 Y94.414 A123.9742
+G1 X82.532 Y94.041 A124.0021
+G1 X83.331 Y93.770 A124.0299
+G1 X84.158 Y93.605 A124.0578
+G1 X85.000 Y93.550 A124.0856
+G1 X85.842 Y93.605 A124.1134
+G1 X86.669 Y93.770 A124.1413
+G1 X87.468 Y94.041 A124.1691
+G1 X88.225 Y94.414 A124.1970
+G1 X88.927 Y94.883 A124.2248
+G1 X89.561 Y95.439 A124.2527
+G1 X90.117 Y96.073 A124.2805
+G1 X90.586 Y96.775 A124.3083
+G1 X90.959 Y97.532 A124.3362
+G1 X91.230 Y98.331 A124.3640
+G1 X91.395 Y99.158 A124.3919
+G1 X91.450 Y100.000 A124.4197
+G0 Z1.50
+G1 A123.4197 F2400
+G0 X130.000 Y112.000
+G1 A124.4197 F2400
+G1 F2400
+G1 X129.932 Y113.044 A124.4542
+G1 X129.727 Y114.071 A124.4888
+G1 X129.391 Y115.061 A124.5233
+G1 X128.928 Y116.000 A124.5578
+G1 X128.347 Y116.870 A124.5924
+G1 X127.657 Y117.657 A124.6269
+G1 X126.870 Y118.347 A124.6614
+G1 X126.000 Y118.928 A124.6960
+G1 X125.061 Y119.391 A124.7305
+G1 X124.071 Y119.727 A124.7650
+G1 X123.044 Y119.932 A124.7996
+G1 X122.000 Y120.000 A124.8341
+G1 X78.000 Y120.000 A126.2861
+G1 X76.956 Y119.932 A126.3206
+G1 X75.929 Y119.727 A126.3552
+G1 X74.939 Y119.391 A126.3897
+G1 X74.000 Y118.928 A126.4242
+G1 X73.130 Y118.347 A126.4588
+G1 X72.343 Y117.657 A126.4933
+G1 X71.653 Y116.870 A126.5278
+G1 X71.072 Y116.000 A126.5624
+G1 X70.609 Y115.061 A126.5969
+G1 X70.273 Y114.071 A126.6314
+G1 X70.068 Y113.044 A126.6660
+G1 X70.000 Y112.000 A126.7005
+G1 X70.000 Y88.000 A127.4925
+G1 X70.068 Y86.956 A127.5270
+G1 X70.273 Y85.929 A127.5616
+G1 X70.609 Y84.939 A127.5961
+G1 X71.072 Y84.000 A127.6306
+G1 X71.653 Y83.130 A127.6652
+G1 X72.343 Y82.343 A127.6997
+G1 X73.130 Y81.653 A127.7342
+G1 X74.000 Y81.072 A127.7688
+G1 X74.939 Y80.609 A127.8033
+G1 X75.929 Y80.273 A127.8378
+G1 X76.956 Y80.068 A127.8724
+G1 X78.000 Y80.000 A127.9069
+G1 X122.000 Y80.000 A129.3589
+G1 X123.044 Y80.068 A129.3934
+G1 X124.071 Y80.273 A129.4280
+G1 X125.061 Y80.609 A129.4625
+G1 X126.000 Y81.072 A129.4970
+G1 X126.870 Y81.653 A129.5316
+G1 X127.657 Y82.343 A129.5661
+G1 X128.347 Y83.130 A129.6006
+G1 X128.928 Y84.000 A129.6352
+G1 X129.391 Y84.939 A129.6697
+G1 X129.727 Y85.929 A129.7042
+G1 X129.932 Y86.956 A129.7388
+G1 X130.000 Y88.000 A129.7733
+G1 X130.000 Y112.000 A130.5653
+G1 A129.5653 F2400
+G0 X129.550 Y112.000
+G1 A130.5653 F2400
+G1 F2400
+G1 X129.485 Y112.985 A130.5979
+G1 X129.293 Y113.954 A130.6305
+G1 X128.975 Y114.889 A130.6631
+G1 X128.538 Y115.775 A130.6957
+G1 X127.990 Y116.596 A130.7282
+G1 X127.339 Y117.339 A130.7608
+G1 X126.596 Y117.990 A130.7934
+G1 X125.775 Y118.538 A130.8260
+G1 X124.889 Y118.975 A130.8586
+G1 X123.954 Y119.293 A130.8912
+G1 X122.985 Y119.485 A130.9238
+G1 X122.000 Y119.550 A130.9564
+G1 X78.000 Y119.550 A132.4084
+G1 X77.015 Y119.485 A132.4410
+G1 X76.046 Y119.293 A132.4736
+G1 X75.111 Y118.975 A132.5061
+G1 X74.225 Y118.538 A132.5387
+G1 X73.404 Y117.990 A132.5713
+G1 X72.661 Y117.339 A132.6039
+G1 X72.010 Y116.596 A132.6365
+G1 X71.462 Y115.775 A132.6691
+G1 X71.025 Y114.889 A132.7017
+G1 X70.707 Y113.954 A132.7343
+G1 X70.515 Y112.985 A132.7669
+G1 X70.450 Y112.000 A132.7995
+G1 X70.450 Y88.000 A133.5915
+G1 X70.515 Y87.015 A133.6240
+G1 X70.707 Y86.046 A133.6566
+G1 X71.025 Y85.111 A133.6892
+G1 X71.462 Y84.225 A133.7218
+G1 X72.010 Y83.404 A133.7544
+G1 X72.661 Y82.661 A133.7870
+G1 X73.404 Y82.010 A133.8196
+G1 X74.225 Y81.462 A133.8522
+G1 X75.111 Y81.025 A133.8848
+G1 X76.046 Y80.707 A133.9174
+G1 X77.015 Y80.515 A133.9500
+G1 X78.000 Y80.450 A133.9825
+G1 X122.000 Y80.450 A135.4345
+G1 X122.985 Y80.515 A135.4671
+G1 X123.954 Y80.707 A135.4997
+G1 X124.889 Y81.025 A135.5323
+G1 X125.775 Y81.462 A135.5649
+G1 X126.596 Y82.010 A135.5975
+G1 X127.339 Y82.661 A135.6301
+G1 X127.990 Y83.404 A135.6627
+G1 X128.538 Y84.225 A135.6953
+G1 X128.975 Y85.111 A135.7279
+G1 X129.293 Y86.046 A135.7604
+G1 X129.485 Y87.015 A135.7930
+G1 X129.550 Y88.000 A135.8256
+G1 X129.550 Y112.000 A136.6176
+G1 A135.6176 F2400
+G0 X129.100 Y112.000
+G1 A136.6176 F2400
+G1 F2400
+G1 X129.039 Y112.927 A136.6483
+G1 X128.858 Y113.838 A136.6789
+G1 X128.560 Y114.717 A136.7096
+G1 X128.149 Y115.550 A136.7402
+G1 X127.633 Y116.322 A136.7709
+G1 X127.020 Y117.020 A136.8015
+G1 X126.322 Y117.633 A136.8322
+G1 X125.550 Y118.149 A136.8628
+G1 X124.717 Y118.560 A136.8935
+G1 X123.838 Y118.858 A136.9241
+G1 X122.927 Y119.039 A136.9548
+G1 X122.000 Y119.100 A136.9854
+G1 X78.000 Y119.100 A138.4374
+G1 X77.073 Y119.039 A138.4680
+G1 X76.162 Y118.858 A138.4987
+G1 X75.283 Y118.560 A138.5293
+G1 X74.450 Y118.149 A138.5600
+G1 X73.678 Y117.633 A138.5906
+G1 X72.980 Y117.020 A138.6213
+G1 X72.367 Y116.322 A138.6519
+G1 X71.851 Y115.550 A138.6826
+G1 X71.440 Y114.717 A138.7132
+G1 X71.142 Y113.838 A138.7439
+G1 X70.961 Y112.927 A138.7745
+G1 X70.900 Y112.000 A138.8052
+G1 X70.900 Y88.000 A139.5972
+G1 X70.961 Y87.073 A139.6278
+G1 X71.142 Y86.162 A139.6585
+G1 X71.440 Y85.283 A139.6891
+G1 X71.851 Y84.450 A139.7198
+G1 X72.367 Y83.678 A139.7504
+G1 X72.980 Y82.980 A139.7811
+G1 X73.678 Y82.367 A139.8117
+G1 X74.450 Y81.851 A139.8424
+G1 X75.283 Y81.440 A139.8730
+G1 X76.162 Y81.142 A139.9037
+G1 X77.073 Y80.961 A139.9343
+G1 X78.000 Y80.900 A139.9650
+G1 X122.000 Y80.900 A141.4170
+G1 X122.927 Y80.961 A141.4476
+G1 X123.838 Y81.142 A141.4782
+G1 X124.717 Y81.440 A141.5089
+G1 X125.550 Y81.851 A141.5395
+G1 X126.322 Y82.367 A141.5702
+G1 X127.020 Y82.980 A141.6008
+G1 X127.633 Y83.678 A141.6315
+G1 X128.149 Y84.450 A141.6621
+G1 X128.560 Y85.283 A141.6928
+G1 X128.858 Y86.162 A141.7234
+G1 X129.039 Y87.073 A141.7541
+G1 X129.100 Y88.000 A141.7847
+G1 X129.100 Y112.000 A142.5767
+G1 A141.5767 F2400
+G0 X91.000 Y100.000
+G1 A142.5767 F2400
+G1 F2400
+G1 X90.949 Y100.783 A142.6026
+G1 X90.796 Y101.553 A142.6285
+G1 X90.543 Y102.296 A142.6544
+G1 X90.196 Y103.000 A142.6803
+G1 X89.760 Y103.653 A142.7062
+G1 X89.243 Y104.243 A142.7321
+G1 X88.653 Y104.760 A142.7580
+G1 X88.000 Y105.196 A142.7839
+G1 X87.296 Y105.543 A142.8098
+G1 X86.553 Y105.796 A142.8357
+G1 X85.783 Y105.949 A142.8616
+G1 X85.000 Y106.000 A142.8875
+G1 X84.217 Y105.949 A142.9134
+G1 X83.447 Y105.796 A142.9393
+G1 X82.704 Y105.543 A142.9652
+G1 X82.000 Y105.196 A142.9911
+G1 X81.347 Y104.760 A143.0170
+G1 X80.757 Y104.243 A143.0429
+G1 X80.240 Y103.653 A143.0688
+G1 X79.804 Y103.000 A143.0947
+G1 X79.457 Y102.296 A143.1206
+G1 X79.204 Y101.553 A143.1465
+G1 X79.051 Y100.783 A143.1724
+G1 X79.000 Y100.000 A143.1983
+G1 X79.051 Y99.217 A143.2242
+G1 X79.204 Y98.447 A143.2501
+G1 X79.457 Y97.704 A143.2760
+G1 X79.804 Y97.000 A143.3019
+G1 X80.240 Y96.347 A143.3278
+G1 X80.757 Y95.757 A143.3537
+G1 X81.347 Y95.240 A143.3796
+G1 X82.000 Y94.804 A143.4055
+G1 X82.704 Y94.457 A143.4314
+G1 X83.447 Y94.204 A143.4573
+G1 X84.217 Y94.051 A143.4832
+G1 X85.000 Y94.000 A143.5091
+G1 X85.783 Y94.051 A143.5350
+G1 X86.553 Y94.204 A143.5609
+G1 X87.296 Y94.457 A143.5868
+G1 X88.000 Y94.804 A143.6127
+G1 X88.653 Y95.240 A143.6386
+G1 X89.243 Y95.757 A143.6645
+G1 X89.760 Y96.347 A143.6904
+G1 X90.196 Y97.000 A143.7163
+G1 X90.543 Y97.704 A143.7422
+G1 X90.796 Y98.447 A143.7681
+G1 X90.949 Y99.217 A143.7940
+G1 X91.000 Y100.000 A143.8199
+G1 A142.8199 F2400
+G0 X91.450 Y100.000
+G1 A143.8199 F2400
+G1 F2400
+G1 X91.395 Y100.842 A143.8478
+G1 X91.230 Y101.669 A143.8756
+G1 X90.959 Y102.468 A143.9034
+G1 X90.586 Y103.225 A143.9313
+G1 X90.117 Y103.927 A143.9591
+G1 X89.561 Y104.561 A143.9870
+G1 X88.927 Y105.117 A144.0148
+G1 X88.225 Y105.586 A144.0426
+G1 X87.468 Y105.959 A144.0705
+G1 X86.669 Y106.230 A144.0983
+G1 X85.842 Y106.395 A144.1262
+G1 X85.000 Y106.450 A144.1540
+G1 X84.158 Y106.395 A144.1819
+G1 X83.331 Y106.230 A144.2097
+G1 X82.532 Y105.959 A144.2375
+G1 X81.775 Y105.586 A144.2654
+G1 X81.073 Y105.117 A144.2932
+G1 X80.439 Y104.561 A144.3211
+G1 X79.883 Y103.927 A144.3489
+G1 X79.414 Y103.225 A144.3768
+G1 X79.041 Y102.468 A144.4046
+G1 X78.770 Y101.669 A144.4324
+G1 X78.605 Y100.842 A144.4603
+G1 X78.550 Y100.000 A144.4881
+G1 X78.605 Y99.158 A144.5160
+G1 X78.770 Y98.331 A144.5438
+G1 X79.041 Y97.532 A144.5716
+G1 X79.414 Y96.775 A144.5995
+G1 X79.883 Y96.073 A144.6273
+G1 X80.439 Y95.439 A144.6552
+G1 X81.073 Y94.883 A144.6830
+G1 X81.775 Y94.414 A144.7109
+G1 X82.532 Y94.041 A144.7387
+G1 X83.331 Y93.770 A144.7665
+G1 X84.158 Y93.605 A144.7944
+G1 X85.000 Y93.550 A144.8222
+G1 X85.842 Y93.605 A144.8501
+G1 X86.669 Y93.770 A144.8779
+G1 X87.468 Y94.041 A144.9058
+G1 X88.225 Y94.414 A144.9336
+G1 X88.927 Y94.883 A144.9614
+G1 X89.561 Y95.439 A144.9893
+G1 X90.117 Y96.073 A145.0171
+G1 X90.586 Y96.775 A145.0450
+G1 X90.959 Y97.532 A145.0728
+G1 X91.230 Y98.331 A145.1006
+G1 X91.395 Y99.158 A145.1285
+G1 X91.450 Y100.000 A145.1563
+G0 Z1.70
+G1 A144.1563 F2400
+G0 X130.000 Y112.000
+G1 A145.1563 F2400
+G1 F2400
+G1 X129.932 Y113.044 A145.1909
+G1 X129.727 Y114.071 A145.2254
+G1 X129.391 Y115.061 A145.2599
+G1 X128.928 Y116.000 A145.2945
+G1 X128.347 Y116.870 A145.3290
+G1 X127.657 Y117.657 A145.3635
+G1 X126.870 Y118.347 A145.3981
+G1 X126.000 Y118.928 A145.4326
+G1 X125.061 Y119.391 A145.4671
+G1 X124.071 Y119.727 A145.5017
+G1 X123.044 Y119.932 A145.5362
+G1 X122.000 Y120.000 A145.5707
+G1 X78.000 Y120.000 A147.0227
+G1 X76.956 Y119.932 A147.0573
+G1 X75.929 Y119.727 A147.0918
+G1 X74.939 Y119.391 A147.1263
+G1 X74.000 Y118.928 A147.1609
+G1 X73.130 Y118.347 A147.1954
+G1 X72.343 Y117.657 A147.2299
+G1 X71.653 Y116.870 A147.2645
+G1 X71.072 Y116.000 A147.2990
+G1 X70.609 Y115.061 A147.3335
+G1 X70.273 Y114.071 A147.3681
+G1 X70.068 Y113.044 A147.4026
+G1 X70.000 Y112.000 A147.4371
+G1 X70.000 Y88.000 A148.2291
+G1 X70.068 Y86.956 A148.2637
+G1 X70.273 Y85.929 A148.2982
+G1 X70.609 Y84.939 A148.3327
+G1 X71.072 Y84.000 A148.3673
+G1 X71.653 Y83.130 A148.4018
+G1 X72.343 Y82.343 A148.4363
+G1 X73.130 Y81.653 A148.4708
+G1 X74.000 Y81.072 A148.5054
+G1 X74.939 Y80.609 A148.5399
+G1 X75.929 Y80.273 A148.5744
+G1 X76.956 Y80.068 A148.6090
+G1 X78.000 Y80.000 A148.6435
+G1 X122.000 Y80.000 A150.0955
+G1 X123.044 Y80.068 A150.1300
+G1 X124.071 Y80.273 A150.1646
+G1 X125.061 Y80.609 A150.1991
+G1 X126.000 Y81.072 A150.2336
+G1 X126.870 Y81.653 A150.2682
+G1 X127.657 Y82.343 A150.3027
+G1 X128.347 Y83.130 A150.3372
+G1 X128.928 Y84.000 A150.3718
+G1 X129.391 Y84.939 A150.4063
+G1 X129.727 Y85.929 A150.4408
+G1 X129.932 Y86.956 A150.4754
+G1 X130.000 Y88.000 A150.5099
+G1 X130.000 Y112.000 A151.3019
+G1 A150.3019 F2400
+G0 X129.550 Y112.000
+G1 A151.3019 F2400
+G1 F2400
+G1 X129.485 Y112.985 A151.3345
+G1 X129.293 Y113.954 A151.3671
+G1 X128.975 Y114.889 A151.3997
+G1 X128.538 Y115.775 A151.4323
+G1 X127.990 Y116.596 A151.4649
+G1 X127.339 Y117.339 A151.4974
+G1 X126.596 Y117.990 A151.5300
+G1 X125.775 Y118.538 A151.5626
+G1 X124.889 Y118.975 A151.5952
+G1 X123.954 Y119.293 A151.6278
+G1 X122.985 Y119.485 A151.6604
+G1 X122.000 Y119.550 A151.6930
+G1 X78.000 Y119.550 A153.1450
+G1 X77.015 Y119.485 A153.1776
+G1 X76.046 Y119.293 A153.2102
+G1 X75.111 Y118.975 A153.2428
+G1 X74.225 Y118.538 A153.2754
+G1 X73.404 Y117.990 A153.3079
+G1 X72.661 Y117.339 A153.3405
+G1 X72.010 Y116.596 A153.3731
+G1 X71.462 Y115.775 A153.4057
+G1 X71.025 Y114.889 A153.4383
+G1 X70.707 Y113.954 A153.4709
+G1 X70.515 Y112.985 A153.5035
+G1 X70.450 Y112.000 A153.5361
+G1 X70.450 Y88.000 A154.3281
+G1 X70.515 Y87.015 A154.3607
+G1 X70.707 Y86.046 A154.3933
+G1 X71.025 Y85.111 A154.4258
+G1 X71.462 Y84.225 A154.4584
+G1 X72.010 Y83.404 A154.4910
+G1 X72.661 Y82.661 A154.5236
+G1 X73.404 Y82.010 A154.5562
+G1 X74.225 Y81.462 A154.5888
+G1 X75.111 Y81.025 A154.6214
+G1 X76.046 Y80.707 A154.6540
+G1 X77.015 Y80.515 A154.6866
+G1 X78.000 Y80.450 A154.7192
+G1 X122.000 Y80.450 A156.1712
+G1 X122.985 Y80.515 A156.2038
+G1 X123.954 Y80.707 A156.2363
+G1 X124.889 Y81.025 A156.2689
+G1 X125.775 Y81.462 A156.3015
+G1 X126.596 Y82.010 A156.3341
+G1 X127.339 Y82.661 A156.3667
+G1 X127.990 Y83.404 A156.3993
+G1 X128.538 Y84.225 A156.4319
+G1 X128.975 Y85.111 A156.4645
+G1 X129.293 Y86.046 A156.4971
+G1 X129.485 Y87.015 A156.5297
+G1 X129.550 Y88.000 A156.5622
+G1 X129.550 Y112.000 A157.3542
+G1 A156.3542 F2400
+G0 X129.100 Y112.000
+G1 A157.3542 F2400
+G1 F2400
+G1 X129.039 Y112.927 A157.3849
+G1 X128.858 Y113.838 A157.4155
+G1 X128.560 Y114.717 A157.4462
+G1 X128.149 Y115.550 A157.4768
+G1 X127.633 Y116.322 A157.5075
+G1 X127.020 Y117.020 A157.5381
+G1 X126.322 Y117.633 A157.5688
+G1 X125.550 Y118.149 A157.5994
+G1 X124.717 Y118.560 A157.6301
+G1 X123.838 Y118.858 A157.6607
+G1 X122.927 Y119.039 A157.6914
+G1 X122.000 Y119.100 A157.7220
+G1 X78.000 Y119.100 A159.1740
+G1 X77.073 Y119.039 A159.2047
+G1 X76.162 Y118.858 A159.2353
+G1 X75.283 Y118.560 A159.2660
+G1 X74.450 Y118.149 A159.2966
+G1 X73.678 Y117.633 A159.3273
+G1 X72.980 Y117.020 A159.3579
+G1 X72.367 Y116.322 A159.3886
+G1 X71.851 Y115.550 A159.4192
+G1 X71.440 Y114.717 A159.4499
+G1 X71.142 Y113.838 A159.4805
+G1 X70.961 Y112.927 A159.5111
+G1 X70.900 Y112.000 A159.5418
+G1 X70.900 Y88.000 A160.3338
+G1 X70.961 Y87.073 A160.3644
+G1 X71.142 Y86.162 A160.3951
+G1 X71.440 Y85.283 A160.4257
+G1 X71.851 Y84.450 A160.4564
+G1 X72.367 Y83.678 A160.4870
+G1 X72.980 Y82.980 A160.5177
+G1 X73.678 Y82.367 A160.5483
+G1 X74.450 Y81.851 A160.5790
+G1 X75.283 Y81.440 A160.6096
+G1 X76.162 Y81.142 A160.6403
+G1 X77.073 Y80.961 A160.6709
+G1 X78.000 Y80.900 A160.7016
+G1 X122.000 Y80.900 A162.1536
+G1 X122.927 Y80.961 A162.1842
+G1 X123.838 Y81.142 A162.2149
+G1 X124.717 Y81.440 A162.2455
+G1 X125.550 Y81.851 A162.2762
+G1 X126.322 Y82.367 A162.3068
+G1 X127.020 Y82.980 A162.3375
+G1 X127.633 Y83.678 A162.3681
+G1 X128.149 Y84.450 A162.3988
+G1 X128.560 Y85.283 A162.4294
+G1 X128.858 Y86.162 A162.4600
+G1 X129.039 Y87.073 A162.4907
+G1 X129.100 Y88.000 A162.5213
+G1 X129.100 Y112.000 A163.3133
+G1 A162.3133 F2400
+G0 X91.000 Y100.000
+G1 A163.3133 F2400
+G1 F2400
+G1 X90.949 Y100.783 A163.3392
+G1 X90.796 Y101.553 A163.3651
+G1 X90.543 Y102.296 A163.3910
+G1 X90.196 Y103.000 A163.4169
+G1 X89.760 Y103.653 A163.4428
+G1 X89.243 Y104.243 A163.4687
+G1 X88.653 Y104.760 A163.4946
+G1 X88.000 Y105.196 A163.5205
+G1 X87.296 Y105.543 A163.5464
+G1 X86.553 Y105.796 A163.5723
+G1 X85.783 Y105.949 A163.5982
+G1 X85.000 Y106.000 A163.6241
+G1 X84.217 Y105.949 A163.6500
+G1 X83.447 Y105.796 A163.6759
+G1 X82.704 Y105.543 A163.7018
+G1 X82.000 Y105.196 A163.7277
+G1 X81.347 Y104.760 A163.7536
+G1 X80.757 Y104.243 A163.7795
+G1 X80.240 Y103.653 A163.8054
+G1 X79.804 Y103.000 A163.8313
+G1 X79.457 Y102.296 A163.8572
+G1 X79.204 Y101.553 A163.8831
+G1 X79.051 Y100.783 A163.9090
+G1 X79.000 Y100.000 A163.9349
+G1 X79.051 Y99.217 A163.9608
+G1 X79.204 Y98.447 A163.9867
+G1 X79.457 Y97.704 A164.0126
+G1 X79.804 Y97.000 A164.0385
+G1 X80.240 Y96.347 A164.0644
+G1 X80.757 Y95.757 A164.0903
+G1 X81.347 Y95.240 A164.1162
+G1 X82.000 Y94.804 A164.1421
+G1 X82.704 Y94.457 A164.1680
+G1 X83.447 Y94.204 A164.1939
+G1 X84.217 Y94.051 A164.2198
+G1 X85.000 Y94.000 A164.2457
+G1 X85.783 Y94.051 A164.2716
+G1 X86.553 Y94.204 A164.2975
+G1 X87.296 Y94.457 A164.3234
+G1 X88.000 Y94.804 A164.3493
+G1 X88.653 Y95.240 A164.3752
+G1 X89.243 Y95.757 A164.4011
+G1 X89.760 Y96.347 A164.4270
+G1 X90.196 Y97.000 A164.4529
+G1 X90.543 Y97.704 A164.4788
+G1 X90.796 Y98.447 A164.5047
+G1 X90.949 Y99.217 A164.5306
+G1 X91.000 Y100.000 A164.5565
+G1 A163.5565 F2400
+G0 X91.450 Y100.000
+G1 A164.5565 F2400
+G1 F2400
+G1 X91.395 Y100.842 A164.5844
+G1 X91.230 Y101.669 A164.6122
+G1 X90.959 Y102.468 A164.6401
+G1 X90.586 Y103.225 A164.6679
+G1 X90.117 Y103.927 A164.6957
+G1 X89.561 Y104.561 A164.7236
+G1 X88.927 Y105.117 A164.7514
+G1 X88.225 Y105.586 A164.7793
+G1 X87.468 Y105.959 A164.8071
+G1 X86.669 Y106.230 A164.8349
+G1 X85.842 Y106.395 A164.8628
+G1 X85.000 Y106.450 A164.8906
+G1 X84.158 Y106.395 A164.9185
+G1 X83.331 Y106.230 A164.9463
+G1 X82.532 Y105.959 A164.9742
+G1 X81.775 Y105.586 A165.0020
+G1 X81.073 Y105.117 A165.0298
+G1 X80.439 Y104.561 A165.0577
+G1 X79.883 Y103.927 A165.0855
+G1 X79.414 Y103.225 A165.1134
+G1 X79.041 Y102.468 A165.1412
+G1 X78.770 Y101.669 A165.1691
+G1 X78.605 Y100.842 A165.1969
+G1 X78.550 Y100.000 A165.2247
+G1 X78.605 Y99.158 A165.2526
+G1 X78.770 Y98.331 A165.2804
+G1 X79.041 Y97.532 A165.3083
+G1 X79.414 Y96.775 A165.3361
+G1 X79.883 Y96.073 A165.3639
+G1 X80.439 Y95.439 A165.3918
+G1 X81.073 Y94.883 A165.4196
+G1 X81.775 Y94.414 A165.4475
+G1 X82.532 Y94.041 A165.4753
+G1 X83.331 Y93.770 A165.5032
+G1 X84.158 Y93.605 A165.5310
+G1 X85.000 Y93.550 A165.5588
+G1 X85.842 Y93.605 A165.5867
+G1 X86.669 Y93.770 A165.6145
+G1 X87.468 Y94.041 A165.6424
+G1 X88.225 Y94.414 A165.6702
+G1 X88.927 Y94.883 A165.6981
+G1 X89.561 Y95.439 A165.7259
+G1 X90.117 Y96.073 A165.7537
+G1 X90.586 Y96.775 A165.7816
+G1 X90.959 Y97.532 A165.8094
+G1 X91.230 Y98.331 A165.8373
+G1 X91.395 Y99.158 A165.8651
+G1 X91.450 Y100.000 A165.8929
+G0 Z1.90
+G1 A164.8929 F2400
+G0 X130.000 Y112.000
+G1 A165.8929 F2400
+G1 F2400
+G1 X129.932 Y113.044 A165.9275
+G1 X129.727 Y114.071 A165.9620
+G1 X129.391 Y115.061 A165.9965
+G1 X128.928 Y116.000 A166.0311
+G1 X128.347 Y116.870 A166.0656
+G1 X127.657 Y117.657 A166.1001
+G1 X126.870 Y118.347 A166.1347
+G1 X126.000 Y118.928 A166.1692
+G1 X125.061 Y119.391 A166.2037
+G1 X124.071 Y119.727 A166.2383
+G1 X123.044 Y119.932 A166.2728
+G1 X122.000 Y120.000 A166.3073
+G1 X78.000 Y120.000 A167.7593
+G1 X76.956 Y119.932 A167.7939
+G1 X75.929 Y119.727 A167.8284
+G1 X74.939 Y119.391 A167.8629
+G1 X74.000 Y118.928 A167.8975
+G1 X73.130 Y118.347 A167.9320
+G1 X72.343 Y117.657 A167.9665
+G1 X71.653 Y116.870 A168.0011
+G1 X71.072 Y116.000 A168.0356
+G1 X70.609 Y115.061 A168.0701
+G1 X70.273 Y114.071 A168.1047
+G1 X70.068 Y113.044 A168.1392
+G1 X70.000 Y112.000 A168.1737
+G1 X70.000 Y88.000 A168.9657
+G1 X70.068 Y86.956 A169.0003
+G1 X70.273 Y85.929 A169.0348
+G1 X70.609 Y84.939 A169.0693
+G1 X71.072 Y84.000 A169.1039
+G1 X71.653 Y83.130 A169.1384
+G1 X72.343 Y82.343 A169.1729
+G1 X73.130 Y81.653 A169.2075
+G1 X74.000 Y81.072 A169.2420
+G1 X74.939 Y80.609 A169.2765
+G1 X75.929 Y80.273 A169.3111
+G1 X76.956 Y80.068 A169.3456
+G1 X78.000 Y80.000 A169.3801
+G1 X122.000 Y80.000 A170.8321
+G1 X123.044 Y80.068 A170.8667
+G1 X124.071 Y80.273 A170.9012
+G1 X125.061 Y80.609 A170.9357
+G1 X126.000 Y81.072 A170.9703
+G1 X126.870 Y81.653 A171.0048
+G1 X127.657 Y82.343 A171.0393
+G1 X128.347 Y83.130 A171.0739
+G1 X128.928 Y84.000 A171.1084
+G1 X129.391 Y84.939 A171.1429
+G1 X129.727 Y85.929 A171.1775
+G1 X129.932 Y86.956 A171.2120
+G1 X130.000 Y88.000 A171.2465
+G1 X130.000 Y112.000 A172.0385
+G1 A171.0385 F2400
+G0 X129.550 Y112.000
+G1 A172.0385 F2400
+G1 F2400
+G1 X129.485 Y112.985 A172.0711
+G1 X129.293 Y113.954 A172.1037
+G1 X128.975 Y114.889 A172.1363
+G1 X128.538 Y115.775 A172.1689
+G1 X127.990 Y116.596 A172.2015
+G1 X127.339 Y117.339 A172.2341
+G1 X126.596 Y117.990 A172.2667
+G1 X125.775 Y118.538 A172.2992
+G1 X124.889 Y118.975 A172.3318
+G1 X123.954 Y119.293 A172.3644
+G1 X122.985 Y119.485 A172.3970
+G1 X122.000 Y119.550 A172.4296
+G1 X78.000 Y119.550 A173.8816
+G1 X77.015 Y119.485 A173.9142
+G1 X76.046 Y119.293 A173.9468
+G1 X75.111 Y118.975 A173.9794
+G1 X74.225 Y118.538 A174.0120
+G1 X73.404 Y117.990 A174.0446
+G1 X72.661 Y117.339 A174.0772
+G1 X72.010 Y116.596 A174.1097
+G1 X71.462 Y115.775 A174.1423
+G1 X71.025 Y114.889 A174.1749
+G1 X70.707 Y113.954 A174.2075
+G1 X70.515 Y112.985 A174.2401
+G1 X70.450 Y112.000 A174.2727
+G1 X70.450 Y88.000 A175.0647
+G1 X70.515 Y87.015 A175.0973
+G1 X70.707 Y86.046 A175.1299
+G1 X71.025 Y85.111 A175.1625
+G1 X71.462 Y84.225 A175.1951
+G1 X72.010 Y83.404 A175.2276
+G1 X72.661 Y82.661 A175.2602
+G1 X73.404 Y82.010 A175.2928
+G1 X74.225 Y81.462 A175.3254
+G1 X75.111 Y81.025 A175.3580
+G1 X76.046 Y80.707 A175.3906
+G1 X77.015 Y80.515 A175.4232
+G1 X78.000 Y80.450 A175.4558
+G1 X122.000 Y80.450 A176.9078
+G1 X122.985 Y80.515 A176.9404
+G1 X123.954 Y80.707 A176.9730
+G1 X124.889 Y81.025 A177.0056
+G1 X125.775 Y81.462 A177.0381
+G1 X126.596 Y82.010 A177.0707
+G1 X127.339 Y82.661 A177.1033
+G1 X127.990 Y83.404 A177.1359
+G1 X128.538 Y84.225 A177.1685
+G1 X128.975 Y85.111 A177.2011
+G1 X129.293 Y86.046 A177.2337
+G1 X129.485 Y87.015 A177.2663
+G1 X129.550 Y88.000 A177.2989
+G1 X129.550 Y112.000 A178.0909
+G1 A177.0909 F2400
+G0 X129.100 Y112.000
+G1 A178.0909 F2400
+G1 F2400
+G1 X129.039 Y112.927 A178.1215
+G1 X128.858 Y113.838 A178.1522
+G1 X128.560 Y114.717 A178.1828
+G1 X128.149 Y115.550 A178.2135
+G1 X127.633 Y116.322 A178.2441
+G1 X127.020 Y117.020 A178.2748
+G1 X126.322 Y117.633 A178.3054
+G1 X125.550 Y118.149 A178.3360
+G1 X124.717 Y118.560 A178.3667
+G1 X123.838 Y118.858 A178.3973
+G1 X122.927 Y119.039 A178.4280
+G1 X122.000 Y119.100 A178.4586
+G1 X78.000 Y119.100 A179.9106
+G1 X77.073 Y119.039 A179.9413
+G1 X76.162 Y118.858 A179.9719
+G1 X75.283 Y118.560 A180.0026
+G1 X74.450 Y118.149 A180.0332
+G1 X73.678 Y117.633 A180.0639
+G1 X72.980 Y117.020 A180.0945
+G1 X72.367 Y116.322 A180.1252
+G1 X71.851 Y115.550 A180.1558
+G1 X71.440 Y114.717 A180.1865
+G1 X71.142 Y113.838 A180.2171
+G1 X70.961 Y112.927 A180.2478
+G1 X70.900 Y112.000 A180.2784
+G1 X70.900 Y88.000 A181.0704
+G1 X70.961 Y87.073 A181.1011
+G1 X71.142 Y86.162 A181.1317
+G1 X71.440 Y85.283 A181.1624
+G1 X71.851 Y84.450 A181.1930
+G1 X72.367 Y83.678 A181.2237
+G1 X72.980 Y82.980 A181.2543
+G1 X73.678 Y82.367 A181.2849
+G1 X74.450 Y81.851 A181.3156
+G1 X75.283 Y81.440 A181.3462
+G1 X76.162 Y81.142 A181.3769
+G1 X77.073 Y80.961 A181.4075
+G1 X78.000 Y80.900 A181.4382
+G1 X122.000 Y80.900 A182.8902
+G1 X122.927 Y80.961 A182.9208
+G1 X123.838 Y81.142 A182.9515
+G1 X124.717 Y81.440 A182.9821
+G1 X125.550 Y81.851 A183.0128
+G1 X126.322 Y82.367 A183.0434
+G1 X127.020 Y82.980 A183.0741
+G1 X127.633 Y83.678 A183.1047
+G1 X128.149 Y84.450 A183.1354
+G1 X128.560 Y85.283 A183.1660
+G1 X128.858 Y86.162 A183.1967
+G1 X129.039 Y87.073 A183.2273
+G1 X129.100 Y88.000 A183.2580
+G1 X129.100 Y112.000 A184.0500
+G1 A183.0500 F2400
+G0 X91.000 Y100.000
+G1 A184.0500 F2400
+G1 F2400
+G1 X90.949 Y100.783 A184.0759
+G1 X90.796 Y101.553 A184.1018
+G1 X90.543 Y102.296 A184.1277
+G1 X90.196 Y103.000 A184.1536
+G1 X89.760 Y103.653 A184.1795
+G1 X89.243 Y104.243 A184.2054
+G1 X88.653 Y104.760 A184.2313
+G1 X88.000 Y105.196 A184.2572
+G1 X87.296 Y105.543 A184.2831
+G1 X86.553 Y105.796 A184.3090
+G1 X85.783 Y105.949 A184.3349
+G1 X85.000 Y106.000 A184.3608
+G1 X84.217 Y105.949 A184.3867
+G1 X83.447 Y105.796 A184.4126
+G1 X82.704 Y105.543 A184.4385
+G1 X82.000 Y105.196 A184.4644
+G1 X81.347 Y104.760 A184.4903
+G1 X80.757 Y104.243 A184.5162
+G1 X80.240 Y103.653 A184.5421
+G1 X79.804 Y103.000 A184.5680
+G1 X79.457 Y102.296 A184.5939
+G1 X79.204 Y101.553 A184.6198
+G1 X79.051 Y100.783 A184.6457
+G1 X79.000 Y100.000 A184.6716
+G1 X79.051 Y99.217 A184.6975
+G1 X79.204 Y98.447 A184.7234
+G1 X79.457 Y97.704 A184.7493
+G1 X79.804 Y97.000 A184.7752
+G1 X80.240 Y96.347 A184.8011
+G1 X80.757 Y95.757 A184.8270
+G1 X81.347 Y95.240 A184.8529
+G1 X82.000 Y94.804 A184.8788
+G1 X82.704 Y94.457 A184.9047
+G1 X83.447 Y94.204 A184.9306
+G1 X84.217 Y94.051 A184.9565
+G1 X85.000 Y94.000 A184.9824
+G1 X85.783 Y94.051 A185.0083
+G1 X86.553 Y94.204 A185.0342
+G1 X87.296 Y94.457 A185.0600
+G1 X88.000 Y94.804 A185.0859
+G1 X88.653 Y95.240 A185.1118
+G1 X89.243 Y95.757 A185.1377
+G1 X89.760 Y96.347 A185.1636
+G1 X90.196 Y97.000 A185.1895
+G1 X90.543 Y97.704 A185.2154
+G1 X90.796 Y98.447 A185.2413
+G1 X90.949 Y99.217 A185.2672
+G1 X91.000 Y100.000 A185.2931
+G1 A184.2931 F2400
+G0 X91.450 Y100.000
+G1 A185.2931 F2400
+G1 F2400
+G1 X91.395 Y100.842 A185.3210
+G1 X91.230 Y101.669 A185.3488
+G1 X90.959 Y102.468 A185.3767
+G1 X90.586 Y103.225 A185.4045
+G1 X90.117 Y103.927 A185.4324
+G1 X89.561 Y104.561 A185.4602
+G1 X88.927 Y105.117 A185.4880
+G1 X88.225 Y105.586 A185.5159
+G1 X87.468 Y105.959 A185.5437
+G1 X86.669 Y106.230 A185.5716
+G1 X85.842 Y106.395 A185.5994
+G1 X85.000 Y106.450 A185.6273
+G1 X84.158 Y106.395 A185.6551
+G1 X83.331 Y106.230 A185.6829
+G1 X82.532 Y105.959 A185.7108
+G1 X81.775 Y105.586 A185.7386
+G1 X81.073 Y105.117 A185.7665
+G1 X80.439 Y104.561 A185.7943
+G1 X79.883 Y103.927 A185.8221
+G1 X79.414 Y103.225 A185.8500
+G1 X79.041 Y102.468 A185.8778
+G1 X78.770 Y101.669 A185.9057
+G1 X78.605 Y100.842 A185.9335
+G1 X78.550 Y100.000 A185.9614
+G1 X78.605 Y99.158 A185.9892
+G1 X78.770 Y98.331 A186.0170
+G1 X79.041 Y97.532 A186.0449
+G1 X79.414 Y96.775 A186.0727
+G1 X79.883 Y96.073 A186.1006
+G1 X80.439 Y95.439 A186.1284
+G1 X81.073 Y94.883 A186.1563
+G1 X81.775 Y94.414 A186.1841
+G1 X82.532 Y94.041 A186.2119
+G1 X83.331 Y93.770 A186.2398
+G1 X84.158 Y93.605 A186.2676
+G1 X85.000 Y93.550 A186.2955
+G1 X85.842 Y93.605 A186.3233
+G1 X86.669 Y93.770 A186.3511
+G1 X87.468 Y94.041 A186.3790
+G1 X88.225 Y94.414 A186.4068
+G1 X88.927 Y94.883 A186.4347
+G1 X89.561 Y95.439 A186.4625
+G1 X90.117 Y96.073 A186.4904
+G1 X90.586 Y96.775 A186.5182
+G1 X90.959 Y97.532 A186.5460
+G1 X91.230 Y98.331 A186.5739
+G1 X91.395 Y99.158 A186.6017
+G1 X91.450 Y100.000 A186.6296
+G0 Z2.10
+G1 A185.6296 F2400
+G0 X130.000 Y112.000
+G1 A186.6296 F2400
+G1 F2400
+G1 X129.932 Y113.044 A186.6641
+G1 X129.727 Y114.071 A186.6986
+G1 X129.391 Y115.061 A186.7332
+G1 X128.928 Y116.000 A186.7677
+G1 X128.347 Y116.870 A186.8022
+G1 X127.657 Y117.657 A186.8368
+G1 X126.870 Y118.347 A186.8713
+G1 X126.000 Y118.928 A186.9058
+G1 X125.061 Y119.391 A186.9404
+G1 X124.071 Y119.727 A186.9749
+G1 X123.044 Y119.932 A187.0094
+G1 X122.000 Y120.000 A187.0440
+G1 X78.000 Y120.000 A188.4960
+G1 X76.956 Y119.932 A188.5305
+G1 X75.929 Y119.727 A188.5650
+G1 X74.939 Y119.391 A188.5996
+G1 X74.000 Y118.928 A188.6341
+G1 X73.130 Y118.347 A188.6686
+G1 X72.343 Y117.657 A188.7032
+G1 X71.653 Y116.870 A188.7377
+G1 X71.072 Y116.000 A188.7722
+G1 X70.609 Y115.061 A188.8068
+G1 X70.273 Y114.071 A188.8413
+G1 X70.068 Y113.044 A188.8758
+G1 X70.000 Y112.000 A188.9104
+G1 X70.000 Y88.000 A189.7024
+G1 X70.068 Y86.956 A189.7369
+G1 X70.273 Y85.929 A189.7714
+G1 X70.609 Y84.939 A189.8060
+G1 X71.072 Y84.000 A189.8405
+G1 X71.653 Y83.130 A189.8750
+G1 X72.343 Y82.343 A189.9096
+G1 X73.130 Y81.653 A189.9441
+G1 X74.000 Y81.072 A189.9786
+G1 X74.939 Y80.609 A190.0132
+G1 X75.929 Y80.273 A190.0477
+G1 X76.956 Y80.068 A190.0822
+G1 X78.000 Y80.000 A190.1168
+G1 X122.000 Y80.000 A191.5688
+G1 X123.044 Y80.068 A191.6033
+G1 X124.071 Y80.273 A191.6378
+G1 X125.061 Y80.609 A191.6723
+G1 X126.000 Y81.072 A191.7069
+G1 X126.870 Y81.653 A191.7414
+G1 X127.657 Y82.343 A191.7759
+G1 X128.347 Y83.130 A191.8105
+G1 X128.928 Y84.000 A191.8450
+G1 X129.391 Y84.939 A191.8795
+G1 X129.727 Y85.929 A191.9141
+G1 X129.932 Y86.956 A191.9486
+G1 X130.000 Y88.000 A191.9831
+G1 X130.000 Y112.000 A192.7751
+G1 A191.7751 F2400
+G0 X129.550 Y112.000
+G1 A192.7751 F2400
+G1 F2400
+G1 X129.485 Y112.985 A192.8077
+G1 X129.293 Y113.954 A192.8403
+G1 X128.975 Y114.889 A192.8729
+G1 X128.538 Y115.775 A192.9055
+G1 X127.990 Y116.596 A192.9381
+G1 X127.339 Y117.339 A192.9707
+G1 X126.596 Y117.990 A193.0033
+G1 X125.775 Y118.538 A193.0359
+G1 X124.889 Y118.975 A193.0685
+G1 X123.954 Y119.293 A193.1010
+G1 X122.985 Y119.485 A193.1336
+G1 X122.000 Y119.550 A193.1662
+G1 X78.000 Y119.550 A194.6182
+G1 X77.015 Y119.485 A194.6508
+G1 X76.046 Y119.293 A194.6834
+G1 X75.111 Y118.975 A194.7160
+G1 X74.225 Y118.538 A194.7486
+G1 X73.404 Y117.990 A194.7812
+G1 X72.661 Y117.339 A194.8138
+G1 X72.010 Y116.596 A194.8464
+G1 X71.462 Y115.775 A194.8790
+G1 X71.025 Y114.889 A194.9115
+G1 X70.707 Y113.954 A194.9441
+G1 X70.515 Y112.985 A194.9767
+G1 X70.450 Y112.000 A195.0093
+G1 X70.450 Y88.000 A195.8013
+G1 X70.515 Y87.015 A195.8339
+G1 X70.707 Y86.046 A195.8665
+G1 X71.025 Y85.111 A195.8991
+G1 X71.462 Y84.225 A195.9317
+G1 X72.010 Y83.404 A195.9643
+G1 X72.661 Y82.661 A195.9969
+G1 X73.404 Y82.010 A196.0294
+G1 X74.225 Y81.462 A196.0620
+G1 X75.111 Y81.025 A196.0946
+G1 X76.046 Y80.707 A196.1272
+G1 X77.015 Y80.515 A196.1598
+G1 X78.000 Y80.450 A196.1924
+G1 X122.000 Y80.450 A197.6444
+G1 X122.985 Y80.515 A197.6770
+G1 X123.954 Y80.707 A197.7096
+G1 X124.889 Y81.025 A197.7422
+G1 X125.775 Y81.462 A197.7748
+G1 X126.596 Y82.010 A197.8074
+G1 X127.339 Y82.661 A197.8399
+G1 X127.990 Y83.404 A197.8725
+G1 X128.538 Y84.225 A197.9051
+G1 X128.975 Y85.111 A197.9377
+G1 X129.293 Y86.046 A197.9703
+G1 X129.485 Y87.015 A198.0029
+G1 X129.550 Y88.000 A198.0355
+G1 X129.550 Y112.000 A198.8275
+G1 A197.8275 F2400
+G0 X129.100 Y112.000
+G1 A198.8275 F2400
+G1 F2400
+G1 X129.039 Y112.927 A198.8581
+G1 X128.858 Y113.838 A198.8888
+G1 X128.560 Y114.717 A198.9194
+G1 X128.149 Y115.550 A198.9501
+G1 X127.633 Y116.322 A198.9807
+G1 X127.020 Y117.020 A199.0114
+G1 X126.322 Y117.633 A199.0420
+G1 X125.550 Y118.149 A199.0727
+G1 X124.717 Y118.560 A199.1033
+G1 X123.838 Y118.858 A199.1340
+G1 X122.927 Y119.039 A199.1646
+G1 X122.000 Y119.100 A199.1953
+G1 X78.000 Y119.100 A200.6473
+G1 X77.073 Y119.039 A200.6779
+G1 X76.162 Y118.858 A200.7086
+G1 X75.283 Y118.560 A200.7392
+G1 X74.450 Y118.149 A200.7698
+G1 X73.678 Y117.633 A200.8005
+G1 X72.980 Y117.020 A200.8311
+G1 X72.367 Y116.322 A200.8618
+G1 X71.851 Y115.550 A200.8924
+G1 X71.440 Y114.717 A200.9231
+G1 X71.142 Y113.838 A200.9537
+G1 X70.961 Y112.927 A200.9844
+G1 X70.900 Y112.000 A201.0150
+G1 X70.900 Y88.000 A201.8070
+G1 X70.961 Y87.073 A201.8377
+G1 X71.142 Y86.162 A201.8683
+G1 X71.440 Y85.283 A201.8990
+G1 X71.851 Y84.450 A201.9296
+G1 X72.367 Y83.678 A201.9603
+G1 X72.980 Y82.980 A201.9909
+G1 X73.678 Y82.367 A202.0216
+G1 X74.450 Y81.851 A202.0522
+G1 X75.283 Y81.440 A202.0829
+G1 X76.162 Y81.142 A202.1135
+G1 X77.073 Y80.961 A202.1442
+G1 X78.000 Y80.900 A202.1748
+G1 X122.000 Y80.900 A203.6268
+G1 X122.927 Y80.961 A203.6575
+G1 X123.838 Y81.142 A203.6881
+G1 X124.717 Y81.440 A203.7188
+G1 X125.550 Y81.851 A203.7494
+G1 X126.322 Y82.367 A203.7800
+G1 X127.020 Y82.980 A203.8107
+G1 X127.633 Y83.678 A203.8413
+G1 X128.149 Y84.450 A203.8720
+G1 X128.560 Y85.283 A203.9026
+G1 X128.858 Y86.162 A203.9333
+G1 X129.039 Y87.073 A203.9639
+G1 X129.100 Y88.000 A203.9946
+G1 X129.100 Y112.000 A204.7866
+G1 A203.7866 F2400
+G0 X91.000 Y100.000
+G1 A204.7866 F2400
+G1 F2400
+G1 X90.949 Y100.783 A204.8125
+G1 X90.796 Y101.553 A204.8384
+G1 X90.543 Y102.296 A204.8643
+G1 X90.196 Y103.000 A204.8902
+G1 X89.760 Y103.653 A204.9161
+G1 X89.243 Y104.243 A204.9420
+G1 X88.653 Y104.760 A204.9679
+G1 X88.000 Y105.196 A204.9938
+G1 X87.296 Y105.543 A205.0197
+G1 X86.553 Y105.796 A205.0456
+G1 X85.783 Y105.949 A205.0715
+G1 X85.000 Y106.000 A205.0974
+G1 X84.217 Y105.949 A205.1233
+G1 X83.447 Y105.796 A205.1492
+G1 X82.704 Y105.543 A205.1751
+G1 X82.000 Y105.196 A205.2010
+G1 X81.347 Y104.760 A205.2269
+G1 X80.757 Y104.243 A205.2528
+G1 X80.240 Y103.653 A205.2787
+G1 X79.804 Y103.000 A205.3046
+G1 X79.457 Y102.296 A205.3305
+G1 X79.204 Y101.553 A205.3564
+G1 X79.051 Y100.783 A205.3823
+G1 X79.000 Y100.000 A205.4082
+G1 X79.051 Y99.217 A205.4341
+G1 X79.204 Y98.447 A205.4600
+G1 X79.457 Y97.704 A205.4859
+G1 X79.804 Y97.000 A205.5118
+G1 X80.240 Y96.347 A205.5377
+G1 X80.757 Y95.757 A205.5636
+G1 X81.347 Y95.240 A205.5895
+G1 X82.000 Y94.804 A205.6154
+G1 X82.704 Y94.457 A205.6413
+G1 X83.447 Y94.204 A205.6672
+G1 X84.217 Y94.051 A205.6931
+G1 X85.000 Y94.000 A205.7190
+G1 X85.783 Y94.051 A205.7449
+G1 X86.553 Y94.204 A205.7708
+G1 X87.296 Y94.457 A205.7967
+G1 X88.000 Y94.804 A205.8226
+G1 X88.653 Y95.240 A205.8485
+G1 X89.243 Y95.757 A205.8744
+G1 X89.760 Y96.347 A205.9003
+G1 X90.196 Y97.000 A205.9262
+G1 X90.543 Y97.704 A205.9521
+G1 X90.796 Y98.447 A205.9780
+G1 X90.949 Y99.217 A206.0039
+G1 X91.000 Y100.000 A206.0298
+G1 A205.0298 F2400
+G0 X91.450 Y100.000
+G1 A206.0298 F2400
+G1 F2400
+G1 X91.395 Y100.842 A206.0576
+G1 X91.230 Y101.669 A206.0854
+G1 X90.959 Y102.468 A206.1133
+G1 X90.586 Y103.225 A206.1411
+G1 X90.117 Y103.927 A206.1690
+G1 X89.561 Y104.561 A206.1968
+G1 X88.927 Y105.117 A206.2247
+G1 X88.225 Y105.586 A206.2525
+G1 X87.468 Y105.959 A206.2803
+G1 X86.669 Y106.230 A206.3082
+G1 X85.842 Y106.395 A206.3360
+G1 X85.000 Y106.450 A206.3639
+G1 X84.158 Y106.395 A206.3917
+G1 X83.331 Y106.230 A206.4196
+G1 X82.532 Y105.959 A206.4474
+G1 X81.775 Y105.586 A206.4752
+G1 X81.073 Y105.117 A206.5031
+G1 X80.439 Y104.561 A206.5309
+G1 X79.883 Y103.927 A206.5588
+G1 X79.414 Y103.225 A206.5866
+G1 X79.041 Y102.468 A206.6144
+G1 X78.770 Y101.669 A206.6423
+G1 X78.605 Y100.842 A206.6701
+G1 X78.550 Y100.000 A206.6980
+G1 X78.605 Y99.158 A206.7258
+G1 X78.770 Y98.331 A206.7537
+G1 X79.041 Y97.532 A206.7815
+G1 X79.414 Y96.775 A206.8093
+G1 X79.883 Y96.073 A206.8372
+G1 X80.439 Y95.439 A206.8650
+G1 X81.073 Y94.883 A206.8929
+G1 X81.775 Y94.414 A206.9207
+G1 X82.532 Y94.041 A206.9486
+G1 X83.331 Y93.770 A206.9764
+G1 X84.158 Y93.605 A207.0042
+G1 X85.000 Y93.550 A207.0321
+G1 X85.842 Y93.605 A207.0599
+G1 X86.669 Y93.770 A207.0878
+G1 X87.468 Y94.041 A207.1156
+G1 X88.225 Y94.414 A207.1434
+G1 X88.927 Y94.883 A207.1713
+G1 X89.561 Y95.439 A207.1991
+G1 X90.117 Y96.073 A207.2270
+G1 X90.586 Y96.775 A207.2548
+G1 X90.959 Y97.532 A207.2827
+G1 X91.230 Y98.331 A207.3105
+G1 X91.395 Y99.158 A207.3383
+G1 X91.450 Y100.000 A207.3662
+G0 Z2.30
+G1 A206.3662 F2400
+G0 X130.000 Y112.000
+G1 A207.3662 F2400
+G1 F2400
+G1 X129.932 Y113.044 A207.4007
+G1 X129.727 Y114.071 A207.4353
+G1 X129.391 Y115.061 A207.4698
+G1 X128.928 Y116.000 A207.5043
+G1 X128.347 Y116.870 A207.5389
+G1 X127.657 Y117.657 A207.5734
+G1 X126.870 Y118.347 A207.6079
+G1 X126.000 Y118.928 A207.6424
+G1 X125.061 Y119.391 A207.6770
+G1 X124.071 Y119.727 A207.7115
+G1 X123.044 Y119.932 A207.7460
+G1 X122.000 Y120.000 A207.7806
+G1 X78.000 Y120.000 A209.2326
+G1 X76.956 Y119.932 A209.2671
+G1 X75.929 Y119.727 A209.3016
+G1 X74.939 Y119.391 A209.3362
+G1 X74.000 Y118.928 A209.3707
+G1 X73.130 Y118.347 A209.4052
+G1 X72.343 Y117.657 A209.4398
+G1 X71.653 Y116.870 A209.4743
+G1 X71.072 Y116.000 A209.5088
+G1 X70.609 Y115.061 A209.5434
+G1 X70.273 Y114.071 A209.5779
+G1 X70.068 Y113.044 A209.6124
+G1 X70.000 Y112.000 A209.6470
+G1 X70.000 Y88.000 A210.4390
+G1 X70.068 Y86.956 A210.4735
+G1 X70.273 Y85.929 A210.5080
+G1 X70.609 Y84.939 A210.5426
+G1 X71.072 Y84.000 A210.5771
+G1 X71.653 Y83.130 A210.6116
+G1 X72.343 Y82.343 A210.6462
+G1 X73.130 Y81.653 A210.6807
+G1 X74.000 Y81.072 A210.7152
+G1 X74.939 Y80.609 A210.7498
+G1 X75.929 Y80.273 A210.7843
+G1 X76.956 Y80.068 A210.8188
+G1 X78.000 Y80.000 A210.8534
+G1 X122.000 Y80.000 A212.3054
+G1 X123.044 Y80.068 A212.3399
+G1 X124.071 Y80.273 A212.3744
+G1 X125.061 Y80.609 A212.4090
+G1 X126.000 Y81.072 A212.4435
+G1 X126.870 Y81.653 A212.4780
+G1 X127.657 Y82.343 A212.5126
+G1 X128.347 Y83.130 A212.5471
+G1 X128.928 Y84.000 A212.5816
+G1 X129.391 Y84.939 A212.6162
+G1 X129.727 Y85.929 A212.6507
+G1 X129.932 Y86.956 A212.6852
+G1 X130.000 Y88.000 A212.7198
+G1 X130.000 Y112.000 A213.5118
+G1 A212.5118 F2400
+G0 X129.550 Y112.000
+G1 A213.5118 F2400
+G1 F2400
+G1 X129.485 Y112.985 A213.5444
+G1 X129.293 Y113.954 A213.5769
+G1 X128.975 Y114.889 A213.6095
+G1 X128.538 Y115.775 A213.6421
+G1 X127.990 Y116.596 A213.6747
+G1 X127.339 Y117.339 A213.7073
+G1 X126.596 Y117.990 A213.7399
+G1 X125.775 Y118.538 A213.7725
+G1 X124.889 Y118.975 A213.8051
+G1 X123.954 Y119.293 A213.8377
+G1 X122.985 Y119.485 A213.8703
+G1 X122.000 Y119.550 A213.9028
+G1 X78.000 Y119.550 A215.3548
+G1 X77.015 Y119.485 A215.3874
+G1 X76.046 Y119.293 A215.4200
+G1 X75.111 Y118.975 A215.4526
+G1 X74.225 Y118.538 A215.4852
+G1 X73.404 Y117.990 A215.5178
+G1 X72.661 Y117.339 A215.5504
+G1 X72.010 Y116.596 A215.5830
+G1 X71.462 Y115.775 A215.6156
+G1 X71.025 Y114.889 A215.6482
+G1 X70.707 Y113.954 A215.6808
+G1 X70.515 Y112.985 A215.7133
+G1 X70.450 Y112.000 A215.7459
+G1 X70.450 Y88.000 A216.5379
+G1 X70.515 Y87.015 A216.5705
+G1 X70.707 Y86.046 A216.6031
+G1 X71.025 Y85.111 A216.6357
+G1 X71.462 Y84.225 A216.6683
+G1 X72.010 Y83.404 A216.7009
+G1 X72.661 Y82.661 A216.7335
+G1 X73.404 Y82.010 A216.7661
+G1 X74.225 Y81.462 A216.7987
+G1 X75.111 Y81.025 A216.8312
+G1 X76.046 Y80.707 A216.8638
+G1 X77.015 Y80.515 A216.8964
+G1 X78.000 Y80.450 A216.9290
+G1 X122.000 Y80.450 A218.3810
+G1 X122.985 Y80.515 A218.4136
+G1 X123.954 Y80.707 A218.4462
+G1 X124.889 Y81.025 A218.4788
+G1 X125.775 Y81.462 A218.5114
+G1 X126.596 Y82.010 A218.5440
+G1 X127.339 Y82.661 A218.5766
+G1 X127.990 Y83.404 A218.6092
+G1 X128.538 Y84.225 A218.6417
+G1 X128.975 Y85.111 A218.6743
+G1 X129.293 Y86.046 A218.7069
+G1 X129.485 Y87.015 A218.7395
+G1 X129.550 Y88.000 A218.7721
+G1 X129.550 Y112.000 A219.5641
+G1 A218.5641 F2400
+G0 X129.100 Y112.000
+G1 A219.5641 F2400
+G1 F2400
+G1 X129.039 Y112.927 A219.5947
+G1 X128.858 Y113.838 A219.6254
+G1 X128.560 Y114.717 A219.6560
+G1 X128.149 Y115.550 A219.6867
+G1 X127.633 Y116.322 A219.7173
+G1 X127.020 Y117.020 A219.7480
+G1 X126.322 Y117.633 A219.7786
+G1 X125.550 Y118.149 A219.8093
+G1 X124.717 Y118.560 A219.8399
+G1 X123.838 Y118.858 A219.8706
+G1 X122.927 Y119.039 A219.9012
+G1 X122.000 Y119.100 A219.9319
+G1 X78.000 Y119.100 A221.3839
+G1 X77.073 Y119.039 A221.4145
+G1 X76.162 Y118.858 A221.4452
+G1 X75.283 Y118.560 A221.4758
+G1 X74.450 Y118.149 A221.5065
+G1 X73.678 Y117.633 A221.5371
+G1 X72.980 Y117.020 A221.5678
+G1 X72.367 Y116.322 A221.5984
+G1 X71.851 Y115.550 A221.6291
+G1 X71.440 Y114.717 A221.6597
+G1 X71.142 Y113.838 A221.6904
+G1 X70.961 Y112.927 A221.7210
+G1 X70.900 Y112.000 A221.7517
+G1 X70.900 Y88.000 A222.5437
+G1 X70.961 Y87.073 A222.5743
+G1 X71.142 Y86.162 A222.6049
+G1 X71.440 Y85.283 A222.6356
+G1 X71.851 Y84.450 A222.6662
+G1 X72.367 Y83.678 A222.6969
+G1 X72.980 Y82.980 A222.7275
+G1 X73.678 Y82.367 A222.7582
+G1 X74.450 Y81.851 A222.7888
+G1 X75.283 Y81.440 A222.8195
+G1 X76.162 Y81.142 A222.8501
+G1 X77.073 Y80.961 A222.8808
+G1 X78.000 Y80.900 A222.9114
+G1 X122.000 Y80.900 A224.3634
+G1 X122.927 Y80.961 A224.3941
+G1 X123.838 Y81.142 A224.4247
+G1 X124.717 Y81.440 A224.4554
+G1 X125.550 Y81.851 A224.4860
+G1 X126.322 Y82.367 A224.5167
+G1 X127.020 Y82.980 A224.5473
+G1 X127.633 Y83.678 A224.5780
+G1 X128.149 Y84.450 A224.6086
+G1 X128.560 Y85.283 A224.6393
+G1 X128.858 Y86.162 A224.6699
+G1 X129.039 Y87.073 A224.7006
+G1 X129.100 Y88.000 A224.7312
+G1 X129.100 Y112.000 A225.5232
+G1 A224.5232 F2400
+G0 X91.000 Y100.000
+G1 A225.5232 F2400
+G1 F2400
+G1 X90.949 Y100.783 A225.5491
+G1 X90.796 Y101.553 A225.5750
+G1 X90.543 Y102.296 A225.6009
+G1 X90.196 Y103.000 A225.6268
+G1 X89.760 Y103.653 A225.6527
+G1 X89.243 Y104.243 A225.6786
+G1 X88.653 Y104.760 A225.7045
+G1 X88.000 Y105.196 A225.7304
+G1 X87.296 Y105.543 A225.7563
+G1 X86.553 Y105.796 A225.7822
+G1 X85.783 Y105.949 A225.8081
+G1 X85.000 Y106.000 A225.8340
+G1 X84.217 Y105.949 A225.8599
+G1 X83.447 Y105.796 A225.8858
+G1 X82.704 Y105.543 A225.9117
+G1 X82.000 Y105.196 A225.9376
+G1 X81.347 Y104.760 A225.9635
+G1 X80.757 Y104.243 A225.9894
+G1 X80.240 Y103.653 A226.0153
+G1 X79.804 Y103.000 A226.0412
+G1 X79.457 Y102.296 A226.0671
+G1 X79.204 Y101.553 A226.0930
+G1 X79.051 Y100.783 A226.1189
+G1 X79.000 Y100.000 A226.1448
+G1 X79.051 Y99.217 A226.1707
+G1 X79.204 Y98.447 A226.1966
+G1 X79.457 Y97.704 A226.2225
+G1 X79.804 Y97.000 A226.2484
+G1 X80.240 Y96.347 A226.2743
+G1 X80.757 Y95.757 A226.3002
+G1 X81.347 Y95.240 A226.3261
+G1 X82.000 Y94.804 A226.3520
+G1 X82.704 Y94.457 A226.3779
+G1 X83.447 Y94.204 A226.4038
+G1 X84.217 Y94.051 A226.4297
+G1 X85.000 Y94.000 A226.4556
+G1 X85.783 Y94.051 A226.4815
+G1 X86.553 Y94.204 A226.5074
+G1 X87.296 Y94.457 A226.5333
+G1 X88.000 Y94.804 A226.5592
+G1 X88.653 Y95.240 A226.5851
+G1 X89.243 Y95.757 A226.6110
+G1 X89.760 Y96.347 A226.6369
+G1 X90.196 Y97.000 A226.6628
+G1 X90.543 Y97.704 A226.6887
+G1 X90.796 Y98.447 A226.7146
+G1 X90.949 Y99.217 A226.7405
+G1 X91.000 Y100.000 A226.7664
+G1 A225.7664 F2400
+G0 X91.450 Y100.000
+G1 A226.7664 F2400
+G1 F2400
+G1 X91.395 Y100.842 A226.7942
+G1 X91.230 Y101.669 A226.8221
+G1 X90.959 Y102.468 A226.8499
+G1 X90.586 Y103.225 A226.8778
+G1 X90.117 Y103.927 A226.9056
+G1 X89.561 Y104.561 A226.9334
+G1 X88.927 Y105.117 A226.9613
+G1 X88.225 Y105.586 A226.9891
+G1 X87.468 Y105.959 A227.0170
+G1 X86.669 Y106.230 A227.0448
+G1 X85.842 Y106.395 A227.0726
+G1 X85.000 Y106.450 A227.1005
+G1 X84.158 Y106.395 A227.1283
+G1 X83.331 Y106.230 A227.1562
+G1 X82.532 Y105.959 A227.1840
+G1 X81.775 Y105.586 A227.2119
+G1 X81.073 Y105.117 A227.2397
+G1 X80.439 Y104.561 A227.2675
+G1 X79.883 Y103.927 A227.2954
+G1 X79.414 Y103.225 A227.3232
+G1 X79.041 Y102.468 A227.3511
+G1 X78.770 Y101.669 A227.3789
+G1 X78.605 Y100.842 A227.4068
+G1 X78.550 Y100.000 A227.4346
+G1 X78.605 Y99.158 A227.4624
+G1 X78.770 Y98.331 A227.4903
+G1 X79.041 Y97.532 A227.5181
+G1 X79.414 Y96.775 A227.5460
+G1 X79.883 Y96.073 A227.5738
+G1 X80.439 Y95.439 A227.6016
+G1 X81.073 Y94.883 A227.6295
+G1 X81.775 Y94.414 A227.6573
+G1 X82.532 Y94.041 A227.6852
+G1 X83.331 Y93.770 A227.7130
+G1 X84.158 Y93.605 A227.7409
+G1 X85.000 Y93.550 A227.7687
+G1 X85.842 Y93.605 A227.7965
+G1 X86.669 Y93.770 A227.8244
+G1 X87.468 Y94.041 A227.8522
+G1 X88.225 Y94.414 A227.8801
+G1 X88.927 Y94.883 A227.9079
+G1 X89.561 Y95.439 A227.9358
+G1 X90.117 Y96.073 A227.9636
+G1 X90.586 Y96.775 A227.9914
+G1 X90.959 Y97.532 A228.0193
+G1 X91.230 Y98.331 A228.0471
+G1 X91.395 Y99.158 A228.0750
+G1 X91.450 Y100.000 A228.1028
+G0 Z2.50
+G1 A227.1028 F2400
+G0 X130.000 Y112.000
+G1 A228.1028 F2400
+G1 F2400
+G1 X129.932 Y113.044 A228.1373
+G1 X129.727 Y114.071 A228.1719
+G1 X129.391 Y115.061 A228.2064
+G1 X128.928 Y116.000 A228.2409
+G1 X128.347 Y116.870 A228.2755
+G1 X127.657 Y117.657 A228.3100
+G1 X126.870 Y118.347 A228.3445
+G1 X126.000 Y118.928 A228.3791
+G1 X125.061 Y119.391 A228.4136
+G1 X124.071 Y119.727 A228.4481
+G1 X123.044 Y119.932 A228.4827
+G1 X122.000 Y120.000 A228.5172
+G1 X78.000 Y120.000 A229.9692
+G1 X76.956 Y119.932 A230.0037
+G1 X75.929 Y119.727 A230.0383
+G1 X74.939 Y119.391 A230.0728
+G1 X74.000 Y118.928 A230.1073
+G1 X73.130 Y118.347 A230.1419
+G1 X72.343 Y117.657 A230.1764
+G1 X71.653 Y116.870 A230.2109
+G1 X71.072 Y116.000 A230.2455
+G1 X70.609 Y115.061 A230.2800
+G1 X70.273 Y114.071 A230.3145
+G1 X70.068 Y113.044 A230.3491
+G1 X70.000 Y112.000 A230.3836
+G1 X70.000 Y88.000 A231.1756
+G1 X70.068 Y86.956 A231.2101
+G1 X70.273 Y85.929 A231.2447
+G1 X70.609 Y84.939 A231.2792
+G1 X71.072 Y84.000 A231.3137
+G1 X71.653 Y83.130 A231.3483
+G1 X72.343 Y82.343 A231.3828
+G1 X73.130 Y81.653 A231.4173
+G1 X74.000 Y81.072 A231.4519
+G1 X74.939 Y80.609 A231.4864
+G1 X75.929 Y80.273 A231.5209
+G1 X76.956 Y80.068 A231.5555
+G1 X78.000 Y80.000 A231.5900
+G1 X122.000 Y80.000 A233.0420
+G1 X123.044 Y80.068 A233.0765
+G1 X124.071 Y80.273 A233.1111
+G1 X125.061 Y80.609 A233.1456
+G1 X126.000 Y81.072 A233.1801
+G1 X126.870 Y81.653 A233.2147
+G1 X127.657 Y82.343 A233.2492
+G1 X128.347 Y83.130 A233.2837
+G1 X128.928 Y84.000 A233.3183
+G1 X129.391 Y84.939 A233.3528
+G1 X129.727 Y85.929 A233.3873
+G1 X129.932 Y86.956 A233.4218
+G1 X130.000 Y88.000 A233.4564
+G1 X130.000 Y112.000 A234.2484
+G1 A233.2484 F2400
+G0 X129.550 Y112.000
+G1 A234.2484 F2400
+G1 F2400
+G1 X129.485 Y112.985 A234.2810
+G1 X129.293 Y113.954 A234.3136
+G1 X128.975 Y114.889 A234.3462
+G1 X128.538 Y115.775 A234.3787
+G1 X127.990 Y116.596 A234.4113
+G1 X127.339 Y117.339 A234.4439
+G1 X126.596 Y117.990 A234.4765
+G1 X125.775 Y118.538 A234.5091
+G1 X124.889 Y118.975 A234.5417
+G1 X123.954 Y119.293 A234.5743
+G1 X122.985 Y119.485 A234.6069
+G1 X122.000 Y119.550 A234.6395
+G1 X78.000 Y119.550 A236.0915
+G1 X77.015 Y119.485 A236.1241
+G1 X76.046 Y119.293 A236.1566
+G1 X75.111 Y118.975 A236.1892
+G1 X74.225 Y118.538 A236.2218
+G1 X73.404 Y117.990 A236.2544
+G1 X72.661 Y117.339 A236.2870
+G1 X72.010 Y116.596 A236.3196
+G1 X71.462 Y115.775 A236.3522
+G1 X71.025 Y114.889 A236.3848
+G1 X70.707 Y113.954 A236.4174
+G1 X70.515 Y112.985 A236.4500
+G1 X70.450 Y112.000 A236.4826
+G1 X70.450 Y88.000 A237.2746
+G1 X70.515 Y87.015 A237.3071
+G1 X70.707 Y86.046 A237.3397
+G1 X71.025 Y85.111 A237.3723
+G1 X71.462 Y84.225 A237.4049
+G1 X72.010 Y83.404 A237.4375
+G1 X72.661 Y82.661 A237.4701
+G1 X73.404 Y82.010 A237.5027
+G1 X74.225 Y81.462 A237.5353
+G1 X75.111 Y81.025 A237.5679
+G1 X76.046 Y80.707 A237.6005
+G1 X77.015 Y80.515 A237.6330
+G1 X78.000 Y80.450 A237.6656
+G1 X122.000 Y80.450 A239.1176
+G1 X122.985 Y80.515 A239.1502
+G1 X123.954 Y80.707 A239.1828
+G1 X124.889 Y81.025 A239.2154
+G1 X125.775 Y81.462 A239.2480
+G1 X126.596 Y82.010 A239.2806
+G1 X127.339 Y82.661 A239.3132
+G1 X127.990 Y83.404 A239.3458
+G1 X128.538 Y84.225 A239.3784
+G1 X128.975 Y85.111 A239.4109
+G1 X129.293 Y86.046 A239.4435
+G1 X129.485 Y87.015 A239.4761
+G1 X129.550 Y88.000 A239.5087
+G1 X129.550 Y112.000 A240.3007
+G1 A239.3007 F2400
+G0 X129.100 Y112.000
+G1 A240.3007 F2400
+G1 F2400
+G1 X129.039 Y112.927 A240.3314
+G1 X128.858 Y113.838 A240.3620
+G1 X128.560 Y114.717 A240.3927
+G1 X128.149 Y115.550 A240.4233
+G1 X127.633 Y116.322 A240.4540
+G1 X127.020 Y117.020 A240.4846
+G1 X126.322 Y117.633 A240.5153
+G1 X125.550 Y118.149 A240.5459
+G1 X124.717 Y118.560 A240.5766
+G1 X123.838 Y118.858 A240.6072
+G1 X122.927 Y119.039 A240.6378
+G1 X122.000 Y119.100 A240.6685
+G1 X78.000 Y119.100 A242.1205
+G1 X77.073 Y119.039 A242.1511
+G1 X76.162 Y118.858 A242.1818
+G1 X75.283 Y118.560 A242.2124
+G1 X74.450 Y118.149 A242.2431
+G1 X73.678 Y117.633 A242.2737
+G1 X72.980 Y117.020 A242.3044
+G1 X72.367 Y116.322 A242.3350
+G1 X71.851 Y115.550 A242.3657
+G1 X71.440 Y114.717 A242.3963
+G1 X71.142 Y113.838 A242.4270
+G1 X70.961 Y112.927 A242.4576
+G1 X70.900 Y112.000 A242.4883
+G1 X70.900 Y88.000 A243.2803
+G1 X70.961 Y87.073 A243.3109
+G1 X71.142 Y86.162 A243.3416
+G1 X71.440 Y85.283 A243.3722
+G1 X71.851 Y84.450 A243.4029
+G1 X72.367 Y83.678 A243.4335
+G1 X72.980 Y82.980 A243.4642
+G1 X73.678 Y82.367 A243.4948
+G1 X74.450 Y81.851 A243.5255
+G1 X75.283 Y81.440 A243.5561
+G1 X76.162 Y81.142 A243.5867
+G1 X77.073 Y80.961 A243.6174
+G1 X78.000 Y80.900 A243.6480
+G1 X122.000 Y80.900 A245.1000
+G1 X122.927 Y80.961 A245.1307
+G1 X123.838 Y81.142 A245.1613
+G1 X124.717 Y81.440 A245.1920
+G1 X125.550 Y81.851 A245.2226
+G1 X126.322 Y82.367 A245.2533
+G1 X127.020 Y82.980 A245.2839
+G1 X127.633 Y83.678 A245.3146
+G1 X128.149 Y84.450 A245.3452
+G1 X128.560 Y85.283 A245.3759
+G1 X128.858 Y86.162 A245.4065
+G1 X129.039 Y87.073 A245.4372
+G1 X129.100 Y88.000 A245.4678
+G1 X129.100 Y112.000 A246.2598
+G1 A245.2598 F2400
+G0 X91.000 Y100.000
+G1 A246.2598 F2400
+G1 F2400
+G1 X90.949 Y100.783 A246.2857
+G1 X90.796 Y101.553 A246.3116
+G1 X90.543 Y102.296 A246.3375
+G1 X90.196 Y103.000 A246.3634
+G1 X89.760 Y103.653 A246.3893
+G1 X89.243 Y104.243 A246.4152
+G1 X88.653 Y104.760 A246.4411
+G1 X88.000 Y105.196 A246.4670
+G1 X87.296 Y105.543 A246.4929
+G1 X86.553 Y105.796 A246.5188
+G1 X85.783 Y105.949 A246.5447
+G1 X85.000 Y106.000 A246.5706
+G1 X84.217 Y105.949 A246.5965
+G1 X83.447 Y105.796 A246.6224
+G1 X82.704 Y105.543 A246.6483
+G1 X82.000 Y105.196 A246.6742
+G1 X81.347 Y104.760 A246.7001
+G1 X80.757 Y104.243 A246.7260
+G1 X80.240 Y103.653 A246.7519
+G1 X79.804 Y103.000 A246.7778
+G1 X79.457 Y102.296 A246.8037
+G1 X79.204 Y101.553 A246.8296
+G1 X79.051 Y100.783 A246.8555
+G1 X79.000 Y100.000 A246.8814
+G1 X79.051 Y99.217 A246.9073
+G1 X79.204 Y98.447 A246.9332
+G1 X79.457 Y97.704 A246.9591
+G1 X79.804 Y97.000 A246.9850
+G1 X80.240 Y96.347 A247.0109
+G1 X80.757 Y95.757 A247.0368
+G1 X81.347 Y95.240 A247.0627
+G1 X82.000 Y94.804 A247.0886
+G1 X82.704 Y94.457 A247.1145
+G1 X83.447 Y94.204 A247.1404
+G1 X84.217 Y94.051 A247.1663
+G1 X85.000 Y94.000 A247.1922
+G1 X85.783 Y94.051 A247.2181
+G1 X86.553 Y94.204 A247.2440
+G1 X87.296 Y94.457 A247.2699
+G1 X88.000 Y94.804 A247.2958
+G1 X88.653 Y95.240 A247.3217
+G1 X89.243 Y95.757 A247.3476
+G1 X89.760 Y96.347 A247.3735
+G1 X90.196 Y97.000 A247.3994
+G1 X90.543 Y97.704 A247.4253
+G1 X90.796 Y98.447 A247.4512
+G1 X90.949 Y99.217 A247.4771
+G1 X91.000 Y100.000 A247.5030
+G1 A246.5030 F2400
+G0 X91.450 Y100.000
+G1 A247.5030 F2400
+G1 F2400
+G1 X91.395 Y100.842 A247.5308
+G1 X91.230 Y101.669 A247.5587
+G1 X90.959 Y102.468 A247.5865
+G1 X90.586 Y103.225 A247.6144
+G1 X90.117 Y103.927 A247.6422
+G1 X89.561 Y104.561 A247.6701
+G1 X88.927 Y105.117 A247.6979
+G1 X88.225 Y105.586 A247.7257
+G1 X87.468 Y105.959 A247.7536
+G1 X86.669 Y106.230 A247.7814
+G1 X85.842 Y106.395 A247.8093
+G1 X85.000 Y106.450 A247.8371
+G1 X84.158 Y106.395 A247.8650
+G1 X83.331 Y106.230 A247.8928
+G1 X82.532 Y105.959 A247.9206
+G1 X81.775 Y105.586 A247.9485
+G1 X81.073 Y105.117 A247.9763
+G1 X80.439 Y104.561 A248.0042
+G1 X79.883 Y103.927 A248.0320
+G1 X79.414 Y103.225 A248.0598
+G1 X79.041 Y102.468 A248.0877
+G1 X78.770 Y101.669 A248.1155
+G1 X78.605 Y100.842 A248.1434
+G1 X78.550 Y100.000 A248.1712
+G1 X78.605 Y99.158 A248.1991
+G1 X78.770 Y98.331 A248.2269
+G1 X79.041 Y97.532 A248.2547
+G1 X79.414 Y96.775 A248.2826
+G1 X79.883 Y96.073 A248.3104
+G1 X80.439 Y95.439 A248.3383
+G1 X81.073 Y94.883 A248.3661
+G1 X81.775 Y94.414 A248.3940
+G1 X82.532 Y94.041 A248.4218
+G1 X83.331 Y93.770 A248.4496
+G1 X84.158 Y93.605 A248.4775
+G1 X85.000 Y93.550 A248.5053
+G1 X85.842 Y93.605 A248.5332
+G1 X86.669 Y93.770 A248.5610
+G1 X87.468 Y94.041 A248.5888
+G1 X88.225 Y94.414 A248.6167
+G1 X88.927 Y94.883 A248.6445
+G1 X89.561 Y95.439 A248.6724
+G1 X90.117 Y96.073 A248.7002
+G1 X90.586 Y96.775 A248.7281
+G1 X90.959 Y97.532 A248.7559
+G1 X91.230 Y98.331 A248.7837
+G1 X91.395 Y99.158 A248.8116
+G1 X91.450 Y100.000 A248.8394
+G0 X0 Y0
+M2
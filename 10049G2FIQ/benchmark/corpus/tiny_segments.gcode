@@ -0,0 +1,6011 @@
+; tiny segments - 0.05 to 0.2 mm moves at 6000 mm/min
+G21
+G90
+G92 A0
+G0 Z0.3
+G1 A-1.0000 F2400
+G0 X100.000 Y60.000
+G1 A0.0000 F2400
+G1 F6000
+G1 X100.125 Y59.913 A0.0050
+G1 X100.253 Y59.824 A0.0102
+G1 X100.384 Y59.735 A0.0154
+G1 X100.517 Y59.645 A0.0207
+G1 X100.652 Y59.555 A0.0261
+G1 X100.791 Y59.463 A0.0315
+G1 X100.932 Y59.371 A0.0371
+G1 X101.076 Y59.279 A0.0427
+G1 X101.222 Y59.186 A0.0485
+G1 X101.372 Y59.093 A0.0543
+G1 X101.524 Y59.000 A0.0602
+G1 X101.678 Y58.907 A0.0661
+G1 X101.836 Y58.814 A0.0721
+G1 X101.996 Y58.721 A0.0782
+G1 X102.159 Y58.629 A0.0844
+G1 X102.324 Y58.537 A0.0907
+G1 X102.492 Y58.446 A0.0970
+G1 X102.663 Y58.356 A0.1034
+G1 X102.836 Y58.267 A0.1098
+G1 X103.012 Y58.179 A0.1163
+G1 X103.191 Y58.092 A0.1228
+G1 X103.372 Y58.007 A0.1294
+G1 X103.556 Y57.924 A0.1361
+G1 X103.742 Y57.843 A0.1428
+G1 X103.930 Y57.763 A0.1495
+G1 X104.121 Y57.686 A0.1563
+G1 X104.314 Y57.612 A0.1631
+G1 X104.509 Y57.540 A0.1700
+G1 X104.706 Y57.471 A0.1769
+G1 X104.905 Y57.405 A0.1838
+G1 X105.106 Y57.342 A0.1908
+G1 X105.309 Y57.283 A0.1977
+G1 X105.514 Y57.227 A0.2048
+G1 X105.720 Y57.175 A0.2118
+G1 X105.928 Y57.127 A0.2188
+G1 X106.138 Y57.083 A0.2259
+G1 X106.348 Y57.043 A0.2330
+G1 X106.560 Y57.008 A0.2400
+G1 X106.773 Y56.978 A0.2471
+G1 X106.987 Y56.952 A0.2543
+G1 X107.202 Y56.931 A0.2614
+G1 X107.418 Y56.915 A0.2685
+G1 X107.634 Y56.905 A0.2757
+G1 X107.850 Y56.899 A0.2828
+G1 X108.067 Y56.899 A0.2900
+G1 X108.284 Y56.905 A0.2971
+G1 X108.501 Y56.916 A0.3043
+G1 X108.718 Y56.933 A0.3115
+G1 X108.935 Y56.956 A0.3187
+G1 X109.151 Y56.984 A0.3258
+G1 X109.366 Y57.018 A0.3330
+G1 X109.581 Y57.058 A0.3403
+G1 X109.795 Y57.104 A0.3475
+G1 X110.008 Y57.156 A0.3547
+G1 X110.220 Y57.214 A0.3620
+G1 X110.431 Y57.277 A0.3692
+G1 X110.640 Y57.346 A0.3765
+G1 X110.848 Y57.421 A0.3838
+G1 X111.054 Y57.502 A0.3911
+G1 X111.258 Y57.589 A0.3984
+G1 X111.460 Y57.680 A0.4057
+G1 X111.660 Y57.778 A0.4131
+G1 X111.859 Y57.880 A0.4204
+G1 X112.054 Y57.988 A0.4278
+G1 X112.248 Y58.101 A0.4352
+G1 X112.439 Y58.219 A0.4426
+G1 X112.628 Y58.342 A0.4501
+G1 X112.814 Y58.469 A0.4575
+G1 X112.997 Y58.600 A0.4649
+G1 X113.178 Y58.736 A0.4724
+G1 X113.356 Y58.876 A0.4799
+G1 X113.531 Y59.020 A0.4874
+G1 X113.703 Y59.168 A0.4948
+G1 X113.872 Y59.319 A0.5023
+G1 X114.039 Y59.473 A0.5098
+G1 X114.202 Y59.630 A0.5173
+G1 X114.362 Y59.790 A0.5248
+G1 X114.519 Y59.953 A0.5322
+G1 X114.674 Y60.118 A0.5397
+G1 X114.825 Y60.286 A0.5471
+G1 X114.973 Y60.455 A0.5546
+G1 X115.118 Y60.626 A0.5620
+G1 X115.260 Y60.799 A0.5693
+G1 X115.399 Y60.972 A0.5767
+G1 X115.535 Y61.147 A0.5840
+G1 X115.668 Y61.323 A0.5913
+G1 X115.799 Y61.500 A0.5985
+G1 X115.926 Y61.677 A0.6057
+G1 X116.050 Y61.854 A0.6128
+G1 X116.172 Y62.031 A0.6199
+G1 X116.291 Y62.208 A0.6270
+G1 X116.407 Y62.385 A0.6340
+G1 X116.521 Y62.561 A0.6409
+G1 X116.632 Y62.737 A0.6477
+G1 X116.740 Y62.912 A0.6545
+G1 X116.846 Y63.086 A0.6613
+G1 X116.950 Y63.258 A0.6679
+G1 X117.051 Y63.430 A0.6745
+G1 X117.150 Y63.600 A0.6810
+G1 X117.246 Y63.768 A0.6874
+G1 X117.341 Y63.935 A0.6937
+G1 X117.433 Y64.100 A0.6999
+G1 X117.523 Y64.264 A0.7061
+G1 X117.611 Y64.425 A0.7122
+G1 X117.697 Y64.584 A0.7181
+G1 X117.782 Y64.741 A0.7240
+G1 X117.864 Y64.896 A0.7298
+G1 X117.945 Y65.048 A0.7355
+G1 X118.024 Y65.198 A0.7411
+G1 X118.101 Y65.346 A0.7466
+G1 X118.176 Y65.491 A0.7520
+G1 X118.250 Y65.634 A0.7573
+G1 X118.322 Y65.774 A0.7625
+G1 X118.393 Y65.912 A0.7676
+G1 X118.463 Y66.047 A0.7726
+G1 X118.531 Y66.179 A0.7775
+G1 X118.597 Y66.309 A0.7823
+G1 X118.662 Y66.436 A0.7870
+G1 X118.726 Y66.561 A0.7917
+G1 X118.789 Y66.682 A0.7962
+G1 X118.850 Y66.802 A0.8006
+G1 X118.910 Y66.918 A0.8049
+G1 X118.969 Y67.032 A0.8092
+G1 X119.027 Y67.144 A0.8133
+G1 X119.084 Y67.252 A0.8174
+G1 X119.140 Y67.359 A0.8213
+G1 X119.194 Y67.462 A0.8252
+G1 X119.248 Y67.564 A0.8290
+G1 X119.301 Y67.663 A0.8327
+G1 X119.352 Y67.759 A0.8363
+G1 X119.403 Y67.853 A0.8398
+G1 X119.452 Y67.945 A0.8432
+G1 X119.501 Y68.034 A0.8466
+G1 X119.549 Y68.121 A0.8499
+G1 X119.596 Y68.206 A0.8531
+G1 X119.642 Y68.288 A0.8562
+G1 X119.687 Y68.369 A0.8592
+G1 X119.732 Y68.447 A0.8622
+G1 X119.775 Y68.524 A0.8651
+G1 X119.818 Y68.598 A0.8680
+G1 X119.860 Y68.671 A0.8707
+G1 X119.901 Y68.741 A0.8734
+G1 X119.942 Y68.810 A0.8761
+G1 X119.982 Y68.877 A0.8786
+G1 X120.021 Y68.942 A0.8811
+G1 X120.059 Y69.006 A0.8836
+G1 X120.097 Y69.068 A0.8860
+G1 X120.135 Y69.129 A0.8883
+G1 X120.171 Y69.187 A0.8906
+G1 X120.207 Y69.245 A0.8929
+G1 X120.242 Y69.301 A0.8951
+G1 X120.277 Y69.356 A0.8972
+G1 X120.312 Y69.409 A0.8993
+G1 X120.345 Y69.461 A0.9013
+G1 X120.379 Y69.512 A0.9033
+G1 X120.412 Y69.562 A0.9053
+G1 X120.444 Y69.611 A0.9072
+G1 X120.476 Y69.659 A0.9091
+G1 X120.508 Y69.705 A0.9110
+G1 X120.539 Y69.751 A0.9128
+G1 X120.570 Y69.796 A0.9146
+G1 X120.600 Y69.840 A0.9164
+G1 X120.631 Y69.883 A0.9181
+G1 X120.661 Y69.926 A0.9199
+G1 X120.691 Y69.968 A0.9216
+G1 X120.720 Y70.009 A0.9232
+G1 X120.750 Y70.049 A0.9249
+G1 X120.779 Y70.089 A0.9265
+G1 X120.808 Y70.129 A0.9281
+G1 X120.837 Y70.168 A0.9298
+G1 X120.866 Y70.207 A0.9313
+G1 X120.895 Y70.245 A0.9329
+G1 X120.924 Y70.283 A0.9345
+G1 X120.953 Y70.321 A0.9361
+G1 X120.982 Y70.358 A0.9376
+G1 X121.011 Y70.395 A0.9392
+G1 X121.041 Y70.433 A0.9408
+G1 X121.070 Y70.470 A0.9423
+G1 X121.100 Y70.506 A0.9439
+G1 X121.130 Y70.543 A0.9455
+G1 X121.160 Y70.580 A0.9470
+G1 X121.191 Y70.617 A0.9486
+G1 X121.222 Y70.654 A0.9502
+G1 X121.253 Y70.691 A0.9518
+G1 X121.285 Y70.728 A0.9534
+G1 X121.317 Y70.766 A0.9551
+G1 X121.350 Y70.803 A0.9567
+G1 X121.383 Y70.841 A0.9584
+G1 X121.417 Y70.879 A0.9600
+G1 X121.451 Y70.917 A0.9617
+G1 X121.487 Y70.956 A0.9635
+G1 X121.522 Y70.994 A0.9652
+G1 X121.559 Y71.034 A0.9670
+G1 X121.596 Y71.073 A0.9688
+G1 X121.634 Y71.113 A0.9706
+G1 X121.673 Y71.153 A0.9724
+G1 X121.713 Y71.194 A0.9743
+G1 X121.754 Y71.235 A0.9762
+G1 X121.796 Y71.277 A0.9782
+G1 X121.839 Y71.319 A0.9801
+G1 X121.883 Y71.361 A0.9822
+G1 X121.928 Y71.404 A0.9842
+G1 X121.974 Y71.447 A0.9863
+G1 X122.021 Y71.491 A0.9884
+G1 X122.070 Y71.535 A0.9906
+G1 X122.120 Y71.580 A0.9928
+G1 X122.171 Y71.625 A0.9951
+G1 X122.224 Y71.671 A0.9974
+G1 X122.278 Y71.717 A0.9997
+G1 X122.334 Y71.763 A1.0021
+G1 X122.391 Y71.810 A1.0046
+G1 X122.450 Y71.857 A1.0070
+G1 X122.510 Y71.905 A1.0096
+G1 X122.573 Y71.953 A1.0122
+G1 X122.636 Y72.002 A1.0148
+G1 X122.702 Y72.050 A1.0175
+G1 X122.770 Y72.100 A1.0203
+G1 X122.839 Y72.149 A1.0231
+G1 X122.911 Y72.199 A1.0260
+G1 X122.984 Y72.249 A1.0289
+G1 X123.060 Y72.299 A1.0319
+G1 X123.138 Y72.349 A1.0350
+G1 X123.218 Y72.400 A1.0381
+G1 X123.300 Y72.451 A1.0413
+G1 X123.385 Y72.502 A1.0445
+G1 X123.471 Y72.553 A1.0479
+G1 X123.561 Y72.604 A1.0513
+G1 X123.653 Y72.655 A1.0547
+G1 X123.747 Y72.706 A1.0583
+G1 X123.844 Y72.757 A1.0619
+G1 X123.944 Y72.809 A1.0656
+G1 X124.046 Y72.860 A1.0694
+G1 X124.151 Y72.911 A1.0732
+G1 X124.259 Y72.962 A1.0772
+G1 X124.370 Y73.012 A1.0812
+G1 X124.484 Y73.063 A1.0853
+G1 X124.600 Y73.114 A1.0895
+G1 X124.720 Y73.164 A1.0938
+G1 X124.843 Y73.214 A1.0982
+G1 X124.969 Y73.264 A1.1026
+G1 X125.098 Y73.314 A1.1072
+G1 X125.230 Y73.364 A1.1119
+G1 X125.366 Y73.413 A1.1166
+G1 X125.505 Y73.462 A1.1215
+G1 X125.647 Y73.511 A1.1264
+G1 X125.792 Y73.560 A1.1315
+G1 X125.941 Y73.608 A1.1367
+G1 X126.093 Y73.657 A1.1419
+G1 X126.249 Y73.705 A1.1473
+G1 X126.408 Y73.753 A1.1528
+G1 X126.570 Y73.801 A1.1584
+G1 X126.736 Y73.849 A1.1641
+G1 X126.905 Y73.897 A1.1699
+G1 X127.077 Y73.945 A1.1758
+G1 X127.253 Y73.993 A1.1818
+G1 X127.432 Y74.042 A1.1879
+G1 X127.614 Y74.090 A1.1941
+G1 X127.800 Y74.139 A1.2005
+G1 X127.989 Y74.188 A1.2069
+G1 X128.180 Y74.237 A1.2134
+G1 X128.375 Y74.287 A1.2201
+G1 X128.573 Y74.338 A1.2268
+G1 X128.774 Y74.389 A1.2336
+G1 X128.977 Y74.441 A1.2406
+G1 X129.183 Y74.493 A1.2476
+G1 X129.392 Y74.547 A1.2547
+G1 X129.603 Y74.602 A1.2619
+G1 X129.816 Y74.657 A1.2692
+G1 X130.032 Y74.714 A1.2765
+G1 X130.249 Y74.772 A1.2840
+G1 X130.469 Y74.832 A1.2915
+G1 X130.690 Y74.893 A1.2990
+G1 X130.913 Y74.956 A1.3067
+G1 X131.137 Y75.021 A1.3144
+G1 X131.363 Y75.087 A1.3221
+G1 X131.589 Y75.155 A1.3299
+G1 X131.816 Y75.226 A1.3378
+G1 X132.044 Y75.298 A1.3457
+G1 X132.273 Y75.373 A1.3536
+G1 X132.501 Y75.450 A1.3616
+G1 X132.730 Y75.529 A1.3696
+G1 X132.959 Y75.611 A1.3776
+G1 X133.187 Y75.696 A1.3856
+G1 X133.414 Y75.783 A1.3936
+G1 X133.641 Y75.873 A1.4017
+G1 X133.866 Y75.965 A1.4097
+G1 X134.090 Y76.061 A1.4178
+G1 X134.313 Y76.159 A1.4258
+G1 X134.534 Y76.261 A1.4338
+G1 X134.753 Y76.365 A1.4418
+G1 X134.970 Y76.473 A1.4498
+G1 X135.184 Y76.583 A1.4578
+G1 X135.396 Y76.697 A1.4657
+G1 X135.605 Y76.813 A1.4736
+G1 X135.811 Y76.933 A1.4815
+G1 X136.014 Y77.055 A1.4893
+G1 X136.213 Y77.181 A1.4971
+G1 X136.409 Y77.310 A1.5048
+G1 X136.601 Y77.441 A1.5125
+G1 X136.789 Y77.576 A1.5201
+G1 X136.973 Y77.714 A1.5277
+G1 X137.153 Y77.854 A1.5352
+G1 X137.329 Y77.997 A1.5427
+G1 X137.500 Y78.143 A1.5501
+G1 X137.667 Y78.291 A1.5575
+G1 X137.828 Y78.442 A1.5648
+G1 X137.986 Y78.595 A1.5720
+G1 X138.138 Y78.751 A1.5792
+G1 X138.285 Y78.909 A1.5863
+G1 X138.427 Y79.069 A1.5934
+G1 X138.565 Y79.231 A1.6004
+G1 X138.697 Y79.395 A1.6074
+G1 X138.824 Y79.561 A1.6143
+G1 X138.945 Y79.728 A1.6211
+G1 X139.062 Y79.897 A1.6279
+G1 X139.174 Y80.068 A1.6346
+G1 X139.280 Y80.239 A1.6412
+G1 X139.382 Y80.412 A1.6479
+G1 X139.478 Y80.586 A1.6544
+G1 X139.569 Y80.760 A1.6609
+G1 X139.655 Y80.935 A1.6674
+G1 X139.736 Y81.111 A1.6737
+G1 X139.813 Y81.287 A1.6801
+G1 X139.885 Y81.464 A1.6864
+G1 X139.952 Y81.641 A1.6926
+G1 X140.014 Y81.817 A1.6988
+G1 X140.072 Y81.994 A1.7049
+G1 X140.125 Y82.170 A1.7110
+G1 X140.174 Y82.346 A1.7170
+G1 X140.219 Y82.522 A1.7230
+G1 X140.260 Y82.697 A1.7289
+G1 X140.297 Y82.871 A1.7348
+G1 X140.330 Y83.045 A1.7407
+G1 X140.360 Y83.217 A1.7464
+G1 X140.386 Y83.388 A1.7521
+G1 X140.408 Y83.559 A1.7578
+G1 X140.427 Y83.728 A1.7634
+G1 X140.443 Y83.895 A1.7690
+G1 X140.456 Y84.061 A1.7745
+G1 X140.466 Y84.226 A1.7799
+G1 X140.473 Y84.389 A1.7853
+G1 X140.477 Y84.551 A1.7906
+G1 X140.479 Y84.710 A1.7959
+G1 X140.479 Y84.868 A1.8011
+G1 X140.476 Y85.024 A1.8063
+G1 X140.471 Y85.178 A1.8114
+G1 X140.464 Y85.330 A1.8164
+G1 X140.455 Y85.480 A1.8213
+G1 X140.445 Y85.628 A1.8262
+G1 X140.433 Y85.774 A1.8311
+G1 X140.419 Y85.918 A1.8358
+G1 X140.404 Y86.059 A1.8405
+G1 X140.387 Y86.199 A1.8452
+G1 X140.369 Y86.336 A1.8497
+G1 X140.350 Y86.471 A1.8542
+G1 X140.330 Y86.603 A1.8586
+G1 X140.309 Y86.733 A1.8630
+G1 X140.287 Y86.861 A1.8673
+G1 X140.265 Y86.987 A1.8715
+G1 X140.242 Y87.111 A1.8756
+G1 X140.218 Y87.232 A1.8797
+G1 X140.193 Y87.351 A1.8837
+G1 X140.168 Y87.467 A1.8877
+G1 X140.143 Y87.582 A1.8915
+G1 X140.117 Y87.694 A1.8953
+G1 X140.091 Y87.804 A1.8990
+G1 X140.065 Y87.912 A1.9027
+G1 X140.038 Y88.017 A1.9063
+G1 X140.012 Y88.121 A1.9098
+G1 X139.985 Y88.222 A1.9133
+G1 X139.958 Y88.321 A1.9167
+G1 X139.931 Y88.418 A1.9200
+G1 X139.905 Y88.514 A1.9233
+G1 X139.878 Y88.607 A1.9265
+G1 X139.851 Y88.698 A1.9296
+G1 X139.824 Y88.787 A1.9327
+G1 X139.798 Y88.875 A1.9357
+G1 X139.772 Y88.961 A1.9387
+G1 X139.745 Y89.045 A1.9416
+G1 X139.719 Y89.127 A1.9444
+G1 X139.693 Y89.207 A1.9472
+G1 X139.668 Y89.286 A1.9499
+G1 X139.642 Y89.363 A1.9526
+G1 X139.617 Y89.439 A1.9553
+G1 X139.592 Y89.514 A1.9578
+G1 X139.567 Y89.587 A1.9604
+G1 X139.542 Y89.658 A1.9629
+G1 X139.518 Y89.728 A1.9653
+G1 X139.494 Y89.797 A1.9678
+G1 X139.470 Y89.865 A1.9701
+G1 X139.446 Y89.932 A1.9725
+G1 X139.422 Y89.997 A1.9748
+G1 X139.399 Y90.062 A1.9770
+G1 X139.375 Y90.126 A1.9793
+G1 X139.352 Y90.188 A1.9815
+G1 X139.329 Y90.250 A1.9837
+G1 X139.306 Y90.312 A1.9858
+G1 X139.283 Y90.372 A1.9879
+G1 X139.260 Y90.432 A1.9901
+G1 X139.238 Y90.491 A1.9922
+G1 X139.215 Y90.550 A1.9942
+G1 X139.193 Y90.608 A1.9963
+G1 X139.170 Y90.666 A1.9983
+G1 X139.148 Y90.723 A2.0004
+G1 X139.125 Y90.780 A2.0024
+G1 X139.102 Y90.837 A2.0044
+G1 X139.080 Y90.894 A2.0064
+G1 X139.057 Y90.951 A2.0085
+G1 X139.034 Y91.008 A2.0105
+G1 X139.011 Y91.064 A2.0125
+G1 X138.988 Y91.121 A2.0145
+G1 X138.965 Y91.178 A2.0166
+G1 X138.941 Y91.236 A2.0186
+G1 X138.918 Y91.293 A2.0207
+G1 X138.894 Y91.351 A2.0227
+G1 X138.869 Y91.409 A2.0248
+G1 X138.845 Y91.468 A2.0269
+G1 X138.820 Y91.527 A2.0290
+G1 X138.795 Y91.587 A2.0311
+G1 X138.769 Y91.647 A2.0333
+G1 X138.744 Y91.708 A2.0355
+G1 X138.717 Y91.770 A2.0377
+G1 X138.691 Y91.832 A2.0400
+G1 X138.663 Y91.896 A2.0422
+G1 X138.636 Y91.960 A2.0445
+G1 X138.607 Y92.025 A2.0469
+G1 X138.579 Y92.091 A2.0493
+G1 X138.550 Y92.158 A2.0517
+G1 X138.520 Y92.226 A2.0541
+G1 X138.489 Y92.295 A2.0566
+G1 X138.458 Y92.366 A2.0592
+G1 X138.427 Y92.437 A2.0617
+G1 X138.395 Y92.510 A2.0644
+G1 X138.362 Y92.584 A2.0670
+G1 X138.328 Y92.660 A2.0698
+G1 X138.294 Y92.736 A2.0725
+G1 X138.259 Y92.814 A2.0754
+G1 X138.224 Y92.894 A2.0782
+G1 X138.188 Y92.975 A2.0811
+G1 X138.151 Y93.057 A2.0841
+G1 X138.113 Y93.141 A2.0872
+G1 X138.075 Y93.226 A2.0902
+G1 X138.036 Y93.313 A2.0934
+G1 X137.996 Y93.401 A2.0966
+G1 X137.955 Y93.491 A2.0998
+G1 X137.914 Y93.582 A2.1031
+G1 X137.872 Y93.675 A2.1065
+G1 X137.829 Y93.770 A2.1099
+G1 X137.786 Y93.866 A2.1134
+G1 X137.742 Y93.964 A2.1170
+G1 X137.698 Y94.063 A2.1205
+G1 X137.652 Y94.164 A2.1242
+G1 X137.606 Y94.267 A2.1279
+G1 X137.560 Y94.371 A2.1317
+G1 X137.513 Y94.477 A2.1355
+G1 X137.466 Y94.585 A2.1394
+G1 X137.418 Y94.694 A2.1433
+G1 X137.370 Y94.804 A2.1473
+G1 X137.321 Y94.917 A2.1513
+G1 X137.272 Y95.030 A2.1554
+G1 X137.223 Y95.146 A2.1596
+G1 X137.173 Y95.263 A2.1638
+G1 X137.124 Y95.381 A2.1680
+G1 X137.074 Y95.501 A2.1723
+G1 X137.024 Y95.623 A2.1766
+G1 X136.974 Y95.746 A2.1810
+G1 X136.925 Y95.871 A2.1854
+G1 X136.876 Y95.997 A2.1899
+G1 X136.827 Y96.124 A2.1944
+G1 X136.778 Y96.253 A2.1989
+G1 X136.730 Y96.383 A2.2035
+G1 X136.682 Y96.515 A2.2081
+G1 X136.635 Y96.648 A2.2128
+G1 X136.589 Y96.782 A2.2175
+G1 X136.544 Y96.918 A2.2222
+G1 X136.500 Y97.055 A2.2270
+G1 X136.457 Y97.194 A2.2317
+G1 X136.415 Y97.333 A2.2365
+G1 X136.374 Y97.474 A2.2414
+G1 X136.335 Y97.616 A2.2463
+G1 X136.298 Y97.760 A2.2511
+G1 X136.262 Y97.904 A2.2561
+G1 X136.228 Y98.050 A2.2610
+G1 X136.195 Y98.197 A2.2660
+G1 X136.165 Y98.345 A2.2710
+G1 X136.137 Y98.495 A2.2760
+G1 X136.112 Y98.645 A2.2810
+G1 X136.088 Y98.797 A2.2861
+G1 X136.067 Y98.950 A2.2912
+G1 X136.049 Y99.104 A2.2963
+G1 X136.034 Y99.260 A2.3015
+G1 X136.021 Y99.416 A2.3066
+G1 X136.011 Y99.574 A2.3119
+G1 X136.004 Y99.733 A2.3171
+G1 X136.001 Y99.893 A2.3224
+G1 X136.000 Y100.055 A2.3277
+G1 X136.003 Y100.218 A2.3331
+G1 X136.009 Y100.382 A2.3385
+G1 X136.018 Y100.547 A2.3440
+G1 X136.031 Y100.714 A2.3495
+G1 X136.048 Y100.881 A2.3551
+G1 X136.068 Y101.051 A2.3607
+G1 X136.091 Y101.221 A2.3664
+G1 X136.118 Y101.393 A2.3721
+G1 X136.149 Y101.567 A2.3779
+G1 X136.183 Y101.742 A2.3838
+G1 X136.220 Y101.918 A2.3898
+G1 X136.262 Y102.096 A2.3958
+G1 X136.306 Y102.275 A2.4019
+G1 X136.355 Y102.455 A2.4080
+G1 X136.406 Y102.638 A2.4143
+G1 X136.461 Y102.821 A2.4206
+G1 X136.520 Y103.006 A2.4270
+G1 X136.581 Y103.193 A2.4335
+G1 X136.646 Y103.381 A2.4401
+G1 X136.713 Y103.571 A2.4467
+G1 X136.784 Y103.763 A2.4535
+G1 X136.857 Y103.955 A2.4603
+G1 X136.933 Y104.150 A2.4672
+G1 X137.012 Y104.346 A2.4741
+G1 X137.092 Y104.543 A2.4812
+G1 X137.175 Y104.742 A2.4883
+G1 X137.260 Y104.942 A2.4954
+G1 X137.347 Y105.144 A2.5027
+G1 X137.436 Y105.347 A2.5100
+G1 X137.526 Y105.551 A2.5174
+G1 X137.617 Y105.757 A2.5248
+G1 X137.710 Y105.964 A2.5323
+G1 X137.803 Y106.172 A2.5398
+G1 X137.897 Y106.381 A2.5474
+G1 X137.992 Y106.591 A2.5550
+G1 X138.087 Y106.802 A2.5626
+G1 X138.183 Y107.014 A2.5703
+G1 X138.278 Y107.227 A2.5780
+G1 X138.373 Y107.441 A2.5857
+G1 X138.468 Y107.655 A2.5934
+G1 X138.562 Y107.870 A2.6012
+G1 X138.655 Y108.085 A2.6089
+G1 X138.747 Y108.301 A2.6167
+G1 X138.838 Y108.517 A2.6244
+G1 X138.928 Y108.733 A2.6321
+G1 X139.017 Y108.949 A2.6398
+G1 X139.103 Y109.165 A2.6475
+G1 X139.188 Y109.381 A2.6552
+G1 X139.271 Y109.596 A2.6628
+G1 X139.352 Y109.811 A2.6704
+G1 X139.431 Y110.026 A2.6779
+G1 X139.507 Y110.240 A2.6854
+G1 X139.581 Y110.453 A2.6929
+G1 X139.652 Y110.666 A2.7002
+G1 X139.721 Y110.877 A2.7076
+G1 X139.786 Y111.088 A2.7149
+G1 X139.850 Y111.297 A2.7221
+G1 X139.910 Y111.505 A2.7292
+G1 X139.967 Y111.711 A2.7363
+G1 X140.021 Y111.916 A2.7433
+G1 X140.072 Y112.119 A2.7502
+G1 X140.121 Y112.321 A2.7570
+G1 X140.166 Y112.521 A2.7638
+G1 X140.208 Y112.719 A2.7705
+G1 X140.246 Y112.914 A2.7771
+G1 X140.282 Y113.108 A2.7836
+G1 X140.315 Y113.300 A2.7900
+G1 X140.344 Y113.489 A2.7963
+G1 X140.371 Y113.676 A2.8025
+G1 X140.394 Y113.861 A2.8087
+G1 X140.415 Y114.043 A2.8147
+G1 X140.432 Y114.223 A2.8207
+G1 X140.447 Y114.400 A2.8266
+G1 X140.459 Y114.575 A2.8323
+G1 X140.468 Y114.747 A2.8380
+G1 X140.474 Y114.916 A2.8436
+G1 X140.478 Y115.082 A2.8491
+G1 X140.479 Y115.246 A2.8545
+G1 X140.478 Y115.407 A2.8598
+G1 X140.474 Y115.565 A2.8650
+G1 X140.468 Y115.720 A2.8701
+G1 X140.460 Y115.873 A2.8752
+G1 X140.450 Y116.022 A2.8801
+G1 X140.437 Y116.169 A2.8850
+G1 X140.423 Y116.313 A2.8898
+G1 X140.406 Y116.454 A2.8944
+G1 X140.388 Y116.592 A2.8990
+G1 X140.369 Y116.727 A2.9035
+G1 X140.347 Y116.859 A2.9080
+G1 X140.324 Y116.989 A2.9123
+G1 X140.300 Y117.115 A2.9166
+G1 X140.274 Y117.239 A2.9207
+G1 X140.247 Y117.360 A2.9248
+G1 X140.219 Y117.479 A2.9288
+G1 X140.190 Y117.594 A2.9328
+G1 X140.160 Y117.707 A2.9366
+G1 X140.129 Y117.818 A2.9404
+G1 X140.097 Y117.925 A2.9441
+G1 X140.064 Y118.031 A2.9478
+G1 X140.031 Y118.133 A2.9513
+G1 X139.997 Y118.233 A2.9548
+G1 X139.962 Y118.331 A2.9582
+G1 X139.927 Y118.426 A2.9616
+G1 X139.891 Y118.519 A2.9649
+G1 X139.855 Y118.610 A2.9681
+G1 X139.819 Y118.698 A2.9712
+G1 X139.782 Y118.784 A2.9743
+G1 X139.746 Y118.868 A2.9774
+G1 X139.709 Y118.950 A2.9803
+G1 X139.672 Y119.030 A2.9832
+G1 X139.635 Y119.108 A2.9861
+G1 X139.597 Y119.184 A2.9889
+G1 X139.560 Y119.258 A2.9916
+G1 X139.523 Y119.330 A2.9943
+G1 X139.485 Y119.400 A2.9969
+G1 X139.448 Y119.469 A2.9995
+G1 X139.411 Y119.536 A3.0020
+G1 X139.374 Y119.601 A3.0045
+G1 X139.337 Y119.665 A3.0069
+G1 X139.300 Y119.727 A3.0093
+G1 X139.264 Y119.788 A3.0116
+G1 X139.227 Y119.847 A3.0139
+G1 X139.191 Y119.905 A3.0162
+G1 X139.155 Y119.962 A3.0184
+G1 X139.119 Y120.018 A3.0206
+G1 X139.083 Y120.072 A3.0228
+G1 X139.047 Y120.125 A3.0249
+G1 X139.011 Y120.178 A3.0270
+G1 X138.976 Y120.229 A3.0290
+G1 X138.940 Y120.279 A3.0311
+G1 X138.905 Y120.328 A3.0331
+G1 X138.869 Y120.377 A3.0350
+G1 X138.834 Y120.425 A3.0370
+G1 X138.799 Y120.472 A3.0389
+G1 X138.764 Y120.518 A3.0409
+G1 X138.729 Y120.564 A3.0428
+G1 X138.693 Y120.609 A3.0447
+G1 X138.658 Y120.654 A3.0465
+G1 X138.623 Y120.698 A3.0484
+G1 X138.587 Y120.741 A3.0503
+G1 X138.551 Y120.785 A3.0521
+G1 X138.515 Y120.828 A3.0540
+G1 X138.479 Y120.870 A3.0558
+G1 X138.443 Y120.913 A3.0577
+G1 X138.406 Y120.955 A3.0595
+G1 X138.369 Y120.997 A3.0614
+G1 X138.332 Y121.039 A3.0632
+G1 X138.294 Y121.081 A3.0651
+G1 X138.255 Y121.123 A3.0670
+G1 X138.216 Y121.165 A3.0688
+G1 X138.177 Y121.207 A3.0707
+G1 X138.137 Y121.250 A3.0727
+G1 X138.096 Y121.292 A3.0746
+G1 X138.055 Y121.335 A3.0766
+G1 X138.013 Y121.377 A3.0785
+G1 X137.970 Y121.420 A3.0806
+G1 X137.926 Y121.464 A3.0826
+G1 X137.881 Y121.507 A3.0846
+G1 X137.836 Y121.551 A3.0867
+G1 X137.789 Y121.595 A3.0889
+G1 X137.741 Y121.640 A3.0910
+G1 X137.692 Y121.685 A3.0932
+G1 X137.642 Y121.731 A3.0955
+G1 X137.591 Y121.777 A3.0977
+G1 X137.538 Y121.824 A3.1000
+G1 X137.484 Y121.871 A3.1024
+G1 X137.429 Y121.918 A3.1048
+G1 X137.372 Y121.967 A3.1073
+G1 X137.314 Y122.015 A3.1098
+G1 X137.254 Y122.065 A3.1123
+G1 X137.193 Y122.115 A3.1150
+G1 X137.129 Y122.165 A3.1176
+G1 X137.064 Y122.216 A3.1204
+G1 X136.998 Y122.268 A3.1231
+G1 X136.929 Y122.320 A3.1260
+G1 X136.858 Y122.373 A3.1289
+G1 X136.786 Y122.427 A3.1319
+G1 X136.711 Y122.481 A3.1349
+G1 X136.634 Y122.535 A3.1380
+G1 X136.555 Y122.590 A3.1412
+G1 X136.474 Y122.646 A3.1445
+G1 X136.391 Y122.702 A3.1478
+G1 X136.305 Y122.759 A3.1512
+G1 X136.217 Y122.817 A3.1546
+G1 X136.126 Y122.874 A3.1582
+G1 X136.033 Y122.933 A3.1618
+G1 X135.937 Y122.991 A3.1655
+G1 X135.839 Y123.051 A3.1693
+G1 X135.738 Y123.110 A3.1732
+G1 X135.635 Y123.170 A3.1771
+G1 X135.528 Y123.230 A3.1812
+G1 X135.419 Y123.291 A3.1853
+G1 X135.307 Y123.352 A3.1895
+G1 X135.193 Y123.413 A3.1938
+G1 X135.075 Y123.474 A3.1981
+G1 X134.954 Y123.535 A3.2026
+G1 X134.831 Y123.597 A3.2071
+G1 X134.705 Y123.658 A3.2118
+G1 X134.575 Y123.720 A3.2165
+G1 X134.443 Y123.781 A3.2213
+G1 X134.308 Y123.843 A3.2262
+G1 X134.170 Y123.904 A3.2312
+G1 X134.028 Y123.966 A3.2363
+G1 X133.884 Y124.027 A3.2415
+G1 X133.737 Y124.088 A3.2467
+G1 X133.587 Y124.149 A3.2521
+G1 X133.434 Y124.210 A3.2575
+G1 X133.278 Y124.270 A3.2630
+G1 X133.119 Y124.330 A3.2686
+G1 X132.957 Y124.389 A3.2743
+G1 X132.793 Y124.449 A3.2801
+G1 X132.626 Y124.507 A3.2859
+G1 X132.456 Y124.566 A3.2919
+G1 X132.283 Y124.624 A3.2979
+G1 X132.108 Y124.681 A3.3039
+G1 X131.931 Y124.738 A3.3101
+G1 X131.751 Y124.795 A3.3163
+G1 X131.569 Y124.851 A3.3226
+G1 X131.385 Y124.907 A3.3290
+G1 X131.198 Y124.962 A3.3354
+G1 X131.010 Y125.016 A3.3419
+G1 X130.819 Y125.071 A3.3484
+G1 X130.627 Y125.124 A3.3550
+G1 X130.433 Y125.178 A3.3616
+G1 X130.238 Y125.231 A3.3683
+G1 X130.041 Y125.283 A3.3750
+G1 X129.843 Y125.336 A3.3818
+G1 X129.644 Y125.388 A3.3886
+G1 X129.444 Y125.440 A3.3954
+G1 X129.243 Y125.491 A3.4022
+G1 X129.041 Y125.543 A3.4091
+G1 X128.839 Y125.595 A3.4160
+G1 X128.636 Y125.646 A3.4229
+G1 X128.433 Y125.698 A3.4298
+G1 X128.230 Y125.750 A3.4367
+G1 X128.027 Y125.802 A3.4436
+G1 X127.825 Y125.855 A3.4505
+G1 X127.622 Y125.908 A3.4574
+G1 X127.421 Y125.961 A3.4643
+G1 X127.220 Y126.016 A3.4712
+G1 X127.019 Y126.071 A3.4781
+G1 X126.820 Y126.127 A3.4849
+G1 X126.622 Y126.184 A3.4917
+G1 X126.425 Y126.242 A3.4985
+G1 X126.230 Y126.301 A3.5052
+G1 X126.036 Y126.361 A3.5119
+G1 X125.844 Y126.423 A3.5186
+G1 X125.654 Y126.487 A3.5252
+G1 X125.465 Y126.552 A3.5318
+G1 X125.279 Y126.619 A3.5383
+G1 X125.095 Y126.687 A3.5448
+G1 X124.913 Y126.758 A3.5512
+G1 X124.733 Y126.831 A3.5576
+G1 X124.556 Y126.905 A3.5640
+G1 X124.381 Y126.983 A3.5703
+G1 X124.209 Y127.062 A3.5765
+G1 X124.039 Y127.144 A3.5827
+G1 X123.872 Y127.228 A3.5889
+G1 X123.708 Y127.315 A3.5950
+G1 X123.546 Y127.404 A3.6011
+G1 X123.388 Y127.497 A3.6072
+G1 X123.232 Y127.591 A3.6132
+G1 X123.078 Y127.689 A3.6192
+G1 X122.928 Y127.790 A3.6252
+G1 X122.780 Y127.893 A3.6311
+G1 X122.636 Y127.999 A3.6371
+G1 X122.494 Y128.108 A3.6430
+G1 X122.354 Y128.220 A3.6489
+G1 X122.218 Y128.335 A3.6547
+G1 X122.084 Y128.452 A3.6606
+G1 X121.953 Y128.572 A3.6665
+G1 X121.824 Y128.696 A3.6724
+G1 X121.698 Y128.822 A3.6783
+G1 X121.574 Y128.950 A3.6841
+G1 X121.453 Y129.081 A3.6900
+G1 X121.334 Y129.215 A3.6959
+G1 X121.218 Y129.351 A3.7019
+G1 X121.103 Y129.490 A3.7078
+G1 X120.991 Y129.631 A3.7137
+G1 X120.881 Y129.774 A3.7197
+G1 X120.773 Y129.919 A3.7257
+G1 X120.666 Y130.066 A3.7317
+G1 X120.562 Y130.215 A3.7377
+G1 X120.459 Y130.366 A3.7437
+G1 X120.358 Y130.519 A3.7497
+G1 X120.259 Y130.673 A3.7558
+G1 X120.161 Y130.828 A3.7618
+G1 X120.065 Y130.985 A3.7679
+G1 X119.970 Y131.143 A3.7740
+G1 X119.876 Y131.302 A3.7801
+G1 X119.784 Y131.461 A3.7862
+G1 X119.693 Y131.621 A3.7922
+G1 X119.603 Y131.782 A3.7983
+G1 X119.514 Y131.943 A3.8044
+G1 X119.426 Y132.105 A3.8105
+G1 X119.339 Y132.266 A3.8165
+G1 X119.252 Y132.428 A3.8226
+G1 X119.167 Y132.589 A3.8286
+G1 X119.083 Y132.750 A3.8346
+G1 X118.999 Y132.911 A3.8406
+G1 X118.916 Y133.071 A3.8465
+G1 X118.834 Y133.231 A3.8524
+G1 X118.752 Y133.389 A3.8583
+G1 X118.671 Y133.547 A3.8642
+G1 X118.591 Y133.703 A3.8700
+G1 X118.511 Y133.859 A3.8757
+G1 X118.432 Y134.013 A3.8815
+G1 X118.353 Y134.166 A3.8871
+G1 X118.275 Y134.317 A3.8927
+G1 X118.198 Y134.467 A3.8983
+G1 X118.121 Y134.615 A3.9038
+G1 X118.045 Y134.762 A3.9093
+G1 X117.969 Y134.906 A3.9147
+G1 X117.893 Y135.049 A3.9200
+G1 X117.819 Y135.190 A3.9252
+G1 X117.745 Y135.328 A3.9304
+G1 X117.671 Y135.465 A3.9356
+G1 X117.598 Y135.600 A3.9406
+G1 X117.525 Y135.732 A3.9456
+G1 X117.453 Y135.863 A3.9505
+G1 X117.382 Y135.991 A3.9554
+G1 X117.311 Y136.117 A3.9601
+G1 X117.241 Y136.240 A3.9648
+G1 X117.172 Y136.362 A3.9694
+G1 X117.103 Y136.481 A3.9740
+G1 X117.035 Y136.598 A3.9784
+G1 X116.967 Y136.712 A3.9828
+G1 X116.901 Y136.824 A3.9871
+G1 X116.835 Y136.934 A3.9913
+G1 X116.769 Y137.041 A3.9955
+G1 X116.704 Y137.146 A3.9996
+G1 X116.640 Y137.249 A4.0036
+G1 X116.577 Y137.350 A4.0075
+G1 X116.515 Y137.448 A4.0113
+G1 X116.453 Y137.544 A4.0151
+G1 X116.392 Y137.638 A4.0188
+G1 X116.332 Y137.730 A4.0224
+G1 X116.272 Y137.820 A4.0260
+G1 X116.214 Y137.907 A4.0294
+G1 X116.156 Y137.993 A4.0329
+G1 X116.099 Y138.076 A4.0362
+G1 X116.042 Y138.158 A4.0395
+G1 X115.987 Y138.237 A4.0427
+G1 X115.932 Y138.315 A4.0458
+G1 X115.878 Y138.390 A4.0489
+G1 X115.825 Y138.464 A4.0519
+G1 X115.772 Y138.536 A4.0548
+G1 X115.720 Y138.607 A4.0577
+G1 X115.669 Y138.675 A4.0605
+G1 X115.619 Y138.743 A4.0633
+G1 X115.569 Y138.808 A4.0660
+G1 X115.520 Y138.872 A4.0687
+G1 X115.472 Y138.934 A4.0713
+G1 X115.424 Y138.996 A4.0738
+G1 X115.377 Y139.055 A4.0763
+G1 X115.331 Y139.114 A4.0788
+G1 X115.285 Y139.171 A4.0812
+G1 X115.240 Y139.227 A4.0836
+G1 X115.195 Y139.281 A4.0859
+G1 X115.150 Y139.335 A4.0882
+G1 X115.107 Y139.388 A4.0905
+G1 X115.063 Y139.439 A4.0927
+G1 X115.020 Y139.490 A4.0949
+G1 X114.978 Y139.540 A4.0971
+G1 X114.935 Y139.589 A4.0992
+G1 X114.893 Y139.637 A4.1013
+G1 X114.852 Y139.684 A4.1034
+G1 X114.810 Y139.731 A4.1054
+G1 X114.769 Y139.777 A4.1075
+G1 X114.728 Y139.823 A4.1095
+G1 X114.687 Y139.868 A4.1115
+G1 X114.646 Y139.912 A4.1135
+G1 X114.605 Y139.956 A4.1155
+G1 X114.564 Y140.000 A4.1175
+G1 X114.523 Y140.043 A4.1195
+G1 X114.482 Y140.086 A4.1214
+G1 X114.441 Y140.129 A4.1234
+G1 X114.399 Y140.172 A4.1253
+G1 X114.358 Y140.214 A4.1273
+G1 X114.316 Y140.257 A4.1293
+G1 X114.273 Y140.299 A4.1312
+G1 X114.231 Y140.341 A4.1332
+G1 X114.188 Y140.384 A4.1352
+G1 X114.144 Y140.426 A4.1372
+G1 X114.100 Y140.468 A4.1392
+G1 X114.056 Y140.511 A4.1413
+G1 X114.011 Y140.554 A4.1433
+G1 X113.965 Y140.596 A4.1454
+G1 X113.918 Y140.640 A4.1475
+G1 X113.871 Y140.683 A4.1496
+G1 X113.823 Y140.726 A4.1517
+G1 X113.774 Y140.770 A4.1539
+G1 X113.724 Y140.814 A4.1561
+G1 X113.673 Y140.859 A4.1583
+G1 X113.621 Y140.904 A4.1606
+G1 X113.568 Y140.949 A4.1629
+G1 X113.514 Y140.994 A4.1652
+G1 X113.458 Y141.040 A4.1676
+G1 X113.402 Y141.087 A4.1700
+G1 X113.344 Y141.133 A4.1725
+G1 X113.285 Y141.180 A4.1750
+G1 X113.224 Y141.228 A4.1775
+G1 X113.162 Y141.276 A4.1801
+G1 X113.099 Y141.324 A4.1827
+G1 X113.034 Y141.373 A4.1854
+G1 X112.967 Y141.422 A4.1881
+G1 X112.899 Y141.471 A4.1909
+G1 X112.829 Y141.521 A4.1938
+G1 X112.757 Y141.571 A4.1966
+G1 X112.683 Y141.621 A4.1996
+G1 X112.608 Y141.672 A4.2026
+G1 X112.530 Y141.723 A4.2056
+G1 X112.451 Y141.773 A4.2088
+G1 X112.370 Y141.825 A4.2119
+G1 X112.286 Y141.876 A4.2151
+G1 X112.201 Y141.927 A4.2184
+G1 X112.113 Y141.978 A4.2218
+G1 X112.024 Y142.029 A4.2252
+G1 X111.932 Y142.080 A4.2287
+G1 X111.837 Y142.131 A4.2322
+G1 X111.741 Y142.181 A4.2358
+G1 X111.642 Y142.232 A4.2395
+G1 X111.540 Y142.281 A4.2432
+G1 X111.436 Y142.331 A4.2470
+G1 X111.330 Y142.379 A4.2508
+G1 X111.221 Y142.427 A4.2548
+G1 X111.110 Y142.475 A4.2587
+G1 X110.996 Y142.521 A4.2628
+G1 X110.880 Y142.566 A4.2669
+G1 X110.760 Y142.611 A4.2711
+G1 X110.639 Y142.654 A4.2754
+G1 X110.514 Y142.696 A4.2797
+G1 X110.387 Y142.737 A4.2841
+G1 X110.257 Y142.776 A4.2886
+G1 X110.125 Y142.813 A4.2932
+G1 X109.989 Y142.849 A4.2978
+G1 X109.851 Y142.883 A4.3025
+G1 X109.710 Y142.915 A4.3072
+G1 X109.567 Y142.945 A4.3121
+G1 X109.421 Y142.972 A4.3170
+G1 X109.272 Y142.998 A4.3220
+G1 X109.120 Y143.020 A4.3270
+G1 X108.965 Y143.041 A4.3322
+G1 X108.808 Y143.058 A4.3374
+G1 X108.649 Y143.073 A4.3427
+G1 X108.486 Y143.085 A4.3481
+G1 X108.321 Y143.093 A4.3535
+G1 X108.154 Y143.099 A4.3590
+G1 X107.983 Y143.101 A4.3647
+G1 X107.811 Y143.100 A4.3704
+G1 X107.636 Y143.095 A4.3761
+G1 X107.459 Y143.087 A4.3820
+G1 X107.279 Y143.075 A4.3879
+G1 X107.097 Y143.059 A4.3940
+G1 X106.913 Y143.040 A4.4001
+G1 X106.727 Y143.016 A4.4063
+G1 X106.538 Y142.988 A4.4125
+G1 X106.348 Y142.957 A4.4189
+G1 X106.156 Y142.921 A4.4254
+G1 X105.962 Y142.880 A4.4319
+G1 X105.767 Y142.836 A4.4385
+G1 X105.570 Y142.787 A4.4452
+G1 X105.371 Y142.734 A4.4520
+G1 X105.171 Y142.677 A4.4589
+G1 X104.969 Y142.616 A4.4658
+G1 X104.767 Y142.550 A4.4728
+G1 X104.563 Y142.479 A4.4799
+G1 X104.358 Y142.405 A4.4871
+G1 X104.153 Y142.326 A4.4944
+G1 X103.947 Y142.243 A4.5017
+G1 X103.740 Y142.156 A4.5091
+G1 X103.532 Y142.065 A4.5166
+G1 X103.324 Y141.971 A4.5242
+G1 X103.116 Y141.872 A4.5318
+G1 X102.908 Y141.769 A4.5394
+G1 X102.699 Y141.663 A4.5472
+G1 X102.491 Y141.553 A4.5549
+G1 X102.282 Y141.440 A4.5627
+G1 X102.074 Y141.324 A4.5706
+G1 X101.867 Y141.204 A4.5785
+G1 X101.659 Y141.082 A4.5865
+G1 X101.453 Y140.957 A4.5944
+G1 X101.247 Y140.829 A4.6024
+G1 X101.041 Y140.699 A4.6105
+G1 X100.837 Y140.567 A4.6185
+G1 X100.633 Y140.432 A4.6266
+G1 X100.430 Y140.296 A4.6346
+G1 X100.229 Y140.159 A4.6427
+G1 X100.028 Y140.020 A4.6507
+G1 X99.829 Y139.880 A4.6587
+G1 X99.631 Y139.739 A4.6668
+G1 X99.434 Y139.597 A4.6748
+G1 X99.239 Y139.454 A4.6827
+G1 X99.045 Y139.312 A4.6907
+G1 X98.853 Y139.169 A4.6986
+G1 X98.662 Y139.027 A4.7065
+G1 X98.473 Y138.884 A4.7143
+G1 X98.285 Y138.743 A4.7220
+G1 X98.098 Y138.602 A4.7297
+G1 X97.914 Y138.462 A4.7374
+G1 X97.731 Y138.324 A4.7450
+G1 X97.549 Y138.187 A4.7525
+G1 X97.369 Y138.051 A4.7599
+G1 X97.191 Y137.917 A4.7673
+G1 X97.015 Y137.785 A4.7745
+G1 X96.840 Y137.655 A4.7817
+G1 X96.666 Y137.528 A4.7888
+G1 X96.495 Y137.402 A4.7958
+G1 X96.325 Y137.280 A4.8028
+G1 X96.156 Y137.159 A4.8096
+G1 X95.989 Y137.042 A4.8163
+G1 X95.823 Y136.928 A4.8230
+G1 X95.659 Y136.816 A4.8295
+G1 X95.497 Y136.708 A4.8360
+G1 X95.336 Y136.603 A4.8423
+G1 X95.176 Y136.501 A4.8485
+G1 X95.018 Y136.402 A4.8547
+G1 X94.861 Y136.307 A4.8608
+G1 X94.706 Y136.215 A4.8667
+G1 X94.552 Y136.126 A4.8726
+G1 X94.399 Y136.041 A4.8784
+G1 X94.248 Y135.959 A4.8840
+G1 X94.097 Y135.881 A4.8896
+G1 X93.949 Y135.806 A4.8951
+G1 X93.801 Y135.735 A4.9005
+G1 X93.654 Y135.667 A4.9059
+G1 X93.509 Y135.602 A4.9111
+G1 X93.365 Y135.541 A4.9163
+G1 X93.222 Y135.482 A4.9214
+G1 X93.081 Y135.428 A4.9264
+G1 X92.940 Y135.376 A4.9313
+G1 X92.801 Y135.327 A4.9362
+G1 X92.663 Y135.282 A4.9410
+G1 X92.526 Y135.239 A4.9457
+G1 X92.390 Y135.200 A4.9504
+G1 X92.255 Y135.163 A4.9550
+G1 X92.122 Y135.129 A4.9595
+G1 X91.990 Y135.097 A4.9640
+G1 X91.858 Y135.069 A4.9685
+G1 X91.728 Y135.042 A4.9728
+G1 X91.600 Y135.018 A4.9772
+G1 X91.472 Y134.997 A4.9814
+G1 X91.346 Y134.978 A4.9856
+G1 X91.221 Y134.960 A4.9898
+G1 X91.097 Y134.945 A4.9939
+G1 X90.974 Y134.932 A4.9980
+G1 X90.853 Y134.920 A5.0020
+G1 X90.733 Y134.911 A5.0060
+G1 X90.614 Y134.903 A5.0099
+G1 X90.496 Y134.897 A5.0138
+G1 X90.380 Y134.892 A5.0177
+G1 X90.265 Y134.888 A5.0214
+G1 X90.152 Y134.886 A5.0252
+G1 X90.039 Y134.885 A5.0289
+G1 X89.929 Y134.886 A5.0325
+G1 X89.819 Y134.887 A5.0362
+G1 X89.711 Y134.890 A5.0397
+G1 X89.605 Y134.893 A5.0432
+G1 X89.500 Y134.898 A5.0467
+G1 X89.396 Y134.903 A5.0501
+G1 X89.294 Y134.909 A5.0535
+G1 X89.193 Y134.915 A5.0568
+G1 X89.094 Y134.923 A5.0601
+G1 X88.996 Y134.930 A5.0634
+G1 X88.899 Y134.939 A5.0666
+G1 X88.804 Y134.948 A5.0697
+G1 X88.711 Y134.957 A5.0728
+G1 X88.619 Y134.967 A5.0759
+G1 X88.528 Y134.977 A5.0789
+G1 X88.439 Y134.987 A5.0818
+G1 X88.352 Y134.998 A5.0848
+G1 X88.265 Y135.009 A5.0876
+G1 X88.181 Y135.020 A5.0904
+G1 X88.097 Y135.031 A5.0932
+G1 X88.015 Y135.043 A5.0960
+G1 X87.934 Y135.054 A5.0986
+G1 X87.855 Y135.066 A5.1013
+G1 X87.777 Y135.077 A5.1039
+G1 X87.700 Y135.089 A5.1065
+G1 X87.625 Y135.101 A5.1090
+G1 X87.551 Y135.113 A5.1115
+G1 X87.478 Y135.125 A5.1139
+G1 X87.406 Y135.136 A5.1163
+G1 X87.336 Y135.148 A5.1186
+G1 X87.266 Y135.160 A5.1210
+G1 X87.198 Y135.172 A5.1233
+G1 X87.131 Y135.183 A5.1255
+G1 X87.065 Y135.195 A5.1277
+G1 X86.999 Y135.207 A5.1299
+G1 X86.935 Y135.218 A5.1321
+G1 X86.872 Y135.230 A5.1342
+G1 X86.809 Y135.241 A5.1363
+G1 X86.748 Y135.253 A5.1384
+G1 X86.687 Y135.264 A5.1404
+G1 X86.626 Y135.275 A5.1424
+G1 X86.567 Y135.286 A5.1444
+G1 X86.508 Y135.298 A5.1464
+G1 X86.450 Y135.309 A5.1484
+G1 X86.392 Y135.320 A5.1503
+G1 X86.334 Y135.331 A5.1522
+G1 X86.277 Y135.342 A5.1542
+G1 X86.221 Y135.353 A5.1561
+G1 X86.164 Y135.364 A5.1580
+G1 X86.108 Y135.375 A5.1598
+G1 X86.052 Y135.386 A5.1617
+G1 X85.997 Y135.397 A5.1636
+G1 X85.941 Y135.408 A5.1655
+G1 X85.885 Y135.419 A5.1673
+G1 X85.829 Y135.430 A5.1692
+G1 X85.773 Y135.441 A5.1711
+G1 X85.717 Y135.453 A5.1730
+G1 X85.661 Y135.464 A5.1749
+G1 X85.604 Y135.475 A5.1768
+G1 X85.547 Y135.487 A5.1787
+G1 X85.490 Y135.498 A5.1806
+G1 X85.432 Y135.510 A5.1826
+G1 X85.374 Y135.522 A5.1846
+G1 X85.315 Y135.534 A5.1865
+G1 X85.255 Y135.546 A5.1886
+G1 X85.195 Y135.558 A5.1906
+G1 X85.133 Y135.570 A5.1927
+G1 X85.071 Y135.583 A5.1947
+G1 X85.008 Y135.596 A5.1969
+G1 X84.944 Y135.608 A5.1990
+G1 X84.879 Y135.622 A5.2012
+G1 X84.813 Y135.635 A5.2034
+G1 X84.746 Y135.648 A5.2057
+G1 X84.677 Y135.662 A5.2080
+G1 X84.607 Y135.676 A5.2104
+G1 X84.536 Y135.690 A5.2128
+G1 X84.463 Y135.705 A5.2152
+G1 X84.389 Y135.719 A5.2177
+G1 X84.314 Y135.734 A5.2202
+G1 X84.236 Y135.749 A5.2228
+G1 X84.157 Y135.765 A5.2255
+G1 X84.077 Y135.780 A5.2282
+G1 X83.995 Y135.796 A5.2310
+G1 X83.911 Y135.813 A5.2338
+G1 X83.825 Y135.829 A5.2367
+G1 X83.737 Y135.846 A5.2396
+G1 X83.647 Y135.862 A5.2426
+G1 X83.555 Y135.879 A5.2457
+G1 X83.461 Y135.897 A5.2489
+G1 X83.365 Y135.914 A5.2521
+G1 X83.267 Y135.932 A5.2554
+G1 X83.167 Y135.950 A5.2587
+G1 X83.064 Y135.968 A5.2622
+G1 X82.960 Y135.986 A5.2657
+G1 X82.853 Y136.004 A5.2693
+G1 X82.743 Y136.023 A5.2729
+G1 X82.631 Y136.041 A5.2767
+G1 X82.517 Y136.059 A5.2805
+G1 X82.401 Y136.078 A5.2844
+G1 X82.281 Y136.096 A5.2884
+G1 X82.160 Y136.114 A5.2924
+G1 X82.036 Y136.133 A5.2966
+G1 X81.909 Y136.151 A5.3008
+G1 X81.780 Y136.168 A5.3051
+G1 X81.648 Y136.186 A5.3095
+G1 X81.514 Y136.203 A5.3139
+G1 X81.378 Y136.220 A5.3185
+G1 X81.238 Y136.236 A5.3231
+G1 X81.096 Y136.252 A5.3278
+G1 X80.952 Y136.267 A5.3326
+G1 X80.805 Y136.282 A5.3375
+G1 X80.656 Y136.296 A5.3424
+G1 X80.504 Y136.309 A5.3475
+G1 X80.349 Y136.321 A5.3526
+G1 X80.192 Y136.332 A5.3578
+G1 X80.033 Y136.342 A5.3630
+G1 X79.871 Y136.351 A5.3684
+G1 X79.707 Y136.358 A5.3738
+G1 X79.541 Y136.364 A5.3793
+G1 X79.373 Y136.369 A5.3848
+G1 X79.202 Y136.372 A5.3905
+G1 X79.029 Y136.373 A5.3962
+G1 X78.855 Y136.372 A5.4019
+G1 X78.678 Y136.370 A5.4078
+G1 X78.499 Y136.365 A5.4137
+G1 X78.319 Y136.358 A5.4196
+G1 X78.137 Y136.349 A5.4256
+G1 X77.953 Y136.337 A5.4317
+G1 X77.768 Y136.323 A5.4378
+G1 X77.581 Y136.306 A5.4440
+G1 X77.393 Y136.286 A5.4503
+G1 X77.204 Y136.263 A5.4565
+G1 X77.014 Y136.237 A5.4629
+G1 X76.823 Y136.207 A5.4692
+G1 X76.632 Y136.174 A5.4757
+G1 X76.440 Y136.138 A5.4821
+G1 X76.247 Y136.098 A5.4886
+G1 X76.054 Y136.054 A5.4952
+G1 X75.860 Y136.007 A5.5017
+G1 X75.667 Y135.955 A5.5083
+G1 X75.474 Y135.899 A5.5150
+G1 X75.281 Y135.839 A5.5216
+G1 X75.089 Y135.775 A5.5283
+G1 X74.897 Y135.706 A5.5350
+G1 X74.706 Y135.633 A5.5418
+G1 X74.516 Y135.555 A5.5486
+G1 X74.327 Y135.473 A5.5554
+G1 X74.140 Y135.385 A5.5622
+G1 X73.954 Y135.293 A5.5690
+G1 X73.769 Y135.196 A5.5759
+G1 X73.587 Y135.094 A5.5828
+G1 X73.406 Y134.987 A5.5897
+G1 X73.228 Y134.876 A5.5967
+G1 X73.052 Y134.759 A5.6037
+G1 X72.878 Y134.637 A5.6107
+G1 X72.707 Y134.510 A5.6177
+G1 X72.539 Y134.378 A5.6247
+G1 X72.373 Y134.242 A5.6318
+G1 X72.211 Y134.100 A5.6389
+G1 X72.052 Y133.953 A5.6461
+G1 X71.896 Y133.802 A5.6532
+G1 X71.744 Y133.646 A5.6604
+G1 X71.595 Y133.485 A5.6677
+G1 X71.449 Y133.320 A5.6749
+G1 X71.308 Y133.150 A5.6822
+G1 X71.170 Y132.976 A5.6896
+G1 X71.037 Y132.797 A5.6969
+G1 X70.907 Y132.615 A5.7043
+G1 X70.781 Y132.428 A5.7117
+G1 X70.659 Y132.238 A5.7192
+G1 X70.542 Y132.044 A5.7267
+G1 X70.428 Y131.846 A5.7342
+G1 X70.319 Y131.645 A5.7417
+G1 X70.214 Y131.441 A5.7493
+G1 X70.113 Y131.233 A5.7569
+G1 X70.016 Y131.023 A5.7646
+G1 X69.924 Y130.811 A5.7722
+G1 X69.835 Y130.596 A5.7799
+G1 X69.751 Y130.378 A5.7876
+G1 X69.670 Y130.159 A5.7953
+G1 X69.594 Y129.938 A5.8030
+G1 X69.522 Y129.715 A5.8108
+G1 X69.453 Y129.490 A5.8185
+G1 X69.388 Y129.265 A5.8262
+G1 X69.327 Y129.038 A5.8340
+G1 X69.269 Y128.811 A5.8417
+G1 X69.215 Y128.583 A5.8495
+G1 X69.165 Y128.355 A5.8572
+G1 X69.117 Y128.126 A5.8649
+G1 X69.073 Y127.898 A5.8726
+G1 X69.032 Y127.669 A5.8802
+G1 X68.994 Y127.441 A5.8878
+G1 X68.959 Y127.214 A5.8954
+G1 X68.926 Y126.987 A5.9030
+G1 X68.896 Y126.762 A5.9105
+G1 X68.868 Y126.537 A5.9180
+G1 X68.843 Y126.314 A5.9254
+G1 X68.819 Y126.092 A5.9328
+G1 X68.798 Y125.871 A5.9401
+G1 X68.779 Y125.653 A5.9473
+G1 X68.761 Y125.436 A5.9545
+G1 X68.745 Y125.221 A5.9616
+G1 X68.731 Y125.008 A5.9686
+G1 X68.718 Y124.798 A5.9756
+G1 X68.706 Y124.589 A5.9825
+G1 X68.696 Y124.384 A5.9893
+G1 X68.686 Y124.180 A5.9960
+G1 X68.678 Y123.980 A6.0026
+G1 X68.670 Y123.782 A6.0092
+G1 X68.663 Y123.586 A6.0156
+G1 X68.657 Y123.394 A6.0220
+G1 X68.651 Y123.204 A6.0282
+G1 X68.646 Y123.018 A6.0344
+G1 X68.641 Y122.834 A6.0405
+G1 X68.636 Y122.653 A6.0464
+G1 X68.631 Y122.476 A6.0523
+G1 X68.627 Y122.301 A6.0580
+G1 X68.623 Y122.130 A6.0637
+G1 X68.618 Y121.961 A6.0693
+G1 X68.614 Y121.796 A6.0747
+G1 X68.610 Y121.634 A6.0801
+G1 X68.605 Y121.475 A6.0853
+G1 X68.600 Y121.319 A6.0905
+G1 X68.595 Y121.167 A6.0955
+G1 X68.590 Y121.017 A6.1004
+G1 X68.585 Y120.871 A6.1053
+G1 X68.579 Y120.727 A6.1100
+G1 X68.573 Y120.587 A6.1146
+G1 X68.566 Y120.450 A6.1192
+G1 X68.559 Y120.315 A6.1236
+G1 X68.552 Y120.184 A6.1280
+G1 X68.544 Y120.056 A6.1322
+G1 X68.536 Y119.930 A6.1363
+G1 X68.528 Y119.808 A6.1404
+G1 X68.519 Y119.688 A6.1444
+G1 X68.510 Y119.571 A6.1482
+G1 X68.501 Y119.457 A6.1520
+G1 X68.491 Y119.345 A6.1557
+G1 X68.481 Y119.237 A6.1593
+G1 X68.470 Y119.131 A6.1628
+G1 X68.459 Y119.027 A6.1663
+G1 X68.448 Y118.926 A6.1696
+G1 X68.437 Y118.827 A6.1729
+G1 X68.425 Y118.731 A6.1761
+G1 X68.413 Y118.637 A6.1792
+G1 X68.400 Y118.546 A6.1823
+G1 X68.388 Y118.457 A6.1852
+G1 X68.375 Y118.370 A6.1881
+G1 X68.362 Y118.285 A6.1910
+G1 X68.348 Y118.202 A6.1937
+G1 X68.335 Y118.121 A6.1964
+G1 X68.321 Y118.043 A6.1991
+G1 X68.307 Y117.966 A6.2016
+G1 X68.293 Y117.891 A6.2042
+G1 X68.279 Y117.818 A6.2066
+G1 X68.265 Y117.747 A6.2090
+G1 X68.251 Y117.678 A6.2113
+G1 X68.236 Y117.610 A6.2136
+G1 X68.222 Y117.544 A6.2159
+G1 X68.207 Y117.479 A6.2180
+G1 X68.192 Y117.416 A6.2202
+G1 X68.178 Y117.354 A6.2223
+G1 X68.163 Y117.294 A6.2243
+G1 X68.148 Y117.235 A6.2263
+G1 X68.133 Y117.178 A6.2283
+G1 X68.118 Y117.122 A6.2302
+G1 X68.103 Y117.067 A6.2321
+G1 X68.088 Y117.013 A6.2339
+G1 X68.073 Y116.960 A6.2357
+G1 X68.058 Y116.908 A6.2375
+G1 X68.043 Y116.857 A6.2393
+G1 X68.028 Y116.807 A6.2410
+G1 X68.013 Y116.758 A6.2427
+G1 X67.997 Y116.710 A6.2444
+G1 X67.982 Y116.663 A6.2460
+G1 X67.967 Y116.616 A6.2476
+G1 X67.951 Y116.570 A6.2492
+G1 X67.936 Y116.524 A6.2508
+G1 X67.920 Y116.480 A6.2524
+G1 X67.905 Y116.435 A6.2539
+G1 X67.889 Y116.391 A6.2555
+G1 X67.873 Y116.348 A6.2570
+G1 X67.857 Y116.305 A6.2585
+G1 X67.841 Y116.262 A6.2600
+G1 X67.825 Y116.220 A6.2615
+G1 X67.808 Y116.178 A6.2630
+G1 X67.792 Y116.136 A6.2645
+G1 X67.775 Y116.094 A6.2660
+G1 X67.758 Y116.052 A6.2675
+G1 X67.741 Y116.010 A6.2690
+G1 X67.723 Y115.968 A6.2705
+G1 X67.705 Y115.926 A6.2720
+G1 X67.687 Y115.884 A6.2735
+G1 X67.668 Y115.842 A6.2750
+G1 X67.649 Y115.800 A6.2765
+G1 X67.630 Y115.758 A6.2781
+G1 X67.610 Y115.715 A6.2796
+G1 X67.590 Y115.672 A6.2812
+G1 X67.569 Y115.628 A6.2828
+G1 X67.548 Y115.585 A6.2844
+G1 X67.526 Y115.540 A6.2860
+G1 X67.504 Y115.496 A6.2877
+G1 X67.481 Y115.450 A6.2893
+G1 X67.458 Y115.405 A6.2910
+G1 X67.433 Y115.358 A6.2928
+G1 X67.408 Y115.311 A6.2945
+G1 X67.383 Y115.264 A6.2963
+G1 X67.356 Y115.216 A6.2981
+G1 X67.329 Y115.167 A6.3000
+G1 X67.301 Y115.117 A6.3018
+G1 X67.272 Y115.067 A6.3038
+G1 X67.242 Y115.015 A6.3057
+G1 X67.211 Y114.963 A6.3077
+G1 X67.179 Y114.910 A6.3098
+G1 X67.146 Y114.857 A6.3118
+G1 X67.112 Y114.802 A6.3140
+G1 X67.077 Y114.746 A6.3161
+G1 X67.040 Y114.690 A6.3184
+G1 X67.003 Y114.632 A6.3206
+G1 X66.963 Y114.574 A6.3229
+G1 X66.923 Y114.515 A6.3253
+G1 X66.881 Y114.454 A6.3277
+G1 X66.838 Y114.393 A6.3302
+G1 X66.793 Y114.330 A6.3328
+G1 X66.747 Y114.266 A6.3354
+G1 X66.699 Y114.202 A6.3380
+G1 X66.649 Y114.136 A6.3407
+G1 X66.598 Y114.069 A6.3435
+G1 X66.545 Y114.001 A6.3464
+G1 X66.490 Y113.931 A6.3493
+G1 X66.433 Y113.861 A6.3523
+G1 X66.374 Y113.789 A6.3553
+G1 X66.313 Y113.717 A6.3585
+G1 X66.250 Y113.643 A6.3617
+G1 X66.185 Y113.567 A6.3650
+G1 X66.118 Y113.491 A6.3683
+G1 X66.049 Y113.413 A6.3717
+G1 X65.977 Y113.334 A6.3753
+G1 X65.903 Y113.254 A6.3789
+G1 X65.827 Y113.173 A6.3826
+G1 X65.748 Y113.090 A6.3863
+G1 X65.667 Y113.006 A6.3902
+G1 X65.583 Y112.920 A6.3941
+G1 X65.496 Y112.834 A6.3982
+G1 X65.407 Y112.746 A6.4023
+G1 X65.316 Y112.656 A6.4065
+G1 X65.222 Y112.565 A6.4109
+G1 X65.125 Y112.473 A6.4153
+G1 X65.025 Y112.379 A6.4198
+G1 X64.922 Y112.284 A6.4244
+G1 X64.817 Y112.188 A6.4291
+G1 X64.709 Y112.089 A6.4339
+G1 X64.598 Y111.990 A6.4389
+G1 X64.484 Y111.889 A6.4439
+G1 X64.368 Y111.786 A6.4490
+G1 X64.248 Y111.681 A6.4542
+G1 X64.126 Y111.575 A6.4596
+G1 X64.001 Y111.468 A6.4650
+G1 X63.873 Y111.358 A6.4706
+G1 X63.743 Y111.247 A6.4762
+G1 X63.610 Y111.134 A6.4820
+G1 X63.474 Y111.019 A6.4879
+G1 X63.336 Y110.903 A6.4938
+G1 X63.195 Y110.784 A6.4999
+G1 X63.051 Y110.664 A6.5061
+G1 X62.906 Y110.542 A6.5124
+G1 X62.758 Y110.417 A6.5187
+G1 X62.607 Y110.291 A6.5252
+G1 X62.455 Y110.163 A6.5318
+G1 X62.301 Y110.032 A6.5385
+G1 X62.144 Y109.899 A6.5452
+G1 X61.987 Y109.765 A6.5521
+G1 X61.827 Y109.628 A6.5590
+G1 X61.666 Y109.488 A6.5660
+G1 X61.504 Y109.347 A6.5732
+G1 X61.340 Y109.203 A6.5803
+G1 X61.176 Y109.057 A6.5876
+G1 X61.011 Y108.908 A6.5949
+G1 X60.845 Y108.757 A6.6023
+G1 X60.679 Y108.604 A6.6098
+G1 X60.512 Y108.448 A6.6173
+G1 X60.346 Y108.290 A6.6249
+G1 X60.179 Y108.129 A6.6325
+G1 X60.013 Y107.966 A6.6402
+G1 X59.848 Y107.800 A6.6479
+G1 X59.684 Y107.632 A6.6557
+G1 X59.520 Y107.462 A6.6635
+G1 X59.358 Y107.289 A6.6713
+G1 X59.197 Y107.114 A6.6791
+G1 X59.038 Y106.937 A6.6870
+G1 X58.881 Y106.757 A6.6949
+G1 X58.726 Y106.574 A6.7028
+G1 X58.574 Y106.390 A6.7107
+G1 X58.424 Y106.203 A6.7186
+G1 X58.277 Y106.014 A6.7265
+G1 X58.134 Y105.824 A6.7344
+G1 X57.993 Y105.631 A6.7422
+G1 X57.856 Y105.436 A6.7501
+G1 X57.723 Y105.239 A6.7579
+G1 X57.593 Y105.040 A6.7658
+G1 X57.468 Y104.840 A6.7736
+G1 X57.347 Y104.638 A6.7813
+G1 X57.230 Y104.434 A6.7891
+G1 X57.118 Y104.229 A6.7968
+G1 X57.011 Y104.023 A6.8045
+G1 X56.909 Y103.815 A6.8121
+G1 X56.812 Y103.607 A6.8197
+G1 X56.719 Y103.397 A6.8272
+G1 X56.633 Y103.186 A6.8348
+G1 X56.551 Y102.975 A6.8422
+G1 X56.475 Y102.763 A6.8497
+G1 X56.405 Y102.551 A6.8570
+G1 X56.340 Y102.338 A6.8644
+G1 X56.281 Y102.125 A6.8717
+G1 X56.227 Y101.912 A6.8789
+G1 X56.179 Y101.699 A6.8861
+G1 X56.137 Y101.486 A6.8933
+G1 X56.101 Y101.273 A6.9004
+G1 X56.070 Y101.061 A6.9075
+G1 X56.045 Y100.849 A6.9145
+G1 X56.025 Y100.638 A6.9215
+G1 X56.011 Y100.428 A6.9285
+G1 X56.003 Y100.219 A6.9354
+G1 X56.000 Y100.011 A6.9423
+G1 X56.002 Y99.804 A6.9491
+G1 X56.010 Y99.598 A6.9559
+G1 X56.023 Y99.394 A6.9626
+G1 X56.041 Y99.191 A6.9694
+G1 X56.063 Y98.990 A6.9761
+G1 X56.091 Y98.790 A6.9827
+G1 X56.123 Y98.592 A6.9893
+G1 X56.160 Y98.397 A6.9959
+G1 X56.201 Y98.203 A7.0024
+G1 X56.246 Y98.011 A7.0089
+G1 X56.295 Y97.821 A7.0154
+G1 X56.348 Y97.634 A7.0218
+G1 X56.405 Y97.449 A7.0282
+G1 X56.465 Y97.266 A7.0345
+G1 X56.529 Y97.086 A7.0409
+G1 X56.595 Y96.908 A7.0471
+G1 X56.665 Y96.733 A7.0533
+G1 X56.738 Y96.560 A7.0595
+G1 X56.813 Y96.390 A7.0657
+G1 X56.891 Y96.223 A7.0718
+G1 X56.971 Y96.058 A7.0778
+G1 X57.053 Y95.896 A7.0838
+G1 X57.137 Y95.736 A7.0898
+G1 X57.223 Y95.580 A7.0956
+G1 X57.310 Y95.426 A7.1015
+G1 X57.399 Y95.274 A7.1073
+G1 X57.489 Y95.126 A7.1130
+G1 X57.580 Y94.980 A7.1187
+G1 X57.672 Y94.838 A7.1243
+G1 X57.765 Y94.697 A7.1298
+G1 X57.859 Y94.560 A7.1353
+G1 X57.953 Y94.425 A7.1407
+G1 X58.048 Y94.293 A7.1461
+G1 X58.143 Y94.164 A7.1514
+G1 X58.238 Y94.038 A7.1566
+G1 X58.333 Y93.914 A7.1618
+G1 X58.428 Y93.792 A7.1668
+G1 X58.522 Y93.674 A7.1719
+G1 X58.617 Y93.558 A7.1768
+G1 X58.711 Y93.444 A7.1817
+G1 X58.804 Y93.333 A7.1865
+G1 X58.897 Y93.225 A7.1912
+G1 X58.990 Y93.119 A7.1958
+G1 X59.081 Y93.015 A7.2004
+G1 X59.172 Y92.914 A7.2049
+G1 X59.262 Y92.815 A7.2093
+G1 X59.351 Y92.718 A7.2136
+G1 X59.439 Y92.624 A7.2179
+G1 X59.526 Y92.532 A7.2220
+G1 X59.612 Y92.442 A7.2262
+G1 X59.697 Y92.354 A7.2302
+G1 X59.781 Y92.268 A7.2341
+G1 X59.863 Y92.184 A7.2380
+G1 X59.944 Y92.103 A7.2418
+G1 X60.024 Y92.023 A7.2455
+G1 X60.103 Y91.945 A7.2492
+G1 X60.181 Y91.869 A7.2528
+G1 X60.257 Y91.795 A7.2563
+G1 X60.332 Y91.723 A7.2597
+G1 X60.406 Y91.653 A7.2631
+G1 X60.479 Y91.584 A7.2664
+G1 X60.550 Y91.516 A7.2696
+G1 X60.620 Y91.451 A7.2728
+G1 X60.689 Y91.387 A7.2759
+G1 X60.756 Y91.324 A7.2789
+G1 X60.823 Y91.263 A7.2819
+G1 X60.888 Y91.204 A7.2848
+G1 X60.952 Y91.145 A7.2877
+G1 X61.015 Y91.089 A7.2905
+G1 X61.076 Y91.033 A7.2932
+G1 X61.137 Y90.979 A7.2959
+G1 X61.196 Y90.925 A7.2985
+G1 X61.255 Y90.873 A7.3011
+G1 X61.312 Y90.822 A7.3037
+G1 X61.368 Y90.772 A7.3061
+G1 X61.424 Y90.724 A7.3086
+G1 X61.478 Y90.676 A7.3110
+G1 X61.532 Y90.629 A7.3133
+G1 X61.585 Y90.582 A7.3156
+G1 X61.637 Y90.537 A7.3179
+G1 X61.688 Y90.493 A7.3202
+G1 X61.739 Y90.449 A7.3224
+G1 X61.789 Y90.406 A7.3245
+G1 X61.838 Y90.363 A7.3267
+G1 X61.887 Y90.321 A7.3288
+G1 X61.935 Y90.280 A7.3309
+G1 X61.982 Y90.239 A7.3330
+G1 X62.029 Y90.199 A7.3350
+G1 X62.076 Y90.159 A7.3371
+G1 X62.123 Y90.119 A7.3391
+G1 X62.169 Y90.080 A7.3411
+G1 X62.215 Y90.041 A7.3430
+G1 X62.260 Y90.002 A7.3450
+G1 X62.306 Y89.964 A7.3470
+G1 X62.351 Y89.925 A7.3489
+G1 X62.396 Y89.887 A7.3509
+G1 X62.441 Y89.849 A7.3529
+G1 X62.487 Y89.811 A7.3548
+G1 X62.532 Y89.772 A7.3568
+G1 X62.577 Y89.734 A7.3587
+G1 X62.623 Y89.696 A7.3607
+G1 X62.669 Y89.657 A7.3627
+G1 X62.715 Y89.619 A7.3647
+G1 X62.761 Y89.580 A7.3667
+G1 X62.808 Y89.540 A7.3687
+G1 X62.855 Y89.501 A7.3707
+G1 X62.902 Y89.461 A7.3727
+G1 X62.950 Y89.421 A7.3748
+G1 X62.999 Y89.380 A7.3769
+G1 X63.048 Y89.339 A7.3790
+G1 X63.097 Y89.298 A7.3811
+G1 X63.147 Y89.255 A7.3833
+G1 X63.198 Y89.213 A7.3855
+G1 X63.250 Y89.169 A7.3877
+G1 X63.302 Y89.126 A7.3900
+G1 X63.355 Y89.081 A7.3922
+G1 X63.409 Y89.036 A7.3946
+G1 X63.463 Y88.990 A7.3969
+G1 X63.519 Y88.943 A7.3993
+G1 X63.575 Y88.895 A7.4017
+G1 X63.632 Y88.847 A7.4042
+G1 X63.690 Y88.798 A7.4067
+G1 X63.749 Y88.748 A7.4093
+G1 X63.809 Y88.697 A7.4119
+G1 X63.870 Y88.645 A7.4145
+G1 X63.932 Y88.592 A7.4172
+G1 X63.995 Y88.538 A7.4199
+G1 X64.059 Y88.483 A7.4227
+G1 X64.123 Y88.427 A7.4255
+G1 X64.189 Y88.370 A7.4284
+G1 X64.256 Y88.312 A7.4313
+G1 X64.324 Y88.253 A7.4343
+G1 X64.393 Y88.192 A7.4373
+G1 X64.462 Y88.131 A7.4404
+G1 X64.533 Y88.068 A7.4435
+G1 X64.605 Y88.004 A7.4467
+G1 X64.677 Y87.939 A7.4499
+G1 X64.751 Y87.872 A7.4532
+G1 X64.825 Y87.805 A7.4565
+G1 X64.901 Y87.736 A7.4599
+G1 X64.977 Y87.665 A7.4633
+G1 X65.054 Y87.594 A7.4668
+G1 X65.131 Y87.521 A7.4703
+G1 X65.209 Y87.446 A7.4738
+G1 X65.288 Y87.370 A7.4774
+G1 X65.368 Y87.293 A7.4811
+G1 X65.448 Y87.214 A7.4848
+G1 X65.529 Y87.134 A7.4886
+G1 X65.610 Y87.052 A7.4924
+G1 X65.691 Y86.969 A7.4962
+G1 X65.773 Y86.884 A7.5001
+G1 X65.855 Y86.798 A7.5040
+G1 X65.937 Y86.710 A7.5080
+G1 X66.019 Y86.620 A7.5120
+G1 X66.101 Y86.529 A7.5161
+G1 X66.183 Y86.435 A7.5202
+G1 X66.265 Y86.340 A7.5243
+G1 X66.347 Y86.244 A7.5285
+G1 X66.428 Y86.145 A7.5327
+G1 X66.509 Y86.045 A7.5370
+G1 X66.589 Y85.942 A7.5413
+G1 X66.669 Y85.838 A7.5456
+G1 X66.748 Y85.732 A7.5500
+G1 X66.827 Y85.623 A7.5544
+G1 X66.904 Y85.513 A7.5588
+G1 X66.981 Y85.400 A7.5633
+G1 X67.056 Y85.285 A7.5679
+G1 X67.130 Y85.169 A7.5724
+G1 X67.204 Y85.049 A7.5770
+G1 X67.275 Y84.928 A7.5817
+G1 X67.346 Y84.804 A7.5864
+G1 X67.414 Y84.678 A7.5911
+G1 X67.481 Y84.549 A7.5959
+G1 X67.547 Y84.418 A7.6008
+G1 X67.611 Y84.284 A7.6057
+G1 X67.673 Y84.147 A7.6106
+G1 X67.733 Y84.008 A7.6156
+G1 X67.791 Y83.866 A7.6207
+G1 X67.847 Y83.722 A7.6258
+G1 X67.901 Y83.575 A7.6310
+G1 X67.953 Y83.424 A7.6362
+G1 X68.003 Y83.271 A7.6415
+G1 X68.051 Y83.115 A7.6469
+G1 X68.097 Y82.957 A7.6524
+G1 X68.140 Y82.795 A7.6579
+G1 X68.181 Y82.630 A7.6635
+G1 X68.220 Y82.462 A7.6692
+G1 X68.257 Y82.291 A7.6750
+G1 X68.292 Y82.117 A7.6808
+G1 X68.324 Y81.940 A7.6867
+G1 X68.354 Y81.760 A7.6928
+G1 X68.383 Y81.577 A7.6989
+G1 X68.409 Y81.391 A7.7051
+G1 X68.433 Y81.202 A7.7114
+G1 X68.455 Y81.010 A7.7178
+G1 X68.476 Y80.814 A7.7242
+G1 X68.494 Y80.616 A7.7308
+G1 X68.511 Y80.415 A7.7375
+G1 X68.527 Y80.211 A7.7442
+G1 X68.541 Y80.004 A7.7511
+G1 X68.553 Y79.795 A7.7580
+G1 X68.564 Y79.583 A7.7650
+G1 X68.575 Y79.368 A7.7721
+G1 X68.584 Y79.150 A7.7793
+G1 X68.592 Y78.931 A7.7865
+G1 X68.599 Y78.709 A7.7939
+G1 X68.606 Y78.484 A7.8013
+G1 X68.613 Y78.258 A7.8087
+G1 X68.619 Y78.029 A7.8163
+G1 X68.624 Y77.799 A7.8239
+G1 X68.630 Y77.567 A7.8315
+G1 X68.636 Y77.333 A7.8393
+G1 X68.642 Y77.098 A7.8470
+G1 X68.649 Y76.862 A7.8548
+G1 X68.656 Y76.625 A7.8627
+G1 X68.664 Y76.386 A7.8705
+G1 X68.673 Y76.147 A7.8784
+G1 X68.683 Y75.907 A7.8864
+G1 X68.693 Y75.667 A7.8943
+G1 X68.706 Y75.426 A7.9022
+G1 X68.719 Y75.185 A7.9102
+G1 X68.734 Y74.945 A7.9182
+G1 X68.751 Y74.704 A7.9261
+G1 X68.769 Y74.465 A7.9340
+G1 X68.789 Y74.225 A7.9420
+G1 X68.812 Y73.987 A7.9499
+G1 X68.836 Y73.749 A7.9578
+G1 X68.862 Y73.513 A7.9656
+G1 X68.891 Y73.278 A7.9734
+G1 X68.922 Y73.044 A7.9812
+G1 X68.955 Y72.813 A7.9889
+G1 X68.990 Y72.583 A7.9966
+G1 X69.028 Y72.355 A8.0042
+G1 X69.068 Y72.129 A8.0118
+G1 X69.111 Y71.905 A8.0193
+G1 X69.156 Y71.684 A8.0267
+G1 X69.204 Y71.466 A8.0341
+G1 X69.255 Y71.250 A8.0414
+G1 X69.307 Y71.037 A8.0487
+G1 X69.363 Y70.828 A8.0558
+G1 X69.420 Y70.621 A8.0629
+G1 X69.481 Y70.417 A8.0699
+G1 X69.543 Y70.217 A8.0768
+G1 X69.608 Y70.020 A8.0837
+G1 X69.675 Y69.827 A8.0904
+G1 X69.745 Y69.637 A8.0971
+G1 X69.817 Y69.451 A8.1037
+G1 X69.890 Y69.269 A8.1102
+G1 X69.966 Y69.090 A8.1166
+G1 X70.044 Y68.915 A8.1229
+G1 X70.124 Y68.744 A8.1291
+G1 X70.205 Y68.577 A8.1353
+G1 X70.288 Y68.414 A8.1413
+G1 X70.373 Y68.254 A8.1473
+G1 X70.459 Y68.099 A8.1531
+G1 X70.547 Y67.947 A8.1589
+G1 X70.636 Y67.800 A8.1646
+G1 X70.726 Y67.656 A8.1702
+G1 X70.818 Y67.516 A8.1757
+G1 X70.910 Y67.380 A8.1811
+G1 X71.004 Y67.248 A8.1865
+G1 X71.098 Y67.119 A8.1917
+G1 X71.193 Y66.995 A8.1969
+G1 X71.289 Y66.874 A8.2020
+G1 X71.385 Y66.757 A8.2070
+G1 X71.481 Y66.643 A8.2119
+G1 X71.578 Y66.533 A8.2168
+G1 X71.676 Y66.426 A8.2215
+G1 X71.773 Y66.323 A8.2262
+G1 X71.870 Y66.224 A8.2308
+G1 X71.968 Y66.127 A8.2353
+G1 X72.065 Y66.034 A8.2398
+G1 X72.162 Y65.944 A8.2441
+G1 X72.259 Y65.858 A8.2484
+G1 X72.355 Y65.774 A8.2526
+G1 X72.451 Y65.693 A8.2568
+G1 X72.547 Y65.615 A8.2608
+G1 X72.642 Y65.540 A8.2648
+G1 X72.736 Y65.468 A8.2688
+G1 X72.830 Y65.398 A8.2726
+G1 X72.923 Y65.331 A8.2764
+G1 X73.015 Y65.266 A8.2801
+G1 X73.106 Y65.204 A8.2838
+G1 X73.197 Y65.144 A8.2873
+G1 X73.286 Y65.087 A8.2909
+G1 X73.375 Y65.032 A8.2943
+G1 X73.463 Y64.979 A8.2977
+G1 X73.549 Y64.927 A8.3010
+G1 X73.635 Y64.878 A8.3043
+G1 X73.720 Y64.831 A8.3075
+G1 X73.803 Y64.786 A8.3106
+G1 X73.885 Y64.742 A8.3137
+G1 X73.967 Y64.700 A8.3167
+G1 X74.047 Y64.660 A8.3196
+G1 X74.126 Y64.621 A8.3225
+G1 X74.204 Y64.584 A8.3254
+G1 X74.281 Y64.549 A8.3282
+G1 X74.356 Y64.514 A8.3309
+G1 X74.431 Y64.481 A8.3336
+G1 X74.505 Y64.450 A8.3363
+G1 X74.577 Y64.419 A8.3389
+G1 X74.648 Y64.390 A8.3414
+G1 X74.719 Y64.362 A8.3439
+G1 X74.788 Y64.335 A8.3464
+G1 X74.856 Y64.309 A8.3488
+G1 X74.924 Y64.284 A8.3511
+G1 X74.990 Y64.260 A8.3535
+G1 X75.056 Y64.237 A8.3558
+G1 X75.120 Y64.214 A8.3580
+G1 X75.184 Y64.193 A8.3602
+G1 X75.247 Y64.172 A8.3624
+G1 X75.309 Y64.152 A8.3646
+G1 X75.371 Y64.132 A8.3667
+G1 X75.431 Y64.114 A8.3688
+G1 X75.491 Y64.095 A8.3709
+G1 X75.551 Y64.078 A8.3729
+G1 X75.610 Y64.061 A8.3750
+G1 X75.669 Y64.045 A8.3770
+G1 X75.727 Y64.029 A8.3790
+G1 X75.784 Y64.013 A8.3809
+G1 X75.842 Y63.998 A8.3829
+G1 X75.899 Y63.984 A8.3848
+G1 X75.956 Y63.969 A8.3868
+G1 X76.012 Y63.956 A8.3887
+G1 X76.069 Y63.942 A8.3906
+G1 X76.125 Y63.929 A8.3925
+G1 X76.182 Y63.916 A8.3944
+G1 X76.238 Y63.904 A8.3963
+G1 X76.295 Y63.892 A8.3982
+G1 X76.352 Y63.880 A8.4002
+G1 X76.409 Y63.868 A8.4021
+G1 X76.466 Y63.857 A8.4040
+G1 X76.524 Y63.846 A8.4060
+G1 X76.582 Y63.835 A8.4079
+G1 X76.640 Y63.824 A8.4099
+G1 X76.700 Y63.814 A8.4119
+G1 X76.759 Y63.803 A8.4139
+G1 X76.820 Y63.793 A8.4159
+G1 X76.881 Y63.784 A8.4179
+G1 X76.943 Y63.774 A8.4200
+G1 X77.006 Y63.765 A8.4221
+G1 X77.070 Y63.756 A8.4242
+G1 X77.134 Y63.747 A8.4264
+G1 X77.200 Y63.738 A8.4286
+G1 X77.267 Y63.729 A8.4308
+G1 X77.335 Y63.721 A8.4330
+G1 X77.404 Y63.713 A8.4354
+G1 X77.475 Y63.705 A8.4377
+G1 X77.547 Y63.698 A8.4401
+G1 X77.620 Y63.691 A8.4425
+G1 X77.695 Y63.684 A8.4450
+G1 X77.772 Y63.677 A8.4475
+G1 X77.849 Y63.671 A8.4501
+G1 X77.929 Y63.665 A8.4527
+G1 X78.010 Y63.659 A8.4554
+G1 X78.093 Y63.654 A8.4582
+G1 X78.178 Y63.649 A8.4610
+G1 X78.265 Y63.644 A8.4638
+G1 X78.353 Y63.640 A8.4668
+G1 X78.444 Y63.637 A8.4697
+G1 X78.536 Y63.634 A8.4728
+G1 X78.631 Y63.631 A8.4759
+G1 X78.727 Y63.629 A8.4791
+G1 X78.826 Y63.628 A8.4824
+G1 X78.927 Y63.627 A8.4857
+G1 X79.030 Y63.627 A8.4891
+G1 X79.135 Y63.627 A8.4926
+G1 X79.242 Y63.629 A8.4961
+G1 X79.352 Y63.631 A8.4997
+G1 X79.464 Y63.633 A8.5034
+G1 X79.579 Y63.637 A8.5072
+G1 X79.695 Y63.641 A8.5111
+G1 X79.815 Y63.647 A8.5150
+G1 X79.936 Y63.653 A8.5190
+G1 X80.060 Y63.660 A8.5231
+G1 X80.187 Y63.668 A8.5273
+G1 X80.315 Y63.677 A8.5316
+G1 X80.447 Y63.687 A8.5359
+G1 X80.580 Y63.698 A8.5403
+G1 X80.716 Y63.710 A8.5448
+G1 X80.855 Y63.723 A8.5494
+G1 X80.996 Y63.737 A8.5541
+G1 X81.139 Y63.753 A8.5589
+G1 X81.285 Y63.769 A8.5637
+G1 X81.433 Y63.787 A8.5686
+G1 X81.583 Y63.806 A8.5736
+G1 X81.736 Y63.826 A8.5787
+G1 X81.891 Y63.847 A8.5839
+G1 X82.048 Y63.869 A8.5891
+G1 X82.207 Y63.893 A8.5944
+G1 X82.369 Y63.917 A8.5998
+G1 X82.532 Y63.943 A8.6053
+G1 X82.698 Y63.970 A8.6108
+G1 X82.866 Y63.998 A8.6164
+G1 X83.035 Y64.027 A8.6221
+G1 X83.207 Y64.057 A8.6278
+G1 X83.380 Y64.088 A8.6336
+G1 X83.555 Y64.121 A8.6395
+G1 X83.732 Y64.154 A8.6455
+G1 X83.910 Y64.187 A8.6514
+G1 X84.090 Y64.222 A8.6575
+G1 X84.271 Y64.257 A8.6636
+G1 X84.454 Y64.293 A8.6697
+G1 X84.638 Y64.330 A8.6759
+G1 X84.823 Y64.367 A8.6821
+G1 X85.009 Y64.405 A8.6884
+G1 X85.196 Y64.442 A8.6947
+G1 X85.384 Y64.480 A8.7010
+G1 X85.573 Y64.518 A8.7074
+G1 X85.763 Y64.556 A8.7138
+G1 X85.953 Y64.594 A8.7202
+G1 X86.144 Y64.632 A8.7266
+G1 X86.335 Y64.669 A8.7330
+G1 X86.527 Y64.706 A8.7395
+G1 X86.719 Y64.742 A8.7459
+G1 X86.911 Y64.777 A8.7524
+G1 X87.103 Y64.812 A8.7588
+G1 X87.296 Y64.845 A8.7653
+G1 X87.488 Y64.877 A8.7717
+G1 X87.680 Y64.908 A8.7781
+G1 X87.872 Y64.937 A8.7845
+G1 X88.063 Y64.964 A8.7909
+G1 X88.255 Y64.990 A8.7973
+G1 X88.446 Y65.014 A8.8036
+G1 X88.636 Y65.035 A8.8099
+G1 X88.826 Y65.054 A8.8162
+G1 X89.015 Y65.071 A8.8225
+G1 X89.204 Y65.085 A8.8288
+G1 X89.392 Y65.097 A8.8350
+G1 X89.579 Y65.106 A8.8412
+G1 X89.766 Y65.112 A8.8473
+G1 X89.951 Y65.114 A8.8534
+G1 X90.136 Y65.114 A8.8595
+G1 X90.320 Y65.110 A8.8656
+G1 X90.503 Y65.103 A8.8717
+G1 X90.686 Y65.092 A8.8777
+G1 X90.867 Y65.078 A8.8837
+G1 X91.047 Y65.060 A8.8897
+G1 X91.227 Y65.039 A8.8956
+G1 X91.406 Y65.014 A8.9016
+G1 X91.584 Y64.984 A8.9076
+G1 X91.761 Y64.951 A8.9135
+G1 X91.937 Y64.914 A8.9194
+G1 X92.112 Y64.874 A8.9254
+G1 X92.287 Y64.829 A8.9313
+G1 X92.460 Y64.780 A8.9373
+G1 X92.633 Y64.728 A8.9432
+G1 X92.805 Y64.671 A8.9492
+G1 X92.977 Y64.611 A8.9552
+G1 X93.147 Y64.547 A8.9612
+G1 X93.317 Y64.479 A8.9673
+G1 X93.487 Y64.408 A8.9733
+G1 X93.656 Y64.333 A8.9794
+G1 X93.824 Y64.254 A8.9855
+G1 X93.991 Y64.173 A8.9917
+G1 X94.159 Y64.087 A8.9979
+G1 X94.325 Y63.999 A9.0041
+G1 X94.491 Y63.908 A9.0104
+G1 X94.657 Y63.814 A9.0167
+G1 X94.822 Y63.717 A9.0230
+G1 X94.987 Y63.617 A9.0293
+G1 X95.152 Y63.515 A9.0357
+G1 X95.316 Y63.410 A9.0421
+G1 X95.479 Y63.304 A9.0486
+G1 X95.643 Y63.195 A9.0551
+G1 X95.805 Y63.085 A9.0616
+G1 X95.968 Y62.972 A9.0681
+G1 X96.130 Y62.859 A9.0746
+G1 X96.292 Y62.744 A9.0812
+G1 X96.453 Y62.628 A9.0877
+G1 X96.615 Y62.510 A9.0943
+G1 X96.775 Y62.393 A9.1009
+G1 X96.935 Y62.274 A9.1075
+G1 X97.095 Y62.155 A9.1140
+G1 X97.255 Y62.035 A9.1206
+G1 X97.414 Y61.916 A9.1272
+G1 X97.572 Y61.796 A9.1337
+G1 X97.730 Y61.677 A9.1402
+G1 X97.887 Y61.558 A9.1468
+G1 X98.044 Y61.439 A9.1532
+G1 X98.200 Y61.321 A9.1597
+G1 X98.355 Y61.204 A9.1661
+G1 X98.510 Y61.088 A9.1725
+G1 X98.663 Y60.972 A9.1788
+G1 X98.816 Y60.858 A9.1851
+G1 X98.968 Y60.745 A9.1914
+G1 X99.120 Y60.633 A9.1976
+G1 X99.270 Y60.523 A9.2038
+G1 X99.419 Y60.414 A9.2098
+G1 X99.567 Y60.307 A9.2159
+G1 X99.715 Y60.202 A9.2219
+G1 X99.861 Y60.098 A9.2278
+G1 X100.005 Y59.996 A9.2336
+G1 X100.149 Y59.896 A9.2394
+G1 X100.291 Y59.798 A9.2451
+G1 X100.432 Y59.702 A9.2507
+G1 X100.572 Y59.608 A9.2563
+G1 X100.710 Y59.516 A9.2617
+G1 X100.847 Y59.427 A9.2671
+G1 X100.982 Y59.339 A9.2725
+G1 X101.116 Y59.253 A9.2777
+G1 X101.248 Y59.170 A9.2829
+G1 X101.379 Y59.089 A9.2879
+G1 X101.507 Y59.010 A9.2929
+G1 X101.635 Y58.933 A9.2978
+G1 X101.760 Y58.858 A9.3027
+G1 X101.884 Y58.785 A9.3074
+G1 X102.007 Y58.715 A9.3121
+G1 X102.127 Y58.647 A9.3166
+G1 X102.246 Y58.580 A9.3211
+G1 X102.363 Y58.516 A9.3255
+G1 X102.478 Y58.454 A9.3298
+G1 X102.591 Y58.394 A9.3341
+G1 X102.703 Y58.335 A9.3382
+G1 X102.812 Y58.279 A9.3423
+G1 X102.920 Y58.225 A9.3463
+G1 X103.026 Y58.172 A9.3502
+G1 X103.130 Y58.121 A9.3540
+G1 X103.233 Y58.072 A9.3577
+G1 X103.333 Y58.025 A9.3614
+G1 X103.432 Y57.980 A9.3650
+G1 X103.529 Y57.936 A9.3685
+G1 X103.625 Y57.894 A9.3720
+G1 X103.718 Y57.853 A9.3753
+G1 X103.810 Y57.814 A9.3786
+G1 X103.900 Y57.776 A9.3818
+G1 X103.988 Y57.739 A9.3850
+G1 X104.075 Y57.705 A9.3881
+G1 X104.160 Y57.671 A9.3911
+G1 X104.244 Y57.638 A9.3941
+G1 X104.326 Y57.607 A9.3969
+G1 X104.406 Y57.577 A9.3998
+G1 X104.485 Y57.549 A9.4026
+G1 X104.562 Y57.521 A9.4053
+G1 X104.638 Y57.494 A9.4079
+G1 X104.713 Y57.469 A9.4105
+G1 X104.786 Y57.444 A9.4131
+G1 X104.858 Y57.420 A9.4156
+G1 X104.929 Y57.397 A9.4180
+G1 X104.998 Y57.375 A9.4204
+G1 X105.066 Y57.354 A9.4228
+G1 X105.134 Y57.334 A9.4251
+G1 X105.200 Y57.314 A9.4274
+G1 X105.265 Y57.295 A9.4296
+G1 X105.329 Y57.277 A9.4318
+G1 X105.392 Y57.260 A9.4340
+G1 X105.454 Y57.243 A9.4361
+G1 X105.516 Y57.226 A9.4382
+G1 X105.577 Y57.211 A9.4403
+G1 X105.637 Y57.196 A9.4423
+G1 X105.696 Y57.181 A9.4444
+G1 X105.755 Y57.167 A9.4464
+G1 X105.814 Y57.153 A9.4483
+G1 X105.872 Y57.140 A9.4503
+G1 X105.929 Y57.127 A9.4522
+G1 X105.986 Y57.114 A9.4542
+G1 X106.043 Y57.102 A9.4561
+G1 X106.100 Y57.091 A9.4580
+G1 X106.156 Y57.079 A9.4599
+G1 X106.213 Y57.068 A9.4618
+G1 X106.269 Y57.058 A9.4637
+G1 X106.325 Y57.048 A9.4656
+G1 X106.382 Y57.038 A9.4675
+G1 X106.438 Y57.028 A9.4694
+G1 X106.495 Y57.019 A9.4713
+G1 X106.552 Y57.010 A9.4732
+G1 X106.610 Y57.001 A9.4751
+G1 X106.667 Y56.992 A9.4770
+G1 X106.725 Y56.984 A9.4789
+G1 X106.784 Y56.976 A9.4809
+G1 X106.843 Y56.969 A9.4829
+G1 X106.903 Y56.961 A9.4849
+G1 X106.964 Y56.955 A9.4869
+G1 X107.025 Y56.948 A9.4889
+G1 X107.087 Y56.942 A9.4910
+G1 X107.150 Y56.936 A9.4930
+G1 X107.214 Y56.930 A9.4951
+G1 X107.278 Y56.925 A9.4973
+G1 X107.344 Y56.920 A9.4995
+G1 X107.411 Y56.916 A9.5017
+G1 X107.478 Y56.912 A9.5039
+G1 X107.547 Y56.908 A9.5062
+G1 X107.617 Y56.905 A9.5085
+G1 X107.689 Y56.903 A9.5109
+G1 X107.761 Y56.901 A9.5133
+G1 X107.835 Y56.900 A9.5157
+G1 X107.911 Y56.899 A9.5182
+G1 X107.987 Y56.899 A9.5207
+G1 X108.066 Y56.899 A9.5233
+G1 X108.145 Y56.901 A9.5259
+G1 X108.226 Y56.903 A9.5286
+G1 X108.309 Y56.906 A9.5313
+G1 X108.393 Y56.910 A9.5341
+G1 X108.479 Y56.915 A9.5370
+G1 X108.567 Y56.921 A9.5399
+G1 X108.656 Y56.928 A9.5428
+G1 X108.747 Y56.936 A9.5458
+G1 X108.839 Y56.945 A9.5489
+G1 X108.933 Y56.955 A9.5520
+G1 X109.029 Y56.967 A9.5552
+G1 X109.127 Y56.981 A9.5584
+G1 X109.226 Y56.995 A9.5618
+G1 X109.327 Y57.012 A9.5651
+G1 X109.430 Y57.029 A9.5686
+G1 X109.535 Y57.049 A9.5721
+G1 X109.641 Y57.071 A9.5757
+G1 X109.749 Y57.094 A9.5793
+G1 X109.859 Y57.119 A9.5830
+G1 X109.971 Y57.146 A9.5868
+G1 X110.084 Y57.176 A9.5907
+G1 X110.199 Y57.208 A9.5946
+G1 X110.315 Y57.242 A9.5986
+G1 X110.434 Y57.278 A9.6027
+G1 X110.553 Y57.317 A9.6069
+G1 X110.675 Y57.359 A9.6111
+G1 X110.798 Y57.403 A9.6154
+G1 X110.922 Y57.450 A9.6198
+G1 X111.048 Y57.500 A9.6243
+G1 X111.175 Y57.553 A9.6288
+G1 X111.304 Y57.609 A9.6335
+G1 X111.434 Y57.668 A9.6382
+G1 X111.565 Y57.731 A9.6430
+G1 X111.697 Y57.796 A9.6478
+G1 X111.831 Y57.866 A9.6528
+G1 X111.966 Y57.939 A9.6579
+G1 X112.101 Y58.015 A9.6630
+G1 X112.238 Y58.095 A9.6682
+G1 X112.375 Y58.179 A9.6735
+G1 X112.513 Y58.266 A9.6789
+G1 X112.652 Y58.358 A9.6844
+G1 X112.791 Y58.453 A9.6900
+G1 X112.932 Y58.552 A9.6957
+G1 X113.072 Y58.656 A9.7014
+G1 X113.213 Y58.763 A9.7073
+G1 X113.354 Y58.875 A9.7132
+G1 X113.496 Y58.990 A9.7192
+G1 X113.637 Y59.110 A9.7253
+G1 X113.779 Y59.234 A9.7316
+G1 X113.920 Y59.362 A9.7379
+G1 X114.062 Y59.495 A9.7442
+G1 X114.203 Y59.631 A9.7507
+G1 X114.344 Y59.772 A9.7573
+G1 X114.484 Y59.916 A9.7639
+G1 X114.624 Y60.065 A9.7707
+G1 X114.764 Y60.218 A9.7775
+G1 X114.903 Y60.374 A9.7844
+G1 X115.041 Y60.535 A9.7914
+G1 X115.179 Y60.699 A9.7985
+G1 X115.315 Y60.867 A9.8056
+G1 X115.451 Y61.038 A9.8128
+G1 X115.586 Y61.214 A9.8201
+G1 X115.720 Y61.392 A9.8275
+G1 X115.852 Y61.574 A9.8349
+G1 X115.984 Y61.759 A9.8424
+G1 X116.114 Y61.946 A9.8500
+G1 X116.244 Y62.137 A9.8576
+G1 X116.372 Y62.331 A9.8652
+G1 X116.499 Y62.526 A9.8729
+G1 X116.624 Y62.725 A9.8807
+G1 X116.748 Y62.925 A9.8884
+G1 X116.871 Y63.127 A9.8963
+G1 X116.993 Y63.331 A9.9041
+G1 X117.113 Y63.537 A9.9120
+G1 X117.233 Y63.744 A9.9198
+G1 X117.350 Y63.953 A9.9277
+G1 X117.467 Y64.162 A9.9357
+G1 X117.582 Y64.372 A9.9436
+G1 X117.697 Y64.582 A9.9515
+G1 X117.810 Y64.793 A9.9594
+G1 X117.922 Y65.004 A9.9672
+G1 X118.032 Y65.215 A9.9751
+G1 X118.142 Y65.426 A9.9829
+G1 X118.251 Y65.636 A9.9908
+G1 X118.359 Y65.845 A9.9985
+G1 X118.466 Y66.054 A10.0063
+G1 X118.573 Y66.261 A10.0139
+G1 X118.678 Y66.467 A10.0216
+G1 X118.783 Y66.672 A10.0292
+G1 X118.888 Y66.874 A10.0367
+G1 X118.992 Y67.075 A10.0442
+G1 X119.095 Y67.274 A10.0516
+G1 X119.199 Y67.471 A10.0589
+G1 X119.302 Y67.665 A10.0662
+G1 X119.405 Y67.857 A10.0733
+G1 X119.508 Y68.046 A10.0804
+G1 X119.610 Y68.232 A10.0875
+G1 X119.713 Y68.415 A10.0944
+G1 X119.816 Y68.595 A10.1012
+G1 X119.920 Y68.772 A10.1080
+G1 X120.023 Y68.946 A10.1147
+G1 X120.127 Y69.117 A10.1213
+G1 X120.231 Y69.284 A10.1278
+G1 X120.336 Y69.447 A10.1342
+G1 X120.442 Y69.607 A10.1405
+G1 X120.548 Y69.764 A10.1467
+G1 X120.654 Y69.916 A10.1529
+G1 X120.761 Y70.065 A10.1589
+G1 X120.869 Y70.211 A10.1649
+G1 X120.978 Y70.353 A10.1708
+G1 X121.087 Y70.491 A10.1766
+G1 X121.198 Y70.625 A10.1824
+G1 X121.309 Y70.756 A10.1880
+G1 X121.420 Y70.883 A10.1936
+G1 X121.533 Y71.006 A10.1991
+G1 X121.647 Y71.126 A10.2046
+G1 X121.761 Y71.242 A10.2099
+G1 X121.876 Y71.355 A10.2153
+G1 X121.992 Y71.464 A10.2205
+G1 X122.108 Y71.570 A10.2257
+G1 X122.226 Y71.672 A10.2308
+G1 X122.344 Y71.771 A10.2359
+G1 X122.462 Y71.867 A10.2410
+G1 X122.582 Y71.960 A10.2460
+G1 X122.701 Y72.050 A10.2509
+G1 X122.822 Y72.137 A10.2558
+G1 X122.943 Y72.221 A10.2606
+G1 X123.064 Y72.302 A10.2655
+G1 X123.186 Y72.380 A10.2702
+G1 X123.308 Y72.455 A10.2750
+G1 X123.430 Y72.528 A10.2797
+G1 X123.552 Y72.599 A10.2843
+G1 X123.675 Y72.667 A10.2890
+G1 X123.797 Y72.733 A10.2935
+G1 X123.920 Y72.796 A10.2981
+G1 X124.042 Y72.858 A10.3026
+G1 X124.164 Y72.917 A10.3071
+G1 X124.286 Y72.974 A10.3115
+G1 X124.408 Y73.030 A10.3159
+G1 X124.529 Y73.083 A10.3203
+G1 X124.650 Y73.135 A10.3247
+G1 X124.770 Y73.185 A10.3290
+G1 X124.890 Y73.233 A10.3332
+G1 X125.009 Y73.280 A10.3374
+G1 X125.127 Y73.325 A10.3416
+G1 X125.245 Y73.369 A10.3458
+G1 X125.362 Y73.411 A10.3499
+G1 X125.478 Y73.453 A10.3539
+G1 X125.593 Y73.492 A10.3579
+G1 X125.707 Y73.531 A10.3619
+G1 X125.820 Y73.569 A10.3658
+G1 X125.931 Y73.605 A10.3697
+G1 X126.042 Y73.640 A10.3736
+G1 X126.151 Y73.675 A10.3773
+G1 X126.260 Y73.708 A10.3811
+G1 X126.367 Y73.741 A10.3848
+G1 X126.472 Y73.772 A10.3884
+G1 X126.577 Y73.803 A10.3920
+G1 X126.680 Y73.833 A10.3955
+G1 X126.781 Y73.862 A10.3990
+G1 X126.882 Y73.891 A10.4025
+G1 X126.980 Y73.918 A10.4058
+G1 X127.078 Y73.945 A10.4092
+G1 X127.174 Y73.972 A10.4125
+G1 X127.268 Y73.997 A10.4157
+G1 X127.361 Y74.023 A10.4189
+G1 X127.453 Y74.047 A10.4220
+G1 X127.543 Y74.071 A10.4251
+G1 X127.631 Y74.095 A10.4281
+G1 X127.719 Y74.118 A10.4311
+G1 X127.804 Y74.140 A10.4340
+G1 X127.889 Y74.162 A10.4369
+G1 X127.972 Y74.184 A10.4397
+G1 X128.053 Y74.205 A10.4425
+G1 X128.133 Y74.225 A10.4452
+G1 X128.212 Y74.246 A10.4479
+G1 X128.290 Y74.265 A10.4506
+G1 X128.366 Y74.285 A10.4531
+G1 X128.441 Y74.304 A10.4557
+G1 X128.515 Y74.323 A10.4582
+G1 X128.587 Y74.341 A10.4607
+G1 X128.658 Y74.360 A10.4631
+G1 X128.729 Y74.377 A10.4655
+G1 X128.798 Y74.395 A10.4679
+G1 X128.866 Y74.412 A10.4702
+G1 X128.933 Y74.429 A10.4725
+G1 X128.999 Y74.446 A10.4747
+G1 X129.064 Y74.463 A10.4769
+G1 X129.128 Y74.479 A10.4791
+G1 X129.192 Y74.496 A10.4813
+G1 X129.255 Y74.512 A10.4834
+G1 X129.317 Y74.528 A10.4855
+G1 X129.378 Y74.544 A10.4876
+G1 X129.439 Y74.559 A10.4897
+G1 X129.499 Y74.575 A10.4917
+G1 X129.559 Y74.590 A10.4938
+G1 X129.618 Y74.606 A10.4958
+G1 X129.677 Y74.621 A10.4978
+G1 X129.736 Y74.636 A10.4998
+G1 X129.794 Y74.651 A10.5018
+G1 X129.852 Y74.667 A10.5038
+G1 X129.910 Y74.682 A10.5058
+G1 X129.968 Y74.697 A10.5077
+G1 X130.026 Y74.713 A10.5097
+G1 X130.084 Y74.728 A10.5117
+G1 X130.142 Y74.744 A10.5137
+G1 X130.200 Y74.759 A10.5157
+G1 X130.259 Y74.775 A10.5177
+G1 X130.317 Y74.791 A10.5197
+G1 X130.376 Y74.807 A10.5217
+G1 X130.436 Y74.823 A10.5237
+G1 X130.496 Y74.839 A10.5258
+G1 X130.556 Y74.856 A10.5279
+G1 X130.617 Y74.873 A10.5299
+G1 X130.679 Y74.890 A10.5321
+G1 X130.742 Y74.908 A10.5342
+G1 X130.805 Y74.925 A10.5364
+G1 X130.869 Y74.944 A10.5386
+G1 X130.934 Y74.962 A10.5408
+G1 X131.000 Y74.981 A10.5431
+G1 X131.067 Y75.000 A10.5454
+G1 X131.135 Y75.020 A10.5477
+G1 X131.204 Y75.040 A10.5501
+G1 X131.274 Y75.061 A10.5525
+G1 X131.346 Y75.082 A10.5549
+G1 X131.418 Y75.104 A10.5574
+G1 X131.492 Y75.126 A10.5600
+G1 X131.568 Y75.149 A10.5626
+G1 X131.645 Y75.172 A10.5653
+G1 X131.723 Y75.196 A10.5680
+G1 X131.803 Y75.221 A10.5707
+G1 X131.884 Y75.247 A10.5735
+G1 X131.967 Y75.273 A10.5764
+G1 X132.052 Y75.300 A10.5793
+G1 X132.138 Y75.328 A10.5823
+G1 X132.226 Y75.357 A10.5854
+G1 X132.315 Y75.387 A10.5885
+G1 X132.407 Y75.418 A10.5917
+G1 X132.500 Y75.449 A10.5949
+G1 X132.595 Y75.482 A10.5982
+G1 X132.692 Y75.516 A10.6016
+G1 X132.790 Y75.550 A10.6051
+G1 X132.891 Y75.586 A10.6086
+G1 X132.993 Y75.624 A10.6122
+G1 X133.097 Y75.662 A10.6158
+G1 X133.203 Y75.702 A10.6196
+G1 X133.311 Y75.743 A10.6234
+G1 X133.421 Y75.785 A10.6273
+G1 X133.532 Y75.829 A10.6312
+G1 X133.645 Y75.875 A10.6352
+G1 X133.760 Y75.922 A10.6393
+G1 X133.877 Y75.970 A10.6435
+G1 X133.996 Y76.020 A10.6478
+G1 X134.116 Y76.072 A10.6521
+G1 X134.239 Y76.126 A10.6565
+G1 X134.362 Y76.182 A10.6610
+G1 X134.488 Y76.239 A10.6655
+G1 X134.614 Y76.299 A10.6702
+G1 X134.743 Y76.360 A10.6749
+G1 X134.872 Y76.424 A10.6796
+G1 X135.004 Y76.490 A10.6845
+G1 X135.136 Y76.558 A10.6894
+G1 X135.270 Y76.628 A10.6944
+G1 X135.404 Y76.701 A10.6994
+G1 X135.540 Y76.776 A10.7045
+G1 X135.676 Y76.854 A10.7097
+G1 X135.814 Y76.934 A10.7150
+G1 X135.952 Y77.017 A10.7203
+G1 X136.091 Y77.103 A10.7257
+G1 X136.230 Y77.192 A10.7311
+G1 X136.369 Y77.283 A10.7366
+G1 X136.509 Y77.378 A10.7422
+G1 X136.649 Y77.475 A10.7478
+G1 X136.789 Y77.576 A10.7535
+G1 X136.928 Y77.679 A10.7592
+G1 X137.067 Y77.786 A10.7650
+G1 X137.206 Y77.896 A10.7709
+G1 X137.344 Y78.009 A10.7767
+G1 X137.481 Y78.126 A10.7827
+G1 X137.617 Y78.246 A10.7887
+G1 X137.752 Y78.370 A10.7947
+G1 X137.886 Y78.497 A10.8008
+G1 X138.018 Y78.628 A10.8069
+G1 X138.148 Y78.762 A10.8131
+G1 X138.276 Y78.900 A10.8193
+G1 X138.403 Y79.041 A10.8256
+G1 X138.527 Y79.186 A10.8319
+G1 X138.649 Y79.335 A10.8382
+G1 X138.768 Y79.487 A10.8446
+G1 X138.884 Y79.643 A10.8510
+G1 X138.998 Y79.803 A10.8575
+G1 X139.108 Y79.966 A10.8640
+G1 X139.215 Y80.133 A10.8706
+G1 X139.319 Y80.304 A10.8771
+G1 X139.419 Y80.478 A10.8838
+G1 X139.515 Y80.656 A10.8904
+G1 X139.608 Y80.837 A10.8972
+G1 X139.696 Y81.022 A10.9039
+G1 X139.780 Y81.210 A10.9107
+G1 X139.860 Y81.401 A10.9175
+G1 X139.935 Y81.596 A10.9244
+G1 X140.006 Y81.794 A10.9314
+G1 X140.072 Y81.995 A10.9383
+G1 X140.133 Y82.198 A10.9454
+G1 X140.190 Y82.405 A10.9524
+G1 X140.242 Y82.615 A10.9596
+G1 X140.288 Y82.827 A10.9667
+G1 X140.330 Y83.041 A10.9739
+G1 X140.366 Y83.259 A10.9812
+G1 X140.398 Y83.478 A10.9885
+G1 X140.424 Y83.700 A10.9959
+G1 X140.445 Y83.923 A11.0033
+G1 X140.461 Y84.149 A11.0108
+G1 X140.472 Y84.376 A11.0183
+G1 X140.478 Y84.604 A11.0258
+G1 X140.479 Y84.835 A11.0334
+G1 X140.475 Y85.066 A11.0410
+G1 X140.466 Y85.299 A11.0487
+G1 X140.452 Y85.532 A11.0564
+G1 X140.433 Y85.766 A11.0642
+G1 X140.410 Y86.001 A11.0720
+G1 X140.382 Y86.237 A11.0798
+G1 X140.350 Y86.472 A11.0877
+G1 X140.313 Y86.708 A11.0955
+G1 X140.273 Y86.944 A11.1034
+G1 X140.228 Y87.179 A11.1113
+G1 X140.180 Y87.415 A11.1193
+G1 X140.127 Y87.649 A11.1272
+G1 X140.072 Y87.884 A11.1352
+G1 X140.013 Y88.117 A11.1431
+G1 X139.950 Y88.350 A11.1510
+G1 X139.885 Y88.581 A11.1590
+G1 X139.817 Y88.811 A11.1669
+G1 X139.747 Y89.040 A11.1748
+G1 X139.674 Y89.268 A11.1827
+G1 X139.599 Y89.494 A11.1906
+G1 X139.521 Y89.718 A11.1984
+G1 X139.443 Y89.941 A11.2062
+G1 X139.362 Y90.161 A11.2139
+G1 X139.280 Y90.380 A11.2216
+G1 X139.197 Y90.597 A11.2293
+G1 X139.113 Y90.811 A11.2369
+G1 X139.028 Y91.024 A11.2444
+G1 X138.942 Y91.234 A11.2519
+G1 X138.856 Y91.441 A11.2593
+G1 X138.770 Y91.646 A11.2667
+G1 X138.683 Y91.849 A11.2740
+G1 X138.597 Y92.049 A11.2812
+G1 X138.511 Y92.247 A11.2883
+G1 X138.425 Y92.442 A11.2953
+G1 X138.340 Y92.634 A11.3022
+G1 X138.255 Y92.824 A11.3091
+G1 X138.171 Y93.011 A11.3159
+G1 X138.088 Y93.195 A11.3225
+G1 X138.007 Y93.377 A11.3291
+G1 X137.926 Y93.556 A11.3356
+G1 X137.847 Y93.732 A11.3419
+G1 X137.769 Y93.905 A11.3482
+G1 X137.692 Y94.075 A11.3544
+G1 X137.617 Y94.243 A11.3604
+G1 X137.544 Y94.408 A11.3664
+G1 X137.472 Y94.570 A11.3722
+G1 X137.402 Y94.729 A11.3780
+G1 X137.334 Y94.886 A11.3836
+G1 X137.268 Y95.040 A11.3892
+G1 X137.203 Y95.191 A11.3946
+G1 X137.141 Y95.340 A11.3999
+G1 X137.080 Y95.486 A11.4051
+G1 X137.022 Y95.629 A11.4102
+G1 X136.965 Y95.770 A11.4152
+G1 X136.910 Y95.908 A11.4201
+G1 X136.857 Y96.044 A11.4249
+G1 X136.807 Y96.177 A11.4296
+G1 X136.758 Y96.307 A11.4342
+G1 X136.711 Y96.435 A11.4387
+G1 X136.666 Y96.561 A11.4431
+G1 X136.623 Y96.684 A11.4475
+G1 X136.582 Y96.805 A11.4517
+G1 X136.542 Y96.924 A11.4558
+G1 X136.505 Y97.040 A11.4598
+G1 X136.469 Y97.154 A11.4638
+G1 X136.435 Y97.265 A11.4676
+G1 X136.403 Y97.375 A11.4714
+G1 X136.372 Y97.482 A11.4751
+G1 X136.343 Y97.587 A11.4786
+G1 X136.316 Y97.690 A11.4822
+G1 X136.290 Y97.791 A11.4856
+G1 X136.265 Y97.890 A11.4890
+G1 X136.242 Y97.987 A11.4922
+G1 X136.221 Y98.081 A11.4955
+G1 X136.200 Y98.174 A11.4986
+G1 X136.181 Y98.265 A11.5017
+G1 X136.164 Y98.354 A11.5047
+G1 X136.147 Y98.441 A11.5076
+G1 X136.132 Y98.527 A11.5104
+G1 X136.117 Y98.610 A11.5132
+G1 X136.104 Y98.692 A11.5160
+G1 X136.092 Y98.772 A11.5186
+G1 X136.081 Y98.851 A11.5213
+G1 X136.070 Y98.927 A11.5238
+G1 X136.061 Y99.003 A11.5263
+G1 X136.052 Y99.076 A11.5288
+G1 X136.045 Y99.148 A11.5312
+G1 X136.037 Y99.219 A11.5335
+G1 X136.031 Y99.288 A11.5358
+G1 X136.026 Y99.356 A11.5380
+G1 X136.021 Y99.422 A11.5402
+G1 X136.016 Y99.487 A11.5424
+G1 X136.012 Y99.551 A11.5445
+G1 X136.009 Y99.613 A11.5465
+G1 X136.007 Y99.674 A11.5486
+G1 X136.004 Y99.734 A11.5505
+G1 X136.003 Y99.793 A11.5525
+G1 X136.001 Y99.851 A11.5544
+G1 X136.001 Y99.908 A11.5563
+G1 X136.000 Y99.963 A11.5581
+G1 X136.000 Y100.018 A11.5599
+G1 X136.000 Y100.072 A11.5617
+G1 X136.001 Y100.125 A11.5634
+G1 X136.002 Y100.177 A11.5652
+G1 X136.003 Y100.228 A11.5669
+G1 X136.005 Y100.279 A11.5685
+G1 X136.007 Y100.329 A11.5702
+G1 X136.009 Y100.378 A11.5718
+G1 X136.011 Y100.427 A11.5734
+G1 X136.014 Y100.475 A11.5750
+G1 X136.017 Y100.522 A11.5766
+G1 X136.020 Y100.570 A11.5781
+G1 X136.023 Y100.616 A11.5797
+G1 X136.027 Y100.663 A11.5812
+G1 X136.031 Y100.709 A11.5827
+G1 X136.035 Y100.755 A11.5843
+G1 X136.039 Y100.800 A11.5858
+G1 X136.044 Y100.846 A11.5873
+G1 X136.049 Y100.891 A11.5888
+G1 X136.054 Y100.936 A11.5903
+G1 X136.059 Y100.981 A11.5918
+G1 X136.064 Y101.027 A11.5933
+G1 X136.070 Y101.072 A11.5948
+G1 X136.076 Y101.118 A11.5963
+G1 X136.083 Y101.163 A11.5978
+G1 X136.089 Y101.209 A11.5994
+G1 X136.096 Y101.255 A11.6009
+G1 X136.103 Y101.302 A11.6025
+G1 X136.111 Y101.349 A11.6040
+G1 X136.118 Y101.396 A11.6056
+G1 X136.127 Y101.444 A11.6072
+G1 X136.135 Y101.493 A11.6088
+G1 X136.144 Y101.542 A11.6105
+G1 X136.153 Y101.592 A11.6122
+G1 X136.163 Y101.642 A11.6139
+G1 X136.173 Y101.693 A11.6156
+G1 X136.183 Y101.745 A11.6173
+G1 X136.194 Y101.798 A11.6191
+G1 X136.206 Y101.852 A11.6209
+G1 X136.218 Y101.907 A11.6228
+G1 X136.230 Y101.962 A11.6247
+G1 X136.243 Y102.019 A11.6266
+G1 X136.257 Y102.077 A11.6285
+G1 X136.271 Y102.136 A11.6305
+G1 X136.286 Y102.196 A11.6326
+G1 X136.302 Y102.257 A11.6347
+G1 X136.318 Y102.320 A11.6368
+G1 X136.335 Y102.384 A11.6390
+G1 X136.353 Y102.449 A11.6412
+G1 X136.371 Y102.516 A11.6435
+G1 X136.391 Y102.584 A11.6458
+G1 X136.411 Y102.654 A11.6482
+G1 X136.432 Y102.725 A11.6507
+G1 X136.454 Y102.798 A11.6532
+G1 X136.477 Y102.872 A11.6558
+G1 X136.501 Y102.948 A11.6584
+G1 X136.526 Y103.026 A11.6611
+G1 X136.552 Y103.106 A11.6639
+G1 X136.579 Y103.187 A11.6667
+G1 X136.607 Y103.271 A11.6696
+G1 X136.637 Y103.356 A11.6726
+G1 X136.668 Y103.443 A11.6756
+G1 X136.699 Y103.532 A11.6788
+G1 X136.732 Y103.624 A11.6820
+G1 X136.767 Y103.717 A11.6852
+G1 X136.803 Y103.812 A11.6886
+G1 X136.840 Y103.910 A11.6921
+G1 X136.878 Y104.010 A11.6956
+G1 X136.918 Y104.111 A11.6992
+G1 X136.959 Y104.216 A11.7029
+G1 X137.002 Y104.322 A11.7067
+G1 X137.046 Y104.431 A11.7106
+G1 X137.092 Y104.542 A11.7145
+G1 X137.139 Y104.656 A11.7186
+G1 X137.188 Y104.772 A11.7227
+G1 X137.238 Y104.890 A11.7270
+G1 X137.290 Y105.011 A11.7313
+G1 X137.343 Y105.135 A11.7358
+G1 X137.398 Y105.261 A11.7403
+G1 X137.455 Y105.390 A11.7450
+G1 X137.513 Y105.521 A11.7497
+G1 X137.572 Y105.656 A11.7545
+G1 X137.633 Y105.792 A11.7595
+G1 X137.695 Y105.932 A11.7645
+G1 X137.759 Y106.074 A11.7697
+G1 X137.824 Y106.219 A11.7749
+G1 X137.891 Y106.367 A11.7803
+G1 X137.959 Y106.518 A11.7857
+G1 X138.028 Y106.671 A11.7913
+G1 X138.099 Y106.827 A11.7969
+G1 X138.170 Y106.986 A11.8027
+G1 X138.243 Y107.148 A11.8085
+G1 X138.316 Y107.313 A11.8145
+G1 X138.391 Y107.481 A11.8205
+G1 X138.466 Y107.651 A11.8267
+G1 X138.542 Y107.824 A11.8329
+G1 X138.618 Y108.000 A11.8393
+G1 X138.695 Y108.179 A11.8457
+G1 X138.773 Y108.361 A11.8522
+G1 X138.851 Y108.546 A11.8588
+G1 X138.928 Y108.733 A11.8655
+G1 X139.006 Y108.923 A11.8723
+G1 X139.084 Y109.115 A11.8791
+G1 X139.161 Y109.310 A11.8861
+G1 X139.237 Y109.508 A11.8931
+G1 X139.314 Y109.709 A11.9001
+G1 X139.389 Y109.911 A11.9073
+G1 X139.463 Y110.117 A11.9145
+G1 X139.536 Y110.324 A11.9217
+G1 X139.608 Y110.534 A11.9291
+G1 X139.678 Y110.746 A11.9364
+G1 X139.747 Y110.960 A11.9438
+G1 X139.813 Y111.176 A11.9513
+G1 X139.878 Y111.394 A11.9588
+G1 X139.940 Y111.613 A11.9663
+G1 X140.000 Y111.835 A11.9739
+G1 X140.057 Y112.058 A11.9815
+G1 X140.111 Y112.282 A11.9891
+G1 X140.163 Y112.508 A11.9968
+G1 X140.211 Y112.735 A12.0044
+G1 X140.255 Y112.963 A12.0121
+G1 X140.297 Y113.192 A12.0197
+G1 X140.334 Y113.421 A12.0274
+G1 X140.367 Y113.651 A12.0351
+G1 X140.397 Y113.882 A12.0428
+G1 X140.422 Y114.113 A12.0504
+G1 X140.443 Y114.344 A12.0581
+G1 X140.459 Y114.575 A12.0657
+G1 X140.470 Y114.806 A12.0734
+G1 X140.477 Y115.037 A12.0810
+G1 X140.479 Y115.267 A12.0886
+G1 X140.476 Y115.497 A12.0962
+G1 X140.468 Y115.726 A12.1037
+G1 X140.455 Y115.953 A12.1112
+G1 X140.436 Y116.180 A12.1188
+G1 X140.412 Y116.405 A12.1262
+G1 X140.383 Y116.629 A12.1337
+G1 X140.349 Y116.851 A12.1411
+G1 X140.309 Y117.072 A12.1485
+G1 X140.263 Y117.290 A12.1559
+G1 X140.212 Y117.507 A12.1632
+G1 X140.156 Y117.721 A12.1705
+G1 X140.095 Y117.933 A12.1778
+G1 X140.028 Y118.142 A12.1850
+G1 X139.956 Y118.349 A12.1923
+G1 X139.878 Y118.553 A12.1995
+G1 X139.796 Y118.754 A12.2066
+G1 X139.708 Y118.952 A12.2138
+G1 X139.615 Y119.147 A12.2209
+G1 X139.518 Y119.339 A12.2280
+G1 X139.416 Y119.528 A12.2351
+G1 X139.309 Y119.713 A12.2422
+G1 X139.197 Y119.895 A12.2492
+G1 X139.082 Y120.073 A12.2562
+G1 X138.962 Y120.248 A12.2632
+G1 X138.838 Y120.420 A12.2702
+G1 X138.710 Y120.587 A12.2771
+G1 X138.579 Y120.751 A12.2841
+G1 X138.444 Y120.912 A12.2910
+G1 X138.305 Y121.069 A12.2979
+G1 X138.164 Y121.221 A12.3048
+G1 X138.019 Y121.371 A12.3116
+G1 X137.872 Y121.516 A12.3185
+G1 X137.722 Y121.658 A12.3253
+G1 X137.570 Y121.796 A12.3320
+G1 X137.415 Y121.930 A12.3388
+G1 X137.259 Y122.061 A12.3455
+G1 X137.101 Y122.188 A12.3522
+G1 X136.941 Y122.311 A12.3589
+G1 X136.779 Y122.431 A12.3655
+G1 X136.617 Y122.547 A12.3721
+G1 X136.453 Y122.660 A12.3787
+G1 X136.289 Y122.770 A12.3852
+G1 X136.124 Y122.876 A12.3917
+G1 X135.958 Y122.979 A12.3981
+G1 X135.792 Y123.078 A12.4045
+G1 X135.626 Y123.175 A12.4108
+G1 X135.460 Y123.268 A12.4171
+G1 X135.295 Y123.358 A12.4233
+G1 X135.129 Y123.446 A12.4295
+G1 X134.964 Y123.530 A12.4356
+G1 X134.800 Y123.612 A12.4417
+G1 X134.636 Y123.691 A12.4477
+G1 X134.474 Y123.767 A12.4536
+G1 X134.312 Y123.841 A12.4595
+G1 X134.151 Y123.912 A12.4653
+G1 X133.992 Y123.981 A12.4710
+G1 X133.834 Y124.048 A12.4766
+G1 X133.678 Y124.112 A12.4822
+G1 X133.523 Y124.174 A12.4877
+G1 X133.370 Y124.234 A12.4932
+G1 X133.219 Y124.292 A12.4985
+G1 X133.069 Y124.348 A12.5038
+G1 X132.921 Y124.402 A12.5090
+G1 X132.776 Y124.455 A12.5141
+G1 X132.632 Y124.505 A12.5191
+G1 X132.490 Y124.554 A12.5241
+G1 X132.351 Y124.601 A12.5289
+G1 X132.213 Y124.647 A12.5337
+G1 X132.078 Y124.691 A12.5384
+G1 X131.945 Y124.734 A12.5430
+G1 X131.814 Y124.775 A12.5475
+G1 X131.685 Y124.815 A12.5520
+G1 X131.559 Y124.854 A12.5563
+G1 X131.435 Y124.891 A12.5606
+G1 X131.313 Y124.928 A12.5648
+G1 X131.194 Y124.963 A12.5689
+G1 X131.077 Y124.997 A12.5729
+G1 X130.962 Y125.030 A12.5769
+G1 X130.849 Y125.062 A12.5808
+G1 X130.739 Y125.093 A12.5845
+G1 X130.630 Y125.123 A12.5882
+G1 X130.525 Y125.153 A12.5919
+G1 X130.421 Y125.181 A12.5954
+G1 X130.319 Y125.209 A12.5989
+G1 X130.220 Y125.236 A12.6023
+G1 X130.123 Y125.262 A12.6056
+G1 X130.027 Y125.287 A12.6089
+G1 X129.934 Y125.312 A12.6121
+G1 X129.843 Y125.336 A12.6152
+G1 X129.754 Y125.359 A12.6182
+G1 X129.667 Y125.382 A12.6212
+G1 X129.581 Y125.404 A12.6241
+G1 X129.498 Y125.426 A12.6269
+G1 X129.416 Y125.447 A12.6297
+G1 X129.336 Y125.467 A12.6325
+G1 X129.258 Y125.487 A12.6351
+G1 X129.181 Y125.507 A12.6377
+G1 X129.106 Y125.526 A12.6403
+G1 X129.032 Y125.545 A12.6428
+G1 X128.960 Y125.564 A12.6452
+G1 X128.890 Y125.582 A12.6477
+G1 X128.820 Y125.599 A12.6500
+G1 X128.752 Y125.616 A12.6523
+G1 X128.686 Y125.633 A12.6546
+G1 X128.620 Y125.650 A12.6568
+G1 X128.556 Y125.667 A12.6590
+G1 X128.493 Y125.683 A12.6612
+G1 X128.431 Y125.699 A12.6633
+G1 X128.369 Y125.714 A12.6654
+G1 X128.309 Y125.730 A12.6674
+G1 X128.250 Y125.745 A12.6695
+G1 X128.191 Y125.760 A12.6714
+G1 X128.133 Y125.775 A12.6734
+G1 X128.076 Y125.790 A12.6754
+G1 X128.019 Y125.804 A12.6773
+G1 X127.963 Y125.819 A12.6792
+G1 X127.907 Y125.833 A12.6811
+G1 X127.852 Y125.848 A12.6830
+G1 X127.797 Y125.862 A12.6849
+G1 X127.743 Y125.876 A12.6867
+G1 X127.688 Y125.890 A12.6886
+G1 X127.634 Y125.905 A12.6904
+G1 X127.580 Y125.919 A12.6923
+G1 X127.526 Y125.933 A12.6941
+G1 X127.473 Y125.948 A12.6960
+G1 X127.419 Y125.962 A12.6978
+G1 X127.365 Y125.976 A12.6996
+G1 X127.310 Y125.991 A12.7015
+G1 X127.256 Y126.006 A12.7033
+G1 X127.201 Y126.021 A12.7052
+G1 X127.147 Y126.036 A12.7071
+G1 X127.091 Y126.051 A12.7090
+G1 X127.036 Y126.066 A12.7109
+G1 X126.979 Y126.082 A12.7128
+G1 X126.923 Y126.098 A12.7148
+G1 X126.866 Y126.114 A12.7167
+G1 X126.808 Y126.130 A12.7187
+G1 X126.749 Y126.147 A12.7207
+G1 X126.690 Y126.164 A12.7227
+G1 X126.630 Y126.181 A12.7248
+G1 X126.570 Y126.199 A12.7269
+G1 X126.508 Y126.217 A12.7290
+G1 X126.446 Y126.235 A12.7311
+G1 X126.383 Y126.254 A12.7333
+G1 X126.319 Y126.274 A12.7355
+G1 X126.254 Y126.294 A12.7378
+G1 X126.188 Y126.314 A12.7400
+G1 X126.121 Y126.335 A12.7423
+G1 X126.053 Y126.356 A12.7447
+G1 X125.984 Y126.378 A12.7471
+G1 X125.914 Y126.400 A12.7495
+G1 X125.843 Y126.424 A12.7520
+G1 X125.771 Y126.447 A12.7545
+G1 X125.698 Y126.472 A12.7570
+G1 X125.624 Y126.497 A12.7596
+G1 X125.548 Y126.523 A12.7623
+G1 X125.471 Y126.550 A12.7649
+G1 X125.394 Y126.577 A12.7676
+G1 X125.315 Y126.606 A12.7704
+G1 X125.235 Y126.635 A12.7732
+G1 X125.154 Y126.665 A12.7761
+G1 X125.072 Y126.696 A12.7790
+G1 X124.988 Y126.728 A12.7819
+G1 X124.904 Y126.761 A12.7849
+G1 X124.819 Y126.796 A12.7880
+G1 X124.732 Y126.831 A12.7910
+G1 X124.645 Y126.868 A12.7942
+G1 X124.556 Y126.905 A12.7973
+G1 X124.466 Y126.944 A12.8006
+G1 X124.376 Y126.985 A12.8038
+G1 X124.285 Y127.027 A12.8072
+G1 X124.192 Y127.070 A12.8105
+G1 X124.099 Y127.114 A12.8139
+G1 X124.005 Y127.161 A12.8174
+G1 X123.910 Y127.208 A12.8209
+G1 X123.815 Y127.258 A12.8244
+G1 X123.718 Y127.309 A12.8280
+G1 X123.621 Y127.362 A12.8317
+G1 X123.524 Y127.417 A12.8354
+G1 X123.426 Y127.474 A12.8391
+G1 X123.327 Y127.533 A12.8429
+G1 X123.228 Y127.594 A12.8468
+G1 X123.128 Y127.657 A12.8506
+G1 X123.028 Y127.722 A12.8546
+G1 X122.928 Y127.790 A12.8586
+G1 X122.827 Y127.859 A12.8626
+G1 X122.726 Y127.932 A12.8667
+G1 X122.625 Y128.007 A12.8709
+G1 X122.524 Y128.084 A12.8751
+G1 X122.423 Y128.164 A12.8793
+G1 X122.321 Y128.247 A12.8837
+G1 X122.220 Y128.333 A12.8880
+G1 X122.118 Y128.421 A12.8925
+G1 X122.017 Y128.513 A12.8970
+G1 X121.915 Y128.608 A12.9016
+G1 X121.814 Y128.705 A12.9062
+G1 X121.713 Y128.806 A12.9109
+G1 X121.612 Y128.910 A12.9157
+G1 X121.511 Y129.017 A12.9206
+G1 X121.411 Y129.128 A12.9255
+G1 X121.310 Y129.242 A12.9305
+G1 X121.210 Y129.360 A12.9356
+G1 X121.111 Y129.481 A12.9408
+G1 X121.011 Y129.605 A12.9461
+G1 X120.912 Y129.733 A12.9514
+G1 X120.812 Y129.865 A12.9568
+G1 X120.714 Y130.000 A12.9624
+G1 X120.615 Y130.139 A12.9680
+G1 X120.516 Y130.282 A12.9737
+G1 X120.418 Y130.428 A12.9795
+G1 X120.320 Y130.578 A12.9854
+G1 X120.222 Y130.731 A12.9914
+G1 X120.124 Y130.888 A12.9976
+G1 X120.026 Y131.049 A13.0038
+G1 X119.928 Y131.213 A13.0101
+G1 X119.830 Y131.381 A13.0165
+G1 X119.732 Y131.552 A13.0230
+G1 X119.634 Y131.726 A13.0296
+G1 X119.536 Y131.903 A13.0363
+G1 X119.437 Y132.084 A13.0431
+G1 X119.338 Y132.268 A13.0500
+G1 X119.238 Y132.455 A13.0570
+G1 X119.138 Y132.645 A13.0640
+G1 X119.037 Y132.837 A13.0712
+G1 X118.936 Y133.032 A13.0785
+G1 X118.834 Y133.230 A13.0858
+G1 X118.731 Y133.429 A13.0932
+G1 X118.628 Y133.631 A13.1007
+G1 X118.523 Y133.835 A13.1083
+G1 X118.418 Y134.041 A13.1159
+G1 X118.311 Y134.248 A13.1236
+G1 X118.203 Y134.457 A13.1313
+G1 X118.094 Y134.667 A13.1392
+G1 X117.983 Y134.878 A13.1470
+G1 X117.872 Y135.090 A13.1549
+G1 X117.758 Y135.303 A13.1629
+G1 X117.644 Y135.516 A13.1709
+G1 X117.527 Y135.729 A13.1789
+G1 X117.409 Y135.942 A13.1869
+G1 X117.290 Y136.155 A13.1950
+G1 X117.169 Y136.367 A13.2030
+G1 X117.046 Y136.579 A13.2111
+G1 X116.921 Y136.790 A13.2192
+G1 X116.795 Y136.999 A13.2273
+G1 X116.667 Y137.207 A13.2353
+G1 X116.537 Y137.414 A13.2434
+G1 X116.405 Y137.619 A13.2514
+G1 X116.271 Y137.822 A13.2594
+G1 X116.136 Y138.022 A13.2674
+G1 X115.999 Y138.220 A13.2754
+G1 X115.860 Y138.416 A13.2833
+G1 X115.719 Y138.609 A13.2912
+G1 X115.577 Y138.798 A13.2990
+G1 X115.433 Y138.985 A13.3068
+G1 X115.287 Y139.168 A13.3145
+G1 X115.140 Y139.348 A13.3222
+G1 X114.991 Y139.524 A13.3298
+G1 X114.841 Y139.696 A13.3373
+G1 X114.689 Y139.864 A13.3448
+G1 X114.537 Y140.029 A13.3522
+G1 X114.383 Y140.189 A13.3595
+G1 X114.227 Y140.345 A13.3668
+G1 X114.071 Y140.496 A13.3740
+G1 X113.914 Y140.644 A13.3811
+G1 X113.755 Y140.786 A13.3881
+G1 X113.596 Y140.925 A13.3951
+G1 X113.437 Y141.058 A13.4019
+G1 X113.276 Y141.187 A13.4087
+G1 X113.116 Y141.311 A13.4154
+G1 X112.954 Y141.431 A13.4220
+G1 X112.793 Y141.546 A13.4286
+G1 X112.631 Y141.656 A13.4351
+G1 X112.469 Y141.762 A13.4414
+G1 X112.307 Y141.863 A13.4477
+G1 X112.146 Y141.959 A13.4539
+G1 X111.984 Y142.051 A13.4601
+G1 X111.823 Y142.138 A13.4661
+G1 X111.662 Y142.221 A13.4721
+G1 X111.502 Y142.300 A13.4780
+G1 X111.342 Y142.374 A13.4838
+G1 X111.183 Y142.444 A13.4895
+G1 X111.025 Y142.509 A13.4952
+G1 X110.868 Y142.571 A13.5007
+G1 X110.712 Y142.628 A13.5062
+G1 X110.557 Y142.682 A13.5116
+G1 X110.402 Y142.732 A13.5170
+G1 X110.250 Y142.778 A13.5223
+G1 X110.098 Y142.820 A13.5275
+G1 X109.948 Y142.859 A13.5326
+G1 X109.799 Y142.895 A13.5376
+G1 X109.652 Y142.927 A13.5426
+G1 X109.506 Y142.956 A13.5475
+G1 X109.362 Y142.983 A13.5523
+G1 X109.220 Y143.006 A13.5571
+G1 X109.079 Y143.026 A13.5618
+G1 X108.940 Y143.044 A13.5664
+G1 X108.803 Y143.059 A13.5710
+G1 X108.668 Y143.071 A13.5754
+G1 X108.534 Y143.082 A13.5799
+G1 X108.403 Y143.090 A13.5842
+G1 X108.274 Y143.095 A13.5885
+G1 X108.146 Y143.099 A13.5927
+G1 X108.021 Y143.101 A13.5968
+G1 X107.897 Y143.101 A13.6009
+G1 X107.776 Y143.099 A13.6049
+G1 X107.656 Y143.096 A13.6089
+G1 X107.539 Y143.091 A13.6127
+G1 X107.423 Y143.085 A13.6165
+G1 X107.310 Y143.077 A13.6203
+G1 X107.199 Y143.069 A13.6240
+G1 X107.090 Y143.059 A13.6276
+G1 X106.982 Y143.048 A13.6312
+G1 X106.877 Y143.035 A13.6346
+G1 X106.774 Y143.022 A13.6381
+G1 X106.673 Y143.008 A13.6414
+G1 X106.574 Y142.994 A13.6448
+G1 X106.476 Y142.978 A13.6480
+G1 X106.381 Y142.962 A13.6512
+G1 X106.287 Y142.946 A13.6543
+G1 X106.196 Y142.928 A13.6574
+G1 X106.106 Y142.911 A13.6604
+G1 X106.018 Y142.892 A13.6634
+G1 X105.932 Y142.874 A13.6663
+G1 X105.847 Y142.855 A13.6692
+G1 X105.765 Y142.836 A13.6720
+G1 X105.684 Y142.816 A13.6747
+G1 X105.604 Y142.796 A13.6774
+G1 X105.526 Y142.776 A13.6801
+G1 X105.450 Y142.756 A13.6827
+G1 X105.375 Y142.736 A13.6852
+G1 X105.302 Y142.715 A13.6878
+G1 X105.229 Y142.694 A13.6902
+G1 X105.159 Y142.674 A13.6927
+G1 X105.089 Y142.653 A13.6951
+G1 X105.021 Y142.632 A13.6974
+G1 X104.954 Y142.611 A13.6997
+G1 X104.888 Y142.590 A13.7020
+G1 X104.823 Y142.568 A13.7043
+G1 X104.760 Y142.547 A13.7065
+G1 X104.697 Y142.526 A13.7087
+G1 X104.635 Y142.505 A13.7108
+G1 X104.574 Y142.483 A13.7130
+G1 X104.514 Y142.462 A13.7151
+G1 X104.454 Y142.440 A13.7172
+G1 X104.395 Y142.419 A13.7192
+G1 X104.337 Y142.397 A13.7213
+G1 X104.279 Y142.375 A13.7233
+G1 X104.222 Y142.353 A13.7253
+G1 X104.165 Y142.331 A13.7273
+G1 X104.109 Y142.309 A13.7293
+G1 X104.053 Y142.287 A13.7313
+G1 X103.997 Y142.264 A13.7333
+G1 X103.942 Y142.241 A13.7353
+G1 X103.886 Y142.219 A13.7373
+G1 X103.831 Y142.195 A13.7393
+G1 X103.776 Y142.172 A13.7412
+G1 X103.720 Y142.148 A13.7432
+G1 X103.665 Y142.124 A13.7452
+G1 X103.609 Y142.100 A13.7472
+G1 X103.554 Y142.075 A13.7492
+G1 X103.498 Y142.050 A13.7513
+G1 X103.441 Y142.024 A13.7533
+G1 X103.384 Y141.998 A13.7554
+G1 X103.327 Y141.972 A13.7574
+G1 X103.269 Y141.945 A13.7596
+G1 X103.211 Y141.917 A13.7617
+G1 X103.152 Y141.889 A13.7638
+G1 X103.093 Y141.860 A13.7660
+G1 X103.033 Y141.831 A13.7682
+G1 X102.972 Y141.801 A13.7705
+G1 X102.910 Y141.770 A13.7727
+G1 X102.847 Y141.739 A13.7751
+G1 X102.783 Y141.706 A13.7774
+G1 X102.719 Y141.673 A13.7798
+G1 X102.653 Y141.639 A13.7823
+G1 X102.587 Y141.604 A13.7847
+G1 X102.519 Y141.568 A13.7873
+G1 X102.450 Y141.531 A13.7898
+G1 X102.380 Y141.494 A13.7925
+G1 X102.309 Y141.455 A13.7951
+G1 X102.236 Y141.415 A13.7979
+G1 X102.163 Y141.373 A13.8007
+G1 X102.088 Y141.331 A13.8035
+G1 X102.011 Y141.288 A13.8064
+G1 X101.933 Y141.243 A13.8094
+G1 X101.854 Y141.197 A13.8124
+G1 X101.773 Y141.150 A13.8155
+G1 X101.691 Y141.101 A13.8186
+G1 X101.608 Y141.051 A13.8218
+G1 X101.523 Y140.999 A13.8251
+G1 X101.436 Y140.946 A13.8285
+G1 X101.348 Y140.892 A13.8319
+G1 X101.258 Y140.836 A13.8354
+G1 X101.167 Y140.779 A13.8390
+G1 X101.074 Y140.720 A13.8426
+G1 X100.979 Y140.659 A13.8463
+G1 X100.883 Y140.597 A13.8501
+G1 X100.785 Y140.533 A13.8539
+G1 X100.686 Y140.468 A13.8578
+G1 X100.585 Y140.401 A13.8618
+G1 X100.482 Y140.332 A13.8659
+G1 X100.378 Y140.261 A13.8701
+G1 X100.273 Y140.189 A13.8743
+G1 X100.165 Y140.115 A13.8786
+G1 X100.056 Y140.039 A13.8830
+G1 X99.946 Y139.962 A13.8874
+G1 X99.834 Y139.883 A13.8919
+G1 X99.720 Y139.802 A13.8965
+G1 X99.605 Y139.720 A13.9012
+G1 X99.489 Y139.636 A13.9060
+G1 X99.371 Y139.550 A13.9108
+G1 X99.251 Y139.463 A13.9157
+G1 X99.130 Y139.374 A13.9206
+G1 X99.008 Y139.284 A13.9256
+G1 X98.884 Y139.192 A13.9307
+G1 X98.759 Y139.099 A13.9359
+G1 X98.632 Y139.004 A13.9411
+G1 X98.504 Y138.908 A13.9464
+G1 X98.375 Y138.811 A13.9517
+G1 X98.245 Y138.713 A13.9571
+G1 X98.113 Y138.613 A13.9625
+G1 X97.980 Y138.513 A13.9680
+G1 X97.847 Y138.411 A13.9736
+G1 X97.711 Y138.309 A13.9791
+G1 X97.575 Y138.206 A13.9848
+G1 X97.438 Y138.102 A13.9905
+G1 X97.300 Y137.998 A13.9962
+G1 X97.160 Y137.894 A14.0019
+G1 X97.020 Y137.789 A14.0077
+G1 X96.878 Y137.684 A14.0135
+G1 X96.736 Y137.578 A14.0194
+G1 X96.593 Y137.473 A14.0252
+G1 X96.448 Y137.369 A14.0311
+G1 X96.303 Y137.264 A14.0370
+G1 X96.157 Y137.160 A14.0429
+G1 X96.010 Y137.057 A14.0489
+G1 X95.862 Y136.954 A14.0548
+G1 X95.713 Y136.853 A14.0608
+G1 X95.564 Y136.752 A14.0667
+G1 X95.413 Y136.653 A14.0726
+G1 X95.262 Y136.555 A14.0786
+G1 X95.110 Y136.459 A14.0845
+G1 X94.956 Y136.364 A14.0905
+G1 X94.802 Y136.272 A14.0964
+G1 X94.647 Y136.181 A14.1023
+G1 X94.492 Y136.092 A14.1083
+G1 X94.335 Y136.006 A14.1142
+G1 X94.177 Y135.922 A14.1201
+G1 X94.018 Y135.841 A14.1259
+G1 X93.859 Y135.762 A14.1318
+G1 X93.698 Y135.687 A14.1377
+G1 X93.536 Y135.614 A14.1435
+G1 X93.374 Y135.544 A14.1494
+G1 X93.210 Y135.477 A14.1552
+G1 X93.045 Y135.414 A14.1610
+G1 X92.879 Y135.354 A14.1669
+G1 X92.711 Y135.298 A14.1727
+G1 X92.543 Y135.244 A14.1785
+G1 X92.373 Y135.195 A14.1844
+G1 X92.202 Y135.149 A14.1902
+G1 X92.030 Y135.107 A14.1961
+G1 X91.856 Y135.068 A14.2019
+G1 X91.681 Y135.033 A14.2078
+G1 X91.505 Y135.002 A14.2137
+G1 X91.327 Y134.975 A14.2197
+G1 X91.148 Y134.951 A14.2256
+G1 X90.967 Y134.931 A14.2316
+G1 X90.785 Y134.915 A14.2377
+G1 X90.602 Y134.902 A14.2437
+G1 X90.417 Y134.893 A14.2498
+G1 X90.231 Y134.888 A14.2560
+G1 X90.043 Y134.885 A14.2622
+G1 X89.854 Y134.887 A14.2684
+G1 X89.663 Y134.891 A14.2747
+G1 X89.471 Y134.899 A14.2811
+G1 X89.278 Y134.910 A14.2874
+G1 X89.083 Y134.923 A14.2939
+G1 X88.887 Y134.940 A14.3004
+G1 X88.689 Y134.959 A14.3069
+G1 X88.491 Y134.981 A14.3135
+G1 X88.291 Y135.005 A14.3202
+G1 X88.090 Y135.032 A14.3269
+G1 X87.888 Y135.061 A14.3336
+G1 X87.685 Y135.092 A14.3404
+G1 X87.481 Y135.124 A14.3472
+G1 X87.276 Y135.158 A14.3540
+G1 X87.070 Y135.194 A14.3609
+G1 X86.864 Y135.231 A14.3679
+G1 X86.657 Y135.269 A14.3748
+G1 X86.449 Y135.309 A14.3818
+G1 X86.241 Y135.349 A14.3888
+G1 X86.033 Y135.390 A14.3958
+G1 X85.824 Y135.431 A14.4028
+G1 X85.615 Y135.473 A14.4098
+G1 X85.406 Y135.515 A14.4169
+G1 X85.197 Y135.557 A14.4239
+G1 X84.989 Y135.599 A14.4309
+G1 X84.780 Y135.641 A14.4379
+G1 X84.572 Y135.683 A14.4449
+G1 X84.365 Y135.724 A14.4519
+G1 X84.158 Y135.765 A14.4589
+G1 X83.952 Y135.805 A14.4658
+G1 X83.747 Y135.844 A14.4727
+G1 X83.542 Y135.882 A14.4795
+G1 X83.339 Y135.919 A14.4864
+G1 X83.137 Y135.955 A14.4931
+G1 X82.936 Y135.990 A14.4999
+G1 X82.736 Y136.024 A14.5065
+G1 X82.538 Y136.056 A14.5132
+G1 X82.342 Y136.087 A14.5197
+G1 X82.147 Y136.116 A14.5262
+G1 X81.954 Y136.144 A14.5327
+G1 X81.763 Y136.171 A14.5390
+G1 X81.574 Y136.196 A14.5453
+G1 X81.386 Y136.219 A14.5516
+G1 X81.201 Y136.240 A14.5577
+G1 X81.018 Y136.260 A14.5638
+G1 X80.838 Y136.279 A14.5698
+G1 X80.659 Y136.295 A14.5757
+G1 X80.483 Y136.310 A14.5815
+G1 X80.309 Y136.324 A14.5873
+G1 X80.138 Y136.335 A14.5929
+G1 X79.969 Y136.346 A14.5985
+G1 X79.803 Y136.354 A14.6040
+G1 X79.640 Y136.361 A14.6094
+G1 X79.479 Y136.366 A14.6147
+G1 X79.321 Y136.370 A14.6199
+G1 X79.165 Y136.372 A14.6251
+G1 X79.012 Y136.373 A14.6301
+G1 X78.862 Y136.372 A14.6351
+G1 X78.715 Y136.371 A14.6399
+G1 X78.570 Y136.367 A14.6447
+G1 X78.428 Y136.363 A14.6494
+G1 X78.289 Y136.357 A14.6540
+G1 X78.153 Y136.350 A14.6585
+G1 X78.019 Y136.342 A14.6629
+G1 X77.889 Y136.332 A14.6672
+G1 X77.760 Y136.322 A14.6715
+G1 X77.635 Y136.311 A14.6756
+G1 X77.512 Y136.299 A14.6797
+G1 X77.392 Y136.285 A14.6837
+G1 X77.275 Y136.272 A14.6876
+G1 X77.160 Y136.257 A14.6914
+G1 X77.048 Y136.241 A14.6952
+G1 X76.938 Y136.225 A14.6988
+G1 X76.831 Y136.208 A14.7024
+G1 X76.726 Y136.191 A14.7059
+G1 X76.624 Y136.173 A14.7093
+G1 X76.524 Y136.154 A14.7127
+G1 X76.426 Y136.135 A14.7160
+G1 X76.331 Y136.116 A14.7192
+G1 X76.238 Y136.096 A14.7223
+G1 X76.147 Y136.076 A14.7254
+G1 X76.058 Y136.055 A14.7284
+G1 X75.972 Y136.035 A14.7313
+G1 X75.887 Y136.014 A14.7342
+G1 X75.805 Y135.992 A14.7370
+G1 X75.724 Y135.971 A14.7398
+G1 X75.646 Y135.949 A14.7425
+G1 X75.569 Y135.927 A14.7451
+G1 X75.494 Y135.905 A14.7477
+G1 X75.420 Y135.883 A14.7502
+G1 X75.349 Y135.861 A14.7527
+G1 X75.278 Y135.838 A14.7551
+G1 X75.210 Y135.816 A14.7575
+G1 X75.143 Y135.793 A14.7598
+G1 X75.077 Y135.771 A14.7621
+G1 X75.013 Y135.748 A14.7644
+G1 X74.950 Y135.726 A14.7666
+G1 X74.888 Y135.703 A14.7687
+G1 X74.827 Y135.680 A14.7709
+G1 X74.768 Y135.657 A14.7730
+G1 X74.710 Y135.634 A14.7751
+G1 X74.652 Y135.611 A14.7771
+G1 X74.596 Y135.588 A14.7791
+G1 X74.540 Y135.565 A14.7811
+G1 X74.485 Y135.542 A14.7831
+G1 X74.431 Y135.519 A14.7850
+G1 X74.378 Y135.495 A14.7869
+G1 X74.326 Y135.472 A14.7888
+G1 X74.274 Y135.448 A14.7907
+G1 X74.222 Y135.424 A14.7926
+G1 X74.171 Y135.400 A14.7944
+G1 X74.120 Y135.376 A14.7963
+G1 X74.070 Y135.351 A14.7981
+G1 X74.020 Y135.327 A14.8000
+G1 X73.971 Y135.302 A14.8018
+G1 X73.921 Y135.276 A14.8036
+G1 X73.872 Y135.251 A14.8055
+G1 X73.823 Y135.225 A14.8073
+G1 X73.773 Y135.198 A14.8092
+G1 X73.724 Y135.171 A14.8110
+G1 X73.675 Y135.144 A14.8129
+G1 X73.626 Y135.116 A14.8147
+G1 X73.576 Y135.088 A14.8166
+G1 X73.527 Y135.059 A14.8185
+G1 X73.477 Y135.030 A14.8204
+G1 X73.426 Y135.000 A14.8223
+G1 X73.376 Y134.969 A14.8243
+G1 X73.325 Y134.937 A14.8263
+G1 X73.274 Y134.905 A14.8283
+G1 X73.222 Y134.872 A14.8303
+G1 X73.170 Y134.838 A14.8324
+G1 X73.117 Y134.803 A14.8344
+G1 X73.064 Y134.767 A14.8366
+G1 X73.011 Y134.731 A14.8387
+G1 X72.956 Y134.693 A14.8409
+G1 X72.901 Y134.654 A14.8431
+G1 X72.846 Y134.614 A14.8454
+G1 X72.790 Y134.572 A14.8477
+G1 X72.733 Y134.530 A14.8500
+G1 X72.675 Y134.486 A14.8524
+G1 X72.617 Y134.441 A14.8548
+G1 X72.558 Y134.394 A14.8573
+G1 X72.499 Y134.346 A14.8598
+G1 X72.438 Y134.296 A14.8624
+G1 X72.377 Y134.245 A14.8651
+G1 X72.315 Y134.192 A14.8677
+G1 X72.253 Y134.137 A14.8705
+G1 X72.190 Y134.081 A14.8733
+G1 X72.126 Y134.022 A14.8761
+G1 X72.061 Y133.962 A14.8790
+G1 X71.996 Y133.900 A14.8820
+G1 X71.930 Y133.836 A14.8851
+G1 X71.863 Y133.769 A14.8882
+G1 X71.796 Y133.701 A14.8913
+G1 X71.728 Y133.630 A14.8946
+G1 X71.660 Y133.557 A14.8979
+G1 X71.591 Y133.481 A14.9012
+G1 X71.522 Y133.403 A14.9047
+G1 X71.452 Y133.323 A14.9082
+G1 X71.382 Y133.240 A14.9118
+G1 X71.311 Y133.154 A14.9155
+G1 X71.240 Y133.066 A14.9192
+G1 X71.169 Y132.974 A14.9230
+G1 X71.098 Y132.880 A14.9269
+G1 X71.026 Y132.784 A14.9309
+G1 X70.955 Y132.684 A14.9349
+G1 X70.883 Y132.581 A14.9391
+G1 X70.812 Y132.475 A14.9433
+G1 X70.740 Y132.366 A14.9476
+G1 X70.669 Y132.254 A14.9520
+G1 X70.598 Y132.138 A14.9564
+G1 X70.528 Y132.020 A14.9610
+G1 X70.457 Y131.897 A14.9656
+G1 X70.387 Y131.772 A14.9704
+G1 X70.318 Y131.643 A14.9752
+G1 X70.249 Y131.511 A14.9801
+G1 X70.182 Y131.376 A14.9851
+G1 X70.114 Y131.236 A14.9902
+G1 X70.048 Y131.094 A14.9954
+G1 X69.983 Y130.948 A15.0007
+G1 X69.918 Y130.798 A15.0061
+G1 X69.855 Y130.645 A15.0115
+G1 X69.793 Y130.488 A15.0171
+G1 X69.732 Y130.328 A15.0228
+G1 X69.672 Y130.164 A15.0285
+G1 X69.614 Y129.997 A15.0343
+G1 X69.557 Y129.827 A15.0403
+G1 X69.502 Y129.653 A15.0463
+G1 X69.448 Y129.475 A15.0524
+G1 X69.396 Y129.294 A15.0586
+G1 X69.346 Y129.110 A15.0649
+G1 X69.297 Y128.923 A15.0713
+G1 X69.250 Y128.732 A15.0778
+G1 X69.205 Y128.539 A15.0844
+G1 X69.162 Y128.342 A15.0910
+G1 X69.121 Y128.142 A15.0977
+G1 X69.081 Y127.940 A15.1045
+G1 X69.044 Y127.735 A15.1114
+G1 X69.008 Y127.527 A15.1184
+G1 X68.974 Y127.316 A15.1254
+G1 X68.942 Y127.103 A15.1325
+G1 X68.912 Y126.888 A15.1397
+G1 X68.884 Y126.671 A15.1469
+G1 X68.858 Y126.451 A15.1542
+G1 X68.834 Y126.230 A15.1616
+G1 X68.811 Y126.007 A15.1690
+G1 X68.790 Y125.782 A15.1764
+G1 X68.771 Y125.556 A15.1839
+G1 X68.753 Y125.329 A15.1914
+G1 X68.737 Y125.100 A15.1990
+G1 X68.722 Y124.870 A15.2066
+G1 X68.709 Y124.640 A15.2142
+G1 X68.697 Y124.409 A15.2219
+G1 X68.686 Y124.177 A15.2295
+G1 X68.676 Y123.945 A15.2372
+G1 X68.668 Y123.713 A15.2448
+G1 X68.660 Y123.481 A15.2525
+G1 X68.652 Y123.248 A15.2602
+G1 X68.646 Y123.017 A15.2678
+G1 X68.639 Y122.785 A15.2755
+G1 X68.633 Y122.555 A15.2831
+G1 X68.628 Y122.325 A15.2907
+G1 X68.622 Y122.096 A15.2982
+G1 X68.616 Y121.868 A15.3057
+G1 X68.610 Y121.642 A15.3132
+G1 X68.603 Y121.416 A15.3206
+G1 X68.596 Y121.193 A15.3280
+G1 X68.588 Y120.971 A15.3354
+G1 X68.580 Y120.750 A15.3426
+G1 X68.570 Y120.532 A15.3499
+G1 X68.559 Y120.315 A15.3570
+G1 X68.547 Y120.101 A15.3641
+G1 X68.534 Y119.889 A15.3711
+G1 X68.519 Y119.679 A15.3781
+G1 X68.502 Y119.471 A15.3849
+G1 X68.484 Y119.266 A15.3917
+G1 X68.463 Y119.063 A15.3985
+G1 X68.441 Y118.863 A15.4051
+G1 X68.416 Y118.665 A15.4117
+G1 X68.390 Y118.470 A15.4182
+G1 X68.361 Y118.278 A15.4246
+G1 X68.329 Y118.089 A15.4309
+G1 X68.295 Y117.902 A15.4372
+G1 X68.259 Y117.718 A15.4434
+G1 X68.220 Y117.537 A15.4495
+G1 X68.178 Y117.358 A15.4555
+G1 X68.134 Y117.183 A15.4615
+G1 X68.087 Y117.010 A15.4674
+G1 X68.038 Y116.840 A15.4733
+G1 X67.985 Y116.672 A15.4791
+G1 X67.930 Y116.508 A15.4848
+G1 X67.872 Y116.346 A15.4905
+G1 X67.812 Y116.187 A15.4961
+G1 X67.749 Y116.030 A15.5017
+G1 X67.683 Y115.876 A15.5072
+G1 X67.615 Y115.725 A15.5127
+G1 X67.544 Y115.576 A15.5181
+G1 X67.470 Y115.429 A15.5235
+G1 X67.394 Y115.285 A15.5289
+G1 X67.316 Y115.144 A15.5342
+G1 X67.236 Y115.004 A15.5395
+G1 X67.153 Y114.867 A15.5448
+G1 X67.068 Y114.733 A15.5501
+G1 X66.981 Y114.600 A15.5553
+G1 X66.892 Y114.470 A15.5605
+G1 X66.801 Y114.341 A15.5657
+G1 X66.709 Y114.215 A15.5709
+G1 X66.615 Y114.091 A15.5760
+G1 X66.520 Y113.969 A15.5811
+G1 X66.423 Y113.848 A15.5862
+G1 X66.324 Y113.730 A15.5913
+G1 X66.225 Y113.613 A15.5964
+G1 X66.125 Y113.498 A15.6014
+G1 X66.023 Y113.385 A15.6064
+G1 X65.921 Y113.273 A15.6114
+G1 X65.818 Y113.163 A15.6164
+G1 X65.715 Y113.055 A15.6213
+G1 X65.611 Y112.949 A15.6262
+G1 X65.506 Y112.844 A15.6311
+G1 X65.402 Y112.740 A15.6360
+G1 X65.297 Y112.638 A15.6408
+G1 X65.192 Y112.537 A15.6456
+G1 X65.087 Y112.438 A15.6503
+G1 X64.983 Y112.340 A15.6551
+G1 X64.879 Y112.244 A15.6598
+G1 X64.775 Y112.149 A15.6644
+G1 X64.671 Y112.056 A15.6690
+G1 X64.568 Y111.963 A15.6736
+G1 X64.466 Y111.873 A15.6781
+G1 X64.364 Y111.783 A15.6825
+G1 X64.263 Y111.695 A15.6870
+G1 X64.163 Y111.608 A15.6913
+G1 X64.064 Y111.522 A15.6957
+G1 X63.966 Y111.438 A15.6999
+G1 X63.869 Y111.355 A15.7042
+G1 X63.773 Y111.273 A15.7083
+G1 X63.678 Y111.192 A15.7124
+G1 X63.584 Y111.112 A15.7165
+G1 X63.492 Y111.034 A15.7205
+G1 X63.400 Y110.957 A15.7244
+G1 X63.310 Y110.881 A15.7283
+G1 X63.221 Y110.807 A15.7321
+G1 X63.134 Y110.733 A15.7359
+G1 X63.048 Y110.661 A15.7396
+G1 X62.963 Y110.590 A15.7433
+G1 X62.880 Y110.520 A15.7469
+G1 X62.798 Y110.451 A15.7504
+G1 X62.718 Y110.384 A15.7539
+G1 X62.639 Y110.317 A15.7573
+G1 X62.561 Y110.252 A15.7606
+G1 X62.485 Y110.188 A15.7639
+G1 X62.410 Y110.124 A15.7671
+G1 X62.336 Y110.062 A15.7703
+G1 X62.264 Y110.001 A15.7734
+G1 X62.193 Y109.941 A15.7765
+G1 X62.124 Y109.882 A15.7795
+G1 X62.056 Y109.824 A15.7825
+G1 X61.989 Y109.767 A15.7854
+G1 X61.924 Y109.711 A15.7882
+G1 X61.859 Y109.655 A15.7910
+G1 X61.796 Y109.601 A15.7938
+G1 X61.735 Y109.548 A15.7965
+G1 X61.674 Y109.495 A15.7991
+G1 X61.614 Y109.443 A15.8017
+G1 X61.556 Y109.392 A15.8043
+G1 X61.499 Y109.342 A15.8068
+G1 X61.442 Y109.293 A15.8092
+G1 X61.387 Y109.244 A15.8117
+G1 X61.333 Y109.196 A15.8141
+G1 X61.279 Y109.149 A15.8164
+G1 X61.227 Y109.102 A15.8187
+G1 X61.175 Y109.056 A15.8210
+G1 X61.124 Y109.010 A15.8233
+G1 X61.074 Y108.965 A15.8255
+G1 X61.025 Y108.920 A15.8277
+G1 X60.976 Y108.876 A15.8299
+G1 X60.928 Y108.832 A15.8320
+G1 X60.880 Y108.789 A15.8342
+G1 X60.833 Y108.746 A15.8363
+G1 X60.786 Y108.703 A15.8384
+G1 X60.740 Y108.660 A15.8404
+G1 X60.694 Y108.618 A15.8425
+G1 X60.649 Y108.576 A15.8445
+G1 X60.603 Y108.534 A15.8466
+G1 X60.558 Y108.491 A15.8486
+G1 X60.514 Y108.449 A15.8506
+G1 X60.469 Y108.407 A15.8527
+G1 X60.425 Y108.365 A15.8547
+G1 X60.380 Y108.323 A15.8567
+G1 X60.336 Y108.280 A15.8588
+G1 X60.291 Y108.237 A15.8608
+G1 X60.247 Y108.194 A15.8628
+G1 X60.202 Y108.151 A15.8649
+G1 X60.157 Y108.107 A15.8670
+G1 X60.112 Y108.063 A15.8690
+G1 X60.067 Y108.019 A15.8711
+G1 X60.021 Y107.973 A15.8732
+G1 X59.975 Y107.928 A15.8754
+G1 X59.929 Y107.882 A15.8775
+G1 X59.882 Y107.835 A15.8797
+G1 X59.835 Y107.787 A15.8819
+G1 X59.787 Y107.739 A15.8842
+G1 X59.739 Y107.689 A15.8865
+G1 X59.690 Y107.639 A15.8888
+G1 X59.641 Y107.588 A15.8911
+G1 X59.591 Y107.536 A15.8935
+G1 X59.540 Y107.483 A15.8959
+G1 X59.489 Y107.429 A15.8984
+G1 X59.437 Y107.374 A15.9009
+G1 X59.385 Y107.318 A15.9034
+G1 X59.331 Y107.260 A15.9060
+G1 X59.277 Y107.202 A15.9086
+G1 X59.222 Y107.142 A15.9113
+G1 X59.166 Y107.080 A15.9140
+G1 X59.110 Y107.017 A15.9168
+G1 X59.053 Y106.953 A15.9197
+G1 X58.995 Y106.887 A15.9226
+G1 X58.936 Y106.820 A15.9255
+G1 X58.876 Y106.751 A15.9285
+G1 X58.816 Y106.680 A15.9316
+G1 X58.754 Y106.608 A15.9347
+G1 X58.692 Y106.533 A15.9379
+G1 X58.629 Y106.457 A15.9412
+G1 X58.566 Y106.380 A15.9445
+G1 X58.501 Y106.300 A15.9479
+G1 X58.436 Y106.218 A15.9513
+G1 X58.370 Y106.135 A15.9548
+G1 X58.304 Y106.049 A15.9584
+G1 X58.237 Y105.961 A15.9621
+G1 X58.169 Y105.872 A15.9658
+G1 X58.101 Y105.780 A15.9696
+G1 X58.032 Y105.685 A15.9734
+G1 X57.963 Y105.589 A15.9773
+G1 X57.894 Y105.490 A15.9813
+G1 X57.824 Y105.389 A15.9853
+G1 X57.754 Y105.286 A15.9895
+G1 X57.684 Y105.180 A15.9937
+G1 X57.614 Y105.072 A15.9979
+G1 X57.543 Y104.961 A16.0022
+G1 X57.473 Y104.848 A16.0066
+G1 X57.403 Y104.733 A16.0111
+G1 X57.334 Y104.615 A16.0156
+G1 X57.264 Y104.494 A16.0202
+G1 X57.195 Y104.371 A16.0249
+G1 X57.127 Y104.245 A16.0296
+G1 X57.059 Y104.117 A16.0344
+G1 X56.992 Y103.986 A16.0392
+G1 X56.927 Y103.852 A16.0441
+G1 X56.862 Y103.716 A16.0491
+G1 X56.798 Y103.577 A16.0542
+G1 X56.736 Y103.435 A16.0593
+G1 X56.675 Y103.291 A16.0644
+G1 X56.616 Y103.144 A16.0697
+G1 X56.558 Y102.995 A16.0749
+G1 X56.503 Y102.843 A16.0803
+G1 X56.450 Y102.688 A16.0857
+G1 X56.398 Y102.531 A16.0911
+G1 X56.349 Y102.371 A16.0967
+G1 X56.303 Y102.209 A16.1022
+G1 X56.259 Y102.044 A16.1079
+G1 X56.219 Y101.876 A16.1135
+G1 X56.181 Y101.707 A16.1193
+G1 X56.146 Y101.535 A16.1251
+G1 X56.115 Y101.360 A16.1309
+G1 X56.087 Y101.184 A16.1368
+G1 X56.063 Y101.005 A16.1428
+G1 X56.042 Y100.824 A16.1488
+G1 X56.025 Y100.641 A16.1548
+G1 X56.013 Y100.456 A16.1610
+G1 X56.004 Y100.269 A16.1671
+G1 X56.000 Y100.080 A16.1734
+G1 X56.001 Y99.890 A16.1797
+G1 X56.006 Y99.697 A16.1860
+G1 X56.015 Y99.504 A16.1924
+G1 X56.030 Y99.308 A16.1989
+G1 X56.049 Y99.112 A16.2054
+G1 X56.073 Y98.914 A16.2120
+G1 X56.102 Y98.715 A16.2186
+G1 X56.137 Y98.515 A16.2253
+G1 X56.176 Y98.314 A16.2321
+G1 X56.221 Y98.112 A16.2389
+G1 X56.271 Y97.910 A16.2458
+G1 X56.327 Y97.707 A16.2527
+G1 X56.388 Y97.503 A16.2597
+G1 X56.454 Y97.299 A16.2668
+G1 X56.525 Y97.095 A16.2739
+G1 X56.602 Y96.891 A16.2811
+G1 X56.684 Y96.687 A16.2884
+G1 X56.771 Y96.483 A16.2957
+G1 X56.864 Y96.279 A16.3031
+G1 X56.962 Y96.076 A16.3105
+G1 X57.064 Y95.873 A16.3180
+G1 X57.172 Y95.671 A16.3256
+G1 X57.285 Y95.470 A16.3332
+G1 X57.402 Y95.269 A16.3409
+G1 X57.524 Y95.070 A16.3486
+G1 X57.650 Y94.871 A16.3563
+G1 X57.781 Y94.674 A16.3642
+G1 X57.916 Y94.478 A16.3720
+G1 X58.055 Y94.283 A16.3799
+G1 X58.198 Y94.090 A16.3878
+G1 X58.345 Y93.898 A16.3958
+G1 X58.495 Y93.708 A16.4038
+G1 X58.648 Y93.520 A16.4118
+G1 X58.804 Y93.333 A16.4199
+G1 X58.964 Y93.148 A16.4279
+G1 X59.126 Y92.965 A16.4360
+G1 X59.290 Y92.784 A16.4440
+G1 X59.457 Y92.605 A16.4521
+G1 X59.625 Y92.428 A16.4602
+G1 X59.796 Y92.253 A16.4682
+G1 X59.967 Y92.080 A16.4763
+G1 X60.140 Y91.909 A16.4843
+G1 X60.315 Y91.740 A16.4923
+G1 X60.490 Y91.573 A16.5003
+G1 X60.665 Y91.409 A16.5082
+G1 X60.841 Y91.246 A16.5161
+G1 X61.017 Y91.086 A16.5240
+G1 X61.193 Y90.928 A16.5318
+G1 X61.369 Y90.772 A16.5396
+G1 X61.544 Y90.618 A16.5473
+G1 X61.719 Y90.466 A16.5549
+G1 X61.892 Y90.316 A16.5625
+G1 X62.065 Y90.168 A16.5700
+G1 X62.236 Y90.023 A16.5774
+G1 X62.406 Y89.879 A16.5847
+G1 X62.574 Y89.737 A16.5920
+G1 X62.741 Y89.597 A16.5992
+G1 X62.905 Y89.459 A16.6063
+G1 X63.067 Y89.322 A16.6132
+G1 X63.228 Y89.188 A16.6202
+G1 X63.386 Y89.055 A16.6270
+G1 X63.541 Y88.924 A16.6337
+G1 X63.694 Y88.795 A16.6403
+G1 X63.844 Y88.667 A16.6468
+G1 X63.991 Y88.541 A16.6532
+G1 X64.136 Y88.416 A16.6595
+G1 X64.277 Y88.293 A16.6657
+G1 X64.416 Y88.171 A16.6718
+G1 X64.552 Y88.051 A16.6777
+G1 X64.684 Y87.933 A16.6836
+G1 X64.814 Y87.815 A16.6894
+G1 X64.940 Y87.699 A16.6950
+G1 X65.063 Y87.584 A16.7006
+G1 X65.184 Y87.471 A16.7060
+G1 X65.300 Y87.359 A16.7114
+G1 X65.414 Y87.248 A16.7166
+G1 X65.525 Y87.138 A16.7218
+G1 X65.632 Y87.030 A16.7268
+G1 X65.736 Y86.922 A16.7318
+G1 X65.837 Y86.816 A16.7366
+G1 X65.935 Y86.711 A16.7413
+G1 X66.030 Y86.607 A16.7460
+G1 X66.122 Y86.504 A16.7505
+G1 X66.211 Y86.403 A16.7550
+G1 X66.297 Y86.302 A16.7594
+G1 X66.381 Y86.203 A16.7636
+G1 X66.461 Y86.104 A16.7678
+G1 X66.539 Y86.007 A16.7719
+G1 X66.614 Y85.911 A16.7760
+G1 X66.686 Y85.816 A16.7799
+G1 X66.756 Y85.722 A16.7838
+G1 X66.823 Y85.629 A16.7876
+G1 X66.888 Y85.537 A16.7913
+G1 X66.950 Y85.446 A16.7949
+G1 X67.010 Y85.356 A16.7985
+G1 X67.068 Y85.268 A16.8019
+G1 X67.123 Y85.180 A16.8054
+G1 X67.176 Y85.094 A16.8087
+G1 X67.228 Y85.009 A16.8120
+G1 X67.277 Y84.925 A16.8152
+G1 X67.324 Y84.842 A16.8184
+G1 X67.370 Y84.760 A16.8215
+G1 X67.414 Y84.679 A16.8245
+G1 X67.456 Y84.599 A16.8275
+G1 X67.496 Y84.521 A16.8304
+G1 X67.534 Y84.443 A16.8332
+G1 X67.572 Y84.367 A16.8360
+G1 X67.607 Y84.291 A16.8388
+G1 X67.641 Y84.217 A16.8415
+G1 X67.674 Y84.144 A16.8441
+G1 X67.706 Y84.072 A16.8467
+G1 X67.736 Y84.002 A16.8492
+G1 X67.765 Y83.932 A16.8517
+G1 X67.792 Y83.863 A16.8542
+G1 X67.819 Y83.796 A16.8566
+G1 X67.845 Y83.729 A16.8589
+G1 X67.869 Y83.663 A16.8612
+G1 X67.893 Y83.599 A16.8635
+G1 X67.915 Y83.535 A16.8657
+G1 X67.937 Y83.473 A16.8679
+G1 X67.958 Y83.411 A16.8701
+G1 X67.978 Y83.351 A16.8722
+G1 X67.997 Y83.291 A16.8742
+G1 X68.016 Y83.233 A16.8763
+G1 X68.033 Y83.175 A16.8783
+G1 X68.050 Y83.118 A16.8802
+G1 X68.067 Y83.061 A16.8822
+G1 X68.083 Y83.006 A16.8841
+G1 X68.098 Y82.952 A16.8859
+G1 X68.113 Y82.898 A16.8878
+G1 X68.127 Y82.844 A16.8896
+G1 X68.141 Y82.792 A16.8914
+G1 X68.154 Y82.740 A16.8931
+G1 X68.167 Y82.689 A16.8949
+G1 X68.179 Y82.638 A16.8966
+G1 X68.191 Y82.588 A16.8983
+G1 X68.203 Y82.538 A16.9000
+G1 X68.214 Y82.489 A16.9017
+G1 X68.225 Y82.440 A16.9033
+G1 X68.236 Y82.391 A16.9050
+G1 X68.246 Y82.343 A16.9066
+G1 X68.256 Y82.295 A16.9082
+G1 X68.266 Y82.247 A16.9098
+G1 X68.276 Y82.200 A16.9114
+G1 X68.285 Y82.152 A16.9130
+G1 X68.294 Y82.105 A16.9146
+G1 X68.303 Y82.057 A16.9162
+G1 X68.312 Y82.010 A16.9178
+G1 X68.320 Y81.962 A16.9194
+G1 X68.329 Y81.915 A16.9210
+G1 X68.337 Y81.867 A16.9226
+G1 X68.345 Y81.819 A16.9242
+G1 X68.353 Y81.770 A16.9258
+G1 X68.361 Y81.721 A16.9275
+G1 X68.368 Y81.672 A16.9291
+G1 X68.376 Y81.623 A16.9308
+G1 X68.383 Y81.572 A16.9324
+G1 X68.391 Y81.522 A16.9341
+G1 X68.398 Y81.470 A16.9358
+G1 X68.405 Y81.418 A16.9376
+G1 X68.412 Y81.365 A16.9393
+G1 X68.419 Y81.312 A16.9411
+G1 X68.426 Y81.257 A16.9429
+G1 X68.433 Y81.202 A16.9448
+G1 X68.440 Y81.145 A16.9466
+G1 X68.447 Y81.088 A16.9486
+G1 X68.453 Y81.030 A16.9505
+G1 X68.460 Y80.970 A16.9525
+G1 X68.466 Y80.909 A16.9545
+G1 X68.473 Y80.847 A16.9566
+G1 X68.479 Y80.784 A16.9587
+G1 X68.485 Y80.719 A16.9608
+G1 X68.491 Y80.653 A16.9630
+G1 X68.497 Y80.585 A16.9652
+G1 X68.503 Y80.516 A16.9675
+G1 X68.509 Y80.445 A16.9699
+G1 X68.515 Y80.372 A16.9723
+G1 X68.520 Y80.298 A16.9748
+G1 X68.526 Y80.222 A16.9773
+G1 X68.532 Y80.144 A16.9798
+G1 X68.537 Y80.064 A16.9825
+G1 X68.542 Y79.982 A16.9852
+G1 X68.547 Y79.898 A16.9880
+G1 X68.552 Y79.813 A16.9908
+G1 X68.557 Y79.725 A16.9937
+G1 X68.562 Y79.635 A16.9967
+G1 X68.566 Y79.542 A16.9997
+G1 X68.571 Y79.448 A17.0028
+G1 X68.575 Y79.351 A17.0060
+G1 X68.580 Y79.252 A17.0093
+G1 X68.584 Y79.150 A17.0127
+G1 X68.588 Y79.046 A17.0161
+G1 X68.592 Y78.939 A17.0196
+G1 X68.595 Y78.830 A17.0232
+G1 X68.599 Y78.719 A17.0269
+G1 X68.603 Y78.604 A17.0307
+G1 X68.606 Y78.487 A17.0346
+G1 X68.610 Y78.367 A17.0385
+G1 X68.613 Y78.245 A17.0426
+G1 X68.616 Y78.120 A17.0467
+G1 X68.620 Y77.992 A17.0509
+G1 X68.623 Y77.861 A17.0552
+G1 X68.626 Y77.727 A17.0597
+G1 X68.630 Y77.590 A17.0642
+G1 X68.633 Y77.451 A17.0688
+G1 X68.637 Y77.309 A17.0735
+G1 X68.641 Y77.163 A17.0783
+G1 X68.645 Y77.015 A17.0832
+G1 X68.649 Y76.864 A17.0882
+G1 X68.654 Y76.710 A17.0932
+G1 X68.659 Y76.553 A17.0984
+G1 X68.664 Y76.393 A17.1037
+G1 X68.670 Y76.230 A17.1091
+G1 X68.676 Y76.065 A17.1146
+G1 X68.683 Y75.896 A17.1201
+G1 X68.691 Y75.725 A17.1258
+G1 X68.699 Y75.551 A17.1315
+G1 X68.708 Y75.374 A17.1374
+G1 X68.719 Y75.194 A17.1433
+G1 X68.730 Y75.012 A17.1493
+G1 X68.742 Y74.827 A17.1554
+G1 X68.756 Y74.640 A17.1616
+G1 X68.770 Y74.450 A17.1679
+G1 X68.787 Y74.258 A17.1743
+G1 X68.804 Y74.064 A17.1807
+G1 X68.824 Y73.868 A17.1872
+G1 X68.845 Y73.669 A17.1938
+G1 X68.867 Y73.468 A17.2005
+G1 X68.892 Y73.266 A17.2072
+G1 X68.919 Y73.062 A17.2140
+G1 X68.948 Y72.856 A17.2209
+G1 X68.980 Y72.649 A17.2278
+G1 X69.013 Y72.440 A17.2347
+G1 X69.050 Y72.231 A17.2418
+G1 X69.089 Y72.020 A17.2488
+G1 X69.131 Y71.808 A17.2560
+G1 X69.175 Y71.596 A17.2631
+G1 X69.223 Y71.383 A17.2703
+G1 X69.274 Y71.170 A17.2776
+G1 X69.328 Y70.956 A17.2848
+G1 X69.386 Y70.743 A17.2921
+G1 X69.447 Y70.530 A17.2994
+G1 X69.512 Y70.317 A17.3068
+G1 X69.580 Y70.104 A17.3142
+G1 X69.652 Y69.893 A17.3215
+G1 X69.728 Y69.682 A17.3289
+G1 X69.808 Y69.473 A17.3363
+G1 X69.892 Y69.265 A17.3437
+G1 X69.980 Y69.058 A17.3511
+G1 X70.072 Y68.853 A17.3585
+G1 X70.169 Y68.651 A17.3659
+G1 X70.269 Y68.450 A17.3734
+G1 X70.374 Y68.252 A17.3808
+G1 X70.484 Y68.056 A17.3881
+G1 X70.597 Y67.863 A17.3955
+G1 X70.715 Y67.673 A17.4029
+G1 X70.838 Y67.487 A17.4103
+G1 X70.964 Y67.303 A17.4176
+G1 X71.095 Y67.123 A17.4250
+G1 X71.231 Y66.947 A17.4323
+G1 X71.370 Y66.774 A17.4397
+G1 X71.514 Y66.605 A17.4470
+G1 X71.662 Y66.441 A17.4543
+G1 X71.814 Y66.281 A17.4616
+G1 X71.970 Y66.125 A17.4688
+G1 X72.130 Y65.973 A17.4761
+G1 X72.294 Y65.826 A17.4834
+G1 X72.462 Y65.684 A17.4906
+G1 X72.633 Y65.547 A17.4979
+G1 X72.808 Y65.414 A17.5051
+G1 X72.987 Y65.286 A17.5124
+G1 X73.168 Y65.163 A17.5196
+G1 X73.353 Y65.045 A17.5268
+G1 X73.540 Y64.933 A17.5341
+G1 X73.731 Y64.825 A17.5413
+G1 X73.924 Y64.722 A17.5485
+G1 X74.120 Y64.624 A17.5557
+G1 X74.318 Y64.532 A17.5629
+G1 X74.518 Y64.444 A17.5701
+G1 X74.720 Y64.362 A17.5773
+G1 X74.924 Y64.284 A17.5845
+G1 X75.130 Y64.211 A17.5917
+G1 X75.337 Y64.143 A17.5989
+G1 X75.545 Y64.080 A17.6061
+G1 X75.755 Y64.021 A17.6133
+G1 X75.965 Y63.967 A17.6205
+G1 X76.176 Y63.917 A17.6276
+G1 X76.388 Y63.872 A17.6348
+G1 X76.600 Y63.831 A17.6419
+G1 X76.813 Y63.795 A17.6490
+G1 X77.025 Y63.762 A17.6561
+G1 X77.237 Y63.733 A17.6632
+G1 X77.450 Y63.708 A17.6702
+G1 X77.661 Y63.687 A17.6773
+G1 X77.872 Y63.669 A17.6842
+G1 X78.082 Y63.654 A17.6912
+G1 X78.292 Y63.643 A17.6981
+G1 X78.500 Y63.635 A17.7050
+G1 X78.707 Y63.630 A17.7118
+G1 X78.913 Y63.627 A17.7186
+G1 X79.117 Y63.627 A17.7254
+G1 X79.320 Y63.630 A17.7321
+G1 X79.521 Y63.635 A17.7387
+G1 X79.720 Y63.642 A17.7453
+G1 X79.917 Y63.652 A17.7518
+G1 X80.113 Y63.663 A17.7582
+G1 X80.306 Y63.676 A17.7646
+G1 X80.497 Y63.691 A17.7710
+G1 X80.686 Y63.707 A17.7772
+G1 X80.873 Y63.725 A17.7834
+G1 X81.057 Y63.744 A17.7895
+G1 X81.238 Y63.764 A17.7955
+G1 X81.417 Y63.785 A17.8015
+G1 X81.594 Y63.807 A17.8074
+G1 X81.768 Y63.830 A17.8132
+G1 X81.939 Y63.854 A17.8189
+G1 X82.108 Y63.878 A17.8245
+G1 X82.274 Y63.903 A17.8300
+G1 X82.437 Y63.928 A17.8355
+G1 X82.597 Y63.953 A17.8408
+G1 X82.755 Y63.979 A17.8461
+G1 X82.909 Y64.005 A17.8513
+G1 X83.061 Y64.032 A17.8564
+G1 X83.210 Y64.058 A17.8614
+G1 X83.357 Y64.084 A17.8663
+G1 X83.500 Y64.110 A17.8711
+G1 X83.641 Y64.136 A17.8758
+G1 X83.779 Y64.162 A17.8804
+G1 X83.914 Y64.188 A17.8850
+G1 X84.047 Y64.214 A17.8894
+G1 X84.176 Y64.239 A17.8938
+G1 X84.303 Y64.264 A17.8980
+G1 X84.427 Y64.288 A17.9022
+G1 X84.549 Y64.312 A17.9063
+G1 X84.668 Y64.336 A17.9103
+G1 X84.785 Y64.359 A17.9142
+G1 X84.898 Y64.382 A17.9181
+G1 X85.010 Y64.405 A17.9218
+G1 X85.119 Y64.427 A17.9255
+G1 X85.225 Y64.448 A17.9291
+G1 X85.329 Y64.469 A17.9326
+G1 X85.431 Y64.490 A17.9360
+G1 X85.530 Y64.510 A17.9393
+G1 X85.627 Y64.529 A17.9426
+G1 X85.722 Y64.548 A17.9458
+G1 X85.814 Y64.567 A17.9489
+G1 X85.905 Y64.585 A17.9520
+G1 X85.993 Y64.602 A17.9549
+G1 X86.080 Y64.619 A17.9578
+G1 X86.164 Y64.636 A17.9607
+G1 X86.247 Y64.652 A17.9634
+G1 X86.327 Y64.668 A17.9662
+G1 X86.406 Y64.683 A17.9688
+G1 X86.483 Y64.698 A17.9714
+G1 X86.558 Y64.712 A17.9739
+G1 X86.632 Y64.726 A17.9764
+G1 X86.704 Y64.739 A17.9788
+G1 X86.775 Y64.752 A17.9812
+G1 X86.844 Y64.765 A17.9835
+G1 X86.911 Y64.777 A17.9858
+G1 X86.978 Y64.789 A17.9880
+G1 X87.043 Y64.801 A17.9902
+G1 X87.106 Y64.812 A17.9923
+G1 X87.169 Y64.823 A17.9944
+G1 X87.230 Y64.834 A17.9965
+G1 X87.291 Y64.844 A17.9985
+G1 X87.350 Y64.854 A18.0005
+G1 X87.408 Y64.864 A18.0024
+G1 X87.466 Y64.873 A18.0043
+G1 X87.522 Y64.883 A18.0062
+G1 X87.578 Y64.892 A18.0081
+G1 X87.633 Y64.900 A18.0099
+G1 X87.688 Y64.909 A18.0118
+G1 X87.742 Y64.917 A18.0136
+G1 X87.795 Y64.925 A18.0153
+G1 X87.848 Y64.933 A18.0171
+G1 X87.900 Y64.941 A18.0189
+G1 X87.952 Y64.949 A18.0206
+G1 X88.004 Y64.956 A18.0223
+G1 X88.056 Y64.963 A18.0240
+G1 X88.107 Y64.970 A18.0257
+G1 X88.158 Y64.977 A18.0274
+G1 X88.209 Y64.984 A18.0291
+G1 X88.260 Y64.991 A18.0308
+G1 X88.311 Y64.997 A18.0325
+G1 X88.362 Y65.003 A18.0342
+G1 X88.414 Y65.010 A18.0359
+G1 X88.465 Y65.016 A18.0377
+G1 X88.517 Y65.022 A18.0394
+G1 X88.569 Y65.028 A18.0411
+G1 X88.621 Y65.033 A18.0428
+G1 X88.674 Y65.039 A18.0446
+G1 X88.727 Y65.045 A18.0464
+G1 X88.781 Y65.050 A18.0481
+G1 X88.835 Y65.055 A18.0499
+G1 X88.890 Y65.060 A18.0518
+G1 X88.946 Y65.065 A18.0536
+G1 X89.002 Y65.070 A18.0555
+G1 X89.059 Y65.075 A18.0573
+G1 X89.116 Y65.079 A18.0592
+G1 X89.175 Y65.083 A18.0612
+G1 X89.234 Y65.087 A18.0631
+G1 X89.294 Y65.091 A18.0651
+G1 X89.355 Y65.095 A18.0671
+G1 X89.417 Y65.098 A18.0692
+G1 X89.480 Y65.102 A18.0713
+G1 X89.544 Y65.104 A18.0734
+G1 X89.610 Y65.107 A18.0756
+G1 X89.676 Y65.109 A18.0777
+G1 X89.743 Y65.111 A18.0800
+G1 X89.812 Y65.113 A18.0822
+G1 X89.881 Y65.114 A18.0845
+G1 X89.952 Y65.114 A18.0869
+G1 X90.024 Y65.115 A18.0892
+G1 X90.098 Y65.114 A18.0917
+G1 X90.172 Y65.113 A18.0941
+G1 X90.248 Y65.112 A18.0966
+G1 X90.326 Y65.110 A18.0992
+G1 X90.404 Y65.107 A18.1018
+G1 X90.484 Y65.104 A18.1044
+G1 X90.565 Y65.100 A18.1071
+G1 X90.648 Y65.095 A18.1098
+G1 X90.732 Y65.089 A18.1126
+G1 X90.817 Y65.083 A18.1154
+G1 X90.904 Y65.075 A18.1183
+G1 X90.992 Y65.066 A18.1212
+G1 X91.082 Y65.057 A18.1242
+G1 X91.173 Y65.046 A18.1272
+G1 X91.266 Y65.034 A18.1303
+G1 X91.359 Y65.020 A18.1335
+G1 X91.455 Y65.006 A18.1366
+G1 X91.552 Y64.990 A18.1399
+G1 X91.650 Y64.972 A18.1432
+G1 X91.750 Y64.953 A18.1465
+G1 X91.851 Y64.933 A18.1499
+G1 X91.953 Y64.911 A18.1534
+G1 X92.058 Y64.887 A18.1569
+G1 X92.163 Y64.861 A18.1605
+G1 X92.270 Y64.833 A18.1641
+G1 X92.379 Y64.804 A18.1679
+G1 X92.488 Y64.772 A18.1716
+G1 X92.600 Y64.738 A18.1755
+G1 X92.713 Y64.702 A18.1794
+G1 X92.827 Y64.664 A18.1834
+G1 X92.943 Y64.623 A18.1874
+G1 X93.060 Y64.580 A18.1915
+G1 X93.179 Y64.535 A18.1957
+G1 X93.300 Y64.486 A18.2000
+G1 X93.421 Y64.436 A18.2044
+G1 X93.545 Y64.382 A18.2088
+G1 X93.670 Y64.326 A18.2133
+G1 X93.796 Y64.268 A18.2179
+G1 X93.924 Y64.206 A18.2226
+G1 X94.054 Y64.141 A18.2274
+G1 X94.185 Y64.074 A18.2323
+G1 X94.318 Y64.003 A18.2372
+G1 X94.452 Y63.930 A18.2423
+G1 X94.588 Y63.853 A18.2474
+G1 X94.726 Y63.774 A18.2527
+G1 X94.865 Y63.691 A18.2580
+G1 X95.006 Y63.605 A18.2635
+G1 X95.149 Y63.517 A18.2690
+G1 X95.293 Y63.425 A18.2747
+G1 X95.439 Y63.330 A18.2804
+G1 X95.587 Y63.232 A18.2863
+G1 X95.737 Y63.131 A18.2922
+G1 X95.889 Y63.027 A18.2983
+G1 X96.042 Y62.920 A18.3045
+G1 X96.198 Y62.811 A18.3107
+G1 X96.355 Y62.699 A18.3171
+G1 X96.514 Y62.584 A18.3236
+G1 X96.675 Y62.466 A18.3302
+G1 X96.839 Y62.346 A18.3369
+G1 X97.004 Y62.223 A18.3437
+G1 X97.171 Y62.098 A18.3505
+G1 X97.340 Y61.971 A18.3575
+G1 X97.511 Y61.842 A18.3646
+G1 X97.684 Y61.712 A18.3717
+G1 X97.859 Y61.579 A18.3790
+G1 X98.036 Y61.445 A18.3863
+G1 X98.216 Y61.309 A18.3938
+G1 X98.397 Y61.172 A18.4012
+G1 X98.580 Y61.035 A18.4088
+G1 X98.766 Y60.896 A18.4165
+G1 X98.953 Y60.757 A18.4242
+G1 X99.142 Y60.617 A18.4319
+G1 X99.334 Y60.477 A18.4397
+G1 X99.527 Y60.337 A18.4476
+G1 X99.722 Y60.197 A18.4555
+G1 X99.919 Y60.057 A18.4635
+G1 X100.117 Y59.918 A18.4715
+G1 X100.318 Y59.780 A18.4795
+G1 X100.520 Y59.643 A18.4876
+G1 X100.724 Y59.507 A18.4957
+G1 X100.929 Y59.373 A18.5038
+G1 X101.136 Y59.241 A18.5119
+G1 X101.344 Y59.110 A18.5200
+G1 X101.554 Y58.982 A18.5281
+G1 X101.764 Y58.856 A18.5362
+G1 X101.976 Y58.732 A18.5443
+G1 X102.189 Y58.612 A18.5524
+G1 X102.403 Y58.494 A18.5604
+G1 X102.618 Y58.379 A18.5685
+G1 X102.834 Y58.268 A18.5765
+G1 X103.050 Y58.160 A18.5844
+G1 X103.267 Y58.056 A18.5924
+G1 X103.484 Y57.956 A18.6003
+G1 X103.701 Y57.860 A18.6081
+G1 X103.919 Y57.768 A18.6159
+G1 X104.137 Y57.680 A18.6237
+G1 X104.354 Y57.597 A18.6314
+G1 X104.572 Y57.518 A18.6390
+G1 X104.789 Y57.443 A18.6466
+G1 X105.005 Y57.373 A18.6541
+G1 X105.221 Y57.308 A18.6615
+G1 X105.437 Y57.248 A18.6689
+G1 X105.651 Y57.192 A18.6762
+G1 X105.865 Y57.141 A18.6834
+G1 X106.077 Y57.095 A18.6906
+G1 X106.288 Y57.054 A18.6977
+G1 X106.498 Y57.018 A18.7047
+G1 X106.706 Y56.987 A18.7117
+G1 X106.913 Y56.960 A18.7186
+G1 X107.119 Y56.939 A18.7254
+G1 X107.322 Y56.922 A18.7321
+G1 X107.524 Y56.909 A18.7388
+G1 X107.723 Y56.902 A18.7454
+G1 X107.921 Y56.899 A18.7519
+G1 X108.116 Y56.900 A18.7584
+G1 X108.309 Y56.906 A18.7647
+G1 X108.500 Y56.916 A18.7710
+G1 X108.689 Y56.930 A18.7773
+G1 X108.875 Y56.949 A18.7835
+G1 X109.058 Y56.971 A18.7896
+G1 X109.239 Y56.997 A18.7956
+G1 X109.418 Y57.027 A18.8016
+G1 X109.593 Y57.061 A18.8075
+G1 X109.766 Y57.098 A18.8133
+G1 X109.936 Y57.138 A18.8191
+G1 X110.104 Y57.181 A18.8248
+G1 X110.268 Y57.228 A18.8304
+G1 X110.430 Y57.277 A18.8360
+G1 X110.588 Y57.329 A18.8415
+G1 X110.744 Y57.383 A18.8469
+G1 X110.897 Y57.440 A18.8523
+G1 X111.047 Y57.500 A18.8576
+G1 X111.194 Y57.561 A18.8629
+G1 X111.338 Y57.624 A18.8681
+G1 X111.479 Y57.690 A18.8732
+G1 X111.618 Y57.757 A18.8783
+G1 X111.753 Y57.825 A18.8833
+G1 X111.886 Y57.895 A18.8882
+G1 X112.015 Y57.966 A18.8931
+G1 X112.142 Y58.038 A18.8979
+G1 X112.266 Y58.112 A18.9027
+G1 X112.387 Y58.186 A18.9074
+G1 X112.505 Y58.261 A18.9120
+G1 X112.621 Y58.337 A18.9166
+G1 X112.734 Y58.413 A18.9211
+G1 X112.844 Y58.490 A18.9255
+G1 X112.951 Y58.567 A18.9299
+G1 X113.056 Y58.644 A18.9341
+G1 X113.159 Y58.721 A18.9384
+G1 X113.258 Y58.799 A18.9426
+G1 X113.356 Y58.876 A18.9467
+G1 X113.451 Y58.953 A18.9507
+G1 X113.543 Y59.030 A18.9547
+G1 X113.633 Y59.107 A18.9586
+G1 X113.721 Y59.183 A18.9624
+G1 X113.807 Y59.259 A18.9662
+G1 X113.890 Y59.335 A18.9699
+G1 X113.972 Y59.410 A18.9736
+G1 X114.051 Y59.484 A18.9771
+G1 X114.128 Y59.558 A18.9807
+G1 X114.203 Y59.631 A18.9841
+G1 X114.276 Y59.703 A18.9875
+G1 X114.347 Y59.775 A18.9908
+G1 X114.417 Y59.846 A18.9941
+G1 X114.484 Y59.916 A18.9973
+G1 X114.550 Y59.985 A19.0005
+G1 X114.614 Y60.054 A19.0036
+G1 X114.677 Y60.122 A19.0066
+G1 X114.738 Y60.188 A19.0096
+G1 X114.797 Y60.254 A19.0125
+G1 X114.855 Y60.319 A19.0154
+G1 X114.911 Y60.383 A19.0182
+G1 X114.966 Y60.447 A19.0210
+G1 X115.020 Y60.509 A19.0237
+G1 X115.072 Y60.571 A19.0264
+G1 X115.123 Y60.632 A19.0290
+G1 X115.173 Y60.692 A19.0316
+G1 X115.221 Y60.751 A19.0341
+G1 X115.269 Y60.810 A19.0366
+G1 X115.316 Y60.867 A19.0390
+G1 X115.361 Y60.924 A19.0414
+G1 X115.406 Y60.981 A19.0438
+G1 X115.449 Y61.036 A19.0461
+G1 X115.492 Y61.091 A19.0484
+G1 X115.534 Y61.146 A19.0507
+G1 X115.575 Y61.199 A19.0529
+G1 X115.615 Y61.253 A19.0552
+G1 X115.655 Y61.306 A19.0573
+G1 X115.694 Y61.358 A19.0595
+G1 X115.733 Y61.410 A19.0616
+G1 X115.771 Y61.461 A19.0637
+G1 X115.808 Y61.513 A19.0658
+G1 X115.845 Y61.564 A19.0679
+G1 X115.882 Y61.614 A19.0700
+G1 X115.918 Y61.665 A19.0720
+G1 X115.954 Y61.715 A19.0741
+G1 X115.989 Y61.766 A19.0761
+G1 X116.024 Y61.816 A19.0781
+G1 X116.059 Y61.867 A19.0801
+G1 X116.094 Y61.917 A19.0822
+G1 X116.129 Y61.968 A19.0842
+G1 X116.163 Y62.018 A19.0862
+G1 X116.198 Y62.069 A19.0883
+G1 X116.232 Y62.120 A19.0903
+G1 X116.267 Y62.172 A19.0923
+G1 X116.302 Y62.224 A19.0944
+G1 X116.336 Y62.276 A19.0965
+G1 X116.371 Y62.329 A19.0986
+G1 X116.406 Y62.383 A19.1007
+G1 X116.441 Y62.437 A19.1028
+G1 X116.476 Y62.492 A19.1049
+G1 X116.512 Y62.547 A19.1071
+G1 X116.548 Y62.603 A19.1093
+G1 X116.584 Y62.660 A19.1116
+G1 X116.620 Y62.718 A19.1138
+G1 X116.657 Y62.777 A19.1161
+G1 X116.694 Y62.837 A19.1184
+G1 X116.732 Y62.898 A19.1208
+G1 X116.770 Y62.960 A19.1232
+G1 X116.808 Y63.023 A19.1256
+G1 X116.847 Y63.088 A19.1281
+G1 X116.887 Y63.153 A19.1306
+G1 X116.927 Y63.220 A19.1332
+G1 X116.967 Y63.288 A19.1358
+G1 X117.009 Y63.358 A19.1385
+G1 X117.050 Y63.429 A19.1412
+G1 X117.093 Y63.501 A19.1440
+G1 X117.136 Y63.575 A19.1468
+G1 X117.179 Y63.651 A19.1497
+G1 X117.223 Y63.728 A19.1526
+G1 X117.268 Y63.807 A19.1556
+G1 X117.314 Y63.887 A19.1587
+G1 X117.360 Y63.969 A19.1618
+G1 X117.407 Y64.053 A19.1649
+G1 X117.454 Y64.139 A19.1682
+G1 X117.502 Y64.226 A19.1715
+G1 X117.551 Y64.315 A19.1748
+G1 X117.601 Y64.406 A19.1782
+G1 X117.652 Y64.499 A19.1817
+G1 X117.703 Y64.594 A19.1853
+G1 X117.755 Y64.690 A19.1889
+G1 X117.807 Y64.789 A19.1926
+G1 X117.861 Y64.889 A19.1963
+G1 X117.915 Y64.991 A19.2001
+G1 X117.969 Y65.095 A19.2040
+G1 X118.025 Y65.201 A19.2080
+G1 X118.081 Y65.309 A19.2120
+G1 X118.138 Y65.419 A19.2161
+G1 X118.196 Y65.530 A19.2202
+G1 X118.255 Y65.643 A19.2244
+G1 X118.314 Y65.759 A19.2287
+G1 X118.375 Y65.876 A19.2330
+G1 X118.436 Y65.994 A19.2374
+G1 X118.497 Y66.115 A19.2419
+G1 X118.560 Y66.237 A19.2464
+G1 X118.623 Y66.360 A19.2510
+G1 X118.688 Y66.485 A19.2557
+G1 X118.753 Y66.612 A19.2604
+G1 X118.819 Y66.740 A19.2651
+G1 X118.885 Y66.870 A19.2699
+G1 X118.953 Y67.000 A19.2748
+G1 X119.021 Y67.132 A19.2797
+G1 X119.091 Y67.266 A19.2846
+G1 X119.161 Y67.400 A19.2896
+G1 X119.233 Y67.535 A19.2947
+G1 X119.305 Y67.671 A19.2998
+G1 X119.379 Y67.808 A19.3049
+G1 X119.453 Y67.946 A19.3101
+G1 X119.529 Y68.084 A19.3153
+G1 X119.605 Y68.223 A19.3205
+G1 X119.683 Y68.362 A19.3258
+G1 X119.763 Y68.502 A19.3311
+G1 X119.843 Y68.641 A19.3364
+G1 X119.925 Y68.781 A19.3417
+G1 X120.008 Y68.921 A19.3471
+G1 X120.093 Y69.060 A19.3525
+G1 X120.179 Y69.199 A19.3579
+G1 X120.266 Y69.338 A19.3633
+G1 X120.355 Y69.477 A19.3687
+G1 X120.446 Y69.614 A19.3742
+G1 X120.539 Y69.751 A19.3796
+G1 X120.633 Y69.887 A19.3851
+G1 X120.730 Y70.022 A19.3906
+G1 X120.828 Y70.156 A19.3960
+G1 X120.928 Y70.289 A19.4015
+G1 X121.031 Y70.420 A19.4070
+G1 X121.135 Y70.550 A19.4125
+G1 X121.242 Y70.678 A19.4180
+G1 X121.351 Y70.805 A19.4236
+G1 X121.463 Y70.930 A19.4291
+G1 X121.577 Y71.053 A19.4346
+G1 X121.693 Y71.174 A19.4402
+G1 X121.812 Y71.293 A19.4457
+G1 X121.934 Y71.410 A19.4513
+G1 X122.059 Y71.525 A19.4569
+G1 X122.186 Y71.638 A19.4625
+G1 X122.316 Y71.749 A19.4681
+G1 X122.449 Y71.857 A19.4738
+G1 X122.585 Y71.963 A19.4795
+G1 X122.724 Y72.067 A19.4852
+G1 X122.866 Y72.168 A19.4910
+G1 X123.011 Y72.267 A19.4968
+G1 X123.160 Y72.363 A19.5026
+G1 X123.311 Y72.457 A19.5085
+G1 X123.465 Y72.549 A19.5144
+G1 X123.623 Y72.639 A19.5204
+G1 X123.784 Y72.726 A19.5264
+G1 X123.948 Y72.811 A19.5325
+G1 X124.115 Y72.893 A19.5387
+G1 X124.285 Y72.974 A19.5449
+G1 X124.458 Y73.052 A19.5511
+G1 X124.634 Y73.128 A19.5575
+G1 X124.813 Y73.202 A19.5639
+G1 X124.996 Y73.275 A19.5704
+G1 X125.181 Y73.345 A19.5769
+G1 X125.368 Y73.414 A19.5835
+G1 X125.559 Y73.481 A19.5902
+G1 X125.752 Y73.546 A19.5969
+G1 X125.948 Y73.610 A19.6037
+G1 X126.146 Y73.673 A19.6105
+G1 X126.346 Y73.735 A19.6175
+G1 X126.549 Y73.795 A19.6244
+G1 X126.754 Y73.854 A19.6315
+G1 X126.960 Y73.913 A19.6386
+G1 X127.169 Y73.970 A19.6457
+G1 X127.379 Y74.027 A19.6529
+G1 X127.590 Y74.084 A19.6601
+G1 X127.803 Y74.140 A19.6674
+G1 X128.017 Y74.195 A19.6747
+G1 X128.233 Y74.251 A19.6820
+G1 X128.449 Y74.306 A19.6894
+G1 X128.665 Y74.361 A19.6967
+G1 X128.882 Y74.417 A19.7041
+G1 X129.100 Y74.472 A19.7115
+G1 X129.318 Y74.528 A19.7190
+G1 X129.535 Y74.584 A19.7264
+G1 X129.753 Y74.641 A19.7338
+G1 X129.970 Y74.698 A19.7412
+G1 X130.186 Y74.755 A19.7486
+G1 X130.402 Y74.814 A19.7560
+G1 X130.617 Y74.873 A19.7633
+G1 X130.831 Y74.933 A19.7706
+G1 X131.044 Y74.993 A19.7779
+G1 X131.255 Y75.055 A19.7852
+G1 X131.465 Y75.117 A19.7924
+G1 X131.673 Y75.181 A19.7996
+G1 X131.879 Y75.245 A19.8067
+G1 X132.083 Y75.311 A19.8138
+G1 X132.285 Y75.377 A19.8208
+G1 X132.485 Y75.444 A19.8278
+G1 X132.683 Y75.512 A19.8347
+G1 X132.878 Y75.582 A19.8415
+G1 X133.070 Y75.652 A19.8483
+G1 X133.260 Y75.723 A19.8550
+G1 X133.447 Y75.796 A19.8616
+G1 X133.631 Y75.869 A19.8681
+G1 X133.812 Y75.943 A19.8746
+G1 X133.990 Y76.018 A19.8810
+G1 X134.165 Y76.094 A19.8872
+G1 X134.337 Y76.170 A19.8935
+G1 X134.505 Y76.247 A19.8996
+G1 X134.671 Y76.325 A19.9056
+G1 X134.833 Y76.404 A19.9115
+G1 X134.991 Y76.483 A19.9174
+G1 X135.146 Y76.563 A19.9232
+G1 X135.298 Y76.644 A19.9288
+G1 X135.447 Y76.724 A19.9344
+G1 X135.592 Y76.805 A19.9399
+G1 X135.733 Y76.887 A19.9453
+G1 X135.871 Y76.969 A19.9506
+G1 X136.006 Y77.051 A19.9558
+G1 X136.137 Y77.133 A19.9609
+G1 X136.265 Y77.215 A19.9659
+G1 X136.390 Y77.297 A19.9708
+G1 X136.511 Y77.379 A19.9757
+G1 X136.629 Y77.461 A19.9804
+G1 X136.744 Y77.543 A19.9850
+G1 X136.855 Y77.625 A19.9896
+G1 X136.964 Y77.706 A19.9941
+G1 X137.069 Y77.787 A19.9985
+G1 X137.171 Y77.868 A20.0028
+G1 X137.270 Y77.948 A20.0070
+G1 X137.366 Y78.028 A20.0111
+G1 X137.459 Y78.108 A20.0151
+G1 X137.550 Y78.186 A20.0191
+G1 X137.637 Y78.265 A20.0230
+G1 X137.722 Y78.342 A20.0268
+G1 X137.804 Y78.419 A20.0305
+G1 X137.884 Y78.495 A20.0341
+G1 X137.961 Y78.571 A20.0377
+G1 X138.035 Y78.646 A20.0411
+G1 X138.107 Y78.719 A20.0446
+G1 X138.177 Y78.793 A20.0479
+G1 X138.245 Y78.865 A20.0512
+G1 X138.310 Y78.936 A20.0544
+G1 X138.373 Y79.007 A20.0575
+G1 X138.434 Y79.077 A20.0605
+G1 X138.493 Y79.146 A20.0635
+G1 X138.550 Y79.214 A20.0665
+G1 X138.605 Y79.281 A20.0693
+G1 X138.659 Y79.347 A20.0721
+G1 X138.710 Y79.412 A20.0749
+G1 X138.760 Y79.477 A20.0776
+G1 X138.808 Y79.540 A20.0802
+G1 X138.855 Y79.603 A20.0828
+G1 X138.900 Y79.665 A20.0853
+G1 X138.944 Y79.726 A20.0878
+G1 X138.986 Y79.786 A20.0902
+G1 X139.027 Y79.846 A20.0926
+G1 X139.067 Y79.904 A20.0949
+G1 X139.105 Y79.962 A20.0972
+G1 X139.143 Y80.019 A20.0995
+G1 X139.179 Y80.076 A20.1017
+G1 X139.214 Y80.131 A20.1039
+G1 X139.248 Y80.186 A20.1060
+G1 X139.281 Y80.241 A20.1081
+G1 X139.313 Y80.294 A20.1102
+G1 X139.344 Y80.348 A20.1122
+G1 X139.375 Y80.400 A20.1142
+G1 X139.405 Y80.453 A20.1162
+G1 X139.433 Y80.504 A20.1181
+G1 X139.462 Y80.556 A20.1201
+G1 X139.489 Y80.607 A20.1220
+G1 X139.516 Y80.658 A20.1239
+G1 X139.542 Y80.708 A20.1258
+G1 X139.568 Y80.758 A20.1276
+G1 X139.593 Y80.808 A20.1295
+G1 X139.618 Y80.858 A20.1313
+G1 X139.642 Y80.908 A20.1332
+G1 X139.666 Y80.958 A20.1350
+G1 X139.689 Y81.008 A20.1368
+G1 X139.713 Y81.058 A20.1386
+G1 X139.735 Y81.108 A20.1404
+G1 X139.758 Y81.159 A20.1422
+G1 X139.780 Y81.209 A20.1441
+G1 X139.801 Y81.260 A20.1459
+G1 X139.823 Y81.311 A20.1477
+G1 X139.844 Y81.363 A20.1496
+G1 X139.865 Y81.415 A20.1514
+G1 X139.886 Y81.467 A20.1533
+G1 X139.907 Y81.521 A20.1552
+G1 X139.927 Y81.574 A20.1571
+G1 X139.947 Y81.629 A20.1590
+G1 X139.967 Y81.684 A20.1609
+G1 X139.987 Y81.740 A20.1629
+G1 X140.007 Y81.797 A20.1649
+G1 X140.027 Y81.855 A20.1669
+G1 X140.046 Y81.914 A20.1689
+G1 X140.065 Y81.974 A20.1710
+G1 X140.085 Y82.035 A20.1731
+G1 X140.104 Y82.097 A20.1753
+G1 X140.122 Y82.160 A20.1775
+G1 X140.141 Y82.225 A20.1797
+G1 X140.159 Y82.291 A20.1819
+G1 X140.178 Y82.358 A20.1842
+G1 X140.196 Y82.427 A20.1866
+G1 X140.213 Y82.498 A20.1890
+G1 X140.231 Y82.570 A20.1914
+G1 X140.248 Y82.643 A20.1939
+G1 X140.265 Y82.718 A20.1965
+G1 X140.282 Y82.795 A20.1991
+G1 X140.298 Y82.874 A20.2017
+G1 X140.314 Y82.954 A20.2044
+G1 X140.329 Y83.037 A20.2072
+G1 X140.344 Y83.121 A20.2100
+G1 X140.358 Y83.208 A20.2129
+G1 X140.372 Y83.296 A20.2159
+G1 X140.385 Y83.386 A20.2189
+G1 X140.398 Y83.479 A20.2220
+G1 X140.410 Y83.574 A20.2251
+G1 X140.421 Y83.671 A20.2283
+G1 X140.431 Y83.770 A20.2316
+G1 X140.441 Y83.871 A20.2350
+G1 X140.449 Y83.975 A20.2384
+G1 X140.457 Y84.081 A20.2419
+G1 X140.464 Y84.190 A20.2455
+G1 X140.469 Y84.301 A20.2492
+G1 X140.474 Y84.414 A20.2529
+G1 X140.477 Y84.530 A20.2568
+G1 X140.479 Y84.649 A20.2607
+G1 X140.479 Y84.770 A20.2647
+G1 X140.478 Y84.893 A20.2687
+G1 X140.476 Y85.020 A20.2729
+G1 X140.472 Y85.148 A20.2772
+G1 X140.467 Y85.280 A20.2815
+G1 X140.460 Y85.413 A20.2859
+G1 X140.451 Y85.550 A20.2904
+G1 X140.440 Y85.689 A20.2950
+G1 X140.427 Y85.831 A20.2997
+G1 X140.413 Y85.975 A20.3045
+G1 X140.396 Y86.122 A20.3094
+G1 X140.378 Y86.271 A20.3144
+G1 X140.357 Y86.423 A20.3194
+G1 X140.334 Y86.578 A20.3246
+G1 X140.309 Y86.735 A20.3298
+G1 X140.282 Y86.894 A20.3352
+G1 X140.252 Y87.056 A20.3406
+G1 X140.220 Y87.220 A20.3461
+G1 X140.185 Y87.387 A20.3517
+G1 X140.149 Y87.556 A20.3574
+G1 X140.109 Y87.727 A20.3632
+G1 X140.067 Y87.901 A20.3691
+G1 X140.023 Y88.076 A20.3751
+G1 X139.976 Y88.254 A20.3812
+G1 X139.927 Y88.434 A20.3873
+G1 X139.875 Y88.615 A20.3935
+G1 X139.821 Y88.799 A20.3999
+G1 X139.764 Y88.984 A20.4063
+G1 X139.705 Y89.171 A20.4127
+G1 X139.643 Y89.360 A20.4193
+G1 X139.579 Y89.551 A20.4259
+G1 X139.513 Y89.742 A20.4326
+G1 X139.444 Y89.936 A20.4394
+G1 X139.373 Y90.130 A20.4462
+G1 X139.300 Y90.326 A20.4531
+G1 X139.225 Y90.523 A20.4601
+G1 X139.148 Y90.721 A20.4671
+G1 X139.069 Y90.920 A20.4742
+G1 X138.989 Y91.120 A20.4813
+G1 X138.906 Y91.320 A20.4884
+G1 X138.822 Y91.521 A20.4956
+G1 X138.737 Y91.723 A20.5028
+G1 X138.650 Y91.925 A20.5101
+G1 X138.563 Y92.128 A20.5174
+G1 X138.474 Y92.331 A20.5247
+G1 X138.384 Y92.534 A20.5320
+G1 X138.294 Y92.737 A20.5393
+G1 X138.203 Y92.940 A20.5467
+G1 X138.112 Y93.143 A20.5540
+G1 X138.021 Y93.346 A20.5614
+G1 X137.929 Y93.548 A20.5687
+G1 X137.838 Y93.751 A20.5760
+G1 X137.747 Y93.953 A20.5833
+G1 X137.657 Y94.154 A20.5906
+G1 X137.567 Y94.355 A20.5979
+G1 X137.479 Y94.555 A20.6051
+G1 X137.391 Y94.755 A20.6123
+G1 X137.305 Y94.954 A20.6195
+G1 X137.220 Y95.152 A20.6266
+G1 X137.137 Y95.349 A20.6336
+G1 X137.056 Y95.546 A20.6407
+G1 X136.976 Y95.741 A20.6476
+G1 X136.899 Y95.936 A20.6545
+G1 X136.824 Y96.130 A20.6614
+G1 X136.752 Y96.323 A20.6682
+G1 X136.682 Y96.515 A20.6749
+G1 X136.616 Y96.706 A20.6816
+G1 X136.552 Y96.896 A20.6882
+G1 X136.491 Y97.084 A20.6948
+G1 X136.433 Y97.272 A20.7012
+G1 X136.379 Y97.459 A20.7077
+G1 X136.327 Y97.645 A20.7140
+G1 X136.280 Y97.830 A20.7203
+G1 X136.236 Y98.014 A20.7266
+G1 X136.196 Y98.196 A20.7327
+G1 X136.159 Y98.378 A20.7389
+G1 X136.126 Y98.559 A20.7449
+G1 X136.097 Y98.739 A20.7509
+G1 X136.072 Y98.918 A20.7569
+G1 X136.050 Y99.096 A20.7628
+G1 X136.032 Y99.274 A20.7687
+G1 X136.019 Y99.450 A20.7746
+G1 X136.009 Y99.626 A20.7804
+G1 X136.002 Y99.800 A20.7861
+G1 X136.000 Y99.974 A20.7919
+G1 X136.001 Y100.148 A20.7976
+G1 X136.006 Y100.320 A20.8033
+G1 X136.015 Y100.492 A20.8089
+G1 X136.027 Y100.663 A20.8146
+G1 X136.043 Y100.833 A20.8202
+G1 X136.061 Y101.002 A20.8259
+G1 X136.084 Y101.171 A20.8315
+G1 X136.109 Y101.339 A20.8371
+G1 X136.137 Y101.506 A20.8427
+G1 X136.169 Y101.673 A20.8483
+G1 X136.203 Y101.839 A20.8539
+G1 X136.240 Y102.004 A20.8595
+G1 X136.280 Y102.169 A20.8651
+G1 X136.321 Y102.332 A20.8706
+G1 X136.366 Y102.496 A20.8762
+G1 X136.412 Y102.658 A20.8818
+G1 X136.461 Y102.819 A20.8873
+G1 X136.511 Y102.980 A20.8929
+G1 X136.563 Y103.140 A20.8985
+G1 X136.617 Y103.299 A20.9040
+G1 X136.673 Y103.458 A20.9095
+G1 X136.729 Y103.615 A20.9151
+G1 X136.787 Y103.772 A20.9206
+G1 X136.846 Y103.928 A20.9261
+G1 X136.906 Y104.082 A20.9315
+G1 X136.967 Y104.236 A20.9370
+G1 X137.029 Y104.389 A20.9424
+G1 X137.091 Y104.540 A20.9478
+G1 X137.154 Y104.691 A20.9532
+G1 X137.217 Y104.840 A20.9586
+G1 X137.280 Y104.988 A20.9639
+G1 X137.343 Y105.135 A20.9692
+G1 X137.407 Y105.281 A20.9744
+G1 X137.470 Y105.425 A20.9796
+G1 X137.533 Y105.568 A20.9848
+G1 X137.596 Y105.710 A20.9899
+G1 X137.659 Y105.850 A20.9950
+G1 X137.721 Y105.989 A21.0000
+G1 X137.783 Y106.127 A21.0050
+G1 X137.844 Y106.263 A21.0099
+G1 X137.905 Y106.397 A21.0147
+G1 X137.964 Y106.530 A21.0196
+G1 X138.024 Y106.661 A21.0243
+G1 X138.082 Y106.791 A21.0290
+G1 X138.140 Y106.919 A21.0336
+G1 X138.196 Y107.045 A21.0382
+G1 X138.252 Y107.169 A21.0427
+G1 X138.307 Y107.292 A21.0471
+G1 X138.361 Y107.413 A21.0515
+G1 X138.414 Y107.533 A21.0558
+G1 X138.466 Y107.651 A21.0601
+G1 X138.517 Y107.766 A21.0642
+G1 X138.566 Y107.881 A21.0684
+G1 X138.615 Y107.993 A21.0724
+G1 X138.663 Y108.103 A21.0764
+G1 X138.709 Y108.212 A21.0803
+G1 X138.755 Y108.319 A21.0841
+G1 X138.800 Y108.424 A21.0879
+G1 X138.843 Y108.527 A21.0916
+G1 X138.885 Y108.629 A21.0952
+G1 X138.927 Y108.729 A21.0988
+G1 X138.967 Y108.827 A21.1023
+G1 X139.006 Y108.923 A21.1057
+G1 X139.044 Y109.018 A21.1091
+G1 X139.082 Y109.111 A21.1124
+G1 X139.118 Y109.202 A21.1156
+G1 X139.153 Y109.291 A21.1188
+G1 X139.188 Y109.379 A21.1219
+G1 X139.221 Y109.466 A21.1249
+G1 X139.254 Y109.550 A21.1279
+G1 X139.285 Y109.633 A21.1309
+G1 X139.316 Y109.715 A21.1338
+G1 X139.346 Y109.795 A21.1366
+G1 X139.375 Y109.874 A21.1394
+G1 X139.403 Y109.951 A21.1421
+G1 X139.431 Y110.027 A21.1447
+G1 X139.458 Y110.102 A21.1474
+G1 X139.484 Y110.175 A21.1499
+G1 X139.509 Y110.247 A21.1525
+G1 X139.534 Y110.318 A21.1549
+G1 X139.558 Y110.388 A21.1574
+G1 X139.582 Y110.457 A21.1598
+G1 X139.605 Y110.525 A21.1621
+G1 X139.627 Y110.591 A21.1645
+G1 X139.649 Y110.657 A21.1667
+G1 X139.671 Y110.722 A21.1690
+G1 X139.691 Y110.786 A21.1712
+G1 X139.712 Y110.850 A21.1734
+G1 X139.732 Y110.912 A21.1756
+G1 X139.751 Y110.974 A21.1777
+G1 X139.770 Y111.036 A21.1799
+G1 X139.789 Y111.097 A21.1820
+G1 X139.808 Y111.157 A21.1840
+G1 X139.826 Y111.217 A21.1861
+G1 X139.844 Y111.277 A21.1882
+G1 X139.861 Y111.336 A21.1902
+G1 X139.878 Y111.395 A21.1922
+G1 X139.895 Y111.454 A21.1943
+G1 X139.912 Y111.513 A21.1963
+G1 X139.929 Y111.572 A21.1983
+G1 X139.945 Y111.631 A21.2003
+G1 X139.961 Y111.690 A21.2023
+G1 X139.977 Y111.749 A21.2044
+G1 X139.993 Y111.808 A21.2064
+G1 X140.009 Y111.868 A21.2084
+G1 X140.024 Y111.928 A21.2105
+G1 X140.040 Y111.988 A21.2125
+G1 X140.055 Y112.049 A21.2146
+G1 X140.070 Y112.111 A21.2167
+G1 X140.085 Y112.173 A21.2188
+G1 X140.100 Y112.235 A21.2209
+G1 X140.115 Y112.299 A21.2231
+G1 X140.130 Y112.363 A21.2252
+G1 X140.145 Y112.428 A21.2274
+G1 X140.160 Y112.494 A21.2297
+G1 X140.174 Y112.561 A21.2319
+G1 X140.189 Y112.628 A21.2342
+G1 X140.203 Y112.697 A21.2365
+G1 X140.217 Y112.767 A21.2389
+G1 X140.232 Y112.839 A21.2413
+G1 X140.246 Y112.911 A21.2437
+G1 X140.260 Y112.985 A21.2462
+G1 X140.273 Y113.060 A21.2487
+G1 X140.287 Y113.136 A21.2513
+G1 X140.300 Y113.214 A21.2539
+G1 X140.314 Y113.294 A21.2566
+G1 X140.327 Y113.375 A21.2593
+G1 X140.339 Y113.457 A21.2620
+G1 X140.352 Y113.541 A21.2648
+G1 X140.364 Y113.627 A21.2677
+G1 X140.376 Y113.714 A21.2706
+G1 X140.387 Y113.803 A21.2736
+G1 X140.398 Y113.894 A21.2766
+G1 X140.409 Y113.987 A21.2797
+G1 X140.419 Y114.082 A21.2828
+G1 X140.428 Y114.178 A21.2860
+G1 X140.437 Y114.276 A21.2892
+G1 X140.445 Y114.376 A21.2926
+G1 X140.453 Y114.478 A21.2959
+G1 X140.459 Y114.582 A21.2994
+G1 X140.465 Y114.688 A21.3029
+G1 X140.470 Y114.796 A21.3064
+G1 X140.474 Y114.906 A21.3101
+G1 X140.477 Y115.018 A21.3137
+G1 X140.479 Y115.131 A21.3175
+G1 X140.479 Y115.247 A21.3213
+G1 X140.479 Y115.365 A21.3252
+G1 X140.476 Y115.484 A21.3291
+G1 X140.473 Y115.606 A21.3332
+G1 X140.468 Y115.729 A21.3372
+G1 X140.461 Y115.855 A21.3414
+G1 X140.453 Y115.982 A21.3456
+G1 X140.442 Y116.111 A21.3499
+G1 X140.430 Y116.242 A21.3542
+G1 X140.416 Y116.374 A21.3586
+G1 X140.399 Y116.509 A21.3631
+G1 X140.381 Y116.645 A21.3676
+G1 X140.360 Y116.783 A21.3722
+G1 X140.336 Y116.922 A21.3769
+G1 X140.310 Y117.063 A21.3816
+G1 X140.281 Y117.205 A21.3864
+G1 X140.250 Y117.349 A21.3912
+G1 X140.215 Y117.494 A21.3962
+G1 X140.178 Y117.641 A21.4012
+G1 X140.137 Y117.788 A21.4062
+G1 X140.093 Y117.937 A21.4113
+G1 X140.046 Y118.086 A21.4165
+G1 X139.995 Y118.237 A21.4217
+G1 X139.941 Y118.389 A21.4271
+G1 X139.883 Y118.541 A21.4324
+G1 X139.821 Y118.694 A21.4379
+G1 X139.755 Y118.847 A21.4434
+G1 X139.685 Y119.001 A21.4490
+G1 X139.611 Y119.155 A21.4546
+G1 X139.533 Y119.309 A21.4603
+G1 X139.451 Y119.464 A21.4661
+G1 X139.364 Y119.618 A21.4719
+G1 X139.273 Y119.772 A21.4778
+G1 X139.177 Y119.927 A21.4838
+G1 X139.077 Y120.080 A21.4899
+G1 X138.972 Y120.233 A21.4960
+G1 X138.863 Y120.386 A21.5022
+G1 X138.749 Y120.538 A21.5085
+G1 X138.630 Y120.689 A21.5148
+G1 X138.506 Y120.839 A21.5212
+G1 X138.378 Y120.988 A21.5277
+G1 X138.244 Y121.135 A21.5343
+G1 X138.106 Y121.282 A21.5409
+G1 X137.963 Y121.427 A21.5476
+G1 X137.816 Y121.570 A21.5544
+G1 X137.664 Y121.712 A21.5613
+G1 X137.507 Y121.851 A21.5682
+G1 X137.345 Y121.990 A21.5752
+G1 X137.179 Y122.126 A21.5823
+G1 X137.008 Y122.260 A21.5895
+G1 X136.833 Y122.392 A21.5967
+G1 X136.654 Y122.521 A21.6040
+G1 X136.471 Y122.649 A21.6114
+G1 X136.283 Y122.774 A21.6188
+G1 X136.091 Y122.896 A21.6263
+G1 X135.896 Y123.016 A21.6339
+G1 X135.697 Y123.134 A21.6415
+G1 X135.494 Y123.249 A21.6492
+G1 X135.288 Y123.362 A21.6570
+G1 X135.079 Y123.472 A21.6648
+G1 X134.867 Y123.579 A21.6726
+G1 X134.652 Y123.684 A21.6805
+G1 X134.434 Y123.786 A21.6884
+G1 X134.214 Y123.885 A21.6964
+G1 X133.991 Y123.982 A21.7044
+G1 X133.767 Y124.076 A21.7125
+G1 X133.540 Y124.168 A21.7205
+G1 X133.312 Y124.257 A21.7286
+G1 X133.083 Y124.343 A21.7367
+G1 X132.852 Y124.428 A21.7448
+G1 X132.620 Y124.509 A21.7529
+G1 X132.387 Y124.589 A21.7610
+G1 X132.154 Y124.666 A21.7691
+G1 X131.921 Y124.742 A21.7772
+G1 X131.687 Y124.815 A21.7853
+G1 X131.454 Y124.886 A21.7934
+G1 X131.220 Y124.955 A21.8014
+G1 X130.988 Y125.023 A21.8094
+G1 X130.756 Y125.088 A21.8174
+G1 X130.524 Y125.153 A21.8253
+G1 X130.294 Y125.215 A21.8331
+G1 X130.065 Y125.277 A21.8410
+G1 X129.838 Y125.337 A21.8487
+G1 X129.612 Y125.396 A21.8564
+G1 X129.389 Y125.454 A21.8641
+G1 X129.167 Y125.511 A21.8716
+G1 X128.947 Y125.567 A21.8791
+G1 X128.729 Y125.622 A21.8865
+G1 X128.514 Y125.677 A21.8938
+G1 X128.302 Y125.732 A21.9011
+G1 X128.092 Y125.786 A21.9082
+G1 X127.884 Y125.839 A21.9153
+G1 X127.680 Y125.893 A21.9223
+G1 X127.479 Y125.946 A21.9291
+G1 X127.281 Y125.999 A21.9359
+G1 X127.086 Y126.053 A21.9426
+G1 X126.894 Y126.106 A21.9492
+G1 X126.705 Y126.160 A21.9556
+G1 X126.520 Y126.214 A21.9620
+G1 X126.338 Y126.268 A21.9683
+G1 X126.159 Y126.323 A21.9744
+G1 X125.984 Y126.378 A21.9805
+G1 X125.813 Y126.434 A21.9864
+G1 X125.644 Y126.490 A21.9923
+G1 X125.480 Y126.547 A21.9980
+G1 X125.319 Y126.604 A22.0037
+G1 X125.161 Y126.662 A22.0092
+G1 X125.007 Y126.721 A22.0147
+G1 X124.856 Y126.781 A22.0200
+G1 X124.709 Y126.841 A22.0253
+G1 X124.565 Y126.902 A22.0304
+G1 X124.424 Y126.963 A22.0355
+G1 X124.287 Y127.025 A22.0405
+G1 X124.153 Y127.088 A22.0453
+G1 X124.023 Y127.152 A22.0501
+G1 X123.895 Y127.216 A22.0548
+G1 X123.771 Y127.281 A22.0595
+G1 X123.650 Y127.346 A22.0640
+G1 X123.532 Y127.412 A22.0685
+G1 X123.417 Y127.479 A22.0728
+G1 X123.305 Y127.546 A22.0771
+G1 X123.196 Y127.613 A22.0814
+G1 X123.090 Y127.681 A22.0855
+G1 X122.987 Y127.750 A22.0896
+G1 X122.886 Y127.818 A22.0936
+G1 X122.788 Y127.887 A22.0976
+G1 X122.693 Y127.956 A22.1015
+G1 X122.600 Y128.026 A22.1053
+G1 X122.510 Y128.095 A22.1091
+G1 X122.422 Y128.165 A22.1128
+G1 X122.336 Y128.235 A22.1164
+G1 X122.253 Y128.304 A22.1200
+G1 X122.172 Y128.374 A22.1235
+G1 X122.093 Y128.444 A22.1270
+G1 X122.017 Y128.513 A22.1304
+G1 X121.942 Y128.582 A22.1338
+G1 X121.870 Y128.651 A22.1371
+G1 X121.799 Y128.720 A22.1403
+G1 X121.730 Y128.788 A22.1435
+G1 X121.664 Y128.857 A22.1467
+G1 X121.599 Y128.924 A22.1498
+G1 X121.535 Y128.991 A22.1528
+G1 X121.474 Y129.058 A22.1558
+G1 X121.414 Y129.125 A22.1588
+G1 X121.356 Y129.190 A22.1617
+G1 X121.299 Y129.256 A22.1645
+G1 X121.244 Y129.320 A22.1673
+G1 X121.190 Y129.384 A22.1701
+G1 X121.138 Y129.448 A22.1728
+G1 X121.087 Y129.510 A22.1755
+G1 X121.037 Y129.572 A22.1781
+G1 X120.988 Y129.634 A22.1807
+G1 X120.941 Y129.695 A22.1832
+G1 X120.895 Y129.755 A22.1857
+G1 X120.851 Y129.814 A22.1881
+G1 X120.807 Y129.873 A22.1906
+G1 X120.764 Y129.930 A22.1929
+G1 X120.723 Y129.988 A22.1953
+G1 X120.682 Y130.044 A22.1975
+G1 X120.643 Y130.100 A22.1998
+G1 X120.604 Y130.155 A22.2020
+G1 X120.566 Y130.209 A22.2042
+G1 X120.529 Y130.263 A22.2064
+G1 X120.493 Y130.316 A22.2085
+G1 X120.458 Y130.368 A22.2106
+G1 X120.424 Y130.420 A22.2126
+G1 X120.390 Y130.471 A22.2146
+G1 X120.357 Y130.521 A22.2166
+G1 X120.324 Y130.571 A22.2186
+G1 X120.292 Y130.621 A22.2205
+G1 X120.261 Y130.670 A22.2224
+G1 X120.231 Y130.718 A22.2243
+G1 X120.200 Y130.766 A22.2262
+G1 X120.171 Y130.813 A22.2280
+G1 X120.141 Y130.860 A22.2299
+G1 X120.113 Y130.907 A22.2317
+G1 X120.084 Y130.953 A22.2335
+G1 X120.056 Y130.999 A22.2353
+G1 X120.028 Y131.045 A22.2370
+G1 X120.001 Y131.091 A22.2388
+G1 X119.974 Y131.136 A22.2405
+G1 X119.947 Y131.182 A22.2423
+G1 X119.920 Y131.227 A22.2440
+G1 X119.894 Y131.272 A22.2457
+G1 X119.867 Y131.317 A22.2475
+G1 X119.841 Y131.363 A22.2492
+G1 X119.815 Y131.408 A22.2509
+G1 X119.788 Y131.453 A22.2526
+G1 X119.762 Y131.499 A22.2544
+G1 X119.736 Y131.545 A22.2561
+G1 X119.710 Y131.591 A22.2579
+G1 X119.683 Y131.638 A22.2597
+G1 X119.657 Y131.685 A22.2614
+G1 X119.630 Y131.732 A22.2632
+G1 X119.604 Y131.780 A22.2650
+G1 X119.577 Y131.829 A22.2669
+G1 X119.550 Y131.878 A22.2687
+G1 X119.522 Y131.928 A22.2706
+G1 X119.494 Y131.978 A22.2725
+G1 X119.467 Y132.030 A22.2744
+G1 X119.438 Y132.082 A22.2764
+G1 X119.410 Y132.135 A22.2784
+G1 X119.380 Y132.188 A22.2804
+G1 X119.351 Y132.243 A22.2824
+G1 X119.321 Y132.299 A22.2845
+G1 X119.291 Y132.356 A22.2867
+G1 X119.260 Y132.414 A22.2888
+G1 X119.228 Y132.474 A22.2911
+G1 X119.196 Y132.534 A22.2933
+G1 X119.164 Y132.596 A22.2956
+G1 X119.130 Y132.659 A22.2980
+G1 X119.096 Y132.724 A22.3004
+G1 X119.062 Y132.790 A22.3028
+G1 X119.027 Y132.858 A22.3054
+G1 X118.991 Y132.927 A22.3079
+G1 X118.954 Y132.997 A22.3106
+G1 X118.917 Y133.070 A22.3133
+G1 X118.878 Y133.144 A22.3160
+G1 X118.839 Y133.220 A22.3188
+G1 X118.799 Y133.298 A22.3217
+G1 X118.758 Y133.377 A22.3247
+G1 X118.716 Y133.458 A22.3277
+G1 X118.674 Y133.542 A22.3308
+G1 X118.630 Y133.627 A22.3339
+G1 X118.585 Y133.714 A22.3372
+G1 X118.539 Y133.804 A22.3405
+G1 X118.493 Y133.895 A22.3439
+G1 X118.445 Y133.988 A22.3473
+G1 X118.395 Y134.084 A22.3509
+G1 X118.345 Y134.182 A22.3545
+G1 X118.294 Y134.282 A22.3582
+G1 X118.241 Y134.384 A22.3620
+G1 X118.187 Y134.488 A22.3659
+G1 X118.132 Y134.595 A22.3699
+G1 X118.075 Y134.704 A22.3739
+G1 X118.017 Y134.815 A22.3780
+G1 X117.957 Y134.928 A22.3823
+G1 X117.896 Y135.044 A22.3866
+G1 X117.834 Y135.161 A22.3910
+G1 X117.770 Y135.281 A22.3955
+G1 X117.704 Y135.404 A22.4000
+G1 X117.637 Y135.528 A22.4047
+G1 X117.568 Y135.655 A22.4095
+G1 X117.497 Y135.784 A22.4143
+G1 X117.425 Y135.915 A22.4193
+G1 X117.350 Y136.048 A22.4243
+G1 X117.274 Y136.183 A22.4294
+G1 X117.196 Y136.320 A22.4346
+G1 X117.116 Y136.459 A22.4399
+G1 X117.034 Y136.600 A22.4453
+G1 X116.949 Y136.742 A22.4508
+G1 X116.863 Y136.887 A22.4563
+G1 X116.774 Y137.033 A22.4620
+G1 X116.683 Y137.180 A22.4677
+G1 X116.590 Y137.329 A22.4735
+G1 X116.495 Y137.480 A22.4794
+G1 X116.397 Y137.631 A22.4853
+G1 X116.296 Y137.784 A22.4913
+G1 X116.193 Y137.938 A22.4974
+G1 X116.088 Y138.092 A22.5036
+G1 X115.979 Y138.248 A22.5099
+G1 X115.869 Y138.404 A22.5162
+G1 X115.755 Y138.560 A22.5226
+G1 X115.639 Y138.717 A22.5290
+G1 X115.519 Y138.873 A22.5355
+G1 X115.397 Y139.030 A22.5421
+G1 X115.272 Y139.187 A22.5487
+G1 X115.144 Y139.343 A22.5553
+G1 X115.013 Y139.498 A22.5620
+G1 X114.879 Y139.653 A22.5688
+G1 X114.742 Y139.807 A22.5756
+G1 X114.602 Y139.959 A22.5824
+G1 X114.459 Y140.111 A22.5893
+G1 X114.312 Y140.260 A22.5962
+G1 X114.163 Y140.408 A22.6032
+G1 X114.010 Y140.554 A22.6101
+G1 X113.854 Y140.698 A22.6171
+G1 X113.695 Y140.839 A22.6242
+G1 X113.533 Y140.978 A22.6312
+G1 X113.368 Y141.114 A22.6383
+G1 X113.200 Y141.247 A22.6453
+G1 X113.028 Y141.377 A22.6524
+G1 X112.854 Y141.503 A22.6595
+G1 X112.676 Y141.626 A22.6666
+G1 X112.496 Y141.745 A22.6738
+G1 X112.313 Y141.860 A22.6809
+G1 X112.127 Y141.970 A22.6881
+G1 X111.938 Y142.077 A22.6952
+G1 X111.746 Y142.179 A22.7024
+G1 X111.552 Y142.276 A22.7095
+G1 X111.355 Y142.368 A22.7167
+G1 X111.156 Y142.455 A22.7239
+G1 X110.954 Y142.537 A22.7311
+G1 X110.750 Y142.614 A22.7383
+G1 X110.544 Y142.686 A22.7455
+G1 X110.336 Y142.752 A22.7527
+G1 X110.126 Y142.813 A22.7599
+G1 X109.914 Y142.868 A22.7671
+G1 X109.701 Y142.917 A22.7743
+G1 X109.485 Y142.960 A22.7816
+G1 X109.269 Y142.998 A22.7888
+G1 X109.051 Y143.030 A22.7961
+G1 X108.832 Y143.056 A22.8034
+G1 X108.612 Y143.076 A22.8107
+G1 X108.391 Y143.090 A22.8180
+G1 X108.169 Y143.099 A22.8253
+G1 X107.947 Y143.101 A22.8327
+G1 X107.724 Y143.098 A22.8400
+G1 X107.501 Y143.089 A22.8474
+G1 X107.278 Y143.075 A22.8548
+G1 X107.055 Y143.055 A22.8621
+G1 X106.832 Y143.030 A22.8696
+G1 X106.609 Y142.999 A22.8770
+G1 X106.387 Y142.963 A22.8844
+G1 X106.165 Y142.922 A22.8918
+G1 X105.944 Y142.876 A22.8993
+G1 X105.723 Y142.826 A22.9068
+G1 X105.504 Y142.770 A22.9142
+G1 X105.286 Y142.711 A22.9217
+G1 X105.069 Y142.647 A22.9292
+G1 X104.853 Y142.578 A22.9366
+G1 X104.639 Y142.506 A22.9441
+G1 X104.427 Y142.430 A22.9515
+G1 X104.216 Y142.351 A22.9590
+G1 X104.006 Y142.268 A22.9664
+G1 X103.799 Y142.182 A22.9738
+G1 X103.594 Y142.093 A22.9812
+G1 X103.390 Y142.001 A22.9886
+G1 X103.189 Y141.907 A22.9959
+G1 X102.990 Y141.810 A23.0032
+G1 X102.793 Y141.711 A23.0105
+G1 X102.598 Y141.610 A23.0177
+G1 X102.406 Y141.508 A23.0249
+G1 X102.217 Y141.404 A23.0320
+G1 X102.029 Y141.298 A23.0391
+G1 X101.845 Y141.191 A23.0461
+G1 X101.663 Y141.084 A23.0531
+G1 X101.483 Y140.975 A23.0601
+G1 X101.306 Y140.866 A23.0669
+G1 X101.132 Y140.757 A23.0737
+G1 X100.960 Y140.647 A23.0804
+G1 X100.791 Y140.537 A23.0871
+G1 X100.625 Y140.427 A23.0937
+G1 X100.461 Y140.317 A23.1002
+G1 X100.300 Y140.208 A23.1066
+G1 X100.142 Y140.099 A23.1129
+G1 X99.987 Y139.991 A23.1192
+G1 X99.834 Y139.883 A23.1253
+G1 X99.684 Y139.777 A23.1314
+G1 X99.537 Y139.671 A23.1374
+G1 X99.392 Y139.566 A23.1433
+G1 X99.250 Y139.462 A23.1491
+G1 X99.111 Y139.360 A23.1548
+G1 X98.974 Y139.259 A23.1604
+G1 X98.840 Y139.159 A23.1659
+G1 X98.708 Y139.061 A23.1713
+G1 X98.579 Y138.964 A23.1767
+G1 X98.452 Y138.869 A23.1819
+G1 X98.328 Y138.776 A23.1870
+G1 X98.206 Y138.684 A23.1921
+G1 X98.087 Y138.594 A23.1970
+G1 X97.971 Y138.505 A23.2018
+G1 X97.856 Y138.419 A23.2066
+G1 X97.744 Y138.334 A23.2112
+G1 X97.634 Y138.251 A23.2157
+G1 X97.527 Y138.169 A23.2202
+G1 X97.421 Y138.090 A23.2245
+G1 X97.318 Y138.012 A23.2288
+G1 X97.217 Y137.937 A23.2330
+G1 X97.119 Y137.863 A23.2370
+G1 X97.022 Y137.790 A23.2410
+G1 X96.927 Y137.720 A23.2449
+G1 X96.835 Y137.652 A23.2487
+G1 X96.744 Y137.585 A23.2524
+G1 X96.656 Y137.520 A23.2560
+G1 X96.569 Y137.456 A23.2596
+G1 X96.484 Y137.395 A23.2630
+G1 X96.401 Y137.335 A23.2664
+G1 X96.320 Y137.276 A23.2697
+G1 X96.241 Y137.220 A23.2729
+G1 X96.163 Y137.164 A23.2761
+G1 X96.087 Y137.111 A23.2792
+G1 X96.013 Y137.059 A23.2821
+G1 X95.940 Y137.008 A23.2851
+G1 X95.869 Y136.959 A23.2879
+G1 X95.800 Y136.911 A23.2907
+G1 X95.731 Y136.865 A23.2934
+G1 X95.665 Y136.820 A23.2961
+G1 X95.600 Y136.776 A23.2987
+G1 X95.536 Y136.734 A23.3012
+G1 X95.473 Y136.693 A23.3037
+G1 X95.412 Y136.652 A23.3061
+G1 X95.352 Y136.614 A23.3084
+G1 X95.294 Y136.576 A23.3107
+G1 X95.236 Y136.539 A23.3130
+G1 X95.180 Y136.503 A23.3152
+G1 X95.125 Y136.468 A23.3173
+G1 X95.071 Y136.435 A23.3195
+G1 X95.017 Y136.402 A23.3215
+G1 X94.965 Y136.370 A23.3235
+G1 X94.914 Y136.338 A23.3255
+G1 X94.863 Y136.308 A23.3275
+G1 X94.814 Y136.278 A23.3294
+G1 X94.765 Y136.249 A23.3312
+G1 X94.717 Y136.221 A23.3331
+G1 X94.670 Y136.194 A23.3349
+G1 X94.623 Y136.167 A23.3367
+G1 X94.577 Y136.140 A23.3384
+G1 X94.531 Y136.115 A23.3402
+G1 X94.486 Y136.089 A23.3419
+G1 X94.442 Y136.064 A23.3435
+G1 X94.397 Y136.040 A23.3452
+G1 X94.354 Y136.016 A23.3468
+G1 X94.310 Y135.993 A23.3485
+G1 X94.267 Y135.970 A23.3501
+G1 X94.224 Y135.947 A23.3517
+G1 X94.181 Y135.924 A23.3533
+G1 X94.139 Y135.902 A23.3549
+G1 X94.096 Y135.880 A23.3565
+G1 X94.054 Y135.859 A23.3580
+G1 X94.011 Y135.837 A23.3596
+G1 X93.969 Y135.816 A23.3612
+G1 X93.926 Y135.795 A23.3627
+G1 X93.883 Y135.774 A23.3643
+G1 X93.840 Y135.753 A23.3659
+G1 X93.797 Y135.733 A23.3675
+G1 X93.753 Y135.712 A23.3691
+G1 X93.709 Y135.692 A23.3707
+G1 X93.665 Y135.672 A23.3723
+G1 X93.621 Y135.651 A23.3739
+G1 X93.575 Y135.631 A23.3755
+G1 X93.530 Y135.611 A23.3772
+G1 X93.483 Y135.591 A23.3788
+G1 X93.437 Y135.571 A23.3805
+G1 X93.389 Y135.550 A23.3822
+G1 X93.341 Y135.530 A23.3839
+G1 X93.292 Y135.510 A23.3857
+G1 X93.242 Y135.490 A23.3875
+G1 X93.191 Y135.470 A23.3893
+G1 X93.140 Y135.450 A23.3911
+G1 X93.087 Y135.430 A23.3929
+G1 X93.034 Y135.410 A23.3948
+G1 X92.979 Y135.390 A23.3967
+G1 X92.924 Y135.370 A23.3987
+G1 X92.867 Y135.350 A23.4007
+G1 X92.809 Y135.330 A23.4027
+G1 X92.750 Y135.310 A23.4047
+G1 X92.690 Y135.291 A23.4068
+G1 X92.628 Y135.271 A23.4090
+G1 X92.565 Y135.251 A23.4111
+G1 X92.501 Y135.232 A23.4134
+G1 X92.436 Y135.213 A23.4156
+G1 X92.368 Y135.194 A23.4179
+G1 X92.300 Y135.175 A23.4203
+G1 X92.230 Y135.156 A23.4227
+G1 X92.158 Y135.138 A23.4251
+G1 X92.085 Y135.120 A23.4276
+G1 X92.010 Y135.102 A23.4301
+G1 X91.933 Y135.085 A23.4327
+G1 X91.855 Y135.068 A23.4354
+G1 X91.775 Y135.052 A23.4381
+G1 X91.693 Y135.036 A23.4408
+G1 X91.609 Y135.020 A23.4436
+G1 X91.524 Y135.005 A23.4465
+G1 X91.436 Y134.991 A23.4494
+G1 X91.347 Y134.978 A23.4524
+G1 X91.255 Y134.965 A23.4555
+G1 X91.161 Y134.953 A23.4586
+G1 X91.066 Y134.942 A23.4617
+G1 X90.968 Y134.931 A23.4650
+G1 X90.868 Y134.922 A23.4683
+G1 X90.766 Y134.913 A23.4717
+G1 X90.661 Y134.906 A23.4751
+G1 X90.555 Y134.900 A23.4787
+G1 X90.446 Y134.894 A23.4823
+G1 X90.334 Y134.890 A23.4860
+G1 X90.220 Y134.887 A23.4897
+G1 X90.104 Y134.886 A23.4935
+G1 X89.985 Y134.885 A23.4975
+G1 X89.864 Y134.886 A23.5015
+G1 X89.740 Y134.889 A23.5056
+G1 X89.614 Y134.893 A23.5097
+G1 X89.485 Y134.898 A23.5140
+G1 X89.353 Y134.905 A23.5183
+G1 X89.219 Y134.914 A23.5228
+G1 X89.081 Y134.924 A23.5273
+G1 X88.941 Y134.935 A23.5320
+G1 X88.799 Y134.948 A23.5367
+G1 X88.653 Y134.963 A23.5415
+G1 X88.505 Y134.980 A23.5465
+G1 X88.353 Y134.998 A23.5515
+G1 X88.199 Y135.017 A23.5566
+G1 X88.042 Y135.039 A23.5619
+G1 X87.881 Y135.062 A23.5672
+G1 X87.718 Y135.086 A23.5726
+G1 X87.552 Y135.113 A23.5782
+G1 X87.383 Y135.140 A23.5839
+G1 X87.211 Y135.170 A23.5896
+G1 X87.035 Y135.200 A23.5955
+G1 X86.857 Y135.232 A23.6015
+G1 X86.676 Y135.266 A23.6076
+G1 X86.491 Y135.301 A23.6137
+G1 X86.304 Y135.337 A23.6200
+G1 X86.114 Y135.374 A23.6264
+G1 X85.920 Y135.412 A23.6329
+G1 X85.724 Y135.451 A23.6396
+G1 X85.525 Y135.491 A23.6463
+G1 X85.323 Y135.532 A23.6531
+G1 X85.118 Y135.573 A23.6600
+G1 X84.910 Y135.615 A23.6669
+G1 X84.700 Y135.658 A23.6740
+G1 X84.487 Y135.700 A23.6812
+G1 X84.271 Y135.743 A23.6884
+G1 X84.053 Y135.785 A23.6958
+G1 X83.832 Y135.827 A23.7032
+G1 X83.609 Y135.869 A23.7107
+G1 X83.384 Y135.911 A23.7182
+G1 X83.157 Y135.952 A23.7259
+G1 X82.927 Y135.991 A23.7336
+G1 X82.696 Y136.030 A23.7413
+G1 X82.463 Y136.068 A23.7491
+G1 X82.228 Y136.104 A23.7569
+G1 X81.991 Y136.139 A23.7648
+G1 X81.754 Y136.172 A23.7727
+G1 X81.514 Y136.203 A23.7807
+G1 X81.274 Y136.232 A23.7887
+G1 X81.033 Y136.259 A23.7967
+G1 X80.791 Y136.283 A23.8047
+G1 X80.548 Y136.305 A23.8128
+G1 X80.305 Y136.324 A23.8208
+G1 X80.062 Y136.340 A23.8289
+G1 X79.818 Y136.353 A23.8369
+G1 X79.574 Y136.363 A23.8450
+G1 X79.331 Y136.370 A23.8530
+G1 X79.088 Y136.373 A23.8610
+G1 X78.846 Y136.372 A23.8690
+G1 X78.604 Y136.368 A23.8770
+G1 X78.363 Y136.360 A23.8849
+G1 X78.124 Y136.348 A23.8929
+G1 X77.886 Y136.332 A23.9007
+G1 X77.649 Y136.312 A23.9086
+G1 X77.414 Y136.288 A23.9164
+G1 X77.181 Y136.260 A23.9241
+G1 X76.949 Y136.227 A23.9318
+G1 X76.720 Y136.190 A23.9395
+G1 X76.494 Y136.149 A23.9471
+G1 X76.269 Y136.103 A23.9546
+G1 X76.048 Y136.053 A23.9621
+G1 X75.829 Y135.999 A23.9696
+G1 X75.613 Y135.940 A23.9770
+G1 X75.400 Y135.877 A23.9843
+G1 X75.191 Y135.810 A23.9915
+G1 X74.985 Y135.738 A23.9987
+G1 X74.782 Y135.663 A24.0059
+G1 X74.582 Y135.583 A24.0130
+G1 X74.387 Y135.499 A24.0200
+G1 X74.195 Y135.411 A24.0270
+G1 X74.007 Y135.320 A24.0339
+G1 X73.823 Y135.225 A24.0407
+G1 X73.642 Y135.126 A24.0475
+G1 X73.466 Y135.023 A24.0542
+G1 X73.294 Y134.918 A24.0609
+G1 X73.126 Y134.809 A24.0675
+G1 X72.962 Y134.696 A24.0741
+G1 X72.802 Y134.581 A24.0806
+G1 X72.646 Y134.463 A24.0870
+G1 X72.494 Y134.342 A24.0934
+G1 X72.347 Y134.219 A24.0997
+G1 X72.204 Y134.094 A24.1060
+G1 X72.065 Y133.966 A24.1123
+G1 X71.930 Y133.836 A24.1184
+G1 X71.799 Y133.704 A24.1246
+G1 X71.672 Y133.570 A24.1307
+G1 X71.550 Y133.435 A24.1367
+G1 X71.431 Y133.298 A24.1427
+G1 X71.316 Y133.160 A24.1486
+G1 X71.205 Y133.021 A24.1544
+G1 X71.098 Y132.881 A24.1603
+G1 X70.995 Y132.740 A24.1660
+G1 X70.896 Y132.599 A24.1717
+G1 X70.800 Y132.457 A24.1774
+G1 X70.707 Y132.314 A24.1830
+G1 X70.618 Y132.172 A24.1885
+G1 X70.533 Y132.029 A24.1940
+G1 X70.451 Y131.886 A24.1995
+G1 X70.372 Y131.744 A24.2048
+G1 X70.296 Y131.601 A24.2102
+G1 X70.223 Y131.460 A24.2154
+G1 X70.154 Y131.318 A24.2206
+G1 X70.087 Y131.178 A24.2258
+G1 X70.023 Y131.038 A24.2308
+G1 X69.961 Y130.899 A24.2358
+G1 X69.903 Y130.761 A24.2408
+G1 X69.846 Y130.624 A24.2457
+G1 X69.793 Y130.488 A24.2505
+G1 X69.741 Y130.353 A24.2553
+G1 X69.692 Y130.220 A24.2599
+G1 X69.645 Y130.088 A24.2646
+G1 X69.601 Y129.958 A24.2691
+G1 X69.558 Y129.829 A24.2736
+G1 X69.517 Y129.701 A24.2780
+G1 X69.478 Y129.575 A24.2824
+G1 X69.441 Y129.451 A24.2866
+G1 X69.406 Y129.328 A24.2909
+G1 X69.372 Y129.208 A24.2950
+G1 X69.340 Y129.088 A24.2991
+G1 X69.310 Y128.971 A24.3031
+G1 X69.280 Y128.856 A24.3070
+G1 X69.253 Y128.742 A24.3109
+G1 X69.226 Y128.630 A24.3147
+G1 X69.201 Y128.520 A24.3184
+G1 X69.177 Y128.412 A24.3220
+G1 X69.154 Y128.305 A24.3256
+G1 X69.133 Y128.201 A24.3291
+G1 X69.112 Y128.098 A24.3326
+G1 X69.092 Y127.997 A24.3360
+G1 X69.073 Y127.898 A24.3393
+G1 X69.056 Y127.801 A24.3426
+G1 X69.039 Y127.706 A24.3458
+G1 X69.022 Y127.612 A24.3489
+G1 X69.007 Y127.520 A24.3520
+G1 X68.992 Y127.430 A24.3550
+G1 X68.978 Y127.341 A24.3580
+G1 X68.965 Y127.255 A24.3609
+G1 X68.952 Y127.169 A24.3637
+G1 X68.940 Y127.086 A24.3665
+G1 X68.928 Y127.003 A24.3692
+G1 X68.917 Y126.923 A24.3719
+G1 X68.906 Y126.844 A24.3746
+G1 X68.896 Y126.766 A24.3772
+G1 X68.887 Y126.689 A24.3797
+G1 X68.877 Y126.614 A24.3822
+G1 X68.868 Y126.540 A24.3847
+G1 X68.860 Y126.467 A24.3871
+G1 X68.852 Y126.396 A24.3895
+G1 X68.844 Y126.326 A24.3918
+G1 X68.836 Y126.256 A24.3941
+G1 X68.829 Y126.188 A24.3964
+G1 X68.822 Y126.120 A24.3986
+G1 X68.816 Y126.054 A24.4008
+G1 X68.809 Y125.988 A24.4030
+G1 X68.803 Y125.923 A24.4052
+G1 X68.797 Y125.858 A24.4073
+G1 X68.791 Y125.795 A24.4094
+G1 X68.786 Y125.731 A24.4115
+G1 X68.780 Y125.669 A24.4136
+G1 X68.775 Y125.606 A24.4156
+G1 X68.770 Y125.544 A24.4177
+G1 X68.765 Y125.483 A24.4197
+G1 X68.760 Y125.421 A24.4218
+G1 X68.756 Y125.360 A24.4238
+G1 X68.751 Y125.299 A24.4258
+G1 X68.747 Y125.238 A24.4278
+G1 X68.742 Y125.177 A24.4298
+G1 X68.738 Y125.116 A24.4319
+G1 X68.734 Y125.055 A24.4339
+G1 X68.730 Y124.993 A24.4359
+G1 X68.726 Y124.931 A24.4380
+G1 X68.722 Y124.869 A24.4400
+G1 X68.719 Y124.807 A24.4421
+G1 X68.715 Y124.744 A24.4442
+G1 X68.711 Y124.680 A24.4463
+G1 X68.708 Y124.616 A24.4484
+G1 X68.704 Y124.551 A24.4505
+G1 X68.701 Y124.486 A24.4527
+G1 X68.698 Y124.419 A24.4549
+G1 X68.694 Y124.352 A24.4571
+G1 X68.691 Y124.284 A24.4594
+G1 X68.688 Y124.215 A24.4616
+G1 X68.685 Y124.145 A24.4639
+G1 X68.682 Y124.074 A24.4663
+G1 X68.679 Y124.002 A24.4687
+G1 X68.676 Y123.929 A24.4711
+G1 X68.673 Y123.854 A24.4735
+G1 X68.670 Y123.779 A24.4760
+G1 X68.667 Y123.702 A24.4786
+G1 X68.664 Y123.623 A24.4812
+G1 X68.662 Y123.544 A24.4838
+G1 X68.659 Y123.463 A24.4865
+G1 X68.656 Y123.380 A24.4892
+G1 X68.654 Y123.296 A24.4920
+G1 X68.651 Y123.210 A24.4948
+G1 X68.649 Y123.123 A24.4977
+G1 X68.646 Y123.034 A24.5006
+G1 X68.644 Y122.944 A24.5036
+G1 X68.641 Y122.852 A24.5067
+G1 X68.639 Y122.758 A24.5097
+G1 X68.636 Y122.663 A24.5129
+G1 X68.634 Y122.565 A24.5161
+G1 X68.631 Y122.467 A24.5194
+G1 X68.629 Y122.366 A24.5227
+G1 X68.626 Y122.264 A24.5261
+G1 X68.623 Y122.160 A24.5295
+G1 X68.621 Y122.054 A24.5330
+G1 X68.618 Y121.946 A24.5365
+G1 X68.615 Y121.837 A24.5402
+G1 X68.612 Y121.726 A24.5438
+G1 X68.609 Y121.613 A24.5475
+G1 X68.606 Y121.499 A24.5513
+G1 X68.602 Y121.382 A24.5552
+G1 X68.598 Y121.264 A24.5591
+G1 X68.595 Y121.145 A24.5630
+G1 X68.590 Y121.024 A24.5670
+G1 X68.586 Y120.901 A24.5711
+G1 X68.581 Y120.776 A24.5752
+G1 X68.575 Y120.650 A24.5793
+G1 X68.570 Y120.523 A24.5835
+G1 X68.563 Y120.394 A24.5878
+G1 X68.556 Y120.264 A24.5921
+G1 X68.549 Y120.132 A24.5965
+G1 X68.541 Y119.999 A24.6009
+G1 X68.532 Y119.864 A24.6053
+G1 X68.522 Y119.729 A24.6098
+G1 X68.512 Y119.592 A24.6143
+G1 X68.501 Y119.454 A24.6189
+G1 X68.488 Y119.315 A24.6235
+G1 X68.475 Y119.174 A24.6282
+G1 X68.460 Y119.033 A24.6328
+G1 X68.444 Y118.891 A24.6375
+G1 X68.427 Y118.749 A24.6423
+G1 X68.408 Y118.605 A24.6471
+G1 X68.388 Y118.461 A24.6519
+G1 X68.367 Y118.316 A24.6567
+G1 X68.343 Y118.170 A24.6616
+G1 X68.318 Y118.024 A24.6665
+G1 X68.291 Y117.878 A24.6714
+G1 X68.262 Y117.731 A24.6763
+G1 X68.231 Y117.584 A24.6813
+G1 X68.197 Y117.437 A24.6863
+G1 X68.161 Y117.289 A24.6913
+G1 X68.123 Y117.141 A24.6963
+G1 X68.083 Y116.993 A24.7014
+G1 X68.039 Y116.845 A24.7065
+G1 X67.993 Y116.698 A24.7116
+G1 X67.945 Y116.550 A24.7167
+G1 X67.893 Y116.402 A24.7219
+G1 X67.838 Y116.255 A24.7271
+G1 X67.780 Y116.107 A24.7323
+G1 X67.719 Y115.960 A24.7376
+G1 X67.655 Y115.813 A24.7428
+G1 X67.587 Y115.667 A24.7482
+G1 X67.516 Y115.520 A24.7535
+G1 X67.442 Y115.374 A24.7590
+G1 X67.363 Y115.229 A24.7644
+G1 X67.282 Y115.083 A24.7699
+G1 X67.196 Y114.938 A24.7755
+G1 X67.107 Y114.794 A24.7811
+G1 X67.014 Y114.649 A24.7867
+G1 X66.917 Y114.505 A24.7925
+G1 X66.816 Y114.362 A24.7983
+G1 X66.712 Y114.219 A24.8041
+G1 X66.603 Y114.076 A24.8100
+G1 X66.491 Y113.933 A24.8160
+G1 X66.375 Y113.790 A24.8221
+G1 X66.255 Y113.648 A24.8282
+G1 X66.132 Y113.506 A24.8344
+G1 X66.004 Y113.364 A24.8407
+G1 X65.873 Y113.222 A24.8471
+G1 X65.739 Y113.080 A24.8535
+G1 X65.601 Y112.939 A24.8601
+G1 X65.459 Y112.797 A24.8667
+G1 X65.315 Y112.655 A24.8734
+G1 X65.167 Y112.513 A24.8801
+G1 X65.016 Y112.371 A24.8870
+G1 X64.862 Y112.228 A24.8939
+G1 X64.705 Y112.086 A24.9009
+G1 X64.545 Y111.943 A24.9080
+G1 X64.383 Y111.799 A24.9151
+G1 X64.219 Y111.656 A24.9223
+G1 X64.052 Y111.512 A24.9296
+G1 X63.883 Y111.367 A24.9369
+G1 X63.713 Y111.222 A24.9443
+G1 X63.541 Y111.076 A24.9518
+G1 X63.367 Y110.929 A24.9593
+G1 X63.192 Y110.782 A24.9668
+G1 X63.016 Y110.635 A24.9744
+G1 X62.840 Y110.486 A24.9820
+G1 X62.662 Y110.337 A24.9896
+G1 X62.485 Y110.188 A24.9973
+G1 X62.307 Y110.037 A25.0050
+G1 X62.129 Y109.886 A25.0127
+G1 X61.951 Y109.734 A25.0204
+G1 X61.773 Y109.581 A25.0281
+G1 X61.597 Y109.428 A25.0359
+G1 X61.421 Y109.274 A25.0436
+G1 X61.246 Y109.119 A25.0513
+G1 X61.072 Y108.963 A25.0590
+G1 X60.900 Y108.807 A25.0667
+G1 X60.729 Y108.650 A25.0743
+G1 X60.560 Y108.493 A25.0819
+G1 X60.393 Y108.335 A25.0895
+G1 X60.229 Y108.177 A25.0971
+G1 X60.066 Y108.018 A25.1045
+G1 X59.906 Y107.859 A25.1120
+G1 X59.749 Y107.699 A25.1194
+G1 X59.594 Y107.539 A25.1267
+G1 X59.442 Y107.379 A25.1340
+G1 X59.293 Y107.219 A25.1412
+G1 X59.147 Y107.059 A25.1484
+G1 X59.005 Y106.899 A25.1555
+G1 X58.866 Y106.738 A25.1625
+G1 X58.730 Y106.578 A25.1694
+G1 X58.597 Y106.418 A25.1763
+G1 X58.468 Y106.259 A25.1830
+G1 X58.343 Y106.099 A25.1897
+G1 X58.221 Y105.941 A25.1963
+G1 X58.103 Y105.782 A25.2028
+G1 X57.989 Y105.624 A25.2093
+G1 X57.878 Y105.467 A25.2156
+G1 X57.771 Y105.311 A25.2219
+G1 X57.668 Y105.155 A25.2280
+G1 X57.568 Y105.001 A25.2341
+G1 X57.472 Y104.847 A25.2401
+G1 X57.380 Y104.694 A25.2460
+G1 X57.292 Y104.543 A25.2517
+G1 X57.207 Y104.392 A25.2574
+G1 X57.126 Y104.243 A25.2630
+G1 X57.048 Y104.095 A25.2686
+G1 X56.974 Y103.949 A25.2740
+G1 X56.903 Y103.804 A25.2793
+G1 X56.836 Y103.660 A25.2845
+G1 X56.772 Y103.518 A25.2897
+G1 X56.711 Y103.377 A25.2947
+G1 X56.654 Y103.239 A25.2997
+G1 X56.599 Y103.101 A25.3046
+G1 X56.548 Y102.966 A25.3093
+G1 X56.499 Y102.832 A25.3140
+G1 X56.454 Y102.700 A25.3187
+G1 X56.411 Y102.570 A25.3232
+G1 X56.371 Y102.442 A25.3276
+G1 X56.333 Y102.315 A25.3320
+G1 X56.298 Y102.191 A25.3362
+G1 X56.266 Y102.068 A25.3404
+G1 X56.236 Y101.948 A25.3445
+G1 X56.208 Y101.829 A25.3485
+G1 X56.182 Y101.712 A25.3525
+G1 X56.158 Y101.597 A25.3564
+G1 X56.137 Y101.484 A25.3601
+G1 X56.117 Y101.374 A25.3639
+G1 X56.099 Y101.265 A25.3675
+G1 X56.083 Y101.158 A25.3711
+G1 X56.069 Y101.053 A25.3746
+G1 X56.056 Y100.950 A25.3780
+G1 X56.045 Y100.849 A25.3813
+G1 X56.035 Y100.750 A25.3846
+G1 X56.026 Y100.652 A25.3879
+G1 X56.019 Y100.557 A25.3910
+G1 X56.013 Y100.464 A25.3941
+G1 X56.009 Y100.372 A25.3971
+G1 X56.005 Y100.282 A25.4001
+G1 X56.002 Y100.194 A25.4030
+G1 X56.001 Y100.108 A25.4059
+G1 X56.000 Y100.023 A25.4086
+G1 X56.000 Y99.940 A25.4114
+G1 X56.001 Y99.859 A25.4141
+G1 X56.003 Y99.779 A25.4167
+G1 X56.006 Y99.701 A25.4193
+G1 X56.009 Y99.625 A25.4218
+G1 X56.013 Y99.550 A25.4243
+G1 X56.017 Y99.476 A25.4267
+G1 X56.022 Y99.404 A25.4291
+G1 X56.028 Y99.333 A25.4314
+G1 X56.034 Y99.264 A25.4337
+G1 X56.040 Y99.196 A25.4360
+G1 X56.047 Y99.129 A25.4382
+G1 X56.054 Y99.063 A25.4404
+G1 X56.062 Y98.998 A25.4426
+G1 X56.070 Y98.935 A25.4447
+G1 X56.079 Y98.872 A25.4468
+G1 X56.088 Y98.810 A25.4488
+G1 X56.097 Y98.749 A25.4508
+G1 X56.107 Y98.689 A25.4528
+G1 X56.116 Y98.630 A25.4548
+G1 X56.127 Y98.572 A25.4568
+G1 X56.137 Y98.514 A25.4587
+G1 X56.148 Y98.457 A25.4606
+G1 X56.159 Y98.400 A25.4625
+G1 X56.170 Y98.344 A25.4644
+G1 X56.182 Y98.289 A25.4663
+G1 X56.194 Y98.234 A25.4682
+G1 X56.206 Y98.179 A25.4700
+G1 X56.219 Y98.124 A25.4719
+G1 X56.231 Y98.070 A25.4737
+G1 X56.245 Y98.015 A25.4756
+G1 X56.258 Y97.961 A25.4774
+G1 X56.272 Y97.907 A25.4792
+G1 X56.286 Y97.853 A25.4811
+G1 X56.301 Y97.799 A25.4830
+G1 X56.316 Y97.744 A25.4848
+G1 X56.332 Y97.690 A25.4867
+G1 X56.348 Y97.635 A25.4886
+G1 X56.364 Y97.580 A25.4905
+G1 X56.381 Y97.524 A25.4924
+G1 X56.399 Y97.468 A25.4943
+G1 X56.417 Y97.412 A25.4963
+G1 X56.435 Y97.355 A25.4983
+G1 X56.454 Y97.297 A25.5003
+G1 X56.474 Y97.239 A25.5023
+G1 X56.495 Y97.180 A25.5043
+G1 X56.516 Y97.121 A25.5064
+G1 X56.538 Y97.061 A25.5085
+G1 X56.561 Y96.999 A25.5107
+G1 X56.584 Y96.937 A25.5129
+G1 X56.609 Y96.874 A25.5151
+G1 X56.634 Y96.810 A25.5174
+G1 X56.660 Y96.745 A25.5197
+G1 X56.687 Y96.679 A25.5220
+G1 X56.715 Y96.612 A25.5244
+G1 X56.745 Y96.544 A25.5269
+G1 X56.775 Y96.475 A25.5294
+G1 X56.807 Y96.404 A25.5319
+G1 X56.839 Y96.332 A25.5346
+G1 X56.873 Y96.259 A25.5372
+G1 X56.909 Y96.185 A25.5399
+G1 X56.945 Y96.109 A25.5427
+G1 X56.984 Y96.032 A25.5456
+G1 X57.023 Y95.953 A25.5485
+G1 X57.064 Y95.873 A25.5514
+G1 X57.107 Y95.792 A25.5545
+G1 X57.151 Y95.709 A25.5575
+G1 X57.197 Y95.625 A25.5607
+G1 X57.245 Y95.539 A25.5640
+G1 X57.295 Y95.452 A25.5673
+G1 X57.346 Y95.363 A25.5707
+G1 X57.400 Y95.273 A25.5741
+G1 X57.455 Y95.181 A25.5776
+G1 X57.512 Y95.088 A25.5813
+G1 X57.572 Y94.993 A25.5850
+G1 X57.634 Y94.897 A25.5887
+G1 X57.698 Y94.799 A25.5926
+G1 X57.764 Y94.700 A25.5965
+G1 X57.832 Y94.599 A25.6005
+G1 X57.903 Y94.497 A25.6046
+G1 X57.976 Y94.393 A25.6088
+G1 X58.052 Y94.288 A25.6131
+G1 X58.130 Y94.181 A25.6175
+G1 X58.211 Y94.073 A25.6219
+G1 X58.294 Y93.964 A25.6265
+G1 X58.380 Y93.853 A25.6311
+G1 X58.469 Y93.741 A25.6358
+G1 X58.560 Y93.627 A25.6406
+G1 X58.654 Y93.513 A25.6455
+G1 X58.751 Y93.397 A25.6505
+G1 X58.850 Y93.280 A25.6556
+G1 X58.952 Y93.161 A25.6607
+G1 X59.057 Y93.042 A25.6660
+G1 X59.165 Y92.921 A25.6713
+G1 X59.276 Y92.800 A25.6767
+G1 X59.389 Y92.677 A25.6823
+G1 X59.505 Y92.553 A25.6878
+G1 X59.624 Y92.429 A25.6935
+G1 X59.746 Y92.304 A25.6993
+G1 X59.870 Y92.177 A25.7051
+G1 X59.997 Y92.050 A25.7111
+G1 X60.126 Y91.923 A25.7171
+G1 X60.258 Y91.794 A25.7231
+G1 X60.393 Y91.665 A25.7293
+G1 X60.530 Y91.535 A25.7355
+G1 X60.669 Y91.405 A25.7418
+G1 X60.811 Y91.274 A25.7482
+G1 X60.954 Y91.143 A25.7546
+G1 X61.100 Y91.011 A25.7611
+G1 X61.248 Y90.879 A25.7676
+G1 X61.398 Y90.747 A25.7742
+G1 X61.549 Y90.614 A25.7809
+G1 X61.702 Y90.481 A25.7876
+G1 X61.856 Y90.347 A25.7943
+G1 X62.012 Y90.214 A25.8011
+G1 X62.169 Y90.080 A25.8079
+G1 X62.327 Y89.945 A25.8147
+G1 X62.486 Y89.811 A25.8216
+G1 X62.646 Y89.676 A25.8285
+G1 X62.806 Y89.542 A25.8354
+G1 X62.967 Y89.407 A25.8423
+G1 X63.128 Y89.272 A25.8493
+G1 X63.289 Y89.136 A25.8562
+G1 X63.450 Y89.001 A25.8631
+G1 X63.611 Y88.865 A25.8701
+G1 X63.771 Y88.729 A25.8770
+G1 X63.930 Y88.593 A25.8839
+G1 X64.089 Y88.456 A25.8908
+G1 X64.247 Y88.320 A25.8977
+G1 X64.403 Y88.183 A25.9046
+G1 X64.558 Y88.045 A25.9114
+G1 X64.712 Y87.908 A25.9182
+G1 X64.864 Y87.769 A25.9250
+G1 X65.014 Y87.631 A25.9318
+G1 X65.162 Y87.492 A25.9385
+G1 X65.307 Y87.352 A25.9451
+G1 X65.451 Y87.212 A25.9517
+G1 X65.591 Y87.071 A25.9583
+G1 X65.729 Y86.929 A25.9648
+G1 X65.865 Y86.787 A25.9713
+G1 X65.997 Y86.644 A25.9777
+G1 X66.126 Y86.500 A25.9841
+G1 X66.252 Y86.355 A25.9905
+G1 X66.375 Y86.209 A25.9967
+G1 X66.495 Y86.063 A26.0030
+G1 X66.611 Y85.915 A26.0092
+G1 X66.723 Y85.766 A26.0154
+G1 X66.832 Y85.616 A26.0215
+G1 X66.937 Y85.465 A26.0275
+G1 X67.039 Y85.312 A26.0336
+G1 X67.137 Y85.159 A26.0396
+G1 X67.231 Y85.004 A26.0456
+G1 X67.321 Y84.848 A26.0515
+G1 X67.408 Y84.690 A26.0575
+G1 X67.490 Y84.531 A26.0634
+G1 X67.570 Y84.371 A26.0693
+G1 X67.645 Y84.209 A26.0752
+G1 X67.717 Y84.046 A26.0810
+G1 X67.785 Y83.882 A26.0869
+G1 X67.849 Y83.716 A26.0928
+G1 X67.910 Y83.550 A26.0986
+G1 X67.968 Y83.381 A26.1045
+G1 X68.022 Y83.212 A26.1104
+G1 X68.073 Y83.041 A26.1163
+G1 X68.121 Y82.869 A26.1222
+G1 X68.165 Y82.695 A26.1281
+G1 X68.207 Y82.521 A26.1340
+G1 X68.246 Y82.345 A26.1399
+G1 X68.282 Y82.169 A26.1459
+G1 X68.315 Y81.991 A26.1518
+G1 X68.346 Y81.813 A26.1578
+G1 X68.374 Y81.634 A26.1638
+G1 X68.400 Y81.453 A26.1698
+G1 X68.424 Y81.273 A26.1758
+G1 X68.446 Y81.091 A26.1818
+G1 X68.466 Y80.910 A26.1879
+G1 X68.484 Y80.727 A26.1939
+G1 X68.501 Y80.545 A26.2000
+G1 X68.516 Y80.362 A26.2060
+G1 X68.529 Y80.179 A26.2121
+G1 X68.541 Y79.996 A26.2181
+G1 X68.552 Y79.814 A26.2242
+G1 X68.562 Y79.631 A26.2302
+G1 X68.571 Y79.449 A26.2362
+G1 X68.579 Y79.267 A26.2422
+G1 X68.586 Y79.085 A26.2482
+G1 X68.593 Y78.904 A26.2542
+G1 X68.599 Y78.724 A26.2602
+G1 X68.604 Y78.544 A26.2661
+G1 X68.610 Y78.366 A26.2720
+G1 X68.614 Y78.188 A26.2778
+G1 X68.619 Y78.012 A26.2837
+G1 X68.624 Y77.837 A26.2894
+G1 X68.628 Y77.662 A26.2952
+G1 X68.632 Y77.490 A26.3009
+G1 X68.637 Y77.319 A26.3065
+G1 X68.641 Y77.149 A26.3121
+G1 X68.646 Y76.981 A26.3177
+G1 X68.650 Y76.814 A26.3232
+G1 X68.655 Y76.650 A26.3286
+G1 X68.661 Y76.487 A26.3340
+G1 X68.666 Y76.326 A26.3393
+G1 X68.672 Y76.167 A26.3446
+G1 X68.678 Y76.010 A26.3497
+G1 X68.685 Y75.855 A26.3549
+G1 X68.692 Y75.702 A26.3599
+G1 X68.699 Y75.552 A26.3649
+G1 X68.707 Y75.403 A26.3698
+G1 X68.715 Y75.257 A26.3746
+G1 X68.724 Y75.113 A26.3794
+G1 X68.732 Y74.971 A26.3841
+G1 X68.742 Y74.832 A26.3887
+G1 X68.752 Y74.695 A26.3932
+G1 X68.762 Y74.560 A26.3977
+G1 X68.772 Y74.427 A26.4021
+G1 X68.783 Y74.297 A26.4064
+G1 X68.794 Y74.170 A26.4106
+G1 X68.806 Y74.044 A26.4148
+G1 X68.818 Y73.921 A26.4188
+G1 X68.830 Y73.801 A26.4228
+G1 X68.843 Y73.683 A26.4268
+G1 X68.856 Y73.567 A26.4306
+G1 X68.869 Y73.453 A26.4344
+G1 X68.883 Y73.342 A26.4381
+G1 X68.896 Y73.233 A26.4417
+G1 X68.910 Y73.126 A26.4453
+G1 X68.925 Y73.022 A26.4487
+G1 X68.939 Y72.919 A26.4521
+G1 X68.954 Y72.819 A26.4555
+G1 X68.968 Y72.721 A26.4588
+G1 X68.983 Y72.625 A26.4620
+G1 X68.998 Y72.531 A26.4651
+G1 X69.014 Y72.439 A26.4682
+G1 X69.029 Y72.349 A26.4712
+G1 X69.044 Y72.261 A26.4741
+G1 X69.060 Y72.175 A26.4770
+G1 X69.075 Y72.091 A26.4799
+G1 X69.091 Y72.008 A26.4826
+G1 X69.107 Y71.927 A26.4854
+G1 X69.123 Y71.848 A26.4880
+G1 X69.138 Y71.771 A26.4906
+G1 X69.154 Y71.695 A26.4932
+G1 X69.170 Y71.620 A26.4957
+G1 X69.186 Y71.547 A26.4982
+G1 X69.202 Y71.475 A26.5006
+G1 X69.218 Y71.405 A26.5030
+G1 X69.234 Y71.336 A26.5053
+G1 X69.250 Y71.268 A26.5076
+G1 X69.266 Y71.201 A26.5099
+G1 X69.283 Y71.136 A26.5121
+G1 X69.299 Y71.071 A26.5143
+G1 X69.315 Y71.007 A26.5165
+G1 X69.331 Y70.945 A26.5186
+G1 X69.348 Y70.883 A26.5207
+G1 X69.364 Y70.822 A26.5228
+G1 X69.381 Y70.761 A26.5249
+G1 X69.398 Y70.701 A26.5269
+G1 X69.414 Y70.642 A26.5290
+G1 X69.431 Y70.584 A26.5310
+G1 X69.448 Y70.525 A26.5330
+G1 X69.465 Y70.468 A26.5350
+G1 X69.483 Y70.410 A26.5370
+G1 X69.500 Y70.353 A26.5389
+G1 X69.518 Y70.296 A26.5409
+G1 X69.536 Y70.239 A26.5429
+G1 X69.554 Y70.183 A26.5448
+G1 X69.573 Y70.126 A26.5468
+G1 X69.592 Y70.069 A26.5488
+G1 X69.611 Y70.012 A26.5507
+G1 X69.630 Y69.956 A26.5527
+G1 X69.650 Y69.898 A26.5547
+G1 X69.670 Y69.841 A26.5567
+G1 X69.691 Y69.783 A26.5587
+G1 X69.712 Y69.725 A26.5608
+G1 X69.734 Y69.667 A26.5628
+G1 X69.756 Y69.608 A26.5649
+G1 X69.779 Y69.549 A26.5670
+G1 X69.802 Y69.489 A26.5691
+G1 X69.826 Y69.428 A26.5713
+G1 X69.850 Y69.367 A26.5735
+G1 X69.875 Y69.305 A26.5757
+G1 X69.901 Y69.243 A26.5779
+G1 X69.928 Y69.179 A26.5802
+G1 X69.955 Y69.115 A26.5825
+G1 X69.984 Y69.050 A26.5848
+G1 X70.013 Y68.984 A26.5872
+G1 X70.043 Y68.917 A26.5896
+G1 X70.074 Y68.850 A26.5921
+G1 X70.106 Y68.781 A26.5946
+G1 X70.139 Y68.711 A26.5971
+G1 X70.174 Y68.641 A26.5997
+G1 X70.209 Y68.569 A26.6023
+G1 X70.246 Y68.496 A26.6050
+G1 X70.284 Y68.423 A26.6078
+G1 X70.323 Y68.348 A26.6105
+G1 X70.363 Y68.272 A26.6134
+G1 X70.405 Y68.195 A26.6163
+G1 X70.449 Y68.117 A26.6192
+G1 X70.494 Y68.038 A26.6222
+G1 X70.541 Y67.958 A26.6253
+G1 X70.589 Y67.877 A26.6284
+G1 X70.639 Y67.795 A26.6316
+G1 X70.691 Y67.712 A26.6348
+G1 X70.745 Y67.628 A26.6381
+G1 X70.800 Y67.543 A26.6414
+G1 X70.858 Y67.457 A26.6449
+G1 X70.917 Y67.370 A26.6483
+G1 X70.979 Y67.282 A26.6519
+G1 X71.043 Y67.194 A26.6555
+G1 X71.109 Y67.105 A26.6591
+G1 X71.178 Y67.015 A26.6629
+G1 X71.249 Y66.924 A26.6667
+G1 X71.322 Y66.833 A26.6705
+G1 X71.398 Y66.741 A26.6745
+G1 X71.476 Y66.649 A26.6785
+G1 X71.557 Y66.556 A26.6825
+G1 X71.641 Y66.464 A26.6867
+G1 X71.728 Y66.370 A26.6909
+G1 X71.818 Y66.277 A26.6951
+G1 X71.910 Y66.184 A26.6995
+G1 X72.006 Y66.091 A26.7039
+G1 X72.104 Y65.997 A26.7083
+G1 X72.206 Y65.905 A26.7129
+G1 X72.311 Y65.812 A26.7175
+G1 X72.419 Y65.720 A26.7222
+G1 X72.531 Y65.628 A26.7270
+G1 X72.645 Y65.537 A26.7318
+G1 X72.764 Y65.447 A26.7367
+G1 X72.886 Y65.358 A26.7417
+G1 X73.011 Y65.269 A26.7467
+G1 X73.140 Y65.182 A26.7519
+G1 X73.272 Y65.096 A26.7571
+G1 X73.408 Y65.012 A26.7624
+G1 X73.548 Y64.928 A26.7677
+G1 X73.691 Y64.847 A26.7732
+G1 X73.838 Y64.767 A26.7787
+G1 X73.989 Y64.689 A26.7843
+G1 X74.143 Y64.613 A26.7900
+G1 X74.302 Y64.539 A26.7957
+G1 X74.464 Y64.467 A26.8016
+G1 X74.629 Y64.398 A26.8075
+G1 X74.799 Y64.331 A26.8135
+G1 X74.972 Y64.266 A26.8196
+G1 X75.148 Y64.205 A26.8258
+G1 X75.329 Y64.146 A26.8321
+G1 X75.513 Y64.089 A26.8384
+G1 X75.700 Y64.036 A26.8448
+G1 X75.891 Y63.986 A26.8513
+G1 X76.085 Y63.938 A26.8579
+G1 X76.283 Y63.894 A26.8646
+G1 X76.484 Y63.853 A26.8714
+G1 X76.688 Y63.816 A26.8782
+G1 X76.895 Y63.782 A26.8852
+G1 X77.105 Y63.751 A26.8922
+G1 X77.318 Y63.723 A26.8993
+G1 X77.534 Y63.699 A26.9064
+G1 X77.753 Y63.679 A26.9137
+G1 X77.974 Y63.661 A26.9210
+G1 X78.197 Y63.648 A26.9284
+G1 X78.423 Y63.638 A26.9359
+G1 X78.651 Y63.631 A26.9434
+G1 X78.881 Y63.627 A26.9510
+G1 X79.113 Y63.627 A26.9586
+G1 X79.346 Y63.631 A26.9663
+G1 X79.582 Y63.637 A26.9741
+G1 X79.818 Y63.647 A26.9819
+G1 X80.056 Y63.659 A26.9898
+G1 X80.295 Y63.675 A26.9977
+G1 X80.535 Y63.694 A27.0056
+G1 X80.775 Y63.715 A27.0136
+G1 X81.016 Y63.739 A27.0216
+G1 X81.258 Y63.766 A27.0296
+G1 X81.500 Y63.795 A27.0376
+G1 X81.742 Y63.826 A27.0457
+G1 X81.984 Y63.860 A27.0537
+G1 X82.225 Y63.895 A27.0618
+G1 X82.467 Y63.933 A27.0699
+G1 X82.708 Y63.972 A27.0779
+G1 X82.948 Y64.012 A27.0859
+G1 X83.187 Y64.054 A27.0940
+G1 X83.425 Y64.097 A27.1020
+G1 X83.663 Y64.141 A27.1099
+G1 X83.899 Y64.185 A27.1178
+G1 X84.133 Y64.230 A27.1257
+G1 X84.366 Y64.276 A27.1336
+G1 X84.598 Y64.322 A27.1414
+G1 X84.828 Y64.368 A27.1491
+G1 X85.056 Y64.414 A27.1568
+G1 X85.281 Y64.460 A27.1644
+G1 X85.505 Y64.505 A27.1719
+G1 X85.727 Y64.549 A27.1794
+G1 X85.947 Y64.593 A27.1868
+G1 X86.164 Y64.636 A27.1941
+G1 X86.379 Y64.678 A27.2013
+G1 X86.592 Y64.718 A27.2084
+G1 X86.802 Y64.757 A27.2155
+G1 X87.009 Y64.795 A27.2225
+G1 X87.214 Y64.831 A27.2293
+G1 X87.417 Y64.865 A27.2361
+G1 X87.617 Y64.898 A27.2428
+G1 X87.814 Y64.928 A27.2494
+G1 X88.008 Y64.957 A27.2558
+G1 X88.200 Y64.983 A27.2622
+G1 X88.389 Y65.007 A27.2685
+G1 X88.575 Y65.028 A27.2747
+G1 X88.759 Y65.048 A27.2808
+G1 X88.940 Y65.065 A27.2868
+G1 X89.118 Y65.079 A27.2927
+G1 X89.294 Y65.091 A27.2985
+G1 X89.466 Y65.101 A27.3042
+G1 X89.637 Y65.108 A27.3098
+G1 X89.804 Y65.112 A27.3154
+G1 X89.969 Y65.115 A27.3208
+G1 X90.131 Y65.114 A27.3262
+G1 X90.291 Y65.111 A27.3314
+G1 X90.448 Y65.106 A27.3366
+G1 X90.603 Y65.098 A27.3417
+G1 X90.755 Y65.088 A27.3468
+G1 X90.904 Y65.075 A27.3517
+G1 X91.052 Y65.060 A27.3566
+G1 X91.196 Y65.043 A27.3614
+G1 X91.339 Y65.023 A27.3662
+G1 X91.479 Y65.002 A27.3708
+G1 X91.617 Y64.978 A27.3755
+G1 X91.752 Y64.953 A27.3800
+G1 X91.886 Y64.926 A27.3845
+G1 X92.017 Y64.896 A27.3889
+G1 X92.146 Y64.865 A27.3933
+G1 X92.273 Y64.833 A27.3976
+G1 X92.397 Y64.798 A27.4019
+G1 X92.520 Y64.763 A27.4061
+G1 X92.640 Y64.725 A27.4103
+G1 X92.759 Y64.687 A27.4144
+G1 X92.875 Y64.647 A27.4184
+G1 X92.990 Y64.606 A27.4225
+G1 X93.103 Y64.564 A27.4264
+G1 X93.213 Y64.521 A27.4303
+G1 X93.322 Y64.477 A27.4342
+G1 X93.429 Y64.433 A27.4380
+G1 X93.534 Y64.387 A27.4418
+G1 X93.637 Y64.341 A27.4456
+G1 X93.739 Y64.294 A27.4492
+G1 X93.839 Y64.247 A27.4529
+G1 X93.937 Y64.200 A27.4565
+G1 X94.033 Y64.152 A27.4600
+G1 X94.127 Y64.104 A27.4635
+G1 X94.220 Y64.055 A27.4670
+G1 X94.312 Y64.006 A27.4704
+G1 X94.401 Y63.958 A27.4738
+G1 X94.489 Y63.909 A27.4771
+G1 X94.575 Y63.860 A27.4803
+G1 X94.660 Y63.812 A27.4836
+G1 X94.743 Y63.763 A27.4867
+G1 X94.825 Y63.715 A27.4899
+G1 X94.905 Y63.667 A27.4930
+G1 X94.984 Y63.619 A27.4960
+G1 X95.061 Y63.571 A27.4990
+G1 X95.137 Y63.524 A27.5019
+G1 X95.211 Y63.477 A27.5048
+G1 X95.284 Y63.431 A27.5077
+G1 X95.355 Y63.385 A27.5105
+G1 X95.426 Y63.339 A27.5133
+G1 X95.495 Y63.294 A27.5160
+G1 X95.562 Y63.249 A27.5187
+G1 X95.628 Y63.204 A27.5213
+G1 X95.694 Y63.161 A27.5239
+G1 X95.757 Y63.117 A27.5264
+G1 X95.820 Y63.074 A27.5289
+G1 X95.882 Y63.032 A27.5314
+G1 X95.942 Y62.990 A27.5338
+G1 X96.002 Y62.949 A27.5362
+G1 X96.060 Y62.908 A27.5386
+G1 X96.117 Y62.868 A27.5409
+G1 X96.173 Y62.828 A27.5432
+G1 X96.229 Y62.789 A27.5454
+G1 X96.283 Y62.750 A27.5476
+G1 X96.337 Y62.712 A27.5498
+G1 X96.390 Y62.674 A27.5519
+G1 X96.442 Y62.636 A27.5540
+G1 X96.493 Y62.599 A27.5561
+G1 X96.543 Y62.562 A27.5582
+G1 X96.593 Y62.526 A27.5602
+G1 X96.642 Y62.490 A27.5622
+G1 X96.691 Y62.454 A27.5642
+G1 X96.739 Y62.419 A27.5662
+G1 X96.787 Y62.384 A27.5681
+G1 X96.834 Y62.349 A27.5701
+G1 X96.881 Y62.314 A27.5720
+G1 X96.927 Y62.280 A27.5739
+G1 X96.973 Y62.246 A27.5758
+G1 X97.019 Y62.212 A27.5777
+G1 X97.065 Y62.178 A27.5796
+G1 X97.110 Y62.144 A27.5814
+G1 X97.156 Y62.110 A27.5833
+G1 X97.201 Y62.076 A27.5852
+G1 X97.246 Y62.042 A27.5870
+G1 X97.291 Y62.008 A27.5889
+G1 X97.337 Y61.974 A27.5908
+G1 X97.382 Y61.940 A27.5927
+G1 X97.428 Y61.905 A27.5945
+G1 X97.474 Y61.871 A27.5964
+G1 X97.520 Y61.836 A27.5984
+G1 X97.566 Y61.801 A27.6003
+G1 X97.613 Y61.765 A27.6022
+G1 X97.661 Y61.729 A27.6042
+G1 X97.708 Y61.693 A27.6062
+G1 X97.757 Y61.657 A27.6082
+G1 X97.806 Y61.619 A27.6102
+G1 X97.855 Y61.582 A27.6122
+G1 X97.906 Y61.544 A27.6143
+G0 X0 Y0
+M2
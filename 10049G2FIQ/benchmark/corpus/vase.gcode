@@ -0,0 +1,4510 @@
+; vase - spiral vase, Z rising continuously, 30 turns
+G21
+G90
+G92 A0
+G1 A-1.0000 F2400
+G0 X130.000 Y100.000
+G1 A0.0000 F2400
+G1 F2400
+G1 X130.597 Y101.282 Z0.3013 A0.0423
+G1 X131.111 Y102.612 Z0.3027 A0.0855
+G1 X131.513 Y103.981 Z0.3040 A0.1294
+G1 X131.778 Y105.375 Z0.3053 A0.1739
+G1 X131.886 Y106.778 Z0.3067 A0.2190
+G1 X131.821 Y108.170 Z0.3080 A0.2644
+G1 X131.576 Y109.533 Z0.3093 A0.3100
+G1 X131.149 Y110.847 Z0.3107 A0.3556
+G1 X130.546 Y112.094 Z0.3120 A0.4010
+G1 X129.780 Y113.259 Z0.3133 A0.4461
+G1 X128.868 Y114.330 Z0.3147 A0.4906
+G1 X127.834 Y115.302 Z0.3160 A0.5345
+G1 X126.705 Y116.173 Z0.3173 A0.5777
+G1 X125.507 Y116.947 Z0.3187 A0.6200
+G1 X124.271 Y117.634 Z0.3200 A0.6615
+G1 X123.022 Y118.247 Z0.3213 A0.7021
+G1 X121.786 Y118.805 Z0.3227 A0.7419
+G1 X120.584 Y119.329 Z0.3240 A0.7809
+G1 X119.430 Y119.841 Z0.3253 A0.8193
+G1 X118.335 Y120.364 Z0.3267 A0.8572
+G1 X117.304 Y120.917 Z0.3280 A0.8947
+G1 X116.334 Y121.519 Z0.3293 A0.9320
+G1 X115.419 Y122.185 Z0.3307 A0.9694
+G1 X114.546 Y122.921 Z0.3320 A1.0069
+G1 X113.701 Y123.731 Z0.3333 A1.0448
+G1 X112.866 Y124.610 Z0.3347 A1.0832
+G1 X112.023 Y125.549 Z0.3360 A1.1222
+G1 X111.153 Y126.531 Z0.3373 A1.1620
+G1 X110.240 Y127.534 Z0.3387 A1.2026
+G1 X109.271 Y128.532 Z0.3400 A1.2441
+G1 X108.235 Y129.496 Z0.3413 A1.2864
+G1 X107.129 Y130.395 Z0.3427 A1.3296
+G1 X105.952 Y131.201 Z0.3440 A1.3735
+G1 X104.708 Y131.884 Z0.3453 A1.4180
+G1 X103.407 Y132.420 Z0.3467 A1.4631
+G1 X102.063 Y132.788 Z0.3480 A1.5085
+G1 X100.691 Y132.976 Z0.3493 A1.5541
+G1 X99.309 Y132.976 Z0.3507 A1.5997
+G1 X97.937 Y132.788 Z0.3520 A1.6451
+G1 X96.593 Y132.420 Z0.3533 A1.6901
+G1 X95.292 Y131.884 Z0.3547 A1.7347
+G1 X94.048 Y131.201 Z0.3560 A1.7786
+G1 X92.871 Y130.395 Z0.3573 A1.8218
+G1 X91.765 Y129.496 Z0.3587 A1.8641
+G1 X90.729 Y128.532 Z0.3600 A1.9056
+G1 X89.760 Y127.534 Z0.3613 A1.9462
+G1 X88.847 Y126.531 Z0.3627 A1.9860
+G1 X87.977 Y125.549 Z0.3640 A2.0250
+G1 X87.134 Y124.610 Z0.3653 A2.0634
+G1 X86.299 Y123.731 Z0.3667 A2.1012
+G1 X85.454 Y122.921 Z0.3680 A2.1388
+G1 X84.581 Y122.185 Z0.3693 A2.1761
+G1 X83.666 Y121.519 Z0.3707 A2.2135
+G1 X82.696 Y120.917 Z0.3720 A2.2510
+G1 X81.665 Y120.364 Z0.3733 A2.2889
+G1 X80.570 Y119.841 Z0.3747 A2.3273
+G1 X79.416 Y119.329 Z0.3760 A2.3663
+G1 X78.214 Y118.805 Z0.3773 A2.4061
+G1 X76.978 Y118.247 Z0.3787 A2.4467
+G1 X75.729 Y117.634 Z0.3800 A2.4881
+G1 X74.493 Y116.947 Z0.3813 A2.5305
+G1 X73.295 Y116.173 Z0.3827 A2.5736
+G1 X72.166 Y115.302 Z0.3840 A2.6175
+G1 X71.132 Y114.330 Z0.3853 A2.6621
+G1 X70.220 Y113.259 Z0.3867 A2.7071
+G1 X69.454 Y112.094 Z0.3880 A2.7526
+G1 X68.851 Y110.847 Z0.3893 A2.7982
+G1 X68.424 Y109.533 Z0.3907 A2.8437
+G1 X68.179 Y108.170 Z0.3920 A2.8892
+G1 X68.114 Y106.778 Z0.3933 A2.9342
+G1 X68.222 Y105.375 Z0.3947 A2.9788
+G1 X68.487 Y103.981 Z0.3960 A3.0227
+G1 X68.889 Y102.612 Z0.3973 A3.0658
+G1 X69.403 Y101.282 Z0.3987 A3.1082
+G1 X70.000 Y100.000 Z0.4000 A3.1496
+G1 X70.650 Y98.770 Z0.4013 A3.1902
+G1 X71.321 Y97.592 Z0.4027 A3.2300
+G1 X71.986 Y96.461 Z0.4040 A3.2691
+G1 X72.618 Y95.369 Z0.4053 A3.3074
+G1 X73.197 Y94.303 Z0.4067 A3.3453
+G1 X73.706 Y93.249 Z0.4080 A3.3828
+G1 X74.137 Y92.191 Z0.4093 A3.4202
+G1 X74.486 Y91.115 Z0.4107 A3.4575
+G1 X74.760 Y90.007 Z0.4120 A3.4951
+G1 X74.967 Y88.855 Z0.4133 A3.5329
+G1 X75.126 Y87.652 Z0.4147 A3.5713
+G1 X75.256 Y86.397 Z0.4160 A3.6104
+G1 X75.383 Y85.091 Z0.4173 A3.6501
+G1 X75.532 Y83.743 Z0.4187 A3.6907
+G1 X75.729 Y82.366 Z0.4200 A3.7322
+G1 X76.000 Y80.978 Z0.4213 A3.7745
+G1 X76.366 Y79.600 Z0.4227 A3.8177
+G1 X76.846 Y78.256 Z0.4240 A3.8616
+G1 X77.450 Y76.973 Z0.4253 A3.9062
+G1 X78.188 Y75.775 Z0.4267 A3.9512
+G1 X79.059 Y74.686 Z0.4280 A3.9966
+G1 X80.058 Y73.728 Z0.4293 A4.0422
+G1 X81.176 Y72.916 Z0.4307 A4.0878
+G1 X82.396 Y72.261 Z0.4320 A4.1332
+G1 X83.701 Y71.769 Z0.4333 A4.1783
+G1 X85.068 Y71.438 Z0.4347 A4.2228
+G1 X86.476 Y71.260 Z0.4360 A4.2667
+G1 X87.902 Y71.219 Z0.4373 A4.3099
+G1 X89.325 Y71.297 Z0.4387 A4.3522
+G1 X90.729 Y71.468 Z0.4400 A4.3937
+G1 X92.100 Y71.706 Z0.4413 A4.4343
+G1 X93.428 Y71.981 Z0.4427 A4.4741
+G1 X94.709 Y72.264 Z0.4440 A4.5131
+G1 X95.943 Y72.527 Z0.4453 A4.5515
+G1 X97.136 Y72.748 Z0.4467 A4.5894
+G1 X98.295 Y72.907 Z0.4480 A4.6269
+G1 X99.434 Y72.989 Z0.4493 A4.6643
+G1 X100.566 Y72.989 Z0.4507 A4.7016
+G1 X101.705 Y72.907 Z0.4520 A4.7391
+G1 X102.864 Y72.748 Z0.4533 A4.7770
+G1 X104.057 Y72.527 Z0.4547 A4.8154
+G1 X105.291 Y72.264 Z0.4560 A4.8544
+G1 X106.572 Y71.981 Z0.4573 A4.8942
+G1 X107.900 Y71.706 Z0.4587 A4.9348
+G1 X109.271 Y71.468 Z0.4600 A4.9763
+G1 X110.675 Y71.297 Z0.4613 A5.0186
+G1 X112.098 Y71.219 Z0.4627 A5.0618
+G1 X113.524 Y71.260 Z0.4640 A5.1057
+G1 X114.932 Y71.438 Z0.4653 A5.1502
+G1 X116.299 Y71.769 Z0.4667 A5.1953
+G1 X117.604 Y72.261 Z0.4680 A5.2407
+G1 X118.824 Y72.916 Z0.4693 A5.2863
+G1 X119.942 Y73.728 Z0.4707 A5.3319
+G1 X120.941 Y74.686 Z0.4720 A5.3773
+G1 X121.812 Y75.775 Z0.4733 A5.4224
+G1 X122.550 Y76.973 Z0.4747 A5.4669
+G1 X123.154 Y78.256 Z0.4760 A5.5108
+G1 X123.634 Y79.600 Z0.4773 A5.5540
+G1 X124.000 Y80.978 Z0.4787 A5.5963
+G1 X124.271 Y82.366 Z0.4800 A5.6378
+G1 X124.468 Y83.743 Z0.4813 A5.6784
+G1 X124.617 Y85.091 Z0.4827 A5.7182
+G1 X124.744 Y86.397 Z0.4840 A5.7572
+G1 X124.874 Y87.652 Z0.4853 A5.7956
+G1 X125.033 Y88.855 Z0.4867 A5.8335
+G1 X125.240 Y90.007 Z0.4880 A5.8710
+G1 X125.514 Y91.115 Z0.4893 A5.9083
+G1 X125.863 Y92.191 Z0.4907 A5.9457
+G1 X126.294 Y93.249 Z0.4920 A5.9832
+G1 X126.803 Y94.303 Z0.4933 A6.0211
+G1 X127.382 Y95.369 Z0.4947 A6.0595
+G1 X128.014 Y96.461 Z0.4960 A6.0985
+G1 X128.679 Y97.592 Z0.4973 A6.1383
+G1 X129.350 Y98.770 Z0.4987 A6.1789
+G1 X130.000 Y100.000 Z0.5000 A6.2204
+G1 X130.647 Y101.284 Z0.5013 A6.2628
+G1 X131.161 Y102.617 Z0.5027 A6.3060
+G1 X131.562 Y103.987 Z0.5040 A6.3500
+G1 X131.827 Y105.383 Z0.5053 A6.3946
+G1 X131.935 Y106.788 Z0.5067 A6.4397
+G1 X131.869 Y108.183 Z0.5080 A6.4852
+G1 X131.624 Y109.548 Z0.5093 A6.5308
+G1 X131.196 Y110.864 Z0.5107 A6.5765
+G1 X130.593 Y112.112 Z0.5120 A6.6220
+G1 X129.826 Y113.279 Z0.5133 A6.6671
+G1 X128.913 Y114.353 Z0.5147 A6.7117
+G1 X127.878 Y115.326 Z0.5160 A6.7557
+G1 X126.747 Y116.199 Z0.5173 A6.7989
+G1 X125.549 Y116.975 Z0.5187 A6.8413
+G1 X124.311 Y117.663 Z0.5200 A6.8829
+G1 X123.061 Y118.278 Z0.5213 A6.9236
+G1 X121.824 Y118.838 Z0.5227 A6.9634
+G1 X120.620 Y119.364 Z0.5240 A7.0025
+G1 X119.465 Y119.877 Z0.5253 A7.0410
+G1 X118.369 Y120.401 Z0.5267 A7.0789
+G1 X117.336 Y120.956 Z0.5280 A7.1165
+G1 X116.364 Y121.559 Z0.5293 A7.1539
+G1 X115.447 Y122.226 Z0.5307 A7.1913
+G1 X114.573 Y122.963 Z0.5320 A7.2289
+G1 X113.726 Y123.774 Z0.5333 A7.2669
+G1 X112.889 Y124.655 Z0.5347 A7.3053
+G1 X112.044 Y125.595 Z0.5360 A7.3444
+G1 X111.172 Y126.577 Z0.5373 A7.3843
+G1 X110.257 Y127.581 Z0.5387 A7.4250
+G1 X109.286 Y128.579 Z0.5400 A7.4665
+G1 X108.249 Y129.544 Z0.5413 A7.5089
+G1 X107.141 Y130.444 Z0.5427 A7.5521
+G1 X105.961 Y131.250 Z0.5440 A7.5961
+G1 X104.715 Y131.933 Z0.5453 A7.6407
+G1 X103.413 Y132.469 Z0.5467 A7.6858
+G1 X102.066 Y132.838 Z0.5480 A7.7313
+G1 X100.692 Y133.026 Z0.5493 A7.7770
+G1 X99.308 Y133.026 Z0.5507 A7.8227
+G1 X97.934 Y132.838 Z0.5520 A7.8681
+G1 X96.587 Y132.469 Z0.5533 A7.9133
+G1 X95.285 Y131.933 Z0.5547 A7.9579
+G1 X94.039 Y131.250 Z0.5560 A8.0019
+G1 X92.859 Y130.444 Z0.5573 A8.0451
+G1 X91.751 Y129.544 Z0.5587 A8.0875
+G1 X90.714 Y128.579 Z0.5600 A8.1290
+G1 X89.743 Y127.581 Z0.5613 A8.1697
+G1 X88.828 Y126.577 Z0.5627 A8.2096
+G1 X87.956 Y125.595 Z0.5640 A8.2487
+G1 X87.111 Y124.655 Z0.5653 A8.2871
+G1 X86.274 Y123.774 Z0.5667 A8.3251
+G1 X85.427 Y122.963 Z0.5680 A8.3627
+G1 X84.553 Y122.226 Z0.5693 A8.4001
+G1 X83.636 Y121.559 Z0.5707 A8.4375
+G1 X82.664 Y120.956 Z0.5720 A8.4751
+G1 X81.631 Y120.401 Z0.5733 A8.5130
+G1 X80.535 Y119.877 Z0.5747 A8.5515
+G1 X79.380 Y119.364 Z0.5760 A8.5906
+G1 X78.176 Y118.838 Z0.5773 A8.6304
+G1 X76.939 Y118.278 Z0.5787 A8.6711
+G1 X75.689 Y117.663 Z0.5800 A8.7126
+G1 X74.451 Y116.975 Z0.5813 A8.7550
+G1 X73.253 Y116.199 Z0.5827 A8.7983
+G1 X72.122 Y115.326 Z0.5840 A8.8422
+G1 X71.087 Y114.353 Z0.5853 A8.8869
+G1 X70.174 Y113.279 Z0.5867 A8.9320
+G1 X69.407 Y112.112 Z0.5880 A8.9775
+G1 X68.804 Y110.864 Z0.5893 A9.0231
+G1 X68.376 Y109.548 Z0.5907 A9.0688
+G1 X68.131 Y108.183 Z0.5920 A9.1143
+G1 X68.065 Y106.788 Z0.5933 A9.1594
+G1 X68.173 Y105.383 Z0.5947 A9.2040
+G1 X68.438 Y103.987 Z0.5960 A9.2480
+G1 X68.839 Y102.617 Z0.5973 A9.2912
+G1 X69.353 Y101.284 Z0.5987 A9.3336
+G1 X69.950 Y100.000 Z0.6000 A9.3752
+G1 X70.600 Y98.768 Z0.6013 A9.4158
+G1 X71.271 Y97.588 Z0.6027 A9.4557
+G1 X71.936 Y96.455 Z0.6040 A9.4948
+G1 X72.569 Y95.360 Z0.6053 A9.5333
+G1 X73.148 Y94.292 Z0.6067 A9.5712
+G1 X73.658 Y93.236 Z0.6080 A9.6088
+G1 X74.089 Y92.177 Z0.6093 A9.6462
+G1 X74.439 Y91.099 Z0.6107 A9.6836
+G1 X74.713 Y89.988 Z0.6120 A9.7212
+G1 X74.921 Y88.834 Z0.6133 A9.7592
+G1 X75.081 Y87.630 Z0.6147 A9.7976
+G1 X75.212 Y86.373 Z0.6160 A9.8367
+G1 X75.340 Y85.065 Z0.6173 A9.8766
+G1 X75.490 Y83.716 Z0.6187 A9.9172
+G1 X75.689 Y82.337 Z0.6200 A9.9588
+G1 X75.961 Y80.947 Z0.6213 A10.0012
+G1 X76.329 Y79.567 Z0.6227 A10.0444
+G1 X76.809 Y78.222 Z0.6240 A10.0884
+G1 X77.415 Y76.937 Z0.6253 A10.1330
+G1 X78.154 Y75.738 Z0.6267 A10.1781
+G1 X79.027 Y74.648 Z0.6280 A10.2236
+G1 X80.028 Y73.688 Z0.6293 A10.2693
+G1 X81.147 Y72.875 Z0.6307 A10.3149
+G1 X82.370 Y72.219 Z0.6320 A10.3604
+G1 X83.676 Y71.726 Z0.6333 A10.4056
+G1 X85.045 Y71.394 Z0.6347 A10.4502
+G1 X86.455 Y71.214 Z0.6360 A10.4941
+G1 X87.882 Y71.173 Z0.6373 A10.5374
+G1 X89.308 Y71.250 Z0.6387 A10.5798
+G1 X90.714 Y71.421 Z0.6400 A10.6213
+G1 X92.087 Y71.658 Z0.6413 A10.6620
+G1 X93.417 Y71.932 Z0.6427 A10.7018
+G1 X94.700 Y72.214 Z0.6440 A10.7409
+G1 X95.936 Y72.478 Z0.6453 A10.7794
+G1 X97.130 Y72.698 Z0.6467 A10.8173
+G1 X98.292 Y72.857 Z0.6480 A10.8549
+G1 X99.433 Y72.940 Z0.6493 A10.8924
+G1 X100.567 Y72.940 Z0.6507 A10.9298
+G1 X101.708 Y72.857 Z0.6520 A10.9674
+G1 X102.870 Y72.698 Z0.6533 A11.0053
+G1 X104.064 Y72.478 Z0.6547 A11.0438
+G1 X105.300 Y72.214 Z0.6560 A11.0829
+G1 X106.583 Y71.932 Z0.6573 A11.1227
+G1 X107.913 Y71.658 Z0.6587 A11.1634
+G1 X109.286 Y71.421 Z0.6600 A11.2049
+G1 X110.692 Y71.250 Z0.6613 A11.2473
+G1 X112.118 Y71.173 Z0.6627 A11.2906
+G1 X113.545 Y71.214 Z0.6640 A11.3345
+G1 X114.955 Y71.394 Z0.6653 A11.3792
+G1 X116.324 Y71.726 Z0.6667 A11.4243
+G1 X117.630 Y72.219 Z0.6680 A11.4698
+G1 X118.853 Y72.875 Z0.6693 A11.5154
+G1 X119.972 Y73.688 Z0.6707 A11.5611
+G1 X120.973 Y74.648 Z0.6720 A11.6066
+G1 X121.846 Y75.738 Z0.6733 A11.6517
+G1 X122.585 Y76.937 Z0.6747 A11.6963
+G1 X123.191 Y78.222 Z0.6760 A11.7403
+G1 X123.671 Y79.567 Z0.6773 A11.7835
+G1 X124.039 Y80.947 Z0.6787 A11.8259
+G1 X124.311 Y82.337 Z0.6800 A11.8675
+G1 X124.510 Y83.716 Z0.6813 A11.9081
+G1 X124.660 Y85.065 Z0.6827 A11.9480
+G1 X124.788 Y86.373 Z0.6840 A11.9871
+G1 X124.919 Y87.630 Z0.6853 A12.0255
+G1 X125.079 Y88.834 Z0.6867 A12.0635
+G1 X125.287 Y89.988 Z0.6880 A12.1011
+G1 X125.561 Y91.099 Z0.6893 A12.1385
+G1 X125.911 Y92.177 Z0.6907 A12.1759
+G1 X126.342 Y93.236 Z0.6920 A12.2135
+G1 X126.852 Y94.292 Z0.6933 A12.2515
+G1 X127.431 Y95.360 Z0.6947 A12.2899
+G1 X128.064 Y96.455 Z0.6960 A12.3290
+G1 X128.729 Y97.588 Z0.6973 A12.3689
+G1 X129.400 Y98.768 Z0.6987 A12.4095
+G1 X130.050 Y100.000 Z0.7000 A12.4511
+G1 X130.697 Y101.287 Z0.7013 A12.4935
+G1 X131.210 Y102.621 Z0.7027 A12.5368
+G1 X131.612 Y103.994 Z0.7040 A12.5809
+G1 X131.877 Y105.392 Z0.7053 A12.6256
+G1 X131.984 Y106.798 Z0.7067 A12.6708
+G1 X131.918 Y108.195 Z0.7080 A12.7163
+G1 X131.672 Y109.562 Z0.7093 A12.7621
+G1 X131.243 Y110.880 Z0.7107 A12.8078
+G1 X130.639 Y112.131 Z0.7120 A12.8533
+G1 X129.871 Y113.300 Z0.7133 A12.8985
+G1 X128.958 Y114.375 Z0.7147 A12.9432
+G1 X127.922 Y115.350 Z0.7160 A12.9873
+G1 X126.790 Y116.225 Z0.7173 A13.0306
+G1 X125.590 Y117.002 Z0.7187 A13.0730
+G1 X124.351 Y117.692 Z0.7200 A13.1146
+G1 X123.100 Y118.309 Z0.7213 A13.1554
+G1 X121.862 Y118.871 Z0.7227 A13.1953
+G1 X120.657 Y119.398 Z0.7240 A13.2345
+G1 X119.500 Y119.913 Z0.7253 A13.2730
+G1 X118.402 Y120.438 Z0.7267 A13.3110
+G1 X117.368 Y120.994 Z0.7280 A13.3487
+G1 X116.395 Y121.599 Z0.7293 A13.3862
+G1 X115.476 Y122.267 Z0.7307 A13.4236
+G1 X114.600 Y123.005 Z0.7320 A13.4613
+G1 X113.751 Y123.817 Z0.7333 A13.4993
+G1 X112.912 Y124.699 Z0.7347 A13.5378
+G1 X112.065 Y125.640 Z0.7360 A13.5770
+G1 X111.191 Y126.623 Z0.7373 A13.6169
+G1 X110.275 Y127.628 Z0.7387 A13.6577
+G1 X109.301 Y128.627 Z0.7400 A13.6993
+G1 X108.262 Y129.592 Z0.7413 A13.7418
+G1 X107.152 Y130.493 Z0.7427 A13.7851
+G1 X105.971 Y131.299 Z0.7440 A13.8291
+G1 X104.723 Y131.983 Z0.7453 A13.8738
+G1 X103.418 Y132.519 Z0.7467 A13.9190
+G1 X102.069 Y132.888 Z0.7480 A13.9645
+G1 X100.693 Y133.076 Z0.7493 A14.0103
+G1 X99.307 Y133.076 Z0.7507 A14.0560
+G1 X97.931 Y132.888 Z0.7520 A14.1016
+G1 X96.582 Y132.519 Z0.7533 A14.1468
+G1 X95.277 Y131.983 Z0.7547 A14.1914
+G1 X94.029 Y131.299 Z0.7560 A14.2355
+G1 X92.848 Y130.493 Z0.7573 A14.2788
+G1 X91.738 Y129.592 Z0.7587 A14.3212
+G1 X90.699 Y128.627 Z0.7600 A14.3629
+G1 X89.725 Y127.628 Z0.7613 A14.4036
+G1 X88.809 Y126.623 Z0.7627 A14.4435
+G1 X87.935 Y125.640 Z0.7640 A14.4827
+G1 X87.088 Y124.699 Z0.7653 A14.5212
+G1 X86.249 Y123.817 Z0.7667 A14.5592
+G1 X85.400 Y123.005 Z0.7680 A14.5969
+G1 X84.524 Y122.267 Z0.7693 A14.6344
+G1 X83.605 Y121.599 Z0.7707 A14.6719
+G1 X82.632 Y120.994 Z0.7720 A14.7095
+G1 X81.598 Y120.438 Z0.7733 A14.7475
+G1 X80.500 Y119.913 Z0.7747 A14.7861
+G1 X79.343 Y119.398 Z0.7760 A14.8252
+G1 X78.138 Y118.871 Z0.7773 A14.8652
+G1 X76.900 Y118.309 Z0.7787 A14.9059
+G1 X75.649 Y117.692 Z0.7800 A14.9475
+G1 X74.410 Y117.002 Z0.7813 A14.9900
+G1 X73.210 Y116.225 Z0.7827 A15.0333
+G1 X72.078 Y115.350 Z0.7840 A15.0773
+G1 X71.042 Y114.375 Z0.7853 A15.1220
+G1 X70.129 Y113.300 Z0.7867 A15.1672
+G1 X69.361 Y112.131 Z0.7880 A15.2128
+G1 X68.757 Y110.880 Z0.7893 A15.2585
+G1 X68.328 Y109.562 Z0.7907 A15.3042
+G1 X68.082 Y108.195 Z0.7920 A15.3498
+G1 X68.016 Y106.798 Z0.7933 A15.3950
+G1 X68.123 Y105.392 Z0.7947 A15.4397
+G1 X68.388 Y103.994 Z0.7960 A15.4837
+G1 X68.790 Y102.621 Z0.7973 A15.5270
+G1 X69.303 Y101.287 Z0.7987 A15.5695
+G1 X69.900 Y100.000 Z0.8000 A15.6111
+G1 X70.550 Y98.766 Z0.8013 A15.6518
+G1 X71.221 Y97.583 Z0.8027 A15.6917
+G1 X71.887 Y96.448 Z0.8040 A15.7309
+G1 X72.520 Y95.352 Z0.8053 A15.7694
+G1 X73.099 Y94.282 Z0.8067 A15.8075
+G1 X73.609 Y93.224 Z0.8080 A15.8451
+G1 X74.041 Y92.162 Z0.8093 A15.8826
+G1 X74.392 Y91.082 Z0.8107 A15.9201
+G1 X74.667 Y89.970 Z0.8120 A15.9577
+G1 X74.876 Y88.814 Z0.8133 A15.9958
+G1 X75.036 Y87.608 Z0.8147 A16.0343
+G1 X75.168 Y86.349 Z0.8160 A16.0735
+G1 X75.297 Y85.039 Z0.8173 A16.1134
+G1 X75.449 Y83.688 Z0.8187 A16.1541
+G1 X75.649 Y82.308 Z0.8200 A16.1957
+G1 X75.922 Y80.916 Z0.8213 A16.2382
+G1 X76.291 Y79.535 Z0.8227 A16.2815
+G1 X76.773 Y78.188 Z0.8240 A16.3255
+G1 X77.380 Y76.902 Z0.8253 A16.3702
+G1 X78.121 Y75.701 Z0.8267 A16.4154
+G1 X78.995 Y74.609 Z0.8280 A16.4610
+G1 X79.998 Y73.648 Z0.8293 A16.5067
+G1 X81.119 Y72.833 Z0.8307 A16.5524
+G1 X82.343 Y72.177 Z0.8320 A16.5980
+G1 X83.651 Y71.683 Z0.8333 A16.6432
+G1 X85.022 Y71.350 Z0.8347 A16.6879
+G1 X86.433 Y71.169 Z0.8360 A16.7319
+G1 X87.863 Y71.127 Z0.8373 A16.7752
+G1 X89.291 Y71.203 Z0.8387 A16.8177
+G1 X90.699 Y71.373 Z0.8400 A16.8593
+G1 X92.073 Y71.610 Z0.8413 A16.9000
+G1 X93.405 Y71.883 Z0.8427 A16.9400
+G1 X94.690 Y72.165 Z0.8440 A16.9791
+G1 X95.929 Y72.428 Z0.8453 A17.0177
+G1 X97.125 Y72.649 Z0.8467 A17.0557
+G1 X98.289 Y72.807 Z0.8480 A17.0933
+G1 X99.432 Y72.890 Z0.8493 A17.1308
+G1 X100.568 Y72.890 Z0.8507 A17.1683
+G1 X101.711 Y72.807 Z0.8520 A17.2060
+G1 X102.875 Y72.649 Z0.8533 A17.2440
+G1 X104.071 Y72.428 Z0.8547 A17.2825
+G1 X105.310 Y72.165 Z0.8560 A17.3217
+G1 X106.595 Y71.883 Z0.8573 A17.3616
+G1 X107.927 Y71.610 Z0.8587 A17.4023
+G1 X109.301 Y71.373 Z0.8600 A17.4439
+G1 X110.709 Y71.203 Z0.8613 A17.4864
+G1 X112.137 Y71.127 Z0.8627 A17.5297
+G1 X113.567 Y71.169 Z0.8640 A17.5738
+G1 X114.978 Y71.350 Z0.8653 A17.6184
+G1 X116.349 Y71.683 Z0.8667 A17.6636
+G1 X117.657 Y72.177 Z0.8680 A17.7092
+G1 X118.881 Y72.833 Z0.8693 A17.7549
+G1 X120.002 Y73.648 Z0.8707 A17.8007
+G1 X121.005 Y74.609 Z0.8720 A17.8462
+G1 X121.879 Y75.701 Z0.8733 A17.8914
+G1 X122.620 Y76.902 Z0.8747 A17.9361
+G1 X123.227 Y78.188 Z0.8760 A17.9801
+G1 X123.709 Y79.535 Z0.8773 A18.0234
+G1 X124.078 Y80.916 Z0.8787 A18.0659
+G1 X124.351 Y82.308 Z0.8800 A18.1075
+G1 X124.551 Y83.688 Z0.8813 A18.1483
+G1 X124.703 Y85.039 Z0.8827 A18.1882
+G1 X124.832 Y86.349 Z0.8840 A18.2273
+G1 X124.964 Y87.608 Z0.8853 A18.2659
+G1 X125.124 Y88.814 Z0.8867 A18.3039
+G1 X125.333 Y89.970 Z0.8880 A18.3415
+G1 X125.608 Y91.082 Z0.8893 A18.3790
+G1 X125.959 Y92.162 Z0.8907 A18.4165
+G1 X126.391 Y93.224 Z0.8920 A18.4542
+G1 X126.901 Y94.282 Z0.8933 A18.4922
+G1 X127.480 Y95.352 Z0.8947 A18.5307
+G1 X128.113 Y96.448 Z0.8960 A18.5699
+G1 X128.779 Y97.583 Z0.8973 A18.6098
+G1 X129.450 Y98.766 Z0.8987 A18.6506
+G1 X130.100 Y100.000 Z0.9000 A18.6922
+G1 X130.747 Y101.289 Z0.9013 A18.7347
+G1 X131.260 Y102.625 Z0.9027 A18.7781
+G1 X131.662 Y104.000 Z0.9040 A18.8222
+G1 X131.926 Y105.400 Z0.9053 A18.8669
+G1 X132.032 Y106.809 Z0.9067 A18.9122
+G1 X131.966 Y108.208 Z0.9080 A18.9578
+G1 X131.719 Y109.577 Z0.9093 A19.0036
+G1 X131.291 Y110.897 Z0.9107 A19.0494
+G1 X130.686 Y112.149 Z0.9120 A19.0950
+G1 X129.917 Y113.320 Z0.9133 A19.1403
+G1 X129.003 Y114.397 Z0.9147 A19.1851
+G1 X127.966 Y115.374 Z0.9160 A19.2292
+G1 X126.833 Y116.251 Z0.9173 A19.2725
+G1 X125.632 Y117.030 Z0.9187 A19.3151
+G1 X124.392 Y117.722 Z0.9200 A19.3568
+G1 X123.140 Y118.340 Z0.9213 A19.3976
+G1 X121.900 Y118.903 Z0.9227 A19.4376
+G1 X120.693 Y119.432 Z0.9240 A19.4768
+G1 X119.535 Y119.948 Z0.9253 A19.5154
+G1 X118.436 Y120.475 Z0.9267 A19.5535
+G1 X117.400 Y121.033 Z0.9280 A19.5912
+G1 X116.425 Y121.639 Z0.9293 A19.6288
+G1 X115.504 Y122.308 Z0.9307 A19.6663
+G1 X114.626 Y123.047 Z0.9320 A19.7041
+G1 X113.776 Y123.861 Z0.9333 A19.7421
+G1 X112.935 Y124.743 Z0.9347 A19.7807
+G1 X112.086 Y125.685 Z0.9360 A19.8200
+G1 X111.211 Y126.669 Z0.9373 A19.8600
+G1 X110.292 Y127.674 Z0.9387 A19.9008
+G1 X109.317 Y128.674 Z0.9400 A19.9425
+G1 X108.276 Y129.640 Z0.9413 A19.9850
+G1 X107.163 Y130.541 Z0.9427 A20.0284
+G1 X105.980 Y131.348 Z0.9440 A20.0725
+G1 X104.730 Y132.032 Z0.9453 A20.1172
+G1 X103.423 Y132.569 Z0.9467 A20.1625
+G1 X102.072 Y132.938 Z0.9480 A20.2081
+G1 X100.694 Y133.126 Z0.9493 A20.2539
+G1 X99.306 Y133.126 Z0.9507 A20.2997
+G1 X97.928 Y132.938 Z0.9520 A20.3453
+G1 X96.577 Y132.569 Z0.9533 A20.3906
+G1 X95.270 Y132.032 Z0.9547 A20.4354
+G1 X94.020 Y131.348 Z0.9560 A20.4795
+G1 X92.837 Y130.541 Z0.9573 A20.5228
+G1 X91.724 Y129.640 Z0.9587 A20.5654
+G1 X90.683 Y128.674 Z0.9600 A20.6071
+G1 X89.708 Y127.674 Z0.9613 A20.6479
+G1 X88.789 Y126.669 Z0.9627 A20.6879
+G1 X87.914 Y125.685 Z0.9640 A20.7271
+G1 X87.065 Y124.743 Z0.9653 A20.7657
+G1 X86.224 Y123.861 Z0.9667 A20.8038
+G1 X85.374 Y123.047 Z0.9680 A20.8415
+G1 X84.496 Y122.308 Z0.9693 A20.8791
+G1 X83.575 Y121.639 Z0.9707 A20.9166
+G1 X82.600 Y121.033 Z0.9720 A20.9543
+G1 X81.564 Y120.475 Z0.9733 A20.9924
+G1 X80.465 Y119.948 Z0.9747 A21.0310
+G1 X79.307 Y119.432 Z0.9760 A21.0703
+G1 X78.100 Y118.903 Z0.9773 A21.1103
+G1 X76.860 Y118.340 Z0.9787 A21.1511
+G1 X75.608 Y117.722 Z0.9800 A21.1927
+G1 X74.368 Y117.030 Z0.9813 A21.2353
+G1 X73.167 Y116.251 Z0.9827 A21.2786
+G1 X72.034 Y115.374 Z0.9840 A21.3228
+G1 X70.997 Y114.397 Z0.9853 A21.3675
+G1 X70.083 Y113.320 Z0.9867 A21.4128
+G1 X69.314 Y112.149 Z0.9880 A21.4584
+G1 X68.709 Y110.897 Z0.9893 A21.5042
+G1 X68.281 Y109.577 Z0.9907 A21.5500
+G1 X68.034 Y108.208 Z0.9920 A21.5956
+G1 X67.968 Y106.809 Z0.9933 A21.6409
+G1 X68.074 Y105.400 Z0.9947 A21.6857
+G1 X68.338 Y104.000 Z0.9960 A21.7298
+G1 X68.740 Y102.625 Z0.9973 A21.7731
+G1 X69.253 Y101.289 Z0.9987 A21.8157
+G1 X69.850 Y100.000 Z1.0000 A21.8573
+G1 X70.500 Y98.764 Z1.0013 A21.8982
+G1 X71.172 Y97.579 Z1.0027 A21.9381
+G1 X71.837 Y96.442 Z1.0040 A21.9774
+G1 X72.470 Y95.344 Z1.0053 A22.0160
+G1 X73.050 Y94.272 Z1.0067 A22.0541
+G1 X73.561 Y93.212 Z1.0080 A22.0918
+G1 X73.993 Y92.148 Z1.0093 A22.1294
+G1 X74.345 Y91.066 Z1.0107 A22.1669
+G1 X74.620 Y89.951 Z1.0120 A22.2046
+G1 X74.830 Y88.794 Z1.0133 A22.2427
+G1 X74.991 Y87.586 Z1.0147 A22.2813
+G1 X75.125 Y86.325 Z1.0160 A22.3206
+G1 X75.254 Y85.014 Z1.0173 A22.3605
+G1 X75.407 Y83.660 Z1.0187 A22.4014
+G1 X75.608 Y82.278 Z1.0200 A22.4430
+G1 X75.883 Y80.885 Z1.0213 A22.4856
+G1 X76.253 Y79.502 Z1.0227 A22.5289
+G1 X76.736 Y78.154 Z1.0240 A22.5731
+G1 X77.345 Y76.866 Z1.0253 A22.6178
+G1 X78.087 Y75.663 Z1.0267 A22.6631
+G1 X78.963 Y74.571 Z1.0280 A22.7087
+G1 X79.967 Y73.608 Z1.0293 A22.7545
+G1 X81.090 Y72.792 Z1.0307 A22.8003
+G1 X82.316 Y72.135 Z1.0320 A22.8459
+G1 X83.626 Y71.639 Z1.0333 A22.8912
+G1 X84.999 Y71.305 Z1.0347 A22.9359
+G1 X86.412 Y71.124 Z1.0360 A22.9801
+G1 X87.844 Y71.081 Z1.0373 A23.0234
+G1 X89.273 Y71.156 Z1.0387 A23.0660
+G1 X90.683 Y71.326 Z1.0400 A23.1076
+G1 X92.060 Y71.561 Z1.0413 A23.1485
+G1 X93.394 Y71.835 Z1.0427 A23.1884
+G1 X94.681 Y72.116 Z1.0440 A23.2277
+G1 X95.921 Y72.379 Z1.0453 A23.2663
+G1 X97.120 Y72.599 Z1.0467 A23.3044
+G1 X98.286 Y72.757 Z1.0480 A23.3421
+G1 X99.431 Y72.840 Z1.0493 A23.3796
+G1 X100.569 Y72.840 Z1.0507 A23.4172
+G1 X101.714 Y72.757 Z1.0520 A23.4549
+G1 X102.880 Y72.599 Z1.0533 A23.4930
+G1 X104.079 Y72.379 Z1.0547 A23.5316
+G1 X105.319 Y72.116 Z1.0560 A23.5708
+G1 X106.606 Y71.835 Z1.0573 A23.6108
+G1 X107.940 Y71.561 Z1.0587 A23.6516
+G1 X109.317 Y71.326 Z1.0600 A23.6933
+G1 X110.727 Y71.156 Z1.0613 A23.7359
+G1 X112.156 Y71.081 Z1.0627 A23.7792
+G1 X113.588 Y71.124 Z1.0640 A23.8233
+G1 X115.001 Y71.305 Z1.0653 A23.8681
+G1 X116.374 Y71.639 Z1.0667 A23.9134
+G1 X117.684 Y72.135 Z1.0680 A23.9590
+G1 X118.910 Y72.792 Z1.0693 A24.0048
+G1 X120.033 Y73.608 Z1.0707 A24.0506
+G1 X121.037 Y74.571 Z1.0720 A24.0962
+G1 X121.913 Y75.663 Z1.0733 A24.1415
+G1 X122.655 Y76.866 Z1.0747 A24.1862
+G1 X123.264 Y78.154 Z1.0760 A24.2303
+G1 X123.747 Y79.502 Z1.0773 A24.2737
+G1 X124.117 Y80.885 Z1.0787 A24.3163
+G1 X124.392 Y82.278 Z1.0800 A24.3579
+G1 X124.593 Y83.660 Z1.0813 A24.3987
+G1 X124.746 Y85.014 Z1.0827 A24.4387
+G1 X124.875 Y86.325 Z1.0840 A24.4780
+G1 X125.009 Y87.586 Z1.0853 A24.5166
+G1 X125.170 Y88.794 Z1.0867 A24.5546
+G1 X125.380 Y89.951 Z1.0880 A24.5924
+G1 X125.655 Y91.066 Z1.0893 A24.6299
+G1 X126.007 Y92.148 Z1.0907 A24.6675
+G1 X126.439 Y93.212 Z1.0920 A24.7052
+G1 X126.950 Y94.272 Z1.0933 A24.7433
+G1 X127.530 Y95.344 Z1.0947 A24.7819
+G1 X128.163 Y96.442 Z1.0960 A24.8211
+G1 X128.828 Y97.579 Z1.0973 A24.8611
+G1 X129.500 Y98.764 Z1.0987 A24.9019
+G1 X130.150 Y100.000 Z1.1000 A24.9436
+G1 X130.797 Y101.291 Z1.1013 A24.9862
+G1 X131.310 Y102.629 Z1.1027 A25.0297
+G1 X131.711 Y104.006 Z1.1040 A25.0738
+G1 X131.975 Y105.408 Z1.1053 A25.1187
+G1 X132.081 Y106.819 Z1.1067 A25.1640
+G1 X132.015 Y108.220 Z1.1080 A25.2097
+G1 X131.767 Y109.591 Z1.1093 A25.2556
+G1 X131.338 Y110.913 Z1.1107 A25.3014
+G1 X130.732 Y112.168 Z1.1120 A25.3471
+G1 X129.963 Y113.340 Z1.1133 A25.3925
+G1 X129.047 Y114.419 Z1.1147 A25.4373
+G1 X128.010 Y115.398 Z1.1160 A25.4815
+G1 X126.876 Y116.277 Z1.1173 A25.5249
+G1 X125.674 Y117.058 Z1.1187 A25.5675
+G1 X124.432 Y117.751 Z1.1200 A25.6093
+G1 X123.179 Y118.371 Z1.1213 A25.6501
+G1 X121.938 Y118.936 Z1.1227 A25.6902
+G1 X120.729 Y119.466 Z1.1240 A25.7295
+G1 X119.570 Y119.984 Z1.1253 A25.7682
+G1 X118.469 Y120.512 Z1.1267 A25.8063
+G1 X117.432 Y121.071 Z1.1280 A25.8441
+G1 X116.455 Y121.679 Z1.1293 A25.8817
+G1 X115.533 Y122.349 Z1.1307 A25.9194
+G1 X114.653 Y123.090 Z1.1320 A25.9572
+G1 X113.801 Y123.904 Z1.1333 A25.9953
+G1 X112.959 Y124.788 Z1.1347 A26.0340
+G1 X112.108 Y125.730 Z1.1360 A26.0733
+G1 X111.230 Y126.715 Z1.1373 A26.1134
+G1 X110.309 Y127.721 Z1.1387 A26.1542
+G1 X109.332 Y128.722 Z1.1400 A26.1960
+G1 X108.289 Y129.688 Z1.1413 A26.2386
+G1 X107.175 Y130.590 Z1.1427 A26.2820
+G1 X105.989 Y131.397 Z1.1440 A26.3262
+G1 X104.737 Y132.082 Z1.1453 A26.3710
+G1 X103.428 Y132.618 Z1.1467 A26.4164
+G1 X102.075 Y132.988 Z1.1480 A26.4621
+G1 X100.695 Y133.176 Z1.1493 A26.5079
+G1 X99.305 Y133.176 Z1.1507 A26.5538
+G1 X97.925 Y132.988 Z1.1520 A26.5995
+G1 X96.572 Y132.618 Z1.1533 A26.6448
+G1 X95.263 Y132.082 Z1.1547 A26.6897
+G1 X94.011 Y131.397 Z1.1560 A26.7338
+G1 X92.825 Y130.590 Z1.1573 A26.7773
+G1 X91.711 Y129.688 Z1.1587 A26.8199
+G1 X90.668 Y128.722 Z1.1600 A26.8616
+G1 X89.691 Y127.721 Z1.1613 A26.9025
+G1 X88.770 Y126.715 Z1.1627 A26.9426
+G1 X87.892 Y125.730 Z1.1640 A26.9819
+G1 X87.041 Y124.788 Z1.1653 A27.0205
+G1 X86.199 Y123.904 Z1.1667 A27.0587
+G1 X85.347 Y123.090 Z1.1680 A27.0965
+G1 X84.467 Y122.349 Z1.1693 A27.1341
+G1 X83.545 Y121.679 Z1.1707 A27.1717
+G1 X82.568 Y121.071 Z1.1720 A27.2095
+G1 X81.531 Y120.512 Z1.1733 A27.2477
+G1 X80.430 Y119.984 Z1.1747 A27.2864
+G1 X79.271 Y119.466 Z1.1760 A27.3257
+G1 X78.062 Y118.936 Z1.1773 A27.3657
+G1 X76.821 Y118.371 Z1.1787 A27.4066
+G1 X75.568 Y117.751 Z1.1800 A27.4483
+G1 X74.326 Y117.058 Z1.1813 A27.4910
+G1 X73.124 Y116.277 Z1.1827 A27.5344
+G1 X71.990 Y115.398 Z1.1840 A27.5786
+G1 X70.953 Y114.419 Z1.1853 A27.6234
+G1 X70.037 Y113.340 Z1.1867 A27.6687
+G1 X69.268 Y112.168 Z1.1880 A27.7144
+G1 X68.662 Y110.913 Z1.1893 A27.7603
+G1 X68.233 Y109.591 Z1.1907 A27.8062
+G1 X67.985 Y108.220 Z1.1920 A27.8519
+G1 X67.919 Y106.819 Z1.1933 A27.8972
+G1 X68.025 Y105.408 Z1.1947 A27.9420
+G1 X68.289 Y104.006 Z1.1960 A27.9862
+G1 X68.690 Y102.629 Z1.1973 A28.0296
+G1 X69.203 Y101.291 Z1.1987 A28.0722
+G1 X69.800 Y100.000 Z1.2000 A28.1140
+G1 X70.450 Y98.761 Z1.2013 A28.1549
+G1 X71.122 Y97.575 Z1.2027 A28.1949
+G1 X71.788 Y96.436 Z1.2040 A28.2342
+G1 X72.421 Y95.335 Z1.2053 A28.2729
+G1 X73.001 Y94.261 Z1.2067 A28.3111
+G1 X73.512 Y93.199 Z1.2080 A28.3489
+G1 X73.945 Y92.134 Z1.2093 A28.3865
+G1 X74.297 Y91.049 Z1.2107 A28.4241
+G1 X74.574 Y89.933 Z1.2120 A28.4619
+G1 X74.784 Y88.773 Z1.2133 A28.5001
+G1 X74.946 Y87.563 Z1.2147 A28.5387
+G1 X75.081 Y86.301 Z1.2160 A28.5780
+G1 X75.212 Y84.988 Z1.2173 A28.6181
+G1 X75.365 Y83.633 Z1.2187 A28.6590
+G1 X75.568 Y82.249 Z1.2200 A28.7007
+G1 X75.844 Y80.854 Z1.2213 A28.7433
+G1 X76.215 Y79.469 Z1.2227 A28.7868
+G1 X76.700 Y78.120 Z1.2240 A28.8309
+G1 X77.310 Y76.830 Z1.2253 A28.8758
+G1 X78.054 Y75.626 Z1.2267 A28.9211
+G1 X78.931 Y74.532 Z1.2280 A28.9668
+G1 X79.937 Y73.568 Z1.2293 A29.0127
+G1 X81.062 Y72.751 Z1.2307 A29.0585
+G1 X82.289 Y72.092 Z1.2320 A29.1042
+G1 X83.601 Y71.596 Z1.2333 A29.1496
+G1 X84.976 Y71.261 Z1.2347 A29.1944
+G1 X86.391 Y71.079 Z1.2360 A29.2386
+G1 X87.824 Y71.035 Z1.2373 A29.2820
+G1 X89.256 Y71.109 Z1.2387 A29.3246
+G1 X90.668 Y71.278 Z1.2400 A29.3663
+G1 X92.046 Y71.513 Z1.2413 A29.4072
+G1 X93.382 Y71.786 Z1.2427 A29.4473
+G1 X94.672 Y72.067 Z1.2440 A29.4866
+G1 X95.914 Y72.329 Z1.2453 A29.5253
+G1 X97.115 Y72.549 Z1.2467 A29.5634
+G1 X98.283 Y72.707 Z1.2480 A29.6012
+G1 X99.430 Y72.790 Z1.2493 A29.6388
+G1 X100.570 Y72.790 Z1.2507 A29.6765
+G1 X101.717 Y72.707 Z1.2520 A29.7143
+G1 X102.885 Y72.549 Z1.2533 A29.7524
+G1 X104.086 Y72.329 Z1.2547 A29.7911
+G1 X105.328 Y72.067 Z1.2560 A29.8304
+G1 X106.618 Y71.786 Z1.2573 A29.8704
+G1 X107.954 Y71.513 Z1.2587 A29.9113
+G1 X109.332 Y71.278 Z1.2600 A29.9531
+G1 X110.744 Y71.109 Z1.2613 A29.9957
+G1 X112.176 Y71.035 Z1.2627 A30.0391
+G1 X113.609 Y71.079 Z1.2640 A30.0833
+G1 X115.024 Y71.261 Z1.2653 A30.1281
+G1 X116.399 Y71.596 Z1.2667 A30.1735
+G1 X117.711 Y72.092 Z1.2680 A30.2192
+G1 X118.938 Y72.751 Z1.2693 A30.2650
+G1 X120.063 Y73.568 Z1.2707 A30.3109
+G1 X121.069 Y74.532 Z1.2720 A30.3566
+G1 X121.946 Y75.626 Z1.2733 A30.4019
+G1 X122.690 Y76.830 Z1.2747 A30.4467
+G1 X123.300 Y78.120 Z1.2760 A30.4909
+G1 X123.785 Y79.469 Z1.2773 A30.5344
+G1 X124.156 Y80.854 Z1.2787 A30.5770
+G1 X124.432 Y82.249 Z1.2800 A30.6187
+G1 X124.635 Y83.633 Z1.2813 A30.6596
+G1 X124.788 Y84.988 Z1.2827 A30.6997
+G1 X124.919 Y86.301 Z1.2840 A30.7390
+G1 X125.054 Y87.563 Z1.2853 A30.7776
+G1 X125.216 Y88.773 Z1.2867 A30.8158
+G1 X125.426 Y89.933 Z1.2880 A30.8536
+G1 X125.703 Y91.049 Z1.2893 A30.8912
+G1 X126.055 Y92.134 Z1.2907 A30.9288
+G1 X126.488 Y93.199 Z1.2920 A30.9666
+G1 X126.999 Y94.261 Z1.2933 A31.0048
+G1 X127.579 Y95.335 Z1.2947 A31.0434
+G1 X128.212 Y96.436 Z1.2960 A31.0828
+G1 X128.878 Y97.575 Z1.2973 A31.1228
+G1 X129.550 Y98.761 Z1.2987 A31.1637
+G1 X130.200 Y100.000 Z1.3000 A31.2054
+G1 X130.847 Y101.293 Z1.3013 A31.2481
+G1 X131.360 Y102.633 Z1.3027 A31.2916
+G1 X131.761 Y104.012 Z1.3040 A31.3359
+G1 X132.025 Y105.417 Z1.3053 A31.3808
+G1 X132.130 Y106.829 Z1.3067 A31.4262
+G1 X132.063 Y108.232 Z1.3080 A31.4719
+G1 X131.815 Y109.606 Z1.3093 A31.5179
+G1 X131.385 Y110.929 Z1.3107 A31.5638
+G1 X130.779 Y112.186 Z1.3120 A31.6096
+G1 X130.008 Y113.361 Z1.3133 A31.6550
+G1 X129.092 Y114.441 Z1.3147 A31.6999
+G1 X128.054 Y115.423 Z1.3160 A31.7441
+G1 X126.918 Y116.302 Z1.3173 A31.7876
+G1 X125.715 Y117.085 Z1.3187 A31.8303
+G1 X124.473 Y117.781 Z1.3200 A31.8721
+G1 X123.218 Y118.402 Z1.3213 A31.9131
+G1 X121.975 Y118.969 Z1.3227 A31.9532
+G1 X120.766 Y119.500 Z1.3240 A31.9926
+G1 X119.605 Y120.020 Z1.3253 A32.0313
+G1 X118.503 Y120.549 Z1.3267 A32.0695
+G1 X117.463 Y121.110 Z1.3280 A32.1074
+G1 X116.485 Y121.719 Z1.3293 A32.1451
+G1 X115.561 Y122.390 Z1.3307 A32.1828
+G1 X114.680 Y123.132 Z1.3320 A32.2206
+G1 X113.826 Y123.947 Z1.3333 A32.2589
+G1 X112.982 Y124.832 Z1.3347 A32.2976
+G1 X112.129 Y125.775 Z1.3360 A32.3370
+G1 X111.249 Y126.761 Z1.3373 A32.3771
+G1 X110.327 Y127.768 Z1.3387 A32.4181
+G1 X109.348 Y128.769 Z1.3400 A32.4599
+G1 X108.303 Y129.736 Z1.3413 A32.5026
+G1 X107.186 Y130.639 Z1.3427 A32.5461
+G1 X105.999 Y131.446 Z1.3440 A32.5903
+G1 X104.745 Y132.131 Z1.3453 A32.6352
+G1 X103.434 Y132.668 Z1.3467 A32.6806
+G1 X102.079 Y133.038 Z1.3480 A32.7264
+G1 X100.696 Y133.226 Z1.3493 A32.7723
+G1 X99.304 Y133.226 Z1.3507 A32.8182
+G1 X97.921 Y133.038 Z1.3520 A32.8640
+G1 X96.566 Y132.668 Z1.3533 A32.9094
+G1 X95.255 Y132.131 Z1.3547 A32.9543
+G1 X94.001 Y131.446 Z1.3560 A32.9986
+G1 X92.814 Y130.639 Z1.3573 A33.0421
+G1 X91.697 Y129.736 Z1.3587 A33.0847
+G1 X90.652 Y128.769 Z1.3600 A33.1266
+G1 X89.673 Y127.768 Z1.3613 A33.1675
+G1 X88.751 Y126.761 Z1.3627 A33.2076
+G1 X87.871 Y125.775 Z1.3640 A33.2470
+G1 X87.018 Y124.832 Z1.3653 A33.2857
+G1 X86.174 Y123.947 Z1.3667 A33.3240
+G1 X85.320 Y123.132 Z1.3680 A33.3618
+G1 X84.439 Y122.390 Z1.3693 A33.3995
+G1 X83.515 Y121.719 Z1.3707 A33.4372
+G1 X82.537 Y121.110 Z1.3720 A33.4751
+G1 X81.497 Y120.549 Z1.3733 A33.5133
+G1 X80.395 Y120.020 Z1.3747 A33.5520
+G1 X79.234 Y119.500 Z1.3760 A33.5914
+G1 X78.025 Y118.969 Z1.3773 A33.6315
+G1 X76.782 Y118.402 Z1.3787 A33.6725
+G1 X75.527 Y117.781 Z1.3800 A33.7143
+G1 X74.285 Y117.085 Z1.3813 A33.7570
+G1 X73.082 Y116.302 Z1.3827 A33.8005
+G1 X71.946 Y115.423 Z1.3840 A33.8447
+G1 X70.908 Y114.441 Z1.3853 A33.8896
+G1 X69.992 Y113.361 Z1.3867 A33.9350
+G1 X69.221 Y112.186 Z1.3880 A33.9808
+G1 X68.615 Y110.929 Z1.3893 A34.0267
+G1 X68.185 Y109.606 Z1.3907 A34.0727
+G1 X67.937 Y108.232 Z1.3920 A34.1184
+G1 X67.870 Y106.829 Z1.3933 A34.1638
+G1 X67.975 Y105.417 Z1.3947 A34.2087
+G1 X68.239 Y104.012 Z1.3960 A34.2530
+G1 X68.640 Y102.633 Z1.3973 A34.2965
+G1 X69.153 Y101.293 Z1.3987 A34.3392
+G1 X69.750 Y100.000 Z1.4000 A34.3810
+G1 X70.400 Y98.759 Z1.4013 A34.4219
+G1 X71.072 Y97.571 Z1.4027 A34.4621
+G1 X71.738 Y96.430 Z1.4040 A34.5014
+G1 X72.372 Y95.327 Z1.4053 A34.5402
+G1 X72.952 Y94.251 Z1.4067 A34.5784
+G1 X73.464 Y93.187 Z1.4080 A34.6163
+G1 X73.897 Y92.119 Z1.4093 A34.6540
+G1 X74.250 Y91.033 Z1.4107 A34.6917
+G1 X74.527 Y89.915 Z1.4120 A34.7295
+G1 X74.739 Y88.753 Z1.4133 A34.7677
+G1 X74.902 Y87.541 Z1.4147 A34.8065
+G1 X75.037 Y86.276 Z1.4160 A34.8459
+G1 X75.169 Y84.962 Z1.4173 A34.8860
+G1 X75.324 Y83.605 Z1.4187 A34.9269
+G1 X75.527 Y82.219 Z1.4200 A34.9688
+G1 X75.804 Y80.823 Z1.4213 A35.0114
+G1 X76.177 Y79.437 Z1.4227 A35.0549
+G1 X76.663 Y78.085 Z1.4240 A35.0992
+G1 X77.275 Y76.794 Z1.4253 A35.1441
+G1 X78.020 Y75.589 Z1.4267 A35.1895
+G1 X78.899 Y74.494 Z1.4280 A35.2352
+G1 X79.907 Y73.528 Z1.4293 A35.2812
+G1 X81.033 Y72.710 Z1.4307 A35.3271
+G1 X82.262 Y72.050 Z1.4320 A35.3729
+G1 X83.576 Y71.553 Z1.4333 A35.4183
+G1 X84.952 Y71.217 Z1.4347 A35.4632
+G1 X86.369 Y71.033 Z1.4360 A35.5074
+G1 X87.805 Y70.989 Z1.4373 A35.5509
+G1 X89.238 Y71.063 Z1.4387 A35.5936
+G1 X90.652 Y71.231 Z1.4400 A35.6354
+G1 X92.033 Y71.465 Z1.4413 A35.6764
+G1 X93.371 Y71.737 Z1.4427 A35.7165
+G1 X94.662 Y72.018 Z1.4440 A35.7559
+G1 X95.907 Y72.280 Z1.4453 A35.7946
+G1 X97.110 Y72.500 Z1.4467 A35.8328
+G1 X98.280 Y72.657 Z1.4480 A35.8707
+G1 X99.429 Y72.740 Z1.4493 A35.9084
+G1 X100.571 Y72.740 Z1.4507 A35.9461
+G1 X101.720 Y72.657 Z1.4520 A35.9840
+G1 X102.890 Y72.500 Z1.4533 A36.0222
+G1 X104.093 Y72.280 Z1.4547 A36.0609
+G1 X105.338 Y72.018 Z1.4560 A36.1003
+G1 X106.629 Y71.737 Z1.4573 A36.1404
+G1 X107.967 Y71.465 Z1.4587 A36.1814
+G1 X109.348 Y71.231 Z1.4600 A36.2232
+G1 X110.762 Y71.063 Z1.4613 A36.2659
+G1 X112.195 Y70.989 Z1.4627 A36.3094
+G1 X113.631 Y71.033 Z1.4640 A36.3536
+G1 X115.048 Y71.217 Z1.4653 A36.3985
+G1 X116.424 Y71.553 Z1.4667 A36.4439
+G1 X117.738 Y72.050 Z1.4680 A36.4897
+G1 X118.967 Y72.710 Z1.4693 A36.5356
+G1 X120.093 Y73.528 Z1.4707 A36.5816
+G1 X121.101 Y74.494 Z1.4720 A36.6273
+G1 X121.980 Y75.589 Z1.4733 A36.6727
+G1 X122.725 Y76.794 Z1.4747 A36.7176
+G1 X123.337 Y78.085 Z1.4760 A36.7619
+G1 X123.823 Y79.437 Z1.4773 A36.8054
+G1 X124.196 Y80.823 Z1.4787 A36.8481
+G1 X124.473 Y82.219 Z1.4800 A36.8899
+G1 X124.676 Y83.605 Z1.4813 A36.9308
+G1 X124.831 Y84.962 Z1.4827 A36.9709
+G1 X124.963 Y86.276 Z1.4840 A37.0103
+G1 X125.098 Y87.541 Z1.4853 A37.0491
+G1 X125.261 Y88.753 Z1.4867 A37.0873
+G1 X125.473 Y89.915 Z1.4880 A37.1251
+G1 X125.750 Y91.033 Z1.4893 A37.1628
+G1 X126.103 Y92.119 Z1.4907 A37.2005
+G1 X126.536 Y93.187 Z1.4920 A37.2384
+G1 X127.048 Y94.251 Z1.4933 A37.2766
+G1 X127.628 Y95.327 Z1.4947 A37.3154
+G1 X128.262 Y96.430 Z1.4960 A37.3547
+G1 X128.928 Y97.571 Z1.4973 A37.3949
+G1 X129.600 Y98.759 Z1.4987 A37.4358
+G1 X130.250 Y100.000 Z1.5000 A37.4776
+G1 X130.897 Y101.295 Z1.5013 A37.5204
+G1 X131.410 Y102.638 Z1.5027 A37.5639
+G1 X131.811 Y104.019 Z1.5040 A37.6083
+G1 X132.074 Y105.425 Z1.5053 A37.6532
+G1 X132.179 Y106.840 Z1.5067 A37.6987
+G1 X132.112 Y108.245 Z1.5080 A37.7445
+G1 X131.863 Y109.620 Z1.5093 A37.7905
+G1 X131.432 Y110.946 Z1.5107 A37.8366
+G1 X130.825 Y112.204 Z1.5120 A37.8824
+G1 X130.054 Y113.381 Z1.5133 A37.9279
+G1 X129.137 Y114.464 Z1.5147 A37.9728
+G1 X128.097 Y115.447 Z1.5160 A38.0171
+G1 X126.961 Y116.328 Z1.5173 A38.0607
+G1 X125.757 Y117.113 Z1.5187 A38.1035
+G1 X124.513 Y117.810 Z1.5200 A38.1453
+G1 X123.257 Y118.433 Z1.5213 A38.1864
+G1 X122.013 Y119.001 Z1.5227 A38.2266
+G1 X120.802 Y119.535 Z1.5240 A38.2660
+G1 X119.640 Y120.056 Z1.5253 A38.3048
+G1 X118.536 Y120.587 Z1.5267 A38.3431
+G1 X117.495 Y121.148 Z1.5280 A38.3810
+G1 X116.515 Y121.758 Z1.5293 A38.4188
+G1 X115.590 Y122.431 Z1.5307 A38.4566
+G1 X114.707 Y123.174 Z1.5320 A38.4945
+G1 X113.851 Y123.991 Z1.5333 A38.5328
+G1 X113.005 Y124.876 Z1.5347 A38.5716
+G1 X112.150 Y125.821 Z1.5360 A38.6110
+G1 X111.269 Y126.808 Z1.5373 A38.6512
+G1 X110.344 Y127.815 Z1.5387 A38.6923
+G1 X109.363 Y128.817 Z1.5400 A38.7341
+G1 X108.316 Y129.785 Z1.5413 A38.7769
+G1 X107.198 Y130.687 Z1.5427 A38.8205
+G1 X106.008 Y131.495 Z1.5440 A38.8648
+G1 X104.752 Y132.180 Z1.5453 A38.9097
+G1 X103.439 Y132.718 Z1.5467 A38.9552
+G1 X102.082 Y133.088 Z1.5480 A39.0010
+G1 X100.697 Y133.276 Z1.5493 A39.0471
+G1 X99.303 Y133.276 Z1.5507 A39.0931
+G1 X97.918 Y133.088 Z1.5520 A39.1389
+G1 X96.561 Y132.718 Z1.5533 A39.1844
+G1 X95.248 Y132.180 Z1.5547 A39.2293
+G1 X93.992 Y131.495 Z1.5560 A39.2737
+G1 X92.802 Y130.687 Z1.5573 A39.3172
+G1 X91.684 Y129.785 Z1.5587 A39.3600
+G1 X90.637 Y128.817 Z1.5600 A39.4019
+G1 X89.656 Y127.815 Z1.5613 A39.4429
+G1 X88.731 Y126.808 Z1.5627 A39.4831
+G1 X87.850 Y125.821 Z1.5640 A39.5225
+G1 X86.995 Y124.876 Z1.5653 A39.5613
+G1 X86.149 Y123.991 Z1.5667 A39.5996
+G1 X85.293 Y123.174 Z1.5680 A39.6376
+G1 X84.410 Y122.431 Z1.5693 A39.6753
+G1 X83.485 Y121.758 Z1.5707 A39.7131
+G1 X82.505 Y121.148 Z1.5720 A39.7510
+G1 X81.464 Y120.587 Z1.5733 A39.7893
+G1 X80.360 Y120.056 Z1.5747 A39.8281
+G1 X79.198 Y119.535 Z1.5760 A39.8676
+G1 X77.987 Y119.001 Z1.5773 A39.9077
+G1 X76.743 Y118.433 Z1.5787 A39.9488
+G1 X75.487 Y117.810 Z1.5800 A39.9907
+G1 X74.243 Y117.113 Z1.5813 A40.0334
+G1 X73.039 Y116.328 Z1.5827 A40.0770
+G1 X71.903 Y115.447 Z1.5840 A40.1213
+G1 X70.863 Y114.464 Z1.5853 A40.1663
+G1 X69.946 Y113.381 Z1.5867 A40.2117
+G1 X69.175 Y112.204 Z1.5880 A40.2576
+G1 X68.568 Y110.946 Z1.5893 A40.3036
+G1 X68.137 Y109.620 Z1.5907 A40.3496
+G1 X67.888 Y108.245 Z1.5920 A40.3954
+G1 X67.821 Y106.840 Z1.5933 A40.4409
+G1 X67.926 Y105.425 Z1.5947 A40.4858
+G1 X68.189 Y104.019 Z1.5960 A40.5302
+G1 X68.590 Y102.638 Z1.5973 A40.5737
+G1 X69.103 Y101.295 Z1.5987 A40.6165
+G1 X69.700 Y100.000 Z1.6000 A40.6584
+G1 X70.350 Y98.757 Z1.6013 A40.6994
+G1 X71.022 Y97.567 Z1.6027 A40.7396
+G1 X71.688 Y96.423 Z1.6040 A40.7790
+G1 X72.323 Y95.319 Z1.6053 A40.8178
+G1 X72.903 Y94.240 Z1.6067 A40.8561
+G1 X73.415 Y93.174 Z1.6080 A40.8941
+G1 X73.849 Y92.105 Z1.6093 A40.9318
+G1 X74.203 Y91.017 Z1.6107 A40.9696
+G1 X74.481 Y89.896 Z1.6120 A41.0075
+G1 X74.693 Y88.733 Z1.6133 A41.0458
+G1 X74.857 Y87.519 Z1.6147 A41.0846
+G1 X74.993 Y86.252 Z1.6160 A41.1241
+G1 X75.126 Y84.936 Z1.6173 A41.1643
+G1 X75.282 Y83.577 Z1.6187 A41.2053
+G1 X75.487 Y82.190 Z1.6200 A41.2472
+G1 X75.765 Y80.792 Z1.6213 A41.2899
+G1 X76.139 Y79.404 Z1.6227 A41.3335
+G1 X76.627 Y78.051 Z1.6240 A41.3778
+G1 X77.240 Y76.759 Z1.6253 A41.4228
+G1 X77.987 Y75.552 Z1.6267 A41.4682
+G1 X78.867 Y74.455 Z1.6280 A41.5141
+G1 X79.877 Y73.489 Z1.6293 A41.5601
+G1 X81.005 Y72.669 Z1.6307 A41.6061
+G1 X82.236 Y72.008 Z1.6320 A41.6519
+G1 X83.551 Y71.509 Z1.6333 A41.6974
+G1 X84.929 Y71.172 Z1.6347 A41.7424
+G1 X86.348 Y70.988 Z1.6360 A41.7867
+G1 X87.785 Y70.943 Z1.6373 A41.8302
+G1 X89.221 Y71.016 Z1.6387 A41.8730
+G1 X90.637 Y71.183 Z1.6400 A41.9149
+G1 X92.019 Y71.417 Z1.6413 A41.9559
+G1 X93.360 Y71.689 Z1.6427 A41.9961
+G1 X94.653 Y71.969 Z1.6440 A42.0355
+G1 X95.899 Y72.231 Z1.6453 A42.0743
+G1 X97.104 Y72.450 Z1.6467 A42.1126
+G1 X98.277 Y72.607 Z1.6480 A42.1506
+G1 X99.428 Y72.690 Z1.6493 A42.1883
+G1 X100.572 Y72.690 Z1.6507 A42.2261
+G1 X101.723 Y72.607 Z1.6520 A42.2640
+G1 X102.896 Y72.450 Z1.6533 A42.3023
+G1 X104.101 Y72.231 Z1.6547 A42.3411
+G1 X105.347 Y71.969 Z1.6560 A42.3806
+G1 X106.640 Y71.689 Z1.6573 A42.4208
+G1 X107.981 Y71.417 Z1.6587 A42.4618
+G1 X109.363 Y71.183 Z1.6600 A42.5037
+G1 X110.779 Y71.016 Z1.6613 A42.5464
+G1 X112.215 Y70.943 Z1.6627 A42.5900
+G1 X113.652 Y70.988 Z1.6640 A42.6343
+G1 X115.071 Y71.172 Z1.6653 A42.6793
+G1 X116.449 Y71.509 Z1.6667 A42.7248
+G1 X117.764 Y72.008 Z1.6680 A42.7706
+G1 X118.995 Y72.669 Z1.6693 A42.8166
+G1 X120.123 Y73.489 Z1.6707 A42.8626
+G1 X121.133 Y74.455 Z1.6720 A42.9084
+G1 X122.013 Y75.552 Z1.6733 A42.9539
+G1 X122.760 Y76.759 Z1.6747 A42.9989
+G1 X123.373 Y78.051 Z1.6760 A43.0432
+G1 X123.861 Y79.404 Z1.6773 A43.0868
+G1 X124.235 Y80.792 Z1.6787 A43.1295
+G1 X124.513 Y82.190 Z1.6800 A43.1714
+G1 X124.718 Y83.577 Z1.6813 A43.2124
+G1 X124.874 Y84.936 Z1.6827 A43.2526
+G1 X125.007 Y86.252 Z1.6840 A43.2921
+G1 X125.143 Y87.519 Z1.6853 A43.3309
+G1 X125.307 Y88.733 Z1.6867 A43.3691
+G1 X125.519 Y89.896 Z1.6880 A43.4071
+G1 X125.797 Y91.017 Z1.6893 A43.4448
+G1 X126.151 Y92.105 Z1.6907 A43.4826
+G1 X126.585 Y93.174 Z1.6920 A43.5205
+G1 X127.097 Y94.240 Z1.6933 A43.5588
+G1 X127.677 Y95.319 Z1.6947 A43.5976
+G1 X128.312 Y96.423 Z1.6960 A43.6371
+G1 X128.978 Y97.567 Z1.6973 A43.6773
+G1 X129.650 Y98.757 Z1.6987 A43.7183
+G1 X130.300 Y100.000 Z1.7000 A43.7602
+G1 X130.947 Y101.297 Z1.7013 A43.8030
+G1 X131.459 Y102.642 Z1.7027 A43.8466
+G1 X131.860 Y104.025 Z1.7040 A43.8910
+G1 X132.123 Y105.433 Z1.7053 A43.9361
+G1 X132.228 Y106.850 Z1.7067 A43.9816
+G1 X132.160 Y108.257 Z1.7080 A44.0275
+G1 X131.911 Y109.634 Z1.7093 A44.0736
+G1 X131.479 Y110.962 Z1.7107 A44.1197
+G1 X130.872 Y112.223 Z1.7120 A44.1656
+G1 X130.100 Y113.401 Z1.7133 A44.2111
+G1 X129.182 Y114.486 Z1.7147 A44.2561
+G1 X128.141 Y115.471 Z1.7160 A44.3005
+G1 X127.004 Y116.354 Z1.7173 A44.3442
+G1 X125.799 Y117.141 Z1.7187 A44.3870
+G1 X124.554 Y117.839 Z1.7200 A44.4289
+G1 X123.296 Y118.464 Z1.7213 A44.4700
+G1 X122.051 Y119.034 Z1.7227 A44.5103
+G1 X120.839 Y119.569 Z1.7240 A44.5498
+G1 X119.675 Y120.091 Z1.7253 A44.5887
+G1 X118.570 Y120.624 Z1.7267 A44.6270
+G1 X117.527 Y121.187 Z1.7280 A44.6650
+G1 X116.546 Y121.798 Z1.7293 A44.7029
+G1 X115.618 Y122.472 Z1.7307 A44.7407
+G1 X114.734 Y123.216 Z1.7320 A44.7787
+G1 X113.876 Y124.034 Z1.7333 A44.8171
+G1 X113.028 Y124.921 Z1.7347 A44.8559
+G1 X112.172 Y125.866 Z1.7360 A44.8955
+G1 X111.288 Y126.854 Z1.7373 A44.9357
+G1 X110.362 Y127.862 Z1.7387 A44.9768
+G1 X109.379 Y128.865 Z1.7400 A45.0188
+G1 X108.329 Y129.833 Z1.7413 A45.0616
+G1 X107.209 Y130.736 Z1.7427 A45.1052
+G1 X106.017 Y131.545 Z1.7440 A45.1496
+G1 X104.759 Y132.230 Z1.7453 A45.1947
+G1 X103.444 Y132.768 Z1.7467 A45.2402
+G1 X102.085 Y133.138 Z1.7480 A45.2861
+G1 X100.698 Y133.326 Z1.7493 A45.3322
+G1 X99.302 Y133.326 Z1.7507 A45.3782
+G1 X97.915 Y133.138 Z1.7520 A45.4241
+G1 X96.556 Y132.768 Z1.7533 A45.4697
+G1 X95.241 Y132.230 Z1.7547 A45.5147
+G1 X93.983 Y131.545 Z1.7560 A45.5591
+G1 X92.791 Y130.736 Z1.7573 A45.6028
+G1 X91.671 Y129.833 Z1.7587 A45.6456
+G1 X90.621 Y128.865 Z1.7600 A45.6875
+G1 X89.638 Y127.862 Z1.7613 A45.7286
+G1 X88.712 Y126.854 Z1.7627 A45.7689
+G1 X87.828 Y125.866 Z1.7640 A45.8084
+G1 X86.972 Y124.921 Z1.7653 A45.8473
+G1 X86.124 Y124.034 Z1.7667 A45.8856
+G1 X85.266 Y123.216 Z1.7680 A45.9236
+G1 X84.382 Y122.472 Z1.7693 A45.9615
+G1 X83.454 Y121.798 Z1.7707 A45.9993
+G1 X82.473 Y121.187 Z1.7720 A46.0373
+G1 X81.430 Y120.624 Z1.7733 A46.0757
+G1 X80.325 Y120.091 Z1.7747 A46.1145
+G1 X79.161 Y119.569 Z1.7760 A46.1540
+G1 X77.949 Y119.034 Z1.7773 A46.1943
+G1 X76.704 Y118.464 Z1.7787 A46.2354
+G1 X75.446 Y117.839 Z1.7800 A46.2774
+G1 X74.201 Y117.141 Z1.7813 A46.3202
+G1 X72.996 Y116.354 Z1.7827 A46.3638
+G1 X71.859 Y115.471 Z1.7840 A46.4082
+G1 X70.818 Y114.486 Z1.7853 A46.4532
+G1 X69.900 Y113.401 Z1.7867 A46.4988
+G1 X69.128 Y112.223 Z1.7880 A46.5447
+G1 X68.521 Y110.962 Z1.7893 A46.5908
+G1 X68.089 Y109.634 Z1.7907 A46.6368
+G1 X67.840 Y108.257 Z1.7920 A46.6827
+G1 X67.772 Y106.850 Z1.7933 A46.7283
+G1 X67.877 Y105.433 Z1.7947 A46.7733
+G1 X68.140 Y104.025 Z1.7960 A46.8177
+G1 X68.541 Y102.642 Z1.7973 A46.8613
+G1 X69.053 Y101.297 Z1.7987 A46.9042
+G1 X69.650 Y100.000 Z1.8000 A46.9461
+G1 X70.300 Y98.755 Z1.8013 A46.9872
+G1 X70.972 Y97.562 Z1.8027 A47.0275
+G1 X71.639 Y96.417 Z1.8040 A47.0670
+G1 X72.273 Y95.310 Z1.8053 A47.1058
+G1 X72.855 Y94.230 Z1.8067 A47.1442
+G1 X73.367 Y93.162 Z1.8080 A47.1822
+G1 X73.802 Y92.090 Z1.8093 A47.2200
+G1 X74.156 Y91.000 Z1.8107 A47.2579
+G1 X74.434 Y89.878 Z1.8120 A47.2959
+G1 X74.647 Y88.712 Z1.8133 A47.3342
+G1 X74.812 Y87.497 Z1.8147 A47.3731
+G1 X74.949 Y86.228 Z1.8160 A47.4126
+G1 X75.083 Y84.910 Z1.8173 A47.4529
+G1 X75.240 Y83.550 Z1.8187 A47.4940
+G1 X75.446 Y82.161 Z1.8200 A47.5359
+G1 X75.726 Y80.761 Z1.8213 A47.5788
+G1 X76.102 Y79.371 Z1.8227 A47.6224
+G1 X76.590 Y78.017 Z1.8240 A47.6668
+G1 X77.205 Y76.723 Z1.8253 A47.7118
+G1 X77.953 Y75.515 Z1.8267 A47.7574
+G1 X78.836 Y74.417 Z1.8280 A47.8033
+G1 X79.847 Y73.449 Z1.8293 A47.8493
+G1 X80.976 Y72.628 Z1.8307 A47.8954
+G1 X82.209 Y71.966 Z1.8320 A47.9413
+G1 X83.526 Y71.466 Z1.8333 A47.9869
+G1 X84.906 Y71.128 Z1.8347 A48.0319
+G1 X86.327 Y70.943 Z1.8360 A48.0763
+G1 X87.766 Y70.897 Z1.8373 A48.1199
+G1 X89.203 Y70.969 Z1.8387 A48.1627
+G1 X90.621 Y71.135 Z1.8400 A48.2047
+G1 X92.006 Y71.369 Z1.8413 A48.2458
+G1 X93.348 Y71.640 Z1.8427 A48.2860
+G1 X94.643 Y71.920 Z1.8440 A48.3256
+G1 X95.892 Y72.181 Z1.8453 A48.3644
+G1 X97.099 Y72.400 Z1.8467 A48.4028
+G1 X98.273 Y72.557 Z1.8480 A48.4408
+G1 X99.427 Y72.640 Z1.8493 A48.4786
+G1 X100.573 Y72.640 Z1.8507 A48.5165
+G1 X101.727 Y72.557 Z1.8520 A48.5545
+G1 X102.901 Y72.400 Z1.8533 A48.5928
+G1 X104.108 Y72.181 Z1.8547 A48.6317
+G1 X105.357 Y71.920 Z1.8560 A48.6712
+G1 X106.652 Y71.640 Z1.8573 A48.7115
+G1 X107.994 Y71.369 Z1.8587 A48.7526
+G1 X109.379 Y71.135 Z1.8600 A48.7945
+G1 X110.797 Y70.969 Z1.8613 A48.8373
+G1 X112.234 Y70.897 Z1.8627 A48.8810
+G1 X113.673 Y70.943 Z1.8640 A48.9254
+G1 X115.094 Y71.128 Z1.8653 A48.9704
+G1 X116.474 Y71.466 Z1.8667 A49.0159
+G1 X117.791 Y71.966 Z1.8680 A49.0618
+G1 X119.024 Y72.628 Z1.8693 A49.1079
+G1 X120.153 Y73.449 Z1.8707 A49.1540
+G1 X121.164 Y74.417 Z1.8720 A49.1999
+G1 X122.047 Y75.515 Z1.8733 A49.2454
+G1 X122.795 Y76.723 Z1.8747 A49.2905
+G1 X123.410 Y78.017 Z1.8760 A49.3349
+G1 X123.898 Y79.371 Z1.8773 A49.3785
+G1 X124.274 Y80.761 Z1.8787 A49.4213
+G1 X124.554 Y82.161 Z1.8800 A49.4633
+G1 X124.760 Y83.550 Z1.8813 A49.5044
+G1 X124.917 Y84.910 Z1.8827 A49.5446
+G1 X125.051 Y86.228 Z1.8840 A49.5841
+G1 X125.188 Y87.497 Z1.8853 A49.6230
+G1 X125.353 Y88.712 Z1.8867 A49.6614
+G1 X125.566 Y89.878 Z1.8880 A49.6994
+G1 X125.844 Y91.000 Z1.8893 A49.7372
+G1 X126.198 Y92.090 Z1.8907 A49.7750
+G1 X126.633 Y93.162 Z1.8920 A49.8131
+G1 X127.145 Y94.230 Z1.8933 A49.8514
+G1 X127.727 Y95.310 Z1.8947 A49.8903
+G1 X128.361 Y96.417 Z1.8960 A49.9298
+G1 X129.028 Y97.562 Z1.8973 A49.9701
+G1 X129.700 Y98.755 Z1.8987 A50.0112
+G1 X130.350 Y100.000 Z1.9000 A50.0531
+G1 X130.997 Y101.299 Z1.9013 A50.0960
+G1 X131.509 Y102.646 Z1.9027 A50.1397
+G1 X131.910 Y104.031 Z1.9040 A50.1842
+G1 X132.172 Y105.442 Z1.9053 A50.2293
+G1 X132.277 Y106.861 Z1.9067 A50.2749
+G1 X132.208 Y108.270 Z1.9080 A50.3208
+G1 X131.959 Y109.649 Z1.9093 A50.3670
+G1 X131.527 Y110.979 Z1.9107 A50.4131
+G1 X130.918 Y112.241 Z1.9120 A50.4591
+G1 X130.145 Y113.422 Z1.9133 A50.5047
+G1 X129.227 Y114.508 Z1.9147 A50.5498
+G1 X128.185 Y115.495 Z1.9160 A50.5943
+G1 X127.047 Y116.380 Z1.9173 A50.6380
+G1 X125.840 Y117.168 Z1.9187 A50.6809
+G1 X124.594 Y117.869 Z1.9200 A50.7229
+G1 X123.335 Y118.495 Z1.9213 A50.7641
+G1 X122.089 Y119.067 Z1.9227 A50.8044
+G1 X120.875 Y119.603 Z1.9240 A50.8440
+G1 X119.710 Y120.127 Z1.9253 A50.8829
+G1 X118.603 Y120.661 Z1.9267 A50.9213
+G1 X117.559 Y121.225 Z1.9280 A50.9594
+G1 X116.576 Y121.838 Z1.9293 A50.9973
+G1 X115.647 Y122.513 Z1.9307 A51.0352
+G1 X114.760 Y123.259 Z1.9320 A51.0733
+G1 X113.901 Y124.077 Z1.9333 A51.1117
+G1 X113.051 Y124.965 Z1.9347 A51.1507
+G1 X112.193 Y125.911 Z1.9360 A51.1903
+G1 X111.308 Y126.900 Z1.9373 A51.2306
+G1 X110.379 Y127.909 Z1.9387 A51.2717
+G1 X109.394 Y128.912 Z1.9400 A51.3138
+G1 X108.343 Y129.881 Z1.9413 A51.3567
+G1 X107.221 Y130.785 Z1.9427 A51.4004
+G1 X106.027 Y131.594 Z1.9440 A51.4448
+G1 X104.767 Y132.279 Z1.9453 A51.4899
+G1 X103.449 Y132.817 Z1.9467 A51.5355
+G1 X102.088 Y133.188 Z1.9480 A51.5815
+G1 X100.699 Y133.376 Z1.9493 A51.6277
+G1 X99.301 Y133.376 Z1.9507 A51.6738
+G1 X97.912 Y133.188 Z1.9520 A51.7198
+G1 X96.551 Y132.817 Z1.9533 A51.7654
+G1 X95.233 Y132.279 Z1.9547 A51.8105
+G1 X93.973 Y131.594 Z1.9560 A51.8549
+G1 X92.779 Y130.785 Z1.9573 A51.8986
+G1 X91.657 Y129.881 Z1.9587 A51.9415
+G1 X90.606 Y128.912 Z1.9600 A51.9836
+G1 X89.621 Y127.909 Z1.9613 A52.0247
+G1 X88.692 Y126.900 Z1.9627 A52.0650
+G1 X87.807 Y125.911 Z1.9640 A52.1046
+G1 X86.949 Y124.965 Z1.9653 A52.1436
+G1 X86.099 Y124.077 Z1.9667 A52.1820
+G1 X85.240 Y123.259 Z1.9680 A52.2201
+G1 X84.353 Y122.513 Z1.9693 A52.2580
+G1 X83.424 Y121.838 Z1.9707 A52.2959
+G1 X82.441 Y121.225 Z1.9720 A52.3340
+G1 X81.397 Y120.661 Z1.9733 A52.3724
+G1 X80.290 Y120.127 Z1.9747 A52.4113
+G1 X79.125 Y119.603 Z1.9760 A52.4509
+G1 X77.911 Y119.067 Z1.9773 A52.4912
+G1 X76.665 Y118.495 Z1.9787 A52.5324
+G1 X75.406 Y117.869 Z1.9800 A52.5744
+G1 X74.160 Y117.168 Z1.9813 A52.6173
+G1 X72.953 Y116.380 Z1.9827 A52.6610
+G1 X71.815 Y115.495 Z1.9840 A52.7055
+G1 X70.773 Y114.508 Z1.9853 A52.7506
+G1 X69.855 Y113.422 Z1.9867 A52.7962
+G1 X69.082 Y112.241 Z1.9880 A52.8422
+G1 X68.473 Y110.979 Z1.9893 A52.8883
+G1 X68.041 Y109.649 Z1.9907 A52.9345
+G1 X67.792 Y108.270 Z1.9920 A52.9804
+G1 X67.723 Y106.861 Z1.9933 A53.0260
+G1 X67.828 Y105.442 Z1.9947 A53.0711
+G1 X68.090 Y104.031 Z1.9960 A53.1156
+G1 X68.491 Y102.646 Z1.9973 A53.1593
+G1 X69.003 Y101.299 Z1.9987 A53.2022
+G1 X69.600 Y100.000 Z2.0000 A53.2442
+G1 X70.250 Y98.753 Z2.0013 A53.2854
+G1 X70.923 Y97.558 Z2.0027 A53.3257
+G1 X71.589 Y96.411 Z2.0040 A53.3653
+G1 X72.224 Y95.302 Z2.0053 A53.4042
+G1 X72.806 Y94.220 Z2.0067 A53.4427
+G1 X73.319 Y93.149 Z2.0080 A53.4807
+G1 X73.754 Y92.076 Z2.0093 A53.5186
+G1 X74.109 Y90.984 Z2.0107 A53.5565
+G1 X74.388 Y89.859 Z2.0120 A53.5946
+G1 X74.602 Y88.692 Z2.0133 A53.6330
+G1 X74.767 Y87.474 Z2.0147 A53.6720
+G1 X74.906 Y86.204 Z2.0160 A53.7116
+G1 X75.041 Y84.884 Z2.0173 A53.7519
+G1 X75.199 Y83.522 Z2.0187 A53.7931
+G1 X75.406 Y82.131 Z2.0200 A53.8351
+G1 X75.687 Y80.730 Z2.0213 A53.8780
+G1 X76.064 Y79.339 Z2.0227 A53.9217
+G1 X76.554 Y77.983 Z2.0240 A53.9661
+G1 X77.170 Y76.687 Z2.0253 A54.0112
+G1 X77.920 Y75.478 Z2.0267 A54.0569
+G1 X78.804 Y74.378 Z2.0280 A54.1028
+G1 X79.816 Y73.409 Z2.0293 A54.1490
+G1 X80.948 Y72.587 Z2.0307 A54.1951
+G1 X82.182 Y71.923 Z2.0320 A54.2411
+G1 X83.501 Y71.423 Z2.0333 A54.2867
+G1 X84.883 Y71.084 Z2.0347 A54.3318
+G1 X86.306 Y70.898 Z2.0360 A54.3763
+G1 X87.747 Y70.850 Z2.0373 A54.4200
+G1 X89.186 Y70.922 Z2.0387 A54.4628
+G1 X90.606 Y71.088 Z2.0400 A54.5049
+G1 X91.993 Y71.321 Z2.0413 A54.5460
+G1 X93.337 Y71.591 Z2.0427 A54.5864
+G1 X94.634 Y71.871 Z2.0440 A54.6259
+G1 X95.885 Y72.132 Z2.0453 A54.6649
+G1 X97.094 Y72.350 Z2.0467 A54.7033
+G1 X98.270 Y72.508 Z2.0480 A54.7414
+G1 X99.426 Y72.590 Z2.0493 A54.7793
+G1 X100.574 Y72.590 Z2.0507 A54.8172
+G1 X101.730 Y72.508 Z2.0520 A54.8553
+G1 X102.906 Y72.350 Z2.0533 A54.8937
+G1 X104.115 Y72.132 Z2.0547 A54.9326
+G1 X105.366 Y71.871 Z2.0560 A54.9722
+G1 X106.663 Y71.591 Z2.0573 A55.0126
+G1 X108.007 Y71.321 Z2.0587 A55.0537
+G1 X109.394 Y71.088 Z2.0600 A55.0957
+G1 X110.814 Y70.922 Z2.0613 A55.1386
+G1 X112.253 Y70.850 Z2.0627 A55.1823
+G1 X113.694 Y70.898 Z2.0640 A55.2268
+G1 X115.117 Y71.084 Z2.0653 A55.2719
+G1 X116.499 Y71.423 Z2.0667 A55.3175
+G1 X117.818 Y71.923 Z2.0680 A55.3635
+G1 X119.052 Y72.587 Z2.0693 A55.4096
+G1 X120.184 Y73.409 Z2.0707 A55.4558
+G1 X121.196 Y74.378 Z2.0720 A55.5017
+G1 X122.080 Y75.478 Z2.0733 A55.5474
+G1 X122.830 Y76.687 Z2.0747 A55.5925
+G1 X123.446 Y77.983 Z2.0760 A55.6369
+G1 X123.936 Y79.339 Z2.0773 A55.6806
+G1 X124.313 Y80.730 Z2.0787 A55.7235
+G1 X124.594 Y82.131 Z2.0800 A55.7655
+G1 X124.801 Y83.522 Z2.0813 A55.8067
+G1 X124.959 Y84.884 Z2.0827 A55.8470
+G1 X125.094 Y86.204 Z2.0840 A55.8866
+G1 X125.233 Y87.474 Z2.0853 A55.9255
+G1 X125.398 Y88.692 Z2.0867 A55.9640
+G1 X125.612 Y89.859 Z2.0880 A56.0021
+G1 X125.891 Y90.984 Z2.0893 A56.0400
+G1 X126.246 Y92.076 Z2.0907 A56.0779
+G1 X126.681 Y93.149 Z2.0920 A56.1159
+G1 X127.194 Y94.220 Z2.0933 A56.1544
+G1 X127.776 Y95.302 Z2.0947 A56.1933
+G1 X128.411 Y96.411 Z2.0960 A56.2329
+G1 X129.077 Y97.558 Z2.0973 A56.2732
+G1 X129.750 Y98.753 Z2.0987 A56.3144
+G1 X130.400 Y100.000 Z2.1000 A56.3564
+G1 X131.046 Y101.301 Z2.1013 A56.3994
+G1 X131.559 Y102.650 Z2.1027 A56.4431
+G1 X131.959 Y104.037 Z2.1040 A56.4877
+G1 X132.222 Y105.450 Z2.1053 A56.5328
+G1 X132.326 Y106.871 Z2.1067 A56.5785
+G1 X132.257 Y108.282 Z2.1080 A56.6246
+G1 X132.007 Y109.663 Z2.1093 A56.6708
+G1 X131.574 Y110.995 Z2.1107 A56.7170
+G1 X130.965 Y112.260 Z2.1120 A56.7630
+G1 X130.191 Y113.442 Z2.1133 A56.8087
+G1 X129.271 Y114.530 Z2.1147 A56.8539
+G1 X128.229 Y115.519 Z2.1160 A56.8984
+G1 X127.090 Y116.406 Z2.1173 A56.9422
+G1 X125.882 Y117.196 Z2.1187 A56.9851
+G1 X124.635 Y117.898 Z2.1200 A57.0272
+G1 X123.375 Y118.527 Z2.1213 A57.0685
+G1 X122.127 Y119.099 Z2.1227 A57.1089
+G1 X120.912 Y119.637 Z2.1240 A57.1485
+G1 X119.745 Y120.163 Z2.1253 A57.1875
+G1 X118.637 Y120.698 Z2.1267 A57.2260
+G1 X117.591 Y121.264 Z2.1280 A57.2642
+G1 X116.606 Y121.878 Z2.1293 A57.3021
+G1 X115.675 Y122.554 Z2.1307 A57.3401
+G1 X114.787 Y123.301 Z2.1320 A57.3782
+G1 X113.926 Y124.120 Z2.1333 A57.4167
+G1 X113.074 Y125.009 Z2.1347 A57.4558
+G1 X112.214 Y125.956 Z2.1360 A57.4954
+G1 X111.327 Y126.946 Z2.1373 A57.5358
+G1 X110.397 Y127.956 Z2.1387 A57.5770
+G1 X109.410 Y128.960 Z2.1400 A57.6191
+G1 X108.356 Y129.929 Z2.1413 A57.6621
+G1 X107.232 Y130.833 Z2.1427 A57.7059
+G1 X106.036 Y131.643 Z2.1440 A57.7504
+G1 X104.774 Y132.329 Z2.1453 A57.7956
+G1 X103.454 Y132.867 Z2.1467 A57.8412
+G1 X102.091 Y133.237 Z2.1480 A57.8873
+G1 X100.700 Y133.426 Z2.1493 A57.9335
+G1 X99.300 Y133.426 Z2.1507 A57.9797
+G1 X97.909 Y133.237 Z2.1520 A58.0257
+G1 X96.546 Y132.867 Z2.1533 A58.0714
+G1 X95.226 Y132.329 Z2.1547 A58.1166
+G1 X93.964 Y131.643 Z2.1560 A58.1611
+G1 X92.768 Y130.833 Z2.1573 A58.2049
+G1 X91.644 Y129.929 Z2.1587 A58.2479
+G1 X90.590 Y128.960 Z2.1600 A58.2900
+G1 X89.603 Y127.956 Z2.1613 A58.3312
+G1 X88.673 Y126.946 Z2.1627 A58.3716
+G1 X87.786 Y125.956 Z2.1640 A58.4112
+G1 X86.926 Y125.009 Z2.1653 A58.4503
+G1 X86.074 Y124.120 Z2.1667 A58.4888
+G1 X85.213 Y123.301 Z2.1680 A58.5269
+G1 X84.325 Y122.554 Z2.1693 A58.5649
+G1 X83.394 Y121.878 Z2.1707 A58.6028
+G1 X82.409 Y121.264 Z2.1720 A58.6410
+G1 X81.363 Y120.698 Z2.1733 A58.6795
+G1 X80.255 Y120.163 Z2.1747 A58.7185
+G1 X79.088 Y119.637 Z2.1760 A58.7581
+G1 X77.873 Y119.099 Z2.1773 A58.7985
+G1 X76.625 Y118.527 Z2.1787 A58.8398
+G1 X75.365 Y117.898 Z2.1800 A58.8819
+G1 X74.118 Y117.196 Z2.1813 A58.9248
+G1 X72.910 Y116.406 Z2.1827 A58.9686
+G1 X71.771 Y115.519 Z2.1840 A59.0131
+G1 X70.729 Y114.530 Z2.1853 A59.0583
+G1 X69.809 Y113.442 Z2.1867 A59.1040
+G1 X69.035 Y112.260 Z2.1880 A59.1500
+G1 X68.426 Y110.995 Z2.1893 A59.1962
+G1 X67.993 Y109.663 Z2.1907 A59.2424
+G1 X67.743 Y108.282 Z2.1920 A59.2885
+G1 X67.674 Y106.871 Z2.1933 A59.3342
+G1 X67.778 Y105.450 Z2.1947 A59.3793
+G1 X68.041 Y104.037 Z2.1960 A59.4239
+G1 X68.441 Y102.650 Z2.1973 A59.4676
+G1 X68.954 Y101.301 Z2.1987 A59.5106
+G1 X69.550 Y100.000 Z2.2000 A59.5527
+G1 X70.200 Y98.751 Z2.2013 A59.5939
+G1 X70.873 Y97.554 Z2.2027 A59.6343
+G1 X71.540 Y96.405 Z2.2040 A59.6740
+G1 X72.175 Y95.294 Z2.2053 A59.7130
+G1 X72.757 Y94.209 Z2.2067 A59.7515
+G1 X73.270 Y93.137 Z2.2080 A59.7896
+G1 X73.706 Y92.061 Z2.2093 A59.8276
+G1 X74.061 Y90.967 Z2.2107 A59.8656
+G1 X74.341 Y89.841 Z2.2120 A59.9037
+G1 X74.556 Y88.672 Z2.2133 A59.9422
+G1 X74.723 Y87.452 Z2.2147 A59.9812
+G1 X74.862 Y86.180 Z2.2160 A60.0209
+G1 X74.998 Y84.858 Z2.2173 A60.0613
+G1 X75.157 Y83.494 Z2.2187 A60.1025
+G1 X75.365 Y82.102 Z2.2200 A60.1446
+G1 X75.648 Y80.699 Z2.2213 A60.1876
+G1 X76.026 Y79.306 Z2.2227 A60.2313
+G1 X76.517 Y77.948 Z2.2240 A60.2759
+G1 X77.135 Y76.651 Z2.2253 A60.3210
+G1 X77.887 Y75.440 Z2.2267 A60.3667
+G1 X78.772 Y74.339 Z2.2280 A60.4127
+G1 X79.786 Y73.369 Z2.2293 A60.4590
+G1 X80.919 Y72.546 Z2.2307 A60.5052
+G1 X82.155 Y71.881 Z2.2320 A60.5512
+G1 X83.476 Y71.380 Z2.2333 A60.5969
+G1 X84.860 Y71.039 Z2.2347 A60.6421
+G1 X86.284 Y70.852 Z2.2360 A60.6866
+G1 X87.727 Y70.804 Z2.2373 A60.7304
+G1 X89.169 Y70.875 Z2.2387 A60.7733
+G1 X90.590 Y71.040 Z2.2400 A60.8154
+G1 X91.979 Y71.272 Z2.2413 A60.8566
+G1 X93.325 Y71.542 Z2.2427 A60.8971
+G1 X94.625 Y71.821 Z2.2440 A60.9367
+G1 X95.877 Y72.082 Z2.2453 A60.9757
+G1 X97.089 Y72.301 Z2.2467 A61.0142
+G1 X98.267 Y72.458 Z2.2480 A61.0524
+G1 X99.425 Y72.540 Z2.2493 A61.0903
+G1 X100.575 Y72.540 Z2.2507 A61.1283
+G1 X101.733 Y72.458 Z2.2520 A61.1664
+G1 X102.911 Y72.301 Z2.2533 A61.2049
+G1 X104.123 Y72.082 Z2.2547 A61.2440
+G1 X105.375 Y71.821 Z2.2560 A61.2836
+G1 X106.675 Y71.542 Z2.2573 A61.3240
+G1 X108.021 Y71.272 Z2.2587 A61.3652
+G1 X109.410 Y71.040 Z2.2600 A61.4073
+G1 X110.831 Y70.875 Z2.2613 A61.4503
+G1 X112.273 Y70.804 Z2.2627 A61.4941
+G1 X113.716 Y70.852 Z2.2640 A61.5386
+G1 X115.140 Y71.039 Z2.2653 A61.5838
+G1 X116.524 Y71.380 Z2.2667 A61.6294
+G1 X117.845 Y71.881 Z2.2680 A61.6755
+G1 X119.081 Y72.546 Z2.2693 A61.7217
+G1 X120.214 Y73.369 Z2.2707 A61.7679
+G1 X121.228 Y74.339 Z2.2720 A61.8139
+G1 X122.113 Y75.440 Z2.2733 A61.8596
+G1 X122.865 Y76.651 Z2.2747 A61.9048
+G1 X123.483 Y77.948 Z2.2760 A61.9493
+G1 X123.974 Y79.306 Z2.2773 A61.9931
+G1 X124.352 Y80.699 Z2.2787 A62.0361
+G1 X124.635 Y82.102 Z2.2800 A62.0782
+G1 X124.843 Y83.494 Z2.2813 A62.1194
+G1 X125.002 Y84.858 Z2.2827 A62.1598
+G1 X125.138 Y86.180 Z2.2840 A62.1994
+G1 X125.277 Y87.452 Z2.2853 A62.2384
+G1 X125.444 Y88.672 Z2.2867 A62.2769
+G1 X125.659 Y89.841 Z2.2880 A62.3151
+G1 X125.939 Y90.967 Z2.2893 A62.3531
+G1 X126.294 Y92.061 Z2.2907 A62.3910
+G1 X126.730 Y93.137 Z2.2920 A62.4292
+G1 X127.243 Y94.209 Z2.2933 A62.4677
+G1 X127.825 Y95.294 Z2.2947 A62.5067
+G1 X128.460 Y96.405 Z2.2960 A62.5463
+G1 X129.127 Y97.554 Z2.2973 A62.5867
+G1 X129.800 Y98.751 Z2.2987 A62.6280
+G1 X130.450 Y100.000 Z2.3000 A62.6701
+G1 X131.096 Y101.303 Z2.3013 A62.7131
+G1 X131.609 Y102.654 Z2.3027 A62.7569
+G1 X132.009 Y104.044 Z2.3040 A62.8015
+G1 X132.271 Y105.458 Z2.3053 A62.8468
+G1 X132.375 Y106.881 Z2.3067 A62.8925
+G1 X132.305 Y108.295 Z2.3080 A62.9386
+G1 X132.054 Y109.678 Z2.3093 A62.9849
+G1 X131.621 Y111.012 Z2.3107 A63.0312
+G1 X131.011 Y112.278 Z2.3120 A63.0773
+G1 X130.237 Y113.462 Z2.3133 A63.1230
+G1 X129.316 Y114.553 Z2.3147 A63.1683
+G1 X128.273 Y115.543 Z2.3160 A63.2129
+G1 X127.132 Y116.432 Z2.3173 A63.2567
+G1 X125.924 Y117.224 Z2.3187 A63.2998
+G1 X124.675 Y117.927 Z2.3200 A63.3419
+G1 X123.414 Y118.558 Z2.3213 A63.3832
+G1 X122.165 Y119.132 Z2.3227 A63.4237
+G1 X120.948 Y119.672 Z2.3240 A63.4634
+G1 X119.780 Y120.199 Z2.3253 A63.5025
+G1 X118.670 Y120.735 Z2.3267 A63.5411
+G1 X117.623 Y121.302 Z2.3280 A63.5793
+G1 X116.636 Y121.918 Z2.3293 A63.6173
+G1 X115.704 Y122.595 Z2.3307 A63.6553
+G1 X114.814 Y123.343 Z2.3320 A63.6936
+G1 X113.951 Y124.164 Z2.3333 A63.7321
+G1 X113.098 Y125.053 Z2.3347 A63.7712
+G1 X112.235 Y126.002 Z2.3360 A63.8109
+G1 X111.346 Y126.992 Z2.3373 A63.8514
+G1 X110.414 Y128.002 Z2.3387 A63.8927
+G1 X109.425 Y129.007 Z2.3400 A63.9349
+G1 X108.370 Y129.977 Z2.3413 A63.9779
+G1 X107.243 Y130.882 Z2.3427 A64.0217
+G1 X106.046 Y131.692 Z2.3440 A64.0663
+G1 X104.781 Y132.378 Z2.3453 A64.1116
+G1 X103.460 Y132.917 Z2.3467 A64.1573
+G1 X102.094 Y133.287 Z2.3480 A64.2034
+G1 X100.701 Y133.476 Z2.3493 A64.2497
+G1 X99.299 Y133.476 Z2.3507 A64.2960
+G1 X97.906 Y133.287 Z2.3520 A64.3421
+G1 X96.540 Y132.917 Z2.3533 A64.3879
+G1 X95.219 Y132.378 Z2.3547 A64.4331
+G1 X93.954 Y131.692 Z2.3560 A64.4777
+G1 X92.757 Y130.882 Z2.3573 A64.5215
+G1 X91.630 Y129.977 Z2.3587 A64.5646
+G1 X90.575 Y129.007 Z2.3600 A64.6067
+G1 X89.586 Y128.002 Z2.3613 A64.6480
+G1 X88.654 Y126.992 Z2.3627 A64.6885
+G1 X87.765 Y126.002 Z2.3640 A64.7282
+G1 X86.902 Y125.053 Z2.3653 A64.7673
+G1 X86.049 Y124.164 Z2.3667 A64.8059
+G1 X85.186 Y123.343 Z2.3680 A64.8441
+G1 X84.296 Y122.595 Z2.3693 A64.8821
+G1 X83.364 Y121.918 Z2.3707 A64.9202
+G1 X82.377 Y121.302 Z2.3720 A64.9584
+G1 X81.330 Y120.735 Z2.3733 A64.9969
+G1 X80.220 Y120.199 Z2.3747 A65.0360
+G1 X79.052 Y119.672 Z2.3760 A65.0757
+G1 X77.835 Y119.132 Z2.3773 A65.1162
+G1 X76.586 Y118.558 Z2.3787 A65.1575
+G1 X75.325 Y117.927 Z2.3800 A65.1997
+G1 X74.076 Y117.224 Z2.3813 A65.2427
+G1 X72.868 Y116.432 Z2.3827 A65.2865
+G1 X71.727 Y115.543 Z2.3840 A65.3311
+G1 X70.684 Y114.553 Z2.3853 A65.3764
+G1 X69.763 Y113.462 Z2.3867 A65.4221
+G1 X68.989 Y112.278 Z2.3880 A65.4682
+G1 X68.379 Y111.012 Z2.3893 A65.5145
+G1 X67.946 Y109.678 Z2.3907 A65.5608
+G1 X67.695 Y108.295 Z2.3920 A65.6069
+G1 X67.625 Y106.881 Z2.3933 A65.6527
+G1 X67.729 Y105.458 Z2.3947 A65.6979
+G1 X67.991 Y104.044 Z2.3960 A65.7425
+G1 X68.391 Y102.654 Z2.3973 A65.7863
+G1 X68.904 Y101.303 Z2.3987 A65.8294
+G1 X69.500 Y100.000 Z2.4000 A65.8715
+G1 X70.150 Y98.749 Z2.4013 A65.9128
+G1 X70.823 Y97.550 Z2.4027 A65.9533
+G1 X71.490 Y96.398 Z2.4040 A65.9930
+G1 X72.125 Y95.285 Z2.4053 A66.0321
+G1 X72.708 Y94.199 Z2.4067 A66.0707
+G1 X73.222 Y93.125 Z2.4080 A66.1089
+G1 X73.658 Y92.047 Z2.4093 A66.1469
+G1 X74.014 Y90.951 Z2.4107 A66.1850
+G1 X74.295 Y89.823 Z2.4120 A66.2232
+G1 X74.510 Y88.651 Z2.4133 A66.2617
+G1 X74.678 Y87.430 Z2.4147 A66.3008
+G1 X74.818 Y86.156 Z2.4160 A66.3405
+G1 X74.955 Y84.832 Z2.4173 A66.3810
+G1 X75.115 Y83.467 Z2.4187 A66.4223
+G1 X75.325 Y82.073 Z2.4200 A66.4645
+G1 X75.609 Y80.668 Z2.4213 A66.5075
+G1 X75.988 Y79.273 Z2.4227 A66.5513
+G1 X76.481 Y77.914 Z2.4240 A66.5959
+G1 X77.100 Y76.616 Z2.4253 A66.6412
+G1 X77.853 Y75.403 Z2.4267 A66.6869
+G1 X78.740 Y74.301 Z2.4280 A66.7330
+G1 X79.756 Y73.329 Z2.4293 A66.7793
+G1 X80.890 Y72.505 Z2.4307 A66.8256
+G1 X82.128 Y71.839 Z2.4320 A66.8717
+G1 X83.451 Y71.336 Z2.4333 A66.9175
+G1 X84.837 Y70.995 Z2.4347 A66.9627
+G1 X86.263 Y70.807 Z2.4360 A67.0073
+G1 X87.708 Y70.758 Z2.4373 A67.0512
+G1 X89.151 Y70.828 Z2.4387 A67.0942
+G1 X90.575 Y70.993 Z2.4400 A67.1363
+G1 X91.966 Y71.224 Z2.4413 A67.1776
+G1 X93.314 Y71.494 Z2.4427 A67.2181
+G1 X94.615 Y71.772 Z2.4440 A67.2578
+G1 X95.870 Y72.033 Z2.4453 A67.2969
+G1 X97.083 Y72.251 Z2.4467 A67.3355
+G1 X98.264 Y72.408 Z2.4480 A67.3737
+G1 X99.424 Y72.490 Z2.4493 A67.4117
+G1 X100.576 Y72.490 Z2.4507 A67.4498
+G1 X101.736 Y72.408 Z2.4520 A67.4880
+G1 X102.917 Y72.251 Z2.4533 A67.5265
+G1 X104.130 Y72.033 Z2.4547 A67.5656
+G1 X105.385 Y71.772 Z2.4560 A67.6054
+G1 X106.686 Y71.494 Z2.4573 A67.6458
+G1 X108.034 Y71.224 Z2.4587 A67.6871
+G1 X109.425 Y70.993 Z2.4600 A67.7293
+G1 X110.849 Y70.828 Z2.4613 A67.7723
+G1 X112.292 Y70.758 Z2.4627 A67.8162
+G1 X113.737 Y70.807 Z2.4640 A67.8607
+G1 X115.163 Y70.995 Z2.4653 A67.9060
+G1 X116.549 Y71.336 Z2.4667 A67.9517
+G1 X117.872 Y71.839 Z2.4680 A67.9978
+G1 X119.110 Y72.505 Z2.4693 A68.0441
+G1 X120.244 Y73.329 Z2.4707 A68.0904
+G1 X121.260 Y74.301 Z2.4720 A68.1365
+G1 X122.147 Y75.403 Z2.4733 A68.1823
+G1 X122.900 Y76.616 Z2.4747 A68.2275
+G1 X123.519 Y77.914 Z2.4760 A68.2721
+G1 X124.012 Y79.273 Z2.4773 A68.3160
+G1 X124.391 Y80.668 Z2.4787 A68.3590
+G1 X124.675 Y82.073 Z2.4800 A68.4011
+G1 X124.885 Y83.467 Z2.4813 A68.4424
+G1 X125.045 Y84.832 Z2.4827 A68.4829
+G1 X125.182 Y86.156 Z2.4840 A68.5226
+G1 X125.322 Y87.430 Z2.4853 A68.5617
+G1 X125.490 Y88.651 Z2.4867 A68.6003
+G1 X125.705 Y89.823 Z2.4880 A68.6385
+G1 X125.986 Y90.951 Z2.4893 A68.6765
+G1 X126.342 Y92.047 Z2.4907 A68.7146
+G1 X126.778 Y93.125 Z2.4920 A68.7528
+G1 X127.292 Y94.199 Z2.4933 A68.7914
+G1 X127.875 Y95.285 Z2.4947 A68.8304
+G1 X128.510 Y96.398 Z2.4960 A68.8702
+G1 X129.177 Y97.550 Z2.4973 A68.9106
+G1 X129.850 Y98.749 Z2.4987 A68.9519
+G1 X130.500 Y100.000 Z2.5000 A68.9941
+G1 X131.146 Y101.305 Z2.5013 A69.0372
+G1 X131.659 Y102.658 Z2.5027 A69.0811
+G1 X132.059 Y104.050 Z2.5040 A69.1258
+G1 X132.320 Y105.467 Z2.5053 A69.1711
+G1 X132.424 Y106.892 Z2.5067 A69.2169
+G1 X132.354 Y108.307 Z2.5080 A69.2631
+G1 X132.102 Y109.692 Z2.5093 A69.3094
+G1 X131.668 Y111.028 Z2.5107 A69.3558
+G1 X131.057 Y112.297 Z2.5120 A69.4019
+G1 X130.282 Y113.483 Z2.5133 A69.4478
+G1 X129.361 Y114.575 Z2.5147 A69.4931
+G1 X128.316 Y115.567 Z2.5160 A69.5377
+G1 X127.175 Y116.458 Z2.5173 A69.5817
+G1 X125.965 Y117.251 Z2.5187 A69.6248
+G1 X124.715 Y117.957 Z2.5200 A69.6670
+G1 X123.453 Y118.589 Z2.5213 A69.7083
+G1 X122.203 Y119.165 Z2.5227 A69.7489
+G1 X120.985 Y119.706 Z2.5240 A69.7887
+G1 X119.815 Y120.234 Z2.5253 A69.8278
+G1 X118.703 Y120.772 Z2.5267 A69.8665
+G1 X117.655 Y121.341 Z2.5280 A69.9048
+G1 X116.667 Y121.957 Z2.5293 A69.9429
+G1 X115.733 Y122.636 Z2.5307 A69.9810
+G1 X114.841 Y123.385 Z2.5320 A70.0192
+G1 X113.976 Y124.207 Z2.5333 A70.0579
+G1 X113.121 Y125.098 Z2.5347 A70.0970
+G1 X112.257 Y126.047 Z2.5360 A70.1368
+G1 X111.366 Y127.038 Z2.5373 A70.1774
+G1 X110.431 Y128.049 Z2.5387 A70.2187
+G1 X109.440 Y129.055 Z2.5400 A70.2610
+G1 X108.383 Y130.025 Z2.5413 A70.3041
+G1 X107.255 Y130.931 Z2.5427 A70.3480
+G1 X106.055 Y131.741 Z2.5440 A70.3926
+G1 X104.789 Y132.428 Z2.5453 A70.4380
+G1 X103.465 Y132.966 Z2.5467 A70.4838
+G1 X102.097 Y133.337 Z2.5480 A70.5299
+G1 X100.702 Y133.526 Z2.5493 A70.5763
+G1 X99.298 Y133.526 Z2.5507 A70.6227
+G1 X97.903 Y133.337 Z2.5520 A70.6688
+G1 X96.535 Y132.966 Z2.5533 A70.7146
+G1 X95.211 Y132.428 Z2.5547 A70.7600
+G1 X93.945 Y131.741 Z2.5560 A70.8046
+G1 X92.745 Y130.931 Z2.5573 A70.8485
+G1 X91.617 Y130.025 Z2.5587 A70.8916
+G1 X90.560 Y129.055 Z2.5600 A70.9339
+G1 X89.569 Y128.049 Z2.5613 A70.9752
+G1 X88.634 Y127.038 Z2.5627 A71.0158
+G1 X87.743 Y126.047 Z2.5640 A71.0556
+G1 X86.879 Y125.098 Z2.5653 A71.0947
+G1 X86.024 Y124.207 Z2.5667 A71.1333
+G1 X85.159 Y123.385 Z2.5680 A71.1716
+G1 X84.267 Y122.636 Z2.5693 A71.2097
+G1 X83.333 Y121.957 Z2.5707 A71.2478
+G1 X82.345 Y121.341 Z2.5720 A71.2861
+G1 X81.297 Y120.772 Z2.5733 A71.3248
+G1 X80.185 Y120.234 Z2.5747 A71.3639
+G1 X79.015 Y119.706 Z2.5760 A71.4037
+G1 X77.797 Y119.165 Z2.5773 A71.4442
+G1 X76.547 Y118.589 Z2.5787 A71.4856
+G1 X75.285 Y117.957 Z2.5800 A71.5278
+G1 X74.035 Y117.251 Z2.5813 A71.5709
+G1 X72.825 Y116.458 Z2.5827 A71.6149
+G1 X71.684 Y115.567 Z2.5840 A71.6595
+G1 X70.639 Y114.575 Z2.5853 A71.7048
+G1 X69.718 Y113.483 Z2.5867 A71.7507
+G1 X68.943 Y112.297 Z2.5880 A71.7968
+G1 X68.332 Y111.028 Z2.5893 A71.8432
+G1 X67.898 Y109.692 Z2.5907 A71.8895
+G1 X67.646 Y108.307 Z2.5920 A71.9357
+G1 X67.576 Y106.892 Z2.5933 A71.9815
+G1 X67.680 Y105.467 Z2.5947 A72.0268
+G1 X67.941 Y104.050 Z2.5960 A72.0715
+G1 X68.341 Y102.658 Z2.5973 A72.1154
+G1 X68.854 Y101.305 Z2.5987 A72.1585
+G1 X69.450 Y100.000 Z2.6000 A72.2007
+G1 X70.100 Y98.747 Z2.6013 A72.2421
+G1 X70.773 Y97.546 Z2.6027 A72.2826
+G1 X71.440 Y96.392 Z2.6040 A72.3224
+G1 X72.076 Y95.277 Z2.6053 A72.3616
+G1 X72.659 Y94.188 Z2.6067 A72.4002
+G1 X73.173 Y93.112 Z2.6080 A72.4385
+G1 X73.610 Y92.032 Z2.6093 A72.4766
+G1 X73.967 Y90.934 Z2.6107 A72.5147
+G1 X74.248 Y89.804 Z2.6120 A72.5530
+G1 X74.465 Y88.631 Z2.6133 A72.5916
+G1 X74.633 Y87.408 Z2.6147 A72.6308
+G1 X74.774 Y86.132 Z2.6160 A72.6706
+G1 X74.912 Y84.806 Z2.6173 A72.7111
+G1 X75.074 Y83.439 Z2.6187 A72.7525
+G1 X75.285 Y82.043 Z2.6200 A72.7947
+G1 X75.569 Y80.637 Z2.6213 A72.8378
+G1 X75.950 Y79.241 Z2.6227 A72.8817
+G1 X76.445 Y77.880 Z2.6240 A72.9264
+G1 X77.065 Y76.580 Z2.6253 A72.9717
+G1 X77.820 Y75.366 Z2.6267 A73.0175
+G1 X78.708 Y74.262 Z2.6280 A73.0637
+G1 X79.726 Y73.290 Z2.6293 A73.1101
+G1 X80.862 Y72.464 Z2.6307 A73.1564
+G1 X82.102 Y71.797 Z2.6320 A73.2026
+G1 X83.426 Y71.293 Z2.6333 A73.2484
+G1 X84.813 Y70.951 Z2.6347 A73.2937
+G1 X86.242 Y70.762 Z2.6360 A73.3384
+G1 X87.689 Y70.712 Z2.6373 A73.3823
+G1 X89.134 Y70.781 Z2.6387 A73.4254
+G1 X90.560 Y70.945 Z2.6400 A73.4676
+G1 X91.952 Y71.176 Z2.6413 A73.5090
+G1 X93.303 Y71.445 Z2.6427 A73.5495
+G1 X94.606 Y71.723 Z2.6440 A73.5893
+G1 X95.863 Y71.983 Z2.6453 A73.6285
+G1 X97.078 Y72.201 Z2.6467 A73.6671
+G1 X98.261 Y72.358 Z2.6480 A73.7054
+G1 X99.423 Y72.440 Z2.6493 A73.7435
+G1 X100.577 Y72.440 Z2.6507 A73.7816
+G1 X101.739 Y72.358 Z2.6520 A73.8199
+G1 X102.922 Y72.201 Z2.6533 A73.8585
+G1 X104.137 Y71.983 Z2.6547 A73.8977
+G1 X105.394 Y71.723 Z2.6560 A73.9375
+G1 X106.697 Y71.445 Z2.6573 A73.9780
+G1 X108.048 Y71.176 Z2.6587 A74.0194
+G1 X109.440 Y70.945 Z2.6600 A74.0616
+G1 X110.866 Y70.781 Z2.6613 A74.1047
+G1 X112.311 Y70.712 Z2.6627 A74.1486
+G1 X113.758 Y70.762 Z2.6640 A74.1933
+G1 X115.187 Y70.951 Z2.6653 A74.2386
+G1 X116.574 Y71.293 Z2.6667 A74.2844
+G1 X117.898 Y71.797 Z2.6680 A74.3306
+G1 X119.138 Y72.464 Z2.6693 A74.3769
+G1 X120.274 Y73.290 Z2.6707 A74.4233
+G1 X121.292 Y74.262 Z2.6720 A74.4695
+G1 X122.180 Y75.366 Z2.6733 A74.5153
+G1 X122.935 Y76.580 Z2.6747 A74.5606
+G1 X123.555 Y77.880 Z2.6760 A74.6053
+G1 X124.050 Y79.241 Z2.6773 A74.6492
+G1 X124.431 Y80.637 Z2.6787 A74.6923
+G1 X124.715 Y82.043 Z2.6800 A74.7345
+G1 X124.926 Y83.439 Z2.6813 A74.7759
+G1 X125.088 Y84.806 Z2.6827 A74.8164
+G1 X125.226 Y86.132 Z2.6840 A74.8562
+G1 X125.367 Y87.408 Z2.6853 A74.8953
+G1 X125.535 Y88.631 Z2.6867 A74.9340
+G1 X125.752 Y89.804 Z2.6880 A74.9723
+G1 X126.033 Y90.934 Z2.6893 A75.0104
+G1 X126.390 Y92.032 Z2.6907 A75.0485
+G1 X126.827 Y93.112 Z2.6920 A75.0868
+G1 X127.341 Y94.188 Z2.6933 A75.1254
+G1 X127.924 Y95.277 Z2.6947 A75.1645
+G1 X128.560 Y96.392 Z2.6960 A75.2043
+G1 X129.227 Y97.546 Z2.6973 A75.2449
+G1 X129.900 Y98.747 Z2.6987 A75.2863
+G1 X130.550 Y100.000 Z2.7000 A75.3285
+G1 X131.196 Y101.308 Z2.7013 A75.3716
+G1 X131.709 Y102.663 Z2.7027 A75.4156
+G1 X132.108 Y104.056 Z2.7040 A75.4604
+G1 X132.370 Y105.475 Z2.7053 A75.5057
+G1 X132.473 Y106.902 Z2.7067 A75.5516
+G1 X132.402 Y108.319 Z2.7080 A75.5979
+G1 X132.150 Y109.707 Z2.7093 A75.6443
+G1 X131.716 Y111.045 Z2.7107 A75.6907
+G1 X131.104 Y112.315 Z2.7120 A75.7370
+G1 X130.328 Y113.503 Z2.7133 A75.7829
+G1 X129.406 Y114.597 Z2.7147 A75.8282
+G1 X128.360 Y115.591 Z2.7160 A75.8730
+G1 X127.218 Y116.484 Z2.7173 A75.9170
+G1 X126.007 Y117.279 Z2.7187 A75.9601
+G1 X124.756 Y117.986 Z2.7200 A76.0024
+G1 X123.492 Y118.620 Z2.7213 A76.0438
+G1 X122.240 Y119.197 Z2.7227 A76.0845
+G1 X121.021 Y119.740 Z2.7240 A76.1243
+G1 X119.850 Y120.270 Z2.7253 A76.1635
+G1 X118.737 Y120.809 Z2.7267 A76.2022
+G1 X117.686 Y121.379 Z2.7280 A76.2406
+G1 X116.697 Y121.997 Z2.7293 A76.2788
+G1 X115.761 Y122.677 Z2.7307 A76.3169
+G1 X114.867 Y123.427 Z2.7320 A76.3553
+G1 X114.001 Y124.250 Z2.7333 A76.3940
+G1 X113.144 Y125.142 Z2.7347 A76.4332
+G1 X112.278 Y126.092 Z2.7360 A76.4731
+G1 X111.385 Y127.084 Z2.7373 A76.5137
+G1 X110.449 Y128.096 Z2.7387 A76.5551
+G1 X109.456 Y129.102 Z2.7400 A76.5974
+G1 X108.397 Y130.074 Z2.7413 A76.6406
+G1 X107.266 Y130.979 Z2.7427 A76.6846
+G1 X106.064 Y131.790 Z2.7440 A76.7293
+G1 X104.796 Y132.477 Z2.7453 A76.7747
+G1 X103.470 Y133.016 Z2.7467 A76.8206
+G1 X102.101 Y133.387 Z2.7480 A76.8668
+G1 X100.703 Y133.576 Z2.7493 A76.9132
+G1 X99.297 Y133.576 Z2.7507 A76.9597
+G1 X97.899 Y133.387 Z2.7520 A77.0059
+G1 X96.530 Y133.016 Z2.7533 A77.0518
+G1 X95.204 Y132.477 Z2.7547 A77.0972
+G1 X93.936 Y131.790 Z2.7560 A77.1419
+G1 X92.734 Y130.979 Z2.7573 A77.1859
+G1 X91.603 Y130.074 Z2.7587 A77.2291
+G1 X90.544 Y129.102 Z2.7600 A77.2714
+G1 X89.551 Y128.096 Z2.7613 A77.3128
+G1 X88.615 Y127.084 Z2.7627 A77.3534
+G1 X87.722 Y126.092 Z2.7640 A77.3933
+G1 X86.856 Y125.142 Z2.7653 A77.4325
+G1 X85.999 Y124.250 Z2.7667 A77.4712
+G1 X85.133 Y123.427 Z2.7680 A77.5096
+G1 X84.239 Y122.677 Z2.7693 A77.5477
+G1 X83.303 Y121.997 Z2.7707 A77.5859
+G1 X82.314 Y121.379 Z2.7720 A77.6243
+G1 X81.263 Y120.809 Z2.7733 A77.6630
+G1 X80.150 Y120.270 Z2.7747 A77.7022
+G1 X78.979 Y119.740 Z2.7760 A77.7420
+G1 X77.760 Y119.197 Z2.7773 A77.7826
+G1 X76.508 Y118.620 Z2.7787 A77.8241
+G1 X75.244 Y117.986 Z2.7800 A77.8664
+G1 X73.993 Y117.279 Z2.7813 A77.9095
+G1 X72.782 Y116.484 Z2.7827 A77.9535
+G1 X71.640 Y115.591 Z2.7840 A77.9983
+G1 X70.594 Y114.597 Z2.7853 A78.0436
+G1 X69.672 Y113.503 Z2.7867 A78.0895
+G1 X68.896 Y112.315 Z2.7880 A78.1358
+G1 X68.284 Y111.045 Z2.7893 A78.1822
+G1 X67.850 Y109.707 Z2.7907 A78.2286
+G1 X67.598 Y108.319 Z2.7920 A78.2749
+G1 X67.527 Y106.902 Z2.7933 A78.3208
+G1 X67.630 Y105.475 Z2.7947 A78.3661
+G1 X67.892 Y104.056 Z2.7960 A78.4109
+G1 X68.291 Y102.663 Z2.7973 A78.4549
+G1 X68.804 Y101.308 Z2.7987 A78.4980
+G1 X69.400 Y100.000 Z2.8000 A78.5403
+G1 X70.050 Y98.745 Z2.8013 A78.5818
+G1 X70.723 Y97.542 Z2.8027 A78.6224
+G1 X71.391 Y96.386 Z2.8040 A78.6622
+G1 X72.027 Y95.269 Z2.8053 A78.7014
+G1 X72.610 Y94.178 Z2.8067 A78.7401
+G1 X73.125 Y93.100 Z2.8080 A78.7785
+G1 X73.562 Y92.018 Z2.8093 A78.8167
+G1 X73.920 Y90.918 Z2.8107 A78.8549
+G1 X74.202 Y89.786 Z2.8120 A78.8932
+G1 X74.419 Y88.611 Z2.8133 A78.9319
+G1 X74.588 Y87.385 Z2.8147 A78.9711
+G1 X74.730 Y86.108 Z2.8160 A79.0110
+G1 X74.870 Y84.780 Z2.8173 A79.0516
+G1 X75.032 Y83.411 Z2.8187 A79.0930
+G1 X75.244 Y82.014 Z2.8200 A79.1353
+G1 X75.530 Y80.605 Z2.8213 A79.1785
+G1 X75.912 Y79.208 Z2.8227 A79.2225
+G1 X76.408 Y77.846 Z2.8240 A79.2672
+G1 X77.030 Y76.544 Z2.8253 A79.3126
+G1 X77.786 Y75.329 Z2.8267 A79.3585
+G1 X78.676 Y74.224 Z2.8280 A79.4047
+G1 X79.695 Y73.250 Z2.8293 A79.4512
+G1 X80.833 Y72.423 Z2.8307 A79.4976
+G1 X82.075 Y71.755 Z2.8320 A79.5438
+G1 X83.401 Y71.250 Z2.8333 A79.5897
+G1 X84.790 Y70.906 Z2.8347 A79.6351
+G1 X86.220 Y70.717 Z2.8360 A79.6798
+G1 X87.669 Y70.666 Z2.8373 A79.7238
+G1 X89.116 Y70.735 Z2.8387 A79.7670
+G1 X90.544 Y70.898 Z2.8400 A79.8093
+G1 X91.939 Y71.128 Z2.8413 A79.8507
+G1 X93.291 Y71.396 Z2.8427 A79.8913
+G1 X94.597 Y71.674 Z2.8440 A79.9312
+G1 X95.856 Y71.934 Z2.8453 A79.9704
+G1 X97.073 Y72.151 Z2.8467 A80.0091
+G1 X98.258 Y72.308 Z2.8480 A80.0475
+G1 X99.422 Y72.390 Z2.8493 A80.0856
+G1 X100.578 Y72.390 Z2.8507 A80.1238
+G1 X101.742 Y72.308 Z2.8520 A80.1622
+G1 X102.927 Y72.151 Z2.8533 A80.2009
+G1 X104.144 Y71.934 Z2.8547 A80.2401
+G1 X105.403 Y71.674 Z2.8560 A80.2799
+G1 X106.709 Y71.396 Z2.8573 A80.3206
+G1 X108.061 Y71.128 Z2.8587 A80.3620
+G1 X109.456 Y70.898 Z2.8600 A80.4043
+G1 X110.884 Y70.735 Z2.8613 A80.4474
+G1 X112.331 Y70.666 Z2.8627 A80.4914
+G1 X113.780 Y70.717 Z2.8640 A80.5362
+G1 X115.210 Y70.906 Z2.8653 A80.5816
+G1 X116.599 Y71.250 Z2.8667 A80.6274
+G1 X117.925 Y71.755 Z2.8680 A80.6737
+G1 X119.167 Y72.423 Z2.8693 A80.7201
+G1 X120.305 Y73.250 Z2.8707 A80.7665
+G1 X121.324 Y74.224 Z2.8720 A80.8128
+G1 X122.214 Y75.329 Z2.8733 A80.8587
+G1 X122.970 Y76.544 Z2.8747 A80.9040
+G1 X123.592 Y77.846 Z2.8760 A80.9488
+G1 X124.088 Y79.208 Z2.8773 A80.9928
+G1 X124.470 Y80.605 Z2.8787 A81.0359
+G1 X124.756 Y82.014 Z2.8800 A81.0782
+G1 X124.968 Y83.411 Z2.8813 A81.1197
+G1 X125.130 Y84.780 Z2.8827 A81.1603
+G1 X125.270 Y86.108 Z2.8840 A81.2001
+G1 X125.412 Y87.385 Z2.8853 A81.2393
+G1 X125.581 Y88.611 Z2.8867 A81.2781
+G1 X125.798 Y89.786 Z2.8880 A81.3164
+G1 X126.080 Y90.918 Z2.8893 A81.3546
+G1 X126.438 Y92.018 Z2.8907 A81.3928
+G1 X126.875 Y93.100 Z2.8920 A81.4311
+G1 X127.390 Y94.178 Z2.8933 A81.4698
+G1 X127.973 Y95.269 Z2.8947 A81.5090
+G1 X128.609 Y96.386 Z2.8960 A81.5489
+G1 X129.277 Y97.542 Z2.8973 A81.5895
+G1 X129.950 Y98.745 Z2.8987 A81.6309
+G1 X130.600 Y100.000 Z2.9000 A81.6732
+G1 X131.246 Y101.310 Z2.9013 A81.7165
+G1 X131.758 Y102.667 Z2.9027 A81.7605
+G1 X132.158 Y104.062 Z2.9040 A81.8053
+G1 X132.419 Y105.483 Z2.9053 A81.8508
+G1 X132.522 Y106.913 Z2.9067 A81.8967
+G1 X132.451 Y108.332 Z2.9080 A81.9430
+G1 X132.198 Y109.721 Z2.9093 A81.9895
+G1 X131.763 Y111.061 Z2.9107 A82.0360
+G1 X131.150 Y112.333 Z2.9120 A82.0823
+G1 X130.374 Y113.523 Z2.9133 A82.1283
+G1 X129.450 Y114.619 Z2.9147 A82.1738
+G1 X128.404 Y115.615 Z2.9160 A82.2186
+G1 X127.261 Y116.510 Z2.9173 A82.2626
+G1 X126.049 Y117.307 Z2.9187 A82.3058
+G1 X124.796 Y118.016 Z2.9200 A82.3482
+G1 X123.531 Y118.651 Z2.9213 A82.3897
+G1 X122.278 Y119.230 Z2.9227 A82.4304
+G1 X121.057 Y119.774 Z2.9240 A82.4703
+G1 X119.885 Y120.306 Z2.9253 A82.5096
+G1 X118.770 Y120.847 Z2.9267 A82.5484
+G1 X117.718 Y121.418 Z2.9280 A82.5868
+G1 X116.727 Y122.037 Z2.9293 A82.6251
+G1 X115.790 Y122.718 Z2.9307 A82.6633
+G1 X114.894 Y123.470 Z2.9320 A82.7017
+G1 X114.026 Y124.294 Z2.9333 A82.7405
+G1 X113.167 Y125.186 Z2.9347 A82.7798
+G1 X112.299 Y126.137 Z2.9360 A82.8197
+G1 X111.405 Y127.130 Z2.9373 A82.8604
+G1 X110.466 Y128.143 Z2.9387 A82.9019
+G1 X109.471 Y129.150 Z2.9400 A82.9443
+G1 X108.410 Y130.122 Z2.9413 A82.9875
+G1 X107.278 Y131.028 Z2.9427 A83.0316
+G1 X106.074 Y131.839 Z2.9440 A83.0764
+G1 X104.803 Y132.527 Z2.9453 A83.1218
+G1 X103.475 Y133.066 Z2.9467 A83.1678
+G1 X102.104 Y133.437 Z2.9480 A83.2141
+G1 X100.704 Y133.626 Z2.9493 A83.2606
+G1 X99.296 Y133.626 Z2.9507 A83.3071
+G1 X97.896 Y133.437 Z2.9520 A83.3534
+G1 X96.525 Y133.066 Z2.9533 A83.3993
+G1 X95.197 Y132.527 Z2.9547 A83.4448
+G1 X93.926 Y131.839 Z2.9560 A83.4896
+G1 X92.722 Y131.028 Z2.9573 A83.5336
+G1 X91.590 Y130.122 Z2.9587 A83.5769
+G1 X90.529 Y129.150 Z2.9600 A83.6192
+G1 X89.534 Y128.143 Z2.9613 A83.6607
+G1 X88.595 Y127.130 Z2.9627 A83.7014
+G1 X87.701 Y126.137 Z2.9640 A83.7414
+G1 X86.833 Y125.186 Z2.9653 A83.7806
+G1 X85.974 Y124.294 Z2.9667 A83.8194
+G1 X85.106 Y123.470 Z2.9680 A83.8578
+G1 X84.210 Y122.718 Z2.9693 A83.8961
+G1 X83.273 Y122.037 Z2.9707 A83.9343
+G1 X82.282 Y121.418 Z2.9720 A83.9727
+G1 X81.230 Y120.847 Z2.9733 A84.0115
+G1 X80.115 Y120.306 Z2.9747 A84.0508
+G1 X78.943 Y119.774 Z2.9760 A84.0907
+G1 X77.722 Y119.230 Z2.9773 A84.1314
+G1 X76.469 Y118.651 Z2.9787 A84.1729
+G1 X75.204 Y118.016 Z2.9800 A84.2153
+G1 X73.951 Y117.307 Z2.9813 A84.2585
+G1 X72.739 Y116.510 Z2.9827 A84.3026
+G1 X71.596 Y115.615 Z2.9840 A84.3474
+G1 X70.550 Y114.619 Z2.9853 A84.3928
+G1 X69.626 Y113.523 Z2.9867 A84.4388
+G1 X68.850 Y112.333 Z2.9880 A84.4851
+G1 X68.237 Y111.061 Z2.9893 A84.5316
+G1 X67.802 Y109.721 Z2.9907 A84.5781
+G1 X67.549 Y108.332 Z2.9920 A84.6244
+G1 X67.478 Y106.913 Z2.9933 A84.6704
+G1 X67.581 Y105.483 Z2.9947 A84.7158
+G1 X67.842 Y104.062 Z2.9960 A84.7606
+G1 X68.242 Y102.667 Z2.9973 A84.8047
+G1 X68.754 Y101.310 Z2.9987 A84.8479
+G1 X69.350 Y100.000 Z3.0000 A84.8903
+G1 X70.000 Y98.743 Z3.0013 A84.9318
+G1 X70.673 Y97.537 Z3.0027 A84.9724
+G1 X71.341 Y96.380 Z3.0040 A85.0124
+G1 X71.977 Y95.260 Z3.0053 A85.0517
+G1 X72.561 Y94.168 Z3.0067 A85.0904
+G1 X73.076 Y93.087 Z3.0080 A85.1289
+G1 X73.514 Y92.004 Z3.0093 A85.1671
+G1 X73.872 Y90.901 Z3.0107 A85.2053
+G1 X74.155 Y89.767 Z3.0120 A85.2438
+G1 X74.373 Y88.590 Z3.0133 A85.2825
+G1 X74.543 Y87.363 Z3.0147 A85.3218
+G1 X74.686 Y86.084 Z3.0160 A85.3618
+G1 X74.827 Y84.755 Z3.0173 A85.4024
+G1 X74.990 Y83.384 Z3.0187 A85.4440
+G1 X75.204 Y81.984 Z3.0200 A85.4863
+G1 X75.491 Y80.574 Z3.0213 A85.5295
+G1 X75.874 Y79.175 Z3.0227 A85.5736
+G1 X76.372 Y77.812 Z3.0240 A85.6184
+G1 X76.995 Y76.509 Z3.0253 A85.6639
+G1 X77.753 Y75.292 Z3.0267 A85.7098
+G1 X78.644 Y74.185 Z3.0280 A85.7561
+G1 X79.665 Y73.210 Z3.0293 A85.8026
+G1 X80.805 Y72.382 Z3.0307 A85.8491
+G1 X82.048 Y71.712 Z3.0320 A85.8954
+G1 X83.376 Y71.206 Z3.0333 A85.9414
+G1 X84.767 Y70.862 Z3.0347 A85.9868
+G1 X86.199 Y70.672 Z3.0360 A86.0316
+G1 X87.650 Y70.620 Z3.0373 A86.0757
+G1 X89.099 Y70.688 Z3.0387 A86.1189
+G1 X90.529 Y70.850 Z3.0400 A86.1613
+G1 X91.925 Y71.080 Z3.0413 A86.2028
+G1 X93.280 Y71.348 Z3.0427 A86.2435
+G1 X94.587 Y71.625 Z3.0440 A86.2834
+G1 X95.848 Y71.884 Z3.0453 A86.3227
+G1 X97.068 Y72.102 Z3.0467 A86.3615
+G1 X98.255 Y72.258 Z3.0480 A86.3999
+G1 X99.421 Y72.340 Z3.0493 A86.4381
+G1 X100.579 Y72.340 Z3.0507 A86.4764
+G1 X101.745 Y72.258 Z3.0520 A86.5148
+G1 X102.932 Y72.102 Z3.0533 A86.5536
+G1 X104.152 Y71.884 Z3.0547 A86.5929
+G1 X105.413 Y71.625 Z3.0560 A86.6328
+G1 X106.720 Y71.348 Z3.0573 A86.6735
+G1 X108.075 Y71.080 Z3.0587 A86.7150
+G1 X109.471 Y70.850 Z3.0600 A86.7573
+G1 X110.901 Y70.688 Z3.0613 A86.8006
+G1 X112.350 Y70.620 Z3.0627 A86.8446
+G1 X113.801 Y70.672 Z3.0640 A86.8894
+G1 X115.233 Y70.862 Z3.0653 A86.9349
+G1 X116.624 Y71.206 Z3.0667 A86.9808
+G1 X117.952 Y71.712 Z3.0680 A87.0272
+G1 X119.195 Y72.382 Z3.0693 A87.0736
+G1 X120.335 Y73.210 Z3.0707 A87.1201
+G1 X121.356 Y74.185 Z3.0720 A87.1664
+G1 X122.247 Y75.292 Z3.0733 A87.2124
+G1 X123.005 Y76.509 Z3.0747 A87.2579
+G1 X123.628 Y77.812 Z3.0760 A87.3027
+G1 X124.126 Y79.175 Z3.0773 A87.3467
+G1 X124.509 Y80.574 Z3.0787 A87.3899
+G1 X124.796 Y81.984 Z3.0800 A87.4323
+G1 X125.010 Y83.384 Z3.0813 A87.4738
+G1 X125.173 Y84.755 Z3.0827 A87.5145
+G1 X125.314 Y86.084 Z3.0840 A87.5544
+G1 X125.457 Y87.363 Z3.0853 A87.5937
+G1 X125.627 Y88.590 Z3.0867 A87.6325
+G1 X125.845 Y89.767 Z3.0880 A87.6709
+G1 X126.128 Y90.901 Z3.0893 A87.7092
+G1 X126.486 Y92.004 Z3.0907 A87.7474
+G1 X126.924 Y93.087 Z3.0920 A87.7858
+G1 X127.439 Y94.168 Z3.0933 A87.8246
+G1 X128.023 Y95.260 Z3.0947 A87.8639
+G1 X128.659 Y96.380 Z3.0960 A87.9038
+G1 X129.327 Y97.537 Z3.0973 A87.9445
+G1 X130.000 Y98.743 Z3.0987 A87.9860
+G1 X130.650 Y100.000 Z3.1000 A88.0284
+G1 X131.296 Y101.312 Z3.1013 A88.0717
+G1 X131.808 Y102.671 Z3.1027 A88.1158
+G1 X132.207 Y104.069 Z3.1040 A88.1607
+G1 X132.468 Y105.492 Z3.1053 A88.2062
+G1 X132.570 Y106.923 Z3.1067 A88.2522
+G1 X132.499 Y108.344 Z3.1080 A88.2986
+G1 X132.246 Y109.736 Z3.1093 A88.3452
+G1 X131.810 Y111.077 Z3.1107 A88.3917
+G1 X131.197 Y112.352 Z3.1120 A88.4381
+G1 X130.419 Y113.544 Z3.1133 A88.4841
+G1 X129.495 Y114.642 Z3.1147 A88.5296
+G1 X128.448 Y115.639 Z3.1160 A88.5745
+G1 X127.303 Y116.536 Z3.1173 A88.6186
+G1 X126.090 Y117.334 Z3.1187 A88.6619
+G1 X124.837 Y118.045 Z3.1200 A88.7044
+G1 X123.571 Y118.682 Z3.1213 A88.7459
+G1 X122.316 Y119.263 Z3.1227 A88.7867
+G1 X121.094 Y119.808 Z3.1240 A88.8267
+G1 X119.920 Y120.341 Z3.1253 A88.8661
+G1 X118.804 Y120.884 Z3.1267 A88.9049
+G1 X117.750 Y121.456 Z3.1280 A88.9434
+G1 X116.757 Y122.077 Z3.1293 A88.9817
+G1 X115.818 Y122.759 Z3.1307 A89.0200
+G1 X114.921 Y123.512 Z3.1320 A89.0585
+G1 X114.051 Y124.337 Z3.1333 A89.0974
+G1 X113.190 Y125.231 Z3.1347 A89.1367
+G1 X112.321 Y126.183 Z3.1360 A89.1767
+G1 X111.424 Y127.176 Z3.1373 A89.2175
+G1 X110.484 Y128.190 Z3.1387 A89.2590
+G1 X109.487 Y129.197 Z3.1400 A89.3015
+G1 X108.424 Y130.170 Z3.1413 A89.3448
+G1 X107.289 Y131.077 Z3.1427 A89.3889
+G1 X106.083 Y131.888 Z3.1440 A89.4338
+G1 X104.810 Y132.576 Z3.1453 A89.4793
+G1 X103.481 Y133.116 Z3.1467 A89.5253
+G1 X102.107 Y133.487 Z3.1480 A89.5717
+G1 X100.705 Y133.676 Z3.1493 A89.6183
+G1 X99.295 Y133.676 Z3.1507 A89.6648
+G1 X97.893 Y133.487 Z3.1520 A89.7112
+G1 X96.519 Y133.116 Z3.1533 A89.7572
+G1 X95.190 Y132.576 Z3.1547 A89.8027
+G1 X93.917 Y131.888 Z3.1560 A89.8476
+G1 X92.711 Y131.077 Z3.1573 A89.8917
+G1 X91.576 Y130.170 Z3.1587 A89.9350
+G1 X90.513 Y129.197 Z3.1600 A89.9775
+G1 X89.516 Y128.190 Z3.1613 A90.0190
+G1 X88.576 Y127.176 Z3.1627 A90.0598
+G1 X87.679 Y126.183 Z3.1640 A90.0998
+G1 X86.810 Y125.231 Z3.1653 A90.1392
+G1 X85.949 Y124.337 Z3.1667 A90.1780
+G1 X85.079 Y123.512 Z3.1680 A90.2165
+G1 X84.182 Y122.759 Z3.1693 A90.2548
+G1 X83.243 Y122.077 Z3.1707 A90.2931
+G1 X82.250 Y121.456 Z3.1720 A90.3316
+G1 X81.196 Y120.884 Z3.1733 A90.3705
+G1 X80.080 Y120.341 Z3.1747 A90.4098
+G1 X78.906 Y119.808 Z3.1760 A90.4498
+G1 X77.684 Y119.263 Z3.1773 A90.4906
+G1 X76.429 Y118.682 Z3.1787 A90.5321
+G1 X75.163 Y118.045 Z3.1800 A90.5746
+G1 X73.910 Y117.334 Z3.1813 A90.6179
+G1 X72.697 Y116.536 Z3.1827 A90.6620
+G1 X71.552 Y115.639 Z3.1840 A90.7069
+G1 X70.505 Y114.642 Z3.1853 A90.7524
+G1 X69.581 Y113.544 Z3.1867 A90.7984
+G1 X68.803 Y112.352 Z3.1880 A90.8448
+G1 X68.190 Y111.077 Z3.1893 A90.8914
+G1 X67.754 Y109.736 Z3.1907 A90.9379
+G1 X67.501 Y108.344 Z3.1920 A90.9843
+G1 X67.430 Y106.923 Z3.1933 A91.0303
+G1 X67.532 Y105.492 Z3.1947 A91.0758
+G1 X67.793 Y104.069 Z3.1960 A91.1207
+G1 X68.192 Y102.671 Z3.1973 A91.1648
+G1 X68.704 Y101.312 Z3.1987 A91.2081
+G1 X69.300 Y100.000 Z3.2000 A91.2506
+G1 X69.950 Y98.741 Z3.2013 A91.2921
+G1 X70.624 Y97.533 Z3.2027 A91.3329
+G1 X71.292 Y96.373 Z3.2040 A91.3729
+G1 X71.928 Y95.252 Z3.2053 A91.4122
+G1 X72.512 Y94.157 Z3.2067 A91.4511
+G1 X73.028 Y93.075 Z3.2080 A91.4896
+G1 X73.467 Y91.989 Z3.2093 A91.5279
+G1 X73.825 Y90.885 Z3.2107 A91.5662
+G1 X74.109 Y89.749 Z3.2120 A91.6047
+G1 X74.328 Y88.570 Z3.2133 A91.6436
+G1 X74.499 Y87.341 Z3.2147 A91.6829
+G1 X74.643 Y86.060 Z3.2160 A91.7229
+G1 X74.784 Y84.729 Z3.2173 A91.7637
+G1 X74.949 Y83.356 Z3.2187 A91.8052
+G1 X75.163 Y81.955 Z3.2200 A91.8477
+G1 X75.452 Y80.543 Z3.2213 A91.8910
+G1 X75.837 Y79.143 Z3.2227 A91.9351
+G1 X76.335 Y77.777 Z3.2240 A91.9800
+G1 X76.960 Y76.473 Z3.2253 A92.0255
+G1 X77.719 Y75.255 Z3.2267 A92.0715
+G1 X78.612 Y74.147 Z3.2280 A92.1179
+G1 X79.635 Y73.170 Z3.2293 A92.1644
+G1 X80.776 Y72.341 Z3.2307 A92.2110
+G1 X82.021 Y71.670 Z3.2320 A92.2574
+G1 X83.351 Y71.163 Z3.2333 A92.3034
+G1 X84.744 Y70.818 Z3.2347 A92.3489
+G1 X86.178 Y70.626 Z3.2360 A92.3938
+G1 X87.630 Y70.574 Z3.2373 A92.4379
+G1 X89.081 Y70.641 Z3.2387 A92.4812
+G1 X90.513 Y70.803 Z3.2400 A92.5237
+G1 X91.912 Y71.032 Z3.2413 A92.5652
+G1 X93.268 Y71.299 Z3.2427 A92.6060
+G1 X94.578 Y71.576 Z3.2440 A92.6460
+G1 X95.841 Y71.835 Z3.2453 A92.6853
+G1 X97.063 Y72.052 Z3.2467 A92.7242
+G1 X98.251 Y72.208 Z3.2480 A92.7627
+G1 X99.420 Y72.290 Z3.2493 A92.8010
+G1 X100.580 Y72.290 Z3.2507 A92.8393
+G1 X101.749 Y72.208 Z3.2520 A92.8778
+G1 X102.937 Y72.052 Z3.2533 A92.9166
+G1 X104.159 Y71.835 Z3.2547 A92.9560
+G1 X105.422 Y71.576 Z3.2560 A92.9960
+G1 X106.732 Y71.299 Z3.2573 A93.0368
+G1 X108.088 Y71.032 Z3.2587 A93.0783
+G1 X109.487 Y70.803 Z3.2600 A93.1208
+G1 X110.919 Y70.641 Z3.2613 A93.1641
+G1 X112.370 Y70.574 Z3.2627 A93.2082
+G1 X113.822 Y70.626 Z3.2640 A93.2531
+G1 X115.256 Y70.818 Z3.2653 A93.2986
+G1 X116.649 Y71.163 Z3.2667 A93.3446
+G1 X117.979 Y71.670 Z3.2680 A93.3910
+G1 X119.224 Y72.341 Z3.2693 A93.4375
+G1 X120.365 Y73.170 Z3.2707 A93.4841
+G1 X121.388 Y74.147 Z3.2720 A93.5305
+G1 X122.281 Y75.255 Z3.2733 A93.5765
+G1 X123.040 Y76.473 Z3.2747 A93.6220
+G1 X123.665 Y77.777 Z3.2760 A93.6669
+G1 X124.163 Y79.143 Z3.2773 A93.7110
+G1 X124.548 Y80.543 Z3.2787 A93.7543
+G1 X124.837 Y81.955 Z3.2800 A93.7968
+G1 X125.051 Y83.356 Z3.2813 A93.8383
+G1 X125.216 Y84.729 Z3.2827 A93.8791
+G1 X125.357 Y86.060 Z3.2840 A93.9191
+G1 X125.501 Y87.341 Z3.2853 A93.9584
+G1 X125.672 Y88.570 Z3.2867 A93.9973
+G1 X125.891 Y89.749 Z3.2880 A94.0358
+G1 X126.175 Y90.885 Z3.2893 A94.0741
+G1 X126.533 Y91.989 Z3.2907 A94.1124
+G1 X126.972 Y93.075 Z3.2920 A94.1509
+G1 X127.488 Y94.157 Z3.2933 A94.1897
+G1 X128.072 Y95.252 Z3.2947 A94.2291
+G1 X128.708 Y96.373 Z3.2960 A94.2691
+G1 X129.376 Y97.533 Z3.2973 A94.3099
+G1 X130.050 Y98.741 Z3.2987 A94.3514
+G1 X130.700 Y100.000 Z3.3000 A94.3939
+G1 X131.346 Y101.314 Z3.3013 A94.4372
+G1 X131.858 Y102.675 Z3.3027 A94.4814
+G1 X132.257 Y104.075 Z3.3040 A94.5264
+G1 X132.518 Y105.500 Z3.3053 A94.5720
+G1 X132.619 Y106.933 Z3.3067 A94.6181
+G1 X132.547 Y108.357 Z3.3080 A94.6645
+G1 X132.294 Y109.750 Z3.3093 A94.7111
+G1 X131.857 Y111.094 Z3.3107 A94.7578
+G1 X131.243 Y112.370 Z3.3120 A94.8042
+G1 X130.465 Y113.564 Z3.3133 A94.8503
+G1 X129.540 Y114.664 Z3.3147 A94.8959
+G1 X128.492 Y115.663 Z3.3160 A94.9408
+G1 X127.346 Y116.561 Z3.3173 A94.9850
+G1 X126.132 Y117.362 Z3.3187 A95.0284
+G1 X124.877 Y118.074 Z3.3200 A95.0709
+G1 X123.610 Y118.713 Z3.3213 A95.1125
+G1 X122.354 Y119.295 Z3.3227 A95.1534
+G1 X121.130 Y119.843 Z3.3240 A95.1934
+G1 X119.955 Y120.377 Z3.3253 A95.2329
+G1 X118.837 Y120.921 Z3.3267 A95.2718
+G1 X117.782 Y121.495 Z3.3280 A95.3103
+G1 X116.788 Y122.117 Z3.3293 A95.3487
+G1 X115.847 Y122.800 Z3.3307 A95.3871
+G1 X114.948 Y123.554 Z3.3320 A95.4257
+G1 X114.076 Y124.380 Z3.3333 A95.4646
+G1 X113.213 Y125.275 Z3.3347 A95.5040
+G1 X112.342 Y126.228 Z3.3360 A95.5441
+G1 X111.443 Y127.222 Z3.3373 A95.5849
+G1 X110.501 Y128.237 Z3.3387 A95.6265
+G1 X109.502 Y129.245 Z3.3400 A95.6690
+G1 X108.437 Y130.218 Z3.3413 A95.7124
+G1 X107.300 Y131.126 Z3.3427 A95.7566
+G1 X106.092 Y131.937 Z3.3440 A95.8015
+G1 X104.818 Y132.626 Z3.3453 A95.8471
+G1 X103.486 Y133.165 Z3.3467 A95.8932
+G1 X102.110 Y133.537 Z3.3480 A95.9397
+G1 X100.706 Y133.726 Z3.3493 A95.9863
+G1 X99.294 Y133.726 Z3.3507 A96.0329
+G1 X97.890 Y133.537 Z3.3520 A96.0794
+G1 X96.514 Y133.165 Z3.3533 A96.1255
+G1 X95.182 Y132.626 Z3.3547 A96.1711
+G1 X93.908 Y131.937 Z3.3560 A96.2160
+G1 X92.700 Y131.126 Z3.3573 A96.2602
+G1 X91.563 Y130.218 Z3.3587 A96.3036
+G1 X90.498 Y129.245 Z3.3600 A96.3461
+G1 X89.499 Y128.237 Z3.3613 A96.3877
+G1 X88.557 Y127.222 Z3.3627 A96.4285
+G1 X87.658 Y126.228 Z3.3640 A96.4686
+G1 X86.787 Y125.275 Z3.3653 A96.5080
+G1 X85.924 Y124.380 Z3.3667 A96.5469
+G1 X85.052 Y123.554 Z3.3680 A96.5855
+G1 X84.153 Y122.800 Z3.3693 A96.6239
+G1 X83.212 Y122.117 Z3.3707 A96.6623
+G1 X82.218 Y121.495 Z3.3720 A96.7008
+G1 X81.163 Y120.921 Z3.3733 A96.7397
+G1 X80.045 Y120.377 Z3.3747 A96.7792
+G1 X78.870 Y119.843 Z3.3760 A96.8192
+G1 X77.646 Y119.295 Z3.3773 A96.8601
+G1 X76.390 Y118.713 Z3.3787 A96.9017
+G1 X75.123 Y118.074 Z3.3800 A96.9442
+G1 X73.868 Y117.362 Z3.3813 A96.9876
+G1 X72.654 Y116.561 Z3.3827 A97.0318
+G1 X71.508 Y115.663 Z3.3840 A97.0767
+G1 X70.460 Y114.664 Z3.3853 A97.1223
+G1 X69.535 Y113.564 Z3.3867 A97.1684
+G1 X68.757 Y112.370 Z3.3880 A97.2148
+G1 X68.143 Y111.094 Z3.3893 A97.2615
+G1 X67.706 Y109.750 Z3.3907 A97.3081
+G1 X67.453 Y108.357 Z3.3920 A97.3546
+G1 X67.381 Y106.933 Z3.3933 A97.4007
+G1 X67.482 Y105.500 Z3.3947 A97.4462
+G1 X67.743 Y104.075 Z3.3960 A97.4912
+G1 X68.142 Y102.675 Z3.3973 A97.5354
+G1 X68.654 Y101.314 Z3.3987 A97.5787
+G1 X69.250 Y100.000 Z3.4000 A97.6212
+G1 X69.900 Y98.738 Z3.4013 A97.6629
+G1 X70.574 Y97.529 Z3.4027 A97.7037
+G1 X71.242 Y96.367 Z3.4040 A97.7438
+G1 X71.879 Y95.244 Z3.4053 A97.7832
+G1 X72.463 Y94.147 Z3.4067 A97.8221
+G1 X72.980 Y93.062 Z3.4080 A97.8607
+G1 X73.419 Y91.975 Z3.4093 A97.8991
+G1 X73.778 Y90.869 Z3.4107 A97.9374
+G1 X74.062 Y89.730 Z3.4120 A97.9760
+G1 X74.282 Y88.550 Z3.4133 A98.0149
+G1 X74.454 Y87.319 Z3.4147 A98.0543
+G1 X74.599 Y86.036 Z3.4160 A98.0944
+G1 X74.741 Y84.703 Z3.4173 A98.1352
+G1 X74.907 Y83.328 Z3.4187 A98.1769
+G1 X75.123 Y81.926 Z3.4200 A98.2194
+G1 X75.413 Y80.512 Z3.4213 A98.2627
+G1 X75.799 Y79.110 Z3.4227 A98.3069
+G1 X76.299 Y77.743 Z3.4240 A98.3519
+G1 X76.925 Y76.437 Z3.4253 A98.3975
+G1 X77.686 Y75.218 Z3.4267 A98.4436
+G1 X78.581 Y74.108 Z3.4280 A98.4900
+G1 X79.605 Y73.130 Z3.4293 A98.5366
+G1 X80.748 Y72.300 Z3.4307 A98.5833
+G1 X81.995 Y71.628 Z3.4320 A98.6297
+G1 X83.326 Y71.120 Z3.4333 A98.6758
+G1 X84.721 Y70.774 Z3.4347 A98.7214
+G1 X86.156 Y70.581 Z3.4360 A98.7664
+G1 X87.611 Y70.528 Z3.4373 A98.8105
+G1 X89.064 Y70.594 Z3.4387 A98.8539
+G1 X90.498 Y70.755 Z3.4400 A98.8964
+G1 X91.898 Y70.984 Z3.4413 A98.9381
+G1 X93.257 Y71.250 Z3.4427 A98.9789
+G1 X94.568 Y71.527 Z3.4440 A99.0190
+G1 X95.834 Y71.785 Z3.4453 A99.0584
+G1 X97.057 Y72.002 Z3.4467 A99.0973
+G1 X98.248 Y72.158 Z3.4480 A99.1359
+G1 X99.419 Y72.240 Z3.4493 A99.1742
+G1 X100.581 Y72.240 Z3.4507 A99.2126
+G1 X101.752 Y72.158 Z3.4520 A99.2512
+G1 X102.943 Y72.002 Z3.4533 A99.2901
+G1 X104.166 Y71.785 Z3.4547 A99.3295
+G1 X105.432 Y71.527 Z3.4560 A99.3696
+G1 X106.743 Y71.250 Z3.4573 A99.4104
+G1 X108.102 Y70.984 Z3.4587 A99.4520
+G1 X109.502 Y70.755 Z3.4600 A99.4946
+G1 X110.936 Y70.594 Z3.4613 A99.5379
+G1 X112.389 Y70.528 Z3.4627 A99.5821
+G1 X113.844 Y70.581 Z3.4640 A99.6271
+G1 X115.279 Y70.774 Z3.4653 A99.6726
+G1 X116.674 Y71.120 Z3.4667 A99.7187
+G1 X118.005 Y71.628 Z3.4680 A99.7652
+G1 X119.252 Y72.300 Z3.4693 A99.8118
+G1 X120.395 Y73.130 Z3.4707 A99.8585
+G1 X121.419 Y74.108 Z3.4720 A99.9049
+G1 X122.314 Y75.218 Z3.4733 A99.9510
+G1 X123.075 Y76.437 Z3.4747 A99.9966
+G1 X123.701 Y77.743 Z3.4760 A100.0415
+G1 X124.201 Y79.110 Z3.4773 A100.0857
+G1 X124.587 Y80.512 Z3.4787 A100.1291
+G1 X124.877 Y81.926 Z3.4800 A100.1716
+G1 X125.093 Y83.328 Z3.4813 A100.2132
+G1 X125.259 Y84.703 Z3.4827 A100.2541
+G1 X125.401 Y86.036 Z3.4840 A100.2941
+G1 X125.546 Y87.319 Z3.4853 A100.3335
+G1 X125.718 Y88.550 Z3.4867 A100.3725
+G1 X125.938 Y89.730 Z3.4880 A100.4110
+G1 X126.222 Y90.869 Z3.4893 A100.4494
+G1 X126.581 Y91.975 Z3.4907 A100.4878
+G1 X127.020 Y93.062 Z3.4920 A100.5264
+G1 X127.537 Y94.147 Z3.4933 A100.5653
+G1 X128.121 Y95.244 Z3.4947 A100.6047
+G1 X128.758 Y96.367 Z3.4960 A100.6448
+G1 X129.426 Y97.529 Z3.4973 A100.6856
+G1 X130.100 Y98.738 Z3.4987 A100.7272
+G1 X130.750 Y100.000 Z3.5000 A100.7697
+G1 X131.396 Y101.316 Z3.5013 A100.8132
+G1 X131.908 Y102.679 Z3.5027 A100.8574
+G1 X132.307 Y104.081 Z3.5040 A100.9024
+G1 X132.567 Y105.508 Z3.5053 A100.9481
+G1 X132.668 Y106.944 Z3.5067 A100.9943
+G1 X132.596 Y108.369 Z3.5080 A101.0408
+G1 X132.342 Y109.765 Z3.5093 A101.0875
+G1 X131.904 Y111.110 Z3.5107 A101.1342
+G1 X131.290 Y112.389 Z3.5120 A101.1807
+G1 X130.511 Y113.584 Z3.5133 A101.2269
+G1 X129.585 Y114.686 Z3.5147 A101.2725
+G1 X128.535 Y115.688 Z3.5160 A101.3175
+G1 X127.389 Y116.587 Z3.5173 A101.3618
+G1 X126.173 Y117.390 Z3.5187 A101.4052
+G1 X124.918 Y118.104 Z3.5200 A101.4478
+G1 X123.649 Y118.744 Z3.5213 A101.4895
+G1 X122.392 Y119.328 Z3.5227 A101.5304
+G1 X121.167 Y119.877 Z3.5240 A101.5705
+G1 X119.990 Y120.413 Z3.5253 A101.6100
+G1 X118.871 Y120.958 Z3.5267 A101.6490
+G1 X117.814 Y121.533 Z3.5280 A101.6876
+G1 X116.818 Y122.157 Z3.5293 A101.7261
+G1 X115.875 Y122.841 Z3.5307 A101.7646
+G1 X114.975 Y123.596 Z3.5320 A101.8032
+G1 X114.101 Y124.424 Z3.5333 A101.8422
+G1 X113.237 Y125.319 Z3.5347 A101.8817
+G1 X112.363 Y126.273 Z3.5360 A101.9218
+G1 X111.463 Y127.269 Z3.5373 A101.9627
+G1 X110.519 Y128.284 Z3.5387 A102.0044
+G1 X109.518 Y129.293 Z3.5400 A102.0470
+G1 X108.450 Y130.266 Z3.5413 A102.0904
+G1 X107.312 Y131.174 Z3.5427 A102.1347
+G1 X106.102 Y131.987 Z3.5440 A102.1797
+G1 X104.825 Y132.675 Z3.5453 A102.2253
+G1 X103.491 Y133.215 Z3.5467 A102.2715
+G1 X102.113 Y133.587 Z3.5480 A102.3180
+G1 X100.708 Y133.776 Z3.5493 A102.3647
+G1 X99.292 Y133.776 Z3.5507 A102.4114
+G1 X97.887 Y133.587 Z3.5520 A102.4579
+G1 X96.509 Y133.215 Z3.5533 A102.5041
+G1 X95.175 Y132.675 Z3.5547 A102.5498
+G1 X93.898 Y131.987 Z3.5560 A102.5948
+G1 X92.688 Y131.174 Z3.5573 A102.6390
+G1 X91.550 Y130.266 Z3.5587 A102.6825
+G1 X90.482 Y129.293 Z3.5600 A102.7250
+G1 X89.481 Y128.284 Z3.5613 A102.7668
+G1 X88.537 Y127.269 Z3.5627 A102.8077
+G1 X87.637 Y126.273 Z3.5640 A102.8478
+G1 X86.763 Y125.319 Z3.5653 A102.8873
+G1 X85.899 Y124.424 Z3.5667 A102.9263
+G1 X85.025 Y123.596 Z3.5680 A102.9649
+G1 X84.125 Y122.841 Z3.5693 A103.0033
+G1 X83.182 Y122.157 Z3.5707 A103.0418
+G1 X82.186 Y121.533 Z3.5720 A103.0804
+G1 X81.129 Y120.958 Z3.5733 A103.1194
+G1 X80.010 Y120.413 Z3.5747 A103.1589
+G1 X78.833 Y119.877 Z3.5760 A103.1990
+G1 X77.608 Y119.328 Z3.5773 A103.2399
+G1 X76.351 Y118.744 Z3.5787 A103.2816
+G1 X75.082 Y118.104 Z3.5800 A103.3242
+G1 X73.827 Y117.390 Z3.5813 A103.3677
+G1 X72.611 Y116.587 Z3.5827 A103.4119
+G1 X71.465 Y115.688 Z3.5840 A103.4569
+G1 X70.415 Y114.686 Z3.5853 A103.5026
+G1 X69.489 Y113.584 Z3.5867 A103.5488
+G1 X68.710 Y112.389 Z3.5880 A103.5953
+G1 X68.096 Y111.110 Z3.5893 A103.6420
+G1 X67.658 Y109.765 Z3.5907 A103.6887
+G1 X67.404 Y108.369 Z3.5920 A103.7352
+G1 X67.332 Y106.944 Z3.5933 A103.7814
+G1 X67.433 Y105.508 Z3.5947 A103.8270
+G1 X67.693 Y104.081 Z3.5960 A103.8720
+G1 X68.092 Y102.679 Z3.5973 A103.9163
+G1 X68.604 Y101.316 Z3.5987 A103.9597
+G1 X69.200 Y100.000 Z3.6000 A104.0023
+G1 X69.850 Y98.736 Z3.6013 A104.0440
+G1 X70.524 Y97.525 Z3.6027 A104.0849
+G1 X71.192 Y96.361 Z3.6040 A104.1250
+G1 X71.830 Y95.235 Z3.6053 A104.1645
+G1 X72.414 Y94.136 Z3.6067 A104.2035
+G1 X72.931 Y93.050 Z3.6080 A104.2421
+G1 X73.371 Y91.960 Z3.6093 A104.2806
+G1 X73.731 Y90.852 Z3.6107 A104.3190
+G1 X74.016 Y89.712 Z3.6120 A104.3577
+G1 X74.236 Y88.529 Z3.6133 A104.3967
+G1 X74.409 Y87.297 Z3.6147 A104.4362
+G1 X74.555 Y86.011 Z3.6160 A104.4763
+G1 X74.699 Y84.677 Z3.6173 A104.5172
+G1 X74.866 Y83.301 Z3.6187 A104.5589
+G1 X75.082 Y81.896 Z3.6200 A104.6015
+G1 X75.373 Y80.481 Z3.6213 A104.6449
+G1 X75.761 Y79.077 Z3.6227 A104.6892
+G1 X76.262 Y77.709 Z3.6240 A104.7342
+G1 X76.891 Y76.401 Z3.6253 A104.7798
+G1 X77.652 Y75.180 Z3.6267 A104.8260
+G1 X78.549 Y74.070 Z3.6280 A104.8725
+G1 X79.574 Y73.090 Z3.6293 A104.9192
+G1 X80.719 Y72.259 Z3.6307 A104.9659
+G1 X81.968 Y71.586 Z3.6320 A105.0124
+G1 X83.301 Y71.076 Z3.6333 A105.0586
+G1 X84.698 Y70.729 Z3.6347 A105.1043
+G1 X86.135 Y70.536 Z3.6360 A105.1493
+G1 X87.592 Y70.482 Z3.6373 A105.1935
+G1 X89.047 Y70.547 Z3.6387 A105.2370
+G1 X90.482 Y70.707 Z3.6400 A105.2795
+G1 X91.885 Y70.935 Z3.6413 A105.3213
+G1 X93.245 Y71.202 Z3.6427 A105.3621
+G1 X94.559 Y71.478 Z3.6440 A105.4023
+G1 X95.826 Y71.736 Z3.6453 A105.4418
+G1 X97.052 Y71.953 Z3.6467 A105.4808
+G1 X98.245 Y72.108 Z3.6480 A105.5194
+G1 X99.417 Y72.190 Z3.6493 A105.5578
+G1 X100.583 Y72.190 Z3.6507 A105.5963
+G1 X101.755 Y72.108 Z3.6520 A105.6349
+G1 X102.948 Y71.953 Z3.6533 A105.6739
+G1 X104.174 Y71.736 Z3.6547 A105.7134
+G1 X105.441 Y71.478 Z3.6560 A105.7535
+G1 X106.755 Y71.202 Z3.6573 A105.7944
+G1 X108.115 Y70.935 Z3.6587 A105.8361
+G1 X109.518 Y70.707 Z3.6600 A105.8787
+G1 X110.953 Y70.547 Z3.6613 A105.9221
+G1 X112.408 Y70.482 Z3.6627 A105.9664
+G1 X113.865 Y70.536 Z3.6640 A106.0114
+G1 X115.302 Y70.729 Z3.6653 A106.0571
+G1 X116.699 Y71.076 Z3.6667 A106.1032
+G1 X118.032 Y71.586 Z3.6680 A106.1498
+G1 X119.281 Y72.259 Z3.6693 A106.1965
+G1 X120.426 Y73.090 Z3.6707 A106.2432
+G1 X121.451 Y74.070 Z3.6720 A106.2897
+G1 X122.348 Y75.180 Z3.6733 A106.3358
+G1 X123.109 Y76.401 Z3.6747 A106.3815
+G1 X123.738 Y77.709 Z3.6760 A106.4265
+G1 X124.239 Y79.077 Z3.6773 A106.4708
+G1 X124.627 Y80.481 Z3.6787 A106.5142
+G1 X124.918 Y81.896 Z3.6800 A106.5568
+G1 X125.134 Y83.301 Z3.6813 A106.5985
+G1 X125.301 Y84.677 Z3.6827 A106.6394
+G1 X125.445 Y86.011 Z3.6840 A106.6795
+G1 X125.591 Y87.297 Z3.6853 A106.7190
+G1 X125.764 Y88.529 Z3.6867 A106.7580
+G1 X125.984 Y89.712 Z3.6880 A106.7966
+G1 X126.269 Y90.852 Z3.6893 A106.8351
+G1 X126.629 Y91.960 Z3.6907 A106.8735
+G1 X127.069 Y93.050 Z3.6920 A106.9122
+G1 X127.586 Y94.136 Z3.6933 A106.9511
+G1 X128.170 Y95.235 Z3.6947 A106.9906
+G1 X128.808 Y96.361 Z3.6960 A107.0308
+G1 X129.476 Y97.525 Z3.6973 A107.0717
+G1 X130.150 Y98.736 Z3.6987 A107.1134
+G1 X130.800 Y100.000 Z3.7000 A107.1560
+G1 X131.446 Y101.318 Z3.7013 A107.1995
+G1 X131.958 Y102.684 Z3.7027 A107.2438
+G1 X132.356 Y104.088 Z3.7040 A107.2889
+G1 X132.616 Y105.517 Z3.7053 A107.3346
+G1 X132.717 Y106.954 Z3.7067 A107.3808
+G1 X132.644 Y108.382 Z3.7080 A107.4274
+G1 X132.390 Y109.779 Z3.7093 A107.4742
+G1 X131.952 Y111.127 Z3.7107 A107.5210
+G1 X131.336 Y112.407 Z3.7120 A107.5675
+G1 X130.556 Y113.605 Z3.7133 A107.6138
+G1 X129.630 Y114.708 Z3.7147 A107.6595
+G1 X128.579 Y115.712 Z3.7160 A107.7046
+G1 X127.432 Y116.613 Z3.7173 A107.7489
+G1 X126.215 Y117.417 Z3.7187 A107.7924
+G1 X124.958 Y118.133 Z3.7200 A107.8351
+G1 X123.688 Y118.775 Z3.7213 A107.8769
+G1 X122.430 Y119.361 Z3.7227 A107.9178
+G1 X121.203 Y119.911 Z3.7240 A107.9580
+G1 X120.025 Y120.449 Z3.7253 A107.9976
+G1 X118.904 Y120.995 Z3.7267 A108.0366
+G1 X117.846 Y121.572 Z3.7280 A108.0753
+G1 X116.848 Y122.196 Z3.7293 A108.1139
+G1 X115.904 Y122.883 Z3.7307 A108.1524
+G1 X115.001 Y123.639 Z3.7320 A108.1911
+G1 X114.126 Y124.467 Z3.7333 A108.2301
+G1 X113.260 Y125.364 Z3.7347 A108.2697
+G1 X112.384 Y126.318 Z3.7360 A108.3099
+G1 X111.482 Y127.315 Z3.7373 A108.3508
+G1 X110.536 Y128.331 Z3.7387 A108.3926
+G1 X109.533 Y129.340 Z3.7400 A108.4353
+G1 X108.464 Y130.314 Z3.7413 A108.4788
+G1 X107.323 Y131.223 Z3.7427 A108.5231
+G1 X106.111 Y132.036 Z3.7440 A108.5682
+G1 X104.832 Y132.725 Z3.7453 A108.6139
+G1 X103.496 Y133.265 Z3.7467 A108.6602
+G1 X102.116 Y133.637 Z3.7480 A108.7067
+G1 X100.709 Y133.826 Z3.7493 A108.7535
+G1 X99.291 Y133.826 Z3.7507 A108.8003
+G1 X97.884 Y133.637 Z3.7520 A108.8469
+G1 X96.504 Y133.265 Z3.7533 A108.8931
+G1 X95.168 Y132.725 Z3.7547 A108.9388
+G1 X93.889 Y132.036 Z3.7560 A108.9839
+G1 X92.677 Y131.223 Z3.7573 A109.0282
+G1 X91.536 Y130.314 Z3.7587 A109.0717
+G1 X90.467 Y129.340 Z3.7600 A109.1144
+G1 X89.464 Y128.331 Z3.7613 A109.1562
+G1 X88.518 Y127.315 Z3.7627 A109.1971
+G1 X87.616 Y126.318 Z3.7640 A109.2373
+G1 X86.740 Y125.364 Z3.7653 A109.2769
+G1 X85.874 Y124.467 Z3.7667 A109.3160
+G1 X84.999 Y123.639 Z3.7680 A109.3547
+G1 X84.096 Y122.883 Z3.7693 A109.3932
+G1 X83.152 Y122.196 Z3.7707 A109.4317
+G1 X82.154 Y121.572 Z3.7720 A109.4704
+G1 X81.096 Y120.995 Z3.7733 A109.5094
+G1 X79.975 Y120.449 Z3.7747 A109.5490
+G1 X78.797 Y119.911 Z3.7760 A109.5892
+G1 X77.570 Y119.361 Z3.7773 A109.6302
+G1 X76.312 Y118.775 Z3.7787 A109.6720
+G1 X75.042 Y118.133 Z3.7800 A109.7146
+G1 X73.785 Y117.417 Z3.7813 A109.7581
+G1 X72.568 Y116.613 Z3.7827 A109.8024
+G1 X71.421 Y115.712 Z3.7840 A109.8475
+G1 X70.370 Y114.708 Z3.7853 A109.8932
+G1 X69.444 Y113.605 Z3.7867 A109.9395
+G1 X68.664 Y112.407 Z3.7880 A109.9861
+G1 X68.048 Y111.127 Z3.7893 A110.0328
+G1 X67.610 Y109.779 Z3.7907 A110.0796
+G1 X67.356 Y108.382 Z3.7920 A110.1262
+G1 X67.283 Y106.954 Z3.7933 A110.1724
+G1 X67.384 Y105.517 Z3.7947 A110.2181
+G1 X67.644 Y104.088 Z3.7960 A110.2632
+G1 X68.042 Y102.684 Z3.7973 A110.3076
+G1 X68.554 Y101.318 Z3.7987 A110.3511
+G1 X69.150 Y100.000 Z3.8000 A110.3937
+G1 X69.800 Y98.734 Z3.8013 A110.4355
+G1 X70.474 Y97.521 Z3.8027 A110.4764
+G1 X71.143 Y96.354 Z3.8040 A110.5167
+G1 X71.780 Y95.227 Z3.8053 A110.5562
+G1 X72.365 Y94.126 Z3.8067 A110.5953
+G1 X72.883 Y93.037 Z3.8080 A110.6340
+G1 X73.323 Y91.946 Z3.8093 A110.6725
+G1 X73.684 Y90.836 Z3.8107 A110.7110
+G1 X73.969 Y89.694 Z3.8120 A110.7497
+G1 X74.191 Y88.509 Z3.8133 A110.7888
+G1 X74.364 Y87.274 Z3.8147 A110.8283
+G1 X74.511 Y85.987 Z3.8160 A110.8685
+G1 X74.656 Y84.651 Z3.8173 A110.9095
+G1 X74.824 Y83.273 Z3.8187 A110.9513
+G1 X75.042 Y81.867 Z3.8200 A110.9939
+G1 X75.334 Y80.450 Z3.8213 A111.0374
+G1 X75.723 Y79.045 Z3.8227 A111.0818
+G1 X76.226 Y77.675 Z3.8240 A111.1268
+G1 X76.856 Y76.366 Z3.8253 A111.1726
+G1 X77.619 Y75.143 Z3.8267 A111.2188
+G1 X78.517 Y74.031 Z3.8280 A111.2654
+G1 X79.544 Y73.051 Z3.8293 A111.3121
+G1 X80.691 Y72.218 Z3.8307 A111.3589
+G1 X81.941 Y71.543 Z3.8320 A111.4055
+G1 X83.276 Y71.033 Z3.8333 A111.4517
+G1 X84.674 Y70.685 Z3.8347 A111.4975
+G1 X86.114 Y70.491 Z3.8360 A111.5425
+G1 X87.572 Y70.436 Z3.8373 A111.5869
+G1 X89.029 Y70.500 Z3.8387 A111.6304
+G1 X90.467 Y70.660 Z3.8400 A111.6730
+G1 X91.872 Y70.887 Z3.8413 A111.7148
+G1 X93.234 Y71.153 Z3.8427 A111.7558
+G1 X94.550 Y71.429 Z3.8440 A111.7960
+G1 X95.819 Y71.686 Z3.8453 A111.8355
+G1 X97.047 Y71.903 Z3.8467 A111.8746
+G1 X98.242 Y72.058 Z3.8480 A111.9133
+G1 X99.416 Y72.140 Z3.8493 A111.9518
+G1 X100.584 Y72.140 Z3.8507 A111.9903
+G1 X101.758 Y72.058 Z3.8520 A112.0290
+G1 X102.953 Y71.903 Z3.8533 A112.0681
+G1 X104.181 Y71.686 Z3.8547 A112.1076
+G1 X105.450 Y71.429 Z3.8560 A112.1478
+G1 X106.766 Y71.153 Z3.8573 A112.1888
+G1 X108.128 Y70.887 Z3.8587 A112.2306
+G1 X109.533 Y70.660 Z3.8600 A112.2732
+G1 X110.971 Y70.500 Z3.8613 A112.3167
+G1 X112.428 Y70.436 Z3.8627 A112.3611
+G1 X113.886 Y70.491 Z3.8640 A112.4062
+G1 X115.326 Y70.685 Z3.8653 A112.4519
+G1 X116.724 Y71.033 Z3.8667 A112.4981
+G1 X118.059 Y71.543 Z3.8680 A112.5447
+G1 X119.309 Y72.218 Z3.8693 A112.5915
+G1 X120.456 Y73.051 Z3.8707 A112.6382
+G1 X121.483 Y74.031 Z3.8720 A112.6848
+G1 X122.381 Y75.143 Z3.8733 A112.7311
+G1 X123.144 Y76.366 Z3.8747 A112.7768
+G1 X123.774 Y77.675 Z3.8760 A112.8219
+G1 X124.277 Y79.045 Z3.8773 A112.8662
+G1 X124.666 Y80.450 Z3.8787 A112.9097
+G1 X124.958 Y81.867 Z3.8800 A112.9523
+G1 X125.176 Y83.273 Z3.8813 A112.9941
+G1 X125.344 Y84.651 Z3.8827 A113.0351
+G1 X125.489 Y85.987 Z3.8840 A113.0753
+G1 X125.636 Y87.274 Z3.8853 A113.1149
+G1 X125.809 Y88.509 Z3.8867 A113.1539
+G1 X126.031 Y89.694 Z3.8880 A113.1926
+G1 X126.316 Y90.836 Z3.8893 A113.2311
+G1 X126.677 Y91.946 Z3.8907 A113.2696
+G1 X127.117 Y93.037 Z3.8920 A113.3083
+G1 X127.635 Y94.126 Z3.8933 A113.3474
+G1 X128.220 Y95.227 Z3.8947 A113.3870
+G1 X128.857 Y96.354 Z3.8960 A113.4272
+G1 X129.526 Y97.521 Z3.8973 A113.4681
+G1 X130.200 Y98.734 Z3.8987 A113.5099
+G1 X130.850 Y100.000 Z3.9000 A113.5526
+G1 X131.496 Y101.320 Z3.9013 A113.5961
+G1 X132.008 Y102.688 Z3.9027 A113.6405
+G1 X132.406 Y104.094 Z3.9040 A113.6857
+G1 X132.665 Y105.525 Z3.9053 A113.7315
+G1 X132.766 Y106.965 Z3.9067 A113.7778
+G1 X132.693 Y108.394 Z3.9080 A113.8244
+G1 X132.437 Y109.793 Z3.9093 A113.8713
+G1 X131.999 Y111.143 Z3.9107 A113.9181
+G1 X131.383 Y112.425 Z3.9120 A113.9648
+G1 X130.602 Y113.625 Z3.9133 A114.0111
+G1 X129.674 Y114.731 Z3.9147 A114.0569
+G1 X128.623 Y115.736 Z3.9160 A114.1020
+G1 X127.474 Y116.639 Z3.9173 A114.1464
+G1 X126.257 Y117.445 Z3.9187 A114.1900
+G1 X124.999 Y118.163 Z3.9200 A114.2327
+G1 X123.727 Y118.806 Z3.9213 A114.2746
+G1 X122.467 Y119.393 Z3.9227 A114.3156
+G1 X121.240 Y119.945 Z3.9240 A114.3559
+G1 X120.060 Y120.484 Z3.9253 A114.3955
+G1 X118.938 Y121.032 Z3.9267 A114.4346
+G1 X117.878 Y121.610 Z3.9280 A114.4734
+G1 X116.878 Y122.236 Z3.9293 A114.5120
+G1 X115.932 Y122.924 Z3.9307 A114.5506
+G1 X115.028 Y123.681 Z3.9320 A114.5893
+G1 X114.151 Y124.510 Z3.9333 A114.6284
+G1 X113.283 Y125.408 Z3.9347 A114.6681
+G1 X112.406 Y126.364 Z3.9360 A114.7084
+G1 X111.501 Y127.361 Z3.9373 A114.7494
+G1 X110.553 Y128.377 Z3.9387 A114.7912
+G1 X109.549 Y129.388 Z3.9400 A114.8339
+G1 X108.477 Y130.362 Z3.9413 A114.8775
+G1 X107.335 Y131.272 Z3.9427 A114.9219
+G1 X106.121 Y132.085 Z3.9440 A114.9671
+G1 X104.840 Y132.774 Z3.9453 A115.0129
+G1 X103.502 Y133.315 Z3.9467 A115.0592
+G1 X102.119 Y133.687 Z3.9480 A115.1058
+G1 X100.710 Y133.876 Z3.9493 A115.1527
+G1 X99.290 Y133.876 Z3.9507 A115.1995
+G1 X97.881 Y133.687 Z3.9520 A115.2462
+G1 X96.498 Y133.315 Z3.9533 A115.2925
+G1 X95.160 Y132.774 Z3.9547 A115.3383
+G1 X93.879 Y132.085 Z3.9560 A115.3834
+G1 X92.665 Y131.272 Z3.9573 A115.4278
+G1 X91.523 Y130.362 Z3.9587 A115.4714
+G1 X90.451 Y129.388 Z3.9600 A115.5141
+G1 X89.447 Y128.377 Z3.9613 A115.5559
+G1 X88.499 Y127.361 Z3.9627 A115.5970
+G1 X87.594 Y126.364 Z3.9640 A115.6372
+G1 X86.717 Y125.408 Z3.9653 A115.6769
+G1 X85.849 Y124.510 Z3.9667 A115.7160
+G1 X84.972 Y123.681 Z3.9680 A115.7548
+G1 X84.068 Y122.924 Z3.9693 A115.7934
+G1 X83.122 Y122.236 Z3.9707 A115.8319
+G1 X82.122 Y121.610 Z3.9720 A115.8707
+G1 X81.062 Y121.032 Z3.9733 A115.9098
+G1 X79.940 Y120.484 Z3.9747 A115.9495
+G1 X78.760 Y119.945 Z3.9760 A115.9897
+G1 X77.533 Y119.393 Z3.9773 A116.0308
+G1 X76.273 Y118.806 Z3.9787 A116.0726
+G1 X75.001 Y118.163 Z3.9800 A116.1153
+G1 X73.743 Y117.445 Z3.9813 A116.1589
+G1 X72.526 Y116.639 Z3.9827 A116.2033
+G1 X71.377 Y115.736 Z3.9840 A116.2485
+G1 X70.326 Y114.731 Z3.9853 A116.2943
+G1 X69.398 Y113.625 Z3.9867 A116.3406
+G1 X68.617 Y112.425 Z3.9880 A116.3872
+G1 X68.001 Y111.143 Z3.9893 A116.4341
+G1 X67.563 Y109.793 Z3.9907 A116.4809
+G1 X67.307 Y108.394 Z3.9920 A116.5276
+G1 X67.234 Y106.965 Z3.9933 A116.5739
+G1 X67.335 Y105.525 Z3.9947 A116.6197
+G1 X67.594 Y104.094 Z3.9960 A116.6648
+G1 X67.992 Y102.688 Z3.9973 A116.7092
+G1 X68.504 Y101.320 Z3.9987 A116.7528
+G1 X69.100 Y100.000 Z4.0000 A116.7955
+G1 X69.750 Y98.732 Z4.0013 A116.8373
+G1 X70.424 Y97.516 Z4.0027 A116.8784
+G1 X71.093 Y96.348 Z4.0040 A116.9186
+G1 X71.731 Y95.219 Z4.0053 A116.9583
+G1 X72.317 Y94.116 Z4.0067 A116.9974
+G1 X72.834 Y93.025 Z4.0080 A117.0362
+G1 X73.275 Y91.931 Z4.0093 A117.0748
+G1 X73.636 Y90.819 Z4.0107 A117.1133
+G1 X73.923 Y89.675 Z4.0120 A117.1521
+G1 X74.145 Y88.489 Z4.0133 A117.1912
+G1 X74.319 Y87.252 Z4.0147 A117.2309
+G1 X74.467 Y85.963 Z4.0160 A117.2711
+G1 X74.613 Y84.625 Z4.0173 A117.3122
+G1 X74.782 Y83.245 Z4.0187 A117.3540
+G1 X75.001 Y81.837 Z4.0200 A117.3967
+G1 X75.295 Y80.419 Z4.0213 A117.4403
+G1 X75.685 Y79.012 Z4.0227 A117.4847
+G1 X76.189 Y77.640 Z4.0240 A117.5299
+G1 X76.821 Y76.330 Z4.0253 A117.5757
+G1 X77.585 Y75.106 Z4.0267 A117.6220
+G1 X78.485 Y73.993 Z4.0280 A117.6686
+G1 X79.514 Y73.011 Z4.0293 A117.7154
+G1 X80.662 Y72.177 Z4.0307 A117.7623
+G1 X81.914 Y71.501 Z4.0320 A117.8089
+G1 X83.251 Y70.990 Z4.0333 A117.8552
+G1 X84.651 Y70.641 Z4.0347 A117.9010
+G1 X86.093 Y70.445 Z4.0360 A117.9462
+G1 X87.553 Y70.390 Z4.0373 A117.9906
+G1 X89.012 Y70.453 Z4.0387 A118.0342
+G1 X90.451 Y70.612 Z4.0400 A118.0769
+G1 X91.858 Y70.839 Z4.0413 A118.1187
+G1 X93.223 Y71.104 Z4.0427 A118.1598
+G1 X94.540 Y71.379 Z4.0440 A118.2000
+G1 X95.812 Y71.637 Z4.0453 A118.2397
+G1 X97.042 Y71.853 Z4.0467 A118.2788
+G1 X98.239 Y72.009 Z4.0480 A118.3176
+G1 X99.415 Y72.090 Z4.0493 A118.3561
+G1 X100.585 Y72.090 Z4.0507 A118.3947
+G1 X101.761 Y72.009 Z4.0520 A118.4335
+G1 X102.958 Y71.853 Z4.0533 A118.4726
+G1 X104.188 Y71.637 Z4.0547 A118.5123
+G1 X105.460 Y71.379 Z4.0560 A118.5525
+G1 X106.777 Y71.104 Z4.0573 A118.5936
+G1 X108.142 Y70.839 Z4.0587 A118.6354
+G1 X109.549 Y70.612 Z4.0600 A118.6781
+G1 X110.988 Y70.453 Z4.0613 A118.7217
+G1 X112.447 Y70.390 Z4.0627 A118.7661
+G1 X113.907 Y70.445 Z4.0640 A118.8112
+G1 X115.349 Y70.641 Z4.0653 A118.8570
+G1 X116.749 Y70.990 Z4.0667 A118.9033
+G1 X118.086 Y71.501 Z4.0680 A118.9500
+G1 X119.338 Y72.177 Z4.0693 A118.9968
+G1 X120.486 Y73.011 Z4.0707 A119.0437
+G1 X121.515 Y73.993 Z4.0720 A119.0903
+G1 X122.415 Y75.106 Z4.0733 A119.1366
+G1 X123.179 Y76.330 Z4.0747 A119.1824
+G1 X123.811 Y77.640 Z4.0760 A119.2276
+G1 X124.315 Y79.012 Z4.0773 A119.2720
+G1 X124.705 Y80.419 Z4.0787 A119.3156
+G1 X124.999 Y81.837 Z4.0800 A119.3583
+G1 X125.218 Y83.245 Z4.0813 A119.4001
+G1 X125.387 Y84.625 Z4.0827 A119.4412
+G1 X125.533 Y85.963 Z4.0840 A119.4814
+G1 X125.681 Y87.252 Z4.0853 A119.5211
+G1 X125.855 Y88.489 Z4.0867 A119.5602
+G1 X126.077 Y89.675 Z4.0880 A119.5990
+G1 X126.364 Y90.819 Z4.0893 A119.6375
+G1 X126.725 Y91.931 Z4.0907 A119.6761
+G1 X127.166 Y93.025 Z4.0920 A119.7149
+G1 X127.683 Y94.116 Z4.0933 A119.7540
+G1 X128.269 Y95.219 Z4.0947 A119.7937
+G1 X128.907 Y96.348 Z4.0960 A119.8339
+G1 X129.576 Y97.516 Z4.0973 A119.8750
+G1 X130.250 Y98.732 Z4.0987 A119.9168
+G1 X130.900 Y100.000 Z4.1000 A119.9595
+G1 X131.546 Y101.322 Z4.1013 A120.0032
+G1 X132.057 Y102.692 Z4.1027 A120.0476
+G1 X132.455 Y104.100 Z4.1040 A120.0928
+G1 X132.715 Y105.533 Z4.1053 A120.1387
+G1 X132.815 Y106.975 Z4.1067 A120.1851
+G1 X132.741 Y108.407 Z4.1080 A120.2318
+G1 X132.485 Y109.808 Z4.1093 A120.2787
+G1 X132.046 Y111.160 Z4.1107 A120.3256
+G1 X131.429 Y112.444 Z4.1120 A120.3724
+G1 X130.648 Y113.645 Z4.1133 A120.4187
+G1 X129.719 Y114.753 Z4.1147 A120.4646
+G1 X128.667 Y115.760 Z4.1160 A120.5098
+G1 X127.517 Y116.665 Z4.1173 A120.5543
+G1 X126.298 Y117.473 Z4.1187 A120.5979
+G1 X125.039 Y118.192 Z4.1200 A120.6407
+G1 X123.766 Y118.837 Z4.1213 A120.6826
+G1 X122.505 Y119.426 Z4.1227 A120.7237
+G1 X121.276 Y119.980 Z4.1240 A120.7641
+G1 X120.095 Y120.520 Z4.1253 A120.8038
+G1 X118.971 Y121.070 Z4.1267 A120.8430
+G1 X117.910 Y121.649 Z4.1280 A120.8818
+G1 X116.908 Y122.276 Z4.1293 A120.9205
+G1 X115.961 Y122.965 Z4.1307 A120.9591
+G1 X115.055 Y123.723 Z4.1320 A120.9979
+G1 X114.176 Y124.553 Z4.1333 A121.0371
+G1 X113.306 Y125.452 Z4.1347 A121.0768
+G1 X112.427 Y126.409 Z4.1360 A121.1172
+G1 X111.521 Y127.407 Z4.1373 A121.1583
+G1 X110.571 Y128.424 Z4.1387 A121.2002
+G1 X109.564 Y129.435 Z4.1400 A121.2430
+G1 X108.491 Y130.411 Z4.1413 A121.2866
+G1 X107.346 Y131.320 Z4.1427 A121.3311
+G1 X106.130 Y132.134 Z4.1440 A121.3763
+G1 X104.847 Y132.823 Z4.1453 A121.4222
+G1 X103.507 Y133.364 Z4.1467 A121.4686
+G1 X102.123 Y133.736 Z4.1480 A121.5153
+G1 X100.711 Y133.926 Z4.1493 A121.5622
+G1 X99.289 Y133.926 Z4.1507 A121.6091
+G1 X97.877 Y133.736 Z4.1520 A121.6558
+G1 X96.493 Y133.364 Z4.1533 A121.7022
+G1 X95.153 Y132.823 Z4.1547 A121.7481
+G1 X93.870 Y132.134 Z4.1560 A121.7933
+G1 X92.654 Y131.320 Z4.1573 A121.8377
+G1 X91.509 Y130.411 Z4.1587 A121.8814
+G1 X90.436 Y129.435 Z4.1600 A121.9242
+G1 X89.429 Y128.424 Z4.1613 A121.9661
+G1 X88.479 Y127.407 Z4.1627 A122.0072
+G1 X87.573 Y126.409 Z4.1640 A122.0475
+G1 X86.694 Y125.452 Z4.1653 A122.0872
+G1 X85.824 Y124.553 Z4.1667 A122.1264
+G1 X84.945 Y123.723 Z4.1680 A122.1653
+G1 X84.039 Y122.965 Z4.1693 A122.2039
+G1 X83.092 Y122.276 Z4.1707 A122.2426
+G1 X82.090 Y121.649 Z4.1720 A122.2814
+G1 X81.029 Y121.070 Z4.1733 A122.3206
+G1 X79.905 Y120.520 Z4.1747 A122.3603
+G1 X78.724 Y119.980 Z4.1760 A122.4007
+G1 X77.495 Y119.426 Z4.1773 A122.4417
+G1 X76.234 Y118.837 Z4.1787 A122.4837
+G1 X74.961 Y118.192 Z4.1800 A122.5264
+G1 X73.702 Y117.473 Z4.1813 A122.5701
+G1 X72.483 Y116.665 Z4.1827 A122.6146
+G1 X71.333 Y115.760 Z4.1840 A122.6598
+G1 X70.281 Y114.753 Z4.1853 A122.7056
+G1 X69.352 Y113.645 Z4.1867 A122.7520
+G1 X68.571 Y112.444 Z4.1880 A122.7987
+G1 X67.954 Y111.160 Z4.1893 A122.8457
+G1 X67.515 Y109.808 Z4.1907 A122.8926
+G1 X67.259 Y108.407 Z4.1920 A122.9393
+G1 X67.185 Y106.975 Z4.1933 A122.9857
+G1 X67.285 Y105.533 Z4.1947 A123.0315
+G1 X67.545 Y104.100 Z4.1960 A123.0767
+G1 X67.943 Y102.692 Z4.1973 A123.1212
+G1 X68.454 Y101.322 Z4.1987 A123.1649
+G1 X69.050 Y100.000 Z4.2000 A123.2076
+G1 X69.700 Y98.730 Z4.2013 A123.2496
+G1 X70.374 Y97.512 Z4.2027 A123.2907
+G1 X71.044 Y96.342 Z4.2040 A123.3310
+G1 X71.682 Y95.210 Z4.2053 A123.3707
+G1 X72.268 Y94.105 Z4.2067 A123.4099
+G1 X72.786 Y93.013 Z4.2080 A123.4487
+G1 X73.227 Y91.917 Z4.2093 A123.4874
+G1 X73.589 Y90.803 Z4.2107 A123.5260
+G1 X73.876 Y89.657 Z4.2120 A123.5649
+G1 X74.099 Y88.468 Z4.2133 A123.6041
+G1 X74.275 Y87.230 Z4.2147 A123.6438
+G1 X74.424 Y85.939 Z4.2160 A123.6841
+G1 X74.570 Y84.599 Z4.2173 A123.7252
+G1 X74.741 Y83.218 Z4.2187 A123.7671
+G1 X74.961 Y81.808 Z4.2200 A123.8099
+G1 X75.256 Y80.388 Z4.2213 A123.8536
+G1 X75.647 Y78.979 Z4.2227 A123.8980
+G1 X76.153 Y77.606 Z4.2240 A123.9432
+G1 X76.786 Y76.294 Z4.2253 A123.9891
+G1 X77.552 Y75.069 Z4.2267 A124.0355
+G1 X78.453 Y73.954 Z4.2280 A124.0822
+G1 X79.484 Y72.971 Z4.2293 A124.1291
+G1 X80.634 Y72.135 Z4.2307 A124.1760
+G1 X81.887 Y71.459 Z4.2320 A124.2228
+G1 X83.226 Y70.947 Z4.2333 A124.2691
+G1 X84.628 Y70.596 Z4.2347 A124.3150
+G1 X86.071 Y70.400 Z4.2360 A124.3602
+G1 X87.534 Y70.343 Z4.2373 A124.4047
+G1 X88.994 Y70.407 Z4.2387 A124.4483
+G1 X90.436 Y70.565 Z4.2400 A124.4911
+G1 X91.845 Y70.791 Z4.2413 A124.5330
+G1 X93.211 Y71.056 Z4.2427 A124.5741
+G1 X94.531 Y71.330 Z4.2440 A124.6145
+G1 X95.804 Y71.588 Z4.2453 A124.6542
+G1 X97.036 Y71.803 Z4.2467 A124.6934
+G1 X98.236 Y71.959 Z4.2480 A124.7322
+G1 X99.414 Y72.040 Z4.2493 A124.7709
+G1 X100.586 Y72.040 Z4.2507 A124.8095
+G1 X101.764 Y71.959 Z4.2520 A124.8483
+G1 X102.964 Y71.803 Z4.2533 A124.8875
+G1 X104.196 Y71.588 Z4.2547 A124.9272
+G1 X105.469 Y71.330 Z4.2560 A124.9676
+G1 X106.789 Y71.056 Z4.2573 A125.0087
+G1 X108.155 Y70.791 Z4.2587 A125.0506
+G1 X109.564 Y70.565 Z4.2600 A125.0934
+G1 X111.006 Y70.407 Z4.2613 A125.1370
+G1 X112.466 Y70.343 Z4.2627 A125.1815
+G1 X113.929 Y70.400 Z4.2640 A125.2267
+G1 X115.372 Y70.596 Z4.2653 A125.2726
+G1 X116.774 Y70.947 Z4.2667 A125.3190
+G1 X118.113 Y71.459 Z4.2680 A125.3657
+G1 X119.366 Y72.135 Z4.2693 A125.4126
+G1 X120.516 Y72.971 Z4.2707 A125.4595
+G1 X121.547 Y73.954 Z4.2720 A125.5062
+G1 X122.448 Y75.069 Z4.2733 A125.5526
+G1 X123.214 Y76.294 Z4.2747 A125.5985
+G1 X123.847 Y77.606 Z4.2760 A125.6437
+G1 X124.353 Y78.979 Z4.2773 A125.6881
+G1 X124.744 Y80.388 Z4.2787 A125.7318
+G1 X125.039 Y81.808 Z4.2800 A125.7746
+G1 X125.259 Y83.218 Z4.2813 A125.8165
+G1 X125.430 Y84.599 Z4.2827 A125.8576
+G1 X125.576 Y85.939 Z4.2840 A125.8979
+G1 X125.725 Y87.230 Z4.2853 A125.9376
+G1 X125.901 Y88.468 Z4.2867 A125.9768
+G1 X126.124 Y89.657 Z4.2880 A126.0157
+G1 X126.411 Y90.803 Z4.2893 A126.0543
+G1 X126.773 Y91.917 Z4.2907 A126.0930
+G1 X127.214 Y93.013 Z4.2920 A126.1318
+G1 X127.732 Y94.105 Z4.2933 A126.1710
+G1 X128.318 Y95.210 Z4.2947 A126.2107
+G1 X128.956 Y96.342 Z4.2960 A126.2510
+G1 X129.626 Y97.512 Z4.2973 A126.2921
+G1 X130.300 Y98.730 Z4.2987 A126.3341
+G1 X130.950 Y100.000 Z4.3000 A126.3768
+G1 X131.596 Y101.324 Z4.3013 A126.4206
+G1 X132.107 Y102.696 Z4.3027 A126.4651
+G1 X132.505 Y104.106 Z4.3040 A126.5104
+G1 X132.764 Y105.542 Z4.3053 A126.5563
+G1 X132.864 Y106.985 Z4.3067 A126.6028
+G1 X132.790 Y108.419 Z4.3080 A126.6496
+G1 X132.533 Y109.822 Z4.3093 A126.6965
+G1 X132.093 Y111.176 Z4.3107 A126.7435
+G1 X131.476 Y112.462 Z4.3120 A126.7903
+G1 X130.693 Y113.666 Z4.3133 A126.8367
+G1 X129.764 Y114.775 Z4.3147 A126.8827
+G1 X128.711 Y115.784 Z4.3160 A126.9280
+G1 X127.560 Y116.691 Z4.3173 A126.9725
+G1 X126.340 Y117.500 Z4.3187 A127.0162
+G1 X125.080 Y118.221 Z4.3200 A127.0591
+G1 X123.806 Y118.868 Z4.3213 A127.1011
+G1 X122.543 Y119.459 Z4.3227 A127.1422
+G1 X121.313 Y120.014 Z4.3240 A127.1826
+G1 X120.130 Y120.556 Z4.3253 A127.2224
+G1 X119.005 Y121.107 Z4.3267 A127.2617
+G1 X117.941 Y121.688 Z4.3280 A127.3006
+G1 X116.939 Y122.316 Z4.3293 A127.3393
+G1 X115.989 Y123.006 Z4.3307 A127.3780
+G1 X115.082 Y123.765 Z4.3320 A127.4169
+G1 X114.201 Y124.597 Z4.3333 A127.4562
+G1 X113.329 Y125.497 Z4.3347 A127.4960
+G1 X112.448 Y126.454 Z4.3360 A127.5364
+G1 X111.540 Y127.453 Z4.3373 A127.5775
+G1 X110.588 Y128.471 Z4.3387 A127.6195
+G1 X109.580 Y129.483 Z4.3400 A127.6624
+G1 X108.504 Y130.459 Z4.3413 A127.7061
+G1 X107.358 Y131.369 Z4.3427 A127.7506
+G1 X106.139 Y132.183 Z4.3440 A127.7959
+G1 X104.854 Y132.873 Z4.3453 A127.8419
+G1 X103.512 Y133.414 Z4.3467 A127.8883
+G1 X102.126 Y133.786 Z4.3480 A127.9351
+G1 X100.712 Y133.976 Z4.3493 A127.9821
+G1 X99.288 Y133.976 Z4.3507 A128.0290
+G1 X97.874 Y133.786 Z4.3520 A128.0758
+G1 X96.488 Y133.414 Z4.3533 A128.1223
+G1 X95.146 Y132.873 Z4.3547 A128.1682
+G1 X93.861 Y132.183 Z4.3560 A128.2135
+G1 X92.642 Y131.369 Z4.3573 A128.2580
+G1 X91.496 Y130.459 Z4.3587 A128.3018
+G1 X90.420 Y129.483 Z4.3600 A128.3446
+G1 X89.412 Y128.471 Z4.3613 A128.3866
+G1 X88.460 Y127.453 Z4.3627 A128.4278
+G1 X87.552 Y126.454 Z4.3640 A128.4682
+G1 X86.671 Y125.497 Z4.3653 A128.5079
+G1 X85.799 Y124.597 Z4.3667 A128.5472
+G1 X84.918 Y123.765 Z4.3680 A128.5861
+G1 X84.011 Y123.006 Z4.3693 A128.6248
+G1 X83.061 Y122.316 Z4.3707 A128.6636
+G1 X82.059 Y121.688 Z4.3720 A128.7025
+G1 X80.995 Y121.107 Z4.3733 A128.7417
+G1 X79.870 Y120.556 Z4.3747 A128.7815
+G1 X78.687 Y120.014 Z4.3760 A128.8219
+G1 X77.457 Y119.459 Z4.3773 A128.8631
+G1 X76.194 Y118.868 Z4.3787 A128.9051
+G1 X74.920 Y118.221 Z4.3800 A128.9479
+G1 X73.660 Y117.500 Z4.3813 A128.9916
+G1 X72.440 Y116.691 Z4.3827 A129.0362
+G1 X71.289 Y115.784 Z4.3840 A129.0815
+G1 X70.236 Y114.775 Z4.3853 A129.1274
+G1 X69.307 Y113.666 Z4.3867 A129.1738
+G1 X68.524 Y112.462 Z4.3880 A129.2206
+G1 X67.907 Y111.176 Z4.3893 A129.2676
+G1 X67.467 Y109.822 Z4.3907 A129.3146
+G1 X67.210 Y108.419 Z4.3920 A129.3614
+G1 X67.136 Y106.985 Z4.3933 A129.4078
+G1 X67.236 Y105.542 Z4.3947 A129.4538
+G1 X67.495 Y104.106 Z4.3960 A129.4990
+G1 X67.893 Y102.696 Z4.3973 A129.5436
+G1 X68.404 Y101.324 Z4.3987 A129.5873
+G1 X69.000 Y100.000 Z4.4000 A129.6302
+G1 X69.650 Y98.728 Z4.4013 A129.6721
+G1 X70.325 Y97.508 Z4.4027 A129.7133
+G1 X70.994 Y96.336 Z4.4040 A129.7537
+G1 X71.632 Y95.202 Z4.4053 A129.7935
+G1 X72.219 Y94.095 Z4.4067 A129.8327
+G1 X72.737 Y93.000 Z4.4080 A129.8717
+G1 X73.179 Y91.902 Z4.4093 A129.9104
+G1 X73.542 Y90.786 Z4.4107 A129.9491
+G1 X73.830 Y89.638 Z4.4120 A129.9880
+G1 X74.054 Y88.448 Z4.4133 A130.0273
+G1 X74.230 Y87.208 Z4.4147 A130.0670
+G1 X74.380 Y85.915 Z4.4160 A130.1075
+G1 X74.527 Y84.573 Z4.4173 A130.1486
+G1 X74.699 Y83.190 Z4.4187 A130.1906
+G1 X74.920 Y81.779 Z4.4200 A130.2335
+G1 X75.217 Y80.357 Z4.4213 A130.2772
+G1 X75.609 Y78.947 Z4.4227 A130.3217
+G1 X76.117 Y77.572 Z4.4240 A130.3670
+G1 X76.751 Y76.258 Z4.4253 A130.4129
+G1 X77.518 Y75.032 Z4.4267 A130.4594
+G1 X78.421 Y73.916 Z4.4280 A130.5062
+G1 X79.454 Y72.931 Z4.4293 A130.5532
+G1 X80.605 Y72.094 Z4.4307 A130.6001
+G1 X81.861 Y71.417 Z4.4320 A130.6469
+G1 X83.201 Y70.903 Z4.4333 A130.6934
+G1 X84.605 Y70.552 Z4.4347 A130.7393
+G1 X86.050 Y70.355 Z4.4360 A130.7846
+G1 X87.514 Y70.297 Z4.4373 A130.8291
+G1 X88.977 Y70.360 Z4.4387 A130.8728
+G1 X90.420 Y70.517 Z4.4400 A130.9157
+G1 X91.831 Y70.743 Z4.4413 A130.9577
+G1 X93.200 Y71.007 Z4.4427 A130.9988
+G1 X94.522 Y71.281 Z4.4440 A131.0393
+G1 X95.797 Y71.538 Z4.4453 A131.0790
+G1 X97.031 Y71.754 Z4.4467 A131.1183
+G1 X98.233 Y71.909 Z4.4480 A131.1572
+G1 X99.413 Y71.990 Z4.4493 A131.1959
+G1 X100.587 Y71.990 Z4.4507 A131.2347
+G1 X101.767 Y71.909 Z4.4520 A131.2736
+G1 X102.969 Y71.754 Z4.4533 A131.3128
+G1 X104.203 Y71.538 Z4.4547 A131.3526
+G1 X105.478 Y71.281 Z4.4560 A131.3930
+G1 X106.800 Y71.007 Z4.4573 A131.4342
+G1 X108.169 Y70.743 Z4.4587 A131.4762
+G1 X109.580 Y70.517 Z4.4600 A131.5190
+G1 X111.023 Y70.360 Z4.4613 A131.5627
+G1 X112.486 Y70.297 Z4.4627 A131.6073
+G1 X113.950 Y70.355 Z4.4640 A131.6525
+G1 X115.395 Y70.552 Z4.4653 A131.6985
+G1 X116.799 Y70.903 Z4.4667 A131.7449
+G1 X118.139 Y71.417 Z4.4680 A131.7917
+G1 X119.395 Y72.094 Z4.4693 A131.8387
+G1 X120.546 Y72.931 Z4.4707 A131.8857
+G1 X121.579 Y73.916 Z4.4720 A131.9325
+G1 X122.482 Y75.032 Z4.4733 A131.9789
+G1 X123.249 Y76.258 Z4.4747 A132.0248
+G1 X123.883 Y77.572 Z4.4760 A132.0701
+G1 X124.391 Y78.947 Z4.4773 A132.1147
+G1 X124.783 Y80.357 Z4.4787 A132.1584
+G1 X125.080 Y81.779 Z4.4800 A132.2012
+G1 X125.301 Y83.190 Z4.4813 A132.2432
+G1 X125.473 Y84.573 Z4.4827 A132.2844
+G1 X125.620 Y85.915 Z4.4840 A132.3248
+G1 X125.770 Y87.208 Z4.4853 A132.3646
+G1 X125.946 Y88.448 Z4.4867 A132.4038
+G1 X126.170 Y89.638 Z4.4880 A132.4427
+G1 X126.458 Y90.786 Z4.4893 A132.4815
+G1 X126.821 Y91.902 Z4.4907 A132.5202
+G1 X127.263 Y93.000 Z4.4920 A132.5591
+G1 X127.781 Y94.095 Z4.4933 A132.5984
+G1 X128.368 Y95.202 Z4.4947 A132.6381
+G1 X129.006 Y96.336 Z4.4960 A132.6785
+G1 X129.675 Y97.508 Z4.4973 A132.7197
+G1 X130.350 Y98.728 Z4.4987 A132.7617
+G1 X131.000 Y100.000 Z4.5000 A132.8045
+G1 X131.646 Y101.326 Z4.5013 A132.8483
+G1 X132.157 Y102.700 Z4.5027 A132.8929
+G1 X132.555 Y104.113 Z4.5040 A132.9383
+G1 X132.813 Y105.550 Z4.5053 A132.9843
+G1 X132.913 Y106.996 Z4.5067 A133.0308
+G1 X132.838 Y108.431 Z4.5080 A133.0777
+G1 X132.581 Y109.837 Z4.5093 A133.1247
+G1 X132.140 Y111.193 Z4.5107 A133.1718
+G1 X131.522 Y112.481 Z4.5120 A133.2186
+G1 X130.739 Y113.686 Z4.5133 A133.2651
+G1 X129.809 Y114.797 Z4.5147 A133.3111
+G1 X128.755 Y115.808 Z4.5160 A133.3565
+G1 X127.603 Y116.717 Z4.5173 A133.4011
+G1 X126.382 Y117.528 Z4.5187 A133.4449
+G1 X125.120 Y118.251 Z4.5200 A133.4878
+G1 X123.845 Y118.899 Z4.5213 A133.5299
+G1 X122.581 Y119.491 Z4.5227 A133.5711
+G1 X121.349 Y120.048 Z4.5240 A133.6116
+G1 X120.165 Y120.592 Z4.5253 A133.6514
+G1 X119.038 Y121.144 Z4.5267 A133.6908
+G1 X117.973 Y121.726 Z4.5280 A133.7297
+G1 X116.969 Y122.356 Z4.5293 A133.7685
+G1 X116.018 Y123.047 Z4.5307 A133.8073
+G1 X115.109 Y123.807 Z4.5320 A133.8463
+G1 X114.226 Y124.640 Z4.5333 A133.8856
+G1 X113.352 Y125.541 Z4.5347 A133.9255
+G1 X112.470 Y126.499 Z4.5360 A133.9659
+G1 X111.560 Y127.499 Z4.5373 A134.0072
+G1 X110.606 Y128.518 Z4.5387 A134.0492
+G1 X109.595 Y129.530 Z4.5400 A134.0922
+G1 X108.518 Y130.507 Z4.5413 A134.1359
+G1 X107.369 Y131.418 Z4.5427 A134.1805
+G1 X106.149 Y132.232 Z4.5440 A134.2259
+G1 X104.862 Y132.922 Z4.5453 A134.2719
+G1 X103.517 Y133.464 Z4.5467 A134.3184
+G1 X102.129 Y133.836 Z4.5480 A134.3653
+G1 X100.713 Y134.026 Z4.5493 A134.4123
+G1 X99.287 Y134.026 Z4.5507 A134.4594
+G1 X97.871 Y133.836 Z4.5520 A134.5062
+G1 X96.483 Y133.464 Z4.5533 A134.5528
+G1 X95.138 Y132.922 Z4.5547 A134.5988
+G1 X93.851 Y132.232 Z4.5560 A134.6441
+G1 X92.631 Y131.418 Z4.5573 A134.6887
+G1 X91.482 Y130.507 Z4.5587 A134.7325
+G1 X90.405 Y129.530 Z4.5600 A134.7754
+G1 X89.394 Y128.518 Z4.5613 A134.8175
+G1 X88.440 Y127.499 Z4.5627 A134.8587
+G1 X87.530 Y126.499 Z4.5640 A134.8992
+G1 X86.648 Y125.541 Z4.5653 A134.9390
+G1 X85.774 Y124.640 Z4.5667 A134.9784
+G1 X84.891 Y123.807 Z4.5680 A135.0173
+G1 X83.982 Y123.047 Z4.5693 A135.0561
+G1 X83.031 Y122.356 Z4.5707 A135.0949
+G1 X82.027 Y121.726 Z4.5720 A135.1339
+G1 X80.962 Y121.144 Z4.5733 A135.1732
+G1 X79.835 Y120.592 Z4.5747 A135.2131
+G1 X78.651 Y120.048 Z4.5760 A135.2536
+G1 X77.419 Y119.491 Z4.5773 A135.2948
+G1 X76.155 Y118.899 Z4.5787 A135.3369
+G1 X74.880 Y118.251 Z4.5800 A135.3798
+G1 X73.618 Y117.528 Z4.5813 A135.4236
+G1 X72.397 Y116.717 Z4.5827 A135.4682
+G1 X71.245 Y115.808 Z4.5840 A135.5135
+G1 X70.191 Y114.797 Z4.5853 A135.5595
+G1 X69.261 Y113.686 Z4.5867 A135.6060
+G1 X68.478 Y112.481 Z4.5880 A135.6529
+G1 X67.860 Y111.193 Z4.5893 A135.6999
+G1 X67.419 Y109.837 Z4.5907 A135.7470
+G1 X67.162 Y108.431 Z4.5920 A135.7939
+G1 X67.087 Y106.996 Z4.5933 A135.8404
+G1 X67.187 Y105.550 Z4.5947 A135.8864
+G1 X67.445 Y104.113 Z4.5960 A135.9317
+G1 X67.843 Y102.700 Z4.5973 A135.9763
+G1 X68.354 Y101.326 Z4.5987 A136.0201
+G1 X68.950 Y100.000 Z4.6000 A136.0630
+G1 X69.600 Y98.726 Z4.6013 A136.1051
+G1 X70.275 Y97.504 Z4.6027 A136.1463
+G1 X70.944 Y96.329 Z4.6040 A136.1868
+G1 X71.583 Y95.194 Z4.6053 A136.2266
+G1 X72.170 Y94.085 Z4.6067 A136.2660
+G1 X72.689 Y92.988 Z4.6080 A136.3050
+G1 X73.131 Y91.888 Z4.6093 A136.3437
+G1 X73.495 Y90.770 Z4.6107 A136.3825
+G1 X73.783 Y89.620 Z4.6120 A136.4215
+G1 X74.008 Y88.428 Z4.6133 A136.4609
+G1 X74.185 Y87.185 Z4.6147 A136.5007
+G1 X74.336 Y85.891 Z4.6160 A136.5412
+G1 X74.485 Y84.547 Z4.6173 A136.5824
+G1 X74.657 Y83.162 Z4.6187 A136.6245
+G1 X74.880 Y81.749 Z4.6200 A136.6674
+G1 X75.178 Y80.326 Z4.6213 A136.7112
+G1 X75.572 Y78.914 Z4.6227 A136.7558
+G1 X76.080 Y77.538 Z4.6240 A136.8011
+G1 X76.716 Y76.223 Z4.6253 A136.8471
+G1 X77.485 Y74.995 Z4.6267 A136.8936
+G1 X78.389 Y73.877 Z4.6280 A136.9405
+G1 X79.423 Y72.891 Z4.6293 A136.9876
+G1 X80.577 Y72.053 Z4.6307 A137.0346
+G1 X81.834 Y71.375 Z4.6320 A137.0815
+G1 X83.176 Y70.860 Z4.6333 A137.1280
+G1 X84.582 Y70.508 Z4.6347 A137.1740
+G1 X86.029 Y70.310 Z4.6360 A137.2193
+G1 X87.495 Y70.251 Z4.6373 A137.2639
+G1 X88.959 Y70.313 Z4.6387 A137.3077
+G1 X90.405 Y70.470 Z4.6400 A137.3506
+G1 X91.818 Y70.695 Z4.6413 A137.3927
+G1 X93.188 Y70.958 Z4.6427 A137.4339
+G1 X94.512 Y71.232 Z4.6440 A137.4744
+G1 X95.790 Y71.489 Z4.6453 A137.5143
+G1 X97.026 Y71.704 Z4.6467 A137.5536
+G1 X98.230 Y71.859 Z4.6480 A137.5926
+G1 X99.412 Y71.940 Z4.6493 A137.6314
+G1 X100.588 Y71.940 Z4.6507 A137.6702
+G1 X101.770 Y71.859 Z4.6520 A137.7091
+G1 X102.974 Y71.704 Z4.6533 A137.7485
+G1 X104.210 Y71.489 Z4.6547 A137.7883
+G1 X105.488 Y71.232 Z4.6560 A137.8288
+G1 X106.812 Y70.958 Z4.6573 A137.8700
+G1 X108.182 Y70.695 Z4.6587 A137.9121
+G1 X109.595 Y70.470 Z4.6600 A137.9550
+G1 X111.041 Y70.313 Z4.6613 A137.9988
+G1 X112.505 Y70.251 Z4.6627 A138.0434
+G1 X113.971 Y70.310 Z4.6640 A138.0887
+G1 X115.418 Y70.508 Z4.6653 A138.1347
+G1 X116.824 Y70.860 Z4.6667 A138.1813
+G1 X118.166 Y71.375 Z4.6680 A138.2281
+G1 X119.423 Y72.053 Z4.6693 A138.2752
+G1 X120.577 Y72.891 Z4.6707 A138.3222
+G1 X121.611 Y73.877 Z4.6720 A138.3691
+G1 X122.515 Y74.995 Z4.6733 A138.4156
+G1 X123.284 Y76.223 Z4.6747 A138.4616
+G1 X123.920 Y77.538 Z4.6760 A138.5070
+G1 X124.428 Y78.914 Z4.6773 A138.5516
+G1 X124.822 Y80.326 Z4.6787 A138.5953
+G1 X125.120 Y81.749 Z4.6800 A138.6383
+G1 X125.343 Y83.162 Z4.6813 A138.6803
+G1 X125.515 Y84.547 Z4.6827 A138.7216
+G1 X125.664 Y85.891 Z4.6840 A138.7620
+G1 X125.815 Y87.185 Z4.6853 A138.8019
+G1 X125.992 Y88.428 Z4.6867 A138.8412
+G1 X126.217 Y89.620 Z4.6880 A138.8802
+G1 X126.505 Y90.770 Z4.6893 A138.9190
+G1 X126.869 Y91.888 Z4.6907 A138.9578
+G1 X127.311 Y92.988 Z4.6920 A138.9967
+G1 X127.830 Y94.085 Z4.6933 A139.0361
+G1 X128.417 Y95.194 Z4.6947 A139.0759
+G1 X129.056 Y96.329 Z4.6960 A139.1164
+G1 X129.725 Y97.504 Z4.6973 A139.1576
+G1 X130.400 Y98.726 Z4.6987 A139.1997
+G1 X131.050 Y100.000 Z4.7000 A139.2426
+G1 X131.696 Y101.328 Z4.7013 A139.2865
+G1 X132.207 Y102.704 Z4.7027 A139.3311
+G1 X132.604 Y104.119 Z4.7040 A139.3766
+G1 X132.863 Y105.558 Z4.7053 A139.4226
+G1 X132.962 Y107.006 Z4.7067 A139.4692
+G1 X132.886 Y108.444 Z4.7080 A139.5162
+G1 X132.629 Y109.851 Z4.7093 A139.5633
+G1 X132.188 Y111.209 Z4.7107 A139.6104
+G1 X131.569 Y112.499 Z4.7120 A139.6573
+G1 X130.785 Y113.706 Z4.7133 A139.7039
+G1 X129.854 Y114.819 Z4.7147 A139.7500
+G1 X128.798 Y115.832 Z4.7160 A139.7954
+G1 X127.646 Y116.743 Z4.7173 A139.8401
+G1 X126.423 Y117.556 Z4.7187 A139.8839
+G1 X125.160 Y118.280 Z4.7200 A139.9269
+G1 X123.884 Y118.930 Z4.7213 A139.9690
+G1 X122.619 Y119.524 Z4.7227 A140.0103
+G1 X121.385 Y120.082 Z4.7240 A140.0509
+G1 X120.200 Y120.627 Z4.7253 A140.0908
+G1 X119.072 Y121.181 Z4.7267 A140.1302
+G1 X118.005 Y121.765 Z4.7280 A140.1692
+G1 X116.999 Y122.396 Z4.7293 A140.2081
+G1 X116.046 Y123.088 Z4.7307 A140.2470
+G1 X115.135 Y123.850 Z4.7320 A140.2860
+G1 X114.251 Y124.683 Z4.7333 A140.3254
+G1 X113.376 Y125.585 Z4.7347 A140.3653
+G1 X112.491 Y126.545 Z4.7360 A140.4059
+G1 X111.579 Y127.545 Z4.7373 A140.4472
+G1 X110.623 Y128.565 Z4.7387 A140.4893
+G1 X109.610 Y129.578 Z4.7400 A140.5323
+G1 X108.531 Y130.555 Z4.7413 A140.5762
+G1 X107.380 Y131.466 Z4.7427 A140.6208
+G1 X106.158 Y132.281 Z4.7440 A140.6663
+G1 X104.869 Y132.972 Z4.7453 A140.7123
+G1 X103.522 Y133.513 Z4.7467 A140.7589
+G1 X102.132 Y133.886 Z4.7480 A140.8058
+G1 X100.714 Y134.076 Z4.7493 A140.8530
+G1 X99.286 Y134.076 Z4.7507 A140.9001
+G1 X97.868 Y133.886 Z4.7520 A140.9470
+G1 X96.478 Y133.513 Z4.7533 A140.9936
+G1 X95.131 Y132.972 Z4.7547 A141.0397
+G1 X93.842 Y132.281 Z4.7560 A141.0851
+G1 X92.620 Y131.466 Z4.7573 A141.1298
+G1 X91.469 Y130.555 Z4.7587 A141.1736
+G1 X90.390 Y129.578 Z4.7600 A141.2166
+G1 X89.377 Y128.565 Z4.7613 A141.2587
+G1 X88.421 Y127.545 Z4.7627 A141.3000
+G1 X87.509 Y126.545 Z4.7640 A141.3406
+G1 X86.624 Y125.585 Z4.7653 A141.3805
+G1 X85.749 Y124.683 Z4.7667 A141.4199
+G1 X84.865 Y123.850 Z4.7680 A141.4589
+G1 X83.954 Y123.088 Z4.7693 A141.4978
+G1 X83.001 Y122.396 Z4.7707 A141.5367
+G1 X81.995 Y121.765 Z4.7720 A141.5757
+G1 X80.928 Y121.181 Z4.7733 A141.6151
+G1 X79.800 Y120.627 Z4.7747 A141.6550
+G1 X78.615 Y120.082 Z4.7760 A141.6956
+G1 X77.381 Y119.524 Z4.7773 A141.7369
+G1 X76.116 Y118.930 Z4.7787 A141.7790
+G1 X74.840 Y118.280 Z4.7800 A141.8220
+G1 X73.577 Y117.556 Z4.7813 A141.8658
+G1 X72.354 Y116.743 Z4.7827 A141.9105
+G1 X71.202 Y115.832 Z4.7840 A141.9559
+G1 X70.146 Y114.819 Z4.7853 A142.0020
+G1 X69.215 Y113.706 Z4.7867 A142.0486
+G1 X68.431 Y112.499 Z4.7880 A142.0955
+G1 X67.812 Y111.209 Z4.7893 A142.1426
+G1 X67.371 Y109.851 Z4.7907 A142.1898
+G1 X67.114 Y108.444 Z4.7920 A142.2367
+G1 X67.038 Y107.006 Z4.7933 A142.2833
+G1 X67.137 Y105.558 Z4.7947 A142.3293
+G1 X67.396 Y104.119 Z4.7960 A142.3748
+G1 X67.793 Y102.704 Z4.7973 A142.4194
+G1 X68.304 Y101.328 Z4.7987 A142.4633
+G1 X68.900 Y100.000 Z4.8000 A142.5063
+G1 X69.550 Y98.724 Z4.8013 A142.5484
+G1 X70.225 Y97.500 Z4.8027 A142.5897
+G1 X70.895 Y96.323 Z4.8040 A142.6303
+G1 X71.534 Y95.185 Z4.8053 A142.6702
+G1 X72.121 Y94.074 Z4.8067 A142.7096
+G1 X72.641 Y92.975 Z4.8080 A142.7486
+G1 X73.084 Y91.873 Z4.8093 A142.7875
+G1 X73.448 Y90.753 Z4.8107 A142.8263
+G1 X73.737 Y89.602 Z4.8120 A142.8654
+G1 X73.962 Y88.407 Z4.8133 A142.9048
+G1 X74.140 Y87.163 Z4.8147 A142.9447
+G1 X74.292 Y85.867 Z4.8160 A142.9853
+G1 X74.442 Y84.521 Z4.8173 A143.0266
+G1 X74.616 Y83.135 Z4.8187 A143.0687
+G1 X74.840 Y81.720 Z4.8200 A143.1117
+G1 X75.138 Y80.295 Z4.8213 A143.1555
+G1 X75.534 Y78.881 Z4.8227 A143.2002
+G1 X76.044 Y77.503 Z4.8240 A143.2456
+G1 X76.681 Y76.187 Z4.8253 A143.2917
+G1 X77.452 Y74.957 Z4.8267 A143.3383
+G1 X78.357 Y73.839 Z4.8280 A143.3852
+G1 X79.393 Y72.851 Z4.8293 A143.4323
+G1 X80.548 Y72.012 Z4.8307 A143.4794
+G1 X81.807 Y71.332 Z4.8320 A143.5264
+G1 X83.151 Y70.817 Z4.8333 A143.5730
+G1 X84.559 Y70.463 Z4.8347 A143.6190
+G1 X86.007 Y70.264 Z4.8360 A143.6645
+G1 X87.475 Y70.205 Z4.8373 A143.7091
+G1 X88.942 Y70.266 Z4.8387 A143.7530
+G1 X90.390 Y70.422 Z4.8400 A143.7960
+G1 X91.804 Y70.646 Z4.8413 A143.8381
+G1 X93.177 Y70.910 Z4.8427 A143.8794
+G1 X94.503 Y71.183 Z4.8440 A143.9200
+G1 X95.783 Y71.439 Z4.8453 A143.9599
+G1 X97.021 Y71.654 Z4.8467 A143.9993
+G1 X98.226 Y71.809 Z4.8480 A144.0383
+G1 X99.411 Y71.890 Z4.8493 A144.0772
+G1 X100.589 Y71.890 Z4.8507 A144.1160
+G1 X101.774 Y71.809 Z4.8520 A144.1551
+G1 X102.979 Y71.654 Z4.8533 A144.1945
+G1 X104.217 Y71.439 Z4.8547 A144.2344
+G1 X105.497 Y71.183 Z4.8560 A144.2749
+G1 X106.823 Y70.910 Z4.8573 A144.3162
+G1 X108.196 Y70.646 Z4.8587 A144.3584
+G1 X109.610 Y70.422 Z4.8600 A144.4014
+G1 X111.058 Y70.266 Z4.8613 A144.4452
+G1 X112.525 Y70.205 Z4.8627 A144.4899
+G1 X113.993 Y70.264 Z4.8640 A144.5353
+G1 X115.441 Y70.463 Z4.8653 A144.5814
+G1 X116.849 Y70.817 Z4.8667 A144.6280
+G1 X118.193 Y71.332 Z4.8680 A144.6749
+G1 X119.452 Y72.012 Z4.8693 A144.7220
+G1 X120.607 Y72.851 Z4.8707 A144.7691
+G1 X121.643 Y73.839 Z4.8720 A144.8161
+G1 X122.548 Y74.957 Z4.8733 A144.8626
+G1 X123.319 Y76.187 Z4.8747 A144.9087
+G1 X123.956 Y77.503 Z4.8760 A144.9541
+G1 X124.466 Y78.881 Z4.8773 A144.9988
+G1 X124.862 Y80.295 Z4.8787 A145.0427
+G1 X125.160 Y81.720 Z4.8800 A145.0857
+G1 X125.384 Y83.135 Z4.8813 A145.1278
+G1 X125.558 Y84.521 Z4.8827 A145.1691
+G1 X125.708 Y85.867 Z4.8840 A145.2096
+G1 X125.860 Y87.163 Z4.8853 A145.2495
+G1 X126.038 Y88.407 Z4.8867 A145.2889
+G1 X126.263 Y89.602 Z4.8880 A145.3280
+G1 X126.552 Y90.753 Z4.8893 A145.3669
+G1 X126.916 Y91.873 Z4.8907 A145.4057
+G1 X127.359 Y92.975 Z4.8920 A145.4448
+G1 X127.879 Y94.074 Z4.8933 A145.4842
+G1 X128.466 Y95.185 Z4.8947 A145.5241
+G1 X129.105 Y96.323 Z4.8960 A145.5646
+G1 X129.775 Y97.500 Z4.8973 A145.6059
+G1 X130.450 Y98.724 Z4.8987 A145.6481
+G1 X131.100 Y100.000 Z4.9000 A145.6910
+G1 X131.746 Y101.331 Z4.9013 A145.7350
+G1 X132.257 Y102.709 Z4.9027 A145.7797
+G1 X132.654 Y104.125 Z4.9040 A145.8252
+G1 X132.912 Y105.567 Z4.9053 A145.8713
+G1 X133.011 Y107.017 Z4.9067 A145.9180
+G1 X132.935 Y108.456 Z4.9080 A145.9650
+G1 X132.677 Y109.866 Z4.9093 A146.0122
+G1 X132.235 Y111.225 Z4.9107 A146.0594
+G1 X131.615 Y112.517 Z4.9120 A146.1064
+G1 X130.830 Y113.727 Z4.9133 A146.1530
+G1 X129.898 Y114.842 Z4.9147 A146.1992
+G1 X128.842 Y115.856 Z4.9160 A146.2447
+G1 X127.688 Y116.769 Z4.9173 A146.2894
+G1 X126.465 Y117.583 Z4.9187 A146.3333
+G1 X125.201 Y118.310 Z4.9200 A146.3764
+G1 X123.923 Y118.961 Z4.9213 A146.4186
+G1 X122.657 Y119.557 Z4.9227 A146.4599
+G1 X121.422 Y120.117 Z4.9240 A146.5006
+G1 X120.235 Y120.663 Z4.9253 A146.5405
+G1 X119.105 Y121.218 Z4.9267 A146.5800
+G1 X118.037 Y121.803 Z4.9280 A146.6191
+G1 X117.029 Y122.435 Z4.9293 A146.6581
+G1 X116.075 Y123.129 Z4.9307 A146.6970
+G1 X115.162 Y123.892 Z4.9320 A146.7361
+G1 X114.276 Y124.727 Z4.9333 A146.7756
+G1 X113.399 Y125.630 Z4.9347 A146.8156
+G1 X112.512 Y126.590 Z4.9360 A146.8562
+G1 X111.598 Y127.591 Z4.9373 A146.8976
+G1 X110.641 Y128.612 Z4.9387 A146.9397
+G1 X109.626 Y129.625 Z4.9400 A146.9828
+G1 X108.545 Y130.603 Z4.9413 A147.0267
+G1 X107.392 Y131.515 Z4.9427 A147.0715
+G1 X106.167 Y132.330 Z4.9440 A147.1170
+G1 X104.876 Y133.021 Z4.9453 A147.1631
+G1 X103.528 Y133.563 Z4.9467 A147.2098
+G1 X102.135 Y133.936 Z4.9480 A147.2568
+G1 X100.715 Y134.126 Z4.9493 A147.3039
+G1 X99.285 Y134.126 Z4.9507 A147.3511
+G1 X97.865 Y133.936 Z4.9520 A147.3981
+G1 X96.472 Y133.563 Z4.9533 A147.4448
+G1 X95.124 Y133.021 Z4.9547 A147.4909
+G1 X93.833 Y132.330 Z4.9560 A147.5364
+G1 X92.608 Y131.515 Z4.9573 A147.5812
+G1 X91.455 Y130.603 Z4.9587 A147.6251
+G1 X90.374 Y129.625 Z4.9600 A147.6681
+G1 X89.359 Y128.612 Z4.9613 A147.7103
+G1 X88.402 Y127.591 Z4.9627 A147.7517
+G1 X87.488 Y126.590 Z4.9640 A147.7923
+G1 X86.601 Y125.630 Z4.9653 A147.8323
+G1 X85.724 Y124.727 Z4.9667 A147.8718
+G1 X84.838 Y123.892 Z4.9680 A147.9109
+G1 X83.925 Y123.129 Z4.9693 A147.9498
+G1 X82.971 Y122.435 Z4.9707 A147.9888
+G1 X81.963 Y121.803 Z4.9720 A148.0279
+G1 X80.895 Y121.218 Z4.9733 A148.0673
+G1 X79.765 Y120.663 Z4.9747 A148.1073
+G1 X78.578 Y120.117 Z4.9760 A148.1479
+G1 X77.343 Y119.557 Z4.9773 A148.1893
+G1 X76.077 Y118.961 Z4.9787 A148.2315
+G1 X74.799 Y118.310 Z4.9800 A148.2746
+G1 X73.535 Y117.583 Z4.9813 A148.3185
+G1 X72.312 Y116.769 Z4.9827 A148.3632
+G1 X71.158 Y115.856 Z4.9840 A148.4087
+G1 X70.102 Y114.842 Z4.9853 A148.4549
+G1 X69.170 Y113.727 Z4.9867 A148.5015
+G1 X68.385 Y112.517 Z4.9880 A148.5485
+G1 X67.765 Y111.225 Z4.9893 A148.5957
+G1 X67.323 Y109.866 Z4.9907 A148.6429
+G1 X67.065 Y108.456 Z4.9920 A148.6899
+G1 X66.989 Y107.017 Z4.9933 A148.7365
+G1 X67.088 Y105.567 Z4.9947 A148.7827
+G1 X67.346 Y104.125 Z4.9960 A148.8282
+G1 X67.743 Y102.709 Z4.9973 A148.8729
+G1 X68.254 Y101.331 Z4.9987 A148.9168
+G1 X68.850 Y100.000 Z5.0000 A148.9599
+G1 X69.501 Y98.722 Z5.0013 A149.0021
+G1 X70.175 Y97.496 Z5.0027 A149.0435
+G1 X70.845 Y96.317 Z5.0040 A149.0841
+G1 X71.484 Y95.177 Z5.0053 A149.1241
+G1 X72.072 Y94.064 Z5.0067 A149.1635
+G1 X72.592 Y92.963 Z5.0080 A149.2026
+G1 X73.036 Y91.859 Z5.0093 A149.2416
+G1 X73.400 Y90.737 Z5.0107 A149.2805
+G1 X73.690 Y89.583 Z5.0120 A149.3196
+G1 X73.917 Y88.387 Z5.0133 A149.3591
+G1 X74.096 Y87.141 Z5.0147 A149.3991
+G1 X74.248 Y85.843 Z5.0160 A149.4397
+G1 X74.399 Y84.496 Z5.0173 A149.4811
+G1 X74.574 Y83.107 Z5.0187 A149.5233
+G1 X74.799 Y81.690 Z5.0200 A149.5663
+G1 X75.099 Y80.264 Z5.0213 A149.6102
+G1 X75.496 Y78.849 Z5.0227 A149.6550
+G1 X76.007 Y77.469 Z5.0240 A149.7005
+G1 X76.646 Y76.151 Z5.0253 A149.7466
+G1 X77.418 Y74.920 Z5.0267 A149.7933
+G1 X78.326 Y73.800 Z5.0280 A149.8403
+G1 X79.363 Y72.812 Z5.0293 A149.8875
+G1 X80.520 Y71.971 Z5.0307 A149.9346
+G1 X81.780 Y71.290 Z5.0320 A149.9816
+G1 X83.126 Y70.773 Z5.0333 A150.0283
+G1 X84.535 Y70.419 Z5.0347 A150.0744
+G1 X85.986 Y70.219 Z5.0360 A150.1199
+G1 X87.456 Y70.159 Z5.0373 A150.1647
+G1 X88.925 Y70.219 Z5.0387 A150.2086
+G1 X90.374 Y70.375 Z5.0400 A150.2517
+G1 X91.791 Y70.598 Z5.0413 A150.2939
+G1 X93.166 Y70.861 Z5.0427 A150.3352
+G1 X94.493 Y71.134 Z5.0440 A150.3759
+G1 X95.775 Y71.390 Z5.0453 A150.4158
+G1 X97.016 Y71.604 Z5.0467 A150.4553
+G1 X98.223 Y71.759 Z5.0480 A150.4944
+G1 X99.410 Y71.840 Z5.0493 A150.5333
+G1 X100.590 Y71.840 Z5.0507 A150.5723
+G1 X101.777 Y71.759 Z5.0520 A150.6114
+G1 X102.984 Y71.604 Z5.0533 A150.6509
+G1 X104.225 Y71.390 Z5.0547 A150.6908
+G1 X105.507 Y71.134 Z5.0560 A150.7315
+G1 X106.834 Y70.861 Z5.0573 A150.7728
+G1 X108.209 Y70.598 Z5.0587 A150.8150
+G1 X109.626 Y70.375 Z5.0600 A150.8581
+G1 X111.075 Y70.219 Z5.0613 A150.9020
+G1 X112.544 Y70.159 Z5.0627 A150.9468
+G1 X114.014 Y70.219 Z5.0640 A150.9922
+G1 X115.465 Y70.419 Z5.0653 A151.0384
+G1 X116.874 Y70.773 Z5.0667 A151.0850
+G1 X118.220 Y71.290 Z5.0680 A151.1320
+G1 X119.480 Y71.971 Z5.0693 A151.1792
+G1 X120.637 Y72.812 Z5.0707 A151.2264
+G1 X121.674 Y73.800 Z5.0720 A151.2734
+G1 X122.582 Y74.920 Z5.0733 A151.3201
+G1 X123.354 Y76.151 Z5.0747 A151.3662
+G1 X123.993 Y77.469 Z5.0760 A151.4117
+G1 X124.504 Y78.849 Z5.0773 A151.4564
+G1 X124.901 Y80.264 Z5.0787 A151.5004
+G1 X125.201 Y81.690 Z5.0800 A151.5434
+G1 X125.426 Y83.107 Z5.0813 A151.5856
+G1 X125.601 Y84.496 Z5.0827 A151.6270
+G1 X125.752 Y85.843 Z5.0840 A151.6676
+G1 X125.904 Y87.141 Z5.0853 A151.7076
+G1 X126.083 Y88.387 Z5.0867 A151.7471
+G1 X126.310 Y89.583 Z5.0880 A151.7862
+G1 X126.600 Y90.737 Z5.0893 A151.8251
+G1 X126.964 Y91.859 Z5.0907 A151.8640
+G1 X127.408 Y92.963 Z5.0920 A151.9032
+G1 X127.928 Y94.064 Z5.0933 A151.9426
+G1 X128.516 Y95.177 Z5.0947 A151.9826
+G1 X129.155 Y96.317 Z5.0960 A152.0232
+G1 X129.825 Y97.496 Z5.0973 A152.0646
+G1 X130.499 Y98.722 Z5.0987 A152.1068
+G1 X131.150 Y100.000 Z5.1000 A152.1498
+G1 X131.796 Y101.333 Z5.1013 A152.1938
+G1 X132.307 Y102.713 Z5.1027 A152.2386
+G1 X132.703 Y104.131 Z5.1040 A152.2842
+G1 X132.961 Y105.575 Z5.1053 A152.3304
+G1 X133.060 Y107.027 Z5.1067 A152.3771
+G1 X132.983 Y108.469 Z5.1080 A152.4242
+G1 X132.725 Y109.880 Z5.1093 A152.4715
+G1 X132.282 Y111.242 Z5.1107 A152.5187
+G1 X131.662 Y112.536 Z5.1120 A152.5658
+G1 X130.876 Y113.747 Z5.1133 A152.6125
+G1 X129.943 Y114.864 Z5.1147 A152.6587
+G1 X128.886 Y115.880 Z5.1160 A152.7043
+G1 X127.731 Y116.795 Z5.1173 A152.7491
+G1 X126.507 Y117.611 Z5.1187 A152.7931
+G1 X125.241 Y118.339 Z5.1200 A152.8362
+G1 X123.962 Y118.992 Z5.1213 A152.8785
+G1 X122.695 Y119.589 Z5.1227 A152.9199
+G1 X121.458 Y120.151 Z5.1240 A152.9606
+G1 X120.270 Y120.699 Z5.1253 A153.0007
+G1 X119.138 Y121.255 Z5.1267 A153.0402
+G1 X118.069 Y121.842 Z5.1280 A153.0794
+G1 X117.060 Y122.475 Z5.1293 A153.1184
+G1 X116.104 Y123.170 Z5.1307 A153.1574
+G1 X115.189 Y123.934 Z5.1320 A153.1966
+G1 X114.301 Y124.770 Z5.1333 A153.2361
+G1 X113.422 Y125.674 Z5.1347 A153.2762
+G1 X112.534 Y126.635 Z5.1360 A153.3168
+G1 X111.618 Y127.637 Z5.1373 A153.3583
+G1 X110.658 Y128.659 Z5.1387 A153.4006
+G1 X109.641 Y129.673 Z5.1400 A153.4437
+G1 X108.558 Y130.651 Z5.1413 A153.4877
+G1 X107.403 Y131.564 Z5.1427 A153.5325
+G1 X106.177 Y132.379 Z5.1440 A153.5780
+G1 X104.883 Y133.071 Z5.1453 A153.6243
+G1 X103.533 Y133.613 Z5.1467 A153.6710
+G1 X102.138 Y133.986 Z5.1480 A153.7180
+G1 X100.716 Y134.176 Z5.1493 A153.7653
+G1 X99.284 Y134.176 Z5.1507 A153.8126
+G1 X97.862 Y133.986 Z5.1520 A153.8596
+G1 X96.467 Y133.613 Z5.1533 A153.9063
+G1 X95.117 Y133.071 Z5.1547 A153.9526
+G1 X93.823 Y132.379 Z5.1560 A153.9981
+G1 X92.597 Y131.564 Z5.1573 A154.0429
+G1 X91.442 Y130.651 Z5.1587 A154.0869
+G1 X90.359 Y129.673 Z5.1600 A154.1301
+G1 X89.342 Y128.659 Z5.1613 A154.1723
+G1 X88.382 Y127.637 Z5.1627 A154.2138
+G1 X87.466 Y126.635 Z5.1640 A154.2544
+G1 X86.578 Y125.674 Z5.1653 A154.2945
+G1 X85.699 Y124.770 Z5.1667 A154.3340
+G1 X84.811 Y123.934 Z5.1680 A154.3732
+G1 X83.896 Y123.170 Z5.1693 A154.4122
+G1 X82.940 Y122.475 Z5.1707 A154.4512
+G1 X81.931 Y121.842 Z5.1720 A154.4904
+G1 X80.862 Y121.255 Z5.1733 A154.5299
+G1 X79.730 Y120.699 Z5.1747 A154.5700
+G1 X78.542 Y120.151 Z5.1760 A154.6107
+G1 X77.305 Y119.589 Z5.1773 A154.6521
+G1 X76.038 Y118.992 Z5.1787 A154.6944
+G1 X74.759 Y118.339 Z5.1800 A154.7375
+G1 X73.493 Y117.611 Z5.1813 A154.7815
+G1 X72.269 Y116.795 Z5.1827 A154.8263
+G1 X71.114 Y115.880 Z5.1840 A154.8719
+G1 X70.057 Y114.864 Z5.1853 A154.9181
+G1 X69.124 Y113.747 Z5.1867 A154.9648
+G1 X68.338 Y112.536 Z5.1880 A155.0119
+G1 X67.718 Y111.242 Z5.1893 A155.0591
+G1 X67.275 Y109.880 Z5.1907 A155.1064
+G1 X67.017 Y108.469 Z5.1920 A155.1535
+G1 X66.940 Y107.027 Z5.1933 A155.2002
+G1 X67.039 Y105.575 Z5.1947 A155.2464
+G1 X67.297 Y104.131 Z5.1960 A155.2920
+G1 X67.693 Y102.713 Z5.1973 A155.3368
+G1 X68.204 Y101.333 Z5.1987 A155.3808
+G1 X68.800 Y100.000 Z5.2000 A155.4239
+G1 X69.451 Y98.720 Z5.2013 A155.4662
+G1 X70.125 Y97.491 Z5.2027 A155.5076
+G1 X70.795 Y96.311 Z5.2040 A155.5483
+G1 X71.435 Y95.169 Z5.2053 A155.5883
+G1 X72.023 Y94.053 Z5.2067 A155.6279
+G1 X72.544 Y92.950 Z5.2080 A155.6670
+G1 X72.988 Y91.845 Z5.2093 A155.7061
+G1 X73.353 Y90.721 Z5.2107 A155.7451
+G1 X73.644 Y89.565 Z5.2120 A155.7842
+G1 X73.871 Y88.367 Z5.2133 A155.8238
+G1 X74.051 Y87.119 Z5.2147 A155.8638
+G1 X74.204 Y85.819 Z5.2160 A155.9045
+G1 X74.356 Y84.470 Z5.2173 A155.9460
+G1 X74.532 Y83.079 Z5.2187 A155.9882
+G1 X74.759 Y81.661 Z5.2200 A156.0313
+G1 X75.060 Y80.233 Z5.2213 A156.0753
+G1 X75.458 Y78.816 Z5.2227 A156.1202
+G1 X75.971 Y77.435 Z5.2240 A156.1657
+G1 X76.611 Y76.116 Z5.2253 A156.2119
+G1 X77.385 Y74.883 Z5.2267 A156.2586
+G1 X78.294 Y73.762 Z5.2280 A156.3057
+G1 X79.333 Y72.772 Z5.2293 A156.3530
+G1 X80.491 Y71.930 Z5.2307 A156.4002
+G1 X81.753 Y71.248 Z5.2320 A156.4473
+G1 X83.101 Y70.730 Z5.2333 A156.4940
+G1 X84.512 Y70.375 Z5.2347 A156.5402
+G1 X85.965 Y70.174 Z5.2360 A156.5858
+G1 X87.437 Y70.113 Z5.2373 A156.6306
+G1 X88.907 Y70.172 Z5.2387 A156.6746
+G1 X90.359 Y70.327 Z5.2400 A156.7177
+G1 X91.777 Y70.550 Z5.2413 A156.7600
+G1 X93.154 Y70.812 Z5.2427 A156.8014
+G1 X94.484 Y71.085 Z5.2440 A156.8421
+G1 X95.768 Y71.340 Z5.2453 A156.8822
+G1 X97.010 Y71.555 Z5.2467 A156.9217
+G1 X98.220 Y71.709 Z5.2480 A156.9609
+G1 X99.409 Y71.790 Z5.2493 A156.9999
+G1 X100.591 Y71.790 Z5.2507 A157.0389
+G1 X101.780 Y71.709 Z5.2520 A157.0781
+G1 X102.990 Y71.555 Z5.2533 A157.1176
+G1 X104.232 Y71.340 Z5.2547 A157.1577
+G1 X105.516 Y71.085 Z5.2560 A157.1983
+G1 X106.846 Y70.812 Z5.2573 A157.2398
+G1 X108.223 Y70.550 Z5.2587 A157.2821
+G1 X109.641 Y70.327 Z5.2600 A157.3252
+G1 X111.093 Y70.172 Z5.2613 A157.3692
+G1 X112.563 Y70.113 Z5.2627 A157.4140
+G1 X114.035 Y70.174 Z5.2640 A157.4595
+G1 X115.488 Y70.375 Z5.2653 A157.5058
+G1 X116.899 Y70.730 Z5.2667 A157.5525
+G1 X118.247 Y71.248 Z5.2680 A157.5995
+G1 X119.509 Y71.930 Z5.2693 A157.6468
+G1 X120.667 Y72.772 Z5.2707 A157.6941
+G1 X121.706 Y73.762 Z5.2720 A157.7411
+G1 X122.615 Y74.883 Z5.2733 A157.7878
+G1 X123.389 Y76.116 Z5.2747 A157.8341
+G1 X124.029 Y77.435 Z5.2760 A157.8796
+G1 X124.542 Y78.816 Z5.2773 A157.9244
+G1 X124.940 Y80.233 Z5.2787 A157.9684
+G1 X125.241 Y81.661 Z5.2800 A158.0116
+G1 X125.468 Y83.079 Z5.2813 A158.0538
+G1 X125.644 Y84.470 Z5.2827 A158.0953
+G1 X125.796 Y85.819 Z5.2840 A158.1359
+G1 X125.949 Y87.119 Z5.2853 A158.1760
+G1 X126.129 Y88.367 Z5.2867 A158.2155
+G1 X126.356 Y89.565 Z5.2880 A158.2547
+G1 X126.647 Y90.721 Z5.2893 A158.2937
+G1 X127.012 Y91.845 Z5.2907 A158.3327
+G1 X127.456 Y92.950 Z5.2920 A158.3719
+G1 X127.977 Y94.053 Z5.2933 A158.4114
+G1 X128.565 Y95.169 Z5.2947 A158.4515
+G1 X129.205 Y96.311 Z5.2960 A158.4922
+G1 X129.875 Y97.491 Z5.2973 A158.5336
+G1 X130.549 Y98.720 Z5.2987 A158.5759
+G1 X131.200 Y100.000 Z5.3000 A158.6190
+G1 X131.846 Y101.335 Z5.3013 A158.6631
+G1 X132.356 Y102.717 Z5.3027 A158.7080
+G1 X132.753 Y104.138 Z5.3040 A158.7536
+G1 X133.011 Y105.583 Z5.3053 A158.7999
+G1 X133.108 Y107.037 Z5.3067 A158.8467
+G1 X133.032 Y108.481 Z5.3080 A158.8938
+G1 X132.772 Y109.895 Z5.3093 A158.9411
+G1 X132.329 Y111.258 Z5.3107 A158.9884
+G1 X131.708 Y112.554 Z5.3120 A159.0356
+G1 X130.922 Y113.767 Z5.3133 A159.0824
+G1 X129.988 Y114.886 Z5.3147 A159.1286
+G1 X128.930 Y115.904 Z5.3160 A159.1743
+G1 X127.774 Y116.820 Z5.3173 A159.2192
+G1 X126.548 Y117.639 Z5.3187 A159.2632
+G1 X125.282 Y118.368 Z5.3200 A159.3064
+G1 X124.002 Y119.023 Z5.3213 A159.3488
+G1 X122.732 Y119.622 Z5.3227 A159.3903
+G1 X121.495 Y120.185 Z5.3240 A159.4310
+G1 X120.305 Y120.734 Z5.3253 A159.4711
+G1 X119.172 Y121.293 Z5.3267 A159.5107
+G1 X118.101 Y121.880 Z5.3280 A159.5500
+G1 X117.090 Y122.515 Z5.3293 A159.5891
+G1 X116.132 Y123.211 Z5.3307 A159.6281
+G1 X115.216 Y123.976 Z5.3320 A159.6674
+G1 X114.326 Y124.813 Z5.3333 A159.7070
+G1 X113.445 Y125.718 Z5.3347 A159.7471
+G1 X112.555 Y126.680 Z5.3360 A159.7879
+G1 X111.637 Y127.683 Z5.3373 A159.8294
+G1 X110.675 Y128.705 Z5.3387 A159.8717
+G1 X109.657 Y129.721 Z5.3400 A159.9149
+G1 X108.571 Y130.700 Z5.3413 A159.9590
+G1 X107.415 Y131.612 Z5.3427 A160.0039
+G1 X106.186 Y132.429 Z5.3440 A160.0495
+G1 X104.891 Y133.120 Z5.3453 A160.0958
+G1 X103.538 Y133.663 Z5.3467 A160.1426
+G1 X102.141 Y134.036 Z5.3480 A160.1897
+G1 X100.717 Y134.226 Z5.3493 A160.2370
+G1 X99.283 Y134.226 Z5.3507 A160.2843
+G1 X97.859 Y134.036 Z5.3520 A160.3315
+G1 X96.462 Y133.663 Z5.3533 A160.3783
+G1 X95.109 Y133.120 Z5.3547 A160.4246
+G1 X93.814 Y132.429 Z5.3560 A160.4702
+G1 X92.585 Y131.612 Z5.3573 A160.5151
+G1 X91.429 Y130.700 Z5.3587 A160.5591
+G1 X90.343 Y129.721 Z5.3600 A160.6023
+G1 X89.325 Y128.705 Z5.3613 A160.6447
+G1 X88.363 Y127.683 Z5.3627 A160.6862
+G1 X87.445 Y126.680 Z5.3640 A160.7269
+G1 X86.555 Y125.718 Z5.3653 A160.7670
+G1 X85.674 Y124.813 Z5.3667 A160.8067
+G1 X84.784 Y123.976 Z5.3680 A160.8459
+G1 X83.868 Y123.211 Z5.3693 A160.8850
+G1 X82.910 Y122.515 Z5.3707 A160.9241
+G1 X81.899 Y121.880 Z5.3720 A160.9633
+G1 X80.828 Y121.293 Z5.3733 A161.0029
+G1 X79.695 Y120.734 Z5.3747 A161.0430
+G1 X78.505 Y120.185 Z5.3760 A161.0838
+G1 X77.268 Y119.622 Z5.3773 A161.1253
+G1 X75.998 Y119.023 Z5.3787 A161.1676
+G1 X74.718 Y118.368 Z5.3800 A161.2108
+G1 X73.452 Y117.639 Z5.3813 A161.2549
+G1 X72.226 Y116.820 Z5.3827 A161.2998
+G1 X71.070 Y115.904 Z5.3840 A161.3454
+G1 X70.012 Y114.886 Z5.3853 A161.3917
+G1 X69.078 Y113.767 Z5.3867 A161.4385
+G1 X68.292 Y112.554 Z5.3880 A161.4856
+G1 X67.671 Y111.258 Z5.3893 A161.5329
+G1 X67.228 Y109.895 Z5.3907 A161.5803
+G1 X66.968 Y108.481 Z5.3920 A161.6274
+G1 X66.892 Y107.037 Z5.3933 A161.6742
+G1 X66.989 Y105.583 Z5.3947 A161.7205
+G1 X67.247 Y104.138 Z5.3960 A161.7661
+G1 X67.644 Y102.717 Z5.3973 A161.8110
+G1 X68.154 Y101.335 Z5.3987 A161.8550
+G1 X68.750 Y100.000 Z5.4000 A161.8982
+G1 X69.401 Y98.718 Z5.4013 A161.9406
+G1 X70.076 Y97.487 Z5.4027 A161.9821
+G1 X70.746 Y96.304 Z5.4040 A162.0228
+G1 X71.386 Y95.160 Z5.4053 A162.0630
+G1 X71.974 Y94.043 Z5.4067 A162.1026
+G1 X72.495 Y92.938 Z5.4080 A162.1418
+G1 X72.940 Y91.830 Z5.4093 A162.1809
+G1 X73.306 Y90.704 Z5.4107 A162.2200
+G1 X73.597 Y89.546 Z5.4120 A162.2592
+G1 X73.825 Y88.346 Z5.4133 A162.2988
+G1 X74.006 Y87.096 Z5.4147 A162.3389
+G1 X74.161 Y85.795 Z5.4160 A162.3797
+G1 X74.314 Y84.444 Z5.4173 A162.4212
+G1 X74.491 Y83.052 Z5.4187 A162.4635
+G1 X74.718 Y81.632 Z5.4200 A162.5067
+G1 X75.021 Y80.202 Z5.4213 A162.5508
+G1 X75.420 Y78.783 Z5.4227 A162.5957
+G1 X75.934 Y77.401 Z5.4240 A162.6413
+G1 X76.576 Y76.080 Z5.4253 A162.6876
+G1 X77.351 Y74.846 Z5.4267 A162.7344
+G1 X78.262 Y73.723 Z5.4280 A162.7815
+G1 X79.302 Y72.732 Z5.4293 A162.8288
+G1 X80.462 Y71.889 Z5.4307 A162.8762
+G1 X81.727 Y71.206 Z5.4320 A162.9233
+G1 X83.076 Y70.687 Z5.4333 A162.9701
+G1 X84.489 Y70.330 Z5.4347 A163.0164
+G1 X85.944 Y70.129 Z5.4360 A163.0620
+G1 X87.417 Y70.067 Z5.4373 A163.1069
+G1 X88.890 Y70.125 Z5.4387 A163.1509
+G1 X90.343 Y70.279 Z5.4400 A163.1941
+G1 X91.764 Y70.502 Z5.4413 A163.2365
+G1 X93.143 Y70.764 Z5.4427 A163.2780
+G1 X94.475 Y71.036 Z5.4440 A163.3187
+G1 X95.761 Y71.291 Z5.4453 A163.3589
+G1 X97.005 Y71.505 Z5.4467 A163.3985
+G1 X98.217 Y71.659 Z5.4480 A163.4377
+G1 X99.408 Y71.740 Z5.4493 A163.4768
+G1 X100.592 Y71.740 Z5.4507 A163.5159
+G1 X101.783 Y71.659 Z5.4520 A163.5551
+G1 X102.995 Y71.505 Z5.4533 A163.5947
+G1 X104.239 Y71.291 Z5.4547 A163.6348
+G1 X105.525 Y71.036 Z5.4560 A163.6756
+G1 X106.857 Y70.764 Z5.4573 A163.7171
+G1 X108.236 Y70.502 Z5.4587 A163.7594
+G1 X109.657 Y70.279 Z5.4600 A163.8026
+G1 X111.110 Y70.125 Z5.4613 A163.8467
+G1 X112.583 Y70.067 Z5.4627 A163.8916
+G1 X114.056 Y70.129 Z5.4640 A163.9372
+G1 X115.511 Y70.330 Z5.4653 A163.9835
+G1 X116.924 Y70.687 Z5.4667 A164.0303
+G1 X118.273 Y71.206 Z5.4680 A164.0774
+G1 X119.538 Y71.889 Z5.4693 A164.1247
+G1 X120.698 Y72.732 Z5.4707 A164.1721
+G1 X121.738 Y73.723 Z5.4720 A164.2192
+G1 X122.649 Y74.846 Z5.4733 A164.2660
+G1 X123.424 Y76.080 Z5.4747 A164.3123
+G1 X124.066 Y77.401 Z5.4760 A164.3579
+G1 X124.580 Y78.783 Z5.4773 A164.4028
+G1 X124.979 Y80.202 Z5.4787 A164.4469
+G1 X125.282 Y81.632 Z5.4800 A164.4900
+G1 X125.509 Y83.052 Z5.4813 A164.5324
+G1 X125.686 Y84.444 Z5.4827 A164.5739
+G1 X125.839 Y85.795 Z5.4840 A164.6147
+G1 X125.994 Y87.096 Z5.4853 A164.6548
+G1 X126.175 Y88.346 Z5.4867 A164.6944
+G1 X126.403 Y89.546 Z5.4880 A164.7336
+G1 X126.694 Y90.704 Z5.4893 A164.7727
+G1 X127.060 Y91.830 Z5.4907 A164.8118
+G1 X127.505 Y92.938 Z5.4920 A164.8510
+G1 X128.026 Y94.043 Z5.4933 A164.8906
+G1 X128.614 Y95.160 Z5.4947 A164.9307
+G1 X129.254 Y96.304 Z5.4960 A164.9715
+G1 X129.924 Y97.487 Z5.4973 A165.0130
+G1 X130.599 Y98.718 Z5.4987 A165.0554
+G1 X131.250 Y100.000 Z5.5000 A165.0985
+G1 X131.896 Y101.337 Z5.5013 A165.1427
+G1 X132.406 Y102.721 Z5.5027 A165.1876
+G1 X132.803 Y104.144 Z5.5040 A165.2333
+G1 X133.060 Y105.592 Z5.5053 A165.2797
+G1 X133.157 Y107.048 Z5.5067 A165.3265
+G1 X133.080 Y108.494 Z5.5080 A165.3737
+G1 X132.820 Y109.909 Z5.5093 A165.4211
+G1 X132.377 Y111.275 Z5.5107 A165.4685
+G1 X131.755 Y112.573 Z5.5120 A165.5157
+G1 X130.967 Y113.788 Z5.5133 A165.5626
+G1 X130.033 Y114.908 Z5.5147 A165.6089
+G1 X128.974 Y115.928 Z5.5160 A165.6546
+G1 X127.817 Y116.846 Z5.5173 A165.6996
+G1 X126.590 Y117.666 Z5.5187 A165.7437
+G1 X125.322 Y118.398 Z5.5200 A165.7870
+G1 X124.041 Y119.054 Z5.5213 A165.8294
+G1 X122.770 Y119.655 Z5.5227 A165.8710
+G1 X121.531 Y120.219 Z5.5240 A165.9118
+G1 X120.340 Y120.770 Z5.5253 A165.9520
+G1 X119.205 Y121.330 Z5.5267 A165.9917
+G1 X118.133 Y121.919 Z5.5280 A166.0310
+G1 X117.120 Y122.555 Z5.5293 A166.0701
+G1 X116.161 Y123.252 Z5.5307 A166.1093
+G1 X115.243 Y124.018 Z5.5320 A166.1486
+G1 X114.351 Y124.857 Z5.5333 A166.1883
+G1 X113.468 Y125.762 Z5.5347 A166.2285
+G1 X112.576 Y126.726 Z5.5360 A166.2693
+G1 X111.656 Y127.729 Z5.5373 A166.3109
+G1 X110.693 Y128.752 Z5.5387 A166.3533
+G1 X109.672 Y129.768 Z5.5400 A166.3965
+G1 X108.585 Y130.748 Z5.5413 A166.4407
+G1 X107.426 Y131.661 Z5.5427 A166.4856
+G1 X106.195 Y132.478 Z5.5440 A166.5313
+G1 X104.898 Y133.170 Z5.5453 A166.5777
+G1 X103.543 Y133.712 Z5.5467 A166.6245
+G1 X102.144 Y134.086 Z5.5480 A166.6717
+G1 X100.718 Y134.276 Z5.5493 A166.7191
+G1 X99.282 Y134.276 Z5.5507 A166.7665
+G1 X97.856 Y134.086 Z5.5520 A166.8137
+G1 X96.457 Y133.712 Z5.5533 A166.8606
+G1 X95.102 Y133.170 Z5.5547 A166.9069
+G1 X93.805 Y132.478 Z5.5560 A166.9526
+G1 X92.574 Y131.661 Z5.5573 A166.9976
+G1 X91.415 Y130.748 Z5.5587 A167.0417
+G1 X90.328 Y129.768 Z5.5600 A167.0850
+G1 X89.307 Y128.752 Z5.5613 A167.1274
+G1 X88.344 Y127.729 Z5.5627 A167.1690
+G1 X87.424 Y126.726 Z5.5640 A167.2098
+G1 X86.532 Y125.762 Z5.5653 A167.2500
+G1 X85.649 Y124.857 Z5.5667 A167.2896
+G1 X84.757 Y124.018 Z5.5680 A167.3290
+G1 X83.839 Y123.252 Z5.5693 A167.3681
+G1 X82.880 Y122.555 Z5.5707 A167.4073
+G1 X81.867 Y121.919 Z5.5720 A167.4466
+G1 X80.795 Y121.330 Z5.5733 A167.4862
+G1 X79.660 Y120.770 Z5.5747 A167.5264
+G1 X78.469 Y120.219 Z5.5760 A167.5673
+G1 X77.230 Y119.655 Z5.5773 A167.6088
+G1 X75.959 Y119.054 Z5.5787 A167.6512
+G1 X74.678 Y118.398 Z5.5800 A167.6945
+G1 X73.410 Y117.666 Z5.5813 A167.7386
+G1 X72.183 Y116.846 Z5.5827 A167.7836
+G1 X71.026 Y115.928 Z5.5840 A167.8293
+G1 X69.967 Y114.908 Z5.5853 A167.8756
+G1 X69.033 Y113.788 Z5.5867 A167.9225
+G1 X68.245 Y112.573 Z5.5880 A167.9697
+G1 X67.623 Y111.275 Z5.5893 A168.0171
+G1 X67.180 Y109.909 Z5.5907 A168.0645
+G1 X66.920 Y108.494 Z5.5920 A168.1117
+G1 X66.843 Y107.048 Z5.5933 A168.1586
+G1 X66.940 Y105.592 Z5.5947 A168.2049
+G1 X67.197 Y104.144 Z5.5960 A168.2506
+G1 X67.594 Y102.721 Z5.5973 A168.2956
+G1 X68.104 Y101.337 Z5.5987 A168.3397
+G1 X68.700 Y100.000 Z5.6000 A168.3830
+G1 X69.351 Y98.715 Z5.6013 A168.4254
+G1 X70.026 Y97.483 Z5.6027 A168.4669
+G1 X70.696 Y96.298 Z5.6040 A168.5078
+G1 X71.337 Y95.152 Z5.6053 A168.5480
+G1 X71.925 Y94.033 Z5.6067 A168.5876
+G1 X72.447 Y92.926 Z5.6080 A168.6269
+G1 X72.892 Y91.816 Z5.6093 A168.6661
+G1 X73.259 Y90.688 Z5.6107 A168.7052
+G1 X73.551 Y89.528 Z5.6120 A168.7446
+G1 X73.779 Y88.326 Z5.6133 A168.7842
+G1 X73.961 Y87.074 Z5.6147 A168.8244
+G1 X74.117 Y85.771 Z5.6160 A168.8652
+G1 X74.271 Y84.418 Z5.6173 A168.9068
+G1 X74.449 Y83.024 Z5.6187 A168.9492
+G1 X74.678 Y81.602 Z5.6200 A168.9925
+G1 X74.982 Y80.171 Z5.6213 A169.0366
+G1 X75.382 Y78.751 Z5.6227 A169.0816
+G1 X75.898 Y77.367 Z5.6240 A169.1273
+G1 X76.541 Y76.044 Z5.6253 A169.1736
+G1 X77.318 Y74.809 Z5.6267 A169.2205
+G1 X78.230 Y73.685 Z5.6280 A169.2677
+G1 X79.272 Y72.692 Z5.6293 A169.3151
+G1 X80.434 Y71.848 Z5.6307 A169.3625
+G1 X81.700 Y71.164 Z5.6320 A169.4097
+G1 X83.051 Y70.643 Z5.6333 A169.4565
+G1 X84.466 Y70.286 Z5.6347 A169.5029
+G1 X85.922 Y70.083 Z5.6360 A169.5486
+G1 X87.398 Y70.021 Z5.6373 A169.5935
+G1 X88.872 Y70.078 Z5.6387 A169.6377
+G1 X90.328 Y70.232 Z5.6400 A169.6809
+G1 X91.751 Y70.454 Z5.6413 A169.7233
+G1 X93.131 Y70.715 Z5.6427 A169.7649
+G1 X94.465 Y70.987 Z5.6440 A169.8057
+G1 X95.753 Y71.241 Z5.6453 A169.8459
+G1 X97.000 Y71.455 Z5.6467 A169.8856
+G1 X98.214 Y71.609 Z5.6480 A169.9249
+G1 X99.407 Y71.690 Z5.6493 A169.9641
+G1 X100.593 Y71.690 Z5.6507 A170.0032
+G1 X101.786 Y71.609 Z5.6520 A170.0425
+G1 X103.000 Y71.455 Z5.6533 A170.0822
+G1 X104.247 Y71.241 Z5.6547 A170.1224
+G1 X105.535 Y70.987 Z5.6560 A170.1632
+G1 X106.869 Y70.715 Z5.6573 A170.2048
+G1 X108.249 Y70.454 Z5.6587 A170.2472
+G1 X109.672 Y70.232 Z5.6600 A170.2905
+G1 X111.128 Y70.078 Z5.6613 A170.3346
+G1 X112.602 Y70.021 Z5.6627 A170.3796
+G1 X114.078 Y70.083 Z5.6640 A170.4253
+G1 X115.534 Y70.286 Z5.6653 A170.4716
+G1 X116.949 Y70.643 Z5.6667 A170.5185
+G1 X118.300 Y71.164 Z5.6680 A170.5657
+G1 X119.566 Y71.848 Z5.6693 A170.6131
+G1 X120.728 Y72.692 Z5.6707 A170.6604
+G1 X121.770 Y73.685 Z5.6720 A170.7077
+G1 X122.682 Y74.809 Z5.6733 A170.7545
+G1 X123.459 Y76.044 Z5.6747 A170.8009
+G1 X124.102 Y77.367 Z5.6760 A170.8466
+G1 X124.618 Y78.751 Z5.6773 A170.8915
+G1 X125.018 Y80.171 Z5.6787 A170.9356
+G1 X125.322 Y81.602 Z5.6800 A170.9789
+G1 X125.551 Y83.024 Z5.6813 A171.0213
+G1 X125.729 Y84.418 Z5.6827 A171.0629
+G1 X125.883 Y85.771 Z5.6840 A171.1037
+G1 X126.039 Y87.074 Z5.6853 A171.1439
+G1 X126.221 Y88.326 Z5.6867 A171.1836
+G1 X126.449 Y89.528 Z5.6880 A171.2229
+G1 X126.741 Y90.688 Z5.6893 A171.2620
+G1 X127.108 Y91.816 Z5.6907 A171.3012
+G1 X127.553 Y92.926 Z5.6920 A171.3405
+G1 X128.075 Y94.033 Z5.6933 A171.3802
+G1 X128.663 Y95.152 Z5.6947 A171.4204
+G1 X129.304 Y96.298 Z5.6960 A171.4612
+G1 X129.974 Y97.483 Z5.6973 A171.5028
+G1 X130.649 Y98.715 Z5.6987 A171.5452
+G1 X131.300 Y100.000 Z5.7000 A171.5885
+G1 X131.946 Y101.339 Z5.7013 A171.6326
+G1 X132.456 Y102.725 Z5.7027 A171.6777
+G1 X132.852 Y104.150 Z5.7040 A171.7234
+G1 X133.109 Y105.600 Z5.7053 A171.7699
+G1 X133.206 Y107.058 Z5.7067 A171.8168
+G1 X133.129 Y108.506 Z5.7080 A171.8641
+G1 X132.868 Y109.923 Z5.7093 A171.9115
+G1 X132.424 Y111.291 Z5.7107 A171.9590
+G1 X131.801 Y112.591 Z5.7120 A172.0063
+G1 X131.013 Y113.808 Z5.7133 A172.0532
+G1 X130.077 Y114.931 Z5.7147 A172.0996
+G1 X129.017 Y115.952 Z5.7160 A172.1454
+G1 X127.859 Y116.872 Z5.7173 A172.1904
+G1 X126.632 Y117.694 Z5.7187 A172.2346
+G1 X125.363 Y118.427 Z5.7200 A172.2779
+G1 X124.080 Y119.086 Z5.7213 A172.3204
+G1 X122.808 Y119.687 Z5.7227 A172.3621
+G1 X121.568 Y120.253 Z5.7240 A172.4030
+G1 X120.375 Y120.806 Z5.7253 A172.4432
+G1 X119.239 Y121.367 Z5.7267 A172.4829
+G1 X118.165 Y121.957 Z5.7280 A172.5223
+G1 X117.150 Y122.595 Z5.7293 A172.5616
+G1 X116.189 Y123.293 Z5.7307 A172.6008
+G1 X115.269 Y124.061 Z5.7320 A172.6402
+G1 X114.376 Y124.900 Z5.7333 A172.6799
+G1 X113.491 Y125.807 Z5.7347 A172.7201
+G1 X112.597 Y126.771 Z5.7360 A172.7610
+G1 X111.676 Y127.776 Z5.7373 A172.8027
+G1 X110.710 Y128.799 Z5.7387 A172.8452
+G1 X109.688 Y129.816 Z5.7400 A172.8885
+G1 X108.598 Y130.796 Z5.7413 A172.9327
+G1 X107.437 Y131.710 Z5.7427 A172.9777
+G1 X106.205 Y132.527 Z5.7440 A173.0235
+G1 X104.905 Y133.219 Z5.7453 A173.0699
+G1 X103.549 Y133.762 Z5.7467 A173.1168
+G1 X102.148 Y134.136 Z5.7480 A173.1641
+G1 X100.719 Y134.326 Z5.7493 A173.2116
+G1 X99.281 Y134.326 Z5.7507 A173.2590
+G1 X97.852 Y134.136 Z5.7520 A173.3063
+G1 X96.451 Y133.762 Z5.7533 A173.3532
+G1 X95.095 Y133.219 Z5.7547 A173.3997
+G1 X93.795 Y132.527 Z5.7560 A173.4454
+G1 X92.563 Y131.710 Z5.7573 A173.4905
+G1 X91.402 Y130.796 Z5.7587 A173.5347
+G1 X90.312 Y129.816 Z5.7600 A173.5780
+G1 X89.290 Y128.799 Z5.7613 A173.6205
+G1 X88.324 Y127.776 Z5.7627 A173.6621
+G1 X87.403 Y126.771 Z5.7640 A173.7030
+G1 X86.509 Y125.807 Z5.7653 A173.7433
+G1 X85.624 Y124.900 Z5.7667 A173.7830
+G1 X84.731 Y124.061 Z5.7680 A173.8224
+G1 X83.811 Y123.293 Z5.7693 A173.8616
+G1 X82.850 Y122.595 Z5.7707 A173.9008
+G1 X81.835 Y121.957 Z5.7720 A173.9402
+G1 X80.761 Y121.367 Z5.7733 A173.9800
+G1 X79.625 Y120.806 Z5.7747 A174.0202
+G1 X78.432 Y120.253 Z5.7760 A174.0611
+G1 X77.192 Y119.687 Z5.7773 A174.1027
+G1 X75.920 Y119.086 Z5.7787 A174.1452
+G1 X74.637 Y118.427 Z5.7800 A174.1886
+G1 X73.368 Y117.694 Z5.7813 A174.2328
+G1 X72.141 Y116.872 Z5.7827 A174.2778
+G1 X70.983 Y115.952 Z5.7840 A174.3235
+G1 X69.923 Y114.931 Z5.7853 A174.3700
+G1 X68.987 Y113.808 Z5.7867 A174.4169
+G1 X68.199 Y112.591 Z5.7880 A174.4642
+G1 X67.576 Y111.291 Z5.7893 A174.5116
+G1 X67.132 Y109.923 Z5.7907 A174.5591
+G1 X66.871 Y108.506 Z5.7920 A174.6064
+G1 X66.794 Y107.058 Z5.7933 A174.6533
+G1 X66.891 Y105.600 Z5.7947 A174.6997
+G1 X67.148 Y104.150 Z5.7960 A174.7455
+G1 X67.544 Y102.725 Z5.7973 A174.7905
+G1 X68.054 Y101.339 Z5.7987 A174.8347
+G1 X68.650 Y100.000 Z5.8000 A174.8780
+G1 X69.301 Y98.713 Z5.8013 A174.9205
+G1 X69.976 Y97.479 Z5.8027 A174.9622
+G1 X70.647 Y96.292 Z5.8040 A175.0031
+G1 X71.287 Y95.144 Z5.8053 A175.0433
+G1 X71.876 Y94.022 Z5.8067 A175.0831
+G1 X72.398 Y92.913 Z5.8080 A175.1224
+G1 X72.844 Y91.801 Z5.8093 A175.1617
+G1 X73.211 Y90.671 Z5.8107 A175.2009
+G1 X73.504 Y89.510 Z5.8120 A175.2403
+G1 X73.734 Y88.306 Z5.8133 A175.2800
+G1 X73.916 Y87.052 Z5.8147 A175.3203
+G1 X74.073 Y85.747 Z5.8160 A175.3612
+G1 X74.228 Y84.392 Z5.8173 A175.4028
+G1 X74.407 Y82.996 Z5.8187 A175.4453
+G1 X74.637 Y81.573 Z5.8200 A175.4886
+G1 X74.942 Y80.140 Z5.8213 A175.5328
+G1 X75.345 Y78.718 Z5.8227 A175.5778
+G1 X75.861 Y77.332 Z5.8240 A175.6236
+G1 X76.506 Y76.008 Z5.8253 A175.6700
+G1 X77.284 Y74.772 Z5.8267 A175.7169
+G1 X78.198 Y73.646 Z5.8280 A175.7642
+G1 X79.242 Y72.652 Z5.8293 A175.8117
+G1 X80.405 Y71.807 Z5.8307 A175.8591
+G1 X81.673 Y71.121 Z5.8320 A175.9064
+G1 X83.026 Y70.600 Z5.8333 A175.9533
+G1 X84.443 Y70.242 Z5.8347 A175.9998
+G1 X85.901 Y70.038 Z5.8360 A176.0455
+G1 X87.379 Y69.975 Z5.8373 A176.0906
+G1 X88.855 Y70.032 Z5.8387 A176.1348
+G1 X90.312 Y70.184 Z5.8400 A176.1781
+G1 X91.737 Y70.406 Z5.8413 A176.2206
+G1 X93.120 Y70.666 Z5.8427 A176.2622
+G1 X94.456 Y70.937 Z5.8440 A176.3031
+G1 X95.746 Y71.192 Z5.8453 A176.3434
+G1 X96.995 Y71.406 Z5.8467 A176.3831
+G1 X98.211 Y71.559 Z5.8480 A176.4225
+G1 X99.406 Y71.640 Z5.8493 A176.4617
+G1 X100.594 Y71.640 Z5.8507 A176.5009
+G1 X101.789 Y71.559 Z5.8520 A176.5403
+G1 X103.005 Y71.406 Z5.8533 A176.5801
+G1 X104.254 Y71.192 Z5.8547 A176.6203
+G1 X105.544 Y70.937 Z5.8560 A176.6612
+G1 X106.880 Y70.666 Z5.8573 A176.7029
+G1 X108.263 Y70.406 Z5.8587 A176.7453
+G1 X109.688 Y70.184 Z5.8600 A176.7887
+G1 X111.145 Y70.032 Z5.8613 A176.8329
+G1 X112.621 Y69.975 Z5.8627 A176.8779
+G1 X114.099 Y70.038 Z5.8640 A176.9237
+G1 X115.557 Y70.242 Z5.8653 A176.9701
+G1 X116.974 Y70.600 Z5.8667 A177.0170
+G1 X118.327 Y71.121 Z5.8680 A177.0643
+G1 X119.595 Y71.807 Z5.8693 A177.1117
+G1 X120.758 Y72.652 Z5.8707 A177.1592
+G1 X121.802 Y73.646 Z5.8720 A177.2065
+G1 X122.716 Y74.772 Z5.8733 A177.2534
+G1 X123.494 Y76.008 Z5.8747 A177.2998
+G1 X124.139 Y77.332 Z5.8760 A177.3456
+G1 X124.655 Y78.718 Z5.8773 A177.3906
+G1 X125.058 Y80.140 Z5.8787 A177.4348
+G1 X125.363 Y81.573 Z5.8800 A177.4781
+G1 X125.593 Y82.996 Z5.8813 A177.5206
+G1 X125.772 Y84.392 Z5.8827 A177.5623
+G1 X125.927 Y85.747 Z5.8840 A177.6032
+G1 X126.084 Y87.052 Z5.8853 A177.6434
+G1 X126.266 Y88.306 Z5.8867 A177.6832
+G1 X126.496 Y89.510 Z5.8880 A177.7226
+G1 X126.789 Y90.671 Z5.8893 A177.7618
+G1 X127.156 Y91.801 Z5.8907 A177.8010
+G1 X127.602 Y92.913 Z5.8920 A177.8404
+G1 X128.124 Y94.022 Z5.8933 A177.8801
+G1 X128.713 Y95.144 Z5.8947 A177.9204
+G1 X129.353 Y96.292 Z5.8960 A177.9613
+G1 X130.024 Y97.479 Z5.8973 A178.0029
+G1 X130.699 Y98.713 Z5.8987 A178.0454
+G1 X131.350 Y100.000 Z5.9000 A178.0887
+G1 X131.996 Y101.341 Z5.9013 A178.1330
+G1 X132.506 Y102.730 Z5.9027 A178.1781
+G1 X132.902 Y104.156 Z5.9040 A178.2239
+G1 X133.158 Y105.608 Z5.9053 A178.2704
+G1 X133.255 Y107.069 Z5.9067 A178.3174
+G1 X133.177 Y108.518 Z5.9080 A178.3647
+G1 X132.916 Y109.938 Z5.9093 A178.4123
+G1 X132.471 Y111.308 Z5.9107 A178.4598
+G1 X131.848 Y112.609 Z5.9120 A178.5072
+G1 X131.059 Y113.828 Z5.9133 A178.5541
+G1 X130.122 Y114.953 Z5.9147 A178.6006
+G1 X129.061 Y115.977 Z5.9160 A178.6465
+G1 X127.902 Y116.898 Z5.9173 A178.6916
+G1 X126.673 Y117.722 Z5.9187 A178.7358
+G1 X125.403 Y118.456 Z5.9200 A178.7792
+G1 X124.119 Y119.117 Z5.9213 A178.8218
+G1 X122.846 Y119.720 Z5.9227 A178.8635
+G1 X121.604 Y120.288 Z5.9240 A178.9045
+G1 X120.410 Y120.842 Z5.9253 A178.9448
+G1 X119.272 Y121.404 Z5.9267 A178.9846
+G1 X118.196 Y121.996 Z5.9280 A179.0241
+G1 X117.181 Y122.635 Z5.9293 A179.0633
+G1 X116.218 Y123.334 Z5.9307 A179.1026
+G1 X115.296 Y124.103 Z5.9320 A179.1421
+G1 X114.401 Y124.943 Z5.9333 A179.1819
+G1 X113.515 Y125.851 Z5.9347 A179.2222
+G1 X112.619 Y126.816 Z5.9360 A179.2632
+G1 X111.695 Y127.822 Z5.9373 A179.3049
+G1 X110.728 Y128.846 Z5.9387 A179.3474
+G1 X109.703 Y129.863 Z5.9400 A179.3908
+G1 X108.612 Y130.844 Z5.9413 A179.4351
+G1 X107.449 Y131.758 Z5.9427 A179.4802
+G1 X106.214 Y132.576 Z5.9440 A179.5260
+G1 X104.913 Y133.269 Z5.9453 A179.5725
+G1 X103.554 Y133.812 Z5.9467 A179.6195
+G1 X102.151 Y134.186 Z5.9480 A179.6669
+G1 X100.720 Y134.376 Z5.9493 A179.7144
+G1 X99.280 Y134.376 Z5.9507 A179.7619
+G1 X97.849 Y134.186 Z5.9520 A179.8093
+G1 X96.446 Y133.812 Z5.9533 A179.8563
+G1 X95.087 Y133.269 Z5.9547 A179.9028
+G1 X93.786 Y132.576 Z5.9560 A179.9486
+G1 X92.551 Y131.758 Z5.9573 A179.9937
+G1 X91.388 Y130.844 Z5.9587 A180.0380
+G1 X90.297 Y129.863 Z5.9600 A180.0814
+G1 X89.272 Y128.846 Z5.9613 A180.1239
+G1 X88.305 Y127.822 Z5.9627 A180.1656
+G1 X87.381 Y126.816 Z5.9640 A180.2066
+G1 X86.485 Y125.851 Z5.9653 A180.2469
+G1 X85.599 Y124.943 Z5.9667 A180.2867
+G1 X84.704 Y124.103 Z5.9680 A180.3262
+G1 X83.782 Y123.334 Z5.9693 A180.3655
+G1 X82.819 Y122.635 Z5.9707 A180.4047
+G1 X81.804 Y121.996 Z5.9720 A180.4442
+G1 X80.728 Y121.404 Z5.9733 A180.4840
+G1 X79.590 Y120.842 Z5.9747 A180.5243
+G1 X78.396 Y120.288 Z5.9760 A180.5653
+G1 X77.154 Y119.720 Z5.9773 A180.6070
+G1 X75.881 Y119.117 Z5.9787 A180.6496
+G1 X74.597 Y118.456 Z5.9800 A180.6930
+G1 X73.327 Y117.722 Z5.9813 A180.7372
+G1 X72.098 Y116.898 Z5.9827 A180.7823
+G1 X70.939 Y115.977 Z5.9840 A180.8282
+G1 X69.878 Y114.953 Z5.9853 A180.8747
+G1 X68.941 Y113.828 Z5.9867 A180.9217
+G1 X68.152 Y112.609 Z5.9880 A180.9690
+G1 X67.529 Y111.308 Z5.9893 A181.0165
+G1 X67.084 Y109.938 Z5.9907 A181.0641
+G1 X66.823 Y108.518 Z5.9920 A181.1114
+G1 X66.745 Y107.069 Z5.9933 A181.1584
+G1 X66.842 Y105.608 Z5.9947 A181.2049
+G1 X67.098 Y104.156 Z5.9960 A181.2507
+G1 X67.494 Y102.730 Z5.9973 A181.2958
+G1 X68.004 Y101.341 Z5.9987 A181.3401
+G1 X68.600 Y100.000 Z6.0000 A181.3835
+G1 X69.251 Y98.711 Z6.0013 A181.4260
+G1 X69.926 Y97.475 Z6.0027 A181.4678
+G1 X70.597 Y96.286 Z6.0040 A181.5087
+G1 X71.238 Y95.135 Z6.0053 A181.5490
+G1 X71.827 Y94.012 Z6.0067 A181.5889
+G1 X72.350 Y92.901 Z6.0080 A181.6283
+G1 X72.796 Y91.787 Z6.0093 A181.6676
+G1 X73.164 Y90.655 Z6.0107 A181.7069
+G1 X73.458 Y89.491 Z6.0120 A181.7463
+G1 X73.688 Y88.285 Z6.0133 A181.7861
+G1 X73.872 Y87.030 Z6.0147 A181.8265
+G1 X74.029 Y85.722 Z6.0160 A181.8674
+G1 X74.185 Y84.366 Z6.0173 A181.9092
+G1 X74.366 Y82.969 Z6.0187 A181.9517
+G1 X74.597 Y81.544 Z6.0200 A181.9951
+G1 X74.903 Y80.109 Z6.0213 A182.0394
+G1 X75.307 Y78.685 Z6.0227 A182.0845
+G1 X75.825 Y77.298 Z6.0240 A182.1303
+G1 X76.471 Y75.973 Z6.0253 A182.1768
+G1 X77.251 Y74.735 Z6.0267 A182.2238
+G1 X78.166 Y73.607 Z6.0280 A182.2711
+G1 X79.212 Y72.612 Z6.0293 A182.3187
+G1 X80.377 Y71.766 Z6.0307 A182.3662
+G1 X81.646 Y71.079 Z6.0320 A182.4135
+G1 X83.001 Y70.557 Z6.0333 A182.4605
+G1 X84.420 Y70.197 Z6.0347 A182.5070
+G1 X85.880 Y69.993 Z6.0360 A182.5529
+G1 X87.359 Y69.929 Z6.0373 A182.5979
+G1 X88.837 Y69.985 Z6.0387 A182.6422
+G1 X90.297 Y70.137 Z6.0400 A182.6856
+G1 X91.724 Y70.357 Z6.0413 A182.7282
+G1 X93.108 Y70.618 Z6.0427 A182.7699
+G1 X94.447 Y70.888 Z6.0440 A182.8108
+G1 X95.739 Y71.142 Z6.0453 A182.8512
+G1 X96.989 Y71.356 Z6.0467 A182.8910
+G1 X98.208 Y71.510 Z6.0480 A182.9304
+G1 X99.405 Y71.590 Z6.0493 A182.9697
+G1 X100.595 Y71.590 Z6.0507 A183.0090
+G1 X101.792 Y71.510 Z6.0520 A183.0485
+G1 X103.011 Y71.356 Z6.0533 A183.0883
+G1 X104.261 Y71.142 Z6.0547 A183.1286
+G1 X105.553 Y70.888 Z6.0560 A183.1696
+G1 X106.892 Y70.618 Z6.0573 A183.2113
+G1 X108.276 Y70.357 Z6.0587 A183.2538
+G1 X109.703 Y70.137 Z6.0600 A183.2972
+G1 X111.163 Y69.985 Z6.0613 A183.3415
+G1 X112.641 Y69.929 Z6.0627 A183.3866
+G1 X114.120 Y69.993 Z6.0640 A183.4324
+G1 X115.580 Y70.197 Z6.0653 A183.4789
+G1 X116.999 Y70.557 Z6.0667 A183.5259
+G1 X118.354 Y71.079 Z6.0680 A183.5733
+G1 X119.623 Y71.766 Z6.0693 A183.6208
+G1 X120.788 Y72.612 Z6.0707 A183.6683
+G1 X121.834 Y73.607 Z6.0720 A183.7157
+G1 X122.749 Y74.735 Z6.0733 A183.7627
+G1 X123.529 Y75.973 Z6.0747 A183.8091
+G1 X124.175 Y77.298 Z6.0760 A183.8550
+G1 X124.693 Y78.685 Z6.0773 A183.9001
+G1 X125.097 Y80.109 Z6.0787 A183.9443
+G1 X125.403 Y81.544 Z6.0800 A183.9877
+G1 X125.634 Y82.969 Z6.0813 A184.0303
+G1 X125.815 Y84.366 Z6.0827 A184.0720
+G1 X125.971 Y85.722 Z6.0840 A184.1130
+G1 X126.128 Y87.030 Z6.0853 A184.1533
+G1 X126.312 Y88.285 Z6.0867 A184.1931
+G1 X126.542 Y89.491 Z6.0880 A184.2326
+G1 X126.836 Y90.655 Z6.0893 A184.2718
+G1 X127.204 Y91.787 Z6.0907 A184.3111
+G1 X127.650 Y92.901 Z6.0920 A184.3506
+G1 X128.173 Y94.012 Z6.0933 A184.3904
+G1 X128.762 Y95.135 Z6.0947 A184.4307
+G1 X129.403 Y96.286 Z6.0960 A184.4717
+G1 X130.074 Y97.475 Z6.0973 A184.5134
+G1 X130.749 Y98.711 Z6.0987 A184.5560
+G1 X131.400 Y100.000 Z6.1000 A184.5994
+G1 X132.046 Y101.343 Z6.1013 A184.6437
+G1 X132.556 Y102.734 Z6.1027 A184.6889
+G1 X132.951 Y104.163 Z6.1040 A184.7348
+G1 X133.208 Y105.617 Z6.1053 A184.7813
+G1 X133.304 Y107.079 Z6.1067 A184.8284
+G1 X133.225 Y108.531 Z6.1080 A184.8758
+G1 X132.964 Y109.952 Z6.1093 A184.9234
+G1 X132.518 Y111.324 Z6.1107 A184.9710
+G1 X131.894 Y112.628 Z6.1120 A185.0184
+G1 X131.104 Y113.849 Z6.1133 A185.0655
+G1 X130.167 Y114.975 Z6.1147 A185.1120
+G1 X129.105 Y116.001 Z6.1160 A185.1579
+G1 X127.945 Y116.924 Z6.1173 A185.2031
+G1 X126.715 Y117.749 Z6.1187 A185.2474
+G1 X125.444 Y118.486 Z6.1200 A185.2909
+G1 X124.158 Y119.148 Z6.1213 A185.3335
+G1 X122.884 Y119.753 Z6.1227 A185.3753
+G1 X121.641 Y120.322 Z6.1240 A185.4163
+G1 X120.445 Y120.877 Z6.1253 A185.4567
+G1 X119.306 Y121.441 Z6.1267 A185.4966
+G1 X118.228 Y122.034 Z6.1280 A185.5361
+G1 X117.211 Y122.674 Z6.1293 A185.5755
+G1 X116.246 Y123.375 Z6.1307 A185.6148
+G1 X115.323 Y124.145 Z6.1320 A185.6544
+G1 X114.426 Y124.986 Z6.1333 A185.6943
+G1 X113.538 Y125.895 Z6.1347 A185.7346
+G1 X112.640 Y126.861 Z6.1360 A185.7757
+G1 X111.715 Y127.868 Z6.1373 A185.8175
+G1 X110.745 Y128.893 Z6.1387 A185.8601
+G1 X109.719 Y129.911 Z6.1400 A185.9036
+G1 X108.625 Y130.892 Z6.1413 A185.9479
+G1 X107.460 Y131.807 Z6.1427 A185.9931
+G1 X106.224 Y132.625 Z6.1440 A186.0390
+G1 X104.920 Y133.318 Z6.1453 A186.0855
+G1 X103.559 Y133.862 Z6.1467 A186.1326
+G1 X102.154 Y134.235 Z6.1480 A186.1800
+G1 X100.721 Y134.426 Z6.1493 A186.2276
+G1 X99.279 Y134.426 Z6.1507 A186.2752
+G1 X97.846 Y134.235 Z6.1520 A186.3226
+G1 X96.441 Y133.862 Z6.1533 A186.3697
+G1 X95.080 Y133.318 Z6.1547 A186.4162
+G1 X93.776 Y132.625 Z6.1560 A186.4621
+G1 X92.540 Y131.807 Z6.1573 A186.5073
+G1 X91.375 Y130.892 Z6.1587 A186.5516
+G1 X90.281 Y129.911 Z6.1600 A186.5951
+G1 X89.255 Y128.893 Z6.1613 A186.6377
+G1 X88.285 Y127.868 Z6.1627 A186.6795
+G1 X87.360 Y126.861 Z6.1640 A186.7205
+G1 X86.462 Y125.895 Z6.1653 A186.7609
+G1 X85.574 Y124.986 Z6.1667 A186.8008
+G1 X84.677 Y124.145 Z6.1680 A186.8403
+G1 X83.754 Y123.375 Z6.1693 A186.8797
+G1 X82.789 Y122.674 Z6.1707 A186.9190
+G1 X81.772 Y122.034 Z6.1720 A186.9586
+G1 X80.694 Y121.441 Z6.1733 A186.9985
+G1 X79.555 Y120.877 Z6.1747 A187.0389
+G1 X78.359 Y120.322 Z6.1760 A187.0799
+G1 X77.116 Y119.753 Z6.1773 A187.1217
+G1 X75.842 Y119.148 Z6.1787 A187.1643
+G1 X74.556 Y118.486 Z6.1800 A187.2078
+G1 X73.285 Y117.749 Z6.1813 A187.2521
+G1 X72.055 Y116.924 Z6.1827 A187.2973
+G1 X70.895 Y116.001 Z6.1840 A187.3432
+G1 X69.833 Y114.975 Z6.1853 A187.3897
+G1 X68.896 Y113.849 Z6.1867 A187.4368
+G1 X68.106 Y112.628 Z6.1880 A187.4842
+G1 X67.482 Y111.324 Z6.1893 A187.5318
+G1 X67.036 Y109.952 Z6.1907 A187.5794
+G1 X66.775 Y108.531 Z6.1920 A187.6268
+G1 X66.696 Y107.079 Z6.1933 A187.6739
+G1 X66.792 Y105.617 Z6.1947 A187.7204
+G1 X67.049 Y104.163 Z6.1960 A187.7663
+G1 X67.444 Y102.734 Z6.1973 A187.8115
+G1 X67.954 Y101.343 Z6.1987 A187.8558
+G1 X68.550 Y100.000 Z6.2000 A187.8993
+G1 X69.201 Y98.709 Z6.2013 A187.9419
+G1 X69.876 Y97.470 Z6.2027 A187.9837
+G1 X70.547 Y96.279 Z6.2040 A188.0247
+G1 X71.189 Y95.127 Z6.2053 A188.0651
+G1 X71.779 Y94.001 Z6.2067 A188.1050
+G1 X72.302 Y92.888 Z6.2080 A188.1445
+G1 X72.749 Y91.772 Z6.2093 A188.1839
+G1 X73.117 Y90.638 Z6.2107 A188.2232
+G1 X73.411 Y89.473 Z6.2120 A188.2628
+G1 X73.642 Y88.265 Z6.2133 A188.3027
+G1 X73.827 Y87.008 Z6.2147 A188.3431
+G1 X73.985 Y85.698 Z6.2160 A188.3841
+G1 X74.143 Y84.340 Z6.2173 A188.4259
+G1 X74.324 Y82.941 Z6.2187 A188.4685
+G1 X74.556 Y81.514 Z6.2200 A188.5120
+G1 X74.864 Y80.077 Z6.2213 A188.5563
+G1 X75.269 Y78.653 Z6.2227 A188.6015
+G1 X75.789 Y77.264 Z6.2240 A188.6474
+G1 X76.436 Y75.937 Z6.2253 A188.6939
+G1 X77.217 Y74.697 Z6.2267 A188.7410
+G1 X78.134 Y73.569 Z6.2280 A188.7884
+G1 X79.181 Y72.573 Z6.2293 A188.8360
+G1 X80.348 Y71.725 Z6.2307 A188.8836
+G1 X81.619 Y71.037 Z6.2320 A188.9310
+G1 X82.976 Y70.514 Z6.2333 A188.9781
+G1 X84.396 Y70.153 Z6.2347 A189.0246
+G1 X85.858 Y69.948 Z6.2360 A189.0705
+G1 X87.340 Y69.883 Z6.2373 A189.1157
+G1 X88.820 Y69.938 Z6.2387 A189.1600
+G1 X90.281 Y70.089 Z6.2400 A189.2035
+G1 X91.710 Y70.309 Z6.2413 A189.2461
+G1 X93.097 Y70.569 Z6.2427 A189.2879
+G1 X94.437 Y70.839 Z6.2440 A189.3289
+G1 X95.731 Y71.093 Z6.2453 A189.3693
+G1 X96.984 Y71.306 Z6.2467 A189.4092
+G1 X98.204 Y71.460 Z6.2480 A189.4488
+G1 X99.404 Y71.540 Z6.2493 A189.4881
+G1 X100.596 Y71.540 Z6.2507 A189.5274
+G1 X101.796 Y71.460 Z6.2520 A189.5670
+G1 X103.016 Y71.306 Z6.2533 A189.6069
+G1 X104.269 Y71.093 Z6.2547 A189.6473
+G1 X105.563 Y70.839 Z6.2560 A189.6883
+G1 X106.903 Y70.569 Z6.2573 A189.7301
+G1 X108.290 Y70.309 Z6.2587 A189.7727
+G1 X109.719 Y70.089 Z6.2600 A189.8162
+G1 X111.180 Y69.938 Z6.2613 A189.8605
+G1 X112.660 Y69.883 Z6.2627 A189.9057
+G1 X114.142 Y69.948 Z6.2640 A189.9516
+G1 X115.604 Y70.153 Z6.2653 A189.9981
+G1 X117.024 Y70.514 Z6.2667 A190.0452
+G1 X118.381 Y71.037 Z6.2680 A190.0926
+G1 X119.652 Y71.725 Z6.2693 A190.1402
+G1 X120.819 Y72.573 Z6.2707 A190.1878
+G1 X121.866 Y73.569 Z6.2720 A190.2352
+G1 X122.783 Y74.697 Z6.2733 A190.2823
+G1 X123.564 Y75.937 Z6.2747 A190.3288
+G1 X124.211 Y77.264 Z6.2760 A190.3747
+G1 X124.731 Y78.653 Z6.2773 A190.4199
+G1 X125.136 Y80.077 Z6.2787 A190.4642
+G1 X125.444 Y81.514 Z6.2800 A190.5077
+G1 X125.676 Y82.941 Z6.2813 A190.5503
+G1 X125.857 Y84.340 Z6.2827 A190.5921
+G1 X126.015 Y85.698 Z6.2840 A190.6331
+G1 X126.173 Y87.008 Z6.2853 A190.6735
+G1 X126.358 Y88.265 Z6.2867 A190.7134
+G1 X126.589 Y89.473 Z6.2880 A190.7530
+G1 X126.883 Y90.638 Z6.2893 A190.7923
+G1 X127.251 Y91.772 Z6.2907 A190.8316
+G1 X127.698 Y92.888 Z6.2920 A190.8712
+G1 X128.221 Y94.001 Z6.2933 A190.9111
+G1 X128.811 Y95.127 Z6.2947 A190.9515
+G1 X129.453 Y96.279 Z6.2960 A190.9925
+G1 X130.124 Y97.470 Z6.2973 A191.0343
+G1 X130.799 Y98.709 Z6.2987 A191.0769
+G1 X131.450 Y100.000 Z6.3000 A191.1204
+G0 X0 Y0
+M2
@@ -0,0 +1,47 @@
+#
+# FILE NAME: build_id.cmake - build identity of the converter sources
+#
+# Copyright (c) 2014 Robert K. Parker
+#
+# Now it is in crystalfontz3D
+#
+# This file ("the software") is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License, version 2 as published by the
+# Free Software Foundation. You should have received a copy of the GNU General Public
+# License, version 2 along with the software.  If not, see <http://www.gnu.org/licenses/>.
+#
+# Run by the build_id target (CMakeLists.txt) ahead of every build:
+#
+#   cmake -DSOURCE=<this directory> -DOUTPUT=<build_id.h> -DFLAGS=<compiler and flags> -P build_id.cmake
+#
+# Writes BUILD_ID, the MD5 of FLAGS and of every source and header of the converter,
+# to OUTPUT. The output cache keys its entries on it (output_cache.h), so a cache
+# filled by one build is never handed back by a build that could convert differently.
+# The file is only rewritten when the id changes.
+#
+
+foreach(var SOURCE OUTPUT FLAGS)
+    if(NOT DEFINED ${var})
+        message(FATAL_ERROR "build_id.cmake: ${var} is not set")
+    endif()
+endforeach()
+
+file(GLOB files RELATIVE ${SOURCE} ${SOURCE}/application/*.cpp ${SOURCE}/platform/*.cpp
+     ${SOURCE}/include/*.h ${SOURCE}/settings/*.h)
+list(SORT files)
+
+set(sums "${FLAGS}\n")
+foreach(file ${files})
+    file(MD5 ${SOURCE}/${file} md5)
+    set(sums "${sums}${md5}  ${file}\n")
+endforeach()
+string(MD5 id "${sums}")
+
+set(header "// Generated by build_id.cmake - do not edit\n#define BUILD_ID \"${id}\"\n")
+set(old "")
+if(EXISTS ${OUTPUT})
+    file(READ ${OUTPUT} old)
+endif()
+if(NOT old STREQUAL header)
+    file(WRITE ${OUTPUT} "${header}")
+endif()
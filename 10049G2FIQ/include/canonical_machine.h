@@ -90,6 +90,14 @@ typedef struct cmSingleton {		// struct to manage cm globals and cycles
 	float min_segment_len;			// line drawing resolution in mm
 	float arc_segment_len;			// arc drawing resolution in mm
 	float estd_segment_usec;		// approximate segment time in microseconds
+	float segment_tolerance;		// adaptive head/tail velocity step bound in mm/min (0 = off)
+	uint8_t body_segment_mode;		// BODY_SEGMENT_CHOPPED or BODY_SEGMENT_LONG
+	uint8_t scurve_mode;			// SCURVE_SEGMENTED or SCURVE_STEP_EXACT
+	uint8_t arc_mode;				// ARC_SEGMENTED or ARC_NATIVE
+	float merge_angle;				// largest direction change merged, in degrees (0 = off)
+	float merge_tolerance;			// feed and extrusion rate match for merging, in percent
+	uint8_t arc_fit;				// FIT_ARCS_OFF or FIT_ARCS_ON
+	float fit_tolerance;			// arc fitting deviation from the G code points in mm
 
 	// gcode power-on default settings - defaults are not the same as the gm state
 	uint8_t coord_system;			// G10 active coordinate system default
@@ -687,6 +695,17 @@ stat_t cm_set_jrk(cmdObj_t *cmd);		// set jerk with 1,000,000 correction
 	void cm_print_ml(cmdObj_t *cmd);
 	void cm_print_ma(cmdObj_t *cmd);
 	void cm_print_ms(cmdObj_t *cmd);
+	void cm_print_mb(cmdObj_t *cmd);
+	void cm_print_mc(cmdObj_t *cmd);
+	void cm_print_mp(cmdObj_t *cmd);
+	void cm_print_mn(cmdObj_t *cmd);
+	void cm_print_mg(cmdObj_t *cmd);
+	void cm_print_mf(cmdObj_t *cmd);
+	void cm_print_mw(cmdObj_t *cmd);
+	void cm_print_mx(cmdObj_t *cmd);
+	void cm_print_seg(cmdObj_t *cmd);
+	void cm_print_mrg(cmdObj_t *cmd);
+	void cm_print_fit(cmdObj_t *cmd);
 	void cm_print_st(cmdObj_t *cmd);
 
 	void cm_print_am(cmdObj_t *cmd);		// axis print functions
@@ -741,6 +760,17 @@ stat_t cm_set_jrk(cmdObj_t *cmd);		// set jerk with 1,000,000 correction
 	#define cm_print_ml tx_print_stub
 	#define cm_print_ma tx_print_stub
 	#define cm_print_ms tx_print_stub
+	#define cm_print_mb tx_print_stub
+	#define cm_print_mc tx_print_stub
+	#define cm_print_mp tx_print_stub
+	#define cm_print_mn tx_print_stub
+	#define cm_print_mg tx_print_stub
+	#define cm_print_mf tx_print_stub
+	#define cm_print_mw tx_print_stub
+	#define cm_print_mx tx_print_stub
+	#define cm_print_seg tx_print_stub
+	#define cm_print_mrg tx_print_stub
+	#define cm_print_fit tx_print_stub
 	#define cm_print_st tx_print_stub
 
 	#define cm_print_am tx_print_stub		// axis print functions
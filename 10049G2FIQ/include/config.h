@@ -215,6 +215,7 @@ typedef uint16_t index_t;			// use this if there are > 255 indexed objects
 
 #define NVM_VALUE_LEN 4				// NVM value length (float, fixed length)
 #define NVM_BASE_ADDR 0x0000		// base address of usable NVM
+#define NVM_FSYNC true				// fsync the config file before it replaces the old one
 
 enum tgCommunicationsMode {
 	TEXT_MODE = 0,					// text command line mode
@@ -307,11 +308,20 @@ typedef struct cfgItem {
 	float def_value;					// default value for config item
 } cfgItem_t;
 
+typedef struct nvmImage {				// in-memory copy of the config file
+	uint8_t *buf;						// file contents
+	uint32_t size;						// bytes in buf
+	uint8_t loaded;						// true once the file has been read
+	uint8_t exists;						// true if the config file exists
+	uint8_t dirty;						// true if buf differs from the file
+} nvmImage_t;
+
 /**** static allocation and definitions ****/
 
 extern cmdStr_t cmdStr;
 extern cmdObj_t cmd_list[];
 extern const cfgItem_t cfgArray[];
+extern index_t cmdTokenIndex[];
 
 #define cmd_header cmd_list
 #define cmd_body  (cmd_list+1)
@@ -326,6 +336,7 @@ stat_t cmd_get(cmdObj_t *cmd);			// main entry point for get value
 stat_t cmd_set(cmdObj_t *cmd);			// main entry point for set value
 void cmd_print(cmdObj_t *cmd);			// main entry point for print value
 void cmd_persist(cmdObj_t *cmd);		// main entry point for persistence
+uint64_t cmd_hash_config(void);			// hash of the loaded config values
 
 // helpers
 uint8_t cmd_get_type(cmdObj_t *cmd);
@@ -375,6 +386,7 @@ void cmd_print_list(stat_t status, uint8_t text_flags, uint8_t json_flags);
 
 stat_t cmd_read_NVM_value(cmdObj_t *cmd, index_t index);
 stat_t cmd_write_NVM_value(cmdObj_t *cmd, index_t index);
+stat_t cmd_commit_NVM(void);
 
 /*********************************************************************************************
  **** PLEASE NOTICE THAT CONFIG_APP.H IS HERE ************************************************
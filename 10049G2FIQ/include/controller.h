@@ -73,7 +73,8 @@ typedef struct controllerSingleton {	// main TG controller struct
 	uint8_t network_mode;				// 0=master, 1=repeater, 2=slave
 	uint16_t linelen;					// length of currently processing line
     int lineNumber;                     // The line number inside the Input file
-    int totalLineNumber;                // The total number of lines that the input file has
+    int totalLineNumber;                // The total number of lines that the input file has (-l only)
+	stat_t job_status;					// STAT_OK, or why the G code file was not converted
 
 	// system state variables
 	uint8_t led_state;		// LEGACY	// 0=off, 1=on
@@ -107,6 +108,7 @@ enum cmControllerState {				// manages startup lines
 
 void controller_init(uint8_t std_in, uint8_t std_out, uint8_t std_err);
 void controller_run(void);
+stat_t controller_run_job(uint8_t (*poll)(void));
 //void controller_reset(void);
 
 #ifdef __cplusplus
@@ -0,0 +1,104 @@
+/*
+ * FILE NAME: fiq_stat.h - FIQ file analyzer
+ *
+ * Copyright (c) 2014 Robert K. Parker
+ *
+ * This file was part of the TinyG project
+ *
+ * Copyright (c) 2010 - 2013 Alden S. Hart, Jr.
+ *
+ * Now it is in crystalfontz3D
+ *
+ * This file ("the software") is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2 as published by the
+ * Free Software Foundation. You should have received a copy of the GNU General Public
+ * License, version 2 along with the software.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * THE SOFTWARE IS DISTRIBUTED IN THE HOPE THAT IT WILL BE USEFUL, BUT WITHOUT ANY
+ * WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT
+ * SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+/*
+ * PURPOSE:	Reads back a FIQ file and reports what the FIQ will be asked to do.
+ *
+ *
+ * CHANGE HISTORY:
+ *
+ *    Revision: Initial 1.0
+ *    User: R.K.Parker     Date: 05/29/14
+ *    First prototype.
+ *
+ */
+
+#ifndef FIQ_STAT_H_ONCE
+#define FIQ_STAT_H_ONCE
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*
+ * FIQ file analyzer
+ *
+ *	With -a <file> the converter converts nothing. It reads <file> back as FIQ cells,
+ *	prints a report and exits - 0 if the file read cleanly, 1 if not. -v says the file
+ *	is compressed (QuickLZ packets, as -f <file> -v writes them), and -A <file> reads
+ *	it as legacy 12 byte { timer, clear, set } cells, as 10049G2LEG writes them. "-"
+ *	reads stdin. The report has:
+ *
+ *	  - cells, print time, and cells per second of print time over the print, in up
+ *		to FS_PROFILE_LINES slices with the mean and the busiest second of each
+ *	  - for each motor, its steps, direction changes, shortest step interval and the
+ *		peak step rate that makes, and a histogram of its step intervals in
+ *		power of two bins of FIQ ticks up to 2^FS_BINS
+ *	  - dwells: gaps of FS_DWELL_MS or more with no step on any motor
+ *
+ *	A cell's timer is the ticks to the next cell, and its set word holds the step
+ *	bits and the direction bits of the motors in the move - so a motor's direction
+ *	is only looked at in the cells where it steps. The file is read in FS_READ_LEN
+ *	blocks and each cell is looked at once, so it reads as fast as the disk can.
+ */
+#define FS_READ_LEN (1024*1024)			// raw cells read at a time
+#define FS_BINS 20						// step interval histogram bins - the last takes the rest
+#define FS_DWELL_MS 50					// shortest gap counted as a dwell
+#define FS_PROFILE_LINES 20				// slices of the cell rate profile
+
+typedef struct fsMotor {
+	uint64_t steps;
+	uint64_t dir_changes;				// a step the other way to the one before it
+	uint32_t dir;						// direction bit of the last step
+	uint64_t last_step;					// tick of the last step
+	uint64_t min_interval;				// ticks, 0 until there have been two steps
+	uint64_t hist[FS_BINS];				// step intervals by floor(log2(ticks))
+} fsMotor_t;
+
+typedef struct fsSingleton {
+	uint8_t cell_size;					// bytes - 8, or 12 for legacy cells
+	uint64_t cells;
+	uint64_t ticks;						// print time so far
+	uint64_t last_step;					// tick of the last step of any motor, 0 before the first
+	uint64_t dwells;
+	uint64_t dwell_ticks;
+	fsMotor_t m[MOTOR_6];				// motors 1 to 5 step
+	uint32_t *per_second;				// cells in each second of print time
+	uint32_t seconds;					// seconds allocated
+	uint32_t second;					// second of print time the next cell falls in
+	uint32_t second_cells;				// cells in it so far
+	uint64_t next_second;				// tick the second after it starts at
+	uint8_t carry_len;					// bytes of a cell split between two reads
+	char carry[12];
+} fsSingleton_t;
+
+extern fsSingleton_t fs;
+
+stat_t fs_analyze(const char *path, uint8_t compressed, uint8_t legacy);
+stat_t fs_read(const char *path, uint8_t compressed, uint8_t cell_size, void (*cells)(const char *data, size_t count));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // End of include guard: FIQ_STAT_H_ONCE
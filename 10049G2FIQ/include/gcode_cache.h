@@ -0,0 +1,112 @@
+/*
+ * FILE NAME: gcode_cache.h - pre-parsed G code cache
+ *
+ * Copyright (c) 2014 Robert K. Parker
+ *
+ * This file was part of the TinyG project
+ *
+ * Copyright (c) 2010 - 2013 Alden S. Hart, Jr.
+ *
+ * Now it is in crystalfontz3D
+ *
+ * This file ("the software") is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2 as published by the
+ * Free Software Foundation. You should have received a copy of the GNU General Public
+ * License, version 2 along with the software.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * THE SOFTWARE IS DISTRIBUTED IN THE HOPE THAT IT WILL BE USEFUL, BUT WITHOUT ANY
+ * WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT
+ * SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+/*
+ * PURPOSE:	Saves the lexed words of a G code file, to skip lexing on later runs.
+ *
+ *
+ * CHANGE HISTORY:
+ *
+ *    Revision: Initial 1.0
+ *    User: R.K.Parker     Date: 05/29/14
+ *    First prototype.
+ *
+ */
+
+#ifndef GCODE_CACHE_H_ONCE
+#define GCODE_CACHE_H_ONCE
+
+#include "gcode_parser.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*
+ * Pre-parsed G code cache
+ *
+ *	With -p the first conversion of a G code file writes <file>.g2c next to it: one
+ *	record per input line, holding the words _lex_gcode_block() found, or the line
+ *	text for lines that don't go to the G code parser (config commands, deleted and
+ *	malformed blocks). Later conversions of the same file replay the records and the
+ *	text is never read or lexed again. The words are the raw values of the block -
+ *	units, offsets and all machine config are applied after them - so the cache stays
+ *	good however the config changes.
+ *
+ *	The cache is keyed by the size, modification time and hash of the G code file,
+ *	and by GC_CACHE_VERSION, which must change with the lexer or the record format.
+ */
+#define GC_CACHE_SUFFIX ".g2c"			// cache path is the G code path plus this
+#define GC_CACHE_MAGIC 0x43503247		// "G2PC" - in the native byte order
+#define GC_CACHE_VERSION 1
+#define GC_CACHE_BUFFER_LEN ((size_t)1024*1024)
+
+#define GC_CACHE_TEXT 0xFF				// record type: line text follows (else a word count)
+#define GC_CACHE_END 0xFE				// record type: end of the file
+
+enum gcCacheMode {
+	GC_CACHE_OFF = 0,
+	GC_CACHE_WRITE,						// converting from the text and writing the cache
+	GC_CACHE_READ						// converting from the cache
+};
+
+typedef struct gcCacheHeader {
+	uint32_t magic;						// GC_CACHE_MAGIC
+	uint32_t version;					// GC_CACHE_VERSION
+	uint64_t size;						// of the G code file
+	int64_t mtime_sec;					// modification time of the G code file
+	int64_t mtime_nsec;
+	uint64_t hash;						// xio_hash_gcode() of the G code file
+} gcCacheHeader_t;
+
+typedef struct gcCache {
+	uint8_t mode;						// gcCacheMode
+	int fd;
+	char path[FILE_PATH_NAME_LEN + sizeof(GC_CACHE_SUFFIX)];
+	gcCacheHeader_t header;
+	char *buf;							// write or read-ahead buffer
+	size_t len;							// valid bytes in buf
+	size_t rd;							// read offset in buf
+	uint64_t offset;					// records read so far (for progress)
+	uint64_t file_size;					// size of the cache being read
+	uint8_t eof;						// TRUE once read() has returned end of file
+	uint8_t line_len;					// pending line (writing) - the text...
+	char line[INPUT_BUFFER_LEN];		// ...kept until it is known if its words are wanted
+	uint8_t line_pending;
+} gcCache_t;
+
+extern gcCache_t gcc;
+
+stat_t gc_cache_open(const char *gcode_path);
+void gc_cache_line(const char *line, uint32_t len);
+void gc_cache_block(void);
+stat_t gc_cache_next(char *text, uint32_t *len, const gcWord_t **word, uint8_t *count);
+void gc_cache_block_text(char *buf, size_t size, const gcWord_t *word, uint8_t count);
+int8_t gc_cache_get_percent(void);
+void gc_cache_close(uint8_t complete);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // End of include guard: GCODE_CACHE_H_ONCE
@@ -40,13 +40,32 @@
 extern "C"{
 #endif
 
+#define GC_MAX_WORDS (INPUT_BUFFER_LEN/2)	// a block can't hold more words than half its characters
+
+typedef struct gcWord {				// a parsed word, e.g. X-12.5
+	char letter;					// upper case
+	float value;
+} gcWord_t;
+
 /*
  * Global Scope Functions
  */
 stat_t gc_gcode_parser(char *block);
+stat_t gc_gcode_words(const gcWord_t *word, uint8_t count);
+int16_t gc_get_words(const gcWord_t **word);
 stat_t gc_get_gc(cmdObj_t *cmd);
 stat_t gc_run_gc(cmdObj_t *cmd);
 
+/*** Unit tests ***/
+
+//#define __UNIT_TEST_GCODE	// uncomment to compile in gcode parser unit tests
+#ifdef __UNIT_TEST_GCODE
+void gc_unit_tests(void);
+#define	GCODE_UNITS gc_unit_tests();
+#else
+#define	GCODE_UNITS
+#endif // __UNIT_TEST_GCODE
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,109 @@
+/*
+ * FILE NAME: metrics.h - per job metrics file
+ *
+ * Copyright (c) 2014 Robert K. Parker
+ *
+ * This file was part of the TinyG project
+ *
+ * Copyright (c) 2010 - 2013 Alden S. Hart, Jr.
+ *
+ * Now it is in crystalfontz3D
+ *
+ * This file ("the software") is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2 as published by the
+ * Free Software Foundation. You should have received a copy of the GNU General Public
+ * License, version 2 along with the software.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * THE SOFTWARE IS DISTRIBUTED IN THE HOPE THAT IT WILL BE USEFUL, BUT WITHOUT ANY
+ * WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT
+ * SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+/*
+ * PURPOSE:	Writes a machine readable summary of each conversion job.
+ *
+ *
+ * CHANGE HISTORY:
+ *
+ *    Revision: Initial 1.0
+ *    User: R.K.Parker     Date: 05/29/14
+ *    First prototype.
+ *
+ */
+
+#ifndef METRICS_H_ONCE
+#define METRICS_H_ONCE
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*
+ * Job metrics
+ *
+ *	With -j <file> each G code file converted gets a JSON object written to <file>
+ *	at its end, replacing the last one:
+ *
+ *		version				JM_VERSION - bumped when a field changes meaning
+ *		gcode, fiq			the files converted
+ *		status				"ok", "drift" if the output was verified off its targets
+ *							(-V), or the status message of a failed output write
+ *		cached				true if the output was copied from the output cache (-k);
+ *							only the file and time fields are filled in then
+ *		lines				G code lines read
+ *		blocks				planner blocks (moves) executed
+ *		arcs				G2/G3 arcs; fitted_arcs - moves fitted into arcs ($af)
+ *		segments			runtime segments prepped
+ *		cells				FIQ cells written, in total and with a step for each motor
+ *		ticks, tick_hz		print time in FIQ timer ticks, and ticks per second
+ *		peak_cells, p99_cells  cells in the busiest and the 99th percentile window
+ *							of window_ms of print time - what the FIQ must keep up with
+ *		starved_blocks		blocks that started with nothing queued behind them, so
+ *							were planned to stop at their end
+ *		clamped_moves		times an axis feed rate or arc velocity limit slowed a
+ *							move below its F word
+ *		lookahead_limited_blocks, lookahead_lost_s  blocks slowed by the planner's short
+ *							lookahead and the print time it cost - only with a block
+ *							log (-b, plan_diag.h)
+ *		verified_blocks, verify_off_blocks, verify_max_steps  blocks checked against
+ *							the output read back, those off, and each motor's worst
+ *							miss in steps - only with -V (verify.h)
+ *		wall_s				conversion wall time; stage_ms - self time per stage,
+ *							only in __PROFILE builds (profile.h)
+ *		peak_rss_kb			the converter's peak resident memory so far - the process's,
+ *							so with the job server (-d) the biggest job's
+ *		bytes_in, bytes_out	output before and after compression, and their ratio
+ *
+ *	The file is written to <file>.tmp and renamed, so a reader never sees half of
+ *	one. The cell fields come from a pass over each output buffer before it is
+ *	written, made only when there is a metrics file.
+ */
+#define JM_VERSION 1
+#define JM_WINDOW_MS 10					// window of print time the cell rate is taken over
+
+typedef struct jmSingleton {
+	uint8_t enabled;					// cells are counted - there is a metrics file
+	uint64_t start;						// wall time the job started, ns
+	uint32_t arcs;						// G2/G3 arcs set up
+	uint32_t starved;					// blocks started with an empty queue behind them
+	uint32_t clamped;					// moves slowed by a limit
+	uint64_t cells;
+	uint64_t steps[MOTOR_6];			// cells with a step of each motor - motors 1 to 5 step
+	uint64_t ticks;						// print time so far
+	uint64_t window;					// window the next cell falls in
+	uint32_t window_cells;				// cells in it so far
+} jmSingleton_t;
+
+extern jmSingleton_t jm;
+
+void jm_start(uint8_t enabled);
+void jm_cells(const char *buf, size_t len);
+stat_t jm_write(const char *path, stat_t status, uint8_t cached);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // End of include guard: METRICS_H_ONCE
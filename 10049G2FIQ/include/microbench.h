@@ -0,0 +1,133 @@
+/*
+ * FILE NAME: microbench.h - planner and stepper kernel microbenchmarks
+ *
+ * Copyright (c) 2014 Robert K. Parker
+ *
+ * This file was part of the TinyG project
+ *
+ * Copyright (c) 2010 - 2013 Alden S. Hart, Jr.
+ *
+ * Now it is in crystalfontz3D
+ *
+ * This file ("the software") is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2 as published by the
+ * Free Software Foundation. You should have received a copy of the GNU General Public
+ * License, version 2 along with the software.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * THE SOFTWARE IS DISTRIBUTED IN THE HOPE THAT IT WILL BE USEFUL, BUT WITHOUT ANY
+ * WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT
+ * SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+/*
+ * PURPOSE:	Times the planner and stepper kernels one at a time, on inputs recorded
+ *			from a real conversion.
+ *
+ *
+ * CHANGE HISTORY:
+ *
+ *    Revision: Initial 1.0
+ *    User: R.K.Parker     Date: 05/29/14
+ *    First prototype.
+ *
+ */
+
+#ifndef MICROBENCH_H_ONCE
+#define MICROBENCH_H_ONCE
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*
+ * Kernel microbenchmarks
+ *
+ *	Compiled in by __MICROBENCH, which only the 10049G2_bench target sets (CMakeLists.txt);
+ *	without it MB_RECORD() is empty and nothing here is built. 10049G2_bench takes the
+ *	converter's options, converts the -g file once with its output thrown away, and
+ *	records the inputs each kernel is called with: MB_RECORD() at the top of the kernel
+ *	copies them when recording. Each kernel keeps MB_SAMPLES of its calls, picked at
+ *	random over the whole file with a fixed seed, so every run keeps the same ones -
+ *	except mp_aline(), which keeps its first MB_SAMPLES so each move starts where the
+ *	one before ended.
+ *
+ *	Each kernel is then run over its samples again and again, MB_PASSES passes of at
+ *	least MB_PASS_NS each, and the mean, standard deviation and minimum of the passes'
+ *	ns per call are printed. Kernels that change state have it put back from the sample
+ *	before each call; that time is measured on its own and taken off. The rest is:
+ *
+ *	  - _exec_aline_segment() includes the ik_kinematics() and st_prep_line() it calls
+ *	  - mp_aline() runs with the stepper held off, so it only plans. The queue is
+ *		flushed every MB_ALINE_BATCH calls; each call plans against half that on average
+ *	  - gc_gcode_parser() lexes and checks the block, but doesn't run it
+ *	  - qlz_compress() compresses whole output buffers, streaming as the writer does
+ *
+ *	Build it with codesourcery_toolchain.cmake to time the SOM - the kernels are the
+ *	converter's own, built with its flags.
+ */
+#ifdef __MICROBENCH
+
+#define MB_SAMPLES 4096					// recorded calls kept of each kernel
+#define MB_BUFFERS 8					// recorded output buffers kept for qlz_compress()
+#define MB_PASSES 10
+#define MB_PASS_NS 20000000				// 20 ms
+#define MB_ALINE_BATCH (PLANNER_BUFFER_POOL_SIZE - 2)
+
+enum mbKernel {
+	MB_TRAPEZOID = 0,					// _calculate_trapezoid()
+	MB_JUNCTION,						// _get_junction_vmax()
+	MB_TARGET_VELOCITY,					// _get_target_velocity()
+	MB_ALINE,							// mp_aline()
+	MB_SEGMENT,							// _exec_aline_segment()
+	MB_KINEMATICS,						// ik_kinematics()
+	MB_PREP_LINE,						// st_prep_line()
+	MB_OUTPUT_FIQ,						// _output_to_FIQ()
+	MB_COMPRESS,						// qlz_compress()
+	MB_PARSER,							// gc_gcode_parser()
+	MB_KERNELS							// count of kernels
+};
+
+typedef struct mbSingleton {
+	uint8_t recording;					// the kernels record their inputs
+	uint8_t replaying;					// the kernels are being timed
+	uint64_t calls[MB_KERNELS];			// calls seen while recording
+	uint32_t samples[MB_KERNELS];		// samples kept
+	uint64_t seed;						// picks the samples kept once full
+	volatile float sink;				// results go here so they aren't optimized out
+} mbSingleton_t;
+
+extern mbSingleton_t bench;
+
+#define MB_RECORD(call) if (bench.recording) { call;}
+
+void mb_record_trapezoid(const mpBuf_t *bf);
+void mb_record_junction(const float a_unit[], const float b_unit[]);
+void mb_record_target_velocity(const float Vi, const float L, const mpBuf_t *bf);
+void mb_record_aline(const GCodeState_t *gm_line);
+void mb_record_segment(uint8_t correction_flag);
+void mb_record_kinematics(const float travel[], const float microseconds);
+void mb_record_prep_line(const float steps[], const float microseconds);
+void mb_record_output(const stRunSingleton_t *run, const void *out);
+void mb_record_buffer(const char *buf, size_t len);
+void mb_record_block(const char *block);
+stat_t mb_run(void);
+
+// the kernels' side of it, in their own files
+stat_t mp_bench_exec_aline_segment(uint8_t correction_flag);	// plan_line.cpp
+void st_bench_load(const stRunSingleton_t *run, const void *out);	// stepper.cpp - sets up _output_to_FIQ()
+void st_bench_output_to_FIQ(void);									// stepper.cpp
+uint8_t st_bench_exec_state(uint8_t exec_state);					// stepper.cpp - returns the one it replaces
+
+#else // __MICROBENCH
+
+#define MB_RECORD(call)
+
+#endif // __MICROBENCH
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // End of include guard: MICROBENCH_H_ONCE
@@ -0,0 +1,105 @@
+/*
+ * FILE NAME: output_cache.h - FIQ output cache
+ *
+ * Copyright (c) 2014 Robert K. Parker
+ *
+ * This file was part of the TinyG project
+ *
+ * Copyright (c) 2010 - 2013 Alden S. Hart, Jr.
+ *
+ * Now it is in crystalfontz3D
+ *
+ * This file ("the software") is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2 as published by the
+ * Free Software Foundation. You should have received a copy of the GNU General Public
+ * License, version 2 along with the software.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * THE SOFTWARE IS DISTRIBUTED IN THE HOPE THAT IT WILL BE USEFUL, BUT WITHOUT ANY
+ * WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT
+ * SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+/*
+ * PURPOSE:	Keeps the FIQ output of past conversions, to hand it back without converting.
+ *
+ *
+ * CHANGE HISTORY:
+ *
+ *    Revision: Initial 1.0
+ *    User: R.K.Parker     Date: 05/29/14
+ *    First prototype.
+ *
+ */
+
+#ifndef OUTPUT_CACHE_H_ONCE
+#define OUTPUT_CACHE_H_ONCE
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*
+ * FIQ output cache
+ *
+ *	With -k <dir> every completed conversion leaves a copy of its output file in
+ *	<dir>, named by a hash of everything the output depends on:
+ *
+ *		- the G code file contents (xio_hash_gcode())
+ *		- the machine config after the config file is loaded (cmd_hash_config())
+ *		- the converter build: BUILD_ID, a hash of its sources and compiler flags
+ *		  made by build_id.cmake. The firmware build and version in the config (fb,
+ *		  fv) are TinyG's and don't change with the converter
+ *		- the output format: compressed or not, and OC_FORMAT
+ *
+ *	A later conversion with the same hash copies the kept file to the output and
+ *	does not convert at all. The directory is held under the -K size limit by
+ *	removing the least recently used entries; a hit touches its entry.
+ *
+ *	Any change to the sources starts a new set of entries, so a planner or stepper
+ *	fix is never answered with output from before it. OC_FORMAT must still change
+ *	whenever the FIQ cells or their stream format change.
+ */
+#define OC_FORMAT 1						// 8 byte FIQ cells, QuickLZ packets when compressed
+#define OC_SUFFIX ".fiq"
+#define OC_TEMP ".tmp"
+#define OC_DEFAULT_LIMIT 1024			// MB kept in the cache directory, if no -K
+#define OC_PATH_LEN (FILE_PATH_NAME_LEN + 40)	// dir + "/" + 16 hex digits + suffixes
+#define OC_TEMP_LEN (OC_PATH_LEN + 12 + sizeof(OC_TEMP))	// + "." pid OC_TEMP
+
+enum ocCacheMode {
+	OC_CACHE_OFF = 0,
+	OC_CACHE_HIT,						// copying a kept output
+	OC_CACHE_FILL						// converting, and keeping a copy of the output
+};
+
+typedef struct ocKey {					// hashed into the entry name - no padding
+	uint64_t gcode_hash;
+	uint64_t gcode_size;
+	uint64_t config_hash;
+	uint64_t build_hash;				// hash of BUILD_ID
+	uint32_t format;					// OC_FORMAT
+	uint32_t compress;
+} ocKey_t;
+
+typedef struct ocCache {
+	uint8_t mode;						// ocCacheMode
+	int fd;								// the hit entry, or the entry being filled
+	uint64_t limit;						// bytes kept in the directory
+	char dir[FILE_PATH_NAME_LEN];
+	char path[OC_PATH_LEN];				// the entry
+	char temp[OC_TEMP_LEN];				// the entry while it is filled
+} ocCache_t;
+
+extern ocCache_t occ;
+
+stat_t oc_open(const char *dir, uint64_t limit_mb, uint8_t compress);
+stat_t oc_copy(void);
+void oc_close(uint8_t complete);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // End of include guard: OUTPUT_CACHE_H_ONCE
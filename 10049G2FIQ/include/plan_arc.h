@@ -42,6 +42,14 @@ extern "C"{
 
 // See planner.h for MM_PER_ARC_SEGMENT setting
 
+/* ARC_ANCHOR_SEGMENTS
+ *	Arc points are generated by rotating the previous point through segment_theta
+ *	(a rotation matrix recurrence) instead of calling sin() and cos() per segment.
+ *	Every ARC_ANCHOR_SEGMENTS segments the point is recomputed exactly from theta
+ *	so the rounding drift of the recurrence stays bounded.
+ */
+#define ARC_ANCHOR_SEGMENTS 16
+
 typedef struct arArcSingleton {	// persistent planner and runtime variables
 	magic_t magic_start;
 	uint8_t run_state;			// runtime state machine sequence
@@ -65,6 +73,10 @@ typedef struct arArcSingleton {	// persistent planner and runtime variables
 	float segment_linear_travel;// linear motion per segment
 	float center_1;				// center of circle at axis 1 (typ X)
 	float center_2;				// center of circle at axis 2 (typ Y)
+	float sin_theta;			// sin and cos of theta, advanced by the recurrence
+	float cos_theta;
+	float sin_segment;			// sin and cos of segment_theta
+	float cos_segment;
 
 	GCodeState_t gm;			// Gcode state struct is passed for each arc segment. Usage:
 //	uint32_t linenum;			// line number of the arc feed move - same for each segment
@@ -0,0 +1,121 @@
+/*
+ * FILE NAME: plan_diag.h - planner lookahead diagnostics
+ *
+ * Copyright (c) 2014 Robert K. Parker
+ *
+ * This file was part of the TinyG project
+ *
+ * Copyright (c) 2010 - 2013 Alden S. Hart, Jr.
+ *
+ * Now it is in crystalfontz3D
+ *
+ * This file ("the software") is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2 as published by the
+ * Free Software Foundation. You should have received a copy of the GNU General Public
+ * License, version 2 along with the software.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * THE SOFTWARE IS DISTRIBUTED IN THE HOPE THAT IT WILL BE USEFUL, BUT WITHOUT ANY
+ * WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT
+ * SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+/*
+ * PURPOSE: planner lookahead diagnostics - the print time lost to a short planning queue.
+ *
+ *
+ * CHANGE HISTORY:
+ *
+ *    Revision: Initial 1.0
+ *    User: R.K.Parker     Date: 05/29/14
+ *    First prototype.
+ *
+ */
+
+#ifndef PLAN_DIAG_H_ONCE
+#define PLAN_DIAG_H_ONCE
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/* Lookahead diagnostics
+ *	_plan_block_list() only sees the blocks queued when it runs. A block whose
+ *	successor is not queued yet is planned to stop at its end, and one with a few
+ *	short successors is planned to slow for the end of those. Either way it runs
+ *	slower than the machine's limits allow, and nothing says so.
+ *
+ *	With -b <file> each block is recorded as it starts to execute, with the entry,
+ *	cruise and exit velocities it was planned to and its entry_vmax, cruise_vmax and
+ *	exit_vmax. At the end of the G code file the whole job is replanned with unlimited
+ *	lookahead - the same junction, cruise and jerk limits, but every block in view -
+ *	and each block is compared with its replan:
+ *
+ *	  - a block whose exit was planned more than DIAG_TOLERANCE percent below the
+ *		replan's is flagged as lookahead limited (L). The rest are held to their
+ *		velocities by physics - corners, feed rates, jerk and stops
+ *	  - the difference between its planned time and the replan's is the time the
+ *		short lookahead cost. Commands and dwells are stops in both plans
+ *
+ *	<file> gets a line per block and a summary, which is also printed and put in the
+ *	metrics file (-j). Velocities are in mm/min, times in ms. The records are kept
+ *	in memory until the end of the file, 56 bytes a block.
+ */
+#define DIAG_TOLERANCE			((float)1)			// percent
+#define DIAG_CHUNK				4096				// records allocated at a time
+
+enum diagFlags {
+	DIAG_HOLD = 0x01,					// a command or dwell - a stop between blocks
+	DIAG_STARVED = 0x02,				// nothing was queued behind the block as it started
+	DIAG_ARC = 0x04,					// native arc
+	DIAG_EXACT_STOP = 0x08,				// G61 - planned to stop at both ends
+	DIAG_LIMITED = 0x10					// lookahead limited - found by the replan
+};
+
+typedef struct mpDiagBlock {
+	uint32_t line;						// G code file line
+	uint8_t flags;						// diagFlags
+	float length;
+	float jerk;
+	float entry_velocity;				// as planned when the block started
+	float cruise_velocity;
+	float exit_velocity;
+	float entry_vmax;
+	float cruise_vmax;
+	float exit_vmax;
+	float junction_vmax;				// limit at the junction with the block before
+	float time;							// minutes, as planned
+	float ideal_exit;					// exit velocity of the replan
+	float ideal_time;					// minutes, in the replan
+} mpDiagBlock_t;
+
+typedef struct mpDiagSingleton {
+	uint8_t enabled;					// recording - there is a block log
+	uint8_t after_hold;					// the last record was a hold, or there is none
+	float unit[AXES];					// exit direction of the last block
+	float cruise_vmax;					// ...its cruise limit
+	uint8_t exact_stop;					// ...and TRUE if it was an exact stop
+	uint32_t blocks;					// records in use
+	uint32_t size;						// records allocated
+	uint8_t failed;						// a record could not be allocated
+	mpDiagBlock_t *block;
+
+	uint32_t total_limited;				// lookahead limited blocks (statistics)
+	float total_time;					// seconds, as planned
+	float total_lost;					// seconds lost to lookahead
+} mpDiag_t;
+extern mpDiag_t diag;
+
+// function prototypes (see planner.h for others)
+
+void mp_diag_start(uint8_t enabled);
+void mp_diag_block(const mpBuf_t *bf);
+void mp_diag_hold(void);
+stat_t mp_diag_finish(const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // End of include Guard: PLAN_DIAG_H_ONCE
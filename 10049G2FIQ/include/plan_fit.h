@@ -0,0 +1,104 @@
+/*
+ * FILE NAME: plan_fit.h - arc fitting of short moves ahead of the planner
+ *
+ * Copyright (c) 2014 Robert K. Parker
+ *
+ * This file was part of the TinyG project
+ *
+ * Copyright (c) 2010 - 2013 Alden S. Hart, Jr.
+ *
+ * Now it is in crystalfontz3D
+ *
+ * This file ("the software") is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2 as published by the
+ * Free Software Foundation. You should have received a copy of the GNU General Public
+ * License, version 2 along with the software.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * THE SOFTWARE IS DISTRIBUTED IN THE HOPE THAT IT WILL BE USEFUL, BUT WITHOUT ANY
+ * WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT
+ * SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+/*
+ * PURPOSE: arc fitting of short moves ahead of the planner.
+ *
+ *
+ * CHANGE HISTORY:
+ *
+ *    Revision: Initial 1.0
+ *    User: R.K.Parker     Date: 05/29/14
+ *    First prototype.
+ *
+ */
+
+#ifndef PLAN_FIT_H_ONCE
+#define PLAN_FIT_H_ONCE
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/* ARC_FIT	Arc fitting of short moves
+ *	Curved perimeters come from slicers as chains of short G1 chords, and every
+ *	chord corner costs a junction velocity limit and a planner block. With arc
+ *	fitting on ($mw) chains of G1 moves in a constant Z are fitted to circular arcs
+ *	and each arc is queued as one native arc block (mp_arc()), so it is planned and
+ *	run as a continuous curve. A chain is taken as an arc while:
+ *
+ *	  - every point and every chord midpoint is within FIT_TOLERANCE ($mx) of the
+ *		circle through the first, middle and last points
+ *	  - it turns one way, by less than a full circle, with a radius no more than
+ *		FIT_MAX_RADIUS (straight runs are left to merging - see plan_merge.h)
+ *	  - the feed rate, and the A, B and C travel per XY mm (the extrusion rate),
+ *		stay within $mf percent of the first move's
+ *
+ *	FIT_TOLERANCE is the fitted arc's deviation from the path the G code gives, so
+ *	keep it well under the extrusion width - 0.02 mm is below what a printer shows.
+ *	It is not the chordal tolerance ($ct): that sets how far the chords of a G2/G3
+ *	arc may cut inside it, and is far tighter than the chords slicers write.
+ *
+ *	Chains of fewer than FIT_MIN_MOVES moves go on as lines. The arc block ends at
+ *	the last target and takes the sum of the move times; the A, B and C axes move
+ *	linearly along it, so extruder travel is kept exactly.
+ *
+ *	Arcs are fitted in double precision: the circle through three close points is
+ *	badly conditioned in float.
+ */
+#define FIT_ARCS_OFF			0
+#define FIT_ARCS_ON				1
+#define ARC_FIT					FIT_ARCS_OFF
+#define FIT_TOLERANCE			((float)0.02)		// millimeters
+#define FIT_MIN_MOVES			4
+#define FIT_MAX_MOVES			64
+#define FIT_MAX_RADIUS			((double)1000)		// millimeters
+
+typedef struct mpFitSingleton {		// the chain being fitted
+	uint8_t count;				// moves in the chain
+	uint8_t emitting;			// TRUE while the chain is being queued
+	float start[AXES];			// where the chain starts
+	double center[2];			// XY circle of the last fit
+	double radius;
+	double theta;				// of the start point - see _get_theta() in plan_arc.cpp
+	double angular_travel;		// +CW, -CCW
+	uint32_t total_fitted;		// moves fitted into arcs (statistics)
+	uint32_t total_arcs;		// arcs queued (statistics)
+
+	GCodeState_t move[FIT_MAX_MOVES];	// the moves - targets are the chain points
+} mpFit_t;
+extern mpFit_t fit;
+
+// function prototypes (see planner.h for others)
+
+stat_t mp_fit_aline(const GCodeState_t *gm_line);
+void mp_fit_flush(void);
+void mp_fit_reset(void);
+uint32_t mp_get_total_fitted(void);
+uint32_t mp_get_total_arcs(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // End of include Guard: PLAN_FIT_H_ONCE
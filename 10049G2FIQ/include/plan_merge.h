@@ -0,0 +1,87 @@
+/*
+ * FILE NAME: plan_merge.h - collinear move merging ahead of the planner
+ *
+ * Copyright (c) 2014 Robert K. Parker
+ *
+ * This file was part of the TinyG project
+ *
+ * Copyright (c) 2010 - 2013 Alden S. Hart, Jr.
+ *
+ * Now it is in crystalfontz3D
+ *
+ * This file ("the software") is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2 as published by the
+ * Free Software Foundation. You should have received a copy of the GNU General Public
+ * License, version 2 along with the software.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * THE SOFTWARE IS DISTRIBUTED IN THE HOPE THAT IT WILL BE USEFUL, BUT WITHOUT ANY
+ * WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT
+ * SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+/*
+ * PURPOSE: collinear move merging ahead of the planner.
+ *
+ *
+ * CHANGE HISTORY:
+ *
+ *    Revision: Initial 1.0
+ *    User: R.K.Parker     Date: 05/29/14
+ *    First prototype.
+ *
+ */
+
+#ifndef PLAN_MERGE_H_ONCE
+#define PLAN_MERGE_H_ONCE
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/* MERGE_ANGLE, MERGE_TOLERANCE	Collinear move merging
+ *	Slicers cut straight and gently curved paths into runs of tiny G1 moves, each
+ *	of which would be planned and run on its own. With merging on, a G0/G1 move is
+ *	held back and the following moves are folded into it while:
+ *
+ *	  - the direction (XYZ) changes by no more than MERGE_ANGLE degrees per move
+ *	  - every folded-in corner stays within the chordal tolerance ($ct) of the
+ *		merged line, and at most MERGE_MAX_VERTICES corners are folded in
+ *	  - the feed rate, and the A, B and C travel per XYZ mm (the extrusion rate),
+ *		stay within MERGE_TOLERANCE percent of the merged move's
+ *	  - nothing else is queued in between (commands, dwells, arcs)
+ *
+ *	The merged move ends at the last target, so A travel is kept exactly, and takes
+ *	the sum of the move times. MERGE_ANGLE of 0 turns merging off. Set at runtime
+ *	with $mg and $mf.
+ */
+#define MERGE_ANGLE				((float)0)			// degrees, 0 = off
+#define MERGE_TOLERANCE			((float)5)			// percent
+#define MERGE_MAX_VERTICES		32
+
+typedef struct mpMergeSingleton {	// the move being merged
+	uint8_t pending;			// TRUE if a move is held back
+	uint8_t vertices;			// corners folded into it so far
+	float vertex[MERGE_MAX_VERTICES][3];	// ...their XYZ, to check against the merged line
+	float unit[3];				// XYZ direction of the last move folded in
+	float xyz_length;			// XYZ length of the merged move
+	uint32_t total_merged;		// moves folded into another (statistics)
+
+	GCodeState_t gm;			// the merged move - target is the last target
+} mpMerge_t;
+extern mpMerge_t merge;
+
+// function prototypes (see planner.h for others)
+
+stat_t mp_merge_aline(const GCodeState_t *gm_line);
+void mp_merge_flush(void);
+void mp_merge_reset(void);
+uint32_t mp_get_total_merged(void);
+uint8_t mp_within_merge_tolerance(const float a, const float b);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // End of include Guard: PLAN_MERGE_H_ONCE
@@ -54,6 +54,7 @@ extern "C"{
 enum moveType {				// bf->move_type values 
 	MOVE_TYPE_NULL = 0,		// null move - does a no-op
 	MOVE_TYPE_ALINE,		// acceleration planned line
+	MOVE_TYPE_CURVE,		// step-exact S-curve section (stepper prep only)
 	MOVE_TYPE_DWELL,		// delay with no movement
 	MOVE_TYPE_COMMAND,		// general command
 	MOVE_TYPE_TOOL,			// T command
@@ -97,6 +98,42 @@ enum moveState {
 #define NOM_SEGMENT_USEC 		((float)5000)		// nominal segment time
 #define MIN_SEGMENT_USEC 		((float)2500)		// minimum segment time
 #define MIN_ARC_SEGMENT_USEC	((float)10000)		// minimum arc segment time
+
+/* BODY_SEGMENT_MODE	How the cruise (body) section of a move is segmented
+ *	BODY_SEGMENT_CHOPPED chops the body into estd_segment_usec pieces so feedholds
+ *	have low latency. BODY_SEGMENT_LONG runs the body as the fewest segments the
+ *	DDA accumulators can hold (DDA_MAX_SEGMENT_USEC), which is all the offline
+ *	converter needs. Set at runtime with $mb.
+ */
+#define BODY_SEGMENT_CHOPPED	0
+#define BODY_SEGMENT_LONG		1
+#define BODY_SEGMENT_MODE		BODY_SEGMENT_CHOPPED
+
+/* SCURVE_MODE	How head and tail (acceleration) sections are executed
+ *	SCURVE_SEGMENTED approximates each half of the S-curve with constant-velocity
+ *	segments from the forward differences. SCURVE_STEP_EXACT runs each half as one
+ *	curve section and times every step from the jerk polynomial (st_prep_curve()).
+ *	Set at runtime with $mc.
+ */
+#define SCURVE_SEGMENTED		0
+#define SCURVE_STEP_EXACT		1
+#define SCURVE_MODE				SCURVE_SEGMENTED
+
+/* SEGMENT_TOLERANCE	Adaptive head and tail segmentation
+ *	Largest velocity step (mm/min) between the constant-velocity segments of a head
+ *	or tail, i.e. how far a segment may stray from the ideal S-curve velocity.
+ *	Zero uses fixed estd_segment_usec segments. Set at runtime with $mp.
+ */
+#define SEGMENT_TOLERANCE		((float)0)
+
+/* ARC_MODE	How G2/G3 arcs reach the runtime
+ *	ARC_SEGMENTED queues every arc segment as its own line (cm_arc_callback()).
+ *	ARC_NATIVE queues the whole arc as a single planner block (mp_arc()) and the
+ *	runtime places each segment on the arc itself. Set at runtime with $mn.
+ */
+#define ARC_SEGMENTED			0
+#define ARC_NATIVE				1
+#define ARC_MODE				ARC_SEGMENTED
 #define NOM_SEGMENT_TIME 		(MIN_SEGMENT_USEC / MICROSECONDS_PER_MINUTE)
 #define MIN_SEGMENT_TIME 		(MIN_SEGMENT_USEC / MICROSECONDS_PER_MINUTE)
 #define MIN_ARC_SEGMENT_TIME 	(MIN_ARC_SEGMENT_USEC / MICROSECONDS_PER_MINUTE)
@@ -184,6 +221,17 @@ typedef struct mpBuffer {		// See Planning Velocity Notes for variable usage
 	float recip_jerk;			// 1/Jm used for planning (compute-once)
 	float cbrt_jerk;			// cube root of Jm used for planning (compute-once)
 
+	uint8_t arc_flag;			// TRUE if this block is a native arc (mp_arc())
+	uint8_t arc_axis_1;			// arc plane axes
+	uint8_t arc_axis_2;
+	float arc_center[2];		// center of circle on arc_axis_1 and arc_axis_2
+	float arc_radius;
+	float arc_theta;			// starting angle (see plan_arc.cpp)
+	float arc_angular_travel;	// radians along arc (+CW, -CCW)
+	float arc_chord;			// longest segment that keeps chordal tolerance
+
+	uint32_t line;				// G code file line the block was planned at (plan_diag.cpp)
+
 	GCodeState_t gm;			// Gode model state - passed from model, used by planner and runtime
 
 } mpBuf_t;
@@ -242,6 +290,21 @@ typedef struct mpMoveRuntimeSingleton {	// persistent runtime variables
 	float forward_diff_1;		// forward difference level 1 (Acceleration)
 	float forward_diff_2;		// forward difference level 2 (Jerk - constant)
 
+	uint8_t arc_flag;			// copies of bf arc variables of same name
+	uint8_t arc_axis_1;
+	uint8_t arc_axis_2;
+	float arc_center[2];
+	float arc_radius;
+	float arc_theta;
+	float arc_angular_travel;
+	float arc_chord;
+	float arc_travel;			// path length run so far on a native arc
+
+	uint32_t move_segments;		// segments prepped so far for the running move
+	uint32_t last_move_segments;// segments prepped for the last completed move
+	uint32_t total_segments;	// segments prepped for all moves (statistics)
+	uint32_t total_moves;		// moves completed (statistics)
+
 	GCodeState_t gm;			// gocode model state currently executing
 
 	magic_t magic_end;
@@ -270,6 +333,8 @@ stat_t mp_dwell(const float seconds);
 void mp_end_dwell(void);
 
 stat_t mp_aline(const GCodeState_t *gm_line);
+stat_t mp_arc(const GCodeState_t *gm_arc, const float center[], const float radius, const float theta,
+			  const float angular_travel, const uint8_t axis_1, const uint8_t axis_2);
 
 stat_t mp_plan_hold_callback(void);
 stat_t mp_end_hold(void);
@@ -278,6 +343,7 @@ stat_t mp_feed_rate_override(uint8_t flag, float parameter);
 // planner buffer handlers
 void mp_init_buffers(void);
 uint8_t mp_get_planner_buffers_available(void);
+uint8_t mp_get_planner_buffers_in_use(void);
 void mp_clear_buffer(mpBuf_t *bf); 
 void mp_copy_buffer(mpBuf_t *bf, const mpBuf_t *bp);
 void mp_queue_write_buffer(const uint8_t move_type);
@@ -291,11 +357,16 @@ mpBuf_t * mp_get_last_buffer(void);
 
 // plan_line.c functions
 float mp_get_runtime_velocity(void);
+uint32_t mp_get_total_segments(void);
+uint32_t mp_get_total_moves(void);
 float mp_get_runtime_work_position(uint8_t axis);
 float mp_get_runtime_absolute_position(uint8_t axis);
 void mp_set_runtime_work_offset(float offset[]);
 void mp_zero_segment_velocity(void);
 uint8_t mp_get_runtime_busy(void);
+float mp_get_junction_vmax(const float a_unit[], const float b_unit[]);
+float mp_get_target_velocity(const float Vi, const float L, const mpBuf_t *bf);
+void mp_calculate_trapezoid(mpBuf_t *bf);
 
 #ifdef __DEBUG
 void mp_dump_running_plan_buffer(void);
@@ -309,7 +380,7 @@ void mp_dump_runtime_state(void);
 #ifdef __UNIT_TEST_PLANNER
 void mp_unit_tests(void);
 void mp_plan_arc_unit_tests(void);
-#define	PLANNER_UNITS mp_unit_tests();
+#define	PLANNER_UNITS mp_unit_tests(); mp_plan_arc_unit_tests();
 #else
 #define	PLANNER_UNITS
 #endif // end __UNIT_TEST_PLANNER
@@ -0,0 +1,129 @@
+/*
+ * FILE NAME: profile.h - conversion stage timing
+ *
+ * Copyright (c) 2014 Robert K. Parker
+ *
+ * This file was part of the TinyG project
+ *
+ * Copyright (c) 2010 - 2013 Alden S. Hart, Jr.
+ *
+ * Now it is in crystalfontz3D
+ *
+ * This file ("the software") is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2 as published by the
+ * Free Software Foundation. You should have received a copy of the GNU General Public
+ * License, version 2 along with the software.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * THE SOFTWARE IS DISTRIBUTED IN THE HOPE THAT IT WILL BE USEFUL, BUT WITHOUT ANY
+ * WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT
+ * SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+/*
+ * PURPOSE:	Times each stage of the conversion, to show where the time goes.
+ *
+ *
+ * CHANGE HISTORY:
+ *
+ *    Revision: Initial 1.0
+ *    User: R.K.Parker     Date: 05/29/14
+ *    First prototype.
+ *
+ */
+
+#ifndef PROFILE_H_ONCE
+#define PROFILE_H_ONCE
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*
+ * Stage timing
+ *
+ *	Compiled in by __PROFILE, which cmake -DPROFILE=ON sets (CMakeLists.txt); without
+ *	it PROF_SCOPE() is empty and nothing here is built. PROF_SCOPE(stage) at the top
+ *	of a function times the function as that stage until it returns.
+ *
+ *	Stages call each other - the parser runs the canonical machine, which plans,
+ *	executes and steps the move before it returns, and _load_move() recurses
+ *	through st_request_exec_move() to the next segment. So each stage is charged
+ *	its self time only: time in a stage it calls is charged to that stage. The
+ *	stages' times add up to the run time, the rest being PROF_CONTROLLER.
+ *
+ *	Each stage keeps a call count, its total and longest self time and a histogram
+ *	of self time per call in power of 2 ns bins, for percentiles. The times come
+ *	from CLOCK_MONOTONIC. They are reset as each G code file is opened, printed at
+ *	its end, printed by $prof and reset by $prof=0.
+ */
+#ifdef __PROFILE
+
+enum profStage {
+	PROF_CONTROLLER = 0,				// reading lines and anything outside the other stages
+	PROF_PARSER,						// gc_gcode_parser(), gc_gcode_words()
+	PROF_CANONICAL,						// _execute_gcode_block() - the cm_* calls of a block
+	PROF_PLAN_LINE,						// mp_aline()
+	PROF_PLAN_BLOCKS,					// _plan_block_list()
+	PROF_EXEC_MOVE,						// mp_exec_move()
+	PROF_KINEMATICS,					// ik_kinematics()
+	PROF_PREP_LINE,						// st_prep_line()
+	PROF_OUTPUT_FIQ,					// _output_to_FIQ(), _load_curve() - making the cells
+	PROF_COMPRESS,						// qlz_compress() of an output buffer
+	PROF_WRITE,							// writing the output
+	PROF_STAGES							// count of stages
+};
+
+#define PROF_BINS 32					// histogram bins - bin n counts calls of 2^n to 2^(n+1) ns
+#define PROF_DEPTH 1024					// stage nesting tracked; deeper calls are charged to the caller
+
+typedef struct profStat {
+	uint64_t calls;
+	uint64_t ns;						// self time, total
+	uint64_t max_ns;					// self time, longest call
+	uint32_t hist[PROF_BINS];			// self time per call
+} profStat_t;
+
+typedef struct profSingleton {
+	uint64_t start;						// time of the last reset
+	uint64_t mark;						// time the current slice of stage[depth] began
+	uint16_t depth;						// stage[0] is PROF_CONTROLLER and is never left
+	uint16_t max_depth;
+	uint32_t untracked;					// calls running past PROF_DEPTH
+	uint64_t untracked_calls;
+	uint8_t stage[PROF_DEPTH];
+	uint64_t self[PROF_DEPTH];			// self time of each open call so far
+	profStat_t stat[PROF_STAGES];
+} profSingleton_t;
+
+extern profSingleton_t prof;
+
+void prof_enter(uint8_t stage);
+void prof_exit(void);
+void prof_reset(void);
+void prof_print(void);
+const char *prof_stage_name(uint8_t stage);
+uint64_t prof_stage_ns(uint8_t stage);
+stat_t prof_get(cmdObj_t *cmd);
+stat_t prof_set(cmdObj_t *cmd);
+
+#ifdef __cplusplus
+struct profScope {						// times the enclosing block
+	profScope(uint8_t stage) { prof_enter(stage);}
+	~profScope() { prof_exit();}
+};
+#define PROF_SCOPE(stage) profScope _prof_scope(stage)
+#endif
+
+#else // __PROFILE
+
+#define PROF_SCOPE(stage)
+
+#endif // __PROFILE
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // End of include guard: PROFILE_H_ONCE
@@ -0,0 +1,110 @@
+/*
+ * FILE NAME: server.h - conversion job server
+ *
+ * Copyright (c) 2014 Robert K. Parker
+ *
+ * This file was part of the TinyG project
+ *
+ * Copyright (c) 2010 - 2013 Alden S. Hart, Jr.
+ *
+ * Now it is in crystalfontz3D
+ *
+ * This file ("the software") is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2 as published by the
+ * Free Software Foundation. You should have received a copy of the GNU General Public
+ * License, version 2 along with the software.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * THE SOFTWARE IS DISTRIBUTED IN THE HOPE THAT IT WILL BE USEFUL, BUT WITHOUT ANY
+ * WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT
+ * SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+/*
+ * PURPOSE:	Keeps the converter running between jobs, taking them on a UNIX socket.
+ *
+ *
+ * CHANGE HISTORY:
+ *
+ *    Revision: Initial 1.0
+ *    User: R.K.Parker     Date: 05/29/14
+ *    First prototype.
+ *
+ */
+
+#ifndef SERVER_H_ONCE
+#define SERVER_H_ONCE
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*
+ * Job server
+ *
+ *	With -d <socket> the converter does not convert a file and exit. It listens on
+ *	a UNIX stream socket and runs the jobs it is sent one at a time, in the order
+ *	they came. Requests and records are lines of text:
+ *
+ *		job <options>		queue a conversion; the options are the command line's
+ *							-g <gcode> -f <fiq> [-j <metrics>] [-b <block log>] [-v] [-l] [-p] [-V] [-k <dir>] [-K <MB>]
+ *							and default to the server's own. Replies "queued <id>"
+ *		cancel <id>			drop a queued job, or stop the running one
+ *		quit				finish the running job, drop the queue and exit
+ *
+ *	The client that queued a job is sent its records:
+ *
+ *		started <id>
+ *		progress <id> <line> <percent>	every 256 lines; percent is -1 if unknown
+ *		done <id> <segments> <moves>
+ *		failed <id> <status message>
+ *		cancelled <id>
+ *
+ *	Each job starts from the context the last one left: the config is reloaded from
+ *	its in-memory image and the planner, machine and steppers are re-initialized,
+ *	so a job's output is the same as a separate run's. Requests are read while a
+ *	job runs, every 256 lines.
+ *
+ *	A job writes whatever paths it names with the server's rights, so the socket is
+ *	made SRV_SOCKET_MODE - only the server's user can connect - before it listens.
+ */
+#define SRV_SOCKET_MODE 0600			// owner only
+#define SRV_MAX_CLIENTS 8				// connected clients
+#define SRV_MAX_JOBS 32					// queued jobs, not counting the running one
+#define SRV_LINE_LEN 1536				// a request - room for five paths and options
+#define SRV_MAX_ARGS 16					// words in a job's options
+
+typedef struct srvClient {
+	int fd;								// -1 if the slot is free
+	uint16_t len;						// bytes of a partial request in buf
+	char buf[SRV_LINE_LEN];
+} srvClient_t;
+
+typedef struct srvJob {
+	uint32_t id;
+	int8_t client;						// client to send records to, or -1 if it has gone
+	char options[SRV_LINE_LEN];
+} srvJob_t;
+
+typedef struct srvSingleton {
+	int fd;								// listening socket
+	uint32_t next_id;
+	uint8_t quit;						// exit after the running job
+	uint8_t cancel;						// stop the running job
+	uint8_t running;					// true while a job is converted
+	srvJob_t job;						// the running job
+	uint8_t jobs;						// count of queued jobs
+	srvJob_t queue[SRV_MAX_JOBS];		// queued jobs, oldest first
+	srvClient_t client[SRV_MAX_CLIENTS];
+} srvSingleton_t;
+
+extern srvSingleton_t srv;
+
+stat_t server_run(const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // End of include guard: SERVER_H_ONCE
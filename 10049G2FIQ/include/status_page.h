@@ -0,0 +1,109 @@
+/*
+ * FILE NAME: status_page.h - shared memory status page
+ *
+ * Copyright (c) 2014 Robert K. Parker
+ *
+ * This file was part of the TinyG project
+ *
+ * Copyright (c) 2010 - 2013 Alden S. Hart, Jr.
+ *
+ * Now it is in crystalfontz3D
+ *
+ * This file ("the software") is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2 as published by the
+ * Free Software Foundation. You should have received a copy of the GNU General Public
+ * License, version 2 along with the software.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * THE SOFTWARE IS DISTRIBUTED IN THE HOPE THAT IT WILL BE USEFUL, BUT WITHOUT ANY
+ * WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT
+ * SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+/*
+ * PURPOSE:	Publishes the converter's state in a shared memory page for the UI to poll.
+ *
+ *
+ * CHANGE HISTORY:
+ *
+ *    Revision: Initial 1.0
+ *    User: R.K.Parker     Date: 05/29/14
+ *    First prototype.
+ *
+ */
+
+#ifndef STATUS_PAGE_H_ONCE
+#define STATUS_PAGE_H_ONCE
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*
+ * Status page
+ *
+ *	With -m <file> the converter maps <file> (best put in /dev/shm) shared and
+ *	keeps an spPage_t at its start up to date: once per G code line, at the end
+ *	of each file and for each error response. Updating it is a few stores - no
+ *	system calls - so it costs nothing noticeable per line.
+ *
+ *	The page is a seqlock. The writer makes seq odd, writes the fields, then makes
+ *	seq even again. A reader copies the page and keeps the copy only if seq was
+ *	even and unchanged around the copy:
+ *
+ *		do {
+ *			seq = __atomic_load_n(&page->seq, __ATOMIC_ACQUIRE);
+ *			memcpy(&copy, page, sizeof(copy));
+ *			__atomic_thread_fence(__ATOMIC_ACQUIRE);
+ *		} while ((seq & 1) || (seq != __atomic_load_n(&page->seq, __ATOMIC_RELAXED)));
+ *
+ *	A reader checks magic and version first. SP_VERSION changes whenever a field
+ *	changes or moves; new fields go on the end, and size tells a reader how much
+ *	of the page this writer fills.
+ */
+#define SP_MAGIC 0x53334643				// "CF3S" little endian
+#define SP_VERSION 1
+#define SP_ERROR_LEN 64					// start of the block that last failed
+
+typedef struct spPage {					// fixed size fields only - the layout is shared
+	uint32_t magic;						// SP_MAGIC
+	uint32_t version;					// SP_VERSION
+	uint32_t size;						// sizeof(spPage_t)
+	uint32_t seq;						// odd while the page is being written
+	uint32_t pid;						// the converter's process
+
+	uint32_t line;						// G code lines read
+	uint32_t total_lines;				// lines in the file if counted (-l), else 0
+	int32_t percent;					// of the file read, -1 if unknown
+	uint64_t cells;						// FIQ cells emitted
+	float position[AXES];				// runtime absolute position, mm or degrees
+	float velocity;						// runtime velocity, mm/min
+
+	uint8_t controller_state;			// cmControllerState
+	uint8_t machine_state;				// cmMachineState
+	uint8_t cycle_state;				// cmCycleState
+	uint8_t motion_state;				// cmMotionState
+	uint8_t planner_depth;				// planner buffers in use
+	uint8_t last_status;				// stat_t of the last error response, 0 if none
+	uint16_t reserved;
+	uint32_t errors;					// count of error responses
+	uint32_t error_line;				// line of the last error
+	char last_error[SP_ERROR_LEN];		// the block that failed, NUL terminated
+} spPage_t;
+
+typedef struct spSingleton {
+	spPage_t *page;						// the mapped page, NULL if there is none
+} spSingleton_t;
+
+extern spSingleton_t sp;
+
+stat_t sp_open(const char *path);
+void sp_update(void);
+void sp_error(stat_t status, const char *block);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // End of include guard: STATUS_PAGE_H_ONCE
@@ -242,14 +242,32 @@ enum prepBufferState {
  */
 #define DDA_SUBSTEPS 100000UL		// 100,000 accumulates substeps to 6 decimal places
 
+/* DDA segment limit
+ *	dda_ticks_X_substeps and the phase accumulators are int32_t, so the longest
+ *	segment the loader can run is INT32_MAX / DDA_SUBSTEPS ticks. At 100,000
+ *	substeps and a 1 MHz DDA that is a little over 21 ms.
+ */
+#define DDA_MAX_SEGMENT_TICKS	((INT32_MAX / DDA_SUBSTEPS) - 1)
+#define DDA_MAX_SEGMENT_USEC	((float)DDA_MAX_SEGMENT_TICKS * 1000000 / FREQUENCY_DDA)
+
+/* Curve sections
+ *	Step-exact curve sections do not use the DDA. Step times are found by solving
+ *	the section's path polynomial for each step, to CURVE_SOLVER_TOLERANCE ticks.
+ *	The pulse phase left at the end of a curve is handed back to the DDA scaled
+ *	by CURVE_PHASE_TICKS.
+ */
+#define CURVE_SOLVER_ITERATIONS	40
+#define CURVE_SOLVER_TOLERANCE	((double)0.01)
+#define CURVE_PHASE_TICKS		DDA_MAX_SEGMENT_TICKS
+
 /* Accumulator resets
- * 	You want to reset the DDA accumulators if the new ticks value is way less
- *	than previous value, but otherwise you should leave the accumulators alone.
  *	Preserving the accumulator value from the previous segment aligns pulse
- *	phasing between segments. However, if the new accumulator is going to be
- *	much less than the old one you must reset it or risk motor stalls.
+ *	phasing between segments. The accumulator is scaled by the segment's ticks,
+ *	so whenever the ticks value changes it is rescaled to the new segment.
+ *	Resetting it instead (as TinyG did when ticks dropped by more than half)
+ *	costs a spurious step per reset on slow motors, and carrying it unscaled
+ *	into a much longer segment fires the next step early.
  */
-#define ACCUMULATOR_RESET_FACTOR 2	// amount counter range can safely change
 
 /*
  * Stepper control structures
@@ -288,6 +306,7 @@ typedef struct stConfig {			// stepper configs
 typedef struct stRunMotor { 		// one per controlled motor
 	int32_t phase_increment;		// total steps in axis times substeps factor
 	int32_t phase_accumulator;		// DDA phase angle accumulator for axis
+	int8_t dir;						// direction of the last segment the motor moved in
 	uint8_t power_state;			// state machine for managing motor power
 	uint32_t power_systick;			// sys_tick for next state transition
 	uint32_t power_level;			// power level for this segment (FUTURE)
@@ -306,6 +325,7 @@ typedef struct stRunSingleton {		// Stepper static values and axis parameters
 
 typedef struct stPrepMotor {
  	uint32_t phase_increment; 		// total steps in axis times substep factor
+	float curve_steps;				// total steps in axis for a curve section (unsigned)
 	int8_t dir;						// direction
 } stPrepMotor_t;
 
@@ -319,6 +339,7 @@ typedef struct stPrepSingleton {
 	uint32_t dda_ticks;				// DDA or dwell ticks for the move
 	uint32_t dda_ticks_X_substeps;	// DDA ticks scaled by substep factor
 //	float segment_velocity;			// record segment velocity for diagnostics
+	float curve_coeff[3];			// curve section path polynomial (see st_prep_curve())
 	stPrepMotor_t m[MOTORS];		// per-motor structs
 } stPrepSingleton_t;
 
@@ -339,9 +360,11 @@ void st_set_motor_power(const uint8_t motor, uint8_t power);
 stat_t st_motor_power_callback(void);
 
 void st_request_exec_move(void);
+uint64_t st_get_cells(void);
 void st_prep_null(void);
 void st_prep_dwell(float microseconds);
 stat_t st_prep_line(float steps[], float microseconds);
+stat_t st_prep_curve(float steps[], float microseconds, float v0, float a0, float jerk);
 
 stat_t st_set_sa(cmdObj_t *cmd);
 stat_t st_set_tr(cmdObj_t *cmd);
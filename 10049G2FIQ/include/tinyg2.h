@@ -74,6 +74,8 @@
 //#define __SUPPRESS_STARTUP_MESSAGES 		// what it says
 //#define __ENABLE_PROBING					// comment out to take out experimental probing code
 //#define __UNIT_TESTS						// master enable for unit tests; USAGE: uncomment test in .h file
+//#define __PROFILE							// set by cmake -DPROFILE=ON - see profile.h and $prof
+//#define __MICROBENCH						// set by the 10049G2_bench target only - see microbench.h
 
 //#ifndef WEAK
 //#define WEAK  __attribute__ ((weak))
@@ -195,19 +197,26 @@ typedef uint16_t magic_t;		// magic number size
 
 #define FILE_PATH_NAME_LEN 255			// File Path and name string storage allocation
 
-extern char TempPathFile[FILE_PATH_NAME_LEN];
 extern char FcodePathFile[FILE_PATH_NAME_LEN];
 extern char GcodePathFile[FILE_PATH_NAME_LEN];
 extern char ConfigPathFile[FILE_PATH_NAME_LEN];
 extern char SlowCmdPathFile[FILE_PATH_NAME_LEN];
+extern char OutCachePathDir[FILE_PATH_NAME_LEN];
+extern char ServerPathFile[FILE_PATH_NAME_LEN];
+extern char StatusPathFile[FILE_PATH_NAME_LEN];
+extern char MetricsPathFile[FILE_PATH_NAME_LEN];
+extern char BlockLogPathFile[FILE_PATH_NAME_LEN];
+extern char FiqStatPathFile[FILE_PATH_NAME_LEN];
 
-extern FILE *Gin_fp;						// Gcode Input File pointer
-extern FILE *Fout_fp;		 				// FIQ pattern Output File pointer
-extern FILE *Temp_fp;		 				// Uncompressed Temporary FIQ pattern Output File pointer
 extern FILE *Cfg_fp; 						// System Configuration File pointer
 extern FILE *SCmd_fp; 						// Slow Commands File pointer
 
-extern bool isCompressing; // whether or not it compresses the fiq data after it writes it.
+extern bool isCompressing; // whether or not it compresses the fiq data as it writes it.
+extern bool isCountingLines; // whether or not it counts the gcode lines before converting.
+extern bool isCaching; // whether or not it converts through the pre-parsed gcode cache.
+extern bool isVerifying; // whether or not it reads the fiq data back and checks it against the gcode.
+extern bool isLegacyFiq; // whether or not the FIQ file analyzed has legacy 12 byte cells.
+extern uint32_t OutCacheLimit; // MB kept in the output cache directory.
 
 
 /************************************************************************************
@@ -265,7 +274,7 @@ char *get_status_message(stat_t status);
 #define	STAT_ALARMED 27
 //#define	STAT_MEMORY_FAULT 28
 #define	STAT_ERROR_28 28
-#define	STAT_ERROR_29 29
+#define	STAT_OUTPUT_DRIFT 29			// output verified more than a step off its targets (-V)
 #define	STAT_ERROR_30 30
 #define	STAT_ERROR_31 31
 #define	STAT_ERROR_32 32
@@ -97,10 +97,9 @@ float max4(float x1, float x2, float x3, float x4);
 uint8_t isnumber(char c);
 char *escape_string(char *dst, char *src);
 uint16_t compute_checksum(char const *string, const uint16_t length);
+uint64_t compute_hash(uint64_t hash, const void *buf, size_t size);
 
 //*** other utilities ***
-int fLineCount(FILE *file);
-unsigned long compressFile(FILE *ifile, FILE *ofile);
 
 #ifdef __ARM
 uint32_t SysTickTimer_getValue(void);
@@ -0,0 +1,105 @@
+/*
+ * FILE NAME: verify.h - FIQ output verifier
+ *
+ * Copyright (c) 2014 Robert K. Parker
+ *
+ * This file was part of the TinyG project
+ *
+ * Copyright (c) 2010 - 2013 Alden S. Hart, Jr.
+ *
+ * Now it is in crystalfontz3D
+ *
+ * This file ("the software") is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2 as published by the
+ * Free Software Foundation. You should have received a copy of the GNU General Public
+ * License, version 2 along with the software.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * THE SOFTWARE IS DISTRIBUTED IN THE HOPE THAT IT WILL BE USEFUL, BUT WITHOUT ANY
+ * WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT
+ * SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+/*
+ * PURPOSE:	Checks that the FIQ cells written step the motors to the G code's targets.
+ *
+ *
+ * CHANGE HISTORY:
+ *
+ *    Revision: Initial 1.0
+ *    User: R.K.Parker     Date: 05/29/14
+ *    First prototype.
+ *
+ */
+
+#ifndef VERIFY_H_ONCE
+#define VERIFY_H_ONCE
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/*
+ * Output verifier
+ *
+ *	With -V each block is marked as it finishes executing, with its G code line, its
+ *	target and the FIQ cells written up to its end. Once the output file is closed
+ *	it is read back (fiq_stat.cpp), the step and direction bits are added up into
+ *	a step count for each motor, and at each mark the counts are checked against
+ *	the block's target - taken from where the job started, through motor_map and
+ *	steps_per_unit, as ik_kinematics() does.
+ *
+ *	A motor more than VF_TOLERANCE steps from its target at a mark puts the block
+ *	off. The DDA runs up to a step behind the exact position, so less is not an
+ *	error. The verifier prints the blocks checked, the blocks off, and the worst
+ *	miss of each motor with the line it was at; the metrics file (-j) gets them
+ *	too. The output can't be verified when it goes to stdout, or comes from the
+ *	output cache. Marks are kept in memory until the end of the file, 40 bytes a
+ *	block.
+ *
+ *	A block off fails the job: its status is STAT_OUTPUT_DRIFT, the metrics status
+ *	is "drift", the job server reports it failed and the converter exits with 1.
+ *	The output is still written, for a look at where it went wrong.
+ */
+#define VF_TOLERANCE ((float)1)			// steps
+#define VF_CHUNK 4096					// marks allocated at a time
+
+typedef struct vfMark {
+	uint32_t line;						// G code file line
+	uint64_t cells;						// cells written by the end of the block
+	float target[AXES];					// absolute machine position, mm or degrees
+} vfMark_t;
+
+typedef struct vfSingleton {
+	uint8_t enabled;					// marking blocks - the output will be verified
+	uint8_t pending;					// a block has finished; its cells are not all loaded yet
+	uint8_t failed;						// a mark could not be allocated
+	vfMark_t next;						// ...that block's mark
+	float start[AXES];					// runtime position the job started at
+	uint32_t marks;						// marks in use
+	uint32_t size;						// marks allocated
+	vfMark_t *mark;
+
+	uint64_t cells;						// cells read back so far
+	uint32_t checked;					// marks checked so far
+	int64_t steps[MOTOR_6];				// step count of each motor so far
+
+	uint32_t total_off;					// blocks off (statistics)
+	float max_miss[MOTOR_6];			// worst miss of each motor, steps
+	uint32_t max_line[MOTOR_6];			// ...and the line it was at
+} vfSingleton_t;
+
+extern vfSingleton_t vf;
+
+void vf_start(uint8_t enabled);
+void vf_block(const mpBuf_t *bf);
+void vf_mark(void);
+stat_t vf_finish(const char *path, uint8_t compressed);
+void vf_print(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // End of include guard: VERIFY_H_ONCE
@@ -31,7 +31,7 @@
  * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  */
 /*
- * PURPOSE: Now mostly just  ASCII character definitions.
+ * PURPOSE: ASCII character definitions, the G code file reader and the FIQ cell writer.
  *
  *
  * CHANGE HISTORY:
@@ -67,6 +67,88 @@
 #define DEL (char)0x7F		//  DEL(ete)
 #define Q_EMPTY (char)0xFF	// signal no character
 
+/*
+ * G code file reader
+ *
+ *	Hands out the input one line at a time as a (pointer, length) view into the
+ *	reader's own memory. Regular files are mmapped in XIO_MAP_WINDOW windows (so a
+ *	multi-GB file fits a 32 bit address space); anything that can't be mapped, like
+ *	a pipe, is read() into an XIO_READ_BUFFER_LEN read-ahead buffer. A view is valid
+ *	until the next xio_read_line() and is NOT terminated - it ends with the LF, if
+ *	the line has one.
+ */
+#define XIO_MAP_WINDOW			((size_t)64*1024*1024)	// bytes of file mapped at a time
+#define XIO_READ_BUFFER_LEN		((size_t)1024*1024)		// read-ahead for unmappable inputs
+
+typedef struct xioReader {
+	int fd;						// input file descriptor, -1 if closed
+	uint8_t mapped;				// TRUE if buf is a window of a mmapped file
+	uint8_t eof;				// TRUE once read() has returned end of file
+	uint8_t is_stdin;			// TRUE if the input is stdin (XIO_STDIO)
+	char *buf;					// mapped window or read-ahead buffer
+	size_t size;				// valid bytes in buf
+	size_t rd;					// offset of the next line in buf
+	uint64_t base;				// file offset of buf[0] (mapped files)
+	uint64_t file_size;			// size of a mapped file
+	uint64_t offset;			// bytes handed out as lines so far
+	uint8_t hashed;				// TRUE once xio_hash_gcode() has run
+	uint64_t hash;				// xio_hash_gcode() of the file
+} xioReader_t;
+
+extern xioReader_t xr;
+
+stat_t xio_open_gcode(const char *path);
+stat_t xio_read_line(char **line, uint32_t *len);
+uint32_t xio_count_lines(void);
+uint64_t xio_hash_gcode(void);
+int8_t xio_get_percent(void);
+void xio_close_gcode(void);
+
+/*
+ * FIQ cell writer
+ *
+ *	Cells are appended to an XIO_WRITE_BUFFER_LEN buffer that is written out each
+ *	time it fills. Compressed output is a stream of QuickLZ packets, one per full
+ *	buffer, compressed as they are made - so the output can go to a pipe and nothing
+ *	is kept but the buffer and the compressor state. XIO_STDIO ("-") as the input
+ *	or output path name means stdin or stdout.
+ */
+#define XIO_STDIO				"-"						// path name for stdin / stdout
+#define XIO_WRITE_BUFFER_LEN	(64*1024)		// must stay below QLZ_STREAMING_BUFFER
+
+typedef struct xioWriter {
+	int fd;						// output file descriptor, -1 if closed
+	int stdout_fd;				// stdout, once xio_claim_stdout() has moved it aside
+	uint8_t compress;			// TRUE to write QuickLZ packets
+	uint8_t error;				// TRUE once a write has failed
+	char *buf;					// cells waiting to be written
+	size_t len;					// valid bytes in buf
+	char *packet;				// compressed packet (compressing only)
+	void *state;				// qlz_state_compress (compressing only)
+	uint64_t bytes_in;			// cell bytes written so far
+	uint64_t bytes_out;			// bytes that reached the output
+	int tee_fd;					// a copy of the output goes here too, -1 if none
+	uint8_t tee_error;			// TRUE once a write to tee_fd has failed
+} xioWriter_t;
+
+extern xioWriter_t xw;
+
+void xio_claim_stdout(void);
+stat_t xio_open_fiq(const char *path, uint8_t compress);
+void xio_tee_fiq(int fd);
+void xio_flush_fiq(void);
+stat_t xio_close_fiq(void);
+
+/*
+ * xio_write_fiq() - append to the output; inline as it is called once per FIQ cell
+ */
+static inline void xio_write_fiq(const void *data, size_t len)
+{
+	if (xw.len + len > XIO_WRITE_BUFFER_LEN) { xio_flush_fiq();}
+	memcpy(xw.buf + xw.len, data, len);
+	xw.len += len;
+}
+
 
 #endif // _XIO_H_
 
@@ -0,0 +1,385 @@
+/*
+ * FILE NAME: fiq_stat.cpp - FIQ file analyzer
+ *
+ * Copyright (c) 2014 Robert K. Parker
+ *
+ * This file was part of the TinyG project
+ *
+ * Copyright (c) 2010 - 2013 Alden S. Hart, Jr.
+ *
+ * Now it is in crystalfontz3D
+ *
+ * This file ("the software") is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2 as published by the
+ * Free Software Foundation. You should have received a copy of the GNU General Public
+ * License, version 2 along with the software.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * THE SOFTWARE IS DISTRIBUTED IN THE HOPE THAT IT WILL BE USEFUL, BUT WITHOUT ANY
+ * WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT
+ * SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+/*
+ * PURPOSE:	Reads back a FIQ file and reports what the FIQ will be asked to do.
+ *
+ * NOTES:	See fiq_stat.h for the report.
+ *
+ *
+ * CHANGE HISTORY:
+ *
+ *    Revision: Initial 1.0
+ *    User: R.K.Parker     Date: 05/29/14
+ *    First prototype.
+ *
+ */
+
+#include "tinyg2.h"			// #1
+#include "config.h"			// #2
+#include "fiq_stat.h"
+#include "hardware.h"
+#include "cfa10049_fiq.h"
+#include "quicklz.h"
+#include "util.h"
+#include "xio.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#define FS_DWELL_TICKS (FREQUENCY_DDA * FS_DWELL_MS / 1000)
+
+fsSingleton_t fs;						// FIQ file analyzer singleton
+static void (*cells_func)(const char *data, size_t count);	// fs_read()'s caller's
+
+static const uint32_t step_bit[MOTOR_6] = { X_STEP_BIT, Y_STEP_BIT, Z_STEP_BIT, A_STEP_BIT, B_STEP_BIT };
+static const uint32_t dir_bit[MOTOR_6] = { X_DIR_BIT, Y_DIR_BIT, Z_DIR_BIT, A_DIR_BIT, B_DIR_BIT };
+static const char *const motor_name[MOTOR_6] = { "x", "y", "z", "a", "b" };
+
+static stat_t _read(int fd, char *buf, size_t len, size_t *got);
+static stat_t _read_raw(int fd);
+static stat_t _read_compressed(int fd);
+static void _feed(const char *data, size_t len);
+static void _cells(const char *data, size_t count);
+static void _step(uint32_t set);
+static void _end_second(void);
+static uint8_t _bin(uint64_t ticks);
+static void _print(const char *path);
+
+/*
+ * fs_analyze() - read a FIQ file and print its report
+ *
+ *	compressed is TRUE for QuickLZ packets, legacy for 12 byte cells.
+ */
+stat_t fs_analyze(const char *path, uint8_t compressed, uint8_t legacy)
+{
+	stat_t status;
+
+	free(fs.per_second);
+	memset(&fs, 0, sizeof(fs));
+	fs.next_second = FREQUENCY_DDA;
+
+	status = fs_read(path, compressed, legacy ? 12 : sizeof(fiq_cell_t), _cells);
+	if (status != STAT_FILE_NOT_OPEN) { _print(path);}	// what was read, even if not all of it
+	free(fs.per_second);
+	fs.per_second = NULL;
+	return (status);
+}
+
+/*
+ * fs_read() - read a FIQ file, passing its cells to cells() a buffer at a time
+ *
+ *	Prints why if the file can't be read to its end. Returns STAT_FILE_NOT_OPEN if
+ *	it can't be opened, STAT_EOF if it ends part way through a cell or a packet,
+ *	STAT_INPUT_VALUE_UNSUPPORTED for a bad packet header and STAT_ERROR if a read fails.
+ */
+stat_t fs_read(const char *path, uint8_t compressed, uint8_t cell_size, void (*cells)(const char *data, size_t count))
+{
+	int fd;
+	stat_t status;
+
+	fs.cell_size = cell_size;
+	fs.carry_len = 0;
+	cells_func = cells;
+
+	if (strcmp(path, XIO_STDIO) == 0) {
+		fd = STDIN_FILENO;
+	} else if ((fd = open(path, O_RDONLY)) < 0) {
+		printf("Can't Open the FIQ file %s\n", path);
+		return (STAT_FILE_NOT_OPEN);
+	}
+	status = compressed ? _read_compressed(fd) : _read_raw(fd);
+	if (fd != STDIN_FILENO) { close(fd);}
+
+	if ((status == STAT_OK) && (fs.carry_len != 0)) { status = STAT_EOF;}
+	if (status == STAT_EOF) {
+		printf("The FIQ file %s ends part way through a %s\n", path, compressed ? "packet or cell" : "cell");
+	} else if (status == STAT_INPUT_VALUE_UNSUPPORTED) {
+		printf("The FIQ file %s has a bad packet - is it compressed?\n", path);
+	} else if (status != STAT_OK) {
+		printf("Can't read the FIQ file %s\n", path);
+	}
+	return (status);
+}
+
+/*
+ * _read()	   - read len bytes, or to the end of the file. Retries short reads
+ * _read_raw() - read cells FS_READ_LEN bytes at a time
+ * _read_compressed() - read and decompress one packet at a time
+ *
+ *	A packet is a QuickLZ header, with its compressed and decompressed sizes, and
+ *	its data. The sizes are checked against the writer's limits before anything is
+ *	decompressed.
+ */
+static stat_t _read(int fd, char *buf, size_t len, size_t *got)
+{
+	*got = 0;
+	while (*got < len) {
+		ssize_t n = read(fd, buf + *got, len - *got);
+		if (n == 0) break;
+		if (n < 0) {
+			if (errno == EINTR) continue;
+			return (STAT_ERROR);
+		}
+		*got += n;
+	}
+	return (STAT_OK);
+}
+
+static stat_t _read_raw(int fd)
+{
+	char *buf = (char *)malloc(FS_READ_LEN);
+	size_t got;
+	stat_t status;
+
+	if (buf == NULL) { return (STAT_MEMORY_FAULT);}
+	do {
+		if ((status = _read(fd, buf, FS_READ_LEN, &got)) != STAT_OK) break;
+		_feed(buf, got);
+	} while (got == FS_READ_LEN);
+	free(buf);
+	return (status);
+}
+
+static stat_t _read_compressed(int fd)
+{
+	char *packet = (char *)malloc(QLZ_STREAMING_BUFFER + 400);	// QuickLZ worst case expansion
+	char *data = (char *)malloc(QLZ_STREAMING_BUFFER);
+	qlz_state_decompress *state = (qlz_state_decompress *)calloc(1, sizeof(qlz_state_decompress));
+	stat_t status = STAT_OK;
+	size_t got;
+
+	if ((packet == NULL) || (data == NULL) || (state == NULL)) { status = STAT_MEMORY_FAULT;}
+	while (status == STAT_OK) {
+		if ((status = _read(fd, packet, 1, &got)) != STAT_OK) break;
+		if (got == 0) break;							// the end of the file, between packets
+		size_t header = (packet[0] & 2) ? 9 : 3;		// QuickLZ long or short header
+		if ((status = _read(fd, packet + 1, header - 1, &got)) != STAT_OK) break;
+		if (got != header - 1) {
+			status = STAT_EOF;
+			break;
+		}
+		size_t size = qlz_size_compressed(packet);
+		size_t len = qlz_size_decompressed(packet);
+		if ((size <= header) || (size > QLZ_STREAMING_BUFFER + 400) || (len > QLZ_STREAMING_BUFFER)) {
+			status = STAT_INPUT_VALUE_UNSUPPORTED;
+			break;
+		}
+		if ((status = _read(fd, packet + header, size - header, &got)) != STAT_OK) break;
+		if (got != size - header) {
+			status = STAT_EOF;
+			break;
+		}
+		_feed(data, qlz_decompress(packet, data, state));
+	}
+	free(packet);
+	free(data);
+	free(state);
+	return (status);
+}
+
+/*
+ * _feed()	- pass on len bytes of cells. A cell split between calls is put together
+ * _cells() - analyze whole cells
+ */
+static void _feed(const char *data, size_t len)
+{
+	if (fs.carry_len != 0) {
+		size_t n = min(len, (size_t)(fs.cell_size - fs.carry_len));
+		memcpy(fs.carry + fs.carry_len, data, n);
+		fs.carry_len += n;
+		data += n;
+		len -= n;
+		if (fs.carry_len < fs.cell_size) return;
+		cells_func(fs.carry, 1);
+		fs.carry_len = 0;
+	}
+	size_t count = len / fs.cell_size;
+	cells_func(data, count);
+	fs.carry_len = len - count * fs.cell_size;
+	memcpy(fs.carry, data + count * fs.cell_size, fs.carry_len);
+}
+
+static void _cells(const char *data, size_t count)
+{
+	const size_t set_offset = fs.cell_size - sizeof(uint32_t);	// set is the last word of either cell
+	const char *end = data + count * fs.cell_size;
+	uint32_t timer, set;
+
+	for (; data < end; data += fs.cell_size) {
+		memcpy(&timer, data, sizeof(timer));
+		memcpy(&set, data + set_offset, sizeof(set));
+		if (fs.ticks >= fs.next_second) { _end_second();}
+		if (set & ALL_STEPS) { _step(set);}
+		fs.second_cells++;
+		fs.ticks += timer;
+	}
+	fs.cells += count;
+}
+
+/*
+ * _step() - count the steps of a cell, at fs.ticks
+ */
+static void _step(uint32_t set)
+{
+	if (fs.ticks - fs.last_step >= FS_DWELL_TICKS) {
+		fs.dwells++;
+		fs.dwell_ticks += fs.ticks - fs.last_step;
+	}
+	fs.last_step = fs.ticks;
+
+	for (uint8_t motor=MOTOR_1; motor<MOTOR_6; motor++) {
+		if ((set & step_bit[motor]) == 0) continue;
+		fsMotor_t *m = &fs.m[motor];
+		uint32_t dir = set & dir_bit[motor];
+		if (m->steps != 0) {
+			uint64_t interval = fs.ticks - m->last_step;
+			if ((m->min_interval == 0) || (interval < m->min_interval)) { m->min_interval = interval;}
+			m->hist[_bin(interval)]++;
+			if (dir != m->dir) { m->dir_changes++;}
+		}
+		m->dir = dir;
+		m->last_step = fs.ticks;
+		m->steps++;
+	}
+}
+
+/*
+ * _end_second() - keep the cells of the second just ended and move on to the one fs.ticks is in
+ *
+ *	The seconds are kept in an array doubled as it fills. If it can't grow the
+ *	profile stops there.
+ */
+static void _end_second()
+{
+	if (fs.second >= fs.seconds) {
+		uint32_t seconds = max(fs.second + 1, fs.seconds * 2);
+		uint32_t *per_second = (uint32_t *)realloc(fs.per_second, seconds * sizeof(uint32_t));
+		if (per_second != NULL) {
+			memset(per_second + fs.seconds, 0, (seconds - fs.seconds) * sizeof(uint32_t));
+			fs.per_second = per_second;
+			fs.seconds = seconds;
+		}
+	}
+	if (fs.second < fs.seconds) { fs.per_second[fs.second] = fs.second_cells;}
+	fs.second = fs.ticks / FREQUENCY_DDA;
+	fs.second_cells = 0;
+	fs.next_second = ((uint64_t)fs.second + 1) * FREQUENCY_DDA;
+}
+
+/*
+ * _bin() - histogram bin of a step interval: floor(log2(ticks))
+ */
+static uint8_t _bin(uint64_t ticks)
+{
+	if (ticks == 0) return (0);
+	uint8_t bin = 63 - __builtin_clzll(ticks);
+	return ((bin < FS_BINS) ? bin : FS_BINS - 1);
+}
+
+/*
+ * _print() - print the report
+ */
+static void _print(const char *path)
+{
+	const double us_per_tick = 1e6 / FREQUENCY_DDA;
+	uint32_t seconds = 0;
+
+	if (fs.cells != 0) {
+		uint32_t last = fs.second;
+		fs.next_second = fs.ticks;			// keep the last, part filled second
+		_end_second();
+		seconds = min(fs.seconds, last + 1);
+	}
+	if (fs.ticks - fs.last_step >= FS_DWELL_TICKS) {
+		fs.dwells++;						// the time after the last step
+		fs.dwell_ticks += fs.ticks - fs.last_step;
+	}
+
+	printf("FIQ file %s: %llu cells of %u bytes, %.3f s of print time.\n", path,
+		   (unsigned long long)fs.cells, fs.cell_size, (double)fs.ticks / FREQUENCY_DDA);
+
+	if (seconds != 0) {
+		uint32_t slice = (seconds + FS_PROFILE_LINES - 1) / FS_PROFILE_LINES;
+		printf("Cells per second of print time:\n");
+		printf("      from s       to s       mean       peak\n");
+		for (uint32_t start=0; start<seconds; start+=slice) {
+			uint32_t end = min(start + slice, seconds);
+			uint64_t total = 0;
+			uint32_t peak = 0;
+			for (uint32_t i=start; i<end; i++) {
+				total += fs.per_second[i];
+				peak = max(peak, fs.per_second[i]);
+			}
+			printf("  %10u %10u %10.0f %10u\n", start, end, (double)total / (end - start), peak);
+		}
+	}
+
+	printf("Motor       steps  dir changes  min interval us  peak steps/s\n");
+	for (uint8_t motor=MOTOR_1; motor<MOTOR_6; motor++) {
+		const fsMotor_t *m = &fs.m[motor];
+		printf("  %s  %12llu %12llu", motor_name[motor], (unsigned long long)m->steps,
+			   (unsigned long long)m->dir_changes);
+		if (m->min_interval == 0) {
+			printf("\n");
+			continue;
+		}
+		printf(" %16.1f %13.0f\n", m->min_interval * us_per_tick, (double)FREQUENCY_DDA / m->min_interval);
+	}
+
+	int8_t first = -1, last = -1;
+	for (uint8_t bin=0; bin<FS_BINS; bin++) {
+		for (uint8_t motor=MOTOR_1; motor<MOTOR_6; motor++) {
+			if (fs.m[motor].hist[bin] == 0) continue;
+			if (first < 0) { first = bin;}
+			last = bin;
+		}
+	}
+	if (first >= 0) {
+		printf("Step intervals, ticks:\n     from       to");
+		for (uint8_t motor=MOTOR_1; motor<MOTOR_6; motor++) { printf(" %12s", motor_name[motor]);}
+		printf("\n");
+		for (int8_t bin=first; bin<=last; bin++) {
+			printf("  %7lu", 1UL << bin);
+			if (bin == FS_BINS - 1) {
+				printf("      ...");
+			} else {
+				printf(" %8lu", (2UL << bin) - 1);
+			}
+			for (uint8_t motor=MOTOR_1; motor<MOTOR_6; motor++) {
+				printf(" %12llu", (unsigned long long)fs.m[motor].hist[bin]);
+			}
+			printf("\n");
+		}
+	}
+	printf("Dwells of %d ms or more: %llu, %.3f s.\n", FS_DWELL_MS, (unsigned long long)fs.dwells,
+		   (double)fs.dwell_ticks / FREQUENCY_DDA);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -176,11 +176,35 @@ stat_t help_command_line()
 fprintf(stderr, PSTR("\n\n\n#### Calling 10049G2 from the Command Line Help ####\n"));
 fprintf(stderr, PSTR("\
 Set these Parameters when invoking 10049G2 from the command line:\n\
+  a             The Path and Name of a FIQ file to read back and report on, then\n\
+                exit - with v if it is compressed. See fiq_stat.h.\n\
+  A             As a, for a legacy FIQ file of 12 byte cells.\n\
+  b             The Path and Name of a file to log the planned velocities of each\n\
+                block to, against a replan with unlimited lookahead. See plan_diag.h.\n\
   c             The Path and Name of the machine configuration file.\n\
+  d             The Path and Name of a UNIX socket to take conversion jobs on.\n\
+                The program runs until a client sends quit - see server.h.\n\
   f             The Path and Name of the FIQ control/status bit output file.\n\
+                - writes it to stdout; messages then go to stderr.\n\
   g             The Path and Name of the gcode command input file.\n\
+                - reads it from stdin; the program exits at its end.\n\
+  j             The Path and Name of a JSON file to write the metrics of each\n\
+                conversion to at its end. See metrics.h.\n\
+  m             The Path and Name of a status page file to keep up to date for\n\
+                a UI to map and poll - best in /dev/shm. See status_page.h.\n\
   s             The Path and Name of the Slow Commands output file.\n\
-  v             Compress the FIQ control/status bit output file.\n\
+  v             Compress the FIQ control/status bit output file as it is written.\n\
+  l             Count the lines of the gcode input file before converting.\n\
+  p             Keep a pre-parsed copy of the gcode input file next to it and\n\
+                convert from it while the gcode file is unchanged.\n\
+  V             Read the FIQ output back after converting and check that it\n\
+                steps the motors to each block's target; exits with 1 if a\n\
+                block is more than a step off. See verify.h.\n\
+  k             A directory to keep the FIQ output of conversions in. A gcode\n\
+                file converted before with the same configuration is copied\n\
+                from there instead of converted.\n\
+  K             The size limit of the k directory in MB - the least recently\n\
+                used outputs are removed past it. Default 1024.\n\
   h             Get this help report.\n\
 "));
 _postscript();
@@ -51,10 +51,17 @@
 #include "hardware.h"
 #include "controller.h"
 #include "canonical_machine.h"
+#include "gcode_parser.h"
 #include "help.h"
+#include "output_cache.h"
 #include "report.h"
 #include "planner.h"
+#include "profile.h"
+#include "server.h"
+#include "fiq_stat.h"
+#include "status_page.h"
 #include "stepper.h"
+#include "microbench.h"
 //#include "network.h"
 #include "switch.h"
 //#include "gpio.h"
@@ -62,19 +69,26 @@
 //#include "pwm.h"
 #include "xio.h"
 
-char TempPathFile[FILE_PATH_NAME_LEN] ={"./temp.out"};
 char FcodePathFile[FILE_PATH_NAME_LEN] ={"./fcode.out"};
 char GcodePathFile[FILE_PATH_NAME_LEN] ={""};
 char ConfigPathFile[FILE_PATH_NAME_LEN] ={"./10049G2.cfg"};
 char SlowCmdPathFile[FILE_PATH_NAME_LEN] ={"./slow.out"};
+char OutCachePathDir[FILE_PATH_NAME_LEN] ={""};
+char ServerPathFile[FILE_PATH_NAME_LEN] ={""};
+char StatusPathFile[FILE_PATH_NAME_LEN] ={""};
+char MetricsPathFile[FILE_PATH_NAME_LEN] ={""};
+char BlockLogPathFile[FILE_PATH_NAME_LEN] ={""};
+char FiqStatPathFile[FILE_PATH_NAME_LEN] ={""};
 
-FILE *Gin_fp;						// Gcode Input File pointer
-FILE *Fout_fp;		 				// FIQ pattern Output File pointer
-FILE *Temp_fp;		 				// Uncompressed Temporary FIQ pattern Output File pointer
 FILE *Cfg_fp; 						// System Configuration File pointer
 FILE *SCmd_fp; 						// Slow Commands File pointer
 
-bool isCompressing = false; // whether or not it compresses the fiq data after it writes it.
+bool isCompressing = false; // whether or not it compresses the fiq data as it writes it.
+bool isCountingLines = false; // whether or not it counts the gcode lines before converting.
+bool isCaching = false; // whether or not it converts through the pre-parsed gcode cache.
+bool isVerifying = false; // whether or not it reads the fiq data back and checks it against the gcode.
+bool isLegacyFiq = false; // whether or not the FIQ file analyzed has legacy 12 byte cells.
+uint32_t OutCacheLimit = OC_DEFAULT_LIMIT; // MB kept in the output cache directory.
 
 
 
@@ -86,29 +100,61 @@ int main(int argc, char* argv[])
 {
   int param;
 
-  std::cout << "G code to FIQ converter" << std::endl;
-
   // TinyG Command Line Parsing
     opterr = 0;
 
-    while ((param = getopt (argc, argv, "f:g:c:vh")) != -1)
+    while ((param = getopt (argc, argv, "a:A:b:f:g:c:d:j:k:K:m:vlpVh")) != -1)
         switch (param)
         {
+            case 'a':
+                sscanf(optarg," %254s", FiqStatPathFile);
+                break;
+            case 'A':
+                sscanf(optarg," %254s", FiqStatPathFile);
+                isLegacyFiq = true;
+                break;
+            case 'b':
+                sscanf(optarg," %254s", BlockLogPathFile);
+                break;
             case 'c':
                 sscanf(optarg," %254s", ConfigPathFile);
                 break;
+            case 'd':
+                sscanf(optarg," %254s", ServerPathFile);
+                break;
             case 'f':
                 sscanf(optarg," %254s", FcodePathFile);
                 break;
             case 'g':
                 sscanf(optarg," %254s", GcodePathFile);
                 break;
+            case 'j':
+                sscanf(optarg," %254s", MetricsPathFile);
+                break;
+            case 'k':
+                sscanf(optarg," %254s", OutCachePathDir);
+                break;
+            case 'K':
+                sscanf(optarg," %u", &OutCacheLimit);
+                break;
+            case 'm':
+                sscanf(optarg," %254s", StatusPathFile);
+                break;
             case 's':
                 sscanf(optarg," %254s", SlowCmdPathFile);
                 break;
             case 'v':
                 isCompressing = true;
                 break;
+            case 'l':
+                isCountingLines = true;
+                break;
+            case 'p':
+                isCaching = true;
+                break;
+            case 'V':
+                isVerifying = true;
+                break;
             case 'h':
                 help_command_line();
                 break;
@@ -124,13 +170,43 @@ int main(int argc, char* argv[])
                 return 1;
         }
 
+    // FIQ cells on stdout - move all messages to stderr before the first one
+    if (strcmp(FcodePathFile, XIO_STDIO) == 0)
+        xio_claim_stdout();
+
+    // FIQ file analyzer - reads a FIQ file back and converts nothing
+    if (strlen(FiqStatPathFile) != 0)
+        return ((fs_analyze(FiqStatPathFile, isCompressing, isLegacyFiq) == STAT_OK) ? 0 : 1);
+
+  std::cout << "G code to FIQ converter" << std::endl;
+
 	// TinyG application setup
 	_application_init();
 
+#ifdef __MICROBENCH
+	// kernel microbenchmarks - records the G code file's kernel inputs and times them
+	return ((mb_run() == STAT_OK) ? 0 : 1);
+#endif
+
+	// status page for the UI - optional
+	if ((strlen(StatusPathFile) != 0) && (sp_open(StatusPathFile) != STAT_OK))
+	    printf("Can't Open the status page %s\n", StatusPathFile);
+
+	// job server - runs the jobs it is sent until told to quit
+	if (strlen(ServerPathFile) != 0)
+	{
+	    if (server_run(ServerPathFile) != STAT_OK)
+	    {
+	        printf("Can't Open the job socket %s\n", ServerPathFile);
+	        return 1;
+	    }
+	    return 0;
+	}
+
 	// main loop
 	controller_run( );			// single pass through the controller loop.
 
-	return 0;
+	return ((cs.job_status == STAT_OK) ? 0 : 1);
 }
 
 static void _application_init(void)
@@ -151,6 +227,9 @@ static void _application_init(void)
 
 	// do these last
 	stepper_init();
+#ifdef __PROFILE
+	prof_reset();					// stage timings start from here
+#endif
 
 	// now get started
 //	// (LAST) announce system is ready
@@ -202,7 +281,7 @@ static const char stat_25[] PROGMEM = "Read-only address";
 static const char stat_26[] PROGMEM = "Initialization failure";
 static const char stat_27[] PROGMEM = "System alarm - shutting down";
 static const char stat_28[] PROGMEM = "Memory fault or corruption";
-static const char stat_29[] PROGMEM = "29";
+static const char stat_29[] PROGMEM = "Output drifts off its targets";
 static const char stat_30[] PROGMEM = "30";
 static const char stat_31[] PROGMEM = "31";
 static const char stat_32[] PROGMEM = "32";
@@ -318,6 +397,7 @@ static void _unit_tests(void)
 //	JSON_UNITS;
 //	GPIO_UNITS;
 	REPORT_UNITS;
+	GCODE_UNITS;
 	PLANNER_UNITS;
 //	PWM_UNITS;
 #endif
@@ -0,0 +1,243 @@
+/*
+ * FILE NAME: metrics.cpp - per job metrics file
+ *
+ * Copyright (c) 2014 Robert K. Parker
+ *
+ * This file was part of the TinyG project
+ *
+ * Copyright (c) 2010 - 2013 Alden S. Hart, Jr.
+ *
+ * Now it is in crystalfontz3D
+ *
+ * This file ("the software") is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2 as published by the
+ * Free Software Foundation. You should have received a copy of the GNU General Public
+ * License, version 2 along with the software.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * THE SOFTWARE IS DISTRIBUTED IN THE HOPE THAT IT WILL BE USEFUL, BUT WITHOUT ANY
+ * WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT
+ * SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+/*
+ * PURPOSE:	Writes a machine readable summary of each conversion job.
+ *
+ * NOTES:	See metrics.h for the fields.
+ *
+ *
+ * CHANGE HISTORY:
+ *
+ *    Revision: Initial 1.0
+ *    User: R.K.Parker     Date: 05/29/14
+ *    First prototype.
+ *
+ */
+
+#include "tinyg2.h"			// #1
+#include "config.h"			// #2
+#include "controller.h"
+#include "canonical_machine.h"
+#include "plan_fit.h"
+#include "planner.h"
+#include "plan_diag.h"
+#include "verify.h"
+#include "profile.h"
+#include "metrics.h"
+#include "hardware.h"
+#include "util.h"
+#include "xio.h"
+#include "cfa10049_fiq.h"
+
+#include <time.h>
+#include <sys/resource.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#define JM_WINDOW_TICKS (FREQUENCY_DDA * JM_WINDOW_MS / 1000)
+
+jmSingleton_t jm;						// job metrics singleton
+static uint32_t hist[JM_WINDOW_TICKS + 1];	// count of windows by the cells in them
+
+static const uint32_t step_bit[MOTOR_6] = { X_STEP_BIT, Y_STEP_BIT, Z_STEP_BIT, A_STEP_BIT, B_STEP_BIT };
+static const char *const motor_name[MOTOR_6] = { "x", "y", "z", "a", "b" };
+
+static uint64_t _now(void);
+static void _end_window(uint64_t window);
+static uint32_t _window_percentile(float fraction);
+static void _print_string(FILE *f, const char *name, const char *value);
+
+/*
+ * jm_start() - clear the metrics as a G code file is opened
+ *
+ *	enabled is true if there will be a metrics file; without one no cells are counted.
+ */
+void jm_start(uint8_t enabled)
+{
+	memset(&jm, 0, sizeof(jm));
+	memset(hist, 0, sizeof(hist));
+	jm.enabled = enabled;
+	jm.start = _now();
+}
+
+/*
+ * jm_cells() - count a buffer of FIQ cells on their way out
+ *
+ *	A cell's timer is the ticks to the next cell, so the running sum of the timers
+ *	is the print time of the next cell.
+ */
+void jm_cells(const char *buf, size_t len)
+{
+	if (jm.enabled == false) return;
+
+	const fiq_cell_t *cell = (const fiq_cell_t *)buf;
+	const fiq_cell_t *end = cell + len / sizeof(fiq_cell_t);
+
+	for (; cell < end; cell++) {
+		uint64_t window = jm.ticks / JM_WINDOW_TICKS;
+		if (window != jm.window) { _end_window(window);}
+		jm.window_cells++;
+		for (uint8_t motor=MOTOR_1; motor<MOTOR_6; motor++) {
+			if (cell->set & step_bit[motor]) { jm.steps[motor]++;}
+		}
+		jm.ticks += cell->timer;
+	}
+	jm.cells += end - (const fiq_cell_t *)buf;
+}
+
+/*
+ * jm_write() - write the metrics of the job just finished
+ *
+ *	status is the job's, cached is true if the output came from the output cache.
+ */
+stat_t jm_write(const char *path, stat_t status, uint8_t cached)
+{
+	char tmp_path[FILE_PATH_NAME_LEN + 4];
+	FILE *f;
+	struct rusage usage;
+
+	snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path);
+	if ((f = fopen(tmp_path, "w")) == NULL) { return (STAT_FILE_NOT_OPEN);}
+
+	fprintf(f, "{\n  \"version\": %d,\n", JM_VERSION);
+	_print_string(f, "gcode", GcodePathFile);
+	_print_string(f, "fiq", FcodePathFile);
+	_print_string(f, "status", (status == STAT_OK) ? "ok" :
+				  (status == STAT_OUTPUT_DRIFT) ? "drift" : get_status_message(status));
+	fprintf(f, "  \"cached\": %s,\n", cached ? "true" : "false");
+	if (cached == false) {
+		_end_window(jm.window + 1);				// the last, part filled window
+		fprintf(f, "  \"lines\": %u,\n", cs.lineNumber);
+		fprintf(f, "  \"blocks\": %u,\n", mp_get_total_moves());
+		fprintf(f, "  \"arcs\": %u,\n", jm.arcs);
+		fprintf(f, "  \"fitted_arcs\": %u,\n", mp_get_total_arcs());
+		fprintf(f, "  \"segments\": %u,\n", mp_get_total_segments());
+		fprintf(f, "  \"cells\": { \"total\": %llu", (unsigned long long)jm.cells);
+		for (uint8_t motor=MOTOR_1; motor<MOTOR_6; motor++) {
+			fprintf(f, ", \"%s\": %llu", motor_name[motor], (unsigned long long)jm.steps[motor]);
+		}
+		fprintf(f, " },\n");
+		fprintf(f, "  \"ticks\": %llu,\n", (unsigned long long)jm.ticks);
+		fprintf(f, "  \"tick_hz\": %lu,\n", FREQUENCY_DDA);
+		fprintf(f, "  \"window_ms\": %d,\n", JM_WINDOW_MS);
+		fprintf(f, "  \"peak_cells\": %u,\n", _window_percentile(1.0));
+		fprintf(f, "  \"p99_cells\": %u,\n", _window_percentile(0.99));
+		fprintf(f, "  \"starved_blocks\": %u,\n", jm.starved);
+		fprintf(f, "  \"clamped_moves\": %u,\n", jm.clamped);
+		if (strlen(BlockLogPathFile) != 0) {
+			fprintf(f, "  \"lookahead_limited_blocks\": %u,\n", diag.total_limited);
+			fprintf(f, "  \"lookahead_lost_s\": %.3f,\n", diag.total_lost);
+		}
+		if (isVerifying) {
+			fprintf(f, "  \"verified_blocks\": %u,\n", vf.checked);
+			fprintf(f, "  \"verify_off_blocks\": %u,\n", vf.total_off);
+			fprintf(f, "  \"verify_max_steps\": {");
+			for (uint8_t motor=MOTOR_1; motor<MOTOR_6; motor++) {
+				fprintf(f, "%s \"%s\": %.3f", (motor == MOTOR_1) ? "" : ",", motor_name[motor], vf.max_miss[motor]);
+			}
+			fprintf(f, " },\n");
+		}
+	}
+	fprintf(f, "  \"wall_s\": %.3f,\n", (_now() - jm.start) / 1e9);
+	if (getrusage(RUSAGE_SELF, &usage) == 0) {
+		fprintf(f, "  \"peak_rss_kb\": %ld,\n", usage.ru_maxrss);
+	}
+#ifdef __PROFILE
+	if (cached == false) {
+		fprintf(f, "  \"stage_ms\": {");
+		for (uint8_t stage=0; stage<PROF_STAGES; stage++) {
+			fprintf(f, "%s \"%s\": %.3f", (stage == 0) ? "" : ",", prof_stage_name(stage), prof_stage_ns(stage) / 1e6);
+		}
+		fprintf(f, " },\n");
+	}
+#endif
+	fprintf(f, "  \"bytes_in\": %llu,\n", (unsigned long long)xw.bytes_in);
+	fprintf(f, "  \"bytes_out\": %llu,\n", (unsigned long long)xw.bytes_out);
+	fprintf(f, "  \"compression_ratio\": %.3f\n}\n",
+			(xw.bytes_out == 0) ? 1.0 : (double)xw.bytes_in / xw.bytes_out);
+
+	if ((fclose(f) != 0) || (rename(tmp_path, path) != 0)) {
+		remove(tmp_path);
+		return (STAT_FILE_NOT_OPEN);
+	}
+	return (STAT_OK);
+}
+
+/*
+ * _now()		 - CLOCK_MONOTONIC in ns
+ * _end_window() - count the cells of the current window and move on to window,
+ *				   counting any windows skipped over as empty
+ * _window_percentile() - cells in the window at the fraction'th place, fewest first
+ * _print_string() - print a "name": "value" member, escaping the value
+ */
+static uint64_t _now()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec);
+}
+
+static void _end_window(uint64_t window)
+{
+	hist[min(jm.window_cells, (uint32_t)JM_WINDOW_TICKS)]++;
+	hist[0] += window - jm.window - 1;
+	jm.window = window;
+	jm.window_cells = 0;
+}
+
+static uint32_t _window_percentile(float fraction)
+{
+	uint64_t windows = 0;
+	for (uint32_t i=0; i<=JM_WINDOW_TICKS; i++) { windows += hist[i];}
+
+	uint64_t rank = (uint64_t)(fraction * windows);
+	if (rank == windows) { rank = windows - 1;}		// the peak
+	uint64_t count = 0;
+	for (uint32_t i=0; i<=JM_WINDOW_TICKS; i++) {
+		count += hist[i];
+		if (count > rank) return (i);
+	}
+	return (0);
+}
+
+static void _print_string(FILE *f, const char *name, const char *value)
+{
+	fprintf(f, "  \"%s\": \"", name);
+	for (; *value != NUL; value++) {
+		if ((*value == '"') || (*value == '\\')) {
+			fprintf(f, "\\%c", *value);
+		} else if ((uint8_t)*value < ' ') {
+			fprintf(f, "\\u%04x", *value);
+		} else {
+			fputc(*value, f);
+		}
+	}
+	fprintf(f, "\",\n");
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,493 @@
+/*
+ * FILE NAME: microbench.cpp - planner and stepper kernel microbenchmarks
+ *
+ * Copyright (c) 2014 Robert K. Parker
+ *
+ * This file was part of the TinyG project
+ *
+ * Copyright (c) 2010 - 2013 Alden S. Hart, Jr.
+ *
+ * Now it is in crystalfontz3D
+ *
+ * This file ("the software") is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2 as published by the
+ * Free Software Foundation. You should have received a copy of the GNU General Public
+ * License, version 2 along with the software.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * THE SOFTWARE IS DISTRIBUTED IN THE HOPE THAT IT WILL BE USEFUL, BUT WITHOUT ANY
+ * WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT
+ * SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+/*
+ * PURPOSE:	Times the planner and stepper kernels one at a time, on inputs recorded
+ *			from a real conversion.
+ *
+ * NOTES:	See microbench.h.
+ *
+ *
+ * CHANGE HISTORY:
+ *
+ *    Revision: Initial 1.0
+ *    User: R.K.Parker     Date: 05/29/14
+ *    First prototype.
+ *
+ */
+
+#include "tinyg2.h"			// #1
+#include "config.h"			// #2
+#include "controller.h"
+#include "canonical_machine.h"
+#include "gcode_parser.h"
+#include "planner.h"
+#include "kinematics.h"
+#include "stepper.h"
+#include "microbench.h"
+#include "quicklz.h"
+#include "util.h"
+#include "xio.h"
+#include "cfa10049_fiq.h"
+
+#ifdef __MICROBENCH
+
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+mbSingleton_t bench;					// microbenchmark singleton
+
+// recorded inputs of each kernel
+
+typedef struct mbJunction {
+	float a_unit[AXES];
+	float b_unit[AXES];
+} mbJunction_t;
+
+typedef struct mbTargetVelocity {
+	float Vi;
+	float L;
+	float jerk;
+	float cbrt_jerk;
+	float recip_jerk;
+} mbTargetVelocity_t;
+
+typedef struct mbAline {
+	GCodeState_t gm;
+	float position[AXES];				// mm.position - where the move starts
+} mbAline_t;
+
+typedef struct mbSegment {
+	mpMoveRuntimeSingleton_t mr;
+	uint8_t correction_flag;
+} mbSegment_t;
+
+typedef struct mbMove {					// ik_kinematics() and st_prep_line()
+	float vector[AXES];					// travel, or steps
+	float microseconds;
+} mbMove_t;
+
+typedef struct mbOutput {
+	stRunSingleton_t run;
+	fiq_line_t out;						// the cell being timed as the segment is loaded
+} mbOutput_t;
+
+typedef struct mbBuffer {
+	char *buf;
+	size_t len;
+} mbBuffer_t;
+
+static mpBuf_t trapezoid[MB_SAMPLES];
+static mbJunction_t junction[MB_SAMPLES];
+static mbTargetVelocity_t target_velocity[MB_SAMPLES];
+static mbAline_t aline[MB_SAMPLES];
+static mbSegment_t segment[MB_SAMPLES];
+static mbMove_t kinematics[MB_SAMPLES];
+static mbMove_t prep_line[MB_SAMPLES];
+static mbOutput_t output[MB_SAMPLES];
+static mbBuffer_t buffer[MB_BUFFERS];
+static char *block[MB_SAMPLES];
+
+// scratch the kernels are run on
+static mpBuf_t bf;
+static float steps[MOTORS];
+static char line[INPUT_BUFFER_LEN];
+static char *packet;
+static qlz_state_compress *state;
+
+typedef struct mbKernelDef {
+	const char *name;
+	void (*setup)(uint8_t begin);		// before and after the kernel's passes; NULL if none
+	void (*restore)(uint32_t i);		// put back the state sample i was called with; NULL if none
+	void (*run)(uint32_t i);			// call the kernel with sample i
+} mbKernelDef_t;
+
+static void _restore_trapezoid(uint32_t i);
+static void _run_trapezoid(uint32_t i);
+static void _run_junction(uint32_t i);
+static void _restore_target_velocity(uint32_t i);
+static void _run_target_velocity(uint32_t i);
+static void _setup_aline(uint8_t begin);
+static void _restore_aline(uint32_t i);
+static void _run_aline(uint32_t i);
+static void _setup_exec(uint8_t begin);
+static void _restore_segment(uint32_t i);
+static void _run_segment(uint32_t i);
+static void _run_kinematics(uint32_t i);
+static void _run_prep_line(uint32_t i);
+static void _setup_output(uint8_t begin);
+static void _restore_output(uint32_t i);
+static void _run_output(uint32_t i);
+static void _setup_compress(uint8_t begin);
+static void _run_compress(uint32_t i);
+static void _restore_parser(uint32_t i);
+static void _run_parser(uint32_t i);
+
+static const mbKernelDef_t kernel[MB_KERNELS] = {
+	{ "calculate_trapezoid",	NULL,			_restore_trapezoid,			_run_trapezoid },
+	{ "get_junction_vmax",		NULL,			NULL,						_run_junction },
+	{ "get_target_velocity",	NULL,			_restore_target_velocity,	_run_target_velocity },
+	{ "mp_aline",				_setup_aline,	_restore_aline,				_run_aline },
+	{ "exec_aline_segment",		_setup_exec,	_restore_segment,			_run_segment },
+	{ "ik_kinematics",			NULL,			NULL,						_run_kinematics },
+	{ "st_prep_line",			_setup_exec,	NULL,						_run_prep_line },
+	{ "output_to_FIQ",			_setup_output,	_restore_output,			_run_output },
+	{ "qlz_compress",			_setup_compress, NULL,						_run_compress },
+	{ "gc_gcode_parser",		NULL,			_restore_parser,			_run_parser }
+};
+
+static int32_t _slot(uint8_t k, uint32_t size);
+static uint8_t _poll(void);
+static void _bench(uint8_t k);
+static uint64_t _pass(const mbKernelDef_t *def, uint32_t samples, uint32_t reps, uint8_t run);
+static uint64_t _now(void);
+
+/*
+ * mb_run() - record the -g file's kernel inputs, then time each kernel on them
+ *
+ *	Takes over from controller_run() in 10049G2_bench (main.cpp).
+ */
+stat_t mb_run()
+{
+	stat_t status;
+
+	if (strlen(GcodePathFile) == 0) {
+		printf("10049G2_bench records from a G code file: -g <file>\n");
+		return (STAT_FILE_NOT_OPEN);
+	}
+	strncpy(FcodePathFile, "/dev/null", FILE_PATH_NAME_LEN);	// the output isn't needed
+
+	memset(&bench, 0, sizeof(bench));
+	bench.seed = 1;						// the same samples each run
+	bench.recording = true;
+	status = controller_run_job(_poll);
+	bench.recording = false;
+	if (status != STAT_OK) {
+		printf("Can't record the kernels from %s: %s\n", GcodePathFile, get_status_message(status));
+		return (status);
+	}
+
+	printf("Kernel timings on inputs recorded from %s, ns per call over %d passes:\n", GcodePathFile, MB_PASSES);
+	printf("  kernel                    calls  samples      mean        sd     cv       min\n");
+	bench.replaying = true;
+	for (uint8_t k=0; k<MB_KERNELS; k++) { _bench(k);}
+	bench.replaying = false;
+	return (STAT_OK);
+}
+
+/*
+ * _bench() - time a kernel and print its line
+ *
+ *	A first pass over the samples warms the caches and sets the repeats that make a
+ *	pass MB_PASS_NS. A kernel with a restore is timed again with only the restore,
+ *	and that is taken off.
+ */
+static void _bench(uint8_t k)
+{
+	const mbKernelDef_t *def = &kernel[k];
+	uint32_t samples = bench.samples[k];
+	uint32_t reps;
+	double per_call[MB_PASSES];
+	double mean = 0, var = 0, min_ns = 0;
+
+	printf("  %-20s %10llu %8u", def->name, (unsigned long long)bench.calls[k], samples);
+	if (samples == 0) {
+		printf("  not called\n");
+		return;
+	}
+	if (def->setup != NULL) { def->setup(true);}
+
+	uint64_t ns = _pass(def, samples, 1, true);
+	reps = (ns >= MB_PASS_NS) ? 1 : (uint32_t)(MB_PASS_NS / (ns + 1)) + 1;
+	for (uint8_t p=0; p<MB_PASSES; p++) {
+		int64_t run_ns = _pass(def, samples, reps, true);
+		if (def->restore != NULL) { run_ns -= _pass(def, samples, reps, false);}
+		per_call[p] = (run_ns < 0) ? 0 : (double)run_ns / ((double)reps * samples);
+		mean += per_call[p] / MB_PASSES;
+		if ((p == 0) || (per_call[p] < min_ns)) { min_ns = per_call[p];}
+	}
+	for (uint8_t p=0; p<MB_PASSES; p++) { var += square(per_call[p] - mean) / (MB_PASSES - 1);}
+
+	if (def->setup != NULL) { def->setup(false);}
+	printf(" %9.1f %9.1f %5.1f%% %9.1f\n", mean, sqrt(var), (mean > 0) ? 100 * sqrt(var) / mean : 0, min_ns);
+}
+
+static uint64_t _pass(const mbKernelDef_t *def, uint32_t samples, uint32_t reps, uint8_t run)
+{
+	uint64_t start = _now();
+
+	for (uint32_t r=0; r<reps; r++) {
+		for (uint32_t i=0; i<samples; i++) {
+			if (def->restore != NULL) { def->restore(i);}
+			if (run) { def->run(i);}
+		}
+	}
+	return (_now() - start);
+}
+
+static uint64_t _now()
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec);
+}
+
+static uint8_t _poll()
+{
+	return (false);						// nothing cancels the recording
+}
+
+/*
+ * _slot() - sample slot for a kernel's next call, or -1 if it isn't kept
+ *
+ *	The first size calls fill the slots. After that call n replaces a random slot
+ *	with a chance of size / n, so every call is as likely to be kept - except
+ *	mp_aline()'s, which keeps its first calls so each move follows the one before.
+ */
+static int32_t _slot(uint8_t k, uint32_t size)
+{
+	uint64_t n = bench.calls[k]++;
+
+	if (n < size) {
+		bench.samples[k]++;
+		return ((int32_t)n);
+	}
+	if (k == MB_ALINE) return (-1);
+	bench.seed = bench.seed * 6364136223846793005ULL + 1442695040888963407ULL;
+	uint64_t slot = (bench.seed >> 16) % (n + 1);
+	return ((slot < size) ? (int32_t)slot : -1);
+}
+
+/*
+ * mb_record_...() - keep a kernel's inputs; called by MB_RECORD() as it starts
+ */
+void mb_record_trapezoid(const mpBuf_t *bp)
+{
+	int32_t i = _slot(MB_TRAPEZOID, MB_SAMPLES);
+	if (i >= 0) { memcpy(&trapezoid[i], bp, sizeof(mpBuf_t));}
+}
+
+void mb_record_junction(const float a_unit[], const float b_unit[])
+{
+	int32_t i = _slot(MB_JUNCTION, MB_SAMPLES);
+	if (i < 0) return;
+	copy_axis_vector(junction[i].a_unit, a_unit);
+	copy_axis_vector(junction[i].b_unit, b_unit);
+}
+
+void mb_record_target_velocity(const float Vi, const float L, const mpBuf_t *bp)
+{
+	int32_t i = _slot(MB_TARGET_VELOCITY, MB_SAMPLES);
+	if (i < 0) return;
+	target_velocity[i].Vi = Vi;
+	target_velocity[i].L = L;
+	target_velocity[i].jerk = bp->jerk;
+	target_velocity[i].cbrt_jerk = bp->cbrt_jerk;
+	target_velocity[i].recip_jerk = bp->recip_jerk;
+}
+
+void mb_record_aline(const GCodeState_t *gm_line)
+{
+	int32_t i = _slot(MB_ALINE, MB_SAMPLES);
+	if (i < 0) return;
+	memcpy(&aline[i].gm, gm_line, sizeof(GCodeState_t));
+	copy_axis_vector(aline[i].position, mm.position);
+}
+
+void mb_record_segment(uint8_t correction_flag)
+{
+	int32_t i = _slot(MB_SEGMENT, MB_SAMPLES);
+	if (i < 0) return;
+	memcpy(&segment[i].mr, &mr, sizeof(mr));
+	segment[i].correction_flag = correction_flag;
+}
+
+void mb_record_kinematics(const float travel[], const float microseconds)
+{
+	int32_t i = _slot(MB_KINEMATICS, MB_SAMPLES);
+	if (i < 0) return;
+	copy_axis_vector(kinematics[i].vector, travel);
+	kinematics[i].microseconds = microseconds;
+}
+
+void mb_record_prep_line(const float steps[], const float microseconds)
+{
+	int32_t i = _slot(MB_PREP_LINE, MB_SAMPLES);
+	if (i < 0) return;
+	memcpy(prep_line[i].vector, steps, sizeof(float) * MOTORS);
+	prep_line[i].microseconds = microseconds;
+}
+
+void mb_record_output(const stRunSingleton_t *run, const void *out)
+{
+	int32_t i = _slot(MB_OUTPUT_FIQ, MB_SAMPLES);
+	if (i < 0) return;
+	memcpy(&output[i].run, run, sizeof(stRunSingleton_t));
+	memcpy(&output[i].out, out, sizeof(fiq_line_t));
+}
+
+void mb_record_buffer(const char *buf, size_t len)
+{
+	int32_t i = _slot(MB_COMPRESS, MB_BUFFERS);
+	if (i < 0) return;
+	if (buffer[i].buf == NULL) {
+		if ((buffer[i].buf = (char *)malloc(XIO_WRITE_BUFFER_LEN)) == NULL) {
+			bench.samples[MB_COMPRESS]--;			// only a first fill can fail - it is the last slot
+			return;
+		}
+	}
+	memcpy(buffer[i].buf, buf, len);
+	buffer[i].len = len;
+}
+
+void mb_record_block(const char *text)
+{
+	int32_t i = _slot(MB_PARSER, MB_SAMPLES);
+	if (i < 0) return;
+	free(block[i]);
+	if ((block[i] = strdup(text)) == NULL) {
+		block[i] = strdup("");						// still a block for the slot
+	}
+}
+
+/*
+ * The kernels, as run on the samples
+ */
+static void _restore_trapezoid(uint32_t i) { memcpy(&bf, &trapezoid[i], sizeof(mpBuf_t));}
+static void _run_trapezoid(uint32_t i) { mp_calculate_trapezoid(&bf);}
+
+static void _run_junction(uint32_t i)
+{
+	bench.sink = mp_get_junction_vmax(junction[i].a_unit, junction[i].b_unit);
+}
+
+static void _restore_target_velocity(uint32_t i)
+{
+	bf.jerk = target_velocity[i].jerk;
+	bf.cbrt_jerk = target_velocity[i].cbrt_jerk;
+	bf.recip_jerk = target_velocity[i].recip_jerk;
+}
+
+static void _run_target_velocity(uint32_t i)
+{
+	bench.sink = mp_get_target_velocity(target_velocity[i].Vi, target_velocity[i].L, &bf);
+}
+
+// mp_aline() with the stepper held off, so the moves queue up planned and unrun
+static void _setup_aline(uint8_t begin)
+{
+	static uint8_t exec_state;
+
+	mp_flush_planner();
+	if (begin) {
+		exec_state = st_bench_exec_state(PREP_BUFFER_OWNED_BY_LOADER);
+	} else {
+		st_bench_exec_state(exec_state);
+	}
+}
+
+static void _restore_aline(uint32_t i)
+{
+	if ((i % MB_ALINE_BATCH) == 0) { mp_flush_planner();}
+	copy_axis_vector(mm.position, aline[i].position);
+}
+
+static void _run_aline(uint32_t i) { mp_aline(&aline[i].gm);}
+
+// segments are prepped for a loader that never comes
+static void _setup_exec(uint8_t begin)
+{
+	static uint8_t exec_state;
+
+	if (begin) {
+		exec_state = st_bench_exec_state(PREP_BUFFER_OWNED_BY_EXEC);
+	} else {
+		st_bench_exec_state(exec_state);
+	}
+}
+
+static void _restore_segment(uint32_t i) { memcpy(&mr, &segment[i].mr, sizeof(mr));}
+static void _run_segment(uint32_t i) { mp_bench_exec_aline_segment(segment[i].correction_flag);}
+
+static void _run_kinematics(uint32_t i)
+{
+	ik_kinematics(kinematics[i].vector, steps, kinematics[i].microseconds);
+}
+
+static void _run_prep_line(uint32_t i)
+{
+	st_prep_line(prep_line[i].vector, prep_line[i].microseconds);
+}
+
+// the cells go to a buffer that is emptied before each call, so it is never written
+static void _setup_output(uint8_t begin)
+{
+	if (begin) {
+		xw.buf = (char *)malloc(XIO_WRITE_BUFFER_LEN);
+	} else {
+		free(xw.buf);
+		xw.buf = NULL;
+	}
+	xw.len = 0;
+}
+
+static void _restore_output(uint32_t i)
+{
+	st_bench_load(&output[i].run, &output[i].out);
+	xw.len = 0;
+}
+
+static void _run_output(uint32_t i) { st_bench_output_to_FIQ();}
+
+// the compressor keeps its state across buffers, as it does writing a file
+static void _setup_compress(uint8_t begin)
+{
+	if (begin) {
+		packet = (char *)malloc(XIO_WRITE_BUFFER_LEN + 400);
+		state = (qlz_state_compress *)calloc(1, sizeof(qlz_state_compress));
+	} else {
+		free(packet);
+		free(state);
+		packet = NULL;
+		state = NULL;
+	}
+}
+
+static void _run_compress(uint32_t i)
+{
+	bench.sink = qlz_compress(buffer[i].buf, packet, buffer[i].len, state);
+}
+
+// gc_gcode_parser() stops short of running the block while bench.replaying
+static void _restore_parser(uint32_t i) { strncpy(line, block[i], INPUT_BUFFER_LEN - 1);}
+static void _run_parser(uint32_t i) { gc_gcode_parser(line);}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __MICROBENCH
@@ -0,0 +1,212 @@
+/*
+ * FILE NAME: profile.cpp - conversion stage timing
+ *
+ * Copyright (c) 2014 Robert K. Parker
+ *
+ * This file was part of the TinyG project
+ *
+ * Copyright (c) 2010 - 2013 Alden S. Hart, Jr.
+ *
+ * Now it is in crystalfontz3D
+ *
+ * This file ("the software") is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2 as published by the
+ * Free Software Foundation. You should have received a copy of the GNU General Public
+ * License, version 2 along with the software.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * THE SOFTWARE IS DISTRIBUTED IN THE HOPE THAT IT WILL BE USEFUL, BUT WITHOUT ANY
+ * WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT
+ * SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+/*
+ * PURPOSE:	Times each stage of the conversion, to show where the time goes.
+ *
+ * NOTES:	See profile.h. Built only with __PROFILE.
+ *
+ *
+ * CHANGE HISTORY:
+ *
+ *    Revision: Initial 1.0
+ *    User: R.K.Parker     Date: 05/29/14
+ *    First prototype.
+ *
+ */
+
+#include "tinyg2.h"			// #1
+#include "config.h"			// #2
+#include "profile.h"
+
+#ifdef __PROFILE
+
+#include <time.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+profSingleton_t prof;					// stage timing singleton
+
+static const char *const prof_name[PROF_STAGES] = {
+	"controller", "parser", "canonical", "plan line", "plan blocks", "exec move",
+	"kinematics", "prep line", "output FIQ", "compress", "write"
+};
+
+static uint64_t _now(void);
+static void _charge(uint64_t now);
+static uint8_t _bin(uint64_t ns);
+static float _percentile_us(const profStat_t *s, float fraction);
+
+/*
+ * prof_enter() - a stage begins: charge the time so far to the stage it was called from
+ * prof_exit()	- the stage ends: record its call and go back to the caller's stage
+ */
+void prof_enter(uint8_t stage)
+{
+	_charge(_now());
+	if (prof.depth == PROF_DEPTH - 1) {
+		prof.untracked++;
+		prof.untracked_calls++;
+		return;
+	}
+	prof.depth++;
+	prof.stage[prof.depth] = stage;
+	prof.self[prof.depth] = 0;
+	if (prof.depth > prof.max_depth) { prof.max_depth = prof.depth;}
+}
+
+void prof_exit()
+{
+	_charge(_now());
+	if (prof.untracked != 0) {
+		prof.untracked--;
+		return;
+	}
+	if (prof.depth == 0) return;
+
+	uint64_t ns = prof.self[prof.depth];
+	profStat_t *s = &prof.stat[prof.stage[prof.depth--]];
+	s->calls++;
+	s->ns += ns;
+	if (ns > s->max_ns) { s->max_ns = ns;}
+	s->hist[_bin(ns)]++;
+}
+
+/*
+ * prof_reset() - clear the timings. Stages open now keep running
+ */
+void prof_reset()
+{
+	memset(prof.stat, 0, sizeof(prof.stat));
+	for (uint16_t i=0; i <= prof.depth; i++) { prof.self[i] = 0;}
+	prof.max_depth = prof.depth;
+	prof.untracked_calls = 0;
+	prof.start = prof.mark = _now();
+}
+
+/*
+ * prof_print() - print the timings since the last reset
+ */
+void prof_print()
+{
+	_charge(_now());
+	uint64_t total = prof.mark - prof.start;
+	if (total == 0) { total = 1;}
+
+	printf("Stage timings over %.3f s, as self time - not counting the stages called:\n", total / 1e9);
+	printf("  stage             calls    total ms  share   mean us    p50 us    p99 us    max us\n");
+	for (uint8_t i=0; i<PROF_STAGES; i++) {
+		const profStat_t *s = &prof.stat[i];
+		uint64_t ns = s->ns + ((i == PROF_CONTROLLER) ? prof.self[0] : 0);
+		printf("  %-12s %10llu %11.3f %5.1f%%", prof_name[i], (unsigned long long)s->calls,
+			   ns / 1e6, 100.0 * ns / total);
+		if (s->calls == 0) {
+			printf("\n");
+			continue;
+		}
+		printf(" %9.3f %9.3f %9.3f %9.3f\n", s->ns / 1e3 / s->calls,
+			   _percentile_us(s, 0.50), _percentile_us(s, 0.99), s->max_ns / 1e3);
+	}
+	printf("  Deepest stage nesting %u", prof.max_depth);
+	if (prof.untracked_calls != 0) {
+		printf(", %llu calls past %u charged to their callers", (unsigned long long)prof.untracked_calls, PROF_DEPTH - 1);
+	}
+	printf(".\n");
+}
+
+/*
+ * prof_stage_name() - name of a stage, as printed
+ * prof_stage_ns()	 - self time of a stage since the last reset, ns
+ */
+const char *prof_stage_name(uint8_t stage)
+{
+	return (prof_name[stage]);
+}
+
+uint64_t prof_stage_ns(uint8_t stage)
+{
+	_charge(_now());
+	return (prof.stat[stage].ns + ((stage == PROF_CONTROLLER) ? prof.self[0] : 0));
+}
+
+/*
+ * prof_get() - $prof prints the timings
+ * prof_set() - $prof=<anything> resets them
+ */
+stat_t prof_get(cmdObj_t *cmd)
+{
+	prof_print();
+	return (STAT_OK);
+}
+
+stat_t prof_set(cmdObj_t *cmd)
+{
+	prof_reset();
+	return (STAT_OK);
+}
+
+/*
+ * _now()	- CLOCK_MONOTONIC in ns
+ * _charge() - add the time since the mark to the open call, and move the mark
+ * _bin()	- histogram bin of a time: floor(log2(ns))
+ * _percentile_us() - upper edge of the bin holding the fraction'th call, in us
+ */
+static uint64_t _now()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec);
+}
+
+static void _charge(uint64_t now)
+{
+	prof.self[prof.depth] += now - prof.mark;
+	prof.mark = now;
+}
+
+static uint8_t _bin(uint64_t ns)
+{
+	if (ns == 0) return (0);
+	uint8_t bin = 63 - __builtin_clzll(ns);
+	return ((bin < PROF_BINS) ? bin : PROF_BINS - 1);
+}
+
+static float _percentile_us(const profStat_t *s, float fraction)
+{
+	uint64_t count = 0;
+	uint64_t rank = (uint64_t)(fraction * s->calls);
+
+	for (uint8_t i=0; i<PROF_BINS; i++) {
+		count += s->hist[i];
+		if (count > rank) return ((float)((uint64_t)2 << i) / 1e3);
+	}
+	return (s->max_ns / 1e3);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __PROFILE
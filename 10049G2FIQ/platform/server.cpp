@@ -0,0 +1,384 @@
+/*
+ * FILE NAME: server.cpp - conversion job server
+ *
+ * Copyright (c) 2014 Robert K. Parker
+ *
+ * This file was part of the TinyG project
+ *
+ * Copyright (c) 2010 - 2013 Alden S. Hart, Jr.
+ *
+ * Now it is in crystalfontz3D
+ *
+ * This file ("the software") is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2 as published by the
+ * Free Software Foundation. You should have received a copy of the GNU General Public
+ * License, version 2 along with the software.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * THE SOFTWARE IS DISTRIBUTED IN THE HOPE THAT IT WILL BE USEFUL, BUT WITHOUT ANY
+ * WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT
+ * SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+/*
+ * PURPOSE:	Keeps the converter running between jobs, taking them on a UNIX socket.
+ *
+ * NOTES:	The server is single threaded. It blocks in poll() while the queue is empty
+ *	and checks for requests without blocking while a job runs, from the poll callback
+ *	of controller_run_job(). The job's console messages still go to stdout.
+ *
+ *
+ * CHANGE HISTORY:
+ *
+ *    Revision: Initial 1.0
+ *    User: R.K.Parker     Date: 05/29/14
+ *    First prototype.
+ *
+ */
+
+#include "tinyg2.h"			// #1
+#include "config.h"			// #2
+#include "controller.h"
+#include "canonical_machine.h"
+#include "gcode_cache.h"
+#include "planner.h"
+#include "plan_line.h"
+#include "stepper.h"
+#include "server.h"
+#include "xio.h"
+
+#include <errno.h>
+#include <poll.h>
+#include <stdarg.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+typedef struct srvOptions {				// the command line options a job may set
+	char gcode[FILE_PATH_NAME_LEN];
+	char fcode[FILE_PATH_NAME_LEN];
+	char cache_dir[FILE_PATH_NAME_LEN];
+	char metrics[FILE_PATH_NAME_LEN];
+	char block_log[FILE_PATH_NAME_LEN];
+	uint32_t cache_limit;
+	bool compress;
+	bool count_lines;
+	bool caching;
+	bool verifying;
+} srvOptions_t;
+
+srvSingleton_t srv;						// job server singleton
+static srvOptions_t defaults;			// the server's own command line
+
+static void _poll(int timeout);
+static void _read_client(int8_t client);
+static void _request(int8_t client, char *line);
+static void _run_job(void);
+static uint8_t _poll_job(void);
+static stat_t _set_options(char *options);
+static void _send(int8_t client, const char *format, ...);
+static void _drop(int8_t client);
+
+/*
+ * server_run() - take and run jobs until a quit request
+ *
+ *	Call after _application_init(). Returns STAT_FILE_NOT_OPEN if the socket can't
+ *	be set up. A socket file left by an earlier server is replaced.
+ */
+stat_t server_run(const char *path)
+{
+	struct sockaddr_un addr;
+
+	memset(&srv, 0, sizeof(srv));
+	for (uint8_t i=0; i<SRV_MAX_CLIENTS; i++) { srv.client[i].fd = -1;}
+	if (strlen(path) >= sizeof(addr.sun_path)) { return (STAT_FILE_NOT_OPEN);}
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	strcpy(addr.sun_path, path);
+	unlink(path);
+	if ((srv.fd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) { return (STAT_FILE_NOT_OPEN);}
+	if ((bind(srv.fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) || (chmod(path, SRV_SOCKET_MODE) != 0) ||
+		(listen(srv.fd, SRV_MAX_CLIENTS) != 0)) {
+		close(srv.fd);
+		return (STAT_FILE_NOT_OPEN);
+	}
+
+	strcpy(defaults.gcode, GcodePathFile);
+	strcpy(defaults.fcode, FcodePathFile);
+	strcpy(defaults.cache_dir, OutCachePathDir);
+	strcpy(defaults.metrics, MetricsPathFile);
+	strcpy(defaults.block_log, BlockLogPathFile);
+	defaults.cache_limit = OutCacheLimit;
+	defaults.compress = isCompressing;
+	defaults.count_lines = isCountingLines;
+	defaults.caching = isCaching;
+	defaults.verifying = isVerifying;
+	printf("Waiting for jobs on %s\n", path);
+
+	while (srv.quit == false) {
+		_poll((srv.jobs == 0) ? -1 : 0);
+		if ((srv.jobs != 0) && (srv.quit == false)) { _run_job();}
+	}
+	for (uint8_t i=0; i<srv.jobs; i++) { _send(srv.queue[i].client, "cancelled %u\n", srv.queue[i].id);}
+	for (int8_t i=0; i<SRV_MAX_CLIENTS; i++) { _drop(i);}
+	close(srv.fd);
+	unlink(path);
+	return (STAT_OK);
+}
+
+/*
+ * _poll() - accept clients and take their requests
+ *
+ *	timeout is in ms as for poll(); -1 waits for something to happen.
+ */
+static void _poll(int timeout)
+{
+	struct pollfd fds[SRV_MAX_CLIENTS+1];
+	int8_t client[SRV_MAX_CLIENTS+1];
+	nfds_t count = 1;
+
+	fds[0].fd = srv.fd;
+	fds[0].events = POLLIN;
+	for (int8_t i=0; i<SRV_MAX_CLIENTS; i++) {
+		if (srv.client[i].fd < 0) continue;
+		fds[count].fd = srv.client[i].fd;
+		fds[count].events = POLLIN;
+		client[count++] = i;
+	}
+	if (poll(fds, count, timeout) <= 0) { return;}
+
+	for (nfds_t i=1; i<count; i++) {
+		if (fds[i].revents != 0) { _read_client(client[i]);}
+	}
+	if (fds[0].revents & POLLIN) {
+		int fd = accept(srv.fd, NULL, NULL);
+		if (fd < 0) { return;}
+		for (int8_t i=0; i<SRV_MAX_CLIENTS; i++) {
+			if (srv.client[i].fd >= 0) continue;
+			srv.client[i].fd = fd;
+			srv.client[i].len = 0;
+			return;
+		}
+		close(fd);							// no free slot
+	}
+}
+
+/*
+ * _read_client() - read what a client sent and run each complete request line
+ */
+static void _read_client(int8_t client)
+{
+	srvClient_t *c = &srv.client[client];
+	ssize_t count = read(c->fd, c->buf + c->len, sizeof(c->buf) - 1 - c->len);
+
+	if (count <= 0) {
+		if ((count < 0) && (errno == EINTR)) return;
+		_drop(client);
+		return;
+	}
+	c->len += count;
+	c->buf[c->len] = NUL;
+
+	char *line = c->buf;
+	char *end;
+	while ((end = strchr(line, '\n')) != NULL) {
+		*end = NUL;
+		if ((end > line) && (end[-1] == '\r')) { end[-1] = NUL;}
+		_request(client, line);
+		if (c->fd < 0) return;				// dropped while answering
+		line = end + 1;
+	}
+	c->len -= line - c->buf;
+	memmove(c->buf, line, c->len);
+	if (c->len == sizeof(c->buf) - 1) {		// a line too long to be a request
+		_send(client, "error request too long\n");
+		c->len = 0;
+	}
+}
+
+/*
+ * _request() - run one request line
+ */
+static void _request(int8_t client, char *line)
+{
+	char *args = line + strcspn(line, " \t");
+	if (*args != NUL) { *args++ = NUL;}
+	args += strspn(args, " \t");
+
+	if (strcmp(line, "job") == 0) {
+		if (srv.jobs == SRV_MAX_JOBS) {
+			_send(client, "error queue full\n");
+			return;
+		}
+		srvJob_t *job = &srv.queue[srv.jobs++];
+		job->id = ++srv.next_id;
+		job->client = client;
+		strcpy(job->options, args);
+		_send(client, "queued %u\n", job->id);
+
+	} else if (strcmp(line, "cancel") == 0) {
+		uint32_t id = strtoul(args, NULL, 10);
+		if ((srv.running) && (srv.job.id == id)) {
+			srv.cancel = true;				// the job sends the record as it stops
+			return;
+		}
+		for (uint8_t i=0; i<srv.jobs; i++) {
+			if (srv.queue[i].id != id) continue;
+			_send(srv.queue[i].client, "cancelled %u\n", id);
+			memmove(&srv.queue[i], &srv.queue[i+1], (srv.jobs - i - 1) * sizeof(srvJob_t));
+			srv.jobs--;
+			return;
+		}
+		_send(client, "error no job %u\n", id);
+
+	} else if (strcmp(line, "quit") == 0) {
+		srv.quit = true;
+
+	} else if (line[0] != NUL) {
+		_send(client, "error unknown request %s\n", line);
+	}
+}
+
+/*
+ * _run_job() - run the oldest queued job
+ */
+static void _run_job()
+{
+	stat_t status;
+
+	memcpy(&srv.job, &srv.queue[0], sizeof(srvJob_t));
+	memmove(&srv.queue[0], &srv.queue[1], (--srv.jobs) * sizeof(srvJob_t));
+	if (_set_options(srv.job.options) != STAT_OK) {
+		_send(srv.job.client, "failed %u bad options\n", srv.job.id);
+		return;
+	}
+
+	// the same order as _application_init() - config first
+	config_init();
+	planner_init();
+	canonical_machine_init();
+	stepper_init();
+
+	_send(srv.job.client, "started %u\n", srv.job.id);
+	srv.running = true;
+	srv.cancel = false;
+	status = controller_run_job(_poll_job);
+	srv.running = false;
+
+	if (status == STAT_OK) {
+		_send(srv.job.client, "done %u %u %u\n", srv.job.id, mp_get_total_segments(), mp_get_total_moves());
+	} else if (status == STAT_TERMINATE) {
+		_send(srv.job.client, "cancelled %u\n", srv.job.id);
+	} else {
+		_send(srv.job.client, "failed %u %s\n", srv.job.id, get_status_message(status));
+	}
+}
+
+/*
+ * _poll_job() - progress callback of the running job. Returns true to cancel it
+ */
+static uint8_t _poll_job()
+{
+	int8_t percent = (gcc.mode == GC_CACHE_READ) ? gc_cache_get_percent() : xio_get_percent();
+
+	_send(srv.job.client, "progress %u %d %d\n", srv.job.id, cs.lineNumber, percent);
+	_poll(0);
+	return (srv.cancel);
+}
+
+/*
+ * _set_options() - set the command line globals from a job's options
+ *
+ *	Options not given keep the server's own. The G code and FIQ files must be
+ *	named, and can't be stdin or stdout - those belong to the server.
+ */
+static stat_t _set_options(char *options)
+{
+	char *argv[SRV_MAX_ARGS];
+	int argc = 0;
+
+	strcpy(GcodePathFile, defaults.gcode);
+	strcpy(FcodePathFile, defaults.fcode);
+	strcpy(OutCachePathDir, defaults.cache_dir);
+	strcpy(MetricsPathFile, defaults.metrics);
+	strcpy(BlockLogPathFile, defaults.block_log);
+	OutCacheLimit = defaults.cache_limit;
+	isCompressing = defaults.compress;
+	isCountingLines = defaults.count_lines;
+	isCaching = defaults.caching;
+	isVerifying = defaults.verifying;
+
+	for (char *word = strtok(options, " \t"); word != NULL; word = strtok(NULL, " \t")) {
+		if (argc == SRV_MAX_ARGS) { return (STAT_INPUT_EXCEEDS_MAX_LENGTH);}
+		argv[argc++] = word;
+	}
+	for (int i=0; i<argc; i++) {
+		const char *arg = argv[i];
+		if ((arg[0] != '-') || (arg[1] == NUL) || (arg[2] != NUL)) { return (STAT_UNRECOGNIZED_COMMAND);}
+		if (strchr("gfjbkK", arg[1]) != NULL) {
+			if (++i == argc) { return (STAT_UNRECOGNIZED_COMMAND);}
+			if (strlen(argv[i]) >= FILE_PATH_NAME_LEN) { return (STAT_INPUT_EXCEEDS_MAX_LENGTH);}
+		}
+		switch (arg[1]) {
+			case 'g': strcpy(GcodePathFile, argv[i]); break;
+			case 'f': strcpy(FcodePathFile, argv[i]); break;
+			case 'j': strcpy(MetricsPathFile, argv[i]); break;
+			case 'b': strcpy(BlockLogPathFile, argv[i]); break;
+			case 'k': strcpy(OutCachePathDir, argv[i]); break;
+			case 'K': OutCacheLimit = strtoul(argv[i], NULL, 10); break;
+			case 'v': isCompressing = true; break;
+			case 'l': isCountingLines = true; break;
+			case 'p': isCaching = true; break;
+			case 'V': isVerifying = true; break;
+			default: return (STAT_UNRECOGNIZED_COMMAND);
+		}
+	}
+	if ((GcodePathFile[0] == NUL) || (strcmp(GcodePathFile, XIO_STDIO) == 0) ||
+		(strcmp(FcodePathFile, XIO_STDIO) == 0)) {
+		return (STAT_UNRECOGNIZED_COMMAND);
+	}
+	return (STAT_OK);
+}
+
+/*
+ * _send() - send a record to a client, if it is still connected
+ *
+ *	A client that can't take a record is dropped rather than block the server.
+ */
+static void _send(int8_t client, const char *format, ...)
+{
+	char buf[SRV_LINE_LEN];
+	va_list args;
+
+	if ((client < 0) || (srv.client[client].fd < 0)) return;
+	va_start(args, format);
+	int len = vsnprintf(buf, sizeof(buf), format, args);
+	va_end(args);
+	if (len >= (int)sizeof(buf)) { len = sizeof(buf) - 1;}
+	if (send(srv.client[client].fd, buf, len, MSG_NOSIGNAL | MSG_DONTWAIT) != len) { _drop(client);}
+}
+
+/*
+ * _drop() - disconnect a client. Its jobs still run, without records
+ */
+static void _drop(int8_t client)
+{
+	if (srv.client[client].fd < 0) return;
+	close(srv.client[client].fd);
+	srv.client[client].fd = -1;
+	if (srv.job.client == client) { srv.job.client = -1;}
+	for (uint8_t i=0; i<srv.jobs; i++) {
+		if (srv.queue[i].client == client) { srv.queue[i].client = -1;}
+	}
+}
+
+#ifdef __cplusplus
+}
+#endif
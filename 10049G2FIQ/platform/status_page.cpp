@@ -0,0 +1,156 @@
+/*
+ * FILE NAME: status_page.cpp - shared memory status page
+ *
+ * Copyright (c) 2014 Robert K. Parker
+ *
+ * This file was part of the TinyG project
+ *
+ * Copyright (c) 2010 - 2013 Alden S. Hart, Jr.
+ *
+ * Now it is in crystalfontz3D
+ *
+ * This file ("the software") is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2 as published by the
+ * Free Software Foundation. You should have received a copy of the GNU General Public
+ * License, version 2 along with the software.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * THE SOFTWARE IS DISTRIBUTED IN THE HOPE THAT IT WILL BE USEFUL, BUT WITHOUT ANY
+ * WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT
+ * SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+/*
+ * PURPOSE:	Publishes the converter's state in a shared memory page for the UI to poll.
+ *
+ * NOTES:	See status_page.h for the page layout and how to read it.
+ *
+ *
+ * CHANGE HISTORY:
+ *
+ *    Revision: Initial 1.0
+ *    User: R.K.Parker     Date: 05/29/14
+ *    First prototype.
+ *
+ */
+
+#include "tinyg2.h"			// #1
+#include "config.h"			// #2
+#include "controller.h"
+#include "canonical_machine.h"
+#include "gcode_cache.h"
+#include "planner.h"
+#include "status_page.h"
+#include "xio.h"
+#include "cfa10049_fiq.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+spSingleton_t sp;						// status page singleton
+
+static void _begin_write(void);
+static void _end_write(void);
+
+/*
+ * sp_open() - map the status page file, creating it if need be
+ *
+ *	The page is cleared and stamped with the layout version before it is used. seq
+ *	is made odd directly rather than by _begin_write(): a run killed inside
+ *	sp_update() leaves it odd, and one more would leave every later write inverted.
+ */
+stat_t sp_open(const char *path)
+{
+	int fd;
+	void *page;
+
+	if ((fd = open(path, O_RDWR | O_CREAT, 0644)) < 0) { return (STAT_FILE_NOT_OPEN);}
+	if (ftruncate(fd, sizeof(spPage_t)) != 0) {
+		close(fd);
+		return (STAT_FILE_NOT_OPEN);
+	}
+	page = mmap(NULL, sizeof(spPage_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);								// the mapping keeps the file
+	if (page == MAP_FAILED) { return (STAT_FILE_NOT_OPEN);}
+
+	sp.page = (spPage_t *)page;
+	uint32_t seq = sp.page->seq | 1;		// odd, even if an earlier run was killed mid-write
+	__atomic_store_n(&sp.page->seq, seq, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+	memset(sp.page, 0, sizeof(spPage_t));
+	sp.page->seq = seq;						// a page left by an earlier run counts on
+	sp.page->magic = SP_MAGIC;
+	sp.page->version = SP_VERSION;
+	sp.page->size = sizeof(spPage_t);
+	sp.page->pid = getpid();
+	sp.page->percent = -1;
+	_end_write();
+	return (STAT_OK);
+}
+
+/*
+ * sp_update() - publish the converter's current state
+ */
+void sp_update()
+{
+	if (sp.page == NULL) return;
+
+	_begin_write();
+	sp.page->line = cs.lineNumber;
+	sp.page->total_lines = cs.totalLineNumber;
+	sp.page->percent = (gcc.mode == GC_CACHE_READ) ? gc_cache_get_percent() : xio_get_percent();
+	sp.page->cells = (xw.bytes_in + xw.len) / sizeof(fiq_cell_t);
+	for (uint8_t axis=0; axis<AXES; axis++) {
+		sp.page->position[axis] = mp_get_runtime_absolute_position(axis);
+	}
+	sp.page->velocity = mp_get_runtime_velocity();
+	sp.page->controller_state = cs.state;
+	sp.page->machine_state = cm_get_machine_state();
+	sp.page->cycle_state = cm_get_cycle_state();
+	sp.page->motion_state = cm_get_motion_state();
+	sp.page->planner_depth = mp_get_planner_buffers_in_use();
+	_end_write();
+}
+
+/*
+ * sp_error() - publish an error response and the block that caused it
+ */
+void sp_error(stat_t status, const char *block)
+{
+	if (sp.page == NULL) return;
+
+	_begin_write();
+	sp.page->last_status = status;
+	sp.page->errors++;
+	sp.page->error_line = cs.lineNumber;
+	size_t len = strcspn(block, "\r\n");				// without the line end
+	if (len > SP_ERROR_LEN - 1) { len = SP_ERROR_LEN - 1;}
+	memcpy(sp.page->last_error, block, len);
+	sp.page->last_error[len] = NUL;
+	_end_write();
+}
+
+/*
+ * _begin_write() - make seq odd: readers retry until _end_write()
+ * _end_write()	  - make seq even again, after the fields are written
+ */
+static void _begin_write()
+{
+	__atomic_store_n(&sp.page->seq, sp.page->seq + 1, __ATOMIC_RELAXED);
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+static void _end_write()
+{
+	__atomic_store_n(&sp.page->seq, sp.page->seq + 1, __ATOMIC_RELEASE);
+}
+
+#ifdef __cplusplus
+}
+#endif
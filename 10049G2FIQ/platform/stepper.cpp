@@ -51,9 +51,12 @@
 #include "config.h"
 #include "stepper.h"
 #include "planner.h"
+#include "profile.h"
+#include "microbench.h"
 #include "hardware.h"
 #include "text_parser.h"
 #include "cfa10049_fiq.h"
+#include "xio.h"
 
 
 //#define ENABLE_DIAGNOSTICS
@@ -74,8 +77,13 @@ static fiq_line_t FIQ_Step_Out;
 /**** Setup local functions ****/
 
 static void _load_move(void);
+static void _load_curve(void);
+static void _reverse_phase(uint8_t motor);
 static void _clear_diagnostic_counters(void);
 
+static const unsigned int Step_Bit[MOTOR_6] = { X_STEP_BIT, Y_STEP_BIT, Z_STEP_BIT, A_STEP_BIT, B_STEP_BIT };
+static const unsigned int Dir_Bit[MOTOR_6]  = { X_DIR_BIT,  Y_DIR_BIT,  Z_DIR_BIT,  A_DIR_BIT,  B_DIR_BIT };
+
 // handy macro
 #define _f_to_period(f) (uint16_t)((float)F_CPU / (float)f)
 
@@ -317,6 +325,8 @@ stat_t st_motor_power_callback() 	// called by controller
  ****************************************************************************************/
 void _output_to_FIQ() 	// Was an interrupt but now it's called from _load_move
 {
+  PROF_SCOPE(PROF_OUTPUT_FIQ);
+  MB_RECORD(mb_record_output(&st_run, &FIQ_Step_Out));
   unsigned int Next_Step;
   unsigned int This_MDIR = FIQ_Step_Out.cell.set;
 
@@ -380,7 +390,7 @@ void _output_to_FIQ() 	// Was an interrupt but now it's called from _load_move
         {
 //loopcount++;
 //loopcount--;
-            fwrite(&FIQ_Step_Out.value, 8, 1, Fout_fp);
+            xio_write_fiq(&FIQ_Step_Out.value, 8);
 
             FIQ_Step_Out.cell.set = Next_Step | This_MDIR;  // Preset the Next set for the Dirs.
             FIQ_Step_Out.cell.timer = 0x00000000;
@@ -397,6 +407,125 @@ void _output_to_FIQ() 	// Was an interrupt but now it's called from _load_move
 }
 
 
+/****************************************************************************************
+ * _load_curve() - Output a step-exact curve section straight to the FIQ file
+ *
+ *	Used instead of _load_move()/_output_to_FIQ() for MOVE_TYPE_CURVE. The path position
+ *	over the section is p(x) = c1*x + c2*x^2 + c3*x^3, x = 0..1, normalized so p(1) = 1.
+ *	Motor i takes its n'th step where p(x) * curve_steps[i] reaches the residual phase
+ *	plus n, so every step gets its own time instead of the time of a DDA tick.
+ *
+ *	The residual phase of each motor is read from and written back to the DDA phase
+ *	accumulator, so curves and DDA segments can follow each other in any order.
+ *	Cells are written in the same form as _output_to_FIQ(); steps of different motors
+ *	that land on the same tick share a cell.
+ */
+static double _curve_position(double x)
+{
+	return (x * (st_prep.curve_coeff[0] + x * (st_prep.curve_coeff[1] + x * st_prep.curve_coeff[2])));
+}
+
+static double _curve_velocity(double x)
+{
+	return (st_prep.curve_coeff[0] + x * (2 * st_prep.curve_coeff[1] + x * 3 * st_prep.curve_coeff[2]));
+}
+
+// safeguarded Newton solve of p(x) = target on [lo, hi]; p is monotonic on 0..1
+static double _curve_solve(double target, double lo, double hi, double tolerance)
+{
+	double x = lo;
+	for (uint8_t i=0; i<CURVE_SOLVER_ITERATIONS; i++) {
+		double f = _curve_position(x) - target;
+		if (f < 0) { lo = x;} else { hi = x;}
+		double v = _curve_velocity(x);
+		double next = (v > 0) ? (x - f/v) : ((lo + hi) / 2);
+		if ((next <= lo) || (next >= hi)) { next = (lo + hi) / 2;}
+		if (fabs(next - x) < tolerance) { return (next);}
+		x = next;
+	}
+	return (x);
+}
+
+static void _load_curve()
+{
+	PROF_SCOPE(PROF_OUTPUT_FIQ);
+	double ticks = st_prep.dda_ticks;
+	double tolerance = CURVE_SOLVER_TOLERANCE / ticks;
+	double steps[MOTOR_6];			// total steps in the section
+	double next_step[MOTOR_6];		// distance in steps to the next step of each motor
+	double next_x[MOTOR_6];			// x at which that step happens (>1 if not in this section)
+	unsigned int dirs = ALL_ZEROES;
+
+	for (uint8_t i=MOTOR_1; i<MOTOR_6; i++) {
+		steps[i] = st_prep.m[i].curve_steps;
+		if (steps[i] > 0) { _reverse_phase(i);}
+		next_step[i] = (st_run.dda_ticks_X_substeps == 0) ? 0.5 :
+			-(double)st_run.m[i].phase_accumulator / st_run.dda_ticks_X_substeps;
+		next_x[i] = 2;
+		if (steps[i] > 0) {
+			if (st_prep.m[i].dir != 0) { dirs |= Dir_Bit[i];}
+			st_run.m[i].power_state = MOTOR_RUNNING;
+			if (next_step[i] < steps[i]) {
+				next_x[i] = _curve_solve(next_step[i] / steps[i], 0, 1, tolerance);
+			}
+		} else if (st.m[i].power_mode == MOTOR_IDLE_WHEN_STOPPED) {
+			st_run.m[i].power_state = MOTOR_START_IDLE_TIMEOUT;
+		} else {
+			st_run.m[i].power_state = MOTOR_STOPPED;
+		}
+	}
+
+	FIQ_Step_Out.cell.timer = 0x00000001;	// same leading direction cell as _load_move()
+	FIQ_Step_Out.cell.set = dirs;
+	uint32_t last_tick = 0;
+	bool first = true;
+
+	while (true) {
+		double x = 2;
+		for (uint8_t i=MOTOR_1; i<MOTOR_6; i++) {
+			if (next_x[i] < x) { x = next_x[i];}
+		}
+		if (x > 1) break;
+
+		// one step per motor per tick, as with the DDA. A step that rounds onto
+		// the tick of the previous cell is pushed back one tick; one pushed past the
+		// last tick of the section is left owed in the phase handed to the next move,
+		// never written as a cell of 0 ticks.
+		uint32_t tick = (uint32_t)(x * ticks);
+		if ((first == false) && (tick <= last_tick)) { tick = last_tick + 1;}
+		if (tick >= st_prep.dda_ticks) {
+			if ((first == false) && (last_tick >= st_prep.dda_ticks - 1)) break;
+			tick = st_prep.dda_ticks - 1;
+		}
+
+		unsigned int Next_Step = ALL_ZEROES;
+		for (uint8_t i=MOTOR_1; i<MOTOR_6; i++) {
+			if ((next_x[i] <= 1) && ((uint32_t)(next_x[i] * ticks) <= tick)) {
+				Next_Step |= Step_Bit[i];
+				INCREMENT_DIAGNOSTIC_COUNTER(i);
+				next_step[i] += 1;
+				next_x[i] = (next_step[i] < steps[i]) ?
+					_curve_solve(next_step[i] / steps[i], next_x[i], 1, tolerance) : 2;
+			}
+		}
+		FIQ_Step_Out.cell.timer += tick - last_tick;
+		xio_write_fiq(&FIQ_Step_Out.value, 8);
+		FIQ_Step_Out.cell.set = Next_Step | dirs;
+		FIQ_Step_Out.cell.timer = 0x00000000;
+		last_tick = tick;
+		first = false;
+	}
+	FIQ_Step_Out.cell.timer += st_prep.dda_ticks - last_tick;
+
+	// hand the residual phase back to the DDA at the fixed curve phase scale
+	st_run.dda_ticks_X_substeps = CURVE_PHASE_TICKS * DDA_SUBSTEPS;
+	for (uint8_t i=MOTOR_1; i<MOTOR_6; i++) {
+		st_run.m[i].phase_accumulator = -(int32_t)((next_step[i] - steps[i]) * st_run.dda_ticks_X_substeps);
+	}
+	st_run.dda_ticks_downcount = 0;
+}
+
+
 /****************************************************************************************
  * Exec sequencing code - computes and prepares next load segment
  * Used to be a software interrupt. Now it just executes this code.
@@ -418,6 +547,36 @@ void st_request_exec_move()
 }
 
 
+/*
+ * _rescale_phase() - carry a motor's pulse phase into a segment of different length
+ *
+ *	The accumulator holds the part of a step already travelled, scaled by the
+ *	previous segment's ticks. Scale it to the new segment so a slow motor keeps
+ *	its phase instead of stalling or taking a spurious step after the change.
+ *	The first move starts half a step in, so each step fires when the motor is
+ *	nearest to it and a motor is never more than half a step from its position.
+ */
+static int32_t _rescale_phase(int32_t accumulator, int32_t prev_ticks_X_substeps)
+{
+	if (prev_ticks_X_substeps == 0) return (-st_run.dda_ticks_X_substeps / 2);	// first move: half a step
+	return ((int32_t)(((int64_t)accumulator * st_run.dda_ticks_X_substeps) / prev_ticks_X_substeps));
+}
+
+/*
+ * _reverse_phase() - carry a motor's pulse phase into a segment going the other way
+ *
+ *	The accumulator counts up from -1 step to the next step in the direction the motor
+ *	was moving, centred half a step either side of the position. Going back, the motor
+ *	is as far from the step behind it as it was short of the one ahead, so the phase is
+ *	mirrored about the half step: acc = -1 step - acc.
+ */
+static void _reverse_phase(uint8_t motor)
+{
+	if (st_prep.m[motor].dir == st_run.m[motor].dir) return;
+	st_run.m[motor].phase_accumulator = -st_run.dda_ticks_X_substeps - st_run.m[motor].phase_accumulator;
+	st_run.m[motor].dir = st_prep.m[motor].dir;
+}
+
 /*
  * _load_move() - Dequeue move and load into stepper struct
  *
@@ -430,8 +589,19 @@ void st_request_exec_move()
 void _load_move()
 {
 	// handle aline() loads first (most common case)  NB: there are no more lines, only alines()
+	// The last cell of the previous segment is still pending in FIQ_Step_Out.
+	// Write it out before it is overwritten or its step and remaining time are lost.
+	if ((st_prep.move_type == MOVE_TYPE_ALINE) || (st_prep.move_type == MOVE_TYPE_CURVE) ||
+	    (st_prep.move_type == MOVE_TYPE_DWELL))
+	{
+	    if (FIQ_Step_Out.cell.timer != ALL_ZEROES)
+	        xio_write_fiq(&FIQ_Step_Out.value, 8);
+	}
+
 	if (st_prep.move_type == MOVE_TYPE_ALINE)
 	{
+	    int32_t prev_ticks_X_substeps = st_run.dda_ticks_X_substeps;
+
 	    st_run.dda_ticks_downcount = st_prep.dda_ticks;
 	    st_run.dda_ticks_X_substeps = st_prep.dda_ticks_X_substeps;
 
@@ -441,10 +611,11 @@ void _load_move()
 	    st_run.m[MOTOR_1].phase_increment = st_prep.m[MOTOR_1].phase_increment;
 
 	    if (st_prep.reset_flag == true)           // compensate for pulse phasing
-	        st_run.m[MOTOR_1].phase_accumulator = -st_prep.m[MOTOR_1].phase_increment;
+	        st_run.m[MOTOR_1].phase_accumulator = _rescale_phase(st_run.m[MOTOR_1].phase_accumulator, prev_ticks_X_substeps);
 
 	    if (st_run.m[MOTOR_1].phase_increment != 0) 	// motor is in this move
             {
+		_reverse_phase(MOTOR_1);
 		if (st_prep.m[MOTOR_1].dir != 0)
                     FIQ_Step_Out.cell.set |= X_DIR_BIT;
 
@@ -461,10 +632,11 @@ void _load_move()
             st_run.m[MOTOR_2].phase_increment = st_prep.m[MOTOR_2].phase_increment;
 
             if (st_prep.reset_flag == true)           // compensate for pulse phasing
-                st_run.m[MOTOR_2].phase_accumulator = -st_prep.m[MOTOR_2].phase_increment;
+                st_run.m[MOTOR_2].phase_accumulator = _rescale_phase(st_run.m[MOTOR_2].phase_accumulator, prev_ticks_X_substeps);
 
             if (st_run.m[MOTOR_2].phase_increment != 0) 	// motor is in this move
             {
+		_reverse_phase(MOTOR_2);
 		if (st_prep.m[MOTOR_2].dir != 0)
                     FIQ_Step_Out.cell.set |= Y_DIR_BIT;
 
@@ -481,10 +653,11 @@ void _load_move()
             st_run.m[MOTOR_3].phase_increment = st_prep.m[MOTOR_3].phase_increment;
 
             if (st_prep.reset_flag == true)           // compensate for pulse phasing
-                st_run.m[MOTOR_3].phase_accumulator = -st_prep.m[MOTOR_3].phase_increment;
+                st_run.m[MOTOR_3].phase_accumulator = _rescale_phase(st_run.m[MOTOR_3].phase_accumulator, prev_ticks_X_substeps);
 
             if (st_run.m[MOTOR_3].phase_increment != 0) 	// motor is in this move
             {
+		_reverse_phase(MOTOR_3);
 		if (st_prep.m[MOTOR_3].dir != 0)
                     FIQ_Step_Out.cell.set |= Z_DIR_BIT;
 
@@ -501,10 +674,11 @@ void _load_move()
             st_run.m[MOTOR_4].phase_increment = st_prep.m[MOTOR_4].phase_increment;
 
             if (st_prep.reset_flag == true)           // compensate for pulse phasing
-                st_run.m[MOTOR_4].phase_accumulator = -st_prep.m[MOTOR_4].phase_increment;
+                st_run.m[MOTOR_4].phase_accumulator = _rescale_phase(st_run.m[MOTOR_4].phase_accumulator, prev_ticks_X_substeps);
 
             if (st_run.m[MOTOR_4].phase_increment != 0) 	// motor is in this move
             {
+		_reverse_phase(MOTOR_4);
 		if (st_prep.m[MOTOR_4].dir != 0)
                     FIQ_Step_Out.cell.set |= A_DIR_BIT;
 
@@ -521,10 +695,11 @@ void _load_move()
             st_run.m[MOTOR_5].phase_increment = st_prep.m[MOTOR_5].phase_increment;
 
             if (st_prep.reset_flag == true)           // compensate for pulse phasing
-                st_run.m[MOTOR_5].phase_accumulator = -st_prep.m[MOTOR_5].phase_increment;
+                st_run.m[MOTOR_5].phase_accumulator = _rescale_phase(st_run.m[MOTOR_5].phase_accumulator, prev_ticks_X_substeps);
 
             if (st_run.m[MOTOR_5].phase_increment != 0) 	// motor is in this move
             {
+		_reverse_phase(MOTOR_5);
 		if (st_prep.m[MOTOR_5].dir != 0)
                     FIQ_Step_Out.cell.set |= B_DIR_BIT;
 
@@ -540,6 +715,10 @@ void _load_move()
 
             _output_to_FIQ();
 	}
+	else if (st_prep.move_type == MOVE_TYPE_CURVE)  // step-exact curve sections
+	{
+            _load_curve();
+	}
 	else if (st_prep.move_type == MOVE_TYPE_DWELL)  // handle dwells
 	{
             FIQ_Step_Out.cell.timer = st_prep.dda_ticks; //Directly add to the FIQ delay counter.
@@ -555,6 +734,40 @@ void _load_move()
 }
 
 
+#ifdef __MICROBENCH
+/*
+ * st_bench_load()			- put back the loader state a segment was output from
+ * st_bench_output_to_FIQ() - _output_to_FIQ() for the microbenchmarks (microbench.cpp)
+ * st_bench_exec_state()	- give the prep buffer to the exec or the loader; returns the old owner
+ */
+void st_bench_load(const stRunSingleton_t *run, const void *out)
+{
+	memcpy(&st_run, run, sizeof(st_run));
+	memcpy(&FIQ_Step_Out, out, sizeof(FIQ_Step_Out));
+}
+
+void st_bench_output_to_FIQ() { _output_to_FIQ();}
+
+uint8_t st_bench_exec_state(uint8_t exec_state)
+{
+	uint8_t old = st_prep.exec_state;
+	st_prep.exec_state = exec_state;
+	return (old);
+}
+#endif // __MICROBENCH
+
+
+/*
+ * st_get_cells() - FIQ cells output so far, counting the one still being timed
+ *
+ *	Between loads that is every cell of the moves loaded so far (verify.cpp).
+ */
+uint64_t st_get_cells()
+{
+	return ((xw.bytes_in + xw.len) / sizeof(fiq_cell_t) + (FIQ_Step_Out.cell.timer != ALL_ZEROES));
+}
+
+
 /*
  * st_prep_null() - Keeps the loader happy. Otherwise performs no action
  *
@@ -591,6 +804,9 @@ void st_prep_dwell(float microseconds)
  */
 stat_t st_prep_line(float steps[], float microseconds)
 {
+	PROF_SCOPE(PROF_PREP_LINE);
+	MB_RECORD(mb_record_prep_line(steps, microseconds));
+
 	// *** defensive programming ***
 	// trap conditions that would prevent queuing the line
 	if (st_prep.exec_state != PREP_BUFFER_OWNED_BY_EXEC) { return (STAT_INTERNAL_ERROR);
@@ -611,12 +827,12 @@ stat_t st_prep_line(float steps[], float microseconds)
         for (uint8_t i=0; i<MOTORS; i++)
         {
             st_prep.m[i].dir = ((steps[i] < 0) ? 1 : 0) ^ st.m[i].polarity;
-		    st_prep.m[i].phase_increment = (uint32_t)fabs(steps[i] * DDA_SUBSTEPS);
+		    st_prep.m[i].phase_increment = (uint32_t)(fabs(steps[i] * DDA_SUBSTEPS) + 0.5);	// rounded - truncating loses steps
 //printf("Motor %d has %lf steps the result is %d\n", i, steps[i], st_prep.m[i].phase_increment);
         }
 
-    // anti-stall measure in case change in velocity between segments is too great
-	if ((st_prep.dda_ticks * ACCUMULATOR_RESET_FACTOR) < st_prep.prev_ticks) {  // NB: uint32_t math
+    // carry pulse phasing across a change in segment length (see _rescale_phase())
+	if (st_prep.dda_ticks != st_prep.prev_ticks) {
 		st_prep.reset_flag = true;
 	}
 	st_prep.prev_ticks = st_prep.dda_ticks;
@@ -625,6 +841,44 @@ stat_t st_prep_line(float steps[], float microseconds)
 }
 
 
+/***********************************************************************************
+ * st_prep_curve() - Prepare a step-exact curve section for the loader
+ *
+ *	A curve section is one jerk-limited piece of an S-curve: the path position is
+ *	s(t) = v0*t + a0*t^2/2 + jerk*t^3/6 over the section time. Step times are computed
+ *	directly from this polynomial by _load_curve() - no DDA and no sub-segments.
+ *
+ * Args:
+ *	steps[] are signed relative motion in steps for the whole section
+ *	microseconds - how long the section runs
+ *	v0, a0, jerk are the initial velocity, initial acceleration and jerk with time
+ *	  normalized to the section (i.e. v0*T, a0*T^2, jerk*T^3). Only their ratios matter.
+ */
+stat_t st_prep_curve(float steps[], float microseconds, float v0, float a0, float jerk)
+{
+	if (st_prep.exec_state != PREP_BUFFER_OWNED_BY_EXEC) { return (STAT_INTERNAL_ERROR);
+	} else if (isfinite(microseconds) == false) { return (STAT_INPUT_EXCEEDS_MAX_LENGTH);
+	} else if (microseconds < EPSILON) { return (STAT_MINIMUM_TIME_MOVE_ERROR);
+	}
+	float length = v0 + a0/2 + jerk/6;
+	if (length < EPSILON) { return (STAT_MINIMUM_LENGTH_MOVE_ERROR);}	// must be a forward path
+	st_prep.curve_coeff[0] = v0 / length;
+	st_prep.curve_coeff[1] = a0 / (2 * length);
+	st_prep.curve_coeff[2] = jerk / (6 * length);
+
+	st_prep.dda_ticks = (uint32_t)((microseconds/1000000) * FREQUENCY_DDA);
+	if (st_prep.dda_ticks == 0) { return (STAT_MINIMUM_TIME_MOVE_ERROR);}
+
+	for (uint8_t i=0; i<MOTORS; i++) {
+		st_prep.m[i].dir = ((steps[i] < 0) ? 1 : 0) ^ st.m[i].polarity;
+		st_prep.m[i].curve_steps = fabs(steps[i]);
+	}
+	st_prep.prev_ticks = CURVE_PHASE_TICKS;	// accumulators are left at this scale
+	st_prep.move_type = MOVE_TYPE_CURVE;
+	return (STAT_OK);
+}
+
+
 /*
  * _set_hw_microsteps() - set microsteps in hardware
  *
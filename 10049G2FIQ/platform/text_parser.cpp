@@ -48,6 +48,7 @@
 #include "text_parser.h"
 //#include "json_parser.h"
 #include "report.h"
+#include "status_page.h"
 #include "xio.h"					// for ASCII char definitions
 
 #ifdef __cplusplus
@@ -101,6 +102,7 @@ stat_t text_parser(char *str)
 	} else { 								// process SET and RUN commands
 		status = cmd_set(cmd);				// set (or run) single value
 		cmd_persist(cmd);					// conditionally persist depending on flags in array
+		if (status == STAT_OK) { cmd_commit_NVM();}	// the setting reaches the config file now
 	}
     cmd_print_list(status, TEXT_MULTILINE_FORMATTED, 0); // Was JSON_RESPONSE_FORMAT but it's unused.
 	return (status);
@@ -161,6 +163,9 @@ static const char prompt_cmd[] PROGMEM = "Cmd type %s\n";
 
 void text_response(const stat_t status, char *buf)
 {
+	if ((status != STAT_OK) && (status != STAT_EAGAIN) && (status != STAT_NOOP)) {
+		sp_error(status, buf);				// the status page gets errors even when silent
+	}
 	if (txt.text_verbosity == TV_SILENT) return;	// skip all this
 
 	if ((status == STAT_OK) || (status == STAT_EAGAIN) || (status == STAT_NOOP))
@@ -51,7 +51,6 @@
 
 #include "tinyg2.h"  // 1
 #include "util.h"    // 2
-#include "quicklz.h" // 3
 
 #ifdef __cplusplus
 extern "C"{
@@ -239,6 +238,31 @@ uint16_t compute_checksum(char const *string, const uint16_t length)
 }
 
 
+/*
+ * compute_hash() - add a buffer to a 64 bit hash
+ *
+ *	Multiply-xorshift mixing of 8 bytes per step. Not cryptographic - it identifies
+ *	file contents and configs for the caches (gcode_cache.cpp, output_cache.cpp).
+ */
+uint64_t compute_hash(uint64_t hash, const void *buf, size_t size)
+{
+	const uint64_t prime = 0x9E3779B97F4A7C15ULL;
+	const uint8_t *bytes = (const uint8_t *)buf;
+	size_t i = 0;
+
+	for (; i + 8 <= size; i += 8) {
+		uint64_t x;
+		memcpy(&x, bytes + i, 8);
+		hash = (hash ^ x) * prime;
+		hash ^= hash >> 29;
+	}
+	for (; i < size; i++) {
+		hash = (hash ^ bytes[i]) * prime;
+	}
+	return (hash ^ (hash >> 32));
+}
+
+
 /*
  * SysTickTimer_getValue() - this is a hack to get around some compatibility problems
  */
@@ -257,71 +281,6 @@ uint32_t SysTickTimer_getValue()
 #endif
 
 
-// Returns the number of lines in the file. Only use is for counting the percent that the program has parsed.
-int fLineCount(FILE *file)
-{
-  int lines = 0;
-  char buf[255];
-
-    while (fgets(buf, sizeof(buf), file) != NULL)
-    {
-        if( feof(file) )
-            break;
-        lines++;
-    }
-
-    printf("0x%x Lines in input file.\n", lines);
-
-    if (fseek(file, 0, SEEK_SET) < 0)
-    {
-        return -1;
-    }
-    else
-    {
-        return lines;
-    }
-}
-
-
-#if(QLZ_STREAMING_BUFFER == 0)
-#error Define QLZ_STREAMING_BUFFER to a non-zero value for this demo
-#endif
-
-// Stolen from quicklz site. http://www.quicklz.com/stream_compress.c. It compresses the input, and returns the amount of bytes saved.
-unsigned long compressFile(FILE *ifile, FILE *ofile)
-{
-    char *file_data, * compressed;
-    size_t d, c;
-    unsigned long bytes_saved = 0;
-    qlz_state_compress *state_compress = (qlz_state_compress *)malloc(sizeof(qlz_state_compress));
-
-    // allocate "uncompressed size" + 400 bytes for the destination buffer where
-    // "uncompressed size" = 10000 in worst case in this sample demo
-    file_data = (char * )malloc(10000);
-    compressed = (char *) malloc(10000 + 400);
-
-    // allocate and initially zero out the states. After this, make sure it is
-    // preserved across calls and never modified manually
-    memset(state_compress, 0, sizeof(qlz_state_compress));
-
-    // compress the file in random sized packets
-    while ((d = fread(file_data, 1, rand() % 10000 + 1, ifile)) != 0)
-    {
-        c = qlz_compress(file_data, compressed, d, state_compress);
-        //printf("%u bytes compressed into %u\n", (unsigned int)d, (unsigned int)c);
-		bytes_saved += ((unsigned int)d - (unsigned int)c);
-        // the buffer "compressed" now contains c bytes which we could have sent directly to a
-        // decompressing site for decompression
-        fwrite(compressed, c, 1, ofile);
-    }
-
-    free(file_data);
-    free(compressed);
-    fclose(ifile);
-    fclose(ofile);
-    return bytes_saved;
-}
-
 #ifdef __cplusplus
 }
 #endif
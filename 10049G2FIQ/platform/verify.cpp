@@ -0,0 +1,195 @@
+/*
+ * FILE NAME: verify.cpp - FIQ output verifier
+ *
+ * Copyright (c) 2014 Robert K. Parker
+ *
+ * This file was part of the TinyG project
+ *
+ * Copyright (c) 2010 - 2013 Alden S. Hart, Jr.
+ *
+ * Now it is in crystalfontz3D
+ *
+ * This file ("the software") is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2 as published by the
+ * Free Software Foundation. You should have received a copy of the GNU General Public
+ * License, version 2 along with the software.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * THE SOFTWARE IS DISTRIBUTED IN THE HOPE THAT IT WILL BE USEFUL, BUT WITHOUT ANY
+ * WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT
+ * SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+/*
+ * PURPOSE:	Checks that the FIQ cells written step the motors to the G code's targets.
+ *
+ * NOTES:	See verify.h.
+ *
+ *
+ * CHANGE HISTORY:
+ *
+ *    Revision: Initial 1.0
+ *    User: R.K.Parker     Date: 05/29/14
+ *    First prototype.
+ *
+ */
+
+#include "tinyg2.h"			// #1
+#include "config.h"			// #2
+#include "canonical_machine.h"
+#include "planner.h"
+#include "stepper.h"
+#include "fiq_stat.h"
+#include "verify.h"
+#include "hardware.h"
+#include "util.h"
+#include "cfa10049_fiq.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+vfSingleton_t vf;						// output verifier singleton
+
+static const uint32_t step_bit[MOTOR_6] = { X_STEP_BIT, Y_STEP_BIT, Z_STEP_BIT, A_STEP_BIT, B_STEP_BIT };
+static const uint32_t dir_bit[MOTOR_6] = { X_DIR_BIT, Y_DIR_BIT, Z_DIR_BIT, A_DIR_BIT, B_DIR_BIT };
+static const char *const motor_name[MOTOR_6] = { "x", "y", "z", "a", "b" };
+
+static void _cells(const char *data, size_t count);
+static void _check(const vfMark_t *mark);
+
+/*
+ * vf_start() - drop the last job's marks; start marking if enabled
+ */
+void vf_start(uint8_t enabled)
+{
+	free(vf.mark);
+	memset(&vf, 0, sizeof(vf));
+	vf.enabled = enabled;
+	for (uint8_t axis=AXIS_X; axis<AXES; axis++) {
+		vf.start[axis] = mp_get_runtime_absolute_position(axis);
+	}
+}
+
+/*
+ * vf_block() - a block has run its last segment
+ *
+ *	The segment is loaded after this returns, so the mark is made by the next
+ *	vf_mark() - the next call to mp_exec_move(), or vf_finish().
+ */
+void vf_block(const mpBuf_t *bf)
+{
+	vf.next.line = bf->line;
+	copy_axis_vector(vf.next.target, bf->gm.target);
+	vf.pending = true;
+}
+
+/*
+ * vf_mark() - mark the block that finished, now its cells are all written
+ *
+ *	The marks grow by VF_CHUNK. If they can't, marking stops and vf_finish() fails.
+ */
+void vf_mark()
+{
+	vf.pending = false;
+	if (vf.marks == vf.size) {
+		vfMark_t *mark = (vfMark_t *)realloc(vf.mark, (vf.size + VF_CHUNK) * sizeof(vfMark_t));
+		if (mark == NULL) {
+			vf.enabled = false;
+			vf.failed = true;
+			return;
+		}
+		vf.mark = mark;
+		vf.size += VF_CHUNK;
+	}
+	vf.next.cells = st_get_cells();
+	vf.mark[vf.marks++] = vf.next;
+}
+
+/*
+ * vf_finish() - read the output back and check it against the marks
+ *
+ *	Marks past the end of the file - the last cell is never written out if the
+ *	stepper is still timing it - are checked against the file's end.
+ */
+stat_t vf_finish(const char *path, uint8_t compressed)
+{
+	stat_t status;
+
+	if (vf.pending) { vf_mark();}
+	if (vf.failed) {
+		vf_start(false);
+		return (STAT_BUFFER_FULL);
+	}
+	status = fs_read(path, compressed, sizeof(fiq_cell_t), _cells);
+	for (; vf.checked < vf.marks; vf.checked++) { _check(&vf.mark[vf.checked]);}
+
+	free(vf.mark);
+	vf.mark = NULL;
+	vf.marks = vf.size = 0;
+	return (status);
+}
+
+/*
+ * vf_print() - print the result of the last vf_finish()
+ */
+void vf_print()
+{
+	printf("Verified %u blocks: %u off by more than %.0f step%s.", vf.checked, vf.total_off,
+		   VF_TOLERANCE, (VF_TOLERANCE == 1) ? "" : "s");
+	for (uint8_t motor=MOTOR_1; motor<MOTOR_6; motor++) {
+		if (vf.max_miss[motor] == 0) continue;
+		printf(" %s %.2f at line %u.", motor_name[motor], vf.max_miss[motor], vf.max_line[motor]);
+	}
+	printf("\n");
+}
+
+/*
+ * _cells() - add up the steps of a buffer of cells, checking each mark as its cells are in
+ */
+static void _cells(const char *data, size_t count)
+{
+	const fiq_cell_t *cell = (const fiq_cell_t *)data;
+	const fiq_cell_t *end = cell + count;
+	uint64_t next = (vf.checked < vf.marks) ? vf.mark[vf.checked].cells : UINT64_MAX;
+
+	for (; cell < end; cell++) {
+		while (vf.cells == next) {					// the cells so far make up the block
+			_check(&vf.mark[vf.checked++]);
+			next = (vf.checked < vf.marks) ? vf.mark[vf.checked].cells : UINT64_MAX;
+		}
+		if (cell->set & ALL_STEPS) {
+			for (uint8_t motor=MOTOR_1; motor<MOTOR_6; motor++) {
+				if ((cell->set & step_bit[motor]) == 0) continue;
+				// a set direction bit is a negative move unless the motor's polarity is reversed
+				vf.steps[motor] += (((cell->set & dir_bit[motor]) != 0) != st.m[motor].polarity) ? -1 : 1;
+			}
+		}
+		vf.cells++;
+	}
+}
+
+/*
+ * _check() - compare the step counts with a mark's target
+ */
+static void _check(const vfMark_t *mark)
+{
+	uint8_t off = false;
+
+	for (uint8_t motor=MOTOR_1; motor<MOTOR_6; motor++) {
+		uint8_t axis = st.m[motor].motor_map;
+		if ((axis >= AXES) || (cm.a[axis].axis_mode == AXIS_INHIBITED)) continue;
+		float miss = fabs((double)vf.steps[motor] - ((double)mark->target[axis] - vf.start[axis]) * st.m[motor].steps_per_unit);
+		if (miss > VF_TOLERANCE) { off = true;}
+		if (miss > vf.max_miss[motor]) {
+			vf.max_miss[motor] = miss;
+			vf.max_line[motor] = mark->line;
+		}
+	}
+	if (off) { vf.total_off++;}
+}
+
+#ifdef __cplusplus
+}
+#endif
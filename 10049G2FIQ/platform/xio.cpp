@@ -0,0 +1,454 @@
+/*
+ * FILE NAME: xio.cpp - extended IO functions: the G code file reader and FIQ cell writer
+ *
+ * Copyright (c) 2014 Robert K. Parker
+ *
+ * This file was part of TInyG2 project
+ *
+ * Copyright (c) 2013 Alden S. Hart Jr.
+ * Copyright (c) 2013 Robert Giseburt
+ *
+ * Now it is in crystalfontz3D
+ *
+ * This file ("the software") is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License, version 2 as published by the
+ * Free Software Foundation. You should have received a copy of the GNU General Public
+ * License, version 2 along with the software.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * As a special exception, you may use this file as part of a software library without
+ * restriction. Specifically, if other files instantiate templates or use macros or
+ * inline functions from this file, or you compile this file and link it with  other
+ * files to produce an executable, this file does not by itself cause the resulting
+ * executable to be covered by the GNU General Public License. This exception does not
+ * however invalidate any other reasons why the executable file might be covered by the
+ * GNU General Public License.
+ *
+ * THE SOFTWARE IS DISTRIBUTED IN THE HOPE THAT IT WILL BE USEFUL, BUT WITHOUT ANY
+ * WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT
+ * SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF
+ * OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+/*
+ * PURPOSE: Reads the G code input file as line views and writes the FIQ cell output.
+ *
+ * NOTES:	Replaces fgets() on the input file. Lines are found with memchr(), which
+ *	is the vectorized newline scan of the C library, and are handed out in place -
+ *	the only copy of the text is the one the kernel makes for a pipe read().
+ *
+ *	Replaces fwrite() of each cell to the output file, and the compress-afterwards
+ *	temporary file. Input and output can both be pipes:
+ *
+ *		slicer | 10049G2FIQ -g - -f - -v | loader
+ *
+ *	runs in bounded memory, and the loader gets its first cells as soon as the
+ *	first buffer is full.
+ *
+ *
+ * CHANGE HISTORY:
+ *
+ *    Revision: Initial 1.0
+ *    User: R.K.Parker     Date: 05/29/14
+ *    First prototype.
+ *
+ */
+
+#include "tinyg2.h"
+#include "config.h"
+#include "canonical_machine.h"
+#include "planner.h"
+#include "stepper.h"
+#include "xio.h"
+#include "profile.h"
+#include "microbench.h"
+#include "metrics.h"
+#include "util.h"
+#include "quicklz.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+xioReader_t xr = { -1 };			// G code file reader singleton
+xioWriter_t xw = { -1, -1 };		// FIQ cell writer singleton
+
+#if (QLZ_STREAMING_BUFFER < XIO_WRITE_BUFFER_LEN)
+#error QLZ_STREAMING_BUFFER must hold a whole XIO_WRITE_BUFFER_LEN packet
+#endif
+
+static uint32_t _xio_count_lf(const char *buf, size_t size);
+static uint64_t _xio_page_base(uint64_t offset);
+static stat_t _xio_map_window(uint64_t offset);
+static stat_t _xio_refill(void);
+static void _xio_write(const char *data, size_t len);
+static uint8_t _xio_write_fd(int fd, const char *data, size_t len);
+
+/*
+ * xio_open_gcode() - open the G code input file for xio_read_line()
+ *
+ *	Maps regular files. Falls back to the read-ahead buffer for pipes, character
+ *	devices and anything else mmap() refuses.
+ */
+stat_t xio_open_gcode(const char *path)
+{
+	struct stat sb;
+
+	xio_close_gcode();
+	memset(&xr, 0, sizeof(xr));
+	if (strcmp(path, XIO_STDIO) == 0) {
+		xr.fd = dup(STDIN_FILENO);						// a stdin redirected from a file still maps
+		xr.is_stdin = true;
+	} else {
+		xr.fd = open(path, O_RDONLY);
+	}
+	if (xr.fd < 0) { return (STAT_FILE_NOT_OPEN);}
+
+	if ((fstat(xr.fd, &sb) == 0) && (S_ISREG(sb.st_mode))) {
+		xr.file_size = sb.st_size;
+		xr.mapped = true;
+		if (xr.file_size == 0) { return (STAT_OK);}			// nothing to map - reads return EOF
+		if (_xio_map_window(0) == STAT_OK) { return (STAT_OK);}
+		xr.mapped = false;
+	}
+	if ((xr.buf = (char *)malloc(XIO_READ_BUFFER_LEN)) == NULL) {
+		xio_close_gcode();
+		return (STAT_FILE_NOT_OPEN);
+	}
+	return (STAT_OK);
+}
+
+/*
+ * xio_close_gcode() - release the mapping or read-ahead buffer and close the file
+ */
+void xio_close_gcode()
+{
+	if (xr.buf != NULL) {
+		if (xr.mapped) {
+			munmap(xr.buf, xr.size);
+		} else {
+			free(xr.buf);
+		}
+		xr.buf = NULL;
+	}
+	if (xr.fd >= 0) { close(xr.fd);}
+	xr.fd = -1;
+}
+
+/*
+ * xio_read_line() - return a view of the next input line
+ *
+ *	Sets *line and *len to the next line including its LF (the last line of the
+ *	file may not have one). A line longer than the buffer is cut at the buffer
+ *	length and the rest comes back as the next line.
+ *
+ *	Returns STAT_OK or STAT_EOF.
+ */
+stat_t xio_read_line(char **line, uint32_t *len)
+{
+	if (xr.buf == NULL) { return (STAT_EOF);}			// empty file
+	while (true) {
+		char *start = xr.buf + xr.rd;
+		size_t avail = xr.size - xr.rd;
+		char *lf = (char *)memchr(start, LF, avail);
+
+		if ((lf == NULL) && (_xio_refill() == STAT_OK)) continue;	// got more to scan
+		if (lf != NULL) {
+			avail = lf - start + 1;
+		} else if (avail == 0) {
+			return (STAT_EOF);
+		}
+		*line = start;
+		*len = avail;
+		xr.rd += avail;
+		xr.offset += avail;
+		return (STAT_OK);
+	}
+}
+
+/*
+ * xio_count_lines() - count the lines of a mapped input file
+ *
+ *	Only run when asked for (-l) - it is a full extra pass over the file.
+ *	Scans the file a window at a time without disturbing the read position.
+ *	Returns 0 for inputs that can't be mapped (pipes) - they can only be read once.
+ */
+uint32_t xio_count_lines()
+{
+	uint32_t lines = 0;
+
+	if (!xr.mapped) { return (0);}
+	for (uint64_t offset = 0; offset < xr.file_size; offset += XIO_MAP_WINDOW) {
+		size_t size = min((uint64_t)XIO_MAP_WINDOW, xr.file_size - offset);
+		char *buf = (char *)mmap(NULL, size, PROT_READ, MAP_PRIVATE, xr.fd, offset);
+		if (buf == MAP_FAILED) { return (lines);}
+		madvise(buf, size, MADV_SEQUENTIAL);
+
+		lines += _xio_count_lf(buf, size);
+		if ((offset + size == xr.file_size) && (buf[size-1] != LF)) { lines++;}	// unterminated last line
+		munmap(buf, size);
+	}
+	return (lines);
+}
+
+/*
+ * xio_hash_gcode() - 64 bit hash of a mapped input file
+ *
+ *	Identifies the file contents for the caches (gcode_cache.cpp, output_cache.cpp).
+ *	A full pass like xio_count_lines(), but at memory speed, and only made once per
+ *	file. Returns 0 for inputs that can't be mapped.
+ */
+uint64_t xio_hash_gcode()
+{
+	uint64_t hash = xr.file_size;
+
+	if (!xr.mapped) { return (0);}
+	if (xr.hashed) { return (xr.hash);}
+	for (uint64_t offset = 0; offset < xr.file_size; offset += XIO_MAP_WINDOW) {
+		size_t size = min((uint64_t)XIO_MAP_WINDOW, xr.file_size - offset);
+		char *buf = (char *)mmap(NULL, size, PROT_READ, MAP_PRIVATE, xr.fd, offset);
+		if (buf == MAP_FAILED) { return (0);}
+		madvise(buf, size, MADV_SEQUENTIAL);
+		hash = compute_hash(hash, buf, size);
+		munmap(buf, size);
+	}
+	xr.hash = hash;
+	xr.hashed = true;
+	return (hash);
+}
+
+/*
+ * xio_get_percent() - percentage of the input handed out so far
+ *
+ *	Byte based, so no line count is needed. Returns -1 if the input size is not
+ *	known (pipes).
+ */
+int8_t xio_get_percent()
+{
+	if ((!xr.mapped) || (xr.file_size == 0)) { return (-1);}
+	return ((int8_t)(xr.offset * 100 / xr.file_size));
+}
+
+/*
+ * xio_claim_stdout() - take stdout for the FIQ cells
+ *
+ *	Called before anything is printed when the output path is XIO_STDIO. The real
+ *	stdout is kept for the cells and the stdout descriptor is pointed at stderr, so
+ *	every message of the program stays out of the cell stream without touching the
+ *	printf()s that make them.
+ */
+void xio_claim_stdout()
+{
+	fflush(stdout);
+	if (xw.stdout_fd < 0) { xw.stdout_fd = dup(STDOUT_FILENO);}
+	dup2(STDERR_FILENO, STDOUT_FILENO);
+}
+
+/*
+ * xio_open_fiq() - open the FIQ cell output, compressed or not
+ */
+stat_t xio_open_fiq(const char *path, uint8_t compress)
+{
+	int stdout_fd = xw.stdout_fd;
+
+	xio_close_fiq();
+	memset(&xw, 0, sizeof(xw));
+	xw.stdout_fd = stdout_fd;
+	xw.tee_fd = -1;
+	if (strcmp(path, XIO_STDIO) == 0) {
+		if (xw.stdout_fd < 0) { xio_claim_stdout();}
+		xw.fd = xw.stdout_fd;
+	} else {
+		xw.fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	}
+	if (xw.fd < 0) { return (STAT_FILE_NOT_OPEN);}
+
+	xw.compress = compress;
+	xw.buf = (char *)malloc(XIO_WRITE_BUFFER_LEN);
+	if (compress) {
+		xw.packet = (char *)malloc(XIO_WRITE_BUFFER_LEN + 400);	// QuickLZ worst case expansion
+		xw.state = calloc(1, sizeof(qlz_state_compress));			// zeroed before the first packet
+	}
+	if ((xw.buf == NULL) || (compress && ((xw.packet == NULL) || (xw.state == NULL)))) {
+		xio_close_fiq();
+		return (STAT_FILE_NOT_OPEN);
+	}
+	return (STAT_OK);
+}
+
+/*
+ * xio_tee_fiq() - also write the output to fd, exactly as it goes out (output_cache.cpp)
+ */
+void xio_tee_fiq(int fd)
+{
+	xw.tee_fd = fd;
+	xw.tee_error = false;
+}
+
+/*
+ * xio_flush_fiq() - write out the buffered cells, as one packet if compressing
+ */
+void xio_flush_fiq()
+{
+	if (xw.len == 0) { return;}
+	MB_RECORD(mb_record_buffer(xw.buf, xw.len));
+	jm_cells(xw.buf, xw.len);
+	xw.bytes_in += xw.len;
+	if (xw.compress) {
+		size_t len;
+		{
+			PROF_SCOPE(PROF_COMPRESS);
+			len = qlz_compress(xw.buf, xw.packet, xw.len, (qlz_state_compress *)xw.state);
+		}
+		_xio_write(xw.packet, len);
+	} else {
+		_xio_write(xw.buf, xw.len);
+	}
+	xw.len = 0;
+}
+
+/*
+ * xio_close_fiq() - flush and close the output
+ *
+ *	Returns STAT_FILE_NOT_OPEN if any of the output could not be written.
+ *	bytes_in and bytes_out are kept for the end of job report.
+ */
+stat_t xio_close_fiq()
+{
+	stat_t status = STAT_OK;
+
+	if (xw.fd >= 0) {
+		xio_flush_fiq();
+		if ((xw.fd != xw.stdout_fd) && (close(xw.fd) != 0)) { xw.error = true;}
+		if (xw.error) { status = STAT_FILE_NOT_OPEN;}
+	}
+	free(xw.buf);
+	free(xw.packet);
+	free(xw.state);
+	xw.buf = xw.packet = NULL;
+	xw.state = NULL;
+	xw.len = 0;
+	xw.fd = -1;
+	xw.tee_fd = -1;								// tee_error is kept for the owner of the tee
+	return (status);
+}
+
+/*
+ * _xio_write() 	- write to the output, and the tee if there is one
+ * _xio_write_fd()	- write all of a buffer, retrying short writes. Returns false on error
+ */
+static void _xio_write(const char *data, size_t len)
+{
+	PROF_SCOPE(PROF_WRITE);
+
+	if (_xio_write_fd(xw.fd, data, len)) {
+		xw.bytes_out += len;
+	} else {
+		xw.error = true;
+	}
+	if ((xw.tee_fd >= 0) && (!xw.tee_error)) {
+		xw.tee_error = !_xio_write_fd(xw.tee_fd, data, len);
+	}
+}
+
+static uint8_t _xio_write_fd(int fd, const char *data, size_t len)
+{
+	while (len > 0) {
+		ssize_t count = write(fd, data, len);
+		if (count < 0) {
+			if (errno == EINTR) continue;
+			return (false);
+		}
+		data += count;
+		len -= count;
+	}
+	return (true);
+}
+
+/*
+ * _xio_count_lf() - count the LFs in a buffer
+ *
+ *	Tests 8 bytes per step (SIMD within a register): a byte of x is zero where the
+ *	input byte is LF, and the expression below sets the high bit of exactly those
+ *	bytes, so a popcount gives the number of LFs in the word. Portable to any 32 or
+ *	64 bit target; the compiler turns the popcount into the native instruction.
+ */
+static uint32_t _xio_count_lf(const char *buf, size_t size)
+{
+	const uint64_t ones = 0x0101010101010101ULL;
+	const uint64_t low7 = 0x7F7F7F7F7F7F7F7FULL;
+	uint32_t count = 0;
+	size_t i = 0;
+
+	for (; i + 8 <= size; i += 8) {
+		uint64_t x;
+		memcpy(&x, buf + i, 8);							// unaligned safe load
+		x ^= ones * LF;
+		count += __builtin_popcountll(~(((x & low7) + low7) | x | low7));
+	}
+	for (; i < size; i++) {
+		if (buf[i] == LF) { count++;}
+	}
+	return (count);
+}
+
+/*
+ * _xio_page_base()	 - file offset of the page holding offset (mmap offsets must be page aligned)
+ * _xio_map_window() - map XIO_MAP_WINDOW bytes of the file starting at the page holding offset
+ */
+static uint64_t _xio_page_base(uint64_t offset)
+{
+	return (offset & ~((uint64_t)sysconf(_SC_PAGESIZE) - 1));
+}
+
+static stat_t _xio_map_window(uint64_t offset)
+{
+	uint64_t base = _xio_page_base(offset);
+	size_t size = min((uint64_t)XIO_MAP_WINDOW, xr.file_size - base);
+	char *buf = (char *)mmap(NULL, size, PROT_READ, MAP_PRIVATE, xr.fd, base);
+
+	if (buf == MAP_FAILED) { return (STAT_FILE_NOT_OPEN);}
+	madvise(buf, size, MADV_SEQUENTIAL);
+	if (xr.buf != NULL) { munmap(xr.buf, xr.size);}
+	xr.buf = buf;
+	xr.size = size;
+	xr.base = base;
+	xr.rd = offset - base;
+	return (STAT_OK);
+}
+
+/*
+ * _xio_refill() - get more input behind the partial line at the end of the buffer
+ *
+ *	Slides the mapped window up to the partial line, or moves the partial line to
+ *	the front of the read-ahead buffer and reads behind it. Returns STAT_OK if there
+ *	is more of the line to scan, STAT_EOF if there is no more input or the line
+ *	already fills the whole buffer.
+ */
+static stat_t _xio_refill()
+{
+	if (xr.mapped) {
+		if ((xr.buf == NULL) || (xr.base + xr.size >= xr.file_size)) { return (STAT_EOF);}
+		if (_xio_page_base(xr.base + xr.rd) == xr.base) { return (STAT_EOF);}	// line fills the window
+		return (_xio_map_window(xr.base + xr.rd));
+	}
+	if (xr.eof) { return (STAT_EOF);}
+	if (xr.rd > 0) {
+		memmove(xr.buf, xr.buf + xr.rd, xr.size - xr.rd);
+		xr.size -= xr.rd;
+		xr.rd = 0;
+	}
+	while (xr.size < XIO_READ_BUFFER_LEN) {
+		ssize_t count = read(xr.fd, xr.buf + xr.size, XIO_READ_BUFFER_LEN - xr.size);
+		if (count > 0) {
+			xr.size += count;
+			return (STAT_OK);
+		}
+		if ((count < 0) && (errno == EINTR)) continue;
+		xr.eof = true;
+		return (STAT_EOF);
+	}
+	return (STAT_EOF);									// line fills the whole buffer
+}